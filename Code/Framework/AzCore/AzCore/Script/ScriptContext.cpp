@@ -13,6 +13,8 @@
 #include <AzCore/Script/ScriptContextDebug.h>
 #include <AzCore/Script/ScriptProperty.h>
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Script/lua/lua.h>
 #include <AzCore/IO/GenericStreams.h>
@@ -400,6 +402,193 @@ namespace AZ
         ///////////////////////////////////////////////////////////////////////////////////////////////
         AZ_ALLOCATOR_DEFAULT_GLOBAL_WRAPPER(LuaSystemAllocator, AZ::SystemAllocator, "{7BEFB496-76EC-43DB-AB82-5ABA524FEF7F}")
 
+        ///////////////////////////////////////////////////////////////////////////////////////////////
+        // Pools the small allocations of a Lua VM in per size free lists. Most of the allocations made by a
+        // BehaviorContext call from Lua are the short lived userdata of value types (Vector3, Quaternion, EntityId...),
+        // these are recycled from the pool instead of going to the allocator for every temporary.
+        // A VM is used from one thread only. Pages are aligned to their size, so a block finds its page from its address,
+        // and each page counts its blocks in use. Trim returns the pages without any block in use to the allocator, after
+        // a full garbage collection, and the remaining pages are returned when the pool is destroyed, after the VM is closed.
+        class LuaAllocationPool
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(LuaAllocationPool, AZ::SystemAllocator, 0);
+
+            static constexpr size_t BlockGranularity = 16; // matches the alignment Lua requires of the allocations
+            static constexpr size_t MaxPooledSize = 256;
+            static constexpr size_t PageSize = 16 * 1024;
+            static_assert((PageSize & (PageSize - 1)) == 0, "Pages are aligned to their size, which must be a power of two");
+
+            explicit LuaAllocationPool(IAllocator* allocator)
+                : m_allocator(allocator)
+            {
+            }
+
+            ~LuaAllocationPool()
+            {
+                while (m_pages)
+                {
+                    Page* next = m_pages->m_next;
+                    m_allocator->DeAllocate(m_pages);
+                    m_pages = next;
+                }
+            }
+
+            void* Allocate(size_t size)
+            {
+                if (size > MaxPooledSize)
+                {
+                    return m_allocator->Allocate(size, BlockGranularity);
+                }
+
+                const size_t sizeClass = ToSizeClass(size);
+                if (!m_freeLists[sizeClass] && !AllocatePage(sizeClass))
+                {
+                    return nullptr;
+                }
+
+                FreeBlock* block = m_freeLists[sizeClass];
+                m_freeLists[sizeClass] = block->m_next;
+                ++ToPage(block)->m_usedCount;
+                return block;
+            }
+
+            void DeAllocate(void* ptr, size_t size)
+            {
+                if (size > MaxPooledSize)
+                {
+                    m_allocator->DeAllocate(ptr);
+                    return;
+                }
+
+                --ToPage(ptr)->m_usedCount;
+                PushFreeBlock(ToSizeClass(size), ptr);
+            }
+
+            // Lua always passes the current size of a block, which determines whether the block came from the pool
+            void* ReAllocate(void* ptr, size_t oldSize, size_t newSize)
+            {
+                if (oldSize > MaxPooledSize && newSize > MaxPooledSize)
+                {
+                    return m_allocator->ReAllocate(ptr, newSize, BlockGranularity);
+                }
+
+                if (oldSize <= MaxPooledSize && newSize <= MaxPooledSize && ToSizeClass(oldSize) == ToSizeClass(newSize))
+                {
+                    return ptr;
+                }
+
+                void* newPtr = Allocate(newSize);
+                if (newPtr)
+                {
+                    memcpy(newPtr, ptr, AZStd::min(oldSize, newSize));
+                    DeAllocate(ptr, oldSize);
+                }
+                return newPtr;
+            }
+
+            void Trim()
+            {
+                bool hasEmptyPage = false;
+                for (Page* page = m_pages; page && !hasEmptyPage; page = page->m_next)
+                {
+                    hasEmptyPage = page->m_usedCount == 0;
+                }
+
+                if (!hasEmptyPage)
+                {
+                    return;
+                }
+
+                // unlink the free blocks of the empty pages first, all the blocks of an empty page are in the free lists
+                for (FreeBlock*& freeList : m_freeLists)
+                {
+                    FreeBlock** link = &freeList;
+                    while (*link)
+                    {
+                        if (ToPage(*link)->m_usedCount == 0)
+                        {
+                            *link = (*link)->m_next;
+                        }
+                        else
+                        {
+                            link = &(*link)->m_next;
+                        }
+                    }
+                }
+
+                Page** link = &m_pages;
+                while (*link)
+                {
+                    Page* page = *link;
+                    if (page->m_usedCount == 0)
+                    {
+                        *link = page->m_next;
+                        m_allocator->DeAllocate(page);
+                    }
+                    else
+                    {
+                        link = &page->m_next;
+                    }
+                }
+            }
+
+        private:
+            struct FreeBlock
+            {
+                FreeBlock* m_next;
+            };
+
+            struct alignas(BlockGranularity) Page
+            {
+                Page* m_next;
+                size_t m_usedCount;
+            };
+
+            static size_t ToSizeClass(size_t size)
+            {
+                return size ? (size - 1) / BlockGranularity : 0;
+            }
+
+            static Page* ToPage(void* ptr)
+            {
+                return reinterpret_cast<Page*>(reinterpret_cast<uintptr_t>(ptr) & ~(PageSize - 1));
+            }
+
+            void PushFreeBlock(size_t sizeClass, void* ptr)
+            {
+                FreeBlock* block = reinterpret_cast<FreeBlock*>(ptr);
+                block->m_next = m_freeLists[sizeClass];
+                m_freeLists[sizeClass] = block;
+            }
+
+            bool AllocatePage(size_t sizeClass)
+            {
+                Page* page = reinterpret_cast<Page*>(m_allocator->Allocate(PageSize, PageSize));
+                if (!page)
+                {
+                    return false;
+                }
+
+                page->m_next = m_pages;
+                page->m_usedCount = 0;
+                m_pages = page;
+
+                const size_t blockSize = (sizeClass + 1) * BlockGranularity;
+                AZ::u8* block = reinterpret_cast<AZ::u8*>(page + 1);
+                AZ::u8* end = reinterpret_cast<AZ::u8*>(page) + PageSize;
+                for (; block + blockSize <= end; block += blockSize)
+                {
+                    PushFreeBlock(sizeClass, block);
+                }
+                return true;
+            }
+
+            IAllocator* m_allocator;
+            Page* m_pages = nullptr;
+            AZStd::array<FreeBlock*, MaxPooledSize / BlockGranularity> m_freeLists = {};
+        };
+
         //=========================================================================
         // azlua_setglobal - raw setglobal function (no metamethods called)
         // [4/1/2012]
@@ -1473,23 +1662,23 @@ namespace AZ
 //=========================================================================
 static void* LuaMemoryHook(void* userData, void* ptr, size_t osize, size_t nsize)
 {
-    (void)osize;
-    IAllocator* allocator = reinterpret_cast<IAllocator*>(userData);
+    static_assert(Internal::LuaAllocationPool::BlockGranularity % LUA_DEFAULT_ALIGNMENT == 0, "Pooled Lua allocations must keep the default alignment");
+    Internal::LuaAllocationPool* pool = reinterpret_cast<Internal::LuaAllocationPool*>(userData);
     if (nsize == 0)
     {
         if (ptr)
         {
-            allocator->DeAllocate(ptr);
+            pool->DeAllocate(ptr, osize);
         }
         return nullptr;
     }
     else if (ptr == nullptr)
     {
-        return allocator->Allocate(nsize, LUA_DEFAULT_ALIGNMENT);
+        return pool->Allocate(nsize);
     }
     else
     {
-        return allocator->ReAllocate(ptr, nsize, LUA_DEFAULT_ALIGNMENT);
+        return pool->ReAllocate(ptr, osize, nsize);
     }
 }
 
@@ -2937,6 +3126,31 @@ LUA_API const Node* lua_getDummyNode()
                     }
                     return false;
                 }
+                // Reader for the parameters of reflected classes, chosen once per method. The userdata of the exact
+                // class is read directly, anything else (wrapped, derived, nil) goes through the generic reader.
+                static bool FromStackExactClass(lua_State* lua, int stackIndex, BehaviorArgument& value, BehaviorClass* valueClass, ScriptContext::StackVariableAllocator* tempAllocator)
+                {
+                    LuaUserData* userData = reinterpret_cast<LuaUserData*>(lua_touserdata(lua, stackIndex));
+                    if (userData && userData->magicData == Internal::AZLuaUserData && userData->behaviorClass == valueClass)
+                    {
+                        if (value.m_traits & BehaviorParameter::TR_POINTER)
+                        {
+                            if (value.m_value == nullptr)
+                            {
+                                AZ_Assert(tempAllocator, "When we don't have the result address ready we need temporary storage! Pass a valid tempData!");
+                                AllocateTempStorage(value, valueClass, *tempAllocator);
+                            }
+                            *reinterpret_cast<void**>(value.m_value) = userData->value;
+                        }
+                        else
+                        {
+                            value.m_value = userData->value;
+                        }
+                        return true;
+                    }
+
+                    return FromStack(lua, stackIndex, value, valueClass, tempAllocator);
+                }
                 static void ToStack(lua_State* lua, BehaviorArgument& value)
                 {
                     void* valueAddress = value.m_value;
@@ -3441,7 +3655,18 @@ LUA_API const Node* lua_getDummyNode()
                         "%s will not be available for scripting unless these requirements are met."
                         , arg->m_name, method->m_name.c_str(), arg->m_name, arg->m_name, arg->m_name, method->m_name.c_str());
 
-                    m_fromLua.push_back(AZStd::make_pair(fromStack, argClass));
+                    // specialize the reading of reflected classes, now that the class of the argument is known
+                    if (fromStack == static_cast<LuaLoadFromStack>(&Internal::LuaScriptReflectedType::FromStack))
+                    {
+                        fromStack = &Internal::LuaScriptReflectedType::FromStackExactClass;
+                    }
+
+                    m_fromLua.push_back({ fromStack, argClass, arg });
+
+                    if (argClass && argClass->m_destructor)
+                    {
+                        m_destroyedArguments.push_back(iArg);
+                    }
                 }
 
                 if (method->HasResult())
@@ -3496,9 +3721,10 @@ LUA_API const Node* lua_getDummyNode()
                 // for each argument read a variable from the stack to a BehaviorArgument
                 for (int i = 0; i < numArguments; ++i)
                 {
-                    const AZ::BehaviorParameter* parameter = thisPtr->m_method->GetArgument(i);
+                    const ArgumentMarshaler& marshaler = thisPtr->m_fromLua[i];
+                    const AZ::BehaviorParameter* parameter = marshaler.m_parameter;
                     arguments[i].Set(*parameter); // store the type of result we expect (pointer, const, etc.)
-                    if (!thisPtr->m_fromLua[i].first(lua, i + 1, arguments[i], thisPtr->m_fromLua[i].second, &tempData))
+                    if (!marshaler.m_fromLua(lua, i + 1, arguments[i], marshaler.m_class, &tempData))
                     {
                         ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Lua failed to call method: cannot convert parameter %d from %s to %s",
                             i + 1, arguments[i].m_name, parameter->m_name);
@@ -3514,6 +3740,7 @@ LUA_API const Node* lua_getDummyNode()
                     return 0;
                 }
                 int numResults = 0;
+                ResultPush resultPush;
 
                 if (thisPtr->m_resultToLua)
                 {
@@ -3524,13 +3751,15 @@ LUA_API const Node* lua_getDummyNode()
                         usedBackupAlloc  = thisPtr->m_prepareResult(result, thisPtr->m_resultClass, tempData, &backupAllocator); // pass temp memory and class info
                     }
 
-                    // TODO: Make it optional for EBuses only, make it light weight too, probably a virtual function for the store result.
-                    result.m_onAssignedResult = AZStd::function<void()>([&]()
+                    // TODO: Make it optional for EBuses only, probably a virtual function for the store result.
+                    // The lambda captures a single pointer, so it fits in the function's local storage and the call does not allocate.
+                    resultPush = { lua, thisPtr, &result, &numResults };
+                    result.m_onAssignedResult = AZStd::function<void()>([push = &resultPush]()
                     {
-                        if (result.m_value)
+                        if (push->m_result->m_value)
                         {
-                            thisPtr->m_resultToLua(lua, result);
-                            ++numResults;
+                            push->m_caller->m_resultToLua(push->m_lua, *push->m_result);
+                            ++(*push->m_numResults);
                         }
                     });
                 }
@@ -3575,23 +3804,42 @@ LUA_API const Node* lua_getDummyNode()
                 {
                     backupAllocator.deallocate(result.m_value, thisPtr->m_resultClass->m_size, thisPtr->m_resultClass->m_alignment);
                 }
-                for (int i = 0; i < numArguments; ++i)
+                for (int i : thisPtr->m_destroyedArguments)
                 {
-                    BehaviorClass* argClass = thisPtr->m_fromLua[i].second;
-                    if (argClass && argClass->m_destructor)
+                    if (i >= numArguments)
                     {
-                        void* valueAddress = arguments[i].GetValueAddress();
-                        if (tempData.inrange(valueAddress))
-                        {
-                            argClass->m_destructor(valueAddress, argClass->m_userData);
-                        }
+                        break;
+                    }
+
+                    BehaviorClass* argClass = thisPtr->m_fromLua[i].m_class;
+                    void* valueAddress = arguments[i].GetValueAddress();
+                    if (tempData.inrange(valueAddress))
+                    {
+                        argClass->m_destructor(valueAddress, argClass->m_userData);
                     }
                 }
 
                 return numResults;
             }
 
-            AZStd::vector<AZStd::pair<LuaLoadFromStack, BehaviorClass*>> m_fromLua;
+            // The marshaling of an argument, resolved once from the signature of the method
+            struct ArgumentMarshaler
+            {
+                LuaLoadFromStack m_fromLua;
+                BehaviorClass* m_class;
+                const BehaviorParameter* m_parameter;
+            };
+
+            struct ResultPush
+            {
+                lua_State* m_lua = nullptr;
+                LuaScriptCaller* m_caller = nullptr;
+                BehaviorArgument* m_result = nullptr;
+                int* m_numResults = nullptr;
+            };
+
+            AZStd::vector<ArgumentMarshaler> m_fromLua;
+            AZStd::vector<int> m_destroyedArguments; ///< Indices of the arguments which need their destructor called, in ascending order.
             LuaPushToStack m_resultToLua;
             LuaPrepareValue m_prepareResult;
             BehaviorClass* m_resultClass;
@@ -4336,7 +4584,8 @@ LUA_API const Node* lua_getDummyNode()
                     {
                         allocator = &m_luaAllocator;
                     }
-                    m_lua = lua_newstate(&LuaMemoryHook, allocator);
+                    m_allocationPool = AZStd::make_unique<Internal::LuaAllocationPool>(allocator);
+                    m_lua = lua_newstate(&LuaMemoryHook, m_allocationPool.get());
                     AZ_Assert(m_lua, "Failed to create new LUA state!");
                 }
 
@@ -5687,6 +5936,12 @@ LUA_API const Node* lua_getDummyNode()
             void GarbageCollect()
             {
                 lua_gc(m_lua, LUA_GCCOLLECT, 0);
+
+                // a full collection is when pages are most likely to be empty
+                if (m_allocationPool)
+                {
+                    m_allocationPool->Trim();
+                }
             }
 
             //////////////////////////////////////////////////////////////////////////
@@ -5836,6 +6091,7 @@ LUA_API const Node* lua_getDummyNode()
             AZStd::vector< ScriptTypeFactory >  m_scriptPropertyArrayFactories;
             ScriptTypeFactory                   m_scriptPropertyTableFactory;
             Internal::LuaSystemAllocator m_luaAllocator;
+            AZStd::unique_ptr<Internal::LuaAllocationPool> m_allocationPool; ///< Declared after the allocator it returns its pages to.
             AZStd::thread::id m_ownerThreadId; // Check if Lua methods (including EBus handlers) are called from background threads.
         };
 
@@ -5873,7 +6129,7 @@ LUA_API const Node* lua_getDummyNode()
     //////////////////////////////////////////////////////////////////////////
     void ScriptContext::GarbageCollect()
     {
-        lua_gc(m_impl->m_lua, LUA_GCCOLLECT, 0);
+        m_impl->GarbageCollect();
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -136,6 +136,9 @@ namespace AZ
 
         Internal::CompiledTaskGraphTracker& GetEventTracker() {return m_eventTracker;}
 
+        // Number of worker threads tasks submitted to this executor are distributed across
+        uint32_t GetThreadCount() const { return m_threadCount; }
+
     private:
         friend class Internal::TaskWorker;
         friend class TaskGraphEvent;
@@ -4430,6 +4430,160 @@ ramenShop.handler:Connect(4);
         lua_pop(m_lua, 1);
     }
 
+    class ScriptAllocationPoolTest
+        : public LeakDetectionFixture
+    {
+    public:
+        // Counts the blocks the pool of the VM takes from the allocator, which are its pages and the allocations too big to pool
+        class CountingAllocator
+            : public AllocatorGlobalWrapper<SystemAllocator>
+        {
+        public:
+            AZ_RTTI(CountingAllocator, "{3C1F5A3E-8E2B-4D7C-9A51-6B0E2F4D8C17}", IAllocator);
+
+            pointer allocate(size_type byteSize, align_type alignment = 1) override
+            {
+                ++m_liveCount;
+                return AllocatorGlobalWrapper<SystemAllocator>::allocate(byteSize, alignment);
+            }
+
+            void deallocate(pointer ptr, size_type byteSize = 0, align_type alignment = 0) override
+            {
+                if (ptr)
+                {
+                    --m_liveCount;
+                }
+                AllocatorGlobalWrapper<SystemAllocator>::deallocate(ptr, byteSize, alignment);
+            }
+
+            size_t m_liveCount = 0;
+        };
+
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            m_allocator = AZStd::make_unique<CountingAllocator>();
+            m_script = aznew ScriptContext(ScriptContextIds::DefaultScriptContextId, m_allocator.get());
+            m_lua = m_script->NativeContext();
+        }
+
+        void TearDown() override
+        {
+            m_lua = nullptr;
+            delete m_script;
+            m_allocator.reset();
+
+            LeakDetectionFixture::TearDown();
+        }
+
+        // Calls the memory hook of the VM the way Lua does
+        void* ReAllocate(void* ptr, size_t oldSize, size_t newSize)
+        {
+            void* userData = nullptr;
+            lua_Alloc allocate = lua_getallocf(m_lua, &userData);
+            return allocate(userData, ptr, oldSize, newSize);
+        }
+
+        static void Fill(void* ptr, size_t size)
+        {
+            AZ::u8* bytes = reinterpret_cast<AZ::u8*>(ptr);
+            for (size_t index = 0; index < size; ++index)
+            {
+                bytes[index] = static_cast<AZ::u8>(index * 7 + 1);
+            }
+        }
+
+        static bool IsFilled(const void* ptr, size_t size)
+        {
+            const AZ::u8* bytes = reinterpret_cast<const AZ::u8*>(ptr);
+            for (size_t index = 0; index < size; ++index)
+            {
+                if (bytes[index] != static_cast<AZ::u8>(index * 7 + 1))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        AZStd::unique_ptr<CountingAllocator> m_allocator;
+        ScriptContext* m_script = nullptr;
+        lua_State* m_lua = nullptr;
+    };
+
+    TEST_F(ScriptAllocationPoolTest, ReAllocate_AcrossSizeClassesAndPoolBoundary_KeepsContents)
+    {
+        // grows through the size classes and out of the pool, then shrinks back into it
+        const size_t sizes[] = { 20, 24, 40, 200, 256, 257, 1024, 300, 256, 64, 8 };
+
+        size_t size = 8;
+        void* block = ReAllocate(nullptr, 0, size);
+        ASSERT_NE(nullptr, block);
+        Fill(block, size);
+
+        for (size_t newSize : sizes)
+        {
+            void* newBlock = ReAllocate(block, size, newSize);
+            ASSERT_NE(nullptr, newBlock) << "size " << size << " to " << newSize;
+            EXPECT_EQ(0, reinterpret_cast<uintptr_t>(newBlock) % 16) << "size " << size << " to " << newSize; // the alignment Lua expects
+            EXPECT_TRUE(IsFilled(newBlock, AZStd::min(size, newSize))) << "size " << size << " to " << newSize;
+
+            block = newBlock;
+            size = newSize;
+            Fill(block, size);
+        }
+
+        ReAllocate(block, size, 0);
+    }
+
+    TEST_F(ScriptAllocationPoolTest, ReAllocate_WithinSizeClass_KeepsBlock)
+    {
+        void* block = ReAllocate(nullptr, 0, 17);
+        ASSERT_NE(nullptr, block);
+        Fill(block, 17);
+
+        void* grownBlock = ReAllocate(block, 17, 32);
+        EXPECT_EQ(block, grownBlock);
+        EXPECT_TRUE(IsFilled(grownBlock, 17));
+
+        ReAllocate(grownBlock, 32, 0);
+    }
+
+    TEST_F(ScriptAllocationPoolTest, GarbageCollect_AfterReleasingBlocks_ReturnsEmptyPages)
+    {
+        m_script->GarbageCollect();
+        const size_t liveCountBefore = m_allocator->m_liveCount;
+
+        // enough blocks of one size to take several new pages
+        AZStd::vector<void*> blocks(4096, nullptr);
+        for (void*& block : blocks)
+        {
+            block = ReAllocate(nullptr, 0, 48);
+            ASSERT_NE(nullptr, block);
+            Fill(block, 48);
+        }
+        EXPECT_GT(m_allocator->m_liveCount, liveCountBefore);
+
+        // a block left in use keeps its page, with its contents
+        void* keptBlock = blocks.back();
+        blocks.pop_back();
+        for (void* block : blocks)
+        {
+            ReAllocate(block, 48, 0);
+        }
+
+        m_script->GarbageCollect();
+        EXPECT_LE(m_allocator->m_liveCount, liveCountBefore + 1);
+        EXPECT_TRUE(IsFilled(keptBlock, 48));
+
+        // the pool still serves the size after the trim
+        void* block = ReAllocate(nullptr, 0, 48);
+        ASSERT_NE(nullptr, block);
+        ReAllocate(block, 48, 0);
+        ReAllocate(keptBlock, 48, 0);
+    }
+
     class UnregisteredSharedPointerTest
         : public BehaviorContextFixture
     {
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathReflection.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Script/ScriptContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    // the number of BehaviorContext calls each script makes, so the compilation of the script does not dominate
+    static constexpr int64_t CallsPerScript = 1000;
+
+    static AZ::Vector3 ScaleVector3(const AZ::Vector3& value, float scale)
+    {
+        return value * scale;
+    }
+
+    class ScriptMarshalingBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            CreateContexts();
+        }
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            CreateContexts();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            DestroyContexts();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            DestroyContexts();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void RunScript(::benchmark::State& state, const char* script)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                m_script->Execute(script);
+            }
+
+            state.SetItemsProcessed(state.iterations() * CallsPerScript);
+        }
+
+        AZ::BehaviorContext* m_behavior = nullptr;
+        AZ::ScriptContext* m_script = nullptr;
+
+    private:
+        void CreateContexts()
+        {
+            m_behavior = aznew AZ::BehaviorContext();
+            AZ::MathReflect(m_behavior);
+            m_behavior->Method("ScaleVector3", &ScaleVector3);
+
+            m_script = aznew AZ::ScriptContext();
+            m_script->BindTo(m_behavior);
+        }
+
+        void DestroyContexts()
+        {
+            delete m_script;
+            m_script = nullptr;
+            delete m_behavior;
+            m_behavior = nullptr;
+        }
+    };
+
+    // a global method taking and returning a value type
+    BENCHMARK_F(ScriptMarshalingBenchmarkFixture, GlobalMethodVector3)(::benchmark::State& state)
+    {
+        RunScript(state,
+            "local v = Vector3(1, 2, 3)\n"
+            "for i = 1, 1000 do\n"
+            "    v = ScaleVector3(v, 1.0)\n"
+            "end\n");
+    }
+
+    // member methods and operators of the reflected math types
+    BENCHMARK_F(ScriptMarshalingBenchmarkFixture, MemberMethodVector3)(::benchmark::State& state)
+    {
+        RunScript(state,
+            "local a = Vector3(1, 2, 3)\n"
+            "local b = Vector3(4, 5, 6)\n"
+            "for i = 1, 1000 do\n"
+            "    a = a:Cross(b)\n"
+            "end\n");
+    }
+
+    BENCHMARK_F(ScriptMarshalingBenchmarkFixture, OperatorVector3)(::benchmark::State& state)
+    {
+        RunScript(state,
+            "local a = Vector3(1, 2, 3)\n"
+            "local b = Vector3(0, 0, 0)\n"
+            "for i = 1, 1000 do\n"
+            "    b = a + b\n"
+            "end\n");
+    }
+
+    BENCHMARK_F(ScriptMarshalingBenchmarkFixture, MemberMethodQuaternion)(::benchmark::State& state)
+    {
+        RunScript(state,
+            "local q = Quaternion.CreateRotationZ(0.1)\n"
+            "for i = 1, 1000 do\n"
+            "    q = q:GetConjugate()\n"
+            "end\n");
+    }
+
+    // a number result, which does not create any userdata
+    BENCHMARK_F(ScriptMarshalingBenchmarkFixture, MemberMethodNumbers)(::benchmark::State& state)
+    {
+        RunScript(state,
+            "local v = Vector3(1, 2, 3)\n"
+            "for i = 1, 1000 do\n"
+            "    local length = v:GetLength()\n"
+            "end\n");
+    }
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
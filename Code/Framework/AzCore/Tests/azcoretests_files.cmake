@@ -180,6 +180,7 @@ set(FILES
     RTTI/TypeSafeIntegralTests.cpp
     Rtti.cpp
     Script.cpp
+    ScriptMarshalingBenchmarks.cpp
     ScriptMath.cpp
     Serialization/Json/ArraySerializerTests.cpp
     Serialization/Json/AnySerializerTests.cpp
@@ -15,6 +15,7 @@ set(FILES
     Materials/Special/ShadowCatcher.materialtype
     Materials/Special/ShadowCatcher.shader
     Materials/Types/BasePBR.materialtype
+    Materials/Types/BasePBRInstanced.materialtype
     Materials/Types/EnhancedPBR.materialtype
     Materials/Types/EnhancedPBR_Anisotropy.lua
     Materials/Types/EnhancedPBR_SubsurfaceState.lua
@@ -216,6 +217,7 @@ set(FILES
     ShaderLib/Atom/Features/PBR/Decals.azsli
     ShaderLib/Atom/Features/PBR/DefaultObjectSrg.azsli
     ShaderLib/Atom/Features/PBR/Hammersley.azsli
+    ShaderLib/Atom/Features/PBR/InstancedObjectSrg.azsli
     ShaderLib/Atom/Features/PBR/LightingOptions.azsli
     ShaderLib/Atom/Features/PBR/LightingUtils.azsli
     ShaderLib/Atom/Features/PBR/MaterialUtils.azsli
@@ -306,6 +308,8 @@ set(FILES
     Shaders/Depth/DepthPass.azsl
     Shaders/Depth/DepthPass.shader
     Shaders/Depth/DepthPassCommon.azsli
+    Shaders/Depth/DepthPassInstanced.azsl
+    Shaders/Depth/DepthPassInstanced.shader
     Shaders/Depth/DepthPassSkin.azsl
     Shaders/Depth/DepthPassSkin.shader
     Shaders/Depth/DepthPassTransparentMax.shader
@@ -326,11 +330,13 @@ set(FILES
     Shaders/Materials/BasePBR/BasePBR.azsli
     Shaders/Materials/BasePBR/BasePBR_ForwardPass.azsl
     Shaders/Materials/BasePBR/BasePBR_ForwardPass.shader
+    Shaders/Materials/BasePBR/BasePBR_ForwardPassInstanced.shader
     Shaders/Materials/BasePBR/BasePBR_LightingBrdf.azsli
     Shaders/Materials/BasePBR/BasePBR_LightingData.azsli
     Shaders/Materials/BasePBR/BasePBR_LightingEval.azsli
     Shaders/Materials/BasePBR/BasePBR_LowEndForward.azsl
     Shaders/Materials/BasePBR/BasePBR_LowEndForward.shader
+    Shaders/Materials/BasePBR/BasePBR_LowEndForwardInstanced.shader
     Shaders/Materials/BasePBR/BasePBR_MaterialSrg.azsli
     Shaders/Materials/BasePBR/BasePBR_PixelGeometryData.azsli
     Shaders/Materials/BasePBR/BasePBR_PixelGeometryEval.azsli
@@ -427,6 +433,8 @@ set(FILES
     Shaders/MotionVector/MeshMotionVector.azsl
     Shaders/MotionVector/MeshMotionVector.shader
     Shaders/MotionVector/MeshMotionVectorCommon.azsli
+    Shaders/MotionVector/MeshMotionVectorInstanced.azsl
+    Shaders/MotionVector/MeshMotionVectorInstanced.shader
     Shaders/MotionVector/MeshMotionVectorSkin.azsl
     Shaders/MotionVector/MeshMotionVectorSkin.shader
     Shaders/PostProcessing/AcesOutputTransformLut.azsl
@@ -572,6 +580,8 @@ set(FILES
     Shaders/Shadow/Shadowmap.azsl
     Shaders/Shadow/Shadowmap.shader
     Shaders/Shadow/ShadowmapCommon.azsli
+    Shaders/Shadow/ShadowmapInstanced.azsl
+    Shaders/Shadow/ShadowmapInstanced.shader
     Shaders/Shadow/ShadowmapSkin.azsl
     Shaders/Shadow/ShadowmapSkin.shader
     Shaders/SkinnedMesh/LinearSkinningCS.azsl
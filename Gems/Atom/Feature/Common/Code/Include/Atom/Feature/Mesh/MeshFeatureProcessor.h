@@ -28,6 +28,7 @@
 #include <Atom/Feature/TransformService/TransformServiceFeatureProcessor.h>
 #include <Atom/Feature/Mesh/ModelReloaderSystemInterface.h>
 
+#include <Mesh/MeshInstanceManager.h>
 #include <RayTracing/RayTracingFeatureProcessor.h>
 
 namespace AZ
@@ -99,12 +100,19 @@ namespace AZ
             void SetVisible(bool isVisible);
             void UpdateMaterialChangeIds();
             bool CheckForMaterialChanges() const;
+            bool CanUseInstancing(const Data::Instance<RPI::Material>& material, const MaterialAssignment& materialAssignment, bool materialRequiresForwardPassIblSpecular) const;
+            void ReleaseInstanceGroups();
 
             // MaterialAssignmentNotificationBus overrides
             void OnRebuildMaterialInstance() override;
 
             RPI::MeshDrawPacketLods m_drawPacketListsByLod;
 
+            //! Instancing records for the draw packets in m_drawPacketListsByLod that are drawn through a MeshInstanceGroup,
+            //! sorted by draw packet index. The culling system holds pointers to these, so they are only modified in Init()/DeInit().
+            AZStd::fixed_vector<AZStd::vector<MeshInstanceData>, RPI::ModelLodAsset::LodCountMax> m_instanceDataByLod;
+            MeshInstanceManager* m_meshInstanceManager = nullptr;
+
             RPI::Cullable m_cullable;
             MaterialAssignmentMap m_materialAssignments;
 
@@ -164,6 +172,8 @@ namespace AZ
             void Deactivate() override;
             //! Updates GPU buffers with latest data from render proxies
             void Simulate(const FeatureProcessor::SimulatePacket& packet) override;
+            //! Builds the instanced draw items for the instances that are visible in each view
+            void OnEndCulling(const FeatureProcessor::RenderPacket& packet) override;
 
             // RPI::SceneNotificationBus overrides ...
             void OnBeginPrepareRender() override;
@@ -238,6 +248,7 @@ namespace AZ
             StableDynamicArray<ModelDataInstance> m_modelData;
             TransformServiceFeatureProcessor* m_transformService;
             RayTracingFeatureProcessor* m_rayTracingFeatureProcessor = nullptr;
+            MeshInstanceManager m_meshInstanceManager;
             AZ::RPI::ShaderSystemInterface::GlobalShaderOptionUpdatedEvent::Handler m_handleGlobalShaderOptionUpdate;
             RPI::MeshDrawPacketLods m_emptyDrawPacketLods;
             RHI::Ptr<FlagRegistry> m_flagRegistry = nullptr;
@@ -245,6 +256,7 @@ namespace AZ
             bool m_forceRebuildDrawPackets = false;
             bool m_reportShaderOptionFlags = false;
             bool m_enablePerMeshShaderOptionFlags = false;
+            bool m_enableMeshInstancing = false;
         };
     } // namespace Render
 } // namespace AZ
@@ -42,6 +42,14 @@ namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(bool,
+            r_meshInstancingEnabled,
+            false,
+            nullptr,
+            AZ::ConsoleFunctorFlags::Null,
+            "Merge meshes that share a model lod, material and draw state into one instanced draw per view. Only applies to materials whose object srg supports instancing."
+        );
+
         static AZ::Name s_o_meshUseForwardPassIBLSpecular_Name =
             AZ::Name::FromStringLiteral("o_meshUseForwardPassIBLSpecular", AZ::Interface<AZ::NameDictionary>::Get());
         static AZ::Name s_Manual_Name = AZ::Name::FromStringLiteral("Manual", AZ::Interface<AZ::NameDictionary>::Get());
@@ -97,6 +105,9 @@ namespace AZ
 
             m_rayTracingFeatureProcessor = GetParentScene()->GetFeatureProcessor<RayTracingFeatureProcessor>();
 
+            m_meshInstanceManager.Activate(GetParentScene());
+            m_enableMeshInstancing = r_meshInstancingEnabled;
+
             m_handleGlobalShaderOptionUpdate = RPI::ShaderSystemInterface::GlobalShaderOptionUpdatedEvent::Handler
             {
                 [this](const AZ::Name&, RPI::ShaderOptionValue) { m_forceRebuildDrawPackets = true; }
@@ -130,6 +141,8 @@ namespace AZ
             m_transformService = nullptr;
             m_forceRebuildDrawPackets = false;
 
+            m_meshInstanceManager.Deactivate();
+
             GetParentScene()->GetViewTagBitRegistry().ReleaseTag(m_meshMovedFlag);
         }
 
@@ -150,6 +163,19 @@ namespace AZ
             AZ::Job* parentJob = packet.m_parentJob;
             AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
 
+            if (m_enableMeshInstancing != r_meshInstancingEnabled)
+            {
+                // Rebuild the draw packet lists of all loaded meshes so they join or leave their instance groups
+                m_enableMeshInstancing = r_meshInstancingEnabled;
+                for (auto& modelData : m_modelData)
+                {
+                    if (modelData.m_model)
+                    {
+                        modelData.m_needsInit = true;
+                    }
+                }
+            }
+
             const auto iteratorRanges = m_modelData.GetParallelRanges();
             AZ::JobCompletion jobCompletion;
             for (const auto& iteratorRange : iteratorRanges)
@@ -220,9 +246,19 @@ namespace AZ
                 }
             }
 
+            m_meshInstanceManager.UpdateDrawPackets(m_forceRebuildDrawPackets);
+
             m_forceRebuildDrawPackets = false;
         }
 
+        void MeshFeatureProcessor::OnEndCulling(const FeatureProcessor::RenderPacket& packet)
+        {
+            if (m_meshInstanceManager.GetGroupCount() > 0)
+            {
+                m_meshInstanceManager.OnEndCulling(packet);
+            }
+        }
+
         void MeshFeatureProcessor::OnBeginPrepareRender()
         {
             m_meshDataChecker.soft_lock();
@@ -310,6 +346,7 @@ namespace AZ
 
             meshDataHandle->m_descriptor = descriptor;
             meshDataHandle->m_scene = GetParentScene();
+            meshDataHandle->m_meshInstanceManager = &m_meshInstanceManager;
             meshDataHandle->m_materialAssignments = materials;
             meshDataHandle->m_objectId = m_transformService->ReserveObjectId();
             meshDataHandle->m_rayTracingUuid = AZ::Uuid::CreateRandom();
@@ -886,6 +923,8 @@ namespace AZ
         {
             m_scene->GetCullingScene()->UnregisterCullable(m_cullable);
 
+            ReleaseInstanceGroups();
+
             for (const auto& materialAssignment : m_materialAssignments)
             {
                 const AZ::Data::Instance<RPI::Material>& materialInstance = materialAssignment.second.m_materialInstance;
@@ -915,6 +954,11 @@ namespace AZ
         {
             const size_t modelLodCount = m_model->GetLodCount();
             m_drawPacketListsByLod.resize(modelLodCount);
+
+            // Init may run again on a loaded model (e.g. when instancing is toggled), so drop any previous group references first
+            ReleaseInstanceGroups();
+            m_instanceDataByLod.resize(modelLodCount);
+
             for (size_t modelLodIndex = 0; modelLodIndex < modelLodCount; ++modelLodIndex)
             {
                 BuildDrawPacketList(modelLodIndex);
@@ -957,6 +1001,9 @@ namespace AZ
             drawPacketListOut.clear();
             drawPacketListOut.reserve(meshCount);
 
+            AZStd::vector<MeshInstanceData>& instanceDataListOut = m_instanceDataByLod[modelLodIndex];
+            AZ_Assert(instanceDataListOut.empty(), "Instance groups must be released before rebuilding the draw packet list");
+
             m_hasForwardPassIblSpecularMaterial = false;
 
             for (size_t meshIndex = 0; meshIndex < meshCount; ++meshIndex)
@@ -1033,6 +1080,25 @@ namespace AZ
                 drawPacket.SetSortKey(m_sortKey);
                 drawPacket.Update(*m_scene, false);
                 drawPacketListOut.emplace_back(AZStd::move(drawPacket));
+
+                if (CanUseInstancing(material, materialAssignment, materialRequiresForwardPassIblSpecular))
+                {
+                    MeshInstanceGroupKey key;
+                    key.m_modelId = m_model->GetId();
+                    key.m_materialId = material->GetId();
+                    key.m_lodIndex = aznumeric_cast<uint32_t>(modelLodIndex);
+                    key.m_meshIndex = aznumeric_cast<uint32_t>(meshIndex);
+                    key.m_sortKey = m_sortKey;
+                    key.m_stencilRef = stencilRef;
+
+                    if (MeshInstanceGroup* group = m_meshInstanceManager->AcquireGroup(key, modelLod, material))
+                    {
+                        MeshInstanceData& instanceData = instanceDataListOut.emplace_back();
+                        instanceData.m_group = group;
+                        instanceData.m_objectId = m_objectId.GetIndex();
+                        instanceData.m_drawPacketIndex = aznumeric_cast<uint32_t>(drawPacketListOut.size() - 1);
+                    }
+                }
             }
         }
 
@@ -1499,6 +1565,16 @@ namespace AZ
                     drawPacket.SetSortKey(sortKey);
                 }
             }
+
+            // The sort key is part of the instance group key, so instanced meshes need to move to a different group
+            for (const auto& instanceDataList : m_instanceDataByLod)
+            {
+                if (!instanceDataList.empty())
+                {
+                    m_needsInit = true;
+                    break;
+                }
+            }
         }
 
         RHI::DrawItemSortKey ModelDataInstance::GetSortKey() const
@@ -1576,16 +1652,40 @@ namespace AZ
                 }
 
                 lod.m_drawPackets.clear();
-                for (const RPI::MeshDrawPacket& meshDrawPacket : m_drawPacketListsByLod[lodIndex])
+                lod.m_visibleObjectUserData.clear();
+
+                // Draw packets that belong to an instance group are drawn by the MeshInstanceManager after culling
+                const RPI::MeshDrawPacketList& drawPacketList = m_drawPacketListsByLod[lodIndex];
+                const MeshInstanceData* instanceData = nullptr;
+                const MeshInstanceData* instanceDataEnd = nullptr;
+                if (lodIndex < m_instanceDataByLod.size())
                 {
-                    const RHI::DrawPacket* rhiDrawPacket = meshDrawPacket.GetRHIDrawPacket();
+                    instanceData = m_instanceDataByLod[lodIndex].data();
+                    instanceDataEnd = instanceData + m_instanceDataByLod[lodIndex].size();
+                }
+                for (size_t drawPacketIndex = 0; drawPacketIndex < drawPacketList.size(); ++drawPacketIndex)
+                {
+                    const bool isInstanced = instanceData != instanceDataEnd && instanceData->m_drawPacketIndex == drawPacketIndex;
+                    const RHI::DrawPacket* rhiDrawPacket = drawPacketList[drawPacketIndex].GetRHIDrawPacket();
 
                     if (rhiDrawPacket)
                     {
                         //OR-together all the drawListMasks (so we know which views to cull against)
                         cullData.m_drawListMask |= rhiDrawPacket->GetDrawListMask();
 
-                        lod.m_drawPackets.push_back(rhiDrawPacket);
+                        if (isInstanced)
+                        {
+                            lod.m_visibleObjectUserData.push_back(instanceData);
+                        }
+                        else
+                        {
+                            lod.m_drawPackets.push_back(rhiDrawPacket);
+                        }
+                    }
+
+                    if (isInstanced)
+                    {
+                        ++instanceData;
                     }
                 }
             }
@@ -1777,6 +1877,34 @@ namespace AZ
             return false;
         }
 
+        bool ModelDataInstance::CanUseInstancing(
+            const Data::Instance<RPI::Material>& material,
+            const MaterialAssignment& materialAssignment,
+            bool materialRequiresForwardPassIblSpecular) const
+        {
+            // Per-instance object srg data (reflection probes), per-mesh shader options and uv overrides
+            // can't be shared by the instances of a group, so those meshes keep their own draw packets.
+            return r_meshInstancingEnabled &&
+                !r_enablePerMeshShaderOptionFlags &&
+                !m_descriptor.m_useForwardPassIblSpecular &&
+                !materialRequiresForwardPassIblSpecular &&
+                materialAssignment.m_matModUvOverrides.empty() &&
+                MeshInstanceManager::SupportsInstancing(material);
+        }
+
+        void ModelDataInstance::ReleaseInstanceGroups()
+        {
+            for (auto& instanceDataList : m_instanceDataByLod)
+            {
+                for (const MeshInstanceData& instanceData : instanceDataList)
+                {
+                    m_meshInstanceManager->ReleaseGroup(instanceData.m_group);
+                }
+                instanceDataList.clear();
+            }
+            m_instanceDataByLod.clear();
+        }
+
         void ModelDataInstance::OnRebuildMaterialInstance()
         {
             if (m_visible && m_descriptor.m_isRayTracingEnabled)
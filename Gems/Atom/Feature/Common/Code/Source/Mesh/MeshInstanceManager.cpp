@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/MeshInstanceManager.h>
+
+#include <Atom/RHI.Reflect/Bits.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+#include <Atom/RPI.Public/Scene.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        static const char* InstanceObjectIdsBufferName = "m_instanceObjectIds";
+        static const char* InstanceDataOffsetConstantName = "m_instanceDataOffset";
+        static const char* InstanceCountConstantName = "m_instanceCount";
+        static const uint32_t InstanceDataBufferMinSize = 1 << 16; // Min 64Kb.
+
+        bool MeshInstanceGroupKey::operator==(const MeshInstanceGroupKey& rhs) const
+        {
+            return m_modelId == rhs.m_modelId &&
+                m_materialId == rhs.m_materialId &&
+                m_lodIndex == rhs.m_lodIndex &&
+                m_meshIndex == rhs.m_meshIndex &&
+                m_sortKey == rhs.m_sortKey &&
+                m_stencilRef == rhs.m_stencilRef;
+        }
+
+        bool MeshInstanceGroupKey::operator!=(const MeshInstanceGroupKey& rhs) const
+        {
+            return !(*this == rhs);
+        }
+
+        size_t MeshInstanceManager::KeyHasher::operator()(const MeshInstanceGroupKey& key) const
+        {
+            size_t seed = AZStd::hash<Data::InstanceId>()(key.m_modelId);
+            AZStd::hash_combine(seed, AZStd::hash<Data::InstanceId>()(key.m_materialId));
+            AZStd::hash_combine(seed, key.m_lodIndex);
+            AZStd::hash_combine(seed, key.m_meshIndex);
+            AZStd::hash_combine(seed, key.m_sortKey);
+            AZStd::hash_combine(seed, key.m_stencilRef);
+            return seed;
+        }
+
+        MeshInstanceGroup::PerViewDrawData& MeshInstanceGroup::AcquirePerViewDrawData()
+        {
+            if (m_perViewDrawDataUsedCount == m_perViewDrawData.size())
+            {
+                m_perViewDrawData.emplace_back(AZStd::make_unique<PerViewDrawData>());
+            }
+            return *m_perViewDrawData[m_perViewDrawDataUsedCount++];
+        }
+
+        void MeshInstanceManager::Activate(RPI::Scene* scene)
+        {
+            m_scene = scene;
+        }
+
+        void MeshInstanceManager::Deactivate()
+        {
+            AZ_Warning("MeshInstanceManager", m_groups.empty(),
+                "Deactivating the MeshInstanceManager, but there are still %zu instance groups in use.", m_groups.size());
+
+            m_groups.clear();
+            m_instanceDataBuffers.clear();
+            m_sortedVisibleObjects = {};
+            m_instanceObjectIds = {};
+            m_instancedDraws = {};
+            m_scene = nullptr;
+        }
+
+        bool MeshInstanceManager::SupportsInstancing(const Data::Instance<RPI::Material>& material)
+        {
+            const RHI::Ptr<RHI::ShaderResourceGroupLayout>& objectSrgLayout = material->GetAsset()->GetObjectSrgLayout();
+            return objectSrgLayout && objectSrgLayout->FindShaderInputBufferIndex(Name(InstanceObjectIdsBufferName)).IsValid();
+        }
+
+        MeshInstanceGroup* MeshInstanceManager::AcquireGroup(
+            const MeshInstanceGroupKey& key, RPI::ModelLod& modelLod, const Data::Instance<RPI::Material>& material)
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_groupMutex);
+
+            AZStd::unique_ptr<MeshInstanceGroup>& group = m_groups[key];
+            if (!group)
+            {
+                const Data::Asset<RPI::ShaderAsset>& shaderAsset = material->GetAsset()->GetMaterialTypeAsset()->GetShaderAssetForObjectSrg();
+                const Name& objectSrgName = material->GetAsset()->GetObjectSrgLayout()->GetName();
+
+                Data::Instance<RPI::ShaderResourceGroup> objectSrg = RPI::ShaderResourceGroup::Create(shaderAsset, objectSrgName);
+                if (!objectSrg)
+                {
+                    AZ_Warning("MeshInstanceManager", false, "Failed to create the object shader resource group for an instance group.");
+                    m_groups.erase(key);
+                    return nullptr;
+                }
+
+                group = AZStd::make_unique<MeshInstanceGroup>();
+                group->m_key = key;
+                group->m_objectSrg = objectSrg;
+                group->m_objectSrgShaderAsset = shaderAsset;
+                group->m_objectSrgName = objectSrgName;
+                group->m_instanceObjectIdsIndex = objectSrg->FindShaderInputBufferIndex(Name(InstanceObjectIdsBufferName));
+                group->m_instanceDataOffsetIndex = objectSrg->FindShaderInputConstantIndex(Name(InstanceDataOffsetConstantName));
+                group->m_instanceCountIndex = objectSrg->FindShaderInputConstantIndex(Name(InstanceCountConstantName));
+                objectSrg->Compile();
+
+                group->m_drawPacket = RPI::MeshDrawPacket(modelLod, key.m_meshIndex, material, objectSrg);
+                group->m_drawPacket.SetStencilRef(key.m_stencilRef);
+                group->m_drawPacket.SetSortKey(key.m_sortKey);
+                group->m_drawPacket.Update(*m_scene, false);
+            }
+
+            ++group->m_refCount;
+            return group.get();
+        }
+
+        void MeshInstanceManager::ReleaseGroup(MeshInstanceGroup* group)
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_groupMutex);
+
+            AZ_Assert(group->m_refCount > 0, "Releasing a mesh instance group that has no references.");
+            if (--group->m_refCount == 0)
+            {
+                m_groups.erase(group->m_key);
+            }
+        }
+
+        void MeshInstanceManager::UpdateDrawPackets(bool forceUpdate)
+        {
+            AZ_PROFILE_SCOPE(AzRender, "MeshInstanceManager: UpdateDrawPackets");
+            for (auto& groupIter : m_groups)
+            {
+                groupIter.second->m_drawPacket.Update(*m_scene, forceUpdate);
+            }
+        }
+
+        void MeshInstanceManager::BuildInstancedDraws(
+            AZStd::vector<RPI::View::VisibleObjectProperties>& visibleObjects,
+            AZStd::vector<uint32_t>& instanceObjectIds,
+            AZStd::vector<InstancedDraw>& instancedDraws)
+        {
+            // Sort the visible instances by group so each group forms one contiguous run of object ids,
+            // and by depth within the group so the instances are drawn front to back.
+            AZStd::sort(visibleObjects.begin(), visibleObjects.end(),
+                [](const RPI::View::VisibleObjectProperties& lhs, const RPI::View::VisibleObjectProperties& rhs)
+                {
+                    const MeshInstanceGroup* lhsGroup = static_cast<const MeshInstanceData*>(lhs.m_userData)->m_group;
+                    const MeshInstanceGroup* rhsGroup = static_cast<const MeshInstanceData*>(rhs.m_userData)->m_group;
+                    return lhsGroup < rhsGroup || (lhsGroup == rhsGroup && lhs.m_depth < rhs.m_depth);
+                });
+
+            for (const RPI::View::VisibleObjectProperties& visibleObject : visibleObjects)
+            {
+                const MeshInstanceData* instanceData = static_cast<const MeshInstanceData*>(visibleObject.m_userData);
+                if (instancedDraws.empty() || instancedDraws.back().m_group != instanceData->m_group)
+                {
+                    InstancedDraw& instancedDraw = instancedDraws.emplace_back();
+                    instancedDraw.m_group = instanceData->m_group;
+                    instancedDraw.m_instanceOffset = aznumeric_cast<uint32_t>(instanceObjectIds.size());
+                    instancedDraw.m_nearDepth = visibleObject.m_depth;
+                }
+                InstancedDraw& instancedDraw = instancedDraws.back();
+                ++instancedDraw.m_instanceCount;
+                instancedDraw.m_farDepth = visibleObject.m_depth;
+                instanceObjectIds.push_back(instanceData->m_objectId);
+            }
+        }
+
+        void MeshInstanceManager::AddBackToFrontInstances(InstancedDraw& instancedDraw, AZStd::vector<uint32_t>& instanceObjectIds)
+        {
+            instancedDraw.m_backToFrontInstanceOffset = aznumeric_cast<uint32_t>(instanceObjectIds.size());
+            instanceObjectIds.resize(instanceObjectIds.size() + instancedDraw.m_instanceCount);
+
+            const uint32_t* frontToBack = instanceObjectIds.data() + instancedDraw.m_instanceOffset;
+            uint32_t* backToFront = instanceObjectIds.data() + instancedDraw.m_backToFrontInstanceOffset;
+            for (uint32_t instanceIndex = 0; instanceIndex < instancedDraw.m_instanceCount; ++instanceIndex)
+            {
+                backToFront[instanceIndex] = frontToBack[instancedDraw.m_instanceCount - instanceIndex - 1];
+            }
+        }
+
+        void MeshInstanceManager::OnEndCulling(const RPI::FeatureProcessor::RenderPacket& packet)
+        {
+            AZ_PROFILE_SCOPE(AzRender, "MeshInstanceManager: OnEndCulling");
+
+            for (auto& groupIter : m_groups)
+            {
+                groupIter.second->m_perViewDrawDataUsedCount = 0;
+            }
+
+            if (m_instanceDataBuffers.size() < packet.m_views.size())
+            {
+                m_instanceDataBuffers.resize(packet.m_views.size());
+            }
+
+            for (size_t viewIndex = 0; viewIndex < packet.m_views.size(); ++viewIndex)
+            {
+                RPI::View& view = *packet.m_views[viewIndex];
+                const RPI::View::VisibleObjectList& visibleObjects = view.GetVisibleObjectList();
+                if (visibleObjects.empty())
+                {
+                    continue;
+                }
+
+                m_sortedVisibleObjects.assign(visibleObjects.begin(), visibleObjects.end());
+                m_instanceObjectIds.clear();
+                m_instancedDraws.clear();
+                BuildInstancedDraws(m_sortedVisibleObjects, m_instanceObjectIds, m_instancedDraws);
+
+                // Draw lists that are sorted back to front (e.g. transparent draws) need the instances of a group in
+                // back to front order as well, so those groups get a reversed copy of their object ids.
+                RHI::DrawListMask backToFrontDrawListMask;
+                const RHI::DrawListMask& viewDrawListMask = view.GetDrawListMask();
+                for (size_t tagIndex = 0; tagIndex < viewDrawListMask.size(); ++tagIndex)
+                {
+                    if (viewDrawListMask[tagIndex] && view.IsDrawListSortedBackToFront(RHI::DrawListTag(tagIndex)))
+                    {
+                        backToFrontDrawListMask.set(tagIndex);
+                    }
+                }
+
+                if (backToFrontDrawListMask.any())
+                {
+                    for (InstancedDraw& instancedDraw : m_instancedDraws)
+                    {
+                        const RHI::DrawPacket* rhiDrawPacket = instancedDraw.m_group->m_drawPacket.GetRHIDrawPacket();
+                        if (rhiDrawPacket && (rhiDrawPacket->GetDrawListMask() & backToFrontDrawListMask).any())
+                        {
+                            AddBackToFrontInstances(instancedDraw, m_instanceObjectIds);
+                        }
+                    }
+                }
+
+                const Data::Instance<RPI::Buffer>& instanceDataBuffer = UpdateInstanceDataBuffer(viewIndex);
+                if (!instanceDataBuffer)
+                {
+                    continue;
+                }
+
+                for (const InstancedDraw& instancedDraw : m_instancedDraws)
+                {
+                    SubmitInstancedDraw(view, instancedDraw, instanceDataBuffer, backToFrontDrawListMask);
+                }
+            }
+        }
+
+        const Data::Instance<RPI::Buffer>& MeshInstanceManager::UpdateInstanceDataBuffer(size_t viewIndex)
+        {
+            Data::Instance<RPI::Buffer>& buffer = m_instanceDataBuffers[viewIndex];
+            const uint32_t dataSize = aznumeric_cast<uint32_t>(m_instanceObjectIds.size() * sizeof(uint32_t));
+
+            if (!buffer)
+            {
+                RPI::CommonBufferDescriptor desc;
+                desc.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
+                desc.m_bufferName = AZStd::string::format("MeshInstanceObjectIds_%zu", viewIndex);
+                desc.m_byteCount = RHI::NextPowerOfTwo(AZStd::max(InstanceDataBufferMinSize, dataSize));
+                desc.m_elementSize = sizeof(uint32_t);
+
+                buffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+                if (!buffer)
+                {
+                    AZ_Error("MeshInstanceManager", false, "Failed to create the instance data buffer for view slot %zu.", viewIndex);
+                    return buffer;
+                }
+            }
+            else if (dataSize > buffer->GetBufferSize())
+            {
+                buffer->Resize(RHI::NextPowerOfTwo(dataSize));
+            }
+
+            buffer->UpdateData(m_instanceObjectIds.data(), dataSize, 0);
+            return buffer;
+        }
+
+        void MeshInstanceManager::SubmitInstancedDraw(
+            RPI::View& view,
+            const InstancedDraw& instancedDraw,
+            const Data::Instance<RPI::Buffer>& instanceDataBuffer,
+            const RHI::DrawListMask& backToFrontDrawListMask)
+        {
+            MeshInstanceGroup& group = *instancedDraw.m_group;
+            const RHI::DrawPacket* rhiDrawPacket = group.m_drawPacket.GetRHIDrawPacket();
+            if (!rhiDrawPacket || (rhiDrawPacket->GetDrawListMask() & view.GetDrawListMask()).none())
+            {
+                return;
+            }
+
+            auto updateObjectSrg = [&group, &instanceDataBuffer, &instancedDraw](
+                Data::Instance<RPI::ShaderResourceGroup>& objectSrg, uint32_t instanceOffset)
+            {
+                if (!objectSrg)
+                {
+                    objectSrg = RPI::ShaderResourceGroup::Create(group.m_objectSrgShaderAsset, group.m_objectSrgName);
+                    if (!objectSrg)
+                    {
+                        return false;
+                    }
+                }
+
+                objectSrg->SetBufferView(group.m_instanceObjectIdsIndex, instanceDataBuffer->GetBufferView());
+                objectSrg->SetConstant(group.m_instanceDataOffsetIndex, instanceOffset);
+                objectSrg->SetConstant(group.m_instanceCountIndex, instancedDraw.m_instanceCount);
+                objectSrg->Compile();
+                return true;
+            };
+
+            MeshInstanceGroup::PerViewDrawData& drawData = group.AcquirePerViewDrawData();
+            if (!updateObjectSrg(drawData.m_objectSrg, instancedDraw.m_instanceOffset))
+            {
+                return;
+            }
+
+            const bool hasBackToFrontInstances = instancedDraw.m_backToFrontInstanceOffset != InstancedDraw::InvalidInstanceOffset;
+            if (hasBackToFrontInstances && !updateObjectSrg(drawData.m_backToFrontObjectSrg, instancedDraw.m_backToFrontInstanceOffset))
+            {
+                return;
+            }
+
+            // Copy the group's draw items, swapping the template object srg for this view's srg and setting the instance count.
+            // The copies must stay alive until the draw lists are submitted, which is guaranteed since they are only rebuilt
+            // in the next frame's OnEndCulling().
+            const RHI::ShaderResourceGroup* templateSrg = group.m_objectSrg->GetRHIShaderResourceGroup();
+            const RHI::ShaderResourceGroup* frontToBackSrg = drawData.m_objectSrg->GetRHIShaderResourceGroup();
+            const RHI::ShaderResourceGroup* backToFrontSrg =
+                hasBackToFrontInstances ? drawData.m_backToFrontObjectSrg->GetRHIShaderResourceGroup() : frontToBackSrg;
+
+            const size_t drawItemCount = rhiDrawPacket->GetDrawItemCount();
+            size_t shaderResourceGroupCount = 0;
+            for (size_t drawItemIndex = 0; drawItemIndex < drawItemCount; ++drawItemIndex)
+            {
+                shaderResourceGroupCount += rhiDrawPacket->GetDrawItem(drawItemIndex).m_item->m_shaderResourceGroupCount;
+            }
+            drawData.m_drawItems.resize(drawItemCount);
+            drawData.m_shaderResourceGroups.resize(shaderResourceGroupCount);
+
+            const RHI::ShaderResourceGroup** shaderResourceGroups = drawData.m_shaderResourceGroups.data();
+            for (size_t drawItemIndex = 0; drawItemIndex < drawItemCount; ++drawItemIndex)
+            {
+                const RHI::DrawListTag drawListTag = rhiDrawPacket->GetDrawListTag(drawItemIndex);
+                const bool backToFront = hasBackToFrontInstances && backToFrontDrawListMask[drawListTag.GetIndex()];
+                const RHI::ShaderResourceGroup* viewSrg = backToFront ? backToFrontSrg : frontToBackSrg;
+
+                RHI::DrawItemProperties drawItemProperties = rhiDrawPacket->GetDrawItem(drawItemIndex);
+                RHI::DrawItem& drawItem = drawData.m_drawItems[drawItemIndex];
+                drawItem = *drawItemProperties.m_item;
+
+                for (uint8_t srgIndex = 0; srgIndex < drawItem.m_shaderResourceGroupCount; ++srgIndex)
+                {
+                    const RHI::ShaderResourceGroup* srg = drawItem.m_shaderResourceGroups[srgIndex];
+                    shaderResourceGroups[srgIndex] = (srg == templateSrg) ? viewSrg : srg;
+                }
+                drawItem.m_shaderResourceGroups = shaderResourceGroups;
+                shaderResourceGroups += drawItem.m_shaderResourceGroupCount;
+
+                if (drawItem.m_arguments.m_type == RHI::DrawType::Indexed)
+                {
+                    drawItem.m_arguments.m_indexed.m_instanceCount = instancedDraw.m_instanceCount;
+                }
+                else if (drawItem.m_arguments.m_type == RHI::DrawType::Linear)
+                {
+                    drawItem.m_arguments.m_linear.m_instanceCount = instancedDraw.m_instanceCount;
+                }
+
+                // Sort the whole draw by its first instance in the list's order: the nearest one for opaque lists that are
+                // sorted front to back, the farthest one for lists that are sorted back to front.
+                drawItemProperties.m_item = &drawItem;
+                drawItemProperties.m_depth = backToFront ? instancedDraw.m_farDepth : instancedDraw.m_nearDepth;
+                view.AddDrawItem(drawListTag, drawItemProperties);
+            }
+        }
+    } // namespace Render
+} // namespace AZ
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RHI/DrawItem.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/FeatureProcessor.h>
+#include <Atom/RPI.Public/MeshDrawPacket.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+#include <Atom/RPI.Public/View.h>
+
+#include <AtomCore/Instance/InstanceId.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class Scene;
+    }
+
+    namespace Render
+    {
+        //! Identifies meshes that can be merged into a single instanced draw: same model lod mesh, same material and same
+        //! draw packet state. Meshes with matching keys share one MeshInstanceGroup.
+        struct MeshInstanceGroupKey
+        {
+            Data::InstanceId m_modelId;
+            Data::InstanceId m_materialId;
+            uint32_t m_lodIndex = 0;
+            uint32_t m_meshIndex = 0;
+            RHI::DrawItemSortKey m_sortKey = 0;
+            uint8_t m_stencilRef = 0;
+
+            bool operator==(const MeshInstanceGroupKey& rhs) const;
+            bool operator!=(const MeshInstanceGroupKey& rhs) const;
+        };
+
+        //! A set of meshes that are drawn with one instanced draw item per view. The group owns a draw packet that is
+        //! built with an instancing-capable object srg. After culling, the object ids of the visible instances are written
+        //! into a per-view structured buffer and a copy of the group's draw items is submitted with the matching instance count.
+        class MeshInstanceGroup
+        {
+            friend class MeshInstanceManager;
+        public:
+            const MeshInstanceGroupKey& GetKey() const { return m_key; }
+            const RPI::MeshDrawPacket& GetDrawPacket() const { return m_drawPacket; }
+            uint32_t GetInstanceCount() const { return m_refCount; }
+
+        private:
+            //! Draw data for one view in the current frame. Instances are kept alive across frames so the draw items and
+            //! srgs can be reused without reallocating.
+            struct PerViewDrawData
+            {
+                Data::Instance<RPI::ShaderResourceGroup> m_objectSrg;
+                //! Points to the back to front copy of the instance object ids, only used for draw lists sorted back to front.
+                Data::Instance<RPI::ShaderResourceGroup> m_backToFrontObjectSrg;
+                AZStd::vector<RHI::DrawItem> m_drawItems;
+                AZStd::vector<const RHI::ShaderResourceGroup*> m_shaderResourceGroups;
+            };
+
+            PerViewDrawData& AcquirePerViewDrawData();
+
+            MeshInstanceGroupKey m_key;
+            RPI::MeshDrawPacket m_drawPacket;
+
+            //! The object srg the draw packet was built with. Per-view srgs are created from the same shader and layout.
+            Data::Instance<RPI::ShaderResourceGroup> m_objectSrg;
+            Data::Asset<RPI::ShaderAsset> m_objectSrgShaderAsset;
+            Name m_objectSrgName;
+            RHI::ShaderInputBufferIndex m_instanceObjectIdsIndex;
+            RHI::ShaderInputConstantIndex m_instanceDataOffsetIndex;
+            RHI::ShaderInputConstantIndex m_instanceCountIndex;
+
+            AZStd::vector<AZStd::unique_ptr<PerViewDrawData>> m_perViewDrawData;
+            size_t m_perViewDrawDataUsedCount = 0;
+
+            uint32_t m_refCount = 0;
+        };
+
+        //! Per-instance record handed to the culling system through Cullable::LodData::Lod::m_visibleObjectUserData.
+        //! When the instance is visible in a view it is routed back to its group by MeshInstanceManager::OnEndCulling().
+        struct MeshInstanceData
+        {
+            MeshInstanceGroup* m_group = nullptr;
+            uint32_t m_objectId = 0;
+            //! Index of the mesh draw packet this record replaces in the owning ModelDataInstance's lod draw packet list.
+            uint32_t m_drawPacketIndex = 0;
+        };
+
+        //! Owns the MeshInstanceGroups for a MeshFeatureProcessor and builds the instanced draw items after culling.
+        class MeshInstanceManager
+        {
+        public:
+            //! A run of visible instances from the same group in a view's sorted visible object list.
+            struct InstancedDraw
+            {
+                static constexpr uint32_t InvalidInstanceOffset = AZStd::numeric_limits<uint32_t>::max();
+
+                MeshInstanceGroup* m_group = nullptr;
+                //! Offset of the instance object ids sorted front to back, which is the order used by opaque draw lists.
+                uint32_t m_instanceOffset = 0;
+                //! Offset of the same object ids sorted back to front, which is only written for groups drawn into a draw list
+                //! that is sorted back to front (e.g. transparent draws).
+                uint32_t m_backToFrontInstanceOffset = InvalidInstanceOffset;
+                uint32_t m_instanceCount = 0;
+                float m_nearDepth = 0.0f;
+                float m_farDepth = 0.0f;
+            };
+
+            //! Sorts the visible instances by group and front to back within each group, then adds one InstancedDraw per
+            //! group and appends the object ids of its instances to instanceObjectIds.
+            static void BuildInstancedDraws(
+                AZStd::vector<RPI::View::VisibleObjectProperties>& visibleObjects,
+                AZStd::vector<uint32_t>& instanceObjectIds,
+                AZStd::vector<InstancedDraw>& instancedDraws);
+
+            //! Appends the object ids of an instanced draw again in back to front order and stores their offset in the draw.
+            static void AddBackToFrontInstances(InstancedDraw& instancedDraw, AZStd::vector<uint32_t>& instanceObjectIds);
+
+            struct KeyHasher
+            {
+                size_t operator()(const MeshInstanceGroupKey& key) const;
+            };
+
+            MeshInstanceManager() = default;
+            AZ_DISABLE_COPY_MOVE(MeshInstanceManager);
+
+            void Activate(RPI::Scene* scene);
+            void Deactivate();
+
+            //! Returns true if meshes drawn with the given material can be merged into instanced draws.
+            static bool SupportsInstancing(const Data::Instance<RPI::Material>& material);
+
+            //! Adds a reference to the group for the given key, creating the group and its draw packet when it doesn't exist.
+            //! This function is thread safe.
+            MeshInstanceGroup* AcquireGroup(
+                const MeshInstanceGroupKey& key, RPI::ModelLod& modelLod, const Data::Instance<RPI::Material>& material);
+
+            //! Releases a reference to a group, destroying it when no instances are left. This function is thread safe.
+            void ReleaseGroup(MeshInstanceGroup* group);
+
+            //! Updates the draw packets of all groups, e.g. after a material or shader variant changed.
+            void UpdateDrawPackets(bool forceUpdate);
+
+            //! Merges the visible instances of each view into instanced draw items and adds them to the view.
+            void OnEndCulling(const RPI::FeatureProcessor::RenderPacket& packet);
+
+            size_t GetGroupCount() const { return m_groups.size(); }
+
+        private:
+            const Data::Instance<RPI::Buffer>& UpdateInstanceDataBuffer(size_t viewIndex);
+            void SubmitInstancedDraw(
+                RPI::View& view,
+                const InstancedDraw& instancedDraw,
+                const Data::Instance<RPI::Buffer>& instanceDataBuffer,
+                const RHI::DrawListMask& backToFrontDrawListMask);
+
+            RPI::Scene* m_scene = nullptr;
+
+            AZStd::mutex m_groupMutex;
+            AZStd::unordered_map<MeshInstanceGroupKey, AZStd::unique_ptr<MeshInstanceGroup>, KeyHasher> m_groups;
+
+            //! One buffer of instance object ids per view slot, reused across frames.
+            AZStd::vector<Data::Instance<RPI::Buffer>> m_instanceDataBuffers;
+
+            // Scratch storage reused between views and frames to avoid per-frame allocations
+            AZStd::vector<RPI::View::VisibleObjectProperties> m_sortedVisibleObjects;
+            AZStd::vector<uint32_t> m_instanceObjectIds;
+            AZStd::vector<InstancedDraw> m_instancedDraws;
+        };
+    } // namespace Render
+} // namespace AZ
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/MeshInstanceManager.h>
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <gtest/gtest.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    class MeshInstanceManagerTests
+        : public UnitTest::LeakDetectionFixture
+    {
+    protected:
+        static MeshInstanceGroupKey CreateKey()
+        {
+            MeshInstanceGroupKey key;
+            key.m_modelId = Data::InstanceId::CreateName("Model");
+            key.m_materialId = Data::InstanceId::CreateName("Material");
+            key.m_lodIndex = 1;
+            key.m_meshIndex = 2;
+            key.m_sortKey = 3;
+            key.m_stencilRef = 4;
+            return key;
+        }
+
+        void AddVisibleObject(MeshInstanceData& instanceData, MeshInstanceGroup& group, uint32_t objectId, float depth)
+        {
+            instanceData.m_group = &group;
+            instanceData.m_objectId = objectId;
+            m_visibleObjects.push_back(RPI::View::VisibleObjectProperties{ &instanceData, depth });
+        }
+
+        AZStd::vector<RPI::View::VisibleObjectProperties> m_visibleObjects;
+        AZStd::vector<uint32_t> m_instanceObjectIds;
+        AZStd::vector<MeshInstanceManager::InstancedDraw> m_instancedDraws;
+    };
+
+    TEST_F(MeshInstanceManagerTests, GroupKey_MatchingKeys_AreEqualAndHashEqual)
+    {
+        const MeshInstanceGroupKey key1 = CreateKey();
+        const MeshInstanceGroupKey key2 = CreateKey();
+
+        EXPECT_TRUE(key1 == key2);
+        EXPECT_FALSE(key1 != key2);
+        EXPECT_EQ(MeshInstanceManager::KeyHasher()(key1), MeshInstanceManager::KeyHasher()(key2));
+    }
+
+    TEST_F(MeshInstanceManagerTests, GroupKey_AnyDifferentField_KeysAreNotEqual)
+    {
+        const MeshInstanceGroupKey key = CreateKey();
+
+        MeshInstanceGroupKey otherKey = CreateKey();
+        otherKey.m_modelId = Data::InstanceId::CreateName("OtherModel");
+        EXPECT_NE(key, otherKey);
+
+        otherKey = CreateKey();
+        otherKey.m_materialId = Data::InstanceId::CreateName("OtherMaterial");
+        EXPECT_NE(key, otherKey);
+
+        otherKey = CreateKey();
+        otherKey.m_lodIndex = 0;
+        EXPECT_NE(key, otherKey);
+
+        otherKey = CreateKey();
+        otherKey.m_meshIndex = 0;
+        EXPECT_NE(key, otherKey);
+
+        otherKey = CreateKey();
+        otherKey.m_sortKey = 0;
+        EXPECT_NE(key, otherKey);
+
+        otherKey = CreateKey();
+        otherKey.m_stencilRef = 0;
+        EXPECT_NE(key, otherKey);
+    }
+
+    TEST_F(MeshInstanceManagerTests, BuildInstancedDraws_InterleavedGroups_OneDrawPerGroupWithContiguousObjectIds)
+    {
+        MeshInstanceGroup groups[2];
+        MeshInstanceData instanceData[5];
+        AddVisibleObject(instanceData[0], groups[0], 10, 1.0f);
+        AddVisibleObject(instanceData[1], groups[1], 20, 2.0f);
+        AddVisibleObject(instanceData[2], groups[0], 11, 3.0f);
+        AddVisibleObject(instanceData[3], groups[1], 21, 4.0f);
+        AddVisibleObject(instanceData[4], groups[0], 12, 5.0f);
+
+        MeshInstanceManager::BuildInstancedDraws(m_visibleObjects, m_instanceObjectIds, m_instancedDraws);
+
+        ASSERT_EQ(m_instancedDraws.size(), 2);
+        EXPECT_EQ(m_instanceObjectIds.size(), 5);
+
+        uint32_t totalInstanceCount = 0;
+        for (const MeshInstanceManager::InstancedDraw& instancedDraw : m_instancedDraws)
+        {
+            const uint32_t expectedCount = instancedDraw.m_group == &groups[0] ? 3 : 2;
+            const uint32_t expectedIdBase = instancedDraw.m_group == &groups[0] ? 10 : 20;
+            ASSERT_EQ(instancedDraw.m_instanceCount, expectedCount);
+            for (uint32_t instanceIndex = 0; instanceIndex < instancedDraw.m_instanceCount; ++instanceIndex)
+            {
+                EXPECT_EQ(m_instanceObjectIds[instancedDraw.m_instanceOffset + instanceIndex], expectedIdBase + instanceIndex);
+            }
+            EXPECT_EQ(instancedDraw.m_backToFrontInstanceOffset, MeshInstanceManager::InstancedDraw::InvalidInstanceOffset);
+            totalInstanceCount += instancedDraw.m_instanceCount;
+        }
+        EXPECT_EQ(totalInstanceCount, 5);
+    }
+
+    TEST_F(MeshInstanceManagerTests, BuildInstancedDraws_UnsortedDepths_InstancesSortedFrontToBack)
+    {
+        MeshInstanceGroup group;
+        MeshInstanceData instanceData[4];
+        AddVisibleObject(instanceData[0], group, 2, 30.0f);
+        AddVisibleObject(instanceData[1], group, 0, -5.0f);
+        AddVisibleObject(instanceData[2], group, 3, 100.0f);
+        AddVisibleObject(instanceData[3], group, 1, 10.0f);
+
+        MeshInstanceManager::BuildInstancedDraws(m_visibleObjects, m_instanceObjectIds, m_instancedDraws);
+
+        ASSERT_EQ(m_instancedDraws.size(), 1);
+        const MeshInstanceManager::InstancedDraw& instancedDraw = m_instancedDraws[0];
+        EXPECT_EQ(instancedDraw.m_instanceOffset, 0);
+        EXPECT_EQ(instancedDraw.m_instanceCount, 4);
+        EXPECT_FLOAT_EQ(instancedDraw.m_nearDepth, -5.0f);
+        EXPECT_FLOAT_EQ(instancedDraw.m_farDepth, 100.0f);
+
+        const AZStd::vector<uint32_t> expectedObjectIds = { 0, 1, 2, 3 };
+        EXPECT_EQ(m_instanceObjectIds, expectedObjectIds);
+    }
+
+    TEST_F(MeshInstanceManagerTests, AddBackToFrontInstances_SortedDraw_AppendsObjectIdsInReverseOrder)
+    {
+        MeshInstanceGroup groups[2];
+        MeshInstanceData instanceData[5];
+        AddVisibleObject(instanceData[0], groups[0], 10, 1.0f);
+        AddVisibleObject(instanceData[1], groups[0], 11, 2.0f);
+        AddVisibleObject(instanceData[2], groups[0], 12, 3.0f);
+        AddVisibleObject(instanceData[3], groups[1], 20, 1.0f);
+        AddVisibleObject(instanceData[4], groups[1], 21, 2.0f);
+
+        MeshInstanceManager::BuildInstancedDraws(m_visibleObjects, m_instanceObjectIds, m_instancedDraws);
+        ASSERT_EQ(m_instancedDraws.size(), 2);
+
+        MeshInstanceManager::InstancedDraw& transparentDraw =
+            m_instancedDraws[0].m_group == &groups[0] ? m_instancedDraws[0] : m_instancedDraws[1];
+        const MeshInstanceManager::InstancedDraw& opaqueDraw =
+            m_instancedDraws[0].m_group == &groups[0] ? m_instancedDraws[1] : m_instancedDraws[0];
+
+        MeshInstanceManager::AddBackToFrontInstances(transparentDraw, m_instanceObjectIds);
+
+        ASSERT_EQ(m_instanceObjectIds.size(), 8);
+        ASSERT_EQ(transparentDraw.m_backToFrontInstanceOffset, 5);
+        EXPECT_EQ(m_instanceObjectIds[5], 12);
+        EXPECT_EQ(m_instanceObjectIds[6], 11);
+        EXPECT_EQ(m_instanceObjectIds[7], 10);
+
+        // The front to back order used by opaque draw lists is left untouched
+        for (uint32_t instanceIndex = 0; instanceIndex < transparentDraw.m_instanceCount; ++instanceIndex)
+        {
+            EXPECT_EQ(m_instanceObjectIds[transparentDraw.m_instanceOffset + instanceIndex], 10 + instanceIndex);
+        }
+        EXPECT_EQ(opaqueDraw.m_backToFrontInstanceOffset, MeshInstanceManager::InstancedDraw::InvalidInstanceOffset);
+        EXPECT_EQ(m_instanceObjectIds[opaqueDraw.m_instanceOffset], 20);
+        EXPECT_EQ(m_instanceObjectIds[opaqueDraw.m_instanceOffset + 1], 21);
+    }
+} // namespace UnitTest
@@ -157,6 +157,8 @@ set(FILES
     Source/Math/MathFilter.cpp
     Source/Math/MathFilterDescriptor.h
     Source/Mesh/MeshFeatureProcessor.cpp
+    Source/Mesh/MeshInstanceManager.cpp
+    Source/Mesh/MeshInstanceManager.h
     Source/Mesh/ModelReloader.cpp
     Source/Mesh/ModelReloader.h
     Source/Mesh/ModelReloaderSystem.cpp
@@ -16,4 +16,5 @@ set(FILES
     Tests/SparseVectorTests.cpp
     Tests/SkinnedMesh/SkinnedMeshDispatchItemTests.cpp
     Tests/Decals/DecalTextureArrayTests.cpp
+    Tests/Mesh/MeshInstanceManagerTests.cpp
 )
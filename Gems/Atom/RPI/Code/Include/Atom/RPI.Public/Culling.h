@@ -99,6 +99,10 @@ namespace AZ
                     float m_screenCoverageMin;
                     float m_screenCoverageMax;
                     AZStd::vector<const RHI::DrawPacket*> m_drawPackets;
+
+                    //! Opaque data forwarded to View::AddVisibleObject() when this lod is visible, for feature processors that
+                    //! build their draw items after culling (e.g. instanced meshes). See FeatureProcessor::OnEndCulling().
+                    AZStd::vector<const void*> m_visibleObjectUserData;
                 };
 
                 AZStd::vector<Lod> m_lods;
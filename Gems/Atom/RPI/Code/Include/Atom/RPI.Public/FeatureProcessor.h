@@ -121,6 +121,12 @@ namespace AZ
             //!  - This may be called in parallel with other feature processors.
             virtual void Render(const RenderPacket&) {}
 
+            //! The feature processor may build draw items for objects it recorded with View::AddVisibleObject().
+            //! 
+            //!  - This is called every frame, after culling is complete and before the draw lists are finalized.
+            //!  - This is called on a single thread for each feature processor in turn.
+            virtual void OnEndCulling(const RenderPacket&) {}
+
             //! The feature processor may do clean up when the current render frame is finished
             //!  - This is called every RPI::RenderTick.
             virtual void OnRenderEnd() {}
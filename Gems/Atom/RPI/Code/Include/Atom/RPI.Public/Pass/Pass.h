@@ -221,6 +221,9 @@ namespace AZ
             //! Function used by views to sort draw lists. Can be overridden so passes can provide custom sort functionality.
             virtual void SortDrawList(RHI::DrawList& drawList) const;
 
+            //! Returns the sort type used by the default SortDrawList() implementation.
+            RHI::DrawListSortType GetDrawListSortType() const { return m_drawListSortType; }
+
             //! Check if the pass is associated to a view. If pass has a pipeline view tag, the rpi view assigned to this view tag will have pass's draw list tag.
             virtual const PipelineViewTag& GetPipelineViewTag() const;
 
@@ -10,6 +10,7 @@
 
 #include <Atom/RHI/ShaderResourceGroup.h>
 #include <Atom/RHI/DrawListContext.h>
+#include <Atom/RHI/ThreadLocalContext.h>
 
 #include <Atom/RPI.Public/Base.h>
 #include <Atom/RPI.Public/Pass/Pass.h>
@@ -56,6 +57,15 @@ namespace AZ
                 UsageReflectiveCubeMap = (1u << 2),
                 UsageXR = (1u << 3)
             };
+            //! An object that passed culling for this view, recorded for feature processors that build their draw items
+            //! after culling instead of submitting pre-built draw packets (see FeatureProcessor::OnEndCulling()).
+            struct VisibleObjectProperties
+            {
+                const void* m_userData = nullptr;
+                float m_depth = 0.0f;
+            };
+            using VisibleObjectList = AZStd::vector<VisibleObjectProperties>;
+
             //! Only use this function to create a new view object. And force using smart pointer to manage view's life time
             static ViewPtr CreateView(const AZ::Name& name, UsageFlags usage);
 
@@ -79,6 +89,20 @@ namespace AZ
             //! Add a draw item to this view with its associated draw list tag
             void AddDrawItem(RHI::DrawListTag drawListTag, const RHI::DrawItemProperties& drawItemProperties);
 
+            //! Records an object that is visible in this view. The user data is opaque to the view and is consumed by the
+            //! feature processor that owns it once culling is complete. This function is thread safe.
+            void AddVisibleObject(const void* userData, Vector3 worldPosition);
+
+            //! Merges the visible objects added during culling into a single list. This should only be called once all
+            //! culling work for the current frame is complete.
+            void FinalizeVisibleObjectList();
+
+            //! Returns the visible objects for the current frame. Only valid after FinalizeVisibleObjectList() was called.
+            const VisibleObjectList& GetVisibleObjectList() const { return m_visibleObjectList; }
+
+            //! Returns true if the pass that draws the given draw list in this view sorts it back to front, e.g. for transparent draws.
+            bool IsDrawListSortedBackToFront(RHI::DrawListTag drawListTag) const;
+
             //! Applies some flags to the view that are reset each frame. The provided flags are combined with m_andFlags
             //! using &, and are combined with m_orFlags using |.
             void ApplyFlags(uint32_t flags);
@@ -200,6 +224,10 @@ namespace AZ
             RHI::DrawListContext m_drawListContext;
             RHI::DrawListMask m_drawListMask;
 
+            // Visible objects added during culling, stored per thread and merged in FinalizeVisibleObjectList()
+            RHI::ThreadLocalContext<VisibleObjectList> m_threadVisibleObjectLists;
+            VisibleObjectList m_visibleObjectList;
+
             Matrix4x4 m_worldToViewMatrix;
             Matrix4x4 m_viewToWorldMatrix;
             Matrix4x4 m_viewToClipMatrix;
@@ -764,6 +764,10 @@ namespace AZ
                 {
                     view.AddDrawPacket(drawPacket, pos);
                 }
+                for (const void* visibleObjectUserData : lod.m_visibleObjectUserData)
+                {
+                    view.AddVisibleObject(visibleObjectUserData, pos);
+                }
             };
 
             switch (lodData.m_lodConfiguration.m_lodType)
@@ -805,6 +805,19 @@ namespace AZ
 
                 m_cullingScene->EndCulling();
 
+                {
+                    AZ_PROFILE_SCOPE(RPI, "Scene: OnEndCulling");
+                    for (auto& view : m_renderPacket.m_views)
+                    {
+                        view->FinalizeVisibleObjectList();
+                    }
+
+                    for (auto& fp : m_featureProcessors)
+                    {
+                        fp->OnEndCulling(m_renderPacket);
+                    }
+                }
+
                 // Add dynamic draw data for all the views
                 if (m_dynamicDrawSystem)
                 {
@@ -94,6 +94,8 @@ namespace AZ
         {
             m_drawListMask.reset();
             m_drawListContext.Shutdown();
+            m_threadVisibleObjectLists.Clear();
+            m_visibleObjectList.clear();
             m_passesByDrawList = nullptr;
         }
 
@@ -125,6 +127,42 @@ namespace AZ
             m_drawListContext.AddDrawItem(drawListTag, drawItemProperties);
         }
 
+        void View::AddVisibleObject(const void* userData, Vector3 worldPosition)
+        {
+            // This function is thread safe since each thread appends to its own list.
+            Vector3 cameraToObject = worldPosition - m_position;
+            float depth = cameraToObject.Dot(-m_viewToWorldMatrix.GetBasisZAsVector3());
+            m_threadVisibleObjectLists.GetStorage().push_back(VisibleObjectProperties{ userData, depth });
+        }
+
+        void View::FinalizeVisibleObjectList()
+        {
+            AZ_PROFILE_SCOPE(RPI, "View: FinalizeVisibleObjectList");
+            m_visibleObjectList.clear();
+            m_threadVisibleObjectLists.ForEach([this](VisibleObjectList& threadList)
+            {
+                m_visibleObjectList.insert(m_visibleObjectList.end(), threadList.begin(), threadList.end());
+                threadList.clear();
+            });
+        }
+
+        bool View::IsDrawListSortedBackToFront(RHI::DrawListTag drawListTag) const
+        {
+            if (!m_passesByDrawList)
+            {
+                return false;
+            }
+
+            auto passIter = m_passesByDrawList->find(drawListTag);
+            if (passIter == m_passesByDrawList->end())
+            {
+                return false;
+            }
+
+            const RHI::DrawListSortType sortType = passIter->second->GetDrawListSortType();
+            return sortType == RHI::DrawListSortType::KeyThenReverseDepth || sortType == RHI::DrawListSortType::ReverseDepthThenKey;
+        }
+
         void View::ApplyFlags(uint32_t flags)
         {
             AZStd::atomic_fetch_and(&m_andFlags, flags);
@@ -295,6 +295,11 @@ namespace EMotionFX
                 UpdateWorldTransform();
             }
 
+            if (updateJointTransforms)
+            {
+                UpdatePoseInterpolation(sampleMotions);
+            }
+
             // when the actor instance isn't visible, we don't want to do more things
             if (!updateJointTransforms)
             {
@@ -1697,6 +1702,81 @@ namespace EMotionFX
         return m_motionSamplingRate;
     }
 
+    void ActorInstance::SetPoseInterpolationEnabled(bool enabled)
+    {
+        m_poseInterpolation = enabled;
+        if (!enabled)
+        {
+            m_prevSampledPose.reset();
+            m_lastSampledPose.reset();
+            m_numSampledPoses = 0;
+        }
+    }
+
+    bool ActorInstance::GetPoseInterpolationEnabled() const
+    {
+        return m_poseInterpolation;
+    }
+
+    void ActorInstance::SetUpdateImportance(float importance)
+    {
+        m_updateImportance = importance;
+    }
+
+    float ActorInstance::GetUpdateImportance() const
+    {
+        return m_updateImportance;
+    }
+
+    void ActorInstance::SetUpdateSignificance(float significance)
+    {
+        m_updateSignificance = significance;
+    }
+
+    float ActorInstance::GetUpdateSignificance() const
+    {
+        return m_updateSignificance;
+    }
+
+    void ActorInstance::UpdatePoseInterpolation(bool motionsSampled)
+    {
+        // Nothing to interpolate when sampling every frame. Start over once the sampling rate drops again.
+        if (!m_poseInterpolation || m_motionSamplingRate <= 0.0f)
+        {
+            m_numSampledPoses = 0;
+            return;
+        }
+
+        if (!m_prevSampledPose)
+        {
+            m_prevSampledPose.reset(aznew Pose());
+            m_prevSampledPose->LinkToActorInstance(this);
+            m_lastSampledPose.reset(aznew Pose());
+            m_lastSampledPose->LinkToActorInstance(this);
+        }
+
+        Pose* currentPose = m_transformData->GetCurrentPose();
+        if (motionsSampled)
+        {
+            AZStd::swap(m_prevSampledPose, m_lastSampledPose);
+            m_lastSampledPose->InitFromPose(currentPose);
+            m_numSampledPoses = AZStd::min<size_t>(m_numSampledPoses + 1, 2);
+
+            // Show the previous sample, which the interpolation reached at the end of the last sampling interval.
+            if (m_numSampledPoses == 2)
+            {
+                currentPose->InitFromPose(m_prevSampledPose.get());
+            }
+        }
+        else if (m_numSampledPoses == 2)
+        {
+            const float weight = AZ::GetClamp(m_motionSamplingTimer / m_motionSamplingRate, 0.0f, 1.0f);
+            currentPose->InitFromPose(m_prevSampledPose.get());
+            currentPose->Blend(m_lastSampledPose.get(), weight);
+            currentPose->InvalidateAllModelSpaceTransforms();
+        }
+    }
+
     void ActorInstance::IncreaseNumAttachmentRefs(uint8 numToIncreaseWith)
     {
         m_numAttachmentRefs += numToIncreaseWith;
@@ -37,6 +37,7 @@ namespace EMotionFX
     class Attachment;
     class AnimGraphInstance;
     class MorphSetupInstance;
+    class Pose;
     class RagdollInstance;
 
 
@@ -857,6 +858,30 @@ namespace EMotionFX
         float GetMotionSamplingTimer() const;
         float GetMotionSamplingRate() const;
 
+        /**
+         * Enable or disable pose interpolation for motion sampling rates that are lower than the update rate.
+         * When enabled, the frames in between two motion samples blend between the last two sampled poses rather than showing the last one
+         * until the next sample. This smooths out the animation, while the shown pose lags one sample behind.
+         * @param[in] enabled True to interpolate between the sampled poses, false to keep the last sampled pose.
+         */
+        void SetPoseInterpolationEnabled(bool enabled);
+        bool GetPoseInterpolationEnabled() const;
+
+        /**
+         * Set the gameplay importance of this actor instance, which is used by the update budget of the actor update scheduler.
+         * Actor instances with a higher importance keep higher motion sampling rates and skeletal LOD levels for longer.
+         * @param[in] importance The importance, where 1 is the default, 0 is unimportant and values above 1 mean more important than usual.
+         */
+        void SetUpdateImportance(float importance);
+        float GetUpdateImportance() const;
+
+        /**
+         * Set the update significance, which is calculated by the update budget of the actor update scheduler.
+         * @param[in] significance The significance in range [0, 1], where 1 means full update rate and detail.
+         */
+        void SetUpdateSignificance(float significance);
+        float GetUpdateSignificance() const;
+
         MCORE_INLINE size_t GetNumNodes() const         { return m_actor->GetSkeleton()->GetNumNodes(); }
 
         void UpdateVisualizeScale();                    // not automatically called on creation for performance reasons (this method relatively is slow as it updates all meshes)
@@ -892,6 +917,12 @@ namespace EMotionFX
         float                   m_boundsUpdatePassedTime;/**< The time passed since the last bounds update. */
         float                   m_motionSamplingRate;    /**< The motion sampling rate in seconds, where 0.1 would mean to update 10 times per second. A value of 0 or lower means to update every frame. */
         float                   m_motionSamplingTimer;   /**< The time passed since the last time we sampled motions/anim graphs. */
+        float                   m_updateImportance = 1.0f;   /**< The gameplay importance, used by the update budget of the scheduler. */
+        float                   m_updateSignificance = 1.0f; /**< The significance as calculated by the update budget of the scheduler. */
+        AZStd::unique_ptr<Pose> m_prevSampledPose;       /**< The sampled pose before the last one, only used with pose interpolation. */
+        AZStd::unique_ptr<Pose> m_lastSampledPose;       /**< The last sampled pose, only used with pose interpolation. */
+        size_t                  m_numSampledPoses = 0;   /**< The number of valid sampled poses for the pose interpolation. */
+        bool                    m_poseInterpolation = false; /**< Interpolate between the sampled poses when the motion sampling rate is lower than the update rate? */
         float                   m_visualizeScale;        /**< Some visualization scale factor when rendering for example normals, to be at a nice size, relative to the character. */
         size_t                  m_lodLevel;              /**< The current LOD level, where 0 is the highest detail. */
         size_t                  m_requestedLODLevel;    /**< Requested LOD level. The actual LOD level will be updated as soon as all transforms for the requested LOD level are ready. */
@@ -1012,5 +1043,11 @@ namespace EMotionFX
          * newly enabled joints (the ones that were not present and thus also not updated in the lower LOD level)will contain incorrect data.
          */
         void UpdateLODLevel();
+
+        /**
+         * Store the sampled pose or interpolate between the last two sampled poses, in case pose interpolation is enabled.
+         * @param[in] motionsSampled True in case the current pose got sampled this frame.
+         */
+        void UpdatePoseInterpolation(bool motionsSampled);
     };
 }   // namespace EMotionFX
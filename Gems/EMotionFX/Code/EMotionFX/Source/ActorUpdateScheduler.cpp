@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathUtils.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/ActorUpdateScheduler.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+
+
+namespace EMotionFX
+{
+    void ActorUpdateScheduler::SetUpdateBudget(const UpdateBudget& budget)
+    {
+        // Hand the actor instances back to full rate when the budget gets disabled.
+        if (m_updateBudget.m_enabled && !budget.m_enabled)
+        {
+            const ActorManager& actorManager = GetActorManager();
+            const size_t numActorInstances = actorManager.GetNumActorInstances();
+            for (size_t i = 0; i < numActorInstances; ++i)
+            {
+                ActorInstance* actorInstance = actorManager.GetActorInstance(i);
+                actorInstance->SetUpdateSignificance(1.0f);
+                actorInstance->SetMotionSamplingRate(0.0f);
+                actorInstance->SetPoseInterpolationEnabled(false);
+            }
+        }
+
+        // Start over with the full significance whenever the budget gets enabled or disabled.
+        if (m_updateBudget.m_enabled != budget.m_enabled)
+        {
+            m_budgetScale = 1.0f;
+        }
+
+        m_updateBudget = budget;
+    }
+
+
+    void ActorUpdateScheduler::ApplyUpdateBudget()
+    {
+        if (!m_updateBudget.m_enabled)
+        {
+            return;
+        }
+
+        const float maxSampleInterval = (m_updateBudget.m_minSampleRate > 0.0f) ? 1.0f / m_updateBudget.m_minSampleRate : 0.0f;
+
+        const ActorManager& actorManager = GetActorManager();
+        const size_t numActorInstances = actorManager.GetNumActorInstances();
+        for (size_t i = 0; i < numActorInstances; ++i)
+        {
+            ActorInstance* actorInstance = actorManager.GetActorInstance(i);
+            if (!actorInstance->GetIsEnabled())
+            {
+                continue;
+            }
+
+            float significance = actorInstance->GetUpdateImportance() * m_budgetScale;
+
+            // The significance falls off with the distance to the viewer, outside of the full rate distance.
+            const float distance = actorInstance->GetWorldSpaceTransform().m_position.GetDistance(m_viewerPosition);
+            if (distance > m_updateBudget.m_fullRateDistance)
+            {
+                significance *= m_updateBudget.m_fullRateDistance / distance;
+            }
+
+            if (!actorInstance->GetIsVisible())
+            {
+                significance *= m_updateBudget.m_invisibleSignificance;
+            }
+
+            significance = AZ::GetClamp(significance, 0.0f, 1.0f);
+            actorInstance->SetUpdateSignificance(significance);
+
+            // Fully significant actor instances sample every frame, the least significant ones at the minimum sample rate.
+            const float sampleInterval = (significance < 1.0f) ? (1.0f - significance) * maxSampleInterval : 0.0f;
+            actorInstance->SetMotionSamplingRate(sampleInterval);
+            actorInstance->SetPoseInterpolationEnabled(m_updateBudget.m_interpolatePoses);
+
+            if (m_updateBudget.m_adjustSkeletalLOD)
+            {
+                const size_t numLODLevels = actorInstance->GetActor()->GetNumLODLevels();
+                if (numLODLevels > 1)
+                {
+                    const size_t lodLevel = AZStd::min(static_cast<size_t>((1.0f - significance) * numLODLevels), numLODLevels - 1);
+                    actorInstance->SetLODLevel(lodLevel);
+                }
+            }
+        }
+    }
+
+
+    void ActorUpdateScheduler::FinishUpdateBudget(float updateTimeInSeconds)
+    {
+        if (!m_updateBudget.m_enabled || m_updateBudget.m_maxUpdateTimeInMs <= 0.0f)
+        {
+            m_budgetScale = 1.0f;
+            return;
+        }
+
+        // Scale the significance down quickly when over budget, and recover slowly to avoid oscillating update rates.
+        const float updateTimeInMs = updateTimeInSeconds * 1000.0f;
+        if (updateTimeInMs > m_updateBudget.m_maxUpdateTimeInMs)
+        {
+            m_budgetScale = AZStd::max(m_budgetScale * 0.9f, s_minBudgetScale);
+        }
+        else if (updateTimeInMs < m_updateBudget.m_maxUpdateTimeInMs * 0.75f)
+        {
+            m_budgetScale = AZStd::min(m_budgetScale * 1.05f, 1.0f);
+        }
+    }
+}   // namespace EMotionFX
@@ -11,6 +11,7 @@
 // include the required headers
 #include "EMotionFXConfig.h"
 #include "BaseObject.h"
+#include <AzCore/Math/Vector3.h>
 
 
 namespace EMotionFX
@@ -28,6 +29,44 @@ namespace EMotionFX
         : public BaseObject
     {
     public:
+        /**
+         * The update budget settings.
+         * The update budget calculates a significance for each actor instance, based on its distance to the viewer, its visibility
+         * and its gameplay importance. Less significant actor instances get lower motion sampling rates and optionally lower skeletal LOD levels.
+         * When updating all actor instances takes longer than the time budget, the significance of all actor instances gets scaled down
+         * until the updates fit into the budget again.
+         */
+        struct EMFX_API UpdateBudget
+        {
+            bool    m_enabled = false;                  /**< Automatically adjust the motion sampling rates of the actor instances? */
+            float   m_maxUpdateTimeInMs = 4.0f;         /**< The time budget for updating all actor instances per frame, in milliseconds. A value of 0 disables the time budget. */
+            float   m_fullRateDistance = 10.0f;         /**< Actor instances within this distance to the viewer get full significance. */
+            float   m_minSampleRate = 10.0f;            /**< The motion sampling rate of the least significant actor instances, in samples per second. */
+            float   m_invisibleSignificance = 0.1f;     /**< Scale of the significance of actor instances that are not visible. */
+            bool    m_interpolatePoses = true;          /**< Interpolate the poses of actor instances that do not sample every frame? */
+            bool    m_adjustSkeletalLOD = false;        /**< Also pick the skeletal LOD level based on the significance? */
+        };
+
+        /**
+         * Set the update budget settings.
+         * @param budget The update budget settings.
+         */
+        void SetUpdateBudget(const UpdateBudget& budget);
+        const UpdateBudget& GetUpdateBudget() const                 { return m_updateBudget; }
+
+        /**
+         * Set the position of the viewer, usually the camera, which the update budget uses to calculate the significance of the actor instances.
+         * @param position The position of the viewer, in world space.
+         */
+        void SetViewerPosition(const AZ::Vector3& position)         { m_viewerPosition = position; }
+        const AZ::Vector3& GetViewerPosition() const                { return m_viewerPosition; }
+
+        /**
+         * Get the scale the update budget applies to the significance of all actor instances to stay within the time budget.
+         * @result The budget scale in range [s_minBudgetScale, 1], where 1 means the updates fit into the time budget.
+         */
+        float GetBudgetScale() const                                { return m_budgetScale; }
+
         /**
          * Get the name of this class, or a description.
          * @result The string containing the name of the scheduler.
@@ -88,6 +127,23 @@ namespace EMotionFX
         MCore::AtomicSizeT m_numUpdated;
         MCore::AtomicSizeT m_numVisible;
         MCore::AtomicSizeT m_numSampled;
+        UpdateBudget m_updateBudget;
+        AZ::Vector3 m_viewerPosition = AZ::Vector3::CreateZero();
+        float m_budgetScale = 1.0f;
+
+        static constexpr float s_minBudgetScale = 0.05f;
+
+        /**
+         * Calculate the significance of all actor instances and adjust their motion sampling rates and LOD levels accordingly.
+         * Call this at the beginning of Execute(), after the visibility got propagated to the attachments.
+         */
+        void ApplyUpdateBudget();
+
+        /**
+         * Adjust the budget scale based on how long updating all actor instances took.
+         * @param updateTimeInSeconds The time it took to update all actor instances, in seconds.
+         */
+        void FinishUpdateBudget(float updateTimeInSeconds);
 
         /**
          * The constructor.
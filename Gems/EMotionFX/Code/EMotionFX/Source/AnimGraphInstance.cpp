@@ -47,6 +47,7 @@ namespace EMotionFX
         m_visualizeScale         = 1.0f;
         m_autoReleaseAllPoses   = true;
         m_autoReleaseAllRefDatas= true;
+        m_parallelOutput         = false;
 
 #if defined(EMFX_DEVELOPMENT_BUILD)
         m_isOwnedByRuntime       = false;
@@ -252,6 +253,10 @@ namespace EMotionFX
         {
             ReleasePoses();
             posePool.FreeAllPoses();
+            for (const AZStd::unique_ptr<AnimGraphPosePool>& parallelOutputPosePool : m_parallelOutputPosePools)
+            {
+                parallelOutputPosePool->FreeAllPoses();
+            }
         }
 
         // Gather active state. Must be done in output function.
@@ -1104,6 +1109,40 @@ namespace EMotionFX
     }
 
 
+    void AnimGraphInstance::SetParallelOutputEnabled(bool enabled)
+    {
+        m_parallelOutput = enabled;
+    }
+
+
+    bool AnimGraphInstance::GetParallelOutputEnabled() const
+    {
+        return m_parallelOutput;
+    }
+
+
+    AnimGraphPosePool& AnimGraphInstance::GetParallelOutputPosePool(size_t subtreeIndex)
+    {
+        while (m_parallelOutputPosePools.size() <= subtreeIndex)
+        {
+            m_parallelOutputPosePools.emplace_back(AZStd::make_unique<AnimGraphPosePool>());
+        }
+        return *m_parallelOutputPosePools[subtreeIndex];
+    }
+
+
+    size_t AnimGraphInstance::GetNumParallelOutputs() const
+    {
+        return m_numParallelOutputs;
+    }
+
+
+    void AnimGraphInstance::IncreaseNumParallelOutputs()
+    {
+        m_numParallelOutputs++;
+    }
+
+
     bool AnimGraphInstance::GetRetargetingEnabled() const
     {
         return m_retarget;
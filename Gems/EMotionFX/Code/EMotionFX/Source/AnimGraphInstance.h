@@ -17,6 +17,7 @@
 #include <EMotionFX/Source/EMotionFXConfig.h>
 #include <MCore/Source/Attribute.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <MCore/Source/Random.h>
 
 
@@ -38,6 +39,7 @@ namespace EMotionFX
     class AnimGraphInstanceEventHandler;
     class AnimGraphObjectData;
     class AnimGraphNodeData;
+    class AnimGraphPosePool;
 
     /**
      * The anim graph instance class.
@@ -206,6 +208,28 @@ namespace EMotionFX
         bool GetRetargetingEnabled() const;
         void SetRetargetingEnabled(bool enabled);
 
+        /**
+         * Enable or disable outputting independent subtrees of the blend trees in parallel.
+         * This is worth it for large anim graphs only, as the subtrees run as jobs and their output poses have to be copied back.
+         * @param[in] enabled True to output independent subtrees in parallel, false to output the anim graph on the calling thread only.
+         */
+        void SetParallelOutputEnabled(bool enabled);
+        bool GetParallelOutputEnabled() const;
+
+        /**
+         * Get the pose pool for a subtree that is output in parallel. There is one pool per subtree, so the jobs don't share a pool.
+         * @param[in] subtreeIndex The index of the subtree among the ones that are output in parallel.
+         * @result The pose pool to be used by the given subtree.
+         */
+        AnimGraphPosePool& GetParallelOutputPosePool(size_t subtreeIndex);
+
+        /**
+         * Get the number of times independent subtrees got output in parallel, e.g. to check if the parallel output kicks in for a given anim graph.
+         * @result The number of parallel outputs since the anim graph instance got created.
+         */
+        size_t GetNumParallelOutputs() const;
+        void IncreaseNumParallelOutputs();
+
         AnimGraphNode* GetRootNode() const;
 
         //-----------------------------------------------------------------------------------------------------------------
@@ -319,6 +343,9 @@ namespace EMotionFX
 
         bool                                                m_autoReleaseAllPoses;
         bool                                                m_autoReleaseAllRefDatas;
+        bool                                                m_parallelOutput;        /**< Output independent subtrees of the blend trees in parallel? */
+        AZStd::vector<AZStd::unique_ptr<AnimGraphPosePool>> m_parallelOutputPosePools; /**< The pose pools for the subtrees that get output in parallel. */
+        size_t                                              m_numParallelOutputs = 0; /**< The number of times subtrees got output in parallel. */
         
         AZStd::vector<AnimGraphInstance*>                   m_followerGraphs;
         AZStd::vector<AnimGraphInstance*>                   m_leaderGraphs;
@@ -10,6 +10,7 @@
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 #include <EMotionFX/Source/AnimGraphBus.h>
 #include "EMotionFXConfig.h"
@@ -31,6 +32,7 @@
 
 #include "AnimGraphMotionNode.h"
 #include "ActorManager.h"
+#include "BlendTree.h"
 #include "EMotionFXManager.h"
 
 #include <MCore/Source/StringIdPool.h>
@@ -1601,6 +1603,26 @@ namespace EMotionFX
     // output all incoming nodes
     void AnimGraphNode::OutputAllIncomingNodes(AnimGraphInstance* animGraphInstance)
     {
+        // Only the nodes that output a pose are worth to be output in parallel.
+        if (animGraphInstance->GetParallelOutputEnabled())
+        {
+            AZStd::fixed_vector<AnimGraphNode*, 8> poseNodes;
+            for (const BlendTreeConnection* connection : m_connections)
+            {
+                AnimGraphNode* sourceNode = connection->GetSourceNode();
+                if (sourceNode->GetHasOutputPose() && poseNodes.size() < poseNodes.capacity() &&
+                    AZStd::find(poseNodes.begin(), poseNodes.end(), sourceNode) == poseNodes.end())
+                {
+                    poseNodes.emplace_back(sourceNode);
+                }
+            }
+
+            if (poseNodes.size() > 1)
+            {
+                OutputIncomingNodes(animGraphInstance, poseNodes);
+            }
+        }
+
         for (const BlendTreeConnection* connection : m_connections)
         {
             OutputIncomingNode(animGraphInstance, connection->GetSourceNode());
@@ -1608,6 +1630,26 @@ namespace EMotionFX
     }
 
 
+    // output several incoming nodes, in parallel when possible
+    void AnimGraphNode::OutputIncomingNodes(AnimGraphInstance* animGraphInstance, AZStd::span<AnimGraphNode* const> nodesToOutput)
+    {
+        if (animGraphInstance->GetParallelOutputEnabled())
+        {
+            BlendTree* blendTree = azdynamic_cast<BlendTree*>(m_parentNode);
+            if (blendTree)
+            {
+                blendTree->OutputNodesInParallel(animGraphInstance, nodesToOutput);
+            }
+        }
+
+        // Output whatever did not get output in parallel. Nodes that are done already return right away.
+        for (AnimGraphNode* nodeToOutput : nodesToOutput)
+        {
+            OutputIncomingNode(animGraphInstance, nodeToOutput);
+        }
+    }
+
+
     // update a specific node
     void AnimGraphNode::UpdateIncomingNode(AnimGraphInstance* animGraphInstance, AnimGraphNode* node, float timePassedInSeconds)
     {
@@ -1979,6 +2021,13 @@ namespace EMotionFX
     // decrease the reference count
     void AnimGraphNode::DecreaseRef(AnimGraphInstance* animGraphInstance)
     {
+        // Nodes without an output pose have nothing to release. Returning early also keeps the value nodes that are shared
+        // by subtrees that get output in parallel untouched.
+        if (!GetHasOutputPose())
+        {
+            return;
+        }
+
         AnimGraphNodeData* uniqueData = FindOrCreateUniqueNodeData(animGraphInstance);
         if (uniqueData->GetPoseRefCount() == 0)
         {
@@ -1986,7 +2035,7 @@ namespace EMotionFX
         }
 
         uniqueData->DecreasePoseRefCount();
-        if (uniqueData->GetPoseRefCount() > 0 || !GetHasOutputPose())
+        if (uniqueData->GetPoseRefCount() > 0)
         {
             return;
         }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/RTTI/ReflectContext.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/tuple.h>
 #include <EMotionFX/Source/AnimGraphObjectIds.h>
@@ -164,6 +165,7 @@ namespace EMotionFX
         virtual bool GetHasVisualGraph() const { return false; }
         virtual bool GetCanHaveChildren() const { return false; }
         virtual bool GetHasOutputPose() const { return false; }
+        virtual bool GetSupportsParallelOutput() const { return true; }
         virtual bool GetCanBeInsideStateMachineOnly() const { return false; }
         virtual bool GetCanBeInsideChildStateMachineOnly() const{ return false; }
         virtual bool GetNeedsNetTimeSync() const                { return false; }
@@ -898,6 +900,13 @@ namespace EMotionFX
         void MarkConnectionVisited(AnimGraphNode* sourceNode);
         void OutputIncomingNode(AnimGraphInstance* animGraphInstance, AnimGraphNode* nodeToOutput);
 
+        /**
+         * Output several incoming nodes. Independent subtrees get output in parallel in case the anim graph instance has parallel output enabled.
+         * @param[in] animGraphInstance The anim graph instance to output the nodes for.
+         * @param[in] nodesToOutput The incoming nodes to output. Entries can be nullptr.
+         */
+        void OutputIncomingNodes(AnimGraphInstance* animGraphInstance, AZStd::span<AnimGraphNode* const> nodesToOutput);
+
         MCORE_INLINE AnimGraphNodeData* FindOrCreateUniqueNodeData(AnimGraphInstance* animGraphInstance) const { return animGraphInstance->FindOrCreateUniqueNodeData(this); }
 
         bool GetIsEnabled() const;
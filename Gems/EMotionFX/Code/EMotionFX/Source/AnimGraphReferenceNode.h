@@ -107,6 +107,7 @@ namespace EMotionFX
         bool GetCanActAsState() const override                      { return true; }
         bool GetSupportsVisualization() const override              { return true; }
         bool GetHasOutputPose() const override                      { return true; }
+        bool GetSupportsParallelOutput() const override             { return false; }
         bool GetHasVisualOutputPorts() const override               { return true; }
         bool GetCanHaveOnlyOneInsideParent() const override         { return false; }
         bool GetHasVisualGraph() const override;
@@ -6,8 +6,13 @@
  *
  */
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <EMotionFX/Source/AnimGraph.h>
 #include "EMotionFXConfig.h"
 #include "BlendTree.h"
@@ -19,6 +24,10 @@
 #include "AnimGraphInstance.h"
 #include "AnimGraphManager.h"
 #include "AnimGraphSyncTrack.h"
+#include "AnimGraphPose.h"
+#include "AnimGraphPosePool.h"
+#include "EMotionFXManager.h"
+#include "ThreadData.h"
 #include <EMotionFX/Source/AnimGraphBus.h>
 
 
@@ -31,6 +40,7 @@ namespace EMotionFX
         , m_finalNodeId(AnimGraphNodeId::InvalidId)
         , m_finalNode(nullptr)
         , m_virtualFinalNode(nullptr)
+        , m_parallelOutputNumWords(0)
     {
         // setup output ports
         InitOutputPorts(1);
@@ -46,6 +56,8 @@ namespace EMotionFX
 
     void BlendTree::Reinit()
     {
+        InitParallelOutput();
+
         m_finalNode = nullptr;
 
         if (m_finalNodeId == AnimGraphNodeId::InvalidId)
@@ -98,6 +110,312 @@ namespace EMotionFX
     }
 
 
+    bool BlendTree::GetSupportsParallelOutputRecursive(const AnimGraphNode* node)
+    {
+        if (!node->GetSupportsParallelOutput())
+        {
+            return false;
+        }
+
+        const size_t numChildNodes = node->GetNumChildNodes();
+        for (size_t i = 0; i < numChildNodes; ++i)
+        {
+            if (!GetSupportsParallelOutputRecursive(node->GetChildNode(i)))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+
+    void BlendTree::InitParallelOutput()
+    {
+        const size_t numNodes = m_childNodes.size();
+        m_parallelOutputNumWords = (numNodes + 63) / 64;
+        m_parallelOutputSubtrees.assign(numNodes * m_parallelOutputNumWords, 0);
+        m_parallelOutputFlags.assign(numNodes, 0);
+
+        m_parallelOutputNodeIndices.clear();
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            m_parallelOutputNodeIndices.emplace(m_childNodes[i], i);
+        }
+
+        // Collect the nodes each node depends on by walking the incoming connections, and the nodes that consume the outputs of each node.
+        AZStd::vector<AZ::u64> consumers(numNodes * m_parallelOutputNumWords, 0);
+        AZStd::vector<size_t> nodeStack;
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            AZ::u64* subtree = &m_parallelOutputSubtrees[i * m_parallelOutputNumWords];
+            subtree[i / 64] |= AZ::u64(1) << (i % 64);
+            nodeStack.emplace_back(i);
+            while (!nodeStack.empty())
+            {
+                const AnimGraphNode* node = m_childNodes[nodeStack.back()];
+                nodeStack.pop_back();
+
+                for (const BlendTreeConnection* connection : node->GetConnections())
+                {
+                    const auto sourceIterator = m_parallelOutputNodeIndices.find(connection->GetSourceNode());
+                    if (sourceIterator == m_parallelOutputNodeIndices.end())
+                    {
+                        continue;
+                    }
+
+                    const size_t sourceIndex = sourceIterator->second;
+                    const AZ::u64 sourceBit = AZ::u64(1) << (sourceIndex % 64);
+                    if (!(subtree[sourceIndex / 64] & sourceBit))
+                    {
+                        subtree[sourceIndex / 64] |= sourceBit;
+                        nodeStack.emplace_back(sourceIndex);
+                    }
+                }
+            }
+
+            for (const BlendTreeConnection* connection : m_childNodes[i]->GetConnections())
+            {
+                const auto sourceIterator = m_parallelOutputNodeIndices.find(connection->GetSourceNode());
+                if (sourceIterator != m_parallelOutputNodeIndices.end())
+                {
+                    consumers[sourceIterator->second * m_parallelOutputNumWords + i / 64] |= AZ::u64(1) << (i % 64);
+                }
+            }
+        }
+
+        AZStd::vector<bool> supportsParallelOutput(numNodes);
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            supportsParallelOutput[i] = GetSupportsParallelOutputRecursive(m_childNodes[i]);
+        }
+
+        // A subtree can be output by a job when all of its nodes can, and when the poses inside of it are only used inside of it.
+        // Poses that leave the subtree through another node than the root would get freed into the wrong pose pool.
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            const AZ::u64* subtree = &m_parallelOutputSubtrees[i * m_parallelOutputNumWords];
+            bool isSupported = m_childNodes[i]->GetHasOutputPose();
+            bool isValuesOnly = true;
+            for (size_t j = 0; j < numNodes; ++j)
+            {
+                if (!(subtree[j / 64] & (AZ::u64(1) << (j % 64))))
+                {
+                    continue;
+                }
+
+                isSupported &= supportsParallelOutput[j];
+                if (m_childNodes[j]->GetHasOutputPose())
+                {
+                    isValuesOnly = false;
+                    if (j != i)
+                    {
+                        const AZ::u64* nodeConsumers = &consumers[j * m_parallelOutputNumWords];
+                        for (size_t word = 0; word < m_parallelOutputNumWords; ++word)
+                        {
+                            isSupported &= (nodeConsumers[word] & ~subtree[word]) == 0;
+                        }
+                    }
+                }
+            }
+
+            m_parallelOutputFlags[i] = static_cast<AZ::u8>((isSupported ? PARALLELOUTPUT_SUPPORTED : 0) | (isValuesOnly ? PARALLELOUTPUT_VALUESONLY : 0));
+        }
+    }
+
+
+    bool BlendTree::OutputNodesInParallel(AnimGraphInstance* animGraphInstance, AZStd::span<AnimGraphNode* const> nodesToOutput)
+    {
+        if (!animGraphInstance->GetParallelOutputEnabled() ||
+            GetEMotionFX().GetIsInEditorMode() ||
+            ThreadData::GetIsPosePoolOverridden() ||
+            m_parallelOutputFlags.size() != m_childNodes.size())
+        {
+            return false;
+        }
+
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (!jobContext)
+        {
+            return false;
+        }
+
+        // When called from a job, e.g. the actor instance update jobs of the MultiThreadScheduler, the subtrees get started as child jobs
+        // of the current job.
+        AZ::Job* currentJob = nullptr;
+        if (jobContext->GetJobManager().GetWorkerThreadId() != AZ::JobManager::InvalidWorkerThreadId)
+        {
+            currentJob = jobContext->GetJobManager().GetCurrentJob();
+            if (!currentJob)
+            {
+                return false;
+            }
+        }
+
+        // Gather the subtrees that still need their output.
+        AZStd::fixed_vector<size_t, s_maxParallelOutputSubtrees> subtrees;
+        for (const AnimGraphNode* node : nodesToOutput)
+        {
+            if (!node || !node->GetHasOutputPose() || animGraphInstance->GetIsOutputReady(node->GetObjectIndex()))
+            {
+                continue;
+            }
+
+            const auto nodeIterator = m_parallelOutputNodeIndices.find(node);
+            if (nodeIterator == m_parallelOutputNodeIndices.end() || !(m_parallelOutputFlags[nodeIterator->second] & PARALLELOUTPUT_SUPPORTED))
+            {
+                return false;
+            }
+
+            if (AZStd::find(subtrees.begin(), subtrees.end(), nodeIterator->second) != subtrees.end())
+            {
+                continue;
+            }
+
+            if (subtrees.size() == subtrees.capacity())
+            {
+                return false;
+            }
+            subtrees.emplace_back(nodeIterator->second);
+        }
+
+        if (subtrees.size() < 2)
+        {
+            return false;
+        }
+
+        // The subtrees may only share nodes that output values.
+        for (size_t a = 0; a < subtrees.size(); ++a)
+        {
+            const AZ::u64* subtreeA = &m_parallelOutputSubtrees[subtrees[a] * m_parallelOutputNumWords];
+            for (size_t b = a + 1; b < subtrees.size(); ++b)
+            {
+                const AZ::u64* subtreeB = &m_parallelOutputSubtrees[subtrees[b] * m_parallelOutputNumWords];
+                for (size_t word = 0; word < m_parallelOutputNumWords; ++word)
+                {
+                    AZ::u64 sharedNodes = subtreeA[word] & subtreeB[word];
+                    for (size_t bit = 0; sharedNodes; ++bit, sharedNodes >>= 1)
+                    {
+                        if ((sharedNodes & 1) && !(m_parallelOutputFlags[word * 64 + bit] & PARALLELOUTPUT_VALUESONLY))
+                        {
+                            return false;
+                        }
+                    }
+                }
+            }
+        }
+
+        AZ_PROFILE_SCOPE(Animation, "BlendTree::OutputNodesInParallel");
+
+        // Output the shared value nodes up front, so that the jobs only read them.
+        for (size_t a = 0; a < subtrees.size(); ++a)
+        {
+            const AZ::u64* subtreeA = &m_parallelOutputSubtrees[subtrees[a] * m_parallelOutputNumWords];
+            for (size_t b = a + 1; b < subtrees.size(); ++b)
+            {
+                const AZ::u64* subtreeB = &m_parallelOutputSubtrees[subtrees[b] * m_parallelOutputNumWords];
+                for (size_t word = 0; word < m_parallelOutputNumWords; ++word)
+                {
+                    AZ::u64 sharedNodes = subtreeA[word] & subtreeB[word];
+                    for (size_t bit = 0; sharedNodes; ++bit, sharedNodes >>= 1)
+                    {
+                        if (sharedNodes & 1)
+                        {
+                            m_childNodes[word * 64 + bit]->PerformOutput(animGraphInstance);
+                        }
+                    }
+                }
+            }
+        }
+
+        ActorInstance* actorInstance = animGraphInstance->GetActorInstance();
+        ThreadData* threadData = GetEMotionFX().GetThreadData(actorInstance->GetThreadIndex());
+
+        AZStd::fixed_vector<AnimGraphPosePool*, s_maxParallelOutputSubtrees> posePools;
+        for (size_t i = 0; i < subtrees.size(); ++i)
+        {
+            posePools.emplace_back(&animGraphInstance->GetParallelOutputPosePool(i));
+        }
+
+        auto outputSubtree = [this, animGraphInstance, threadData](size_t nodeIndex, AnimGraphPosePool* posePool)
+        {
+            AZ_PROFILE_SCOPE(Animation, "BlendTree::OutputSubtree");
+            ThreadData::ScopedPosePoolOverride posePoolOverride(threadData, posePool);
+            m_childNodes[nodeIndex]->PerformOutput(animGraphInstance);
+        };
+
+        // Output the first subtree on the calling thread while the jobs process the others.
+        if (currentJob)
+        {
+            for (size_t i = 1; i < subtrees.size(); ++i)
+            {
+                const size_t nodeIndex = subtrees[i];
+                AnimGraphPosePool* posePool = posePools[i];
+                AZ::Job* job = AZ::CreateJobFunction([&outputSubtree, nodeIndex, posePool]()
+                {
+                    outputSubtree(nodeIndex, posePool);
+                }, /*isAutoDelete=*/true, jobContext);
+                currentJob->StartAsChild(job);
+            }
+
+            outputSubtree(subtrees[0], posePools[0]);
+
+            // The thread runs other jobs while waiting for the children. This can be the update of another actor instance, which gets the
+            // same thread index and with that the same pose pool. Route its poses to a separate pool, so it doesn't hand out or free the
+            // poses of this anim graph instance. Nested blend trees see the override and output sequentially.
+            ThreadData::ScopedPosePoolOverride waitPosePoolOverride(threadData, &animGraphInstance->GetParallelOutputPosePool(subtrees.size()));
+            currentJob->WaitForChildren();
+        }
+        else
+        {
+            AZ::JobCompletion jobCompletion;
+            for (size_t i = 1; i < subtrees.size(); ++i)
+            {
+                const size_t nodeIndex = subtrees[i];
+                AnimGraphPosePool* posePool = posePools[i];
+                AZ::Job* job = AZ::CreateJobFunction([&outputSubtree, nodeIndex, posePool]()
+                {
+                    outputSubtree(nodeIndex, posePool);
+                }, /*isAutoDelete=*/true, jobContext);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+
+            outputSubtree(subtrees[0], posePools[0]);
+            jobCompletion.StartAndWaitForCompletion();
+        }
+
+        // The output poses of the subtree roots came from the subtree pose pools. Move them over to the pose pool of the thread,
+        // so that the nodes downstream release them the regular way.
+        AnimGraphPosePool& posePool = threadData->GetPosePool();
+        for (size_t i = 0; i < subtrees.size(); ++i)
+        {
+            AnimGraphNode* node = m_childNodes[subtrees[i]];
+            const size_t numOutputs = node->GetOutputPorts().size();
+            for (size_t j = 0; j < numOutputs; ++j)
+            {
+                if (node->GetOutputPorts()[j].m_compatibleTypes[0] != AttributePose::TYPE_ID)
+                {
+                    continue;
+                }
+
+                AttributePose* poseAttribute = static_cast<AttributePose*>(node->GetOutputAttribute(animGraphInstance, j));
+                AnimGraphPose* subtreePose = poseAttribute->GetValue();
+                if (subtreePose)
+                {
+                    AnimGraphPose* pose = posePool.RequestPose(actorInstance);
+                    *pose = *subtreePose;
+                    poseAttribute->SetValue(pose);
+                    posePools[i]->FreePose(subtreePose);
+                }
+            }
+        }
+
+        animGraphInstance->IncreaseNumParallelOutputs();
+        return true;
+    }
+
+
     // get the real final node
     AnimGraphNode* BlendTree::GetRealFinalNode() const
     {
@@ -11,6 +11,9 @@
 // include the required headers
 #include "EMotionFXConfig.h"
 #include "BlendTreeFinalNode.h"
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 
 
 namespace EMotionFX
@@ -95,13 +98,44 @@ namespace EMotionFX
         */
         bool ConnectionWillProduceCycle(AnimGraphNode* sourceNode, AnimGraphNode* targetNode) const;
 
+        /**
+        * Output the subtrees of the given child nodes in parallel, each as a job with its own pose pool.
+        * This only happens when the subtrees solely share nodes that output values, as the pose ref counts and pose pools are not thread safe.
+        * Shared value nodes get output up front on the calling thread. When called from a job, the subtrees run as child jobs of it.
+        * Parallel output is skipped in the editor and inside subtrees that are output in parallel already.
+        * @param[in] animGraphInstance The anim graph instance to output the nodes for.
+        * @param[in] nodesToOutput The child nodes of this blend tree to output. Entries can be nullptr.
+        * @result True in case the nodes got output in parallel, false in case the caller has to output them one after another.
+        */
+        bool OutputNodesInParallel(AnimGraphInstance* animGraphInstance, AZStd::span<AnimGraphNode* const> nodesToOutput);
+
         static void Reflect(AZ::ReflectContext* context);
 
     private:
+        enum : AZ::u8
+        {
+            PARALLELOUTPUT_SUPPORTED    = 1 << 0,   /**< The subtree of the node can be output by a job. */
+            PARALLELOUTPUT_VALUESONLY   = 1 << 1    /**< The node and all nodes in its subtree only output values, no poses. */
+        };
+
+        static constexpr size_t s_maxParallelOutputSubtrees = 8;
+
         AZ::u64                 m_finalNodeId;      /**< Id of the final node that gets serialized. The final node represents the output of the blend tree. */
         BlendTreeFinalNode*     m_finalNode;        /**< The cached final node pointer based on the final node id. */
         AnimGraphNode*          m_virtualFinalNode;  /**< The virtual final node, which is the node who's output is used as final output. A value of nullptr means it will use the real m_finalNode. */
 
+        AZStd::unordered_map<const AnimGraphNode*, size_t> m_parallelOutputNodeIndices; /**< The child node index for each child node. */
+        AZStd::vector<AZ::u64>  m_parallelOutputSubtrees;       /**< Bit set of the child nodes in the subtree of each child node, the node itself included. */
+        AZStd::vector<AZ::u8>   m_parallelOutputFlags;          /**< The PARALLELOUTPUT_* flags for each child node. */
+        size_t                  m_parallelOutputNumWords;       /**< The number of 64 bit words in the bit set of a single subtree. */
+
+        /**
+        * Analyze the data dependencies between the child nodes, to find the subtrees that can be output in parallel.
+        * This has to be done again whenever the nodes or connections inside the blend tree change.
+        */
+        void InitParallelOutput();
+        static bool GetSupportsParallelOutputRecursive(const AnimGraphNode* node);
+
         /**
         * Helper function that recursively (through incoming connections) detect cycles. The function performs a DFS to find back edges (connections to itself or to one of its ancestors).
         * @param[in] nextNode the current node being analyzed
@@ -160,8 +160,8 @@ namespace EMotionFX
 
         if (weight < 1.0f - MCore::Math::epsilon)
         {
-            OutputIncomingNode(animGraphInstance, nodeA);
-            OutputIncomingNode(animGraphInstance, nodeB);
+            AnimGraphNode* const nodesToOutput[] = { nodeA, nodeB };
+            OutputIncomingNodes(animGraphInstance, nodesToOutput);
 
             RequestPoses(animGraphInstance);
             outputPose = GetOutputPose(animGraphInstance, OUTPUTPORT_POSE)->GetValue();
@@ -195,6 +195,12 @@ namespace EMotionFX
             return;
         }
 
+        if (nodeB && blendWeight >= MCore::Math::epsilon)
+        {
+            AnimGraphNode* const nodesToOutput[] = { nodeA, nodeB };
+            OutputIncomingNodes(animGraphInstance, nodesToOutput);
+        }
+
         OutputIncomingNode(animGraphInstance, nodeA);
         if (!nodeB || blendWeight < MCore::Math::epsilon)
         {
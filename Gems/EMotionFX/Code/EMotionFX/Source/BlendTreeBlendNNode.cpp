@@ -371,6 +371,13 @@ namespace EMotionFX
             return;
         }
 
+        // both poses are needed when blending, output them together so that independent subtrees can be processed in parallel
+        if (nodeB && nodeA != nodeB && blendWeight >= MCore::Math::epsilon)
+        {
+            AnimGraphNode* const nodesToOutput[] = { nodeA, nodeB };
+            OutputIncomingNodes(animGraphInstance, nodesToOutput);
+        }
+
         // if both nodes are equal we can just output the given pose
         OutputIncomingNode(animGraphInstance, nodeA);
         const AnimGraphPose* poseA = GetInputPose(animGraphInstance, INPUTPORT_POSE_0 + poseIndexA)->GetValue();
@@ -8,6 +8,7 @@
 
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <EMotionFX/Source/Actor.h>
 #include <EMotionFX/Source/ActorInstance.h>
 #include <EMotionFX/Source/AnimGraph.h>
@@ -156,6 +157,21 @@ namespace EMotionFX
     {
         UniqueData* uniqueData = static_cast<UniqueData*>(FindOrCreateUniqueNodeData(animGraphInstance));
 
+        // Output the base pose and the masked poses together, so that independent subtrees (e.g. upper and lower body) can be processed in parallel.
+        if (animGraphInstance->GetParallelOutputEnabled())
+        {
+            AZStd::fixed_vector<AnimGraphNode*, 8> inputNodes;
+            inputNodes.emplace_back(GetInputNode(INPUTPORT_BASEPOSE));
+            for (const UniqueData::MaskInstance& maskInstance : uniqueData->m_maskInstances)
+            {
+                if (inputNodes.size() < inputNodes.capacity())
+                {
+                    inputNodes.emplace_back(GetInputNode(maskInstance.m_inputPortNr));
+                }
+            }
+            OutputIncomingNodes(animGraphInstance, inputNodes);
+        }
+
         RequestPoses(animGraphInstance);
         AnimGraphPose* outputAnimGraphPose = GetOutputPose(animGraphInstance, OUTPUTPORT_RESULT)->GetValue();
         Pose& outputPose = outputAnimGraphPose->GetPose();
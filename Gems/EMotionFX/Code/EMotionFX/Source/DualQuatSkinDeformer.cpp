@@ -8,6 +8,7 @@
 
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Math/SimdMath.h>
 #include "EMotionFXConfig.h"
 #include "DualQuatSkinDeformer.h"
 #include "Mesh.h"
@@ -56,6 +57,7 @@ namespace EMotionFX
 
         // copy the bone info (for precalc/optimization reasons)
         result->m_bones = m_bones;
+        result->m_influences = m_influences;
 
         // return the result
         return result;
@@ -82,6 +84,11 @@ namespace EMotionFX
             m_taskGraph.Submit(&finishedEvent);
             finishedEvent.Wait();
         }
+        else if (m_mesh->GetNumVertices() <= s_numVerticesPerBatch)
+        {
+            // A single batch, skin it right away instead of going through the job system.
+            SkinRange(m_mesh, 0, m_mesh->GetNumVertices(), m_bones, m_influences);
+        }
         else
         {
             AZ::JobCompletion jobCompletion;
@@ -98,7 +105,7 @@ namespace EMotionFX
                 AZ::JobContext* jobContext = nullptr;
                 AZ::Job* job = AZ::CreateJobFunction([this, startVertex, endVertex]()
                     {
-                        SkinRange(m_mesh, startVertex, endVertex, m_bones);
+                        SkinRange(m_mesh, startVertex, endVertex, m_bones, m_influences);
                     }, /*isAutoDelete=*/true, jobContext);
 
                 job->SetDependent(&jobCompletion);
@@ -109,183 +116,63 @@ namespace EMotionFX
         }
     }
 
-    void DualQuatSkinDeformer::SkinRange(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos)
+    void DualQuatSkinDeformer::SkinRange(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos, const SkinInfluenceStream& influences)
     {
-        SkinningInfoVertexAttributeLayer* layer = (SkinningInfoVertexAttributeLayer*)mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID);
-        AZ_Assert(layer, "Cannot find skinning layer.");
-
-        AZ::Vector3 newTangent;
-        AZ::Vector3 vtxPos, normal, tangent, bitangent;
-        AZ::u32 orgVertex;
-        float weight;
+        using AZ::Simd::Vec4;
 
         AZ::Vector3* positions = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
         AZ::Vector3* normals = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
         AZ::Vector4* tangents = static_cast<AZ::Vector4*>(mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
         AZ::Vector3* bitangents = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
-        AZ::u32* orgVerts = static_cast<AZ::u32*>(mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
 
-        // if there are tangents and bitangents to skin
-        if (tangents && bitangents)
+        const size_t numInfluences = influences.GetNumInfluencesPerVertex();
+        if (numInfluences == 0)
         {
-            for (AZ::u32 v = startVertex; v < endVertex; ++v)
-            {
-                orgVertex = orgVerts[v];
-                vtxPos = positions[v];
-                normal = normals[v];
-                const float tangentW = tangents[v].GetW();
-                tangent.Set(tangents[v].GetX(), tangents[v].GetY(), tangents[v].GetZ());
-                bitangent = bitangents[v];
-
-                // process the skin influences for this vertex
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                if (numInfluences > 0)
-                {
-                    // get the pivot quat, used for the dot product check
-                    const MCore::DualQuaternion& pivotQuat = boneInfos[ layer->GetInfluence(orgVertex, 0)->GetBoneNr() ].m_dualQuat;
-
-                    // our skinning dual quaternion
-                    MCore::DualQuaternion skinQuat(AZ::Quaternion(0, 0, 0, 0), AZ::Quaternion(0, 0, 0, 0));
-
-                    for (size_t i = 0; i < numInfluences; ++i)
-                    {
-                        SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                        weight = influence->GetWeight();
-
-                        // check if we need to invert the dual quat
-                        MCore::DualQuaternion influenceQuat = boneInfos[ influence->GetBoneNr() ].m_dualQuat;
-                        if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
-                        {
-                            influenceQuat *= -1.0f;
-                        }
-
-                        // weighted sum
-                        skinQuat += influenceQuat * weight;
-                    }
-
-                    // normalize the dual quaternion
-                    skinQuat.Normalize();
-
-                    // perform skinning
-                    positions[v] = skinQuat.TransformPoint(vtxPos);
-                    normals[v] = skinQuat.TransformVector(normal);
-                    newTangent = skinQuat.TransformVector(tangent);
-                    tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangentW);
-                    bitangents[v] = skinQuat.TransformVector(bitangent);
-                }
-                else
-                {
-                    // no skinning influences, just copy the values
-                    positions[v] = vtxPos;
-                    normals[v] = normal;
-                    newTangent = tangent;
-                    tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangentW);
-                    bitangents[v] = bitangent;
-                }
-            }
+            return;
         }
-        else if (tangents && !bitangents) // tangents but no bitangents
+
+        for (AZ::u32 v = startVertex; v < endVertex; ++v)
         {
-            for (AZ::u32 v = startVertex; v < endVertex; ++v)
+            const AZ::u16* boneNumbers = influences.GetBoneNumbers(v);
+            const float* weights = influences.GetWeights(v);
+
+            // no skinning influences, keep the values
+            if (weights[0] <= 0.0f)
             {
-                orgVertex = orgVerts[v];
-                vtxPos = positions[v];
-                normal = normals[v];
-                const float tangentW = tangents[v].GetW();
-                tangent.Set(tangents[v].GetX(), tangents[v].GetY(), tangents[v].GetZ());
-
-                // process the skin influences for this vertex
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                if (numInfluences > 0)
-                {
-                    // get the pivot quat, used for the dot product check
-                    const MCore::DualQuaternion& pivotQuat = boneInfos[ layer->GetInfluence(orgVertex, 0)->GetBoneNr() ].m_dualQuat;
+                continue;
+            }
 
-                    // our skinning dual quaternion
-                    MCore::DualQuaternion skinQuat(AZ::Quaternion(0, 0, 0, 0), AZ::Quaternion(0, 0, 0, 0));
+            // get the pivot quat, used for the dot product check
+            const MCore::DualQuaternion& pivotQuat = boneInfos[boneNumbers[0]].m_dualQuat;
 
-                    for (size_t i = 0; i < numInfluences; ++i)
-                    {
-                        SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                        weight = influence->GetWeight();
-
-                        // check if we need to invert the dual quat
-                        MCore::DualQuaternion influenceQuat = boneInfos[ influence->GetBoneNr() ].m_dualQuat;
-                        if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
-                        {
-                            influenceQuat *= -1.0f;
-                        }
-
-                        // weighted sum
-                        skinQuat += influenceQuat * weight;
-                    }
-
-                    // normalize the dual quaternion
-                    skinQuat.Normalize();
-
-                    // perform skinning
-                    positions[v] = skinQuat.TransformPoint(vtxPos);
-                    normals[v] = skinQuat.TransformVector(normal);
-                    newTangent = skinQuat.TransformVector(tangent);
-                    tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangentW);
-                }
-                else
-                {
-                    // no skinning influences, just copy the values
-                    positions[v] = vtxPos;
-                    normals[v] = normal;
-                    newTangent = tangent;
-                    tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangentW);
-                }
-            }
-        }
-        else // there are no tangents and bitangents to skin
-        {
-            for (AZ::u32 v = startVertex; v < endVertex; ++v)
+            // weighted sum of the dual quaternions, the padded influences have a weight of zero
+            Vec4::FloatType real = Vec4::ZeroFloat();
+            Vec4::FloatType dual = Vec4::ZeroFloat();
+            for (size_t i = 0; i < numInfluences; ++i)
             {
-                orgVertex = orgVerts[v];
-                vtxPos = positions[v];
-                normal = normals[v];
+                const MCore::DualQuaternion& influenceQuat = boneInfos[boneNumbers[i]].m_dualQuat;
 
-                // process the skin influences for this vertex
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                if (numInfluences > 0)
-                {
-                    // get the pivot quat, used for the dot product check
-                    const MCore::DualQuaternion& pivotQuat = boneInfos[ layer->GetInfluence(orgVertex, 0)->GetBoneNr() ].m_dualQuat;
+                // check if we need to invert the dual quat
+                const float weight = (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f) ? -weights[i] : weights[i];
+                const Vec4::FloatType splatWeight = Vec4::Splat(weight);
+                real = Vec4::Madd(influenceQuat.m_real.GetSimdValue(), splatWeight, real);
+                dual = Vec4::Madd(influenceQuat.m_dual.GetSimdValue(), splatWeight, dual);
+            }
 
-                    // our skinning dual quaternion
-                    MCore::DualQuaternion skinQuat(AZ::Quaternion(0, 0, 0, 0), AZ::Quaternion(0, 0, 0, 0));
+            // normalize the dual quaternion
+            MCore::DualQuaternion skinQuat(AZ::Quaternion(real), AZ::Quaternion(dual));
+            skinQuat.Normalize();
 
-                    for (size_t i = 0; i < numInfluences; ++i)
-                    {
-                        SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                        weight = influence->GetWeight();
-
-                        // check if we need to invert the dual quat
-                        MCore::DualQuaternion influenceQuat = boneInfos[ influence->GetBoneNr() ].m_dualQuat;
-                        if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
-                        {
-                            influenceQuat *= -1.0f;
-                        }
-
-                        // weighted sum
-                        skinQuat += influenceQuat * weight;
-                    }
-
-                    // normalize the dual quaternion
-                    skinQuat.Normalize();
-
-                    // perform skinning
-                    positions[v] = skinQuat.TransformPoint(vtxPos);
-                    normals[v] = skinQuat.TransformVector(normal);
-                }
-                else
-                {
-                    // no skinning influences, just copy the values
-                    positions[v] = vtxPos;
-                    normals[v] = normal;
-                }
+            // perform skinning
+            positions[v] = skinQuat.TransformPoint(positions[v]);
+            normals[v] = skinQuat.TransformVector(normals[v]);
+            if (tangents)
+            {
+                tangents[v].Set(skinQuat.TransformVector(tangents[v].GetAsVector3()), tangents[v].GetW());
+            }
+            if (bitangents)
+            {
+                bitangents[v] = skinQuat.TransformVector(bitangents[v]);
             }
         }
     }
@@ -299,6 +186,7 @@ namespace EMotionFX
 
         // clear the bone information array, but don't free the currently allocated/reserved memory
         m_bones.clear();
+        m_influences.Clear();
 
         // if there is no mesh
         if (m_mesh == nullptr)
@@ -344,6 +232,8 @@ namespace EMotionFX
             }
         }
 
+        m_influences.Init(m_mesh);
+
         if (m_useTaskGraph)
         {
             // Prepare the task graph
@@ -362,7 +252,7 @@ namespace EMotionFX
                     taskDescriptor,
                     [this, startVertex, endVertex]()
                     {
-                        SkinRange(m_mesh, startVertex, endVertex, m_bones);
+                        SkinRange(m_mesh, startVertex, endVertex, m_bones, m_influences);
                     });
             }
         }
@@ -15,6 +15,7 @@
 #include <MCore/Source/DualQuaternion.h>
 #include "Mesh.h"
 #include "MeshDeformer.h"
+#include "SkinInfluenceStream.h"
 
 namespace EMotionFX
 {
@@ -127,6 +128,7 @@ namespace EMotionFX
                 : m_nodeNr(InvalidIndex) {}
         };
         AZStd::vector<BoneInfo> m_bones; /**< The array of bone information used for pre-calculation. */
+        SkinInfluenceStream m_influences; /**< The influences of all vertices, sorted and padded to the same number per vertex. */
 
         /**
          * Skin a part of the mesh.
@@ -135,7 +137,7 @@ namespace EMotionFX
          * @param endVertex The end vertex index for the range to be skinned.
          * @param boneInfos The pre-calculated skinning matrices shared across the skinning process.
          */
-        static void SkinRange(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos);
+        static void SkinRange(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos, const SkinInfluenceStream& influences);
 
         //! Number of vertices per batch/job used for multi-threaded software skinning.
         static constexpr AZ::u32 s_numVerticesPerBatch = 10000;
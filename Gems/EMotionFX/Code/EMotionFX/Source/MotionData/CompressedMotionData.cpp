@@ -0,0 +1,1784 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/sort.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/Algorithms.h>
+#include <EMotionFX/Source/MorphSetup.h>
+#include <EMotionFX/Source/MorphSetupInstance.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/TransformData.h>
+
+#include <EMotionFX/Source/Importer/SharedFileFormatStructs.h>
+#include <EMotionFX/Exporters/ExporterLib/Exporter/Exporter.h>
+#include <MCore/Source/LogManager.h>
+#include <MCore/Source/StringIdPool.h>
+
+namespace EMotionFX
+{
+    namespace
+    {
+        // The three smallest components of a unit quaternion are within [-1/sqrt(2), 1/sqrt(2)].
+        constexpr float s_rotationRange = 0.70710678f;
+        // The rotation components use 15 bits, the top bits of the first two values store the index of the largest component.
+        constexpr float s_maxRotationValue = 32767.0f;
+        constexpr AZ::u16 s_rotationValueMask = 0x7FFF;
+        constexpr float s_maxColumnValue = 65535.0f;
+        // Limit the distance between two keys, so that testing whether the keys in between can be removed stays cheap.
+        constexpr size_t s_maxKeySpacing = 64;
+
+        void EncodeSmallestThree(const AZ::Quaternion& rotation, AZ::u16* outValues)
+        {
+            float components[4];
+            rotation.GetNormalized().StoreToFloat4(components);
+
+            int largestIndex = 0;
+            for (int i = 1; i < 4; ++i)
+            {
+                if (AZStd::abs(components[i]) > AZStd::abs(components[largestIndex]))
+                {
+                    largestIndex = i;
+                }
+            }
+
+            // q and -q are the same rotation, flip the sign so that the largest component is positive and can be reconstructed.
+            const float sign = (components[largestIndex] < 0.0f) ? -1.0f : 1.0f;
+            size_t valueIndex = 0;
+            for (int i = 0; i < 4; ++i)
+            {
+                if (i != largestIndex)
+                {
+                    const float normalizedValue = (components[i] * sign + s_rotationRange) / (2.0f * s_rotationRange);
+                    outValues[valueIndex++] = static_cast<AZ::u16>(AZ::GetClamp(normalizedValue * s_maxRotationValue + 0.5f, 0.0f, s_maxRotationValue));
+                }
+            }
+
+            outValues[0] |= static_cast<AZ::u16>((largestIndex >> 1) << 15);
+            outValues[1] |= static_cast<AZ::u16>((largestIndex & 1) << 15);
+        }
+
+        AZ::Quaternion DecodeSmallestThree(const AZ::u16* values)
+        {
+            using Vec4 = AZ::Simd::Vec4;
+
+            const Vec4::Int32Type quantized = Vec4::LoadImmediate(
+                static_cast<int32_t>(values[0] & s_rotationValueMask),
+                static_cast<int32_t>(values[1] & s_rotationValueMask),
+                static_cast<int32_t>(values[2] & s_rotationValueMask),
+                0);
+            const Vec4::FloatType smallestThree = Vec4::Madd(
+                Vec4::ConvertToFloat(quantized),
+                Vec4::Splat(2.0f * s_rotationRange / s_maxRotationValue),
+                Vec4::Splat(-s_rotationRange));
+
+            float components[4];
+            Vec4::StoreUnaligned(components, smallestThree);
+            const float largest = sqrtf(AZ::GetMax(0.0f, 1.0f - components[0] * components[0] - components[1] * components[1] - components[2] * components[2]));
+            const int largestIndex = ((values[0] >> 15) << 1) | (values[1] >> 15);
+
+            float result[4];
+            int valueIndex = 0;
+            for (int i = 0; i < 4; ++i)
+            {
+                result[i] = (i == largestIndex) ? largest : components[valueIndex++];
+            }
+
+            return AZ::Quaternion::CreateFromFloat4(result);
+        }
+
+        MotionData::OptimizeSettings CreateLosslessOptimizeSettings()
+        {
+            MotionData::OptimizeSettings settings;
+            settings.m_maxPosError = 0.0f;
+            settings.m_maxRotError = 0.0f;
+            settings.m_maxScaleError = 0.0f;
+            settings.m_maxMorphError = 0.0f;
+            settings.m_maxFloatError = 0.0f;
+            return settings;
+        }
+
+        bool IsInList(const AZStd::vector<size_t>& list, size_t index)
+        {
+            return AZStd::find(list.begin(), list.end(), index) != list.end();
+        }
+    } // namespace
+
+    CompressedMotionData::~CompressedMotionData()
+    {
+        ClearAllData();
+    }
+
+    MotionData* CompressedMotionData::CreateNew() const
+    {
+        return aznew CompressedMotionData();
+    }
+
+    const char* CompressedMotionData::GetSceneSettingsName() const
+    {
+        return "Compressed Keyframes (fast, smallest)";
+    }
+
+    void CompressedMotionData::InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate, float newSampleRate, bool updateDuration)
+    {
+        AZ_Assert(newSampleRate > 0.0f, "Expected the sample rate to be larger than zero.");
+        float sampleRate = keepSameSampleRate ? motionData->GetSampleRate() : newSampleRate;
+
+        // Calculate the sample spacing and number of samples required.
+        float sampleSpacing = 0.0f;
+        size_t numSamples = 0;
+        MotionData::CalculateSampleInformation(motionData->GetDuration(), sampleRate, numSamples, sampleSpacing);
+
+        ClearAllData();
+        CopyBaseMotionData(motionData);
+        SetSampleRate(sampleRate);
+
+        // Resample all animated tracks uniformly, the keys that aren't needed get removed by Optimize.
+        // Keep the resampled tracks as source data, so that Optimize doesn't have to work from the quantized values.
+        BuildData& buildData = m_sourceData;
+        buildData.m_keyTimes.resize(numSamples);
+        for (size_t s = 0; s < numSamples; ++s)
+        {
+            buildData.m_keyTimes[s] = s * sampleSpacing;
+        }
+
+        const size_t numJoints = motionData->GetNumJoints();
+        buildData.m_joints.resize(numJoints);
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            if (!motionData->IsJointAnimated(i))
+            {
+                continue;
+            }
+
+            BuildData::JointSamples& jointSamples = buildData.m_joints[i];
+            const bool posAnimated = motionData->IsJointPositionAnimated(i);
+            const bool rotAnimated = motionData->IsJointRotationAnimated(i);
+#ifndef EMFX_SCALE_DISABLED
+            const bool scaleAnimated = motionData->IsJointScaleAnimated(i);
+#else
+            const bool scaleAnimated = false;
+#endif
+
+            for (size_t s = 0; s < numSamples; ++s)
+            {
+                const Transform transform = motionData->SampleJointTransform(buildData.m_keyTimes[s], i);
+                if (posAnimated)
+                {
+                    jointSamples.m_positions.emplace_back(transform.m_position);
+                }
+                if (rotAnimated)
+                {
+                    jointSamples.m_rotations.emplace_back(transform.m_rotation.GetNormalized());
+                }
+#ifndef EMFX_SCALE_DISABLED
+                if (scaleAnimated)
+                {
+                    jointSamples.m_scales.emplace_back(transform.m_scale);
+                }
+#endif
+            }
+        }
+
+        const size_t numMorphs = motionData->GetNumMorphs();
+        buildData.m_morphs.resize(numMorphs);
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            if (motionData->IsMorphAnimated(i))
+            {
+                buildData.m_morphs[i].resize(numSamples);
+                for (size_t s = 0; s < numSamples; ++s)
+                {
+                    buildData.m_morphs[i][s] = motionData->SampleMorph(buildData.m_keyTimes[s], i);
+                }
+            }
+        }
+
+        const size_t numFloats = motionData->GetNumFloats();
+        buildData.m_floats.resize(numFloats);
+        for (size_t i = 0; i < numFloats; ++i)
+        {
+            if (motionData->IsFloatAnimated(i))
+            {
+                buildData.m_floats[i].resize(numSamples);
+                for (size_t s = 0; s < numSamples; ++s)
+                {
+                    buildData.m_floats[i][s] = motionData->SampleFloat(buildData.m_keyTimes[s], i);
+                }
+            }
+        }
+
+        Compress(m_sourceData, CreateLosslessOptimizeSettings());
+
+        if (updateDuration)
+        {
+            UpdateDuration();
+        }
+    }
+
+    void CompressedMotionData::Optimize(const OptimizeSettings& settings)
+    {
+        // Work from the source samples when we have them, so that the first optimization doesn't add to the quantization error.
+        if (HasSourceData())
+        {
+            Compress(m_sourceData, settings);
+
+            // The source samples are as large as uncompressed motion data, don't keep them around once the keys are picked.
+            m_sourceData = {};
+        }
+        else
+        {
+            BuildData buildData;
+            Decompress(buildData);
+            Compress(buildData, settings);
+        }
+
+        if (settings.m_updateDuration)
+        {
+            UpdateDuration();
+        }
+    }
+
+    struct CompressedMotionData::KeyGroupTracks
+    {
+        struct Vector3Track
+        {
+            const AZStd::vector<AZ::Vector3>* m_samples;
+            float m_maxError;
+            size_t* m_column;
+        };
+        struct RotationTrack
+        {
+            const AZStd::vector<AZ::Quaternion>* m_samples;
+            float m_maxError;
+            size_t* m_offset;
+        };
+        struct FloatTrack
+        {
+            const AZStd::vector<float>* m_samples;
+            float m_maxError;
+            size_t* m_column;
+        };
+
+        // A group holds the position, rotation and scale of a joint, or a single morph or float.
+        AZStd::fixed_vector<Vector3Track, 2> m_vector3Tracks;
+        AZStd::fixed_vector<RotationTrack, 1> m_rotationTracks;
+        AZStd::fixed_vector<FloatTrack, 1> m_floatTracks;
+    };
+
+    void CompressedMotionData::Compress(const BuildData& buildData, const OptimizeSettings& settings)
+    {
+        AZ_Assert(buildData.m_joints.size() == m_staticJointData.size(), "Expected the build data to be in sync with the static joint data.");
+        AZ_Assert(buildData.m_morphs.size() == m_staticMorphData.size(), "Expected the build data to be in sync with the static morph data.");
+        AZ_Assert(buildData.m_floats.size() == m_staticFloatData.size(), "Expected the build data to be in sync with the static float data.");
+
+        ClearCompressedData();
+        m_jointData.resize(buildData.m_joints.size());
+        m_morphData.resize(buildData.m_morphs.size());
+        m_floatData.resize(buildData.m_floats.size());
+
+        // Gather the animated tracks of every joint, and turn the ones that stay within the error of their first value into static values.
+        for (size_t i = 0; i < buildData.m_joints.size(); ++i)
+        {
+            const BuildData::JointSamples& jointSamples = buildData.m_joints[i];
+            JointData& jointData = m_jointData[i];
+            KeyGroupTracks tracks;
+
+            float maxPosError = settings.m_maxPosError;
+            float maxRotError = settings.m_maxRotError;
+            float maxScaleError = settings.m_maxScaleError;
+            if (IsInList(settings.m_jointIgnoreList, i))
+            {
+                maxPosError = AZ::GetMin(maxPosError, 0.00001f);
+                maxRotError = AZ::GetMin(maxRotError, 0.00001f);
+                maxScaleError = AZ::GetMin(maxScaleError, 0.00001f);
+            }
+
+            const AZStd::vector<AZ::Vector3>& positions = jointSamples.m_positions;
+            if (!positions.empty())
+            {
+                const bool isStatic = AZStd::all_of(positions.begin(), positions.end(),
+                    [&positions, maxPosError](const AZ::Vector3& position) { return IsClose<AZ::Vector3>(position, positions[0], maxPosError); });
+                if (isStatic)
+                {
+                    SetJointStaticPosition(i, positions[0]);
+                }
+                else
+                {
+                    tracks.m_vector3Tracks.push_back({ &positions, maxPosError, &jointData.m_positionColumn });
+                }
+            }
+
+            const AZStd::vector<AZ::Quaternion>& rotations = jointSamples.m_rotations;
+            if (!rotations.empty())
+            {
+                const bool isStatic = AZStd::all_of(rotations.begin(), rotations.end(),
+                    [&rotations, maxRotError](const AZ::Quaternion& rotation) { return IsClose<AZ::Quaternion>(rotation, rotations[0], maxRotError); });
+                if (isStatic)
+                {
+                    SetJointStaticRotation(i, rotations[0]);
+                }
+                else
+                {
+                    tracks.m_rotationTracks.push_back({ &rotations, maxRotError, &jointData.m_rotationOffset });
+                }
+            }
+
+#ifndef EMFX_SCALE_DISABLED
+            const AZStd::vector<AZ::Vector3>& scales = jointSamples.m_scales;
+            if (!scales.empty())
+            {
+                const bool isStatic = AZStd::all_of(scales.begin(), scales.end(),
+                    [&scales, maxScaleError](const AZ::Vector3& scale) { return IsClose<AZ::Vector3>(scale, scales[0], maxScaleError); });
+                if (isStatic)
+                {
+                    SetJointStaticScale(i, scales[0]);
+                }
+                else
+                {
+                    tracks.m_vector3Tracks.push_back({ &scales, maxScaleError, &jointData.m_scaleColumn });
+                }
+            }
+#endif
+
+            jointData.m_keyGroup = AddKeyGroup(tracks, buildData.m_keyTimes);
+        }
+
+        auto compressFloatTracks = [this, &buildData](const AZStd::vector<AZStd::vector<float>>& floatTracks, AZStd::vector<FloatData>& floatData,
+            AZStd::vector<StaticFloatData>& staticData, const AZStd::vector<size_t>& ignoreList, float maxError)
+        {
+            for (size_t i = 0; i < floatTracks.size(); ++i)
+            {
+                const AZStd::vector<float>& values = floatTracks[i];
+                if (values.empty())
+                {
+                    continue;
+                }
+
+                const float maxTrackError = IsInList(ignoreList, i) ? 0.0f : maxError;
+                const bool isStatic = AZStd::all_of(values.begin(), values.end(),
+                    [&values, maxTrackError](float value) { return AZ::IsClose(value, values[0], maxTrackError); });
+                if (isStatic)
+                {
+                    staticData[i].m_staticValue = values[0];
+                }
+                else
+                {
+                    KeyGroupTracks tracks;
+                    tracks.m_floatTracks.push_back({ &values, maxTrackError, &floatData[i].m_column });
+                    floatData[i].m_keyGroup = AddKeyGroup(tracks, buildData.m_keyTimes);
+                }
+            }
+        };
+        compressFloatTracks(buildData.m_morphs, m_morphData, m_staticMorphData, settings.m_morphIgnoreList, settings.m_maxMorphError);
+        compressFloatTracks(buildData.m_floats, m_floatData, m_staticFloatData, settings.m_floatIgnoreList, settings.m_maxFloatError);
+    }
+
+    size_t CompressedMotionData::AddKeyGroup(const KeyGroupTracks& tracks, const AZStd::vector<float>& sampleTimes)
+    {
+        const size_t numSamples = sampleTimes.size();
+        if (numSamples == 0 || (tracks.m_vector3Tracks.empty() && tracks.m_rotationTracks.empty() && tracks.m_floatTracks.empty()))
+        {
+            return InvalidIndex;
+        }
+
+        KeyGroup& group = m_keyGroups.emplace_back();
+
+        // Assign the columns, the three components of the vectors first followed by the floats, and the encoded rotations after them.
+        group.m_numColumns = tracks.m_vector3Tracks.size() * 3 + tracks.m_floatTracks.size();
+        group.m_keyStride = group.m_numColumns + tracks.m_rotationTracks.size() * 3;
+
+        size_t nextColumn = 0;
+        for (const KeyGroupTracks::Vector3Track& track : tracks.m_vector3Tracks)
+        {
+            *track.m_column = nextColumn;
+            nextColumn += 3;
+        }
+        for (const KeyGroupTracks::FloatTrack& track : tracks.m_floatTracks)
+        {
+            *track.m_column = nextColumn++;
+        }
+        for (const KeyGroupTracks::RotationTrack& track : tracks.m_rotationTracks)
+        {
+            *track.m_offset = nextColumn;
+            nextColumn += 3;
+        }
+
+        // Calculate the quantization range of every column over all samples, so that the quantized values are known before picking the keys.
+        const size_t numColumns = group.m_numColumns;
+        AZStd::vector<float> columnMaxs(numColumns, -AZ::Constants::FloatMax);
+        group.m_columnMins.assign(numColumns + 1, AZ::Constants::FloatMax);
+        group.m_columnScales.assign(numColumns + 1, 0.0f);
+        auto extendRange = [&group, &columnMaxs](size_t column, float value)
+        {
+            group.m_columnMins[column] = AZ::GetMin(group.m_columnMins[column], value);
+            columnMaxs[column] = AZ::GetMax(columnMaxs[column], value);
+        };
+        for (size_t s = 0; s < numSamples; ++s)
+        {
+            for (const KeyGroupTracks::Vector3Track& track : tracks.m_vector3Tracks)
+            {
+                const AZ::Vector3& value = (*track.m_samples)[s];
+                extendRange(*track.m_column + 0, value.GetX());
+                extendRange(*track.m_column + 1, value.GetY());
+                extendRange(*track.m_column + 2, value.GetZ());
+            }
+            for (const KeyGroupTracks::FloatTrack& track : tracks.m_floatTracks)
+            {
+                extendRange(*track.m_column, (*track.m_samples)[s]);
+            }
+        }
+        for (size_t i = 0; i < numColumns; ++i)
+        {
+            group.m_columnScales[i] = (columnMaxs[i] - group.m_columnMins[i]) / s_maxColumnValue;
+        }
+        group.m_columnMins[numColumns] = 0.0f; // Padding.
+
+        auto quantize = [&group](size_t column, float value)
+        {
+            const float scale = group.m_columnScales[column];
+            const float quantized = (scale > 0.0f) ? (value - group.m_columnMins[column]) / scale : 0.0f;
+            return static_cast<AZ::u16>(AZ::GetClamp(quantized + 0.5f, 0.0f, s_maxColumnValue));
+        };
+        auto dequantize = [&group, &quantize](size_t column, float value)
+        {
+            return group.m_columnMins[column] + static_cast<float>(quantize(column, value)) * group.m_columnScales[column];
+        };
+
+        // Round trip every sample through the quantization, so that removing keys accounts for the error of the stored values.
+        AZStd::fixed_vector<AZStd::vector<AZ::Vector3>, 2> decodedVector3s(tracks.m_vector3Tracks.size());
+        for (size_t i = 0; i < tracks.m_vector3Tracks.size(); ++i)
+        {
+            const size_t firstColumn = *tracks.m_vector3Tracks[i].m_column;
+            decodedVector3s[i].reserve(numSamples);
+            for (const AZ::Vector3& value : *tracks.m_vector3Tracks[i].m_samples)
+            {
+                decodedVector3s[i].emplace_back(
+                    dequantize(firstColumn + 0, value.GetX()),
+                    dequantize(firstColumn + 1, value.GetY()),
+                    dequantize(firstColumn + 2, value.GetZ()));
+            }
+        }
+        AZStd::fixed_vector<AZStd::vector<AZ::Quaternion>, 1> decodedRotations(tracks.m_rotationTracks.size());
+        for (size_t i = 0; i < tracks.m_rotationTracks.size(); ++i)
+        {
+            decodedRotations[i].reserve(numSamples);
+            for (const AZ::Quaternion& value : *tracks.m_rotationTracks[i].m_samples)
+            {
+                AZ::u16 encoded[3];
+                EncodeSmallestThree(value, encoded);
+                decodedRotations[i].emplace_back(DecodeSmallestThree(encoded));
+            }
+        }
+        AZStd::fixed_vector<AZStd::vector<float>, 1> decodedFloats(tracks.m_floatTracks.size());
+        for (size_t i = 0; i < tracks.m_floatTracks.size(); ++i)
+        {
+            decodedFloats[i].reserve(numSamples);
+            for (const float value : *tracks.m_floatTracks[i].m_samples)
+            {
+                decodedFloats[i].emplace_back(dequantize(*tracks.m_floatTracks[i].m_column, value));
+            }
+        }
+
+        // Test whether all samples in between two samples can be interpolated from their quantized values, within the error of every track.
+        auto canInterpolate = [&](size_t startSample, size_t endSample)
+        {
+            const float timeRange = sampleTimes[endSample] - sampleTimes[startSample];
+            for (size_t s = startSample + 1; s < endSample; ++s)
+            {
+                const float t = (timeRange > 0.0f) ? (sampleTimes[s] - sampleTimes[startSample]) / timeRange : 0.0f;
+                for (size_t i = 0; i < tracks.m_vector3Tracks.size(); ++i)
+                {
+                    const AZStd::vector<AZ::Vector3>& decoded = decodedVector3s[i];
+                    if (!IsClose<AZ::Vector3>(decoded[startSample].Lerp(decoded[endSample], t), (*tracks.m_vector3Tracks[i].m_samples)[s], tracks.m_vector3Tracks[i].m_maxError))
+                    {
+                        return false;
+                    }
+                }
+                for (size_t i = 0; i < tracks.m_rotationTracks.size(); ++i)
+                {
+                    // The encoding can flip the sign of the quaternion, compare against the source rotation in the same hemisphere.
+                    const AZStd::vector<AZ::Quaternion>& decoded = decodedRotations[i];
+                    const AZ::Quaternion& expected = (*tracks.m_rotationTracks[i].m_samples)[s];
+                    AZ::Quaternion rotation = decoded[startSample].NLerp(decoded[endSample], t);
+                    if (rotation.Dot(expected) < 0.0f)
+                    {
+                        rotation = -rotation;
+                    }
+                    if (!IsClose<AZ::Quaternion>(rotation, expected, tracks.m_rotationTracks[i].m_maxError))
+                    {
+                        return false;
+                    }
+                }
+                for (size_t i = 0; i < tracks.m_floatTracks.size(); ++i)
+                {
+                    const AZStd::vector<float>& decoded = decodedFloats[i];
+                    if (!AZ::IsClose(AZ::Lerp(decoded[startSample], decoded[endSample], t), (*tracks.m_floatTracks[i].m_samples)[s], tracks.m_floatTracks[i].m_maxError))
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        };
+
+        // Pick the keys of the group. Extend every segment for as long as the samples in between it can be removed.
+        AZStd::vector<size_t> keySamples;
+        keySamples.emplace_back(0);
+        size_t startSample = 0;
+        size_t endSample = 1;
+        while (endSample < numSamples)
+        {
+            const size_t nextSample = endSample + 1;
+            if (nextSample < numSamples && nextSample - startSample <= s_maxKeySpacing && canInterpolate(startSample, nextSample))
+            {
+                endSample = nextSample;
+            }
+            else
+            {
+                keySamples.emplace_back(endSample);
+                startSample = endSample;
+                endSample = startSample + 1;
+            }
+        }
+
+        // Quantize the values of all tracks of the group for every key.
+        const size_t numKeys = keySamples.size();
+        group.m_keyTimes.resize(numKeys);
+        group.m_keyValues.resize(numKeys * group.m_keyStride);
+        for (size_t k = 0; k < numKeys; ++k)
+        {
+            const size_t sample = keySamples[k];
+            group.m_keyTimes[k] = sampleTimes[sample];
+
+            AZ::u16* keyValues = group.m_keyValues.data() + k * group.m_keyStride;
+            for (const KeyGroupTracks::Vector3Track& track : tracks.m_vector3Tracks)
+            {
+                const AZ::Vector3& value = (*track.m_samples)[sample];
+                const size_t firstColumn = *track.m_column;
+                keyValues[firstColumn + 0] = quantize(firstColumn + 0, value.GetX());
+                keyValues[firstColumn + 1] = quantize(firstColumn + 1, value.GetY());
+                keyValues[firstColumn + 2] = quantize(firstColumn + 2, value.GetZ());
+            }
+            for (const KeyGroupTracks::FloatTrack& track : tracks.m_floatTracks)
+            {
+                keyValues[*track.m_column] = quantize(*track.m_column, (*track.m_samples)[sample]);
+            }
+            for (const KeyGroupTracks::RotationTrack& track : tracks.m_rotationTracks)
+            {
+                EncodeSmallestThree((*track.m_samples)[sample], keyValues + *track.m_offset);
+            }
+        }
+
+        return m_keyGroups.size() - 1;
+    }
+
+    void CompressedMotionData::Decompress(BuildData& outBuildData) const
+    {
+        // Sample every track at the keys of all groups, which contain the keys of every track.
+        AZStd::vector<float>& keyTimes = outBuildData.m_keyTimes;
+        keyTimes.clear();
+        for (const KeyGroup& group : m_keyGroups)
+        {
+            keyTimes.insert(keyTimes.end(), group.m_keyTimes.begin(), group.m_keyTimes.end());
+        }
+        AZStd::sort(keyTimes.begin(), keyTimes.end());
+        keyTimes.erase(AZStd::unique(keyTimes.begin(), keyTimes.end()), keyTimes.end());
+
+        outBuildData.m_joints.clear();
+        outBuildData.m_joints.resize(m_jointData.size());
+        for (size_t i = 0; i < m_jointData.size(); ++i)
+        {
+            const JointData& jointData = m_jointData[i];
+            BuildData::JointSamples& jointSamples = outBuildData.m_joints[i];
+            for (const float keyTime : keyTimes)
+            {
+                if (jointData.m_positionColumn != InvalidIndex)
+                {
+                    jointSamples.m_positions.emplace_back(SampleJointPosition(keyTime, i));
+                }
+                if (jointData.m_rotationOffset != InvalidIndex)
+                {
+                    jointSamples.m_rotations.emplace_back(SampleJointRotation(keyTime, i));
+                }
+#ifndef EMFX_SCALE_DISABLED
+                if (jointData.m_scaleColumn != InvalidIndex)
+                {
+                    jointSamples.m_scales.emplace_back(SampleJointScale(keyTime, i));
+                }
+#endif
+            }
+        }
+
+        auto decodeFloatTracks = [this, &keyTimes](const AZStd::vector<FloatData>& floatData, const AZStd::vector<StaticFloatData>& staticData,
+            AZStd::vector<AZStd::vector<float>>& outTracks)
+        {
+            outTracks.clear();
+            outTracks.resize(floatData.size());
+            for (size_t i = 0; i < floatData.size(); ++i)
+            {
+                if (floatData[i].m_keyGroup == InvalidIndex)
+                {
+                    continue;
+                }
+
+                outTracks[i].reserve(keyTimes.size());
+                for (const float keyTime : keyTimes)
+                {
+                    outTracks[i].emplace_back(SampleFloatData(keyTime, floatData[i], staticData[i]));
+                }
+            }
+        };
+        decodeFloatTracks(m_morphData, m_staticMorphData, outBuildData.m_morphs);
+        decodeFloatTracks(m_floatData, m_staticFloatData, outBuildData.m_floats);
+    }
+
+    bool CompressedMotionData::HasSourceData() const
+    {
+        return !m_sourceData.m_keyTimes.empty();
+    }
+
+    template <class EditFunction>
+    void CompressedMotionData::EditSourceData(const EditFunction& editFunction)
+    {
+        if (HasSourceData())
+        {
+            editFunction(m_sourceData);
+        }
+    }
+
+    template <class EditFunction>
+    void CompressedMotionData::EditSamples(const EditFunction& editFunction)
+    {
+        EditSourceData(editFunction);
+
+        BuildData buildData;
+        Decompress(buildData);
+        editFunction(buildData);
+        Compress(buildData, CreateLosslessOptimizeSettings());
+    }
+
+    void CompressedMotionData::CalculateKeyInterpolation(const KeyGroup& group, float sampleTime, const AZ::u16*& outKeyValuesA, const AZ::u16*& outKeyValuesB, float& outT)
+    {
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesNonUniform(group.m_keyTimes, sampleTime, indexA, indexB, outT);
+        outKeyValuesA = group.m_keyValues.data() + indexA * group.m_keyStride;
+        outKeyValuesB = group.m_keyValues.data() + indexB * group.m_keyStride;
+    }
+
+    AZ::Vector3 CompressedMotionData::DecodeVector3(const KeyGroup& group, const AZ::u16* keyValuesA, const AZ::u16* keyValuesB, size_t column, float t)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        // Interpolate the quantized values and dequantize the result, which is the same as interpolating the dequantized values.
+        const Vec4::FloatType valuesA = Vec4::ConvertToFloat(Vec4::LoadImmediate(
+            static_cast<int32_t>(keyValuesA[column]), static_cast<int32_t>(keyValuesA[column + 1]), static_cast<int32_t>(keyValuesA[column + 2]), 0));
+        const Vec4::FloatType valuesB = Vec4::ConvertToFloat(Vec4::LoadImmediate(
+            static_cast<int32_t>(keyValuesB[column]), static_cast<int32_t>(keyValuesB[column + 1]), static_cast<int32_t>(keyValuesB[column + 2]), 0));
+        const Vec4::FloatType quantized = Vec4::Madd(Vec4::Sub(valuesB, valuesA), Vec4::Splat(t), valuesA);
+        const Vec4::FloatType result = Vec4::Madd(quantized, Vec4::LoadUnaligned(&group.m_columnScales[column]), Vec4::LoadUnaligned(&group.m_columnMins[column]));
+        return AZ::Vector3(Vec4::ToVec3(result));
+    }
+
+    AZ::Quaternion CompressedMotionData::DecodeRotation(const AZ::u16* keyValuesA, const AZ::u16* keyValuesB, size_t offset, float t)
+    {
+        const AZ::Quaternion rotationA = DecodeSmallestThree(keyValuesA + offset);
+        if (keyValuesA == keyValuesB)
+        {
+            return rotationA;
+        }
+        return rotationA.NLerp(DecodeSmallestThree(keyValuesB + offset), t);
+    }
+
+    float CompressedMotionData::DecodeFloat(const KeyGroup& group, const AZ::u16* keyValuesA, const AZ::u16* keyValuesB, size_t column, float t)
+    {
+        const float valueA = static_cast<float>(keyValuesA[column]);
+        const float valueB = static_cast<float>(keyValuesB[column]);
+        return group.m_columnMins[column] + (valueA + (valueB - valueA) * t) * group.m_columnScales[column];
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const
+    {
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        const size_t jointDataIndex = motionLinkData->GetJointDataLinks()[jointSkeletonIndex];
+        if (m_additive && jointDataIndex == InvalidIndex)
+        {
+            return Transform::CreateIdentity();
+        }
+
+        const bool inPlace = (settings.m_inPlace && jointSkeletonIndex == actor->GetMotionExtractionNodeIndex());
+
+        // Sample the interpolated data.
+        Transform result;
+        if (jointDataIndex != InvalidIndex && !inPlace)
+        {
+            result = SampleJointTransform(settings.m_sampleTime, jointDataIndex);
+        }
+        else
+        {
+            if (settings.m_inputPose && !inPlace)
+            {
+                result = settings.m_inputPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+            else
+            {
+                result = settings.m_actorInstance->GetTransformData()->GetBindPose()->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+        }
+
+        // Apply retargeting.
+        if (settings.m_retarget)
+        {
+            BasicRetarget(settings.m_actorInstance, motionLinkData, jointSkeletonIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            const Pose* bindPose = settings.m_actorInstance->GetTransformData()->GetBindPose();
+            const Actor::NodeMirrorInfo& mirrorInfo = actor->GetNodeMirrorInfo(jointSkeletonIndex);
+            Transform mirrored = bindPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            AZ::Vector3 mirrorAxis = AZ::Vector3::CreateZero();
+            mirrorAxis.SetElement(mirrorInfo.m_axis, 1.0f);
+            const AZ::u16 motionSource = actor->GetNodeMirrorInfo(jointSkeletonIndex).m_sourceNode;
+            mirrored.ApplyDeltaMirrored(bindPose->GetLocalSpaceTransform(motionSource), result, mirrorAxis, mirrorInfo.m_flags);
+            result = mirrored;
+        }
+
+        return result;
+    }
+
+    void CompressedMotionData::SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const
+    {
+        AZ_Assert(settings.m_actorInstance, "Expecting a valid actor instance.");
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        const AZStd::vector<size_t>& jointLinks = motionLinkData->GetJointDataLinks();
+        const ActorInstance* actorInstance = settings.m_actorInstance;
+        const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
+        const size_t numNodes = actorInstance->GetNumEnabledNodes();
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            const size_t skeletonJointIndex = actorInstance->GetEnabledNode(i);
+            const bool inPlace = (settings.m_inPlace && skeletonJointIndex == actor->GetMotionExtractionNodeIndex());
+
+            // Sample the interpolated data.
+            Transform result;
+            const size_t jointDataIndex = jointLinks[skeletonJointIndex];
+            if (jointDataIndex != InvalidIndex && !inPlace)
+            {
+                result = SampleJointTransform(settings.m_sampleTime, jointDataIndex);
+            }
+            else
+            {
+                if (m_additive && jointDataIndex == InvalidIndex)
+                {
+                    result = Transform::CreateIdentity();
+                }
+                else
+                {
+                    if (settings.m_inputPose && !inPlace)
+                    {
+                        result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                    else
+                    {
+                        result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                }
+            }
+
+            // Apply retargeting.
+            if (settings.m_retarget)
+            {
+                BasicRetarget(settings.m_actorInstance, motionLinkData, skeletonJointIndex, result);
+            }
+
+            outputPose->SetLocalSpaceTransformDirect(skeletonJointIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            outputPose->Mirror(motionLinkData);
+        }
+
+        // Output morph target weights.
+        const MorphSetupInstance* morphSetup = actorInstance->GetMorphSetupInstance();
+        const size_t numMorphTargets = morphSetup->GetNumMorphTargets();
+        for (size_t i = 0; i < numMorphTargets; ++i)
+        {
+            const AZ::u32 morphTargetId = morphSetup->GetMorphTarget(i)->GetID();
+            const AZ::Outcome<size_t> morphIndex = FindMorphIndexByNameId(morphTargetId);
+            if (morphIndex.IsSuccess())
+            {
+                const size_t realIndex = morphIndex.GetValue();
+                outputPose->SetMorphWeight(i, SampleFloatData(settings.m_sampleTime, m_morphData[realIndex], m_staticMorphData[realIndex]));
+            }
+            else
+            {
+                if (settings.m_inputPose)
+                {
+                    outputPose->SetMorphWeight(i, settings.m_inputPose->GetMorphWeight(i));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, bindPose->GetMorphWeight(i));
+                }
+            }
+        }
+
+        // Since we used the SetLocalTransformDirect, make sure we manually invalidate all model space transforms.
+        outputPose->InvalidateAllModelSpaceTransforms();
+    }
+
+    float CompressedMotionData::SampleFloatData(float sampleTime, const FloatData& floatData, const StaticFloatData& staticData) const
+    {
+        if (floatData.m_keyGroup == InvalidIndex)
+        {
+            return staticData.m_staticValue;
+        }
+
+        const KeyGroup& group = m_keyGroups[floatData.m_keyGroup];
+        const AZ::u16* keyValuesA;
+        const AZ::u16* keyValuesB;
+        float t;
+        CalculateKeyInterpolation(group, sampleTime, keyValuesA, keyValuesB, t);
+        return DecodeFloat(group, keyValuesA, keyValuesB, floatData.m_column, t);
+    }
+
+    float CompressedMotionData::SampleMorph(float sampleTime, size_t morphDataIndex) const
+    {
+        return SampleFloatData(sampleTime, m_morphData[morphDataIndex], m_staticMorphData[morphDataIndex]);
+    }
+
+    float CompressedMotionData::SampleFloat(float sampleTime, size_t floatDataIndex) const
+    {
+        return SampleFloatData(sampleTime, m_floatData[floatDataIndex], m_staticFloatData[floatDataIndex]);
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(float sampleTime, size_t jointDataIndex) const
+    {
+        const JointData& jointData = m_jointData[jointDataIndex];
+        const Transform& staticTransform = m_staticJointData[jointDataIndex].m_staticTransform;
+        if (jointData.m_keyGroup == InvalidIndex)
+        {
+            return staticTransform;
+        }
+
+        // Look up the keys once, the tracks of the joint share them.
+        const KeyGroup& group = m_keyGroups[jointData.m_keyGroup];
+        const AZ::u16* keyValuesA;
+        const AZ::u16* keyValuesB;
+        float t;
+        CalculateKeyInterpolation(group, sampleTime, keyValuesA, keyValuesB, t);
+        return Transform
+        (
+            (jointData.m_positionColumn != InvalidIndex) ? DecodeVector3(group, keyValuesA, keyValuesB, jointData.m_positionColumn, t) : staticTransform.m_position,
+            (jointData.m_rotationOffset != InvalidIndex) ? DecodeRotation(keyValuesA, keyValuesB, jointData.m_rotationOffset, t) : staticTransform.m_rotation
+
+#ifndef EMFX_SCALE_DISABLED
+            ,(jointData.m_scaleColumn != InvalidIndex) ? DecodeVector3(group, keyValuesA, keyValuesB, jointData.m_scaleColumn, t) : staticTransform.m_scale
+#endif
+        );
+    }
+
+    AZ::Vector3 CompressedMotionData::SampleJointPosition(float sampleTime, size_t jointDataIndex) const
+    {
+        const JointData& jointData = m_jointData[jointDataIndex];
+        if (jointData.m_positionColumn == InvalidIndex)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_position;
+        }
+
+        const KeyGroup& group = m_keyGroups[jointData.m_keyGroup];
+        const AZ::u16* keyValuesA;
+        const AZ::u16* keyValuesB;
+        float t;
+        CalculateKeyInterpolation(group, sampleTime, keyValuesA, keyValuesB, t);
+        return DecodeVector3(group, keyValuesA, keyValuesB, jointData.m_positionColumn, t);
+    }
+
+    AZ::Quaternion CompressedMotionData::SampleJointRotation(float sampleTime, size_t jointDataIndex) const
+    {
+        const JointData& jointData = m_jointData[jointDataIndex];
+        if (jointData.m_rotationOffset == InvalidIndex)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_rotation;
+        }
+
+        const AZ::u16* keyValuesA;
+        const AZ::u16* keyValuesB;
+        float t;
+        CalculateKeyInterpolation(m_keyGroups[jointData.m_keyGroup], sampleTime, keyValuesA, keyValuesB, t);
+        return DecodeRotation(keyValuesA, keyValuesB, jointData.m_rotationOffset, t);
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    AZ::Vector3 CompressedMotionData::SampleJointScale(float sampleTime, size_t jointDataIndex) const
+    {
+        const JointData& jointData = m_jointData[jointDataIndex];
+        if (jointData.m_scaleColumn == InvalidIndex)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_scale;
+        }
+
+        const KeyGroup& group = m_keyGroups[jointData.m_keyGroup];
+        const AZ::u16* keyValuesA;
+        const AZ::u16* keyValuesB;
+        float t;
+        CalculateKeyInterpolation(group, sampleTime, keyValuesA, keyValuesB, t);
+        return DecodeVector3(group, keyValuesA, keyValuesB, jointData.m_scaleColumn, t);
+    }
+#endif
+
+    size_t CompressedMotionData::GetNumKeys() const
+    {
+        size_t numKeys = 0;
+        for (const KeyGroup& group : m_keyGroups)
+        {
+            numKeys += group.m_keyTimes.size();
+        }
+        return numKeys;
+    }
+
+    size_t CompressedMotionData::GetNumJointKeys(size_t jointDataIndex) const
+    {
+        const size_t keyGroup = m_jointData[jointDataIndex].m_keyGroup;
+        return (keyGroup != InvalidIndex) ? m_keyGroups[keyGroup].m_keyTimes.size() : 0;
+    }
+
+    float CompressedMotionData::GetJointKeyTime(size_t jointDataIndex, size_t keyIndex) const
+    {
+        return m_keyGroups[m_jointData[jointDataIndex].m_keyGroup].m_keyTimes[keyIndex];
+    }
+
+    size_t CompressedMotionData::CalcKeyDataSizeInBytes() const
+    {
+        size_t numBytes = 0;
+        for (const KeyGroup& group : m_keyGroups)
+        {
+            numBytes += group.m_keyTimes.size() * sizeof(float) +
+                group.m_columnMins.size() * sizeof(float) +
+                group.m_columnScales.size() * sizeof(float) +
+                group.m_keyValues.size() * sizeof(AZ::u16);
+        }
+        return numBytes;
+    }
+
+    void CompressedMotionData::UpdateDuration()
+    {
+        m_duration = 0.0f;
+        for (const KeyGroup& group : m_keyGroups)
+        {
+            m_duration = AZ::GetMax(m_duration, group.m_keyTimes.back());
+        }
+    }
+
+    void CompressedMotionData::ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats)
+    {
+        bool removesAnimatedData = false;
+        for (size_t i = numJoints; i < m_jointData.size(); ++i)
+        {
+            removesAnimatedData |= IsJointAnimated(i);
+        }
+        for (size_t i = numMorphs; i < m_morphData.size(); ++i)
+        {
+            removesAnimatedData |= IsMorphAnimated(i);
+        }
+        for (size_t i = numFloats; i < m_floatData.size(); ++i)
+        {
+            removesAnimatedData |= IsFloatAnimated(i);
+        }
+
+        auto editFunction = [numJoints, numMorphs, numFloats](BuildData& buildData)
+        {
+            buildData.m_joints.resize(numJoints);
+            buildData.m_morphs.resize(numMorphs);
+            buildData.m_floats.resize(numFloats);
+        };
+        if (removesAnimatedData)
+        {
+            EditSamples(editFunction);
+        }
+        else
+        {
+            EditSourceData(editFunction);
+            m_jointData.resize(numJoints);
+            m_morphData.resize(numMorphs);
+            m_floatData.resize(numFloats);
+        }
+    }
+
+    void CompressedMotionData::ClearAllData()
+    {
+        ClearCompressedData();
+        m_sourceData = {};
+    }
+
+    void CompressedMotionData::ClearCompressedData()
+    {
+        m_jointData.clear();
+        m_jointData.shrink_to_fit();
+        m_morphData.clear();
+        m_morphData.shrink_to_fit();
+        m_floatData.clear();
+        m_floatData.shrink_to_fit();
+        m_keyGroups.clear();
+        m_keyGroups.shrink_to_fit();
+    }
+
+    void CompressedMotionData::AddJointSampleData([[maybe_unused]] size_t jointDataIndex)
+    {
+        AZ_Assert(jointDataIndex == m_jointData.size(), "Expected the size of the jointData vector to be a different size. Is it in sync with the m_staticJointData vector?");
+        m_jointData.emplace_back();
+        EditSourceData([](BuildData& buildData) { buildData.m_joints.emplace_back(); });
+    }
+
+    void CompressedMotionData::AddMorphSampleData([[maybe_unused]] size_t morphDataIndex)
+    {
+        AZ_Assert(morphDataIndex == m_morphData.size(), "Expected the size of the morphData vector to be a different size. Is it in sync with the m_staticMorphData vector?");
+        m_morphData.emplace_back();
+        EditSourceData([](BuildData& buildData) { buildData.m_morphs.emplace_back(); });
+    }
+
+    void CompressedMotionData::AddFloatSampleData([[maybe_unused]] size_t floatDataIndex)
+    {
+        AZ_Assert(floatDataIndex == m_floatData.size(), "Expected the size of the floatData vector to be a different size. Is it in sync with the m_staticFloatData vector?");
+        m_floatData.emplace_back();
+        EditSourceData([](BuildData& buildData) { buildData.m_floats.emplace_back(); });
+    }
+
+    void CompressedMotionData::RemoveJointSampleData(size_t jointDataIndex)
+    {
+        auto editFunction = [jointDataIndex](BuildData& buildData) { buildData.m_joints.erase(buildData.m_joints.begin() + jointDataIndex); };
+        if (IsJointAnimated(jointDataIndex))
+        {
+            EditSamples(editFunction);
+        }
+        else
+        {
+            EditSourceData(editFunction);
+            m_jointData.erase(m_jointData.begin() + jointDataIndex);
+        }
+    }
+
+    void CompressedMotionData::RemoveMorphSampleData(size_t morphDataIndex)
+    {
+        auto editFunction = [morphDataIndex](BuildData& buildData) { buildData.m_morphs.erase(buildData.m_morphs.begin() + morphDataIndex); };
+        if (IsMorphAnimated(morphDataIndex))
+        {
+            EditSamples(editFunction);
+        }
+        else
+        {
+            EditSourceData(editFunction);
+            m_morphData.erase(m_morphData.begin() + morphDataIndex);
+        }
+    }
+
+    void CompressedMotionData::RemoveFloatSampleData(size_t floatDataIndex)
+    {
+        auto editFunction = [floatDataIndex](BuildData& buildData) { buildData.m_floats.erase(buildData.m_floats.begin() + floatDataIndex); };
+        if (IsFloatAnimated(floatDataIndex))
+        {
+            EditSamples(editFunction);
+        }
+        else
+        {
+            EditSourceData(editFunction);
+            m_floatData.erase(m_floatData.begin() + floatDataIndex);
+        }
+    }
+
+    void CompressedMotionData::ClearAllJointTransformSamples()
+    {
+        EditSamples([](BuildData& buildData)
+            {
+                for (BuildData::JointSamples& jointSamples : buildData.m_joints)
+                {
+                    jointSamples = {};
+                }
+            });
+    }
+
+    void CompressedMotionData::ClearAllMorphSamples()
+    {
+        EditSamples([](BuildData& buildData)
+            {
+                for (AZStd::vector<float>& values : buildData.m_morphs)
+                {
+                    values.clear();
+                }
+            });
+    }
+
+    void CompressedMotionData::ClearAllFloatSamples()
+    {
+        EditSamples([](BuildData& buildData)
+            {
+                for (AZStd::vector<float>& values : buildData.m_floats)
+                {
+                    values.clear();
+                }
+            });
+    }
+
+    void CompressedMotionData::ClearJointPositionSamples(size_t jointDataIndex)
+    {
+        auto editFunction = [jointDataIndex](BuildData& buildData) { buildData.m_joints[jointDataIndex].m_positions.clear(); };
+        if (IsJointPositionAnimated(jointDataIndex))
+        {
+            EditSamples(editFunction);
+        }
+        else
+        {
+            EditSourceData(editFunction);
+        }
+    }
+
+    void CompressedMotionData::ClearJointRotationSamples(size_t jointDataIndex)
+    {
+        auto editFunction = [jointDataIndex](BuildData& buildData) { buildData.m_joints[jointDataIndex].m_rotations.clear(); };
+        if (IsJointRotationAnimated(jointDataIndex))
+        {
+            EditSamples(editFunction);
+        }
+        else
+        {
+            EditSourceData(editFunction);
+        }
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    void CompressedMotionData::ClearJointScaleSamples(size_t jointDataIndex)
+    {
+        auto editFunction = [jointDataIndex](BuildData& buildData) { buildData.m_joints[jointDataIndex].m_scales.clear(); };
+        if (IsJointScaleAnimated(jointDataIndex))
+        {
+            EditSamples(editFunction);
+        }
+        else
+        {
+            EditSourceData(editFunction);
+        }
+    }
+#endif
+
+    void CompressedMotionData::ClearJointTransformSamples(size_t jointDataIndex)
+    {
+        auto editFunction = [jointDataIndex](BuildData& buildData) { buildData.m_joints[jointDataIndex] = {}; };
+        if (IsJointAnimated(jointDataIndex))
+        {
+            EditSamples(editFunction);
+        }
+        else
+        {
+            EditSourceData(editFunction);
+        }
+    }
+
+    void CompressedMotionData::ClearMorphSamples(size_t morphDataIndex)
+    {
+        auto editFunction = [morphDataIndex](BuildData& buildData) { buildData.m_morphs[morphDataIndex].clear(); };
+        if (IsMorphAnimated(morphDataIndex))
+        {
+            EditSamples(editFunction);
+        }
+        else
+        {
+            EditSourceData(editFunction);
+        }
+    }
+
+    void CompressedMotionData::ClearFloatSamples(size_t floatDataIndex)
+    {
+        auto editFunction = [floatDataIndex](BuildData& buildData) { buildData.m_floats[floatDataIndex].clear(); };
+        if (IsFloatAnimated(floatDataIndex))
+        {
+            EditSamples(editFunction);
+        }
+        else
+        {
+            EditSourceData(editFunction);
+        }
+    }
+
+    bool CompressedMotionData::IsJointPositionAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_positionColumn != InvalidIndex;
+    }
+
+    bool CompressedMotionData::IsJointRotationAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_rotationOffset != InvalidIndex;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    bool CompressedMotionData::IsJointScaleAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_scaleColumn != InvalidIndex;
+    }
+#endif
+
+    bool CompressedMotionData::IsJointAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_keyGroup != InvalidIndex;
+    }
+
+    bool CompressedMotionData::IsMorphAnimated(size_t morphDataIndex) const
+    {
+        return m_morphData[morphDataIndex].m_keyGroup != InvalidIndex;
+    }
+
+    bool CompressedMotionData::IsFloatAnimated(size_t floatDataIndex) const
+    {
+        return m_floatData[floatDataIndex].m_keyGroup != InvalidIndex;
+    }
+
+    void CompressedMotionData::ScaleData(float scaleFactor)
+    {
+        // Scaling the quantization range of the position columns scales all dequantized positions.
+        for (const JointData& jointData : m_jointData)
+        {
+            if (jointData.m_positionColumn != InvalidIndex)
+            {
+                KeyGroup& group = m_keyGroups[jointData.m_keyGroup];
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    group.m_columnMins[jointData.m_positionColumn + i] *= scaleFactor;
+                    group.m_columnScales[jointData.m_positionColumn + i] *= scaleFactor;
+                }
+            }
+        }
+
+        EditSourceData([scaleFactor](BuildData& buildData)
+            {
+                for (BuildData::JointSamples& jointSamples : buildData.m_joints)
+                {
+                    for (AZ::Vector3& position : jointSamples.m_positions)
+                    {
+                        position *= scaleFactor;
+                    }
+                }
+            });
+    }
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SERIALIZATION
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct File_CompressedMotionData_Info
+    {
+        AZ::u32 m_numJoints = 0;
+        AZ::u32 m_numMorphs = 0;
+        AZ::u32 m_numFloats = 0;
+        AZ::u32 m_numKeyGroups = 0;
+        float m_sampleRate = 30.0f;
+
+        // Followed by:
+        // File_CompressedMotionData_KeyGroup[m_numKeyGroups]
+        // File_CompressedMotionData_Joint[m_numJoints]
+        // File_CompressedMotionData_Float[m_numMorphs]
+        // File_CompressedMotionData_Float[m_numFloats]
+    };
+
+    struct File_CompressedMotionData_KeyGroup
+    {
+        AZ::u32 m_numKeys = 0;
+        AZ::u32 m_numColumns = 0;
+        AZ::u32 m_keyStride = 0;
+
+        // Followed by:
+        // float[m_numKeys]    : The key times.
+        // float[m_numColumns] : The minimum value of every quantized column.
+        // float[m_numColumns] : The quantization scale of every quantized column.
+        // AZ::u16[m_numKeys * m_keyStride] : The quantized columns followed by the encoded rotation, per key.
+    };
+
+    struct File_CompressedMotionData_Joint
+    {
+        FileFormat::File16BitQuaternion m_staticRot { 0, 0, 0, (1 << 15) - 1 };  // First frames rotation.
+        FileFormat::File16BitQuaternion m_bindPoseRot { 0, 0, 0, (1 << 15) - 1 };// Bind pose rotation.
+        FileFormat::FileVector3         m_staticPos { 0.0f, 0.0f, 0.0f };        // First frame position.
+        FileFormat::FileVector3         m_staticScale { 1.0f, 1.0f, 1.0f };      // First frame scale.
+        FileFormat::FileVector3         m_bindPosePos { 0.0f, 0.0f, 0.0f };      // Bind pose position.
+        FileFormat::FileVector3         m_bindPoseScale { 1.0f, 1.0f, 1.0f };    // Bind pose scale.
+        AZ::u32                         m_keyGroup = InvalidIndex32;             // The key group of the animated tracks, or InvalidIndex32 when not animated.
+        AZ::u32                         m_positionColumn = InvalidIndex32;       // The first quantized column of the position, or InvalidIndex32 when not animated.
+        AZ::u32                         m_rotationOffset = InvalidIndex32;       // The offset of the rotation within a key, or InvalidIndex32 when not animated.
+        AZ::u32                         m_scaleColumn = InvalidIndex32;          // The first quantized column of the scale, or InvalidIndex32 when not animated.
+
+        // Followed by:
+        // string : The name of the joint.
+    };
+
+    struct File_CompressedMotionData_Float
+    {
+        float m_staticValue = 0.0f;             // The static (first frame) value.
+        AZ::u32 m_keyGroup = InvalidIndex32;    // The key group, or InvalidIndex32 when not animated.
+        AZ::u32 m_column = InvalidIndex32;      // The quantized column, or InvalidIndex32 when not animated.
+
+        // Followed by:
+        // String: The name of the channel.
+    };
+    //---------------------------------------------------------------------------------------
+
+    namespace
+    {
+        AZ::u32 ToFileIndex(size_t index)
+        {
+            return (index != InvalidIndex) ? static_cast<AZ::u32>(index) : InvalidIndex32;
+        }
+
+        size_t FromFileIndex(AZ::u32 index)
+        {
+            return (index != InvalidIndex32) ? static_cast<size_t>(index) : InvalidIndex;
+        }
+    } // namespace
+
+    size_t CompressedMotionData::CalcStreamSaveSizeInBytes([[maybe_unused]] const SaveSettings& saveSettings) const
+    {
+        size_t numBytes = sizeof(File_CompressedMotionData_Info);
+
+        for (const KeyGroup& group : m_keyGroups)
+        {
+            numBytes += sizeof(File_CompressedMotionData_KeyGroup);
+            numBytes += group.m_keyTimes.size() * sizeof(float);
+            numBytes += group.m_numColumns * 2 * sizeof(float);
+            numBytes += group.m_keyValues.size() * sizeof(AZ::u16);
+        }
+
+        const size_t numJoints = GetNumJoints();
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Joint);
+            numBytes += ExporterLib::GetStringChunkSize(GetJointName(i));
+        }
+
+        const size_t numMorphs = GetNumMorphs();
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetMorphName(i));
+        }
+
+        const size_t numFloats = GetNumFloats();
+        for (size_t i = 0; i < numFloats; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetFloatName(i));
+        }
+
+        return numBytes;
+    }
+
+    AZ::u32 CompressedMotionData::GetStreamSaveVersion() const
+    {
+        return 1;
+    }
+
+    bool CompressedMotionData::Save(MCore::Stream* stream, const SaveSettings& saveSettings) const
+    {
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+
+        // Write the info chunk.
+        File_CompressedMotionData_Info info;
+        info.m_numJoints = static_cast<AZ::u32>(GetNumJoints());
+        info.m_numMorphs = static_cast<AZ::u32>(GetNumMorphs());
+        info.m_numFloats = static_cast<AZ::u32>(GetNumFloats());
+        info.m_numKeyGroups = static_cast<AZ::u32>(m_keyGroups.size());
+        info.m_sampleRate = GetSampleRate();
+
+        if (saveSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- CompressedMotionData:");
+            MCore::LogDetailedInfo("  + NumJoints         = %d", info.m_numJoints);
+            MCore::LogDetailedInfo("  + NumMorphs         = %d", info.m_numMorphs);
+            MCore::LogDetailedInfo("  + NumFloats         = %d", info.m_numFloats);
+            MCore::LogDetailedInfo("  + NumKeyGroups      = %d", info.m_numKeyGroups);
+            MCore::LogDetailedInfo("  + SampleRate        = %f", info.m_sampleRate);
+        }
+
+        ExporterLib::ConvertUnsignedInt(&info.m_numJoints, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numMorphs, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numFloats, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numKeyGroups, targetEndianType);
+        ExporterLib::ConvertFloat(&info.m_sampleRate, targetEndianType);
+        if (stream->Write(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+
+        // Write the key groups, each with its key times, quantization ranges and quantized values.
+        AZStd::vector<float> floatValues;
+        auto saveFloats = [stream, targetEndianType, &floatValues](const float* values, size_t numValues)
+        {
+            if (numValues == 0)
+            {
+                return true;
+            }
+            floatValues.assign(values, values + numValues);
+            for (float& value : floatValues)
+            {
+                ExporterLib::ConvertFloat(&value, targetEndianType);
+            }
+            return stream->Write(floatValues.data(), numValues * sizeof(float)) != 0;
+        };
+
+        AZStd::vector<AZ::u16> keyValues;
+        for (const KeyGroup& group : m_keyGroups)
+        {
+            File_CompressedMotionData_KeyGroup groupChunk;
+            groupChunk.m_numKeys = static_cast<AZ::u32>(group.m_keyTimes.size());
+            groupChunk.m_numColumns = static_cast<AZ::u32>(group.m_numColumns);
+            groupChunk.m_keyStride = static_cast<AZ::u32>(group.m_keyStride);
+            ExporterLib::ConvertUnsignedInt(&groupChunk.m_numKeys, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&groupChunk.m_numColumns, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&groupChunk.m_keyStride, targetEndianType);
+            if (stream->Write(&groupChunk, sizeof(File_CompressedMotionData_KeyGroup)) == 0)
+            {
+                return false;
+            }
+
+            if (!saveFloats(group.m_keyTimes.data(), group.m_keyTimes.size()) ||
+                !saveFloats(group.m_columnMins.data(), group.m_numColumns) ||
+                !saveFloats(group.m_columnScales.data(), group.m_numColumns))
+            {
+                return false;
+            }
+
+            keyValues = group.m_keyValues;
+            for (AZ::u16& value : keyValues)
+            {
+                ExporterLib::ConvertUnsignedShort(&value, targetEndianType);
+            }
+            if (stream->Write(keyValues.data(), keyValues.size() * sizeof(AZ::u16)) == 0)
+            {
+                return false;
+            }
+        }
+
+        // Write the joints.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            File_CompressedMotionData_Joint jointChunk;
+            ExporterLib::CopyVector(jointChunk.m_staticPos, AZ::PackedVector3f(GetJointStaticPosition(i)));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_staticRot, GetJointStaticRotation(i));
+            ExporterLib::CopyVector(jointChunk.m_bindPosePos, AZ::PackedVector3f(GetJointBindPosePosition(i)));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_bindPoseRot, GetJointBindPoseRotation(i));
+            EMFX_SCALECODE
+            (
+                ExporterLib::CopyVector(jointChunk.m_staticScale, AZ::PackedVector3f(GetJointStaticScale(i)));
+                ExporterLib::CopyVector(jointChunk.m_bindPoseScale, AZ::PackedVector3f(GetJointBindPoseScale(i)));
+            )
+            jointChunk.m_keyGroup = ToFileIndex(m_jointData[i].m_keyGroup);
+            jointChunk.m_positionColumn = ToFileIndex(m_jointData[i].m_positionColumn);
+            jointChunk.m_rotationOffset = ToFileIndex(m_jointData[i].m_rotationOffset);
+            jointChunk.m_scaleColumn = ToFileIndex(m_jointData[i].m_scaleColumn);
+
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticPos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_staticRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticScale, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPosePos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_bindPoseRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPoseScale, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&jointChunk.m_keyGroup, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&jointChunk.m_positionColumn, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&jointChunk.m_rotationOffset, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&jointChunk.m_scaleColumn, targetEndianType);
+            if (stream->Write(&jointChunk, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(GetJointName(i), stream, targetEndianType);
+        }
+
+        // Write the morph and float channels.
+        auto saveFloatChannels = [stream, targetEndianType](const AZStd::vector<FloatData>& floatData, const AZStd::vector<StaticFloatData>& staticData, const auto& getName)
+        {
+            for (size_t i = 0; i < floatData.size(); ++i)
+            {
+                const AZStd::string& channelName = getName(i);
+                if (channelName.empty())
+                {
+                    MCore::LogError("Cannot save morph or float channel with empty name.");
+                    return false;
+                }
+
+                File_CompressedMotionData_Float floatChunk;
+                floatChunk.m_staticValue = staticData[i].m_staticValue;
+                floatChunk.m_keyGroup = ToFileIndex(floatData[i].m_keyGroup);
+                floatChunk.m_column = ToFileIndex(floatData[i].m_column);
+                ExporterLib::ConvertFloat(&floatChunk.m_staticValue, targetEndianType);
+                ExporterLib::ConvertUnsignedInt(&floatChunk.m_keyGroup, targetEndianType);
+                ExporterLib::ConvertUnsignedInt(&floatChunk.m_column, targetEndianType);
+                if (stream->Write(&floatChunk, sizeof(File_CompressedMotionData_Float)) == 0)
+                {
+                    return false;
+                }
+                ExporterLib::SaveString(channelName, stream, targetEndianType);
+            }
+            return true;
+        };
+        if (!saveFloatChannels(m_morphData, m_staticMorphData, [this](size_t i) -> const AZStd::string& { return GetMorphName(i); }) ||
+            !saveFloatChannels(m_floatData, m_staticFloatData, [this](size_t i) -> const AZStd::string& { return GetFloatName(i); }))
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        // Read the info header.
+        File_CompressedMotionData_Info info;
+        if (stream->Read(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+        const MCore::Endian::EEndianType sourceEndianType = readSettings.m_sourceEndianType;
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numJoints, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numMorphs, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numFloats, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numKeyGroups, sourceEndianType);
+        MCore::Endian::ConvertFloat(&info.m_sampleRate, sourceEndianType);
+
+        if (readSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- CompressedMotionData:");
+            MCore::LogDetailedInfo("  + NumJoints         = %d", info.m_numJoints);
+            MCore::LogDetailedInfo("  + NumMorphs         = %d", info.m_numMorphs);
+            MCore::LogDetailedInfo("  + NumFloats         = %d", info.m_numFloats);
+            MCore::LogDetailedInfo("  + NumKeyGroups      = %d", info.m_numKeyGroups);
+            MCore::LogDetailedInfo("  + SampleRate        = %f", info.m_sampleRate);
+        }
+
+        Clear();
+        Resize(info.m_numJoints, info.m_numMorphs, info.m_numFloats);
+        SetSampleRate(info.m_sampleRate);
+
+        // Read the key groups, each with its key times, quantization ranges and quantized values.
+        auto readFloats = [stream, sourceEndianType](float* values, size_t numValues)
+        {
+            if (numValues == 0)
+            {
+                return true;
+            }
+            if (stream->Read(values, numValues * sizeof(float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(values, sourceEndianType, static_cast<AZ::u32>(numValues));
+            return true;
+        };
+
+        m_keyGroups.resize(info.m_numKeyGroups);
+        for (size_t i = 0; i < m_keyGroups.size(); ++i)
+        {
+            File_CompressedMotionData_KeyGroup groupInfo;
+            if (stream->Read(&groupInfo, sizeof(File_CompressedMotionData_KeyGroup)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertUnsignedInt32(&groupInfo.m_numKeys, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&groupInfo.m_numColumns, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&groupInfo.m_keyStride, sourceEndianType);
+
+            // Key groups only exist for animated tracks, which need at least one key to be sampled. The values of a key are the
+            // quantized columns followed by an optional encoded rotation.
+            const size_t numRotationValues = static_cast<size_t>(groupInfo.m_keyStride) - groupInfo.m_numColumns;
+            if (groupInfo.m_numKeys == 0 || groupInfo.m_keyStride == 0 || groupInfo.m_keyStride < groupInfo.m_numColumns ||
+                (numRotationValues != 0 && numRotationValues != 3))
+            {
+                AZ_Error("EMotionFX", false, "Key group %zu has %u keys with %u values and %u quantized columns, which isn't valid.",
+                    i, groupInfo.m_numKeys, groupInfo.m_keyStride, groupInfo.m_numColumns);
+                return false;
+            }
+
+            KeyGroup& group = m_keyGroups[i];
+            group.m_numColumns = groupInfo.m_numColumns;
+            group.m_keyStride = groupInfo.m_keyStride;
+            group.m_keyTimes.resize(groupInfo.m_numKeys);
+            group.m_columnMins.assign(group.m_numColumns + 1, 0.0f);
+            group.m_columnScales.assign(group.m_numColumns + 1, 0.0f);
+            group.m_keyValues.resize(group.m_keyTimes.size() * group.m_keyStride);
+            if (!readFloats(group.m_keyTimes.data(), group.m_keyTimes.size()) ||
+                !readFloats(group.m_columnMins.data(), group.m_numColumns) ||
+                !readFloats(group.m_columnScales.data(), group.m_numColumns))
+            {
+                return false;
+            }
+
+            if (!AZStd::is_sorted(group.m_keyTimes.begin(), group.m_keyTimes.end()))
+            {
+                AZ_Error("EMotionFX", false, "The key times of key group %zu aren't in increasing order.", i);
+                return false;
+            }
+
+            if (stream->Read(group.m_keyValues.data(), group.m_keyValues.size() * sizeof(AZ::u16)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertUnsignedInt16(group.m_keyValues.data(), sourceEndianType, static_cast<AZ::u32>(group.m_keyValues.size()));
+        }
+
+        // Read all joints.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            File_CompressedMotionData_Joint jointInfo;
+            if (stream->Read(&jointInfo, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+
+            // Convert endian.
+            AZ::Vector3 staticPos(jointInfo.m_staticPos.m_x, jointInfo.m_staticPos.m_y, jointInfo.m_staticPos.m_z);
+            AZ::Vector3 staticScale(jointInfo.m_staticScale.m_x, jointInfo.m_staticScale.m_y, jointInfo.m_staticScale.m_z);
+            MCore::Compressed16BitQuaternion staticRot(jointInfo.m_staticRot.m_x, jointInfo.m_staticRot.m_y, jointInfo.m_staticRot.m_z, jointInfo.m_staticRot.m_w);
+            AZ::Vector3 bindPosePos(jointInfo.m_bindPosePos.m_x, jointInfo.m_bindPosePos.m_y, jointInfo.m_bindPosePos.m_z);
+            AZ::Vector3 bindPoseScale(jointInfo.m_bindPoseScale.m_x, jointInfo.m_bindPoseScale.m_y, jointInfo.m_bindPoseScale.m_z);
+            MCore::Compressed16BitQuaternion bindPoseRot(jointInfo.m_bindPoseRot.m_x, jointInfo.m_bindPoseRot.m_y, jointInfo.m_bindPoseRot.m_z, jointInfo.m_bindPoseRot.m_w);
+            MCore::Endian::ConvertVector3(&staticPos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&staticRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&staticScale, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPosePos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&bindPoseRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPoseScale, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&jointInfo.m_keyGroup, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&jointInfo.m_positionColumn, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&jointInfo.m_rotationOffset, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&jointInfo.m_scaleColumn, sourceEndianType);
+
+            SetJointStaticPosition(i, staticPos);
+            SetJointStaticRotation(i, staticRot.ToQuaternion().GetNormalized());
+            SetJointBindPosePosition(i, bindPosePos);
+            SetJointBindPoseRotation(i, bindPoseRot.ToQuaternion().GetNormalized());
+            EMFX_SCALECODE
+            (
+                SetJointStaticScale(i, staticScale);
+                SetJointBindPoseScale(i, bindPoseScale);
+            )
+            SetJointName(i, MotionData::ReadStringFromStream(stream, sourceEndianType));
+
+            JointData& jointData = m_jointData[i];
+            jointData.m_keyGroup = FromFileIndex(jointInfo.m_keyGroup);
+            jointData.m_positionColumn = FromFileIndex(jointInfo.m_positionColumn);
+            jointData.m_rotationOffset = FromFileIndex(jointInfo.m_rotationOffset);
+#ifndef EMFX_SCALE_DISABLED
+            jointData.m_scaleColumn = FromFileIndex(jointInfo.m_scaleColumn);
+#endif
+            const bool hasAnimatedTracks = (jointInfo.m_positionColumn != InvalidIndex32 || jointInfo.m_rotationOffset != InvalidIndex32 || jointInfo.m_scaleColumn != InvalidIndex32);
+            if (jointData.m_keyGroup == InvalidIndex || jointData.m_keyGroup >= m_keyGroups.size())
+            {
+                if (hasAnimatedTracks || jointData.m_keyGroup != InvalidIndex)
+                {
+                    AZ_Error("EMotionFX", false, "Joint '%s' references a key group that is out of range.", GetJointName(i).c_str());
+                    return false;
+                }
+            }
+            else
+            {
+                const KeyGroup& group = m_keyGroups[jointData.m_keyGroup];
+                if (!hasAnimatedTracks ||
+                    (jointData.m_positionColumn != InvalidIndex && jointData.m_positionColumn + 3 > group.m_numColumns) ||
+                    (jointData.m_rotationOffset != InvalidIndex && (jointData.m_rotationOffset < group.m_numColumns || jointData.m_rotationOffset + 3 > group.m_keyStride)) ||
+                    (jointData.m_scaleColumn != InvalidIndex && jointData.m_scaleColumn + 3 > group.m_numColumns))
+                {
+                    AZ_Error("EMotionFX", false, "Joint '%s' references quantized data that is out of range.", GetJointName(i).c_str());
+                    return false;
+                }
+            }
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + [%zu] Joint = '%s'", i, GetJointName(i).c_str());
+                MCore::LogDetailedInfo("    - IsPosAnimated   = %s", IsJointPositionAnimated(i) ? "Yes" : "No");
+                MCore::LogDetailedInfo("    - IsRotAnimated   = %s", IsJointRotationAnimated(i) ? "Yes" : "No");
+                MCore::LogDetailedInfo("    - IsScaleAnimated = %s", (jointData.m_scaleColumn != InvalidIndex) ? "Yes" : "No");
+            }
+        }
+
+        // Read the morph and float channels.
+        auto readFloatChannels = [this, stream, sourceEndianType, &readSettings](AZStd::vector<FloatData>& floatData, AZStd::vector<StaticFloatData>& staticData, const char* channelType)
+        {
+            for (size_t i = 0; i < floatData.size(); ++i)
+            {
+                File_CompressedMotionData_Float floatInfo;
+                if (stream->Read(&floatInfo, sizeof(File_CompressedMotionData_Float)) == 0)
+                {
+                    return false;
+                }
+                MCore::Endian::ConvertFloat(&floatInfo.m_staticValue, sourceEndianType);
+                MCore::Endian::ConvertUnsignedInt32(&floatInfo.m_keyGroup, sourceEndianType);
+                MCore::Endian::ConvertUnsignedInt32(&floatInfo.m_column, sourceEndianType);
+
+                staticData[i].m_staticValue = floatInfo.m_staticValue;
+                staticData[i].m_nameId = MCore::GetStringIdPool().GenerateIdForString(MotionData::ReadStringFromStream(stream, sourceEndianType));
+                floatData[i].m_keyGroup = FromFileIndex(floatInfo.m_keyGroup);
+                floatData[i].m_column = FromFileIndex(floatInfo.m_column);
+                const bool isValid = (floatData[i].m_keyGroup == InvalidIndex) ?
+                    (floatData[i].m_column == InvalidIndex) :
+                    (floatData[i].m_keyGroup < m_keyGroups.size() && floatData[i].m_column < m_keyGroups[floatData[i].m_keyGroup].m_numColumns);
+                if (!isValid)
+                {
+                    AZ_Error("EMotionFX", false, "%s channel %zu references quantized data that is out of range.", channelType, i);
+                    return false;
+                }
+
+                if (readSettings.m_logDetails)
+                {
+                    MCore::LogDetailedInfo("  + %s: '%s'", channelType, MCore::GetStringIdPool().GetName(staticData[i].m_nameId).c_str());
+                    MCore::LogDetailedInfo("       + IsAnimated   = %s", (floatData[i].m_keyGroup != InvalidIndex) ? "Yes" : "No");
+                    MCore::LogDetailedInfo("       + Static value = %f", floatInfo.m_staticValue);
+                }
+            }
+            return true;
+        };
+        if (!readFloatChannels(m_morphData, m_staticMorphData, "Morph") ||
+            !readFloatChannels(m_floatData, m_staticFloatData, "Float"))
+        {
+            return false;
+        }
+
+        UpdateDuration();
+        return true;
+    }
+
+    bool CompressedMotionData::Read(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        switch (readSettings.m_version)
+        {
+            case 1:
+            {
+                return ReadVersion1(stream, readSettings);
+            }
+            break;
+
+            default:
+            {
+                AZ_Error("EMotionFX", false, "Unsupported CompressedMotionData version (version=%d), cannot load motion data.", readSettings.m_version);
+            }
+        }
+
+        return false;
+    }
+} // namespace EMotionFX
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/Transform.h>
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace EMotionFX
+{
+    class Pose;
+
+    //! Motion data that stores the animated tracks quantized to 16 bits per component.
+    //! Positions, scales, morphs and floats are quantized within the value range of their track, rotations use the smallest three
+    //! encoding with 15 bits per component.
+    //! The animated tracks of a joint share their keyframes, as do the ones of a morph or float, which forms a key group.
+    //! Optimize removes the keyframes of every group that can be interpolated from their neighbours within the given error on all its
+    //! tracks, and turns tracks that stay within the error of a constant value into static values.
+    //! The quantized values of a group for a keyframe are stored next to each other, so that sampling a joint looks up its keyframes
+    //! only once and then reads two contiguous blocks of memory.
+    class EMFX_API CompressedMotionData
+        : public MotionData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompressedMotionData, MotionAllocator, 0)
+        AZ_RTTI(CompressedMotionData, "{0B9E6C1D-3A5F-4E27-9C84-D2F716A8B35E}", MotionData)
+
+        CompressedMotionData() = default;
+        ~CompressedMotionData() override;
+
+        void InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate=true, float newSampleRate=30.0f, bool updateDuration=false) override;
+        void Optimize(const OptimizeSettings& settings) override;
+        bool Read(MCore::Stream* stream, const ReadSettings& readSettings) override;
+        bool Save(MCore::Stream* stream, const SaveSettings& saveSettings) const override;
+        size_t CalcStreamSaveSizeInBytes(const SaveSettings& saveSettings) const override;
+        AZ::u32 GetStreamSaveVersion() const override;
+        const char* GetSceneSettingsName() const override;
+
+        // Overloaded.
+        Transform SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const override;
+        void SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const override;
+        float SampleMorph(float sampleTime, size_t morphDataIndex) const override;
+        float SampleFloat(float sampleTime, size_t floatDataIndex) const override;
+        Transform SampleJointTransform(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointPosition(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Quaternion SampleJointRotation(float sampleTime, size_t jointDataIndex) const override;
+
+        void ClearAllJointTransformSamples() override;
+        void ClearAllMorphSamples() override;
+        void ClearAllFloatSamples() override;
+        void ClearJointPositionSamples(size_t jointDataIndex) override;
+        void ClearJointRotationSamples(size_t jointDataIndex) override;
+        void ClearJointTransformSamples(size_t jointDataIndex) override;
+        void ClearMorphSamples(size_t morphDataIndex) override;
+        void ClearFloatSamples(size_t floatDataIndex) override;
+
+        bool IsJointPositionAnimated(size_t jointDataIndex) const override;
+        bool IsJointRotationAnimated(size_t jointDataIndex) const override;
+        bool IsJointAnimated(size_t jointDataIndex) const override;
+        bool IsMorphAnimated(size_t morphDataIndex) const override;
+        bool IsFloatAnimated(size_t floatDataIndex) const override;
+
+#ifndef EMFX_SCALE_DISABLED
+        void ClearJointScaleSamples(size_t jointDataIndex) override;
+        bool IsJointScaleAnimated(size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointScale(float sampleTime, size_t jointDataIndex) const override;
+#endif
+
+        size_t GetNumKeys() const; //!< The number of keys of all key groups together.
+        size_t GetNumJointKeys(size_t jointDataIndex) const; //!< The number of keys of the joint, or zero when it isn't animated.
+        float GetJointKeyTime(size_t jointDataIndex, size_t keyIndex) const;
+        size_t CalcKeyDataSizeInBytes() const; //!< The memory used by the key times, the quantization ranges and the quantized values.
+        void UpdateDuration() override;
+
+    private:
+        //! The uncompressed tracks, used while building and editing the motion data.
+        //! Every animated track has one value per key time, the ones that aren't animated are empty.
+        struct BuildData
+        {
+            struct JointSamples
+            {
+                AZStd::vector<AZ::Vector3> m_positions;
+                AZStd::vector<AZ::Quaternion> m_rotations;
+                AZStd::vector<AZ::Vector3> m_scales;
+            };
+
+            AZStd::vector<float> m_keyTimes;
+            AZStd::vector<JointSamples> m_joints;
+            AZStd::vector<AZStd::vector<float>> m_morphs;
+            AZStd::vector<AZStd::vector<float>> m_floats;
+        };
+
+        //! The keys of the animated tracks of a joint, morph or float.
+        struct EMFX_API KeyGroup
+        {
+            AZStd::vector<float> m_keyTimes;
+            AZStd::vector<float> m_columnMins; //!< The dequantized value is min + quantized * scale, padded with one float so three columns can be loaded at once.
+            AZStd::vector<float> m_columnScales;
+            AZStd::vector<AZ::u16> m_keyValues; //!< The quantized columns followed by the encoded rotation, for all keys after each other.
+            size_t m_numColumns = 0;
+            size_t m_keyStride = 0; //!< The number of quantized values per key.
+        };
+
+        //! The columns and offsets are within the values of a key of the key group.
+        struct EMFX_API JointData
+        {
+            size_t m_keyGroup = InvalidIndex;       //!< The key group of the animated tracks, or InvalidIndex when none are animated.
+            size_t m_positionColumn = InvalidIndex; //!< The first of the three quantized columns holding the position.
+            size_t m_rotationOffset = InvalidIndex; //!< The offset of the smallest three encoded rotation.
+            size_t m_scaleColumn = InvalidIndex;    //!< The first of the three quantized columns holding the scale.
+        };
+
+        struct EMFX_API FloatData
+        {
+            size_t m_keyGroup = InvalidIndex;
+            size_t m_column = InvalidIndex;
+        };
+
+        struct KeyGroupTracks;
+
+        MotionData* CreateNew() const override;
+        void ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats) override;
+        void ClearAllData() override;
+        void AddJointSampleData(size_t jointDataIndex) override;
+        void AddMorphSampleData(size_t morphDataIndex) override;
+        void AddFloatSampleData(size_t floatDataIndex) override;
+        void RemoveJointSampleData(size_t jointDataIndex) override;
+        void RemoveMorphSampleData(size_t morphDataIndex) override;
+        void RemoveFloatSampleData(size_t floatDataIndex) override;
+        void ScaleData(float scaleFactor) override;
+
+        void ClearCompressedData();
+        void Compress(const BuildData& buildData, const OptimizeSettings& settings);
+        //! Picks the keys of the tracks and quantizes them into a new key group, returning its index or InvalidIndex when there is nothing to store.
+        size_t AddKeyGroup(const KeyGroupTracks& tracks, const AZStd::vector<float>& sampleTimes);
+        void Decompress(BuildData& outBuildData) const;
+        bool HasSourceData() const;
+        template <class EditFunction>
+        void EditSourceData(const EditFunction& editFunction);
+        template <class EditFunction>
+        void EditSamples(const EditFunction& editFunction);
+
+        static void CalculateKeyInterpolation(const KeyGroup& group, float sampleTime, const AZ::u16*& outKeyValuesA, const AZ::u16*& outKeyValuesB, float& outT);
+        static AZ::Vector3 DecodeVector3(const KeyGroup& group, const AZ::u16* keyValuesA, const AZ::u16* keyValuesB, size_t column, float t);
+        static AZ::Quaternion DecodeRotation(const AZ::u16* keyValuesA, const AZ::u16* keyValuesB, size_t offset, float t);
+        static float DecodeFloat(const KeyGroup& group, const AZ::u16* keyValuesA, const AZ::u16* keyValuesB, size_t column, float t);
+        float SampleFloatData(float sampleTime, const FloatData& floatData, const StaticFloatData& staticData) const;
+
+        bool ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings);
+
+        AZStd::vector<JointData> m_jointData;
+        AZStd::vector<FloatData> m_morphData;
+        AZStd::vector<FloatData> m_floatData;
+        AZStd::vector<KeyGroup> m_keyGroups;
+        BuildData m_sourceData; //!< The tracks this data was initialized from, until Optimize compresses from and releases them. Empty when read from a file.
+    };
+} // namespace EMotionFX
@@ -20,6 +20,7 @@
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Debug/Timer.h>
 
 
 namespace EMotionFX
@@ -141,6 +142,11 @@ namespace EMotionFX
             rootInstance->RecursiveSetIsVisible(rootInstance->GetIsVisible());
         }
 
+        // adjust the motion sampling rates to the update budget
+        ApplyUpdateBudget();
+        AZ::Debug::Timer updateTimer;
+        updateTimer.Stamp();
+
         // reset stats
         m_numUpdated.SetValue(0);
         m_numVisible.SetValue(0);
@@ -202,6 +208,8 @@ namespace EMotionFX
 
             jobCompletion.StartAndWaitForCompletion();
         } // for all steps
+
+        FinishUpdateBudget(updateTimer.GetDeltaTimeInSeconds());
     }
 
 
@@ -13,6 +13,7 @@
 #include "Attachment.h"
 #include "EMotionFXManager.h"
 #include <EMotionFX/Source/Allocators.h>
+#include <AzCore/Debug/Timer.h>
 
 
 namespace EMotionFX
@@ -62,6 +63,11 @@ namespace EMotionFX
             rootInstance->RecursiveSetIsVisible(rootInstance->GetIsVisible());
         }
 
+        // adjust the motion sampling rates to the update budget
+        ApplyUpdateBudget();
+        AZ::Debug::Timer updateTimer;
+        updateTimer.Stamp();
+
         // process all root actor instances, and execute them and their attachments
         for (size_t i = 0; i < numRootActorInstances; ++i)
         {
@@ -73,6 +79,8 @@ namespace EMotionFX
 
             RecursiveExecuteActorInstance(rootActorInstance, timePassedInSeconds);
         }
+
+        FinishUpdateBudget(updateTimer.GetDeltaTimeInSeconds());
     }
 
 
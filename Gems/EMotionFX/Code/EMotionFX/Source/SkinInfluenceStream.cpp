@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/sort.h>
+#include <EMotionFX/Source/Mesh.h>
+#include <EMotionFX/Source/SkinInfluenceStream.h>
+#include <EMotionFX/Source/SkinningInfoVertexAttributeLayer.h>
+
+namespace EMotionFX
+{
+    void SkinInfluenceStream::Init(const Mesh* mesh)
+    {
+        Clear();
+
+        SkinningInfoVertexAttributeLayer* layer = static_cast<SkinningInfoVertexAttributeLayer*>(mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID));
+        const AZ::u32* orgVerts = static_cast<const AZ::u32*>(mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
+        if (!layer || !orgVerts)
+        {
+            return;
+        }
+
+        const AZ::u32 numVertices = mesh->GetNumVertices();
+        for (AZ::u32 v = 0; v < numVertices; ++v)
+        {
+            m_numInfluencesPerVertex = AZStd::max(m_numInfluencesPerVertex, layer->GetNumInfluences(orgVerts[v]));
+        }
+
+        m_boneNumbers.resize(numVertices * m_numInfluencesPerVertex, 0);
+        m_weights.resize(numVertices * m_numInfluencesPerVertex, 0.0f);
+
+        AZStd::vector<const SkinInfluence*> influences;
+        for (AZ::u32 v = 0; v < numVertices; ++v)
+        {
+            const AZ::u32 orgVertex = orgVerts[v];
+            const size_t numInfluences = layer->GetNumInfluences(orgVertex);
+            if (numInfluences == 0)
+            {
+                continue;
+            }
+
+            influences.clear();
+            for (size_t i = 0; i < numInfluences; ++i)
+            {
+                influences.emplace_back(layer->GetInfluence(orgVertex, i));
+            }
+            AZStd::stable_sort(influences.begin(), influences.end(),
+                [](const SkinInfluence* a, const SkinInfluence* b)
+                {
+                    return a->GetWeight() > b->GetWeight();
+                });
+
+            AZ::u16* boneNumbers = &m_boneNumbers[v * m_numInfluencesPerVertex];
+            float* weights = &m_weights[v * m_numInfluencesPerVertex];
+            for (size_t i = 0; i < m_numInfluencesPerVertex; ++i)
+            {
+                if (i < numInfluences)
+                {
+                    boneNumbers[i] = influences[i]->GetBoneNr();
+                    weights[i] = influences[i]->GetWeight();
+                }
+                else
+                {
+                    boneNumbers[i] = boneNumbers[0];
+                }
+            }
+        }
+    }
+
+    void SkinInfluenceStream::Clear()
+    {
+        m_boneNumbers.clear();
+        m_weights.clear();
+        m_numInfluencesPerVertex = 0;
+    }
+} // namespace EMotionFX
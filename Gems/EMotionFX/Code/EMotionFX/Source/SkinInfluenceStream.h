@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+namespace EMotionFX
+{
+    class Mesh;
+
+    //! The skin influences of all vertices of a mesh, flattened into the same number of influences per vertex.
+    //! The influences of each vertex are sorted by weight, largest first, and padded with zero weight influences on the bone of the
+    //! first influence. The stream is indexed by the vertex number rather than the original vertex number, so that skinning walks
+    //! both the vertex data and the influences linearly without branching on the number of influences.
+    class EMFX_API SkinInfluenceStream
+    {
+    public:
+        //! Build the stream from the skinning info layer of the mesh. The bone numbers of the influences have to be set already.
+        void Init(const Mesh* mesh);
+        void Clear();
+
+        size_t GetNumInfluencesPerVertex() const { return m_numInfluencesPerVertex; }
+
+        //! The local bone numbers of the influences of the given vertex, GetNumInfluencesPerVertex() values.
+        const AZ::u16* GetBoneNumbers(AZ::u32 vertex) const { return &m_boneNumbers[vertex * m_numInfluencesPerVertex]; }
+
+        //! The weights of the influences of the given vertex, GetNumInfluencesPerVertex() values.
+        const float* GetWeights(AZ::u32 vertex) const { return &m_weights[vertex * m_numInfluencesPerVertex]; }
+
+    private:
+        AZStd::vector<AZ::u16> m_boneNumbers;
+        AZStd::vector<float> m_weights;
+        size_t m_numInfluencesPerVertex = 0;
+    };
+} // namespace EMotionFX
@@ -7,6 +7,9 @@
  */
 
 // include the required headers
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/SimdMath.h>
 #include "EMotionFXConfig.h"
 #include "SoftSkinDeformer.h"
 #include "Mesh.h"
@@ -17,7 +20,6 @@
 #include "TransformData.h"
 #include "ActorInstance.h"
 #include <EMotionFX/Source/Allocators.h>
-#include <MCore/Source/AzCoreConversions.h>
 
 
 namespace EMotionFX
@@ -69,6 +71,7 @@ namespace EMotionFX
         // copy the bone info (for precalc/optimization reasons)
         result->m_nodeNumbers    = m_nodeNumbers;
         result->m_boneMatrices   = m_boneMatrices;
+        result->m_influences     = m_influences;
 
         // return the result
         return result;
@@ -93,109 +96,80 @@ namespace EMotionFX
             m_boneMatrices[i] = skinningMatrices[nodeIndex];
         }
 
-        // find the skinning layer
-        SkinningInfoVertexAttributeLayer* layer = (SkinningInfoVertexAttributeLayer*)m_mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID);
-        AZ_Assert(layer, "Cannot find skinning info");
+        if (m_influences.GetNumInfluencesPerVertex() == 0)
+        {
+            return;
+        }
 
         // Perform the skinning.
         AZ::Vector3* __restrict positions    = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
         AZ::Vector3* __restrict normals      = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
         AZ::Vector4* __restrict tangents     = static_cast<AZ::Vector4*>(m_mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
         AZ::Vector3* __restrict bitangents   = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
-        AZ::u32*     __restrict orgVerts     = static_cast<AZ::u32*>(m_mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
-        SkinVertexRange(0, m_mesh->GetNumVertices(), positions, normals, tangents, bitangents, orgVerts, layer);
-    }
 
+        const uint32 numVertices = m_mesh->GetNumVertices();
+        if (numVertices <= s_numVerticesPerBatch)
+        {
+            SkinVertexRange(0, numVertices, positions, normals, tangents, bitangents);
+            return;
+        }
 
-    void SoftSkinDeformer::SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer)
-    {
-        AZ::Vector3 newPos, newNormal;
-        AZ::Vector3 vtxPos, normal;
-        AZ::Vector4 tangent, newTangent;
-        AZ::Vector3 bitangent, newBitangent;
-
-        // if there are tangents and bitangents to skin
-        if (tangents && bitangents)
+        // Split up the skinned vertices into batches and skin them simultaneously.
+        AZ::JobCompletion jobCompletion;
+        for (AZ::u32 startVertex = 0; startVertex < numVertices; startVertex += s_numVerticesPerBatch)
         {
-            for (uint32 v = startVertex; v < endVertex; ++v)
-            {
-                newPos = AZ::Vector3::CreateZero();
-                newNormal = AZ::Vector3::CreateZero();
-                newTangent = AZ::Vector4::CreateZero();
-                newBitangent = AZ::Vector3::CreateZero();
-
-                vtxPos  = positions[v];
-                normal  = normals[v];
-                tangent = tangents[v];
-                bitangent = bitangents[v];
-
-                const uint32 orgVertex = orgVerts[v]; // get the original vertex number
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                for (size_t i = 0; i < numInfluences; ++i)
-                {
-                    const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                    MCore::Skin(m_boneMatrices[influence->GetBoneNr()], &vtxPos, &normal, &tangent, &bitangent, &newPos, &newNormal, &newTangent, &newBitangent, influence->GetWeight());
-                }
+            const AZ::u32 endVertex = AZStd::min(startVertex + s_numVerticesPerBatch, numVertices);
 
-                newTangent.SetW(tangents[v].GetW());
+            AZ::JobContext* jobContext = nullptr;
+            AZ::Job* job = AZ::CreateJobFunction([this, startVertex, endVertex, positions, normals, tangents, bitangents]()
+                {
+                    SkinVertexRange(startVertex, endVertex, positions, normals, tangents, bitangents);
+                }, /*isAutoDelete=*/true, jobContext);
 
-                // output the skinned values
-                positions[v]    = newPos;
-                normals[v]      = newNormal;
-                tangents[v]     = newTangent;
-                bitangents[v]   = newBitangent;
-            }
+            job->SetDependent(&jobCompletion);
+            job->Start();
         }
-        else if (tangents) // only tangents but no bitangents
-        {
-            for (uint32 v = startVertex; v < endVertex; ++v)
-            {
-                newPos = AZ::Vector3::CreateZero();
-                newNormal = AZ::Vector3::CreateZero();
-                newTangent = AZ::Vector4::CreateZero();
 
-                vtxPos  = positions[v];
-                normal  = normals[v];
-                tangent = tangents[v];
+        jobCompletion.StartAndWaitForCompletion();
+    }
 
-                const uint32 orgVertex = orgVerts[v]; // get the original vertex number
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                for (size_t i = 0; i < numInfluences; ++i)
-                {
-                    const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                    MCore::Skin(m_boneMatrices[influence->GetBoneNr()], &vtxPos, &normal, &tangent, &newPos, &newNormal, &newTangent, influence->GetWeight());
-                }
 
-                newTangent.SetW(tangents[v].GetW());
+    void SoftSkinDeformer::SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents) const
+    {
+        using AZ::Simd::Vec4;
 
-                // output the skinned values
-                positions[v]    = newPos;
-                normals[v]      = newNormal;
-                tangents[v]     = newTangent;
-            }
-        }
-        else // there are no tangents and bitangents to skin
+        const size_t numInfluences = m_influences.GetNumInfluencesPerVertex();
+        for (uint32 v = startVertex; v < endVertex; ++v)
         {
-            for (uint32 v = startVertex; v < endVertex; ++v)
+            const AZ::u16* boneNumbers = m_influences.GetBoneNumbers(v);
+            const float* weights = m_influences.GetWeights(v);
+
+            // blend the rows of the skinning matrices, the padded influences have a weight of zero
+            const Vec4::FloatType* boneRows = m_boneMatrices[boneNumbers[0]].GetSimdValues();
+            Vec4::FloatType weight = Vec4::Splat(weights[0]);
+            Vec4::FloatType row0 = Vec4::Mul(boneRows[0], weight);
+            Vec4::FloatType row1 = Vec4::Mul(boneRows[1], weight);
+            Vec4::FloatType row2 = Vec4::Mul(boneRows[2], weight);
+            for (size_t i = 1; i < numInfluences; ++i)
             {
-                newPos = AZ::Vector3::CreateZero();
-                newNormal = AZ::Vector3::CreateZero();
-
-                vtxPos  = positions[v];
-                normal  = normals[v];
-
-                // skin the vertex
-                const uint32 orgVertex = orgVerts[v]; // get the original vertex number
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                for (size_t i = 0; i < numInfluences; ++i)
-                {
-                    const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                    MCore::Skin(m_boneMatrices[influence->GetBoneNr()], &vtxPos, &normal, &newPos, &newNormal, influence->GetWeight());
-                }
+                boneRows = m_boneMatrices[boneNumbers[i]].GetSimdValues();
+                weight = Vec4::Splat(weights[i]);
+                row0 = Vec4::Madd(boneRows[0], weight, row0);
+                row1 = Vec4::Madd(boneRows[1], weight, row1);
+                row2 = Vec4::Madd(boneRows[2], weight, row2);
+            }
+            const AZ::Matrix3x4 skinMatrix = AZ::Matrix3x4::CreateFromRows(AZ::Vector4(row0), AZ::Vector4(row1), AZ::Vector4(row2));
 
-                // output the skinned values
-                positions[v]    = newPos;
-                normals[v]      = newNormal;
+            // output the skinned values
+            positions[v] = skinMatrix * positions[v];
+            normals[v] = skinMatrix.TransformVector(normals[v]);
+            if (tangents)
+            {
+                tangents[v].Set(skinMatrix.TransformVector(tangents[v].GetAsVector3()), tangents[v].GetW());
+            }
+            if (bitangents)
+            {
+                bitangents[v] = skinMatrix.TransformVector(bitangents[v]);
             }
         }
     }
@@ -212,6 +186,7 @@ namespace EMotionFX
         // clear the bone information array
         m_boneMatrices.clear();
         m_nodeNumbers.clear();
+        m_influences.Clear();
 
         // if there is no mesh
         if (m_mesh == nullptr)
@@ -257,5 +232,7 @@ namespace EMotionFX
                 influence->SetBoneNr(boneIndex);
             }
         }
+
+        m_influences.Init(m_mesh);
     }
 } // namespace EMotionFX
@@ -13,6 +13,7 @@
 #include <AzCore/Math/Transform.h>
 #include "EMotionFXConfig.h"
 #include "MeshDeformer.h"
+#include "SkinInfluenceStream.h"
 
 
 namespace EMotionFX
@@ -120,6 +121,10 @@ namespace EMotionFX
     protected:
         AZStd::vector<AZ::Matrix3x4>    m_boneMatrices;
         AZStd::vector<size_t>           m_nodeNumbers;
+        SkinInfluenceStream             m_influences;       /**< The influences of all vertices, sorted and padded to the same number per vertex. */
+
+        //! Number of vertices per batch/job used for multi-threaded software skinning.
+        static constexpr AZ::u32 s_numVerticesPerBatch = 10000;
 
         /**
          * Default constructor.
@@ -143,6 +148,11 @@ namespace EMotionFX
             return foundBoneIndex != end(m_nodeNumbers) ? AZStd::distance(begin(m_nodeNumbers), foundBoneIndex) : InvalidIndex;
         }
 
-        void SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer);
+        /**
+         * Skin a range of vertices. The skinning matrices of the influences of a vertex get blended first, after which the vertex gets
+         * transformed by the blended matrix only once.
+         * Tangents and bitangents can be nullptr.
+         */
+        void SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents) const;
     };
 } // namespace EMotionFX
@@ -15,6 +15,10 @@ namespace EMotionFX
 {
     AZ_CLASS_ALLOCATOR_IMPL(ThreadData, ThreadDataAllocator, 0)
 
+    // the pose pool override of the calling thread
+    static thread_local const ThreadData* s_overriddenThreadData = nullptr;
+    static thread_local AnimGraphPosePool* s_posePoolOverride = nullptr;
+
     // default constructor
     ThreadData::ThreadData()
         : BaseObject()
@@ -60,4 +64,38 @@ namespace EMotionFX
     {
         return m_threadIndex;
     }
+
+
+    const AnimGraphPosePool& ThreadData::GetPosePool() const
+    {
+        return (s_overriddenThreadData == this) ? *s_posePoolOverride : m_posePool;
+    }
+
+
+    AnimGraphPosePool& ThreadData::GetPosePool()
+    {
+        return (s_overriddenThreadData == this) ? *s_posePoolOverride : m_posePool;
+    }
+
+
+    bool ThreadData::GetIsPosePoolOverridden()
+    {
+        return s_overriddenThreadData != nullptr;
+    }
+
+
+    ThreadData::ScopedPosePoolOverride::ScopedPosePoolOverride(const ThreadData* threadData, AnimGraphPosePool* posePool)
+        : m_prevThreadData(s_overriddenThreadData)
+        , m_prevPosePool(s_posePoolOverride)
+    {
+        s_overriddenThreadData = threadData;
+        s_posePoolOverride = posePool;
+    }
+
+
+    ThreadData::ScopedPosePoolOverride::~ScopedPosePoolOverride()
+    {
+        s_overriddenThreadData = m_prevThreadData;
+        s_posePoolOverride = m_prevPosePool;
+    }
 }   // namespace EMotionFX
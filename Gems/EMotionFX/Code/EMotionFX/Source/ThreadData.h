@@ -34,12 +34,38 @@ namespace EMotionFX
         void SetThreadIndex(uint32 index);
         uint32 GetThreadIndex() const;
 
-        MCORE_INLINE const AnimGraphPosePool& GetPosePool() const                          { return m_posePool; }
-        MCORE_INLINE AnimGraphPosePool& GetPosePool()                                      { return m_posePool; }
+        /**
+         * Get the pose pool of this thread data.
+         * In case a ScopedPosePoolOverride for this thread data is active on the calling thread, its pose pool is returned instead.
+         * @result The pose pool to request the anim graph poses from.
+         */
+        const AnimGraphPosePool& GetPosePool() const;
+        AnimGraphPosePool& GetPosePool();
 
         MCORE_INLINE AnimGraphRefCountedDataPool& GetRefCountedDataPool()                  { return m_refCountedDataPool; }
         MCORE_INLINE const AnimGraphRefCountedDataPool& GetRefCountedDataPool() const      { return m_refCountedDataPool; }
 
+        /**
+         * Redirects the pose pool of a thread data to another pose pool for the calling thread while in scope.
+         * This is used to output independent parts of an anim graph in parallel, while each of them requests and frees poses from its own pool.
+         */
+        class EMFX_API ScopedPosePoolOverride
+        {
+        public:
+            ScopedPosePoolOverride(const ThreadData* threadData, AnimGraphPosePool* posePool);
+            ~ScopedPosePoolOverride();
+
+        private:
+            const ThreadData*   m_prevThreadData;
+            AnimGraphPosePool*  m_prevPosePool;
+        };
+
+        /**
+         * Check if a pose pool override is active on the calling thread.
+         * @result True in case the calling thread outputs a part of an anim graph in parallel to other threads.
+         */
+        static bool GetIsPosePoolOverridden();
+
     private:
         uint32                          m_threadIndex;
         AnimGraphPosePool              m_posePool;
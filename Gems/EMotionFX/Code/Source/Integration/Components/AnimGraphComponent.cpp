@@ -117,6 +117,7 @@ namespace EMotionFX
                     ->Field("ActiveMotionSetName", &Configuration::m_activeMotionSetName)
                     ->Field("ParameterDefaults", &Configuration::m_parameterDefaults)
                     ->Field("DebugVisualize", &Configuration::m_visualize)
+                    ->Field("ParallelOutput", &Configuration::m_parallelOutput)
                 ;
             }
         }
@@ -466,6 +467,7 @@ namespace EMotionFX
                 }
                 
                 m_animGraphInstance->SetVisualizationEnabled(cfg.m_visualize);
+                m_animGraphInstance->SetParallelOutputEnabled(cfg.m_parallelOutput);
 
                 m_actorInstance->SetAnimGraphInstance(m_animGraphInstance.get());
 
@@ -86,6 +86,7 @@ namespace EMotionFX
                 AZ::Data::Asset<MotionSetAsset>     m_motionSetAsset;           ///< Selected motion set asset.
                 AZStd::string                       m_activeMotionSetName;      ///< Selected motion set.
                 bool                                m_visualize = false;        ///< Debug visualization.
+                bool                                m_parallelOutput = false;   ///< Output independent blend tree subtrees in parallel.
                 ParameterDefaults                   m_parameterDefaults;        ///< Defaults for parameter values.
 
                 static void Reflect(AZ::ReflectContext* context);
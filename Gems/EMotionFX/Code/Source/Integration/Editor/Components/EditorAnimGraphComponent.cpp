@@ -41,6 +41,7 @@ namespace EMotionFX
                     ->Field("MotionSetAsset", &EditorAnimGraphComponent::m_motionSetAsset)
                     ->Field("ActiveMotionSetName", &EditorAnimGraphComponent::m_activeMotionSetName)
                     ->Field("DebugVisualization", &EditorAnimGraphComponent::m_visualize)
+                    ->Field("ParallelOutput", &EditorAnimGraphComponent::m_parallelOutput)
                     ->Field("ParameterDefaults", &EditorAnimGraphComponent::m_parameterDefaults)
                     ;
 
@@ -75,6 +76,7 @@ namespace EMotionFX
                         ->DataElement(AZ_CRC("MotionSetName", 0xcf534ea6), &EditorAnimGraphComponent::m_activeMotionSetName, "Active motion set", "Motion set to use for this anim graph instance")
                             ->Attribute(AZ_CRC("MotionSetAsset", 0xd4e88984), &EditorAnimGraphComponent::GetMotionAsset)
                         ->DataElement(AZ::Edit::UIHandlers::Default, &EditorAnimGraphComponent::m_visualize, "Debug visualization", "Enable this to allow the anim graph to render debug visualization. Enable debug rendering on anim graph nodes first.")
+                        ->DataElement(AZ::Edit::UIHandlers::Default, &EditorAnimGraphComponent::m_parallelOutput, "Parallel output", "Output independent subtrees of the blend trees in parallel. Only worth it for large anim graphs on characters that update on the main thread.")
                         ->DataElement(AZ::Edit::UIHandlers::Default, &EditorAnimGraphComponent::m_animGraphAsset,
                             "Anim graph", "EMotion FX anim graph to be assigned to this actor.")
                             ->Attribute(AZ::Edit::Attributes::ChangeNotify, &EditorAnimGraphComponent::OnAnimGraphAssetSelected)
@@ -380,6 +382,7 @@ namespace EMotionFX
             cfg.m_activeMotionSetName = m_activeMotionSetName;
             cfg.m_parameterDefaults = m_parameterDefaults;
             cfg.m_visualize = m_visualize;
+            cfg.m_parallelOutput = m_parallelOutput;
 
             gameEntity->AddComponent(aznew AnimGraphComponent(&cfg));
         }
@@ -99,6 +99,7 @@ namespace EMotionFX
             AZ::Data::Asset<MotionSetAsset>             m_motionSetAsset;       ///< Selected motion set asset.
             AZStd::string                               m_activeMotionSetName;  ///< Selected motion set.
             bool                                        m_visualize = false;    ///< Enable debug visualisation?
+            bool                                        m_parallelOutput = false; ///< Output independent blend tree subtrees in parallel?
             AnimGraphComponent::ParameterDefaults       m_parameterDefaults;    ///< AnimGraph parameter defaults.
         };
 
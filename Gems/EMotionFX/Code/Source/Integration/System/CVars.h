@@ -16,5 +16,9 @@ namespace EMotionFX::Integration
         static inline int emfx_updateEnabled = 1;
         static inline int emfx_ragdollManipulatorsEnabled = 1;
         static inline int emfx_actorRenderEnabled = 1;
+        static inline int emfx_updateBudgetEnabled = 0;
+        static inline float emfx_updateBudgetTimeInMs = 4.0f;
+        static inline float emfx_updateBudgetFullRateDistance = 10.0f;
+        static inline float emfx_updateBudgetMinSampleRate = 10.0f;
     };
 };
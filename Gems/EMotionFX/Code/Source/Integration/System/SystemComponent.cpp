@@ -18,6 +18,7 @@
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
 
 #include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/ActorUpdateScheduler.h>
 #include <EMotionFX/Source/SingleThreadScheduler.h>
 #include <EMotionFX/Source/EMotionFXManager.h>
 #include <EMotionFX/Source/AnimGraphManager.h>
@@ -62,6 +63,8 @@
 #include <AzFramework/Physics/Common/PhysicsTypes.h>
 
 #include <Integration/MotionExtractionBus.h>
+#include <Atom/RPI.Public/ViewportContext.h>
+#include <Atom/RPI.Public/ViewportContextBus.h>
 
 
 #if defined(EMOTIONFXANIMATION_EDITOR) // EMFX tools / editor includes
@@ -584,6 +587,18 @@ namespace EMotionFX
             REGISTER_CVAR2(
                 "emfx_ragdollManipulatorsEnabled", &CVars::emfx_ragdollManipulatorsEnabled, 1, VF_DEV_ONLY,
                 "Feature flag for in development ragdoll manipulators");
+            REGISTER_CVAR2(
+                "emfx_updateBudgetEnabled", &CVars::emfx_updateBudgetEnabled, 0, VF_NULL,
+                "Automatically lower the animation update rates of distant, invisible and unimportant actor instances");
+            REGISTER_CVAR2(
+                "emfx_updateBudgetTimeInMs", &CVars::emfx_updateBudgetTimeInMs, 4.0f, VF_NULL,
+                "Time budget for updating all actor instances per frame, in milliseconds. 0 disables the time budget");
+            REGISTER_CVAR2(
+                "emfx_updateBudgetFullRateDistance", &CVars::emfx_updateBudgetFullRateDistance, 10.0f, VF_NULL,
+                "Actor instances within this distance to the camera update at full rate");
+            REGISTER_CVAR2(
+                "emfx_updateBudgetMinSampleRate", &CVars::emfx_updateBudgetMinSampleRate, 10.0f, VF_NULL,
+                "Animation sample rate of the least significant actor instances, in samples per second");
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -591,12 +606,44 @@ namespace EMotionFX
         {
             gEnv->pConsole->UnregisterVariable("emfx_updateEnabled");
             gEnv->pConsole->UnregisterVariable("emfx_ragdollManipulatorsEnabled");
+            gEnv->pConsole->UnregisterVariable("emfx_updateBudgetEnabled");
+            gEnv->pConsole->UnregisterVariable("emfx_updateBudgetTimeInMs");
+            gEnv->pConsole->UnregisterVariable("emfx_updateBudgetFullRateDistance");
+            gEnv->pConsole->UnregisterVariable("emfx_updateBudgetMinSampleRate");
 
 #if !defined(AZ_MONOLITHIC_BUILD)
             gEnv = nullptr;
 #endif
         }
 
+        //////////////////////////////////////////////////////////////////////////
+        void SystemComponent::UpdateActorUpdateBudget()
+        {
+            ActorUpdateScheduler* scheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+            if (!scheduler || (!CVars::emfx_updateBudgetEnabled && !scheduler->GetUpdateBudget().m_enabled))
+            {
+                return;
+            }
+
+            ActorUpdateScheduler::UpdateBudget budget = scheduler->GetUpdateBudget();
+            budget.m_enabled = CVars::emfx_updateBudgetEnabled != 0;
+            budget.m_maxUpdateTimeInMs = CVars::emfx_updateBudgetTimeInMs;
+            budget.m_fullRateDistance = CVars::emfx_updateBudgetFullRateDistance;
+            budget.m_minSampleRate = CVars::emfx_updateBudgetMinSampleRate;
+            scheduler->SetUpdateBudget(budget);
+
+            // The significance of the actor instances depends on their distance to the camera of the default viewport.
+            auto viewportContextManager = AZ::Interface<AZ::RPI::ViewportContextRequestsInterface>::Get();
+            if (viewportContextManager)
+            {
+                AZ::RPI::ViewportContextPtr defaultViewportContext = viewportContextManager->GetDefaultViewportContext();
+                if (defaultViewportContext)
+                {
+                    scheduler->SetViewerPosition(defaultViewportContext->GetCameraTransform().GetTranslation());
+                }
+            }
+        }
+
         //////////////////////////////////////////////////////////////////////////
         void SystemComponent::OnTick(float delta, [[maybe_unused]]AZ::ScriptTimePoint timePoint)
         {
@@ -605,6 +652,8 @@ namespace EMotionFX
 
             if (CVars::emfx_updateEnabled)
             {
+                UpdateActorUpdateBudget();
+
                 // Main EMotionFX runtime update.
                 GetEMotionFX().Update(delta);
 
@@ -110,6 +110,9 @@ namespace EMotionFX
             void RegisterAssetTypesAndHandlers();
             void SetMediaRoot(const char* alias);
 
+            // Apply the update budget console settings and the camera position to the actor update scheduler.
+            void UpdateActorUpdateBudget();
+
 #if defined (EMOTIONFXANIMATION_EDITOR)
             void NotifyRegisterViews() override;
             bool IsSystemActive(EditorAnimationSystemRequests::AnimationSystem systemType) override;
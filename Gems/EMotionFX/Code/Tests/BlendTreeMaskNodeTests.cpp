@@ -201,6 +201,43 @@ namespace EMotionFX
             m_animGraphInstance = m_blendTreeAnimGraph->GetAnimGraphInstance(m_actorInstance, m_motionSet);
         }
 
+        void VerifyMaskedPose()
+        {
+            Skeleton* skeleton = m_actor->GetSkeleton();
+            const size_t numJoints = skeleton->GetNumNodes();
+            TransformData* transformData = m_actorInstance->GetTransformData();
+            Pose* pose = transformData->GetCurrentPose();
+
+            // Iterate through the joints and make sure their transforms originate according to the mask setup.
+            for (size_t jointIndex = 0; jointIndex < numJoints; jointIndex++)
+            {
+                const Node* joint = skeleton->GetNode(jointIndex);
+                const char* jointName = joint->GetName();
+                const Transform& transform = pose->GetModelSpaceTransform(jointIndex);
+
+                // The components of the position embed the origin.
+                // If the compareValue equals m_basePosePosValue, it originates from the base pose input.
+                // In case the joint is part of any of the masks and got overwriten by them, the compareValue represents the mask index.
+                const size_t compareValue = static_cast<size_t>(transform.m_position.GetX());
+
+                AZ::Outcome<size_t> maskIndex = FindMaskIndexForJoint(jointIndex);
+                if (maskIndex.IsSuccess())
+                {
+                    EXPECT_EQ(compareValue, maskIndex.GetValue())
+                        << "Joint '" << jointName << "' is part of mask " << maskIndex.GetValue()
+                        << " while the transform originated from input number " << compareValue
+                        << ".";
+                }
+                else
+                {
+                    EXPECT_EQ(compareValue, m_basePosePosValue)
+                        << "Joint '" << jointName << "' is not part of any mask while the transform "
+                        << "originated from input number " << compareValue << ". It should originate "
+                        << "from the base pose input.";
+                }
+            }
+        }
+
     public:
         AZStd::unique_ptr<OneBlendTreeNodeAnimGraph> m_blendTreeAnimGraph;
         BlendTreeMaskNode* m_maskNode = nullptr;
@@ -214,39 +251,27 @@ namespace EMotionFX
     TEST_P(BlendTreeMaskNodeTestFixture, MaskTests)
     {
         GetEMotionFX().Update(0.0f);
+        VerifyMaskedPose();
+    }
 
-        Skeleton* skeleton = m_actor->GetSkeleton();
-        const size_t numJoints = skeleton->GetNumNodes();
-        TransformData* transformData = m_actorInstance->GetTransformData();
-        Pose* pose = transformData->GetCurrentPose();
+    TEST_P(BlendTreeMaskNodeTestFixture, ParallelOutputMaskTests)
+    {
+        // The base pose and the mask inputs are independent subtrees, which get output in parallel.
+        m_animGraphInstance->SetParallelOutputEnabled(true);
+        GetEMotionFX().Update(0.0f);
+        VerifyMaskedPose();
 
-        // Iterate through the joints and make sure their transforms originate according to the mask setup.
-        for (size_t jointIndex = 0; jointIndex < numJoints; jointIndex++)
+        // The actor instances get updated by jobs, so this also checks that the subtrees get output as child jobs. Masks without joints
+        // are not used, so there is nothing to output in parallel with the base pose when all of them are empty.
+        const MaskNodeTestParam& param = GetParam();
+        const bool hasUsedMask = std::any_of(param.begin(), param.end(), [](const std::vector<std::string>& mask) { return !mask.empty(); });
+        if (hasUsedMask)
         {
-            const Node* joint = skeleton->GetNode(jointIndex);
-            const char* jointName = joint->GetName();
-            const Transform& transform = pose->GetModelSpaceTransform(jointIndex);
-
-            // The components of the position embed the origin.
-            // If the compareValue equals m_basePosePosValue, it originates from the base pose input.
-            // In case the joint is part of any of the masks and got overwriten by them, the compareValue represents the mask index.
-            const size_t compareValue = static_cast<size_t>(transform.m_position.GetX());
-
-            AZ::Outcome<size_t> maskIndex = FindMaskIndexForJoint(jointIndex);
-            if (maskIndex.IsSuccess())
-            {
-                EXPECT_EQ(compareValue, maskIndex.GetValue())
-                    << "Joint '" << jointName << "' is part of mask " << maskIndex.GetValue()
-                    << " while the transform originated from input number " << compareValue
-                    << ".";
-            }
-            else
-            {
-                EXPECT_EQ(compareValue, m_basePosePosValue)
-                    << "Joint '" << jointName << "' is not part of any mask while the transform "
-                    << "originated from input number " << compareValue << ". It should originate "
-                    << "from the base pose input.";
-            }
+            EXPECT_GT(m_animGraphInstance->GetNumParallelOutputs(), 0);
+        }
+        else
+        {
+            EXPECT_EQ(m_animGraphInstance->GetNumParallelOutputs(), 0);
         }
     }
 
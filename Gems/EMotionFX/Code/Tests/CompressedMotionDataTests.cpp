@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/Algorithms.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Pose.h>
+#include <MCore/Source/MemoryFile.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+namespace EMotionFX
+{
+    using CompressedMotionDataTests = SystemComponentFixture;
+
+    // Joint 0 moves linearly along x, joint 1 rotates around z and keeps its position, the morph ramps up and down.
+    static void CreateSourceMotionData(NonUniformMotionData& motionData, size_t numSamples)
+    {
+        motionData.Resize(2, 1, 0);
+        motionData.SetJointName(0, "root");
+        motionData.SetJointName(1, "spine");
+        motionData.SetMorphName(0, "smile");
+
+        motionData.AllocateJointPositionSamples(0, numSamples);
+        motionData.AllocateJointPositionSamples(1, numSamples);
+        motionData.AllocateJointRotationSamples(1, numSamples);
+        motionData.AllocateMorphSamples(0, numSamples);
+        for (size_t s = 0; s < numSamples; ++s)
+        {
+            const float time = s / 30.0f;
+            motionData.SetJointPositionSample(0, s, { time, AZ::Vector3(time * 2.0f, 0.0f, 1.0f) });
+            motionData.SetJointPositionSample(1, s, { time, AZ::Vector3(0.0f, 0.5f, 0.0f) });
+            motionData.SetJointRotationSample(1, s, { time, AZ::Quaternion::CreateRotationZ(AZStd::sin(time * 3.0f)) });
+            motionData.SetMorphSample(0, s, { time, AZStd::abs(AZStd::sin(time)) });
+        }
+        motionData.SetSampleRate(30.0f);
+        motionData.UpdateDuration();
+    }
+
+    // The rotation tolerance is in degrees.
+    static void ExpectSamplesNear(const MotionData& motionData, const NonUniformMotionData& sourceData, float tolerance, float rotationTolerance)
+    {
+        for (float time = 0.0f; time <= sourceData.GetDuration(); time += 0.01f)
+        {
+            for (size_t i = 0; i < sourceData.GetNumJoints(); ++i)
+            {
+                const Transform expected = sourceData.SampleJointTransform(time, i);
+                const Transform result = motionData.SampleJointTransform(time, i);
+                EXPECT_TRUE(IsClose<AZ::Vector3>(result.m_position, expected.m_position, tolerance));
+                EXPECT_TRUE(IsClose<AZ::Quaternion>(result.m_rotation, expected.m_rotation, rotationTolerance));
+            }
+            EXPECT_NEAR(motionData.SampleMorph(time, 0), sourceData.SampleMorph(time, 0), tolerance);
+        }
+    }
+
+    TEST_F(CompressedMotionDataTests, InitFromNonUniformData)
+    {
+        NonUniformMotionData sourceData;
+        CreateSourceMotionData(sourceData, 61);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, /*keepSameSampleRate=*/true, 30.0f, /*updateDuration=*/true);
+        EXPECT_FLOAT_EQ(motionData.GetDuration(), sourceData.GetDuration());
+        EXPECT_EQ(motionData.GetNumJoints(), 2);
+        EXPECT_EQ(motionData.GetNumMorphs(), 1);
+
+        // The constant position of the second joint ends up as static value.
+        EXPECT_TRUE(motionData.IsJointPositionAnimated(0));
+        EXPECT_FALSE(motionData.IsJointRotationAnimated(0));
+        EXPECT_FALSE(motionData.IsJointPositionAnimated(1));
+        EXPECT_TRUE(motionData.IsJointRotationAnimated(1));
+        EXPECT_TRUE(motionData.IsMorphAnimated(0));
+        EXPECT_TRUE(IsClose<AZ::Vector3>(motionData.GetJointStaticPosition(1), AZ::Vector3(0.0f, 0.5f, 0.0f), 0.0001f));
+
+        ExpectSamplesNear(motionData, sourceData, 0.01f, 0.05f);
+    }
+
+    TEST_F(CompressedMotionDataTests, OptimizeRemovesKeys)
+    {
+        NonUniformMotionData sourceData;
+        CreateSourceMotionData(sourceData, 61);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, /*keepSameSampleRate=*/true, 30.0f, /*updateDuration=*/true);
+        const size_t numKeysBefore = motionData.GetNumKeys();
+        EXPECT_GT(numKeysBefore, 2);
+
+        MotionData::OptimizeSettings settings;
+        settings.m_maxPosError = 0.01f;
+        settings.m_maxRotError = 0.5f;
+        settings.m_maxMorphError = 0.01f;
+        motionData.Optimize(settings);
+        EXPECT_LT(motionData.GetNumKeys(), numKeysBefore);
+        for (size_t i = 0; i < motionData.GetNumJoints(); ++i)
+        {
+            if (motionData.IsJointAnimated(i))
+            {
+                EXPECT_FLOAT_EQ(motionData.GetJointKeyTime(i, 0), 0.0f);
+                EXPECT_FLOAT_EQ(motionData.GetJointKeyTime(i, motionData.GetNumJointKeys(i) - 1), sourceData.GetDuration());
+            }
+        }
+
+        ExpectSamplesNear(motionData, sourceData, 0.02f, 0.6f);
+    }
+
+    TEST_F(CompressedMotionDataTests, OptimizePicksKeysPerJoint)
+    {
+        NonUniformMotionData sourceData;
+        CreateSourceMotionData(sourceData, 61);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, /*keepSameSampleRate=*/true, 30.0f, /*updateDuration=*/true);
+        MotionData::OptimizeSettings settings;
+        motionData.Optimize(settings);
+
+        // The linear motion of the first joint doesn't need the keys of the rotating second joint.
+        EXPECT_EQ(motionData.GetNumJointKeys(0), 2);
+        EXPECT_GT(motionData.GetNumJointKeys(1), 2);
+        EXPECT_TRUE(IsClose<AZ::Vector3>(motionData.SampleJointPosition(0.5f, 0), sourceData.SampleJointPosition(0.5f, 0), settings.m_maxPosError));
+    }
+
+    TEST_F(CompressedMotionDataTests, OptimizeLinearMotion)
+    {
+        NonUniformMotionData sourceData;
+        sourceData.Resize(1, 0, 0);
+        sourceData.AllocateJointPositionSamples(0, 31);
+        for (size_t s = 0; s < 31; ++s)
+        {
+            const float time = s / 30.0f;
+            sourceData.SetJointPositionSample(0, s, { time, AZ::Vector3(time, -time, 2.0f * time) });
+        }
+        sourceData.UpdateDuration();
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, /*keepSameSampleRate=*/true, 30.0f, /*updateDuration=*/true);
+        MotionData::OptimizeSettings settings;
+        motionData.Optimize(settings);
+        EXPECT_EQ(motionData.GetNumKeys(), 2);
+        EXPECT_TRUE(IsClose<AZ::Vector3>(motionData.SampleJointPosition(0.5f, 0), AZ::Vector3(0.5f, -0.5f, 1.0f), 0.001f));
+    }
+
+    TEST_F(CompressedMotionDataTests, OptimizeMeasuresQuantizedError)
+    {
+        // The quantization step of this range is larger than the allowed error, so interpolating the quantized keys can exceed it.
+        NonUniformMotionData sourceData;
+        sourceData.Resize(1, 0, 0);
+        sourceData.AllocateJointPositionSamples(0, 31);
+        for (size_t s = 0; s < 31; ++s)
+        {
+            const float time = s / 30.0f;
+            sourceData.SetJointPositionSample(0, s, { time, AZ::Vector3(1000.0f * time, 0.0f, 0.0f) });
+        }
+        sourceData.UpdateDuration();
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, /*keepSameSampleRate=*/true, 30.0f, /*updateDuration=*/true);
+        MotionData::OptimizeSettings settings;
+        motionData.Optimize(settings);
+        EXPECT_GT(motionData.GetNumJointKeys(0), 2);
+
+        // Every sample that got removed is still within the error after quantization.
+        size_t keyIndex = 0;
+        for (size_t s = 0; s < 31; ++s)
+        {
+            const float time = s / 30.0f;
+            if (keyIndex < motionData.GetNumJointKeys(0) && AZ::IsClose(motionData.GetJointKeyTime(0, keyIndex), time, 0.00001f))
+            {
+                ++keyIndex;
+                continue;
+            }
+            EXPECT_TRUE(IsClose<AZ::Vector3>(motionData.SampleJointPosition(time, 0), sourceData.SampleJointPosition(time, 0), settings.m_maxPosError));
+        }
+    }
+
+    TEST_F(CompressedMotionDataTests, OptimizeReleasesSourceData)
+    {
+        NonUniformMotionData sourceData;
+        CreateSourceMotionData(sourceData, 61);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, /*keepSameSampleRate=*/true, 30.0f, /*updateDuration=*/true);
+        const size_t numKeysBefore = motionData.GetNumKeys();
+
+        MotionData::OptimizeSettings coarseSettings;
+        coarseSettings.m_maxPosError = 0.1f;
+        coarseSettings.m_maxRotError = 5.0f;
+        coarseSettings.m_maxMorphError = 0.1f;
+        motionData.Optimize(coarseSettings);
+        const size_t numCoarseKeys = motionData.GetNumKeys();
+        EXPECT_LT(numCoarseKeys, numKeysBefore);
+
+        // Optimizing again works from the coarse keys, so a smaller error can't bring back keys that aren't in any of the groups.
+        MotionData::OptimizeSettings fineSettings;
+        fineSettings.m_maxPosError = 0.001f;
+        fineSettings.m_maxRotError = 0.05f;
+        fineSettings.m_maxMorphError = 0.001f;
+        motionData.Optimize(fineSettings);
+        EXPECT_LE(motionData.GetNumJointKeys(1), numCoarseKeys);
+        ExpectSamplesNear(motionData, sourceData, 0.11f, 5.5f);
+
+        // Edits keep working from the compressed data.
+        motionData.RemoveJoint(0);
+        ASSERT_EQ(motionData.GetNumJoints(), 1);
+        EXPECT_TRUE(IsClose<AZ::Quaternion>(motionData.SampleJointRotation(0.5f, 0), sourceData.SampleJointRotation(0.5f, 1), 5.5f));
+    }
+
+    TEST_F(CompressedMotionDataTests, SamplePoseMatchesJointSampling)
+    {
+        NonUniformMotionData sourceData;
+        CreateSourceMotionData(sourceData, 61);
+        sourceData.SetJointName(0, "rootJoint");
+        sourceData.SetJointName(1, "joint1");
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, /*keepSameSampleRate=*/true, 30.0f, /*updateDuration=*/true);
+        MotionData::OptimizeSettings settings;
+        motionData.Optimize(settings);
+
+        // The last joint isn't in the motion, so it samples the bind pose.
+        AZStd::unique_ptr<Actor> actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(3);
+        ActorInstance* actorInstance = ActorInstance::Create(actor.get());
+
+        Pose pose;
+        pose.LinkToActorInstance(actorInstance);
+        for (float time = 0.0f; time <= motionData.GetDuration(); time += 0.05f)
+        {
+            MotionDataSampleSettings sampleSettings;
+            sampleSettings.m_actorInstance = actorInstance;
+            sampleSettings.m_sampleTime = time;
+            motionData.SamplePose(sampleSettings, &pose);
+
+            for (size_t i = 0; i < actor->GetNumNodes(); ++i)
+            {
+                const Transform expected = motionData.SampleJointTransform(sampleSettings, i);
+                const Transform& result = pose.GetLocalSpaceTransform(i);
+                EXPECT_TRUE(IsClose<AZ::Vector3>(result.m_position, expected.m_position, 0.00001f));
+                EXPECT_TRUE(IsClose<AZ::Quaternion>(result.m_rotation, expected.m_rotation, 0.001f));
+#ifndef EMFX_SCALE_DISABLED
+                EXPECT_TRUE(IsClose<AZ::Vector3>(result.m_scale, expected.m_scale, 0.00001f));
+#endif
+            }
+        }
+
+        actorInstance->Destroy();
+    }
+
+    TEST_F(CompressedMotionDataTests, RemoveJoint)
+    {
+        NonUniformMotionData sourceData;
+        CreateSourceMotionData(sourceData, 31);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, /*keepSameSampleRate=*/true, 30.0f, /*updateDuration=*/true);
+        motionData.RemoveJoint(0);
+        ASSERT_EQ(motionData.GetNumJoints(), 1);
+        EXPECT_EQ(motionData.GetJointName(0), "spine");
+        EXPECT_TRUE(motionData.IsJointRotationAnimated(0));
+        EXPECT_TRUE(IsClose<AZ::Quaternion>(motionData.SampleJointRotation(0.5f, 0), sourceData.SampleJointRotation(0.5f, 1), 0.05f));
+        EXPECT_NEAR(motionData.SampleMorph(0.5f, 0), sourceData.SampleMorph(0.5f, 0), 0.01f);
+    }
+
+    TEST_F(CompressedMotionDataTests, SaveAndRead)
+    {
+        NonUniformMotionData sourceData;
+        CreateSourceMotionData(sourceData, 61);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, /*keepSameSampleRate=*/true, 30.0f, /*updateDuration=*/true);
+
+        MCore::MemoryFile memoryFile;
+        memoryFile.Open();
+        MotionData::SaveSettings saveSettings;
+        ASSERT_TRUE(motionData.Save(&memoryFile, saveSettings));
+        EXPECT_EQ(memoryFile.GetFileSize(), motionData.CalcStreamSaveSizeInBytes(saveSettings));
+
+        memoryFile.Seek(0);
+        CompressedMotionData loadedData;
+        MotionData::ReadSettings readSettings;
+        readSettings.m_version = motionData.GetStreamSaveVersion();
+        ASSERT_TRUE(loadedData.Read(&memoryFile, readSettings));
+        EXPECT_EQ(loadedData.GetNumJoints(), motionData.GetNumJoints());
+        EXPECT_EQ(loadedData.GetNumMorphs(), motionData.GetNumMorphs());
+        EXPECT_EQ(loadedData.GetNumKeys(), motionData.GetNumKeys());
+        EXPECT_EQ(loadedData.GetMorphName(0), "smile");
+        EXPECT_FLOAT_EQ(loadedData.GetDuration(), motionData.GetDuration());
+
+        ExpectSamplesNear(loadedData, sourceData, 0.01f, 0.05f);
+    }
+
+    TEST_F(CompressedMotionDataTests, ReadRejectsKeyGroupWithoutKeys)
+    {
+        NonUniformMotionData sourceData;
+        CreateSourceMotionData(sourceData, 31);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, /*keepSameSampleRate=*/true, 30.0f, /*updateDuration=*/true);
+
+        MCore::MemoryFile memoryFile;
+        memoryFile.Open();
+        MotionData::SaveSettings saveSettings;
+        ASSERT_TRUE(motionData.Save(&memoryFile, saveSettings));
+
+        // The key count of the first key group directly follows the info header, which holds four counts and the sample rate.
+        const AZ::u32 numKeys = 0;
+        memoryFile.Seek(4 * sizeof(AZ::u32) + sizeof(float));
+        memoryFile.Write(&numKeys, sizeof(numKeys));
+
+        memoryFile.Seek(0);
+        CompressedMotionData loadedData;
+        MotionData::ReadSettings readSettings;
+        readSettings.m_version = motionData.GetStreamSaveVersion();
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(loadedData.Read(&memoryFile, readSettings));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+} // namespace EMotionFX
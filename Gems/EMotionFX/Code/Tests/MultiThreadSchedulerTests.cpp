@@ -44,4 +44,48 @@ namespace EMotionFX
 
         actorInstance->Destroy();
     }
+
+    TEST_F(SystemComponentFixture, UpdateBudgetLowersSampleRateWithDistance)
+    {
+        ActorUpdateScheduler* scheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+
+        AZStd::unique_ptr<JackNoMeshesActor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        ActorInstance* nearActorInstance = ActorInstance::Create(actor.get());
+        ActorInstance* farActorInstance = ActorInstance::Create(actor.get());
+        ActorInstance* importantActorInstance = ActorInstance::Create(actor.get());
+        farActorInstance->SetLocalSpacePosition(AZ::Vector3(100.0f, 0.0f, 0.0f));
+        importantActorInstance->SetLocalSpacePosition(AZ::Vector3(100.0f, 0.0f, 0.0f));
+        importantActorInstance->SetUpdateImportance(10.0f);
+
+        ActorUpdateScheduler::UpdateBudget budget;
+        budget.m_enabled = true;
+        budget.m_maxUpdateTimeInMs = 0.0f;
+        budget.m_fullRateDistance = 10.0f;
+        budget.m_minSampleRate = 10.0f;
+        scheduler->SetUpdateBudget(budget);
+        scheduler->SetViewerPosition(AZ::Vector3::CreateZero());
+
+        // The significance is based on the world transforms of the last update.
+        GetEMotionFX().Update(0.0f);
+        GetEMotionFX().Update(0.0f);
+
+        EXPECT_FLOAT_EQ(nearActorInstance->GetUpdateSignificance(), 1.0f);
+        EXPECT_FLOAT_EQ(nearActorInstance->GetMotionSamplingRate(), 0.0f);
+        EXPECT_FLOAT_EQ(farActorInstance->GetUpdateSignificance(), 0.1f);
+        EXPECT_NEAR(farActorInstance->GetMotionSamplingRate(), 0.09f, 0.0001f);
+        EXPECT_TRUE(farActorInstance->GetPoseInterpolationEnabled());
+        EXPECT_FLOAT_EQ(importantActorInstance->GetUpdateSignificance(), 1.0f);
+        EXPECT_FLOAT_EQ(importantActorInstance->GetMotionSamplingRate(), 0.0f);
+
+        // Disabling the budget hands the actor instances back to full rate.
+        budget.m_enabled = false;
+        scheduler->SetUpdateBudget(budget);
+        EXPECT_FLOAT_EQ(farActorInstance->GetUpdateSignificance(), 1.0f);
+        EXPECT_FLOAT_EQ(farActorInstance->GetMotionSamplingRate(), 0.0f);
+        EXPECT_FALSE(farActorInstance->GetPoseInterpolationEnabled());
+
+        nearActorInstance->Destroy();
+        farActorInstance->Destroy();
+        importantActorInstance->Destroy();
+    }
 } // namespace EMotionFX
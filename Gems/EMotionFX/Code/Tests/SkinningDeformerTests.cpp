@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+#include <EMotionFX/Source/DualQuatSkinDeformer.h>
+#include <EMotionFX/Source/Mesh.h>
+#include <EMotionFX/Source/SkinInfluenceStream.h>
+#include <EMotionFX/Source/SkinningInfoVertexAttributeLayer.h>
+#include <EMotionFX/Source/SoftSkinDeformer.h>
+#include <EMotionFX/Source/VertexAttributeLayerAbstractData.h>
+#include <MCore/Source/AzCoreConversions.h>
+#include <MCore/Source/DualQuaternion.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/MeshFactory.h>
+
+namespace EMotionFX
+{
+    // Exposes the skinning internals of the deformers, so they can be compared against a reference implementation.
+    class TestSoftSkinDeformer
+        : public SoftSkinDeformer
+    {
+    public:
+        explicit TestSoftSkinDeformer(Mesh* mesh)
+            : SoftSkinDeformer(mesh)
+        {
+        }
+
+        using SoftSkinDeformer::m_boneMatrices;
+        using SoftSkinDeformer::m_influences;
+        using SoftSkinDeformer::SkinVertexRange;
+    };
+
+    class TestDualQuatSkinDeformer
+        : public DualQuatSkinDeformer
+    {
+    public:
+        explicit TestDualQuatSkinDeformer(Mesh* mesh)
+            : DualQuatSkinDeformer(mesh)
+        {
+        }
+
+        void SetBoneTransform(size_t boneIndex, const AZ::Quaternion& rotation, const AZ::Vector3& translation)
+        {
+            m_bones[boneIndex].m_dualQuat.FromRotationTranslation(rotation, translation);
+        }
+
+        const MCore::DualQuaternion& GetBoneDualQuat(size_t boneIndex) const
+        {
+            return m_bones[boneIndex].m_dualQuat;
+        }
+
+        const SkinInfluenceStream& GetInfluences() const
+        {
+            return m_influences;
+        }
+
+        void Skin()
+        {
+            SkinRange(m_mesh, 0, m_mesh->GetNumVertices(), m_bones, m_influences);
+        }
+    };
+
+    // The parameter is the largest number of influences per vertex, the vertices use any count from zero up to it.
+    class SkinningDeformerTests
+        : public SystemComponentFixture
+        , public ::testing::WithParamInterface<size_t>
+    {
+    public:
+        static constexpr size_t s_numJoints = 6;
+        static constexpr AZ::u32 s_numVertices = 30;
+
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            AZ::SimpleLcgRandom random(1234);
+            auto randomVector = [&random]()
+            {
+                return AZ::Vector3(random.GetRandomFloat() * 2.0f - 1.0f, random.GetRandomFloat() * 2.0f - 1.0f, random.GetRandomFloat() * 2.0f - 1.0f);
+            };
+
+            const size_t maxInfluences = GetParam();
+            AZStd::vector<AZ::u32> indices(s_numVertices);
+            AZStd::vector<AZ::Vector3> positions(s_numVertices);
+            AZStd::vector<AZ::Vector3> normals(s_numVertices);
+            AZStd::vector<MeshFactory::VertexSkinInfluences> skinningInfo(s_numVertices);
+            for (AZ::u32 v = 0; v < s_numVertices; ++v)
+            {
+                indices[v] = v;
+                positions[v] = randomVector() * 10.0f;
+                normals[v] = randomVector().GetNormalizedSafe();
+
+                // Every vertex uses a different number of influences, some of which have a weight of zero.
+                const size_t numInfluences = v % (maxInfluences + 1);
+                float totalWeight = 0.0f;
+                for (size_t i = 0; i < numInfluences; ++i)
+                {
+                    const bool zeroWeight = (numInfluences > 1 && i == numInfluences - 1 && v % 3 == 0);
+                    const float weight = zeroWeight ? 0.0f : 0.1f + random.GetRandomFloat();
+                    skinningInfo[v].emplace_back((v + i) % s_numJoints, weight);
+                    totalWeight += weight;
+                }
+                for (MeshFactory::SkinInfluence& influence : skinningInfo[v])
+                {
+                    AZStd::get<1>(influence) /= totalWeight;
+                }
+            }
+
+            m_mesh = MeshFactory::Create(indices, positions, normals, {}, skinningInfo);
+
+            AZStd::vector<AZ::Vector4> tangents(s_numVertices);
+            AZStd::vector<AZ::Vector3> bitangents(s_numVertices);
+            for (AZ::u32 v = 0; v < s_numVertices; ++v)
+            {
+                tangents[v] = AZ::Vector4::CreateFromVector3AndFloat(randomVector().GetNormalizedSafe(), (v % 2) ? 1.0f : -1.0f);
+                bitangents[v] = randomVector().GetNormalizedSafe();
+            }
+            AddVertexLayer(Mesh::ATTRIB_TANGENTS, tangents);
+            AddVertexLayer(Mesh::ATTRIB_BITANGENTS, bitangents);
+
+            // Flip the sign of some rotations, which describes the same rotation and has to be handled by the dual quaternion blending.
+            for (size_t i = 0; i < s_numJoints; ++i)
+            {
+                const AZ::Quaternion rotation = AZ::Quaternion::CreateFromAxisAngle(randomVector().GetNormalizedSafe(), random.GetRandomFloat() * 3.0f);
+                m_jointRotations.emplace_back((i % 2) ? -rotation : rotation);
+                m_jointTranslations.emplace_back(randomVector() * 5.0f);
+            }
+        }
+
+        void TearDown() override
+        {
+            m_mesh->Destroy();
+            SystemComponentFixture::TearDown();
+        }
+
+        template <class T>
+        void AddVertexLayer(AZ::u32 attribute, const AZStd::vector<T>& values)
+        {
+            VertexAttributeLayerAbstractData* layer = VertexAttributeLayerAbstractData::Create(s_numVertices, attribute, sizeof(T), true);
+            m_mesh->AddVertexAttributeLayer(layer);
+            AZStd::copy(values.begin(), values.end(), static_cast<T*>(layer->GetOriginalData()));
+            layer->ResetToOriginalData();
+        }
+
+        SkinningInfoVertexAttributeLayer* GetSkinningLayer() const
+        {
+            return static_cast<SkinningInfoVertexAttributeLayer*>(m_mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID));
+        }
+
+        const AZ::Vector3* GetOriginalPositions() const { return static_cast<const AZ::Vector3*>(m_mesh->FindOriginalVertexData(Mesh::ATTRIB_POSITIONS)); }
+        const AZ::Vector3* GetOriginalNormals() const { return static_cast<const AZ::Vector3*>(m_mesh->FindOriginalVertexData(Mesh::ATTRIB_NORMALS)); }
+        const AZ::Vector4* GetOriginalTangents() const { return static_cast<const AZ::Vector4*>(m_mesh->FindOriginalVertexData(Mesh::ATTRIB_TANGENTS)); }
+        const AZ::Vector3* GetOriginalBitangents() const { return static_cast<const AZ::Vector3*>(m_mesh->FindOriginalVertexData(Mesh::ATTRIB_BITANGENTS)); }
+
+        void ExpectSkinnedVertex(AZ::u32 vertex, const AZ::Vector3& position, const AZ::Vector3& normal, const AZ::Vector4& tangent, const AZ::Vector3& bitangent) const
+        {
+            const AZ::Vector3* positions = static_cast<const AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+            const AZ::Vector3* normals = static_cast<const AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
+            const AZ::Vector4* tangents = static_cast<const AZ::Vector4*>(m_mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
+            const AZ::Vector3* bitangents = static_cast<const AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
+
+            EXPECT_TRUE(positions[vertex].IsClose(position, 0.001f)) << "Vertex " << vertex;
+            EXPECT_TRUE(normals[vertex].IsClose(normal, 0.0001f)) << "Vertex " << vertex;
+            EXPECT_TRUE(tangents[vertex].IsClose(tangent, 0.0001f)) << "Vertex " << vertex;
+            EXPECT_TRUE(bitangents[vertex].IsClose(bitangent, 0.0001f)) << "Vertex " << vertex;
+        }
+
+        Mesh* m_mesh = nullptr;
+        AZStd::vector<AZ::Quaternion> m_jointRotations;
+        AZStd::vector<AZ::Vector3> m_jointTranslations;
+    };
+
+    TEST_P(SkinningDeformerTests, InfluenceStreamIsSortedAndPadded)
+    {
+        TestSoftSkinDeformer deformer(m_mesh);
+        deformer.Reinitialize(nullptr, nullptr, 0, static_cast<uint16>(s_numJoints - 1));
+
+        const SkinInfluenceStream& stream = deformer.m_influences;
+        const size_t maxInfluences = GetParam();
+        ASSERT_EQ(stream.GetNumInfluencesPerVertex(), maxInfluences);
+
+        const SkinningInfoVertexAttributeLayer* layer = GetSkinningLayer();
+        for (AZ::u32 v = 0; v < s_numVertices; ++v)
+        {
+            const AZ::u16* boneNumbers = stream.GetBoneNumbers(v);
+            const float* weights = stream.GetWeights(v);
+            const size_t numInfluences = layer->GetNumInfluences(v);
+
+            // The weights are sorted, the padded influences have a weight of zero and use the bone of the first influence.
+            float totalWeight = 0.0f;
+            for (size_t i = 0; i < maxInfluences; ++i)
+            {
+                if (i > 0)
+                {
+                    EXPECT_GE(weights[i - 1], weights[i]);
+                }
+                if (i >= numInfluences)
+                {
+                    EXPECT_EQ(weights[i], 0.0f);
+                    EXPECT_EQ(boneNumbers[i], boneNumbers[0]);
+                }
+                totalWeight += weights[i];
+            }
+            EXPECT_NEAR(totalWeight, (numInfluences > 0) ? 1.0f : 0.0f, 0.0001f);
+
+            // Every influence of the layer ends up in the stream with the same weight.
+            for (size_t i = 0; i < numInfluences; ++i)
+            {
+                const SkinInfluence* influence = layer->GetInfluence(v, i);
+                bool found = false;
+                for (size_t j = 0; j < numInfluences && !found; ++j)
+                {
+                    found = (boneNumbers[j] == influence->GetBoneNr() && weights[j] == influence->GetWeight());
+                }
+                EXPECT_TRUE(found) << "Vertex " << v << " influence " << i;
+            }
+        }
+    }
+
+    TEST_P(SkinningDeformerTests, SoftSkinMatchesReference)
+    {
+        TestSoftSkinDeformer deformer(m_mesh);
+        deformer.Reinitialize(nullptr, nullptr, 0, static_cast<uint16>(s_numJoints - 1));
+        for (size_t i = 0; i < deformer.GetNumLocalBones(); ++i)
+        {
+            const size_t joint = deformer.GetLocalBone(i);
+            deformer.m_boneMatrices[i] = AZ::Matrix3x4::CreateFromQuaternionAndTranslation(m_jointRotations[joint], m_jointTranslations[joint]);
+        }
+
+        deformer.SkinVertexRange(0, s_numVertices,
+            static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS)),
+            static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_NORMALS)),
+            static_cast<AZ::Vector4*>(m_mesh->FindVertexData(Mesh::ATTRIB_TANGENTS)),
+            static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS)));
+
+        // Skin every influence of the layer separately and accumulate the results.
+        const SkinningInfoVertexAttributeLayer* layer = GetSkinningLayer();
+        for (AZ::u32 v = 0; v < s_numVertices; ++v)
+        {
+            AZ::Vector3 position = AZ::Vector3::CreateZero();
+            AZ::Vector3 normal = AZ::Vector3::CreateZero();
+            AZ::Vector4 tangent = AZ::Vector4::CreateZero();
+            AZ::Vector3 bitangent = AZ::Vector3::CreateZero();
+            for (size_t i = 0; i < layer->GetNumInfluences(v); ++i)
+            {
+                const SkinInfluence* influence = layer->GetInfluence(v, i);
+                MCore::Skin(deformer.m_boneMatrices[influence->GetBoneNr()], &GetOriginalPositions()[v], &GetOriginalNormals()[v], &GetOriginalTangents()[v],
+                    &GetOriginalBitangents()[v], &position, &normal, &tangent, &bitangent, influence->GetWeight());
+            }
+            tangent.SetW(GetOriginalTangents()[v].GetW());
+
+            ExpectSkinnedVertex(v, position, normal, tangent, bitangent);
+        }
+    }
+
+    TEST_P(SkinningDeformerTests, DualQuatSkinMatchesReference)
+    {
+        TestDualQuatSkinDeformer deformer(m_mesh);
+        deformer.Reinitialize(nullptr, nullptr, 0, static_cast<uint16>(s_numJoints - 1));
+        ASSERT_EQ(deformer.GetInfluences().GetNumInfluencesPerVertex(), GetParam());
+        for (size_t i = 0; i < deformer.GetNumLocalBones(); ++i)
+        {
+            const size_t joint = deformer.GetLocalBone(i);
+            deformer.SetBoneTransform(i, m_jointRotations[joint], m_jointTranslations[joint]);
+        }
+
+        deformer.Skin();
+
+        // Blend the dual quaternions in the order of the layer, using the first influence as pivot.
+        const SkinningInfoVertexAttributeLayer* layer = GetSkinningLayer();
+        for (AZ::u32 v = 0; v < s_numVertices; ++v)
+        {
+            const size_t numInfluences = layer->GetNumInfluences(v);
+            if (numInfluences == 0)
+            {
+                ExpectSkinnedVertex(v, GetOriginalPositions()[v], GetOriginalNormals()[v], GetOriginalTangents()[v], GetOriginalBitangents()[v]);
+                continue;
+            }
+
+            const MCore::DualQuaternion& pivotQuat = deformer.GetBoneDualQuat(layer->GetInfluence(v, 0)->GetBoneNr());
+            MCore::DualQuaternion skinQuat(AZ::Quaternion(0.0f, 0.0f, 0.0f, 0.0f), AZ::Quaternion(0.0f, 0.0f, 0.0f, 0.0f));
+            for (size_t i = 0; i < numInfluences; ++i)
+            {
+                const SkinInfluence* influence = layer->GetInfluence(v, i);
+                MCore::DualQuaternion influenceQuat = deformer.GetBoneDualQuat(influence->GetBoneNr());
+                if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
+                {
+                    influenceQuat *= -1.0f;
+                }
+                skinQuat += influenceQuat * influence->GetWeight();
+            }
+            skinQuat.Normalize();
+
+            const AZ::Vector4& orgTangent = GetOriginalTangents()[v];
+            ExpectSkinnedVertex(v,
+                skinQuat.TransformPoint(GetOriginalPositions()[v]),
+                skinQuat.TransformVector(GetOriginalNormals()[v]),
+                AZ::Vector4::CreateFromVector3AndFloat(skinQuat.TransformVector(orgTangent.GetAsVector3()), orgTangent.GetW()),
+                skinQuat.TransformVector(GetOriginalBitangents()[v]));
+        }
+    }
+
+    INSTANTIATE_TEST_CASE_P(SkinningDeformerTests, SkinningDeformerTests, ::testing::Values(1, 3, 5));
+} // namespace EMotionFX
@@ -6,8 +6,10 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 #include <EMotionFX/Source/AnimGraph.h>
@@ -26,6 +28,8 @@
 
 namespace EMotionFX::MotionMatching
 {
+    AZ_CVAR_EXTERNED(bool, mm_batchedSearch);
+
     AZ_CLASS_ALLOCATOR_IMPL(BlendTreeMotionMatchNode, AnimGraphAllocator, 0)
     AZ_CLASS_ALLOCATOR_IMPL(BlendTreeMotionMatchNode::UniqueData, AnimGraphObjectUniqueDataAllocator, 0)
 
@@ -109,9 +113,8 @@ namespace EMotionFX::MotionMatching
 
         // Clear existing data.
         delete m_instance;
-        delete m_data;
+        m_data.reset();
 
-        m_data = aznew MotionMatching::MotionMatchingData(animGraphNode->m_featureSchema);
         m_instance = aznew MotionMatching::MotionMatchingInstance();
 
         MotionSet* motionSet = m_animGraphInstance->GetMotionSet();
@@ -121,6 +124,51 @@ namespace EMotionFX::MotionMatching
             return;
         }
 
+        m_data = animGraphNode->FindOrCreateData(actorInstance, motionSet);
+        if (!m_data)
+        {
+            SetHasError(true);
+            return;
+        }
+
+        // Initialize the instance.
+        AZ_Printf("Motion Matching", "Initializing instance...");
+        MotionMatching::MotionMatchingInstance::InitSettings initSettings;
+        initSettings.m_actorInstance = actorInstance;
+        initSettings.m_data = m_data.get();
+        m_instance->Init(initSettings);
+
+        SetHasError(false);
+    }
+
+    AZStd::shared_ptr<MotionMatchingData> BlendTreeMotionMatchNode::FindOrCreateData(ActorInstance* actorInstance, MotionSet* motionSet)
+    {
+        // Unique datas of different anim graph instances can be updated in parallel.
+        AZStd::scoped_lock lock(m_sharedDataMutex);
+
+        // Sharing the motion matching data is only needed to batch the searches, otherwise every instance keeps its own copy.
+        const bool shareData = mm_batchedSearch;
+        const Actor* actor = actorInstance->GetActor();
+        m_sharedDatas.erase(AZStd::remove_if(m_sharedDatas.begin(), m_sharedDatas.end(),
+            [](const SharedData& sharedData)
+            {
+                return sharedData.m_data.expired();
+            }),
+            m_sharedDatas.end());
+        if (shareData)
+        {
+            for (const SharedData& sharedData : m_sharedDatas)
+            {
+                // Compare the ids along with the pointers, so that an actor or motion set re-created at the address of a destroyed one
+                // does not pick up the data that got initialized for the old one.
+                if (sharedData.m_actorId == actor->GetID() && sharedData.m_motionSetId == motionSet->GetID() &&
+                    sharedData.m_actor == actor && sharedData.m_motionSet == motionSet)
+                {
+                    return sharedData.m_data.lock();
+                }
+            }
+        }
+
         //---------------------------------
         AZ::Debug::Timer timer;
         timer.Stamp();
@@ -129,18 +177,19 @@ namespace EMotionFX::MotionMatching
         AZ_Printf("Motion Matching", "Importing motion database...");
         MotionMatching::MotionMatchingData::InitSettings settings;
         settings.m_actorInstance = actorInstance;
-        settings.m_frameImportSettings.m_sampleRate = animGraphNode->m_sampleRate;
-        settings.m_importMirrored = animGraphNode->m_mirror;
-        settings.m_maxKdTreeDepth = animGraphNode->m_maxKdTreeDepth;
-        settings.m_minFramesPerKdTreeNode = animGraphNode->m_minFramesPerKdTreeNode;
-        settings.m_motionList.reserve(animGraphNode->m_motionIds.size());
-        settings.m_normalizeData = animGraphNode->m_normalizeData;
-        settings.m_featureScalerType = animGraphNode->m_featureScalerType;
-        settings.m_featureTansformerSettings.m_featureMin = animGraphNode->m_featureMin;
-        settings.m_featureTansformerSettings.m_featureMax = animGraphNode->m_featureMax;
-        settings.m_featureTansformerSettings.m_clip = animGraphNode->m_clipFeatures;
-
-        for (const AZStd::string& id : animGraphNode->m_motionIds)
+        settings.m_frameImportSettings.m_sampleRate = m_sampleRate;
+        settings.m_importMirrored = m_mirror;
+        settings.m_maxKdTreeDepth = m_maxKdTreeDepth;
+        settings.m_minFramesPerKdTreeNode = m_minFramesPerKdTreeNode;
+        settings.m_frameSearchType = m_frameSearchType;
+        settings.m_motionList.reserve(m_motionIds.size());
+        settings.m_normalizeData = m_normalizeData;
+        settings.m_featureScalerType = m_featureScalerType;
+        settings.m_featureTansformerSettings.m_featureMin = m_featureMin;
+        settings.m_featureTansformerSettings.m_featureMax = m_featureMax;
+        settings.m_featureTansformerSettings.m_clip = m_clipFeatures;
+
+        for (const AZStd::string& id : m_motionIds)
         {
             Motion* motion = motionSet->RecursiveFindMotionById(id);
             if (motion)
@@ -155,26 +204,35 @@ namespace EMotionFX::MotionMatching
 
         // Initialize the motion matching data (slow).
         AZ_Printf("Motion Matching", "Initializing motion matching...");
-        if (!m_data->Init(settings))
+        AZStd::shared_ptr<MotionMatchingData> data(aznew MotionMatching::MotionMatchingData(m_featureSchema));
+        if (!data->Init(settings))
         {
-            AZ_Warning("Motion Matching", false, "Failed to initialize motion matching for anim graph node '%s'!", animGraphNode->GetName());
-            SetHasError(true);
-            return;
+            AZ_Warning("Motion Matching", false, "Failed to initialize motion matching for anim graph node '%s'!", GetName());
+            return nullptr;
         }
 
-        // Initialize the instance.
-        AZ_Printf("Motion Matching", "Initializing instance...");
-        MotionMatching::MotionMatchingInstance::InitSettings initSettings;
-        initSettings.m_actorInstance = actorInstance;
-        initSettings.m_data = m_data;
-        m_instance->Init(initSettings);
-
         const float initTime = timer.GetDeltaTimeInSeconds();
-        const size_t memUsage = m_data->GetFrameDatabase().CalcMemoryUsageInBytes();
+        const size_t memUsage = data->GetFrameDatabase().CalcMemoryUsageInBytes();
         AZ_Printf("Motion Matching", "Finished in %.2f seconds (mem usage=%d bytes or %.2f mb)", initTime, memUsage, memUsage / (float)(1024 * 1024));
         //---------------------------------
 
-        SetHasError(false);
+        // Instances of the same actor playing the same motion set share the motion database, the feature matrix and the search structures.
+        if (shareData)
+        {
+            m_sharedDatas.push_back({ actor->GetID(), motionSet->GetID(), actor, motionSet, data });
+        }
+        return data;
+    }
+
+    void BlendTreeMotionMatchNode::Reinit()
+    {
+        // The settings changed, don't hand out the motion matching data that got initialized with the old ones anymore.
+        {
+            AZStd::scoped_lock lock(m_sharedDataMutex);
+            m_sharedDatas.clear();
+        }
+
+        AnimGraphNode::Reinit();
     }
 
     void BlendTreeMotionMatchNode::Update(AnimGraphInstance* animGraphInstance, float timePassedInSeconds)
@@ -373,6 +431,18 @@ namespace EMotionFX::MotionMatching
         return "Enable Visualize Feature Schema";
     }
 
+    bool BlendTreeMotionMatchNode::VersionConverter(AZ::SerializeContext& context, AZ::SerializeContext::DataElementNode& classElement)
+    {
+        const unsigned int version = classElement.GetVersion();
+        if (version < 12)
+        {
+            // Nodes saved before the search backend could be picked were built with the kd-tree, keep using it for them.
+            const FrameSearch::FrameSearchType frameSearchType = FrameSearch::KdTreeSearchType;
+            classElement.AddElementWithData(context, "frameSearchType", frameSearchType);
+        }
+        return true;
+    }
+
     void BlendTreeMotionMatchNode::Reflect(AZ::ReflectContext* context)
     {
         AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context);
@@ -382,7 +452,7 @@ namespace EMotionFX::MotionMatching
         }
 
         serializeContext->Class<BlendTreeMotionMatchNode, AnimGraphNode>()
-            ->Version(11)
+            ->Version(12, VersionConverter)
             ->Field("lowestCostSearchFrequency", &BlendTreeMotionMatchNode::m_lowestCostSearchFrequency)
             ->Field("sampleRate", &BlendTreeMotionMatchNode::m_sampleRate)
             ->Field("controlSplineMode", &BlendTreeMotionMatchNode::m_trajectoryQueryMode)
@@ -398,6 +468,7 @@ namespace EMotionFX::MotionMatching
             ->Field("featureSchema", &BlendTreeMotionMatchNode::m_featureSchema)
             ->Field("motionIds", &BlendTreeMotionMatchNode::m_motionIds)
             ->Field("featureScalerType", &BlendTreeMotionMatchNode::m_featureScalerType)
+            ->Field("frameSearchType", &BlendTreeMotionMatchNode::m_frameSearchType)
             ;
 
         AZ::EditContext* editContext = serializeContext->GetEditContext();
@@ -454,6 +525,12 @@ namespace EMotionFX::MotionMatching
                 ->Attribute(AZ::Edit::Attributes::Visibility, &BlendTreeMotionMatchNode::GetMinMaxSettingsVisibility)
             ->ClassElement(AZ::Edit::ClassElements::Group, "Acceleration Structure")
                 ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+            ->DataElement(AZ::Edit::UIHandlers::ComboBox, &BlendTreeMotionMatchNode::m_frameSearchType, "Search backend", "The acceleration structure used for the broad-phase search. Automatic picks one based on the number of frames in the motion database.")
+                ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->EnumAttribute(FrameSearch::AutomaticSearchType, "Automatic")
+                ->EnumAttribute(FrameSearch::KdTreeSearchType, "Kd-tree")
+                ->EnumAttribute(FrameSearch::FlatKdTreeSearchType, "Flat kd-tree")
+                ->EnumAttribute(FrameSearch::QuantizedSearchType, "Quantized brute-force")
             ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_maxKdTreeDepth, "Max kd-tree depth", "The maximum number of hierarchy levels in the kdTree.")
                 ->Attribute(AZ::Edit::Attributes::Min, 1)
                 ->Attribute(AZ::Edit::Attributes::Max, 20)
@@ -9,6 +9,10 @@
 #pragma once
 
 #include <AzCore/Debug/Timer.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/smart_ptr/weak_ptr.h>
 #include <EMotionFX/Source/AnimGraphNode.h>
 #include <EMotionFX/Source/EMotionFXConfig.h>
 #include <MotionMatchingInstance.h>
@@ -16,6 +20,13 @@
 #include <MotionMatchingData.h>
 #include <ImGuiMonitor.h>
 
+namespace EMotionFX
+{
+    class Actor;
+    class ActorInstance;
+    class MotionSet;
+}
+
 namespace EMotionFX::MotionMatching
 {
     class EMFX_API BlendTreeMotionMatchNode
@@ -55,7 +66,6 @@ namespace EMotionFX::MotionMatching
 
             ~UniqueData()
             {
-                delete m_data;
                 delete m_instance;
             }
 
@@ -63,13 +73,14 @@ namespace EMotionFX::MotionMatching
 
         public:
             MotionMatching::MotionMatchingInstance* m_instance = nullptr;
-            MotionMatching::MotionMatchingData* m_data = nullptr;
+            AZStd::shared_ptr<MotionMatching::MotionMatchingData> m_data; //!< Shared with the other anim graph instances of the same actor and motion set.
         };
 
         BlendTreeMotionMatchNode();
         ~BlendTreeMotionMatchNode();
 
         bool InitAfterLoading(AnimGraph* animGraph) override;
+        void Reinit() override;
             
         bool GetSupportsVisualization() const override { return true; }
         bool GetHasOutputPose() const override { return true; }
@@ -91,6 +102,11 @@ namespace EMotionFX::MotionMatching
         void Update(AnimGraphInstance* animGraphInstance, float timePassedInSeconds) override;
         void PostUpdate(AnimGraphInstance* animGraphInstance, float timePassedInSeconds) override;
 
+        //! Get the motion matching data for the given actor and motion set, initialize it in case no other anim graph instance did yet.
+        AZStd::shared_ptr<MotionMatchingData> FindOrCreateData(ActorInstance* actorInstance, MotionSet* motionSet);
+
+        static bool VersionConverter(AZ::SerializeContext& context, AZ::SerializeContext::DataElementNode& classElement);
+
         AZ::Crc32 GetTrajectoryPathSettingsVisibility() const;
         AZ::Crc32 GetFeatureScalerTypeSettingsVisibility() const;
         AZ::Crc32 GetMinMaxSettingsVisibility() const;
@@ -106,6 +122,7 @@ namespace EMotionFX::MotionMatching
         AZ::u32 m_sampleRate = 30;
         AZ::u32 m_maxKdTreeDepth = 15;
         AZ::u32 m_minFramesPerKdTreeNode = 1000;
+        FrameSearch::FrameSearchType m_frameSearchType = FrameSearch::AutomaticSearchType;
         TrajectoryQuery::EMode m_trajectoryQueryMode = TrajectoryQuery::MODE_TARGETDRIVEN;
         bool m_mirror = false;
 
@@ -116,6 +133,17 @@ namespace EMotionFX::MotionMatching
         float m_featureMax = 1.0f;
         bool m_clipFeatures = false;
 
+        struct SharedData
+        {
+            AZ::u32 m_actorId = MCORE_INVALIDINDEX32;
+            AZ::u32 m_motionSetId = MCORE_INVALIDINDEX32;
+            const Actor* m_actor = nullptr;
+            const MotionSet* m_motionSet = nullptr;
+            AZStd::weak_ptr<MotionMatchingData> m_data;
+        };
+        AZStd::vector<SharedData> m_sharedDatas;
+        AZStd::mutex m_sharedDataMutex;
+
         AZ::Debug::Timer m_timer;
         float m_updateTimeInMs = 0.0f;
         float m_postUpdateTimeInMs = 0.0f;
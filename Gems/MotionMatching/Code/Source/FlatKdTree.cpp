@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Debug/Timer.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+#include <Allocators.h>
+#include <FlatKdTree.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZ_CLASS_ALLOCATOR_IMPL(FlatKdTree, MotionMatchAllocator, 0)
+
+    bool FlatKdTree::Init([[maybe_unused]] const FrameDatabase& frameDatabase,
+        const FeatureMatrix& featureMatrix,
+        const AZStd::vector<Feature*>& features,
+        const InitSettings& settings)
+    {
+        AZ_PROFILE_SCOPE(Animation, "FlatKdTree::Init");
+
+#if !defined(_RELEASE)
+        AZ::Debug::Timer timer;
+        timer.Stamp();
+#endif
+
+        Clear();
+
+        const AZStd::vector<size_t> featureColumns = CalcFeatureColumns(features);
+        if (featureColumns.empty())
+        {
+            AZ_Error("Motion Matching", false, "Cannot initialize flat KD-tree. There are no feature values to search.");
+            return false;
+        }
+
+        m_numDimensions = featureColumns.size();
+
+        const size_t numFrames = featureMatrix.rows();
+        if (numFrames == 0)
+        {
+            AZ_Error("Motion Matching", false, "Skipping to initialize flat KD-tree. No frames in the motion database.");
+            return true;
+        }
+
+        m_maxFramesPerLeaf = AZ::GetMax<size_t>(settings.m_maxFramesPerLeaf, 1);
+        m_numCandidates = AZ::GetMax<size_t>(settings.m_numCandidates, 1);
+
+        // Build the tree over the frame indices, each node splits its frames at the median.
+        m_frameIndices.resize(numFrames);
+        for (size_t frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+        {
+            m_frameIndices[frameIndex] = aznumeric_cast<AZ::u32>(frameIndex);
+        }
+        BuildNode(featureMatrix, featureColumns, 0, aznumeric_cast<AZ::u32>(numFrames));
+
+        // Gather the feature values in leaf order.
+        m_frameValues.resize(numFrames * m_numDimensions);
+        for (size_t i = 0; i < numFrames; ++i)
+        {
+            float* frameValues = &m_frameValues[i * m_numDimensions];
+            for (size_t dimension = 0; dimension < m_numDimensions; ++dimension)
+            {
+                frameValues[dimension] = featureMatrix(m_frameIndices[i], featureColumns[dimension]);
+            }
+        }
+
+#if !defined(_RELEASE)
+        const float initTime = timer.GetDeltaTimeInSeconds();
+        AZ_TracePrintf("Motion Matching", "Flat KD-Tree initialized in %.2f ms (numNodes = %zu  numDims = %zu  Memory used = %.2f MB).",
+            initTime * 1000.0f,
+            m_nodes.size(),
+            m_numDimensions,
+            static_cast<float>(CalcMemoryUsageInBytes()) / 1024.0f / 1024.0f);
+#endif
+        return true;
+    }
+
+    AZ::u32 FlatKdTree::BuildNode(const FeatureMatrix& featureMatrix, const AZStd::vector<size_t>& featureColumns, AZ::u32 firstFrame, AZ::u32 numFrames)
+    {
+        const AZ::u32 nodeIndex = aznumeric_cast<AZ::u32>(m_nodes.size());
+        m_nodes.emplace_back();
+        m_nodes[nodeIndex].m_firstFrame = firstFrame;
+        m_nodes[nodeIndex].m_numFrames = numFrames;
+
+        if (numFrames <= m_maxFramesPerLeaf)
+        {
+            return nodeIndex;
+        }
+
+        // Split along the dimension with the largest spread of values.
+        const auto frameBegin = m_frameIndices.begin() + firstFrame;
+        const auto frameEnd = frameBegin + numFrames;
+        size_t splitDimension = 0;
+        float maxSpread = -1.0f;
+        for (size_t dimension = 0; dimension < m_numDimensions; ++dimension)
+        {
+            const size_t column = featureColumns[dimension];
+            float minValue = featureMatrix(*frameBegin, column);
+            float maxValue = minValue;
+            for (auto frame = frameBegin; frame != frameEnd; ++frame)
+            {
+                const float value = featureMatrix(*frame, column);
+                minValue = AZ::GetMin(minValue, value);
+                maxValue = AZ::GetMax(maxValue, value);
+            }
+
+            if (maxValue - minValue > maxSpread)
+            {
+                maxSpread = maxValue - minValue;
+                splitDimension = dimension;
+            }
+        }
+
+        // All frames in this node have the same values, there is nothing to split.
+        if (maxSpread <= 0.0f)
+        {
+            return nodeIndex;
+        }
+
+        // Partition the frames around the median in O(n).
+        const size_t splitColumn = featureColumns[splitDimension];
+        const AZ::u32 numLeftFrames = numFrames / 2;
+        AZStd::nth_element(frameBegin, frameBegin + numLeftFrames, frameEnd,
+            [&featureMatrix, splitColumn](AZ::u32 frameA, AZ::u32 frameB)
+            {
+                return featureMatrix(frameA, splitColumn) < featureMatrix(frameB, splitColumn);
+            });
+
+        m_nodes[nodeIndex].m_dimension = aznumeric_cast<AZ::u32>(splitDimension);
+        m_nodes[nodeIndex].m_split = featureMatrix(*(frameBegin + numLeftFrames), splitColumn);
+
+        // Children are built depth-first, so the left child directly follows this node.
+        BuildNode(featureMatrix, featureColumns, firstFrame, numLeftFrames);
+        const AZ::u32 rightChild = BuildNode(featureMatrix, featureColumns, firstFrame + numLeftFrames, numFrames - numLeftFrames);
+        m_nodes[nodeIndex].m_rightChild = rightChild;
+        return nodeIndex;
+    }
+
+    void FlatKdTree::Clear()
+    {
+        m_nodes.clear();
+        m_frameIndices.clear();
+        m_frameValues.clear();
+        m_numDimensions = 0;
+    }
+
+    bool FlatKdTree::IsInitialized() const
+    {
+        return (m_numDimensions != 0);
+    }
+
+    size_t FlatKdTree::GetNumNodes() const
+    {
+        return m_nodes.size();
+    }
+
+    size_t FlatKdTree::GetNumDimensions() const
+    {
+        return m_numDimensions;
+    }
+
+    size_t FlatKdTree::CalcMemoryUsageInBytes() const
+    {
+        size_t totalBytes = sizeof(FlatKdTree);
+        totalBytes += m_nodes.capacity() * sizeof(Node);
+        totalBytes += m_frameIndices.capacity() * sizeof(AZ::u32);
+        totalBytes += m_frameValues.capacity() * sizeof(float);
+        return totalBytes;
+    }
+
+    void FlatKdTree::FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices, SearchBuffers& buffers) const
+    {
+        AZ_PROFILE_SCOPE(Animation, "FlatKdTree::FindNearestNeighbors");
+        AZ_Assert(IsInitialized(), "Expecting an initialized flat kd-tree. Did you forget to call FlatKdTree::Init()?");
+        AZ_Assert(frameFloats.size() == m_numDimensions, "The query vector doesn't match the number of dimensions of the flat kd-tree.");
+
+        resultFrameIndices.clear();
+        if (m_nodes.empty())
+        {
+            return;
+        }
+
+        // Max-heap on the distance, so the worst candidate is always at the front.
+        AZStd::vector<AZStd::pair<float, AZ::u32>>& candidates = buffers.m_candidates;
+        candidates.clear();
+
+        // Nodes to visit along with the minimum squared distance any of their frames can have to the query.
+        AZStd::vector<AZStd::pair<AZ::u32, float>>& nodeStack = buffers.m_nodeStack;
+        nodeStack.clear();
+        nodeStack.emplace_back(0, 0.0f);
+
+        while (!nodeStack.empty())
+        {
+            const AZ::u32 nodeIndex = nodeStack.back().first;
+            const float minDistance = nodeStack.back().second;
+            nodeStack.pop_back();
+
+            if (candidates.size() == m_numCandidates && minDistance >= candidates.front().first)
+            {
+                continue;
+            }
+
+            const Node& node = m_nodes[nodeIndex];
+            if (node.m_rightChild == 0)
+            {
+                const float* frameValues = &m_frameValues[node.m_firstFrame * m_numDimensions];
+                for (AZ::u32 i = 0; i < node.m_numFrames; ++i, frameValues += m_numDimensions)
+                {
+                    float distance = 0.0f;
+                    for (size_t dimension = 0; dimension < m_numDimensions; ++dimension)
+                    {
+                        const float difference = frameValues[dimension] - frameFloats[dimension];
+                        distance += difference * difference;
+                    }
+
+                    if (candidates.size() < m_numCandidates)
+                    {
+                        candidates.emplace_back(distance, node.m_firstFrame + i);
+                        AZStd::push_heap(candidates.begin(), candidates.end());
+                    }
+                    else if (distance < candidates.front().first)
+                    {
+                        AZStd::pop_heap(candidates.begin(), candidates.end());
+                        candidates.back() = { distance, node.m_firstFrame + i };
+                        AZStd::push_heap(candidates.begin(), candidates.end());
+                    }
+                }
+                continue;
+            }
+
+            // Visit the child on the side of the query first, the other side is at least as far away as the splitting plane.
+            const float planeDistance = frameFloats[node.m_dimension] - node.m_split;
+            const AZ::u32 leftChild = nodeIndex + 1;
+            const AZ::u32 nearChild = (planeDistance < 0.0f) ? leftChild : node.m_rightChild;
+            const AZ::u32 farChild = (planeDistance < 0.0f) ? node.m_rightChild : leftChild;
+            nodeStack.emplace_back(farChild, AZ::GetMax(minDistance, planeDistance * planeDistance));
+            nodeStack.emplace_back(nearChild, minDistance);
+        }
+
+        resultFrameIndices.resize(candidates.size());
+        for (size_t i = 0; i < candidates.size(); ++i)
+        {
+            resultFrameIndices[i] = m_frameIndices[candidates[i].second];
+        }
+    }
+} // namespace EMotionFX::MotionMatching
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+#include <FrameSearch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Kd-tree stored in flat arrays that finds the nearest frames to the query values.
+    //! Nodes are stored depth-first in a single array, so the left child of a node directly follows it. The feature values of the frames
+    //! are copied into a contiguous block in leaf order, so scanning a leaf node reads memory linearly.
+    //! The search descends into the closer child first and skips the other one when the splitting plane is further away than the
+    //! currently worst candidate, so the returned frames are the exact nearest neighbors in the search space.
+    class EMFX_API FlatKdTree
+        : public FrameSearch
+    {
+    public:
+        AZ_RTTI(FlatKdTree, "{2A9E8E5D-7C7B-4C53-9B0F-6E9C0F4F3B11}", FrameSearch);
+        AZ_CLASS_ALLOCATOR_DECL
+
+        FlatKdTree() = default;
+        ~FlatKdTree() override = default;
+
+        bool Init(const FrameDatabase& frameDatabase,
+            const FeatureMatrix& featureMatrix,
+            const AZStd::vector<Feature*>& features,
+            const InitSettings& settings) override;
+        void Clear() override;
+        bool IsInitialized() const override;
+
+        size_t GetNumNodes() const override;
+        size_t GetNumDimensions() const override;
+        size_t CalcMemoryUsageInBytes() const override;
+
+        void FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices, SearchBuffers& buffers) const override;
+
+    private:
+        struct Node
+        {
+            float m_split = 0.0f;
+            AZ::u32 m_dimension = 0;
+            AZ::u32 m_rightChild = 0; //!< Index of the right child node, zero for leaf nodes.
+            AZ::u32 m_firstFrame = 0; //!< Index of the first frame of the node in the leaf ordered frame arrays.
+            AZ::u32 m_numFrames = 0;
+        };
+
+        AZ::u32 BuildNode(const FeatureMatrix& featureMatrix, const AZStd::vector<size_t>& featureColumns, AZ::u32 firstFrame, AZ::u32 numFrames);
+
+        AZStd::vector<Node> m_nodes;
+        AZStd::vector<AZ::u32> m_frameIndices; //!< Frame indices in leaf order.
+        AZStd::vector<float> m_frameValues; //!< Feature values in leaf order, m_numDimensions values per frame.
+        size_t m_numDimensions = 0;
+        size_t m_maxFramesPerLeaf = 64;
+        size_t m_numCandidates = 1000;
+    };
+} // namespace EMotionFX::MotionMatching
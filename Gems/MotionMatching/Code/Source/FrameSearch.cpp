@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Console/IConsole.h>
+
+#include <Allocators.h>
+#include <FlatKdTree.h>
+#include <FrameSearch.h>
+#include <KdTree.h>
+#include <QuantizedFrameSearch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZ_CVAR_EXTERNED(AZ::u32, mm_maxQuantizedSearchFrames);
+
+    AZ_CLASS_ALLOCATOR_IMPL(FrameSearch, MotionMatchAllocator, 0)
+
+    FrameSearch::FrameSearchType FrameSearch::SelectSearchType(size_t numFrames)
+    {
+        // Scanning all frames of a small database touches less memory than walking the tree and doesn't depend on how well
+        // the data splits. Larger databases are better off with the tree as it skips most of the frames.
+        if (numFrames <= static_cast<AZ::u32>(mm_maxQuantizedSearchFrames))
+        {
+            return QuantizedSearchType;
+        }
+
+        return FlatKdTreeSearchType;
+    }
+
+    AZStd::unique_ptr<FrameSearch> FrameSearch::Create(FrameSearchType searchType, size_t numFrames)
+    {
+        if (searchType == AutomaticSearchType)
+        {
+            searchType = SelectSearchType(numFrames);
+        }
+
+        switch (searchType)
+        {
+        case KdTreeSearchType:
+            {
+                return AZStd::make_unique<KdTree>();
+            }
+        case FlatKdTreeSearchType:
+            {
+                return AZStd::make_unique<FlatKdTree>();
+            }
+        case QuantizedSearchType:
+            {
+                return AZStd::make_unique<QuantizedFrameSearch>();
+            }
+        default:
+            {
+                AZ_Error("Motion Matching", false, "Unknown frame search type (%d).", static_cast<int>(searchType));
+                return AZStd::make_unique<KdTree>();
+            }
+        }
+    }
+
+    AZStd::vector<size_t> FrameSearch::CalcFeatureColumns(const AZStd::vector<Feature*>& features)
+    {
+        AZStd::vector<size_t> featureColumns;
+        for (const Feature* feature : features)
+        {
+            const size_t numDimensions = feature->GetNumDimensions();
+            const size_t featureColumnOffset = feature->GetColumnOffset();
+            for (size_t i = 0; i < numDimensions; ++i)
+            {
+                featureColumns.push_back(featureColumnOffset + i);
+            }
+        }
+
+        return featureColumns;
+    }
+} // namespace EMotionFX::MotionMatching
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/utils.h>
+
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+#include <Feature.h>
+#include <FeatureMatrix.h>
+#include <FrameDatabase.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Broad-phase search backend used to reduce the frames that the motion matching search evaluates the full feature costs for.
+    //! A backend is built over the feature matrix columns of the given features and returns a set of candidate frames
+    //! that are close to the query values of these features. Different backends trade accuracy, memory and speed and the best
+    //! choice depends on the size of the motion database.
+    class EMFX_API FrameSearch
+    {
+    public:
+        AZ_RTTI(FrameSearch, "{5B0E2C2E-8C7A-4A7B-9C77-5B2E87B0F3D4}");
+        AZ_CLASS_ALLOCATOR_DECL
+
+        enum FrameSearchType
+        {
+            AutomaticSearchType = 0, //!< Pick the backend based on the number of frames in the motion database.
+            KdTreeSearchType = 1, //!< Pointer-based kd-tree returning all frames of the leaf node the query falls into.
+            FlatKdTreeSearchType = 2, //!< Flattened kd-tree returning the nearest frames.
+            QuantizedSearchType = 3 //!< Brute-force scan over quantized feature values returning the nearest frames.
+        };
+
+        struct EMFX_API InitSettings
+        {
+            size_t m_maxDepth = 20; //!< Maximum depth of the pointer-based kd-tree.
+            size_t m_minFramesPerLeaf = 1000; //!< Minimum number of frames per leaf node of the pointer-based kd-tree.
+            size_t m_maxFramesPerLeaf = 64; //!< Maximum number of frames per leaf node of the flattened kd-tree.
+            size_t m_numCandidates = 1000; //!< Number of nearest frames returned by the backends that rank frames.
+        };
+
+        //! Scratch memory for a search. These are owned by the caller, so that searches on a shared backend can run concurrently
+        //! without allocating memory for every search.
+        struct EMFX_API SearchBuffers
+        {
+            AZStd::vector<float> m_distances;
+            AZStd::vector<float> m_queryOffsets;
+            AZStd::vector<AZ::u32> m_frameOrder;
+            AZStd::vector<AZStd::pair<float, AZ::u32>> m_candidates;
+            AZStd::vector<AZStd::pair<AZ::u32, float>> m_nodeStack;
+        };
+
+        virtual ~FrameSearch() = default;
+
+        //! Build the search structure over the feature matrix columns of the given features.
+        //! Internally clears any existing contents.
+        virtual bool Init(const FrameDatabase& frameDatabase,
+            const FeatureMatrix& featureMatrix,
+            const AZStd::vector<Feature*>& features,
+            const InitSettings& settings) = 0;
+        virtual void Clear() = 0;
+        virtual bool IsInitialized() const = 0;
+
+        virtual size_t GetNumNodes() const = 0;
+        virtual size_t GetNumDimensions() const = 0;
+        virtual size_t CalcMemoryUsageInBytes() const = 0;
+
+        //! Find the candidate frames for the given query values.
+        //! @param frameFloats The query values for the features the search was initialized with, in the order of the features.
+        //! @param resultFrameIndices The candidate frame indices, in no particular order.
+        virtual void FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices, SearchBuffers& buffers) const = 0;
+
+        //! Get the backend that is used for a motion database with the given number of frames when the automatic type is requested.
+        static FrameSearchType SelectSearchType(size_t numFrames);
+
+        //! Create an uninitialized search backend of the given type.
+        static AZStd::unique_ptr<FrameSearch> Create(FrameSearchType searchType, size_t numFrames);
+
+    protected:
+        //! Map the search local columns to the feature matrix columns of the given features.
+        static AZStd::vector<size_t> CalcFeatureColumns(const AZStd::vector<Feature*>& features);
+    };
+} // namespace EMotionFX::MotionMatching
@@ -108,6 +108,14 @@ namespace EMotionFX::MotionMatching
         return true;
     }
 
+    bool KdTree::Init(const FrameDatabase& frameDatabase,
+        const FeatureMatrix& featureMatrix,
+        const AZStd::vector<Feature*>& features,
+        const InitSettings& settings)
+    {
+        return Init(frameDatabase, featureMatrix, features, settings.m_maxDepth, settings.m_minFramesPerLeaf);
+    }
+
     AZStd::vector<size_t> KdTree::CalcLocalToSchemaFeatureColumns(const AZStd::vector<Feature*>& features) const
     {
         AZStd::vector<size_t> localToSchemaFeatureColumns;
@@ -489,6 +497,12 @@ namespace EMotionFX::MotionMatching
         FindNearestNeighbors(curNode, frameFloats, resultFrameIndices);
     }
 
+    void KdTree::FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices, [[maybe_unused]] SearchBuffers& buffers) const
+    {
+        // The leaf node frames are returned as they are, no scratch memory needed.
+        FindNearestNeighbors(frameFloats, resultFrameIndices);
+    }
+
     void KdTree::FindNearestNeighbors([[maybe_unused]] Node* node, [[maybe_unused]] const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const
     {
         resultFrameIndices = node->m_frames;
@@ -16,17 +16,19 @@
 #include <Feature.h>
 #include <FeatureMatrix.h>
 #include <FrameDatabase.h>
+#include <FrameSearch.h>
 
 namespace EMotionFX::MotionMatching
 {
     class KdTree
+        : public FrameSearch
     {
     public:
-        AZ_RTTI(KdTree, "{CDA707EC-4150-463B-8157-90D98351ACED}");
+        AZ_RTTI(KdTree, "{CDA707EC-4150-463B-8157-90D98351ACED}", FrameSearch);
         AZ_CLASS_ALLOCATOR_DECL;
 
         KdTree() = default;
-        virtual ~KdTree();
+        ~KdTree() override;
 
         bool Init(const FrameDatabase& frameDatabase,
             const FeatureMatrix& featureMatrix,
@@ -34,21 +36,28 @@ namespace EMotionFX::MotionMatching
             size_t maxDepth=10,
             size_t minFramesPerLeaf=1000);
 
+        // FrameSearch overrides
+        bool Init(const FrameDatabase& frameDatabase,
+            const FeatureMatrix& featureMatrix,
+            const AZStd::vector<Feature*>& features,
+            const InitSettings& settings) override;
+
         //! Calculate the number of dimensions or values for the given feature set.
         //! Each feature might store one or multiple values inside the feature matrix and the number of
         //! values each feature holds varies with the feature type. This calculates the sum of the number of
         //! values of the given feature set.
         static size_t CalcNumDimensions(const AZStd::vector<Feature*>& features);
 
-        void Clear();
+        void Clear() override;
         void PrintStats();
 
-        size_t GetNumNodes() const;
-        size_t GetNumDimensions() const;
-        size_t CalcMemoryUsageInBytes() const;
-        bool IsInitialized() const;
+        size_t GetNumNodes() const override;
+        size_t GetNumDimensions() const override;
+        size_t CalcMemoryUsageInBytes() const override;
+        bool IsInitialized() const override;
 
         void FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const;
+        void FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices, SearchBuffers& buffers) const override;
 
     private:
         struct Node
@@ -26,6 +26,7 @@
 #include <FeatureSchemaDefault.h>
 #include <FeatureTrajectory.h>
 #include <FrameDatabase.h>
+#include <FrameSearch.h>
 #include <KdTree.h>
 #include <MotionMatchingData.h>
 
@@ -38,7 +39,7 @@ namespace EMotionFX::MotionMatching
     MotionMatchingData::MotionMatchingData(const FeatureSchema& featureSchema)
         : m_featureSchema(featureSchema)
     {
-        m_kdTree = AZStd::make_unique<KdTree>();
+        m_frameSearch = AZStd::make_unique<KdTree>();
     }
 
     MotionMatchingData::~MotionMatchingData()
@@ -260,7 +261,7 @@ namespace EMotionFX::MotionMatching
         }
 
         ///////////////////////////////////////////////////////////////////////
-        // 4. Initialize the kd-tree used to accelerate the searches
+        // 4. Initialize the search backend used to accelerate the searches
         {
             // Use all features other than the trajectory for the broad-phase search using the KD-Tree.
             for (Feature* feature : m_featureSchema.GetFeatures())
@@ -271,9 +272,17 @@ namespace EMotionFX::MotionMatching
                 }
             }
 
-            if (!m_kdTree->Init(m_frameDatabase, m_featureMatrix, m_featuresInKdTree, settings.m_maxKdTreeDepth, settings.m_minFramesPerKdTreeNode)) // Internally automatically clears any existing contents.
+            // Pick the backend based on the size of the motion database, unless a specific one was requested.
+            m_frameSearch = FrameSearch::Create(settings.m_frameSearchType, m_frameDatabase.GetNumFrames());
+
+            FrameSearch::InitSettings frameSearchSettings;
+            frameSearchSettings.m_maxDepth = settings.m_maxKdTreeDepth;
+            frameSearchSettings.m_minFramesPerLeaf = settings.m_minFramesPerKdTreeNode;
+            // Return about as many candidates as a kd-tree leaf holds, so the narrow-phase cost stays the same across backends.
+            frameSearchSettings.m_numCandidates = settings.m_minFramesPerKdTreeNode;
+            if (!m_frameSearch->Init(m_frameDatabase, m_featureMatrix, m_featuresInKdTree, frameSearchSettings)) // Internally automatically clears any existing contents.
             {
-                AZ_Error("EMotionFX", false, "Failed to initialize KdTree acceleration structure.");
+                AZ_Error("EMotionFX", false, "Failed to initialize %s acceleration structure.", m_frameSearch->RTTI_GetTypeName());
                 return false;
             }
         }
@@ -292,7 +301,7 @@ namespace EMotionFX::MotionMatching
     {
         m_frameDatabase.Clear();
         m_featureMatrix.Clear();
-        m_kdTree->Clear();
+        m_frameSearch->Clear();
         m_featuresInKdTree.clear();
     }
 } // namespace EMotionFX::MotionMatching
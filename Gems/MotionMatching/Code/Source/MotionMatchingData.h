@@ -18,7 +18,7 @@
 #include <FeatureSchema.h>
 #include <FrameDatabase.h>
 #include <FeatureMatrixTransformer.h>
-#include <KdTree.h>
+#include <FrameSearch.h>
 
 namespace AZ
 {
@@ -54,6 +54,7 @@ namespace EMotionFX::MotionMatching
             FrameDatabase::FrameImportSettings m_frameImportSettings;
             size_t m_maxKdTreeDepth = 20;
             size_t m_minFramesPerKdTreeNode = 1000;
+            FrameSearch::FrameSearchType m_frameSearchType = FrameSearch::AutomaticSearchType;
             bool m_importMirrored = false;
 
             bool m_normalizeData = false;
@@ -69,7 +70,7 @@ namespace EMotionFX::MotionMatching
         const FeatureSchema& GetFeatureSchema() const { return m_featureSchema; }
         const FeatureMatrix& GetFeatureMatrix() const { return m_featureMatrix; }
         FeatureMatrixTransformer* GetFeatureTransformer() { return m_featureTransformer.get(); }
-        const KdTree& GetKdTree() const { return *m_kdTree.get(); }
+        const FrameSearch& GetFrameSearch() const { return *m_frameSearch.get(); }
         const AZStd::vector<Feature*>& GetFeaturesInKdTree() const { return m_featuresInKdTree; }
 
     protected:
@@ -87,7 +88,7 @@ namespace EMotionFX::MotionMatching
         FeatureMatrix m_featureMatrix;
         AZStd::unique_ptr<FeatureMatrixTransformer> m_featureTransformer;
 
-        AZStd::unique_ptr<KdTree> m_kdTree; //< The acceleration structure to speed up the search for lowest cost frames.
+        AZStd::unique_ptr<FrameSearch> m_frameSearch; //< The acceleration structure to speed up the search for lowest cost frames.
         AZStd::vector<Feature*> m_featuresInKdTree;
     };
 } // namespace EMotionFX::MotionMatching
@@ -25,10 +25,11 @@
 #include <FeatureSchema.h>
 #include <FeatureTrajectory.h>
 #include <FeatureVelocity.h>
+#include <FrameSearch.h>
 #include <ImGuiMonitorBus.h>
-#include <KdTree.h>
 #include <MotionMatchingData.h>
 #include <MotionMatchingInstance.h>
+#include <MotionMatchingSearchBatch.h>
 #include <PoseDataJointVelocities.h>
 
 
@@ -39,6 +40,7 @@ namespace EMotionFX::MotionMatching
     AZ_CVAR_EXTERNED(bool, mm_debugDrawQueryPose);
     AZ_CVAR_EXTERNED(bool, mm_debugDrawQueryVelocities);
     AZ_CVAR_EXTERNED(bool, mm_useKdTree);
+    AZ_CVAR_EXTERNED(bool, mm_batchedSearch);
 
     AZ_CLASS_ALLOCATOR_IMPL(MotionMatchingInstance, MotionMatchAllocator, 0)
 
@@ -46,6 +48,14 @@ namespace EMotionFX::MotionMatching
     {
         DebugDrawRequestBus::Handler::BusDisconnect();
 
+        if (m_batchedSearchPending)
+        {
+            if (MotionMatchingSearchBatch* searchBatch = MotionMatchingSearchBatchInterface::Get())
+            {
+                searchBatch->Cancel(this);
+            }
+        }
+
         if (m_motionInstance)
         {
             GetMotionInstancePool().Free(m_motionInstance);
@@ -108,7 +118,7 @@ namespace EMotionFX::MotionMatching
         m_queryPose.InitFromBindPose(m_actorInstance);
 
         // Make sure we have enough space inside the frame floats array, which is used to search the kdTree.
-        const size_t numValuesInKdTree = m_data->GetKdTree().GetNumDimensions();
+        const size_t numValuesInKdTree = m_data->GetFrameSearch().GetNumDimensions();
         m_kdTreeQueryVector.Resize(numValuesInKdTree);
         m_queryVector.Resize(m_data->GetFeatureMatrix().cols());
 
@@ -389,71 +399,44 @@ namespace EMotionFX::MotionMatching
             }
         }
 
-        const bool searchLowestCostFrame = m_timeSinceLastFrameSwitch >= lowestCostSearchTimeInterval;
+        // Apply the result of the search that ran in the batch since the last update.
+        const bool applyBatchedSearchResult = m_hasBatchedSearchResult;
+        if (applyBatchedSearchResult)
+        {
+            m_hasBatchedSearchResult = false;
+            SwitchToLowestCostFrame(m_batchedSearchResult.m_frameIndex, currentFrameIndex, newMotionTime, timePassedInSeconds);
+        }
+
+        // Don't start another search while the batch didn't process the last one yet or its result just got applied.
+        const bool searchLowestCostFrame = m_timeSinceLastFrameSwitch >= lowestCostSearchTimeInterval && !m_batchedSearchPending && !applyBatchedSearchResult;
         if (searchLowestCostFrame)
         {
             // Calculate the input query pose for the motion matching search algorithm.
-            {
-                AZ_PROFILE_SCOPE(Animation, "MM::EvaluateQueryPose");
-
-                // Sample the pose for the new motion time as the motion instance has not been updated with the timeDelta from this frame yet.
-                SamplePose(m_motionInstance->GetMotion(), m_queryPose, newMotionTime);
-
-                // Copy over the motion extraction joint transform from the current pose to the newly sampled pose.
-                // When sampling a motion, the motion extraction joint is in animation space, while we need the query pose to be in world space.
-                // Note: This does not yet take the extraction delta from the current tick into account.
-                if (m_actorInstance->GetActor()->GetMotionExtractionNode())
-                {
-                    const Pose* currentPose = m_actorInstance->GetTransformData()->GetCurrentPose();
-                    const size_t motionExtractionJointIndex = m_actorInstance->GetActor()->GetMotionExtractionNodeIndex();
-                    m_queryPose.SetWorldSpaceTransform(motionExtractionJointIndex,
-                        currentPose->GetWorldSpaceTransform(motionExtractionJointIndex));
-                }
-
-                // Calculate the joint velocities for the sampled pose using the same method as we do for the frame database.
-                PoseDataJointVelocities* velocityPoseData = m_queryPose.GetAndPreparePoseData<PoseDataJointVelocities>(m_actorInstance);
-                AnimGraphPosePool& posePool = GetEMotionFX().GetThreadData(m_actorInstance->GetThreadIndex())->GetPosePool();
-                velocityPoseData->CalculateVelocity(m_actorInstance, posePool, m_motionInstance->GetMotion(), newMotionTime, m_cachedTrajectoryFeature->GetRelativeToNodeIndex());
-            }
-
-            const FeatureMatrix& featureMatrix = m_data->GetFeatureMatrix();
-            const FrameDatabase& frameDatabase = m_data->GetFrameDatabase();
+            EvaluateQueryPose(newMotionTime);
 
             Feature::QueryVectorContext queryVectorContext(m_queryPose, m_trajectoryQuery);
             queryVectorContext.m_featureTransformer = m_data->GetFeatureTransformer();
+            BuildQueryVector(queryVectorContext);
+
+            MotionMatchingSearchBatch* searchBatch = mm_batchedSearch ? MotionMatchingSearchBatchInterface::Get() : nullptr;
+            if (searchBatch)
+            {
+                // The search runs along with the searches of all other instances, the result gets applied with the next update.
+                m_batchedSearchPending = true;
+                searchBatch->Submit(this);
+            }
+            else
+            {
+                AZ::Debug::Timer timer;
+                timer.Stamp();
 
-            Feature::FrameCostContext frameCostContext(m_queryVector, featureMatrix);
-            const size_t lowestCostFrameIndex = FindLowestCostFrameIndex(queryVectorContext, frameCostContext);
+                const SearchResult result = FindLowestCostFrame(mm_useKdTree);
 
-            const Frame& currentFrame = frameDatabase.GetFrame(currentFrameIndex);
-            const Frame& lowestCostFrame = frameDatabase.GetFrame(lowestCostFrameIndex);
-            const bool sameMotion = (currentFrame.GetSourceMotion() == lowestCostFrame.GetSourceMotion());
-            const float timeBetweenFrames = newMotionTime - lowestCostFrame.GetSampleTime();
-            const bool sameLocation = sameMotion && (AZ::GetAbs(timeBetweenFrames) < 0.1f);
+                const float searchTime = timer.GetDeltaTimeInSeconds();
+                ImGuiMonitorRequestBus::Broadcast(&ImGuiMonitorRequests::PushPerformanceHistogramValue, "FindLowestCostFrameIndex", searchTime * 1000.0f);
+                DebugPushSearchCosts(result);
 
-            if (lowestCostFrameIndex != currentFrameIndex && !sameLocation)
-            {
-                // Start a blend.
-                m_blending = true;
-                m_blendWeight = 0.0f;
-                m_blendProgressTime = 0.0f;
-
-                // Store the current motion instance state, so we can sample this as source pose.
-                m_prevMotionInstance->SetMotion(m_motionInstance->GetMotion());
-                m_prevMotionInstance->SetMirrorMotion(m_motionInstance->GetMirrorMotion());
-                m_prevMotionInstance->SetCurrentTime(newMotionTime);
-                m_prevMotionInstance->SetLastCurrentTime(m_prevMotionInstance->GetCurrentTime() - timePassedInSeconds);
-
-                m_lowestCostFrameIndex = lowestCostFrameIndex;
-
-                m_motionInstance->SetMotion(lowestCostFrame.GetSourceMotion());
-                m_motionInstance->SetMirrorMotion(lowestCostFrame.GetMirrored());
-
-                // The new motion time will become the current time after this frame while the current time
-                // becomes the last current time. As we just start playing at the search frame, calculate
-                // the last time based on the time delta.
-                m_newMotionTime = lowestCostFrame.GetSampleTime();
-                m_motionInstance->SetCurrentTime(m_newMotionTime - timePassedInSeconds);
+                SwitchToLowestCostFrame(result.m_frameIndex, currentFrameIndex, newMotionTime, timePassedInSeconds);
             }
 
             // Do this always, else wise we search for the lowest cost frame index too many times.
@@ -467,8 +450,8 @@ namespace EMotionFX::MotionMatching
             ImGuiMonitorRequests::FrameDatabaseInfo frameDatabaseInfo{frameDatabase.CalcMemoryUsageInBytes(), frameDatabase.GetNumFrames(), frameDatabase.GetNumUsedMotions(), frameDatabase.GetNumFrames() / (float)frameDatabase.GetSampleRate()};
             ImGuiMonitorRequestBus::Broadcast(&ImGuiMonitorRequests::SetFrameDatabaseInfo, frameDatabaseInfo);
 
-            const KdTree& kdTree = m_data->GetKdTree();
-            ImGuiMonitorRequests::KdTreeInfo kdTreeInfo{kdTree.CalcMemoryUsageInBytes(), kdTree.GetNumNodes(), kdTree.GetNumDimensions()};
+            const FrameSearch& frameSearch = m_data->GetFrameSearch();
+            ImGuiMonitorRequests::KdTreeInfo kdTreeInfo{frameSearch.CalcMemoryUsageInBytes(), frameSearch.GetNumNodes(), frameSearch.GetNumDimensions()};
             ImGuiMonitorRequestBus::Broadcast(&ImGuiMonitorRequests::SetKdTreeInfo, kdTreeInfo);
             
             const FeatureMatrix& featureMatrix = m_data->GetFeatureMatrix();
@@ -478,39 +461,60 @@ namespace EMotionFX::MotionMatching
         }
     }
 
-    size_t MotionMatchingInstance::FindLowestCostFrameIndex(const Feature::QueryVectorContext& queryVectorContext, const Feature::FrameCostContext& frameCostContext)
+    void MotionMatchingInstance::EvaluateQueryPose(float newMotionTime)
     {
-        AZ::Debug::Timer timer;
-        timer.Stamp();
+        AZ_PROFILE_SCOPE(Animation, "MM::EvaluateQueryPose");
 
-        AZ_PROFILE_SCOPE(Animation, "MotionMatchingInstance::FindLowestCostFrameIndex");
+        // Sample the pose for the new motion time as the motion instance has not been updated with the timeDelta from this frame yet.
+        SamplePose(m_motionInstance->GetMotion(), m_queryPose, newMotionTime);
 
-        const FrameDatabase& frameDatabase = m_data->GetFrameDatabase();
-        const FeatureSchema& featureSchema = m_data->GetFeatureSchema();
-        const FeatureTrajectory* trajectoryFeature = m_cachedTrajectoryFeature;
+        // Copy over the motion extraction joint transform from the current pose to the newly sampled pose.
+        // When sampling a motion, the motion extraction joint is in animation space, while we need the query pose to be in world space.
+        // Note: This does not yet take the extraction delta from the current tick into account.
+        if (m_actorInstance->GetActor()->GetMotionExtractionNode())
+        {
+            const Pose* currentPose = m_actorInstance->GetTransformData()->GetCurrentPose();
+            const size_t motionExtractionJointIndex = m_actorInstance->GetActor()->GetMotionExtractionNodeIndex();
+            m_queryPose.SetWorldSpaceTransform(motionExtractionJointIndex,
+                currentPose->GetWorldSpaceTransform(motionExtractionJointIndex));
+        }
+
+        // Calculate the joint velocities for the sampled pose using the same method as we do for the frame database.
+        PoseDataJointVelocities* velocityPoseData = m_queryPose.GetAndPreparePoseData<PoseDataJointVelocities>(m_actorInstance);
+        AnimGraphPosePool& posePool = GetEMotionFX().GetThreadData(m_actorInstance->GetThreadIndex())->GetPosePool();
+        velocityPoseData->CalculateVelocity(m_actorInstance, posePool, m_motionInstance->GetMotion(), newMotionTime, m_cachedTrajectoryFeature->GetRelativeToNodeIndex());
+    }
+
+    void MotionMatchingInstance::BuildQueryVector(const Feature::QueryVectorContext& queryVectorContext)
+    {
+        AZ_PROFILE_SCOPE(Animation, "MM::BuildQueryVector");
 
-        // 1. Build query vector
+        // Build the input query features that will be compared to every entry in the feature database in the motion matching search.
+        AZ_Assert(m_queryVector.GetSize() == aznumeric_cast<size_t>(m_data->GetFeatureMatrix().cols()),
+            "The query vector should have the same number of elements as the feature matrix has columns.");
+        for (Feature* feature : m_data->GetFeatureSchema().GetFeatures())
         {
-            AZ_PROFILE_SCOPE(Animation, "MM::BuildQueryVector");
+            feature->FillQueryVector(m_queryVector, queryVectorContext);
+        }
 
-            // Build the input query features that will be compared to every entry in the feature database in the motion matching search.
-            AZ_Assert(m_queryVector.GetSize() == aznumeric_cast<size_t>(m_data->GetFeatureMatrix().cols()),
-                "The query vector should have the same number of elements as the feature matrix has columns.");
-            for (Feature* feature : featureSchema.GetFeatures())
-            {
-                feature->FillQueryVector(m_queryVector, queryVectorContext);
-            }
+        if (FeatureMatrixTransformer* transformer = queryVectorContext.m_featureTransformer)
+        {
+            transformer->Transform(m_queryVector.GetData());
+        }
+    }
 
-            if (FeatureMatrixTransformer* transformer = queryVectorContext.m_featureTransformer)
-            {
-                transformer->Transform(m_queryVector.GetData());
-            }
+    MotionMatchingInstance::SearchResult MotionMatchingInstance::FindLowestCostFrame(bool useBroadPhase)
+    {
+        AZ_PROFILE_SCOPE(Animation, "MotionMatchingInstance::FindLowestCostFrame");
+
+        if (!useBroadPhase)
+        {
+            return FindLowestCostFrameInRange(0, m_data->GetFrameDatabase().GetNumFrames());
         }
 
-        // 2. Broad-phase search using KD-tree
-        if (mm_useKdTree)
+        // 1. Broad-phase search using the search backend picked for the motion database
         {
-            AZ_PROFILE_SCOPE(Animation, "MM::BroadPhaseKDTree");
+            AZ_PROFILE_SCOPE(Animation, "MM::BroadPhaseSearch");
 
             AZStd::vector<float>& kdTreeQueryVector = m_kdTreeQueryVector.GetData();
             const AZStd::vector<float>& queryVectorData = m_queryVector.GetData();
@@ -525,104 +529,144 @@ namespace EMotionFX::MotionMatching
             AZ_Assert(startOffset == kdTreeQueryVector.size(), "Frame float vector is not the expected size.");
 
             // Find our nearest frames.
-            m_data->GetKdTree().FindNearestNeighbors(kdTreeQueryVector, m_nearestFrames);
+            m_data->GetFrameSearch().FindNearestNeighbors(kdTreeQueryVector, m_nearestFrames, m_frameSearchBuffers);
         }
 
-        // 2. Narrow-phase, brute force find the actual best matching frame (frame with the minimal cost).
-        float minCost = FLT_MAX;
-        size_t minCostFrameIndex = 0;
-        m_tempCosts.resize(featureSchema.GetNumFeatures());
-        m_minCosts.resize(featureSchema.GetNumFeatures());
-        float minTrajectoryPastCost = 0.0f;
-        float minTrajectoryFutureCost = 0.0f;
-
-        // Iterate through the frames filtered by the broad-phase search.
-        const size_t numFrames = mm_useKdTree ? m_nearestFrames.size() : frameDatabase.GetNumFrames();
-        for (size_t i = 0; i < numFrames; ++i)
+        // 2. Narrow-phase, brute force find the actual best matching frame (frame with the minimal cost) among the frames filtered by the broad-phase search.
+        AZ_PROFILE_SCOPE(Animation, "MM::NarrowPhaseSearch");
+        const Feature::FrameCostContext frameCostContext(m_queryVector, m_data->GetFeatureMatrix());
+        SearchResult result;
+        for (const size_t frameIndex : m_nearestFrames)
         {
-            const size_t frameIndex = mm_useKdTree ? m_nearestFrames[i] : i;
-            const Frame& frame = frameDatabase.GetFrame(frameIndex);
+            result.Merge({ frameIndex, CalculateFrameCost(frameIndex, frameCostContext) });
+        }
+        return result;
+    }
 
-            // TODO: This shouldn't be there, we should be discarding the frames when extracting the features and not at runtime when checking the cost.
-            if (frame.GetSampleTime() >= frame.GetSourceMotion()->GetDuration() - 1.0f)
-            {
-                continue;
-            }
+    MotionMatchingInstance::SearchResult MotionMatchingInstance::FindLowestCostFrameInRange(size_t startFrame, size_t endFrame) const
+    {
+        AZ_PROFILE_SCOPE(Animation, "MM::NarrowPhaseSearch");
 
-            float frameCost = 0.0f;
+        const Feature::FrameCostContext frameCostContext(m_queryVector, m_data->GetFeatureMatrix());
+        SearchResult result;
+        for (size_t frameIndex = startFrame; frameIndex < endFrame; ++frameIndex)
+        {
+            result.Merge({ frameIndex, CalculateFrameCost(frameIndex, frameCostContext) });
+        }
+        return result;
+    }
 
-            // Calculate the frame cost by accumulating the weighted feature costs.
-            for (size_t featureIndex = 0; featureIndex < featureSchema.GetNumFeatures(); ++featureIndex)
-            {
-                Feature* feature = featureSchema.GetFeature(featureIndex);
-                if (feature->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
-                {
-                    const float featureCost = feature->CalculateFrameCost(frameIndex, frameCostContext);
-                    const float featureCostFactor = feature->GetCostFactor();
-                    const float featureFinalCost = featureCost * featureCostFactor;
+    float MotionMatchingInstance::CalculateFrameCost(size_t frameIndex, const Feature::FrameCostContext& frameCostContext) const
+    {
+        const Frame& frame = m_data->GetFrameDatabase().GetFrame(frameIndex);
 
-                    frameCost += featureFinalCost;
-                    m_tempCosts[featureIndex] = featureFinalCost;
-                }
-            }
+        // TODO: This shouldn't be there, we should be discarding the frames when extracting the features and not at runtime when checking the cost.
+        if (frame.GetSampleTime() >= frame.GetSourceMotion()->GetDuration() - 1.0f)
+        {
+            return FLT_MAX;
+        }
+
+        float frameCost = 0.0f;
 
-            // Manually add the trajectory cost.
-            float trajectoryPastCost = 0.0f;
-            float trajectoryFutureCost = 0.0f;
-            if (trajectoryFeature)
+        // Calculate the frame cost by accumulating the weighted feature costs.
+        const FeatureSchema& featureSchema = m_data->GetFeatureSchema();
+        for (size_t featureIndex = 0; featureIndex < featureSchema.GetNumFeatures(); ++featureIndex)
+        {
+            const Feature* feature = featureSchema.GetFeature(featureIndex);
+            if (feature->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
             {
-                trajectoryPastCost = trajectoryFeature->CalculatePastFrameCost(frameIndex, frameCostContext) * trajectoryFeature->GetPastCostFactor();
-                trajectoryFutureCost = trajectoryFeature->CalculateFutureFrameCost(frameIndex, frameCostContext) * trajectoryFeature->GetFutureCostFactor();
-                frameCost += trajectoryPastCost;
-                frameCost += trajectoryFutureCost;
+                frameCost += feature->CalculateFrameCost(frameIndex, frameCostContext) * feature->GetCostFactor();
             }
+        }
 
-            // Track the minimum feature and frame costs.
-            if (frameCost < minCost)
-            {
-                minCost = frameCost;
-                minCostFrameIndex = frameIndex;
+        // Manually add the trajectory cost.
+        if (const FeatureTrajectory* trajectoryFeature = m_cachedTrajectoryFeature)
+        {
+            frameCost += trajectoryFeature->CalculatePastFrameCost(frameIndex, frameCostContext) * trajectoryFeature->GetPastCostFactor();
+            frameCost += trajectoryFeature->CalculateFutureFrameCost(frameIndex, frameCostContext) * trajectoryFeature->GetFutureCostFactor();
+        }
 
-                for (size_t featureIndex = 0; featureIndex < featureSchema.GetNumFeatures(); ++featureIndex)
-                {
-                    Feature* feature = featureSchema.GetFeature(featureIndex);
-                    if (feature->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
-                    {
-                        m_minCosts[featureIndex] = m_tempCosts[featureIndex];
-                    }
-                }
+        return frameCost;
+    }
 
-                minTrajectoryPastCost = trajectoryPastCost;
-                minTrajectoryFutureCost = trajectoryFutureCost;
-            }
+    void MotionMatchingInstance::OnBatchedSearchFinished(const SearchResult& result)
+    {
+        m_batchedSearchResult = result;
+        m_batchedSearchPending = false;
+        m_hasBatchedSearchResult = true;
+
+        DebugPushSearchCosts(result);
+    }
+
+    void MotionMatchingInstance::SwitchToLowestCostFrame(size_t lowestCostFrameIndex, size_t currentFrameIndex, float newMotionTime, float timePassedInSeconds)
+    {
+        // All frames got discarded.
+        if (lowestCostFrameIndex == InvalidIndex)
+        {
+            return;
         }
 
-        // 3. ImGui debug visualization
+        const FrameDatabase& frameDatabase = m_data->GetFrameDatabase();
+        const Frame& currentFrame = frameDatabase.GetFrame(currentFrameIndex);
+        const Frame& lowestCostFrame = frameDatabase.GetFrame(lowestCostFrameIndex);
+        const bool sameMotion = (currentFrame.GetSourceMotion() == lowestCostFrame.GetSourceMotion());
+        const float timeBetweenFrames = newMotionTime - lowestCostFrame.GetSampleTime();
+        const bool sameLocation = sameMotion && (AZ::GetAbs(timeBetweenFrames) < 0.1f);
+
+        if (lowestCostFrameIndex != currentFrameIndex && !sameLocation)
         {
-            const float time = timer.GetDeltaTimeInSeconds();
-            ImGuiMonitorRequestBus::Broadcast(&ImGuiMonitorRequests::PushPerformanceHistogramValue, "FindLowestCostFrameIndex", time * 1000.0f);
+            // Start a blend.
+            m_blending = true;
+            m_blendWeight = 0.0f;
+            m_blendProgressTime = 0.0f;
 
-            for (size_t featureIndex = 0; featureIndex < featureSchema.GetNumFeatures(); ++featureIndex)
-            {
-                Feature* feature = featureSchema.GetFeature(featureIndex);
-                if (feature->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
-                {
-                    ImGuiMonitorRequestBus::Broadcast(&ImGuiMonitorRequests::PushCostHistogramValue,
-                        feature->GetName().c_str(),
-                        m_minCosts[featureIndex],
-                        feature->GetDebugDrawColor());
-                }
-            }
+            // Store the current motion instance state, so we can sample this as source pose.
+            m_prevMotionInstance->SetMotion(m_motionInstance->GetMotion());
+            m_prevMotionInstance->SetMirrorMotion(m_motionInstance->GetMirrorMotion());
+            m_prevMotionInstance->SetCurrentTime(newMotionTime);
+            m_prevMotionInstance->SetLastCurrentTime(m_prevMotionInstance->GetCurrentTime() - timePassedInSeconds);
+
+            m_lowestCostFrameIndex = lowestCostFrameIndex;
 
-            if (trajectoryFeature)
+            m_motionInstance->SetMotion(lowestCostFrame.GetSourceMotion());
+            m_motionInstance->SetMirrorMotion(lowestCostFrame.GetMirrored());
+
+            // The new motion time will become the current time after this frame while the current time
+            // becomes the last current time. As we just start playing at the search frame, calculate
+            // the last time based on the time delta.
+            m_newMotionTime = lowestCostFrame.GetSampleTime();
+            m_motionInstance->SetCurrentTime(m_newMotionTime - timePassedInSeconds);
+        }
+    }
+
+    void MotionMatchingInstance::DebugPushSearchCosts(const SearchResult& result) const
+    {
+        if (result.m_frameIndex == InvalidIndex)
+        {
+            return;
+        }
+
+        // Only the costs of the found frame are shown, so they are calculated again here rather than tracked for every frame during the search.
+        const Feature::FrameCostContext frameCostContext(m_queryVector, m_data->GetFeatureMatrix());
+        for (const Feature* feature : m_data->GetFeatureSchema().GetFeatures())
+        {
+            if (feature->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
             {
-                ImGuiMonitorRequestBus::Broadcast(&ImGuiMonitorRequests::PushCostHistogramValue, "Future Trajectory", minTrajectoryFutureCost, trajectoryFeature->GetDebugDrawColor());
-                ImGuiMonitorRequestBus::Broadcast(&ImGuiMonitorRequests::PushCostHistogramValue, "Past Trajectory", minTrajectoryPastCost, trajectoryFeature->GetDebugDrawColor());
+                ImGuiMonitorRequestBus::Broadcast(&ImGuiMonitorRequests::PushCostHistogramValue,
+                    feature->GetName().c_str(),
+                    feature->CalculateFrameCost(result.m_frameIndex, frameCostContext) * feature->GetCostFactor(),
+                    feature->GetDebugDrawColor());
             }
+        }
 
-            ImGuiMonitorRequestBus::Broadcast(&ImGuiMonitorRequests::PushCostHistogramValue, "Total Cost", minCost, AZ::Color::CreateFromRgba(202,255,191,255));
+        if (const FeatureTrajectory* trajectoryFeature = m_cachedTrajectoryFeature)
+        {
+            const float futureCost = trajectoryFeature->CalculateFutureFrameCost(result.m_frameIndex, frameCostContext) * trajectoryFeature->GetFutureCostFactor();
+            const float pastCost = trajectoryFeature->CalculatePastFrameCost(result.m_frameIndex, frameCostContext) * trajectoryFeature->GetPastCostFactor();
+            ImGuiMonitorRequestBus::Broadcast(&ImGuiMonitorRequests::PushCostHistogramValue, "Future Trajectory", futureCost, trajectoryFeature->GetDebugDrawColor());
+            ImGuiMonitorRequestBus::Broadcast(&ImGuiMonitorRequests::PushCostHistogramValue, "Past Trajectory", pastCost, trajectoryFeature->GetDebugDrawColor());
         }
 
-        return minCostFrameIndex;
+        ImGuiMonitorRequestBus::Broadcast(&ImGuiMonitorRequests::PushCostHistogramValue, "Total Cost", result.m_cost, AZ::Color::CreateFromRgba(202,255,191,255));
     }
 } // namespace EMotionFX::MotionMatching
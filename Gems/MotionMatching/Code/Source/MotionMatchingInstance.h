@@ -14,6 +14,7 @@
 
 #include <EMotionFX/Source/EMotionFXConfig.h>
 #include <Feature.h>
+#include <FrameSearch.h>
 #include <TrajectoryHistory.h>
 #include <TrajectoryQuery.h>
 
@@ -40,6 +41,8 @@ namespace EMotionFX::MotionMatching
     class EMFX_API MotionMatchingInstance
         : public DebugDrawRequestBus::Handler
     {
+        friend class MotionMatchingSearchBatchFixture;
+
     public:
         AZ_RTTI(MotionMatchingInstance, "{1ED03AD8-0FB2-431B-AF01-02F7E930EB73}")
         AZ_CLASS_ALLOCATOR_DECL
@@ -47,6 +50,23 @@ namespace EMotionFX::MotionMatching
         MotionMatchingInstance() = default;
         virtual ~MotionMatchingInstance();
 
+        //! Result of a lowest cost frame search.
+        struct EMFX_API SearchResult
+        {
+            //! Keep the result with the lower cost. Ties keep the current result, so merging partial results in frame order picks the
+            //! same frame as a single search over all frames.
+            void Merge(const SearchResult& other)
+            {
+                if (other.m_cost < m_cost)
+                {
+                    *this = other;
+                }
+            }
+
+            size_t m_frameIndex = InvalidIndex;
+            float m_cost = FLT_MAX;
+        };
+
         struct EMFX_API InitSettings
         {
             ActorInstance* m_actorInstance = nullptr;
@@ -72,6 +92,19 @@ namespace EMotionFX::MotionMatching
         ActorInstance* GetActorInstance() const { return m_actorInstance; }
         MotionMatchingData* GetData() const { return m_data; }
 
+        //! Search the lowest cost frame for the current query vector.
+        //! Only touches the search buffers of this instance, so searches of different instances can run in parallel.
+        //! @param[in] useBroadPhase Filter the frames with the broad-phase search first and only calculate the costs for the candidates.
+        SearchResult FindLowestCostFrame(bool useBroadPhase);
+
+        //! Calculate the costs for the frames in the range [startFrame, endFrame) against the current query vector and return the lowest one.
+        SearchResult FindLowestCostFrameInRange(size_t startFrame, size_t endFrame) const;
+
+        //! Called by the search batch once the search submitted during the last update finished.
+        //! The result gets applied with the next update.
+        void OnBatchedSearchFinished(const SearchResult& result);
+        bool IsBatchedSearchPending() const { return m_batchedSearchPending; }
+
         size_t GetLowestCostFrameIndex() const { return m_lowestCostFrameIndex; }
         void SetLowestCostSearchFrequency(float frequency) { m_lowestCostSearchFrequency = frequency; }
         float GetNewMotionTime() const { return m_newMotionTime; }
@@ -89,7 +122,15 @@ namespace EMotionFX::MotionMatching
         void SamplePose(MotionInstance* motionInstance, Pose& outputPose);
         void SamplePose(Motion* motion, Pose& outputPose, float sampleTime) const;
 
-        size_t FindLowestCostFrameIndex(const Feature::QueryVectorContext& queryVectorContext, const Feature::FrameCostContext& frameCostContext);
+        void EvaluateQueryPose(float newMotionTime);
+        void BuildQueryVector(const Feature::QueryVectorContext& queryVectorContext);
+        float CalculateFrameCost(size_t frameIndex, const Feature::FrameCostContext& frameCostContext) const;
+
+        //! Start blending towards the lowest cost frame in case it differs from the currently playing one.
+        void SwitchToLowestCostFrame(size_t lowestCostFrameIndex, size_t currentFrameIndex, float newMotionTime, float timePassedInSeconds);
+
+        //! Push the cost break-down of the found frame to the ImGui monitor.
+        void DebugPushSearchCosts(const SearchResult& result) const;
 
         MotionMatchingData* m_data = nullptr;
         ActorInstance* m_actorInstance = nullptr;
@@ -102,9 +143,10 @@ namespace EMotionFX::MotionMatching
 
         QueryVector m_queryVector; //!< The input query features to be compared to every entry/row in the feature matrix with the motion matching search.
 
-        /// Buffers used for the broad-phase KD-tree search.
-        QueryVector m_kdTreeQueryVector; //!< The input query for only the features that are present in the KD-tree.
-        AZStd::vector<size_t> m_nearestFrames; //!< Stores the nearest matching frames / search result from the KD-tree.
+        /// Buffers used for the broad-phase search.
+        QueryVector m_kdTreeQueryVector; //!< The input query for only the features that are present in the broad-phase search.
+        AZStd::vector<size_t> m_nearestFrames; //!< Stores the nearest matching frames / search result from the broad-phase search.
+        FrameSearch::SearchBuffers m_frameSearchBuffers; //!< Scratch memory for the broad-phase search.
 
         FeatureTrajectory* m_cachedTrajectoryFeature = nullptr; //< Cached pointer to the trajectory feature in the feature schema.
         TrajectoryQuery m_trajectoryQuery;
@@ -120,8 +162,9 @@ namespace EMotionFX::MotionMatching
         float m_blendWeight = 1.0f;
         float m_blendProgressTime = 0.0f; //< How long are we already blending? In seconds.
 
-        /// Buffers used for FindLowestCostFrameIndex().
-        AZStd::vector<float> m_tempCosts;
-        AZStd::vector<float> m_minCosts;
+        /// State of the batched search, see MotionMatchingSearchBatch.
+        SearchResult m_batchedSearchResult; //!< Result of the last batched search, waiting to be applied with the next update.
+        bool m_batchedSearchPending = false; //!< The search is submitted to the batch and did not run yet.
+        bool m_hasBatchedSearchResult = false;
     };
 } // namespace EMotionFX::MotionMatching
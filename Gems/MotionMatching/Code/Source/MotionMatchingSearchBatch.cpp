@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Debug/Timer.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+#include <Allocators.h>
+#include <FrameDatabase.h>
+#include <ImGuiMonitorBus.h>
+#include <MotionMatchingData.h>
+#include <MotionMatchingSearchBatch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZ_CVAR_EXTERNED(bool, mm_useKdTree);
+
+    AZ_CLASS_ALLOCATOR_IMPL(MotionMatchingSearchBatch, MotionMatchAllocator, 0)
+
+    void MotionMatchingSearchBatch::Submit(MotionMatchingInstance* instance)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_pendingInstances.emplace_back(instance);
+    }
+
+    void MotionMatchingSearchBatch::Cancel(MotionMatchingInstance* instance)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_pendingInstances.erase(AZStd::remove(m_pendingInstances.begin(), m_pendingInstances.end(), instance), m_pendingInstances.end());
+    }
+
+    size_t MotionMatchingSearchBatch::GetNumPendingSearches() const
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return m_pendingInstances.size();
+    }
+
+    void MotionMatchingSearchBatch::Process()
+    {
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            m_instances.swap(m_pendingInstances);
+        }
+
+        if (m_instances.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Animation, "MotionMatchingSearchBatch::Process");
+
+        AZ::Debug::Timer timer;
+        timer.Stamp();
+
+        const bool useBroadPhase = mm_useKdTree;
+
+        // Sort the instances by their motion matching data, so that searches over the same feature matrix end up next to each other.
+        AZStd::sort(m_instances.begin(), m_instances.end(),
+            [](const MotionMatchingInstance* instanceA, const MotionMatchingInstance* instanceB)
+            {
+                return instanceA->GetData() < instanceB->GetData();
+            });
+
+        m_tasks.clear();
+        size_t firstInstance = 0;
+        while (firstInstance < m_instances.size())
+        {
+            const MotionMatchingData* data = m_instances[firstInstance]->GetData();
+            size_t endInstance = firstInstance + 1;
+            while (endInstance < m_instances.size() && m_instances[endInstance]->GetData() == data)
+            {
+                endInstance++;
+            }
+
+            AddSearchTasks(firstInstance, endInstance - firstInstance, useBroadPhase);
+            firstInstance = endInstance;
+        }
+
+        const size_t numTaskResults = m_tasks.empty() ? 0 : m_tasks.back().m_firstResult + m_tasks.back().m_numInstances;
+        m_taskResults.assign(numTaskResults, MotionMatchingInstance::SearchResult{});
+
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        const bool useTaskGraph = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
+        if (m_tasks.size() == 1)
+        {
+            ProcessSearchTask(m_tasks[0], useBroadPhase);
+        }
+        else if (useTaskGraph)
+        {
+            AZ::TaskGraph taskGraph{ "MotionMatching Search" };
+            for (const SearchTask& task : m_tasks)
+            {
+                AZ::TaskDescriptor taskDescriptor{ "FindLowestCostFrames", "MotionMatching" };
+                taskGraph.AddTask(
+                    taskDescriptor,
+                    [this, &task, useBroadPhase]()
+                    {
+                        ProcessSearchTask(task, useBroadPhase);
+                    });
+            }
+
+            AZ::TaskGraphEvent finishedEvent{ "MotionMatching Search Wait" };
+            taskGraph.Submit(&finishedEvent);
+            finishedEvent.Wait();
+        }
+        else // job system
+        {
+            AZ::JobCompletion jobCompletion;
+            for (const SearchTask& task : m_tasks)
+            {
+                AZ::JobContext* jobContext = nullptr;
+                AZ::Job* job = AZ::CreateJobFunction([this, &task, useBroadPhase]()
+                    {
+                        ProcessSearchTask(task, useBroadPhase);
+                    }, /*isAutoDelete=*/true, jobContext);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+
+            jobCompletion.StartAndWaitForCompletion();
+        }
+
+        // Merge the results of the tasks. The frame ranges got added in order, so ties resolve to the same frame a single search would pick.
+        m_results.assign(m_instances.size(), MotionMatchingInstance::SearchResult{});
+        for (const SearchTask& task : m_tasks)
+        {
+            for (size_t i = 0; i < task.m_numInstances; ++i)
+            {
+                m_results[task.m_firstInstance + i].Merge(m_taskResults[task.m_firstResult + i]);
+            }
+        }
+
+        for (size_t i = 0; i < m_instances.size(); ++i)
+        {
+            m_instances[i]->OnBatchedSearchFinished(m_results[i]);
+        }
+
+        const float searchTime = timer.GetDeltaTimeInSeconds();
+        ImGuiMonitorRequestBus::Broadcast(&ImGuiMonitorRequests::PushPerformanceHistogramValue, "Batched Search", searchTime * 1000.0f);
+
+        m_instances.clear();
+    }
+
+    void MotionMatchingSearchBatch::AddSearchTasks(size_t firstInstance, size_t numInstances, bool useBroadPhase)
+    {
+        size_t firstResult = m_tasks.empty() ? 0 : m_tasks.back().m_firstResult + m_tasks.back().m_numInstances;
+
+        if (useBroadPhase)
+        {
+            // The broad-phase narrows each search down to a small set of candidate frames, split up the searches.
+            for (size_t taskInstance = 0; taskInstance < numInstances; taskInstance += s_numInstancesPerTask)
+            {
+                SearchTask& task = m_tasks.emplace_back();
+                task.m_firstInstance = firstInstance + taskInstance;
+                task.m_numInstances = AZStd::min(s_numInstancesPerTask, numInstances - taskInstance);
+                task.m_firstResult = firstResult;
+                firstResult += task.m_numInstances;
+            }
+        }
+        else
+        {
+            // Every search compares against all frames, split up the feature matrix instead and compare all queries against each range.
+            const size_t numFrames = m_instances[firstInstance]->GetData()->GetFrameDatabase().GetNumFrames();
+            for (size_t startFrame = 0; startFrame < numFrames; startFrame += s_numFramesPerTask)
+            {
+                SearchTask& task = m_tasks.emplace_back();
+                task.m_firstInstance = firstInstance;
+                task.m_numInstances = numInstances;
+                task.m_startFrame = startFrame;
+                task.m_endFrame = AZStd::min(startFrame + s_numFramesPerTask, numFrames);
+                task.m_firstResult = firstResult;
+                firstResult += numInstances;
+            }
+        }
+    }
+
+    void MotionMatchingSearchBatch::ProcessSearchTask(const SearchTask& task, bool useBroadPhase)
+    {
+        AZ_PROFILE_SCOPE(Animation, "MotionMatchingSearchBatch::ProcessSearchTask");
+
+        for (size_t i = 0; i < task.m_numInstances; ++i)
+        {
+            MotionMatchingInstance* instance = m_instances[task.m_firstInstance + i];
+            m_taskResults[task.m_firstResult + i] = useBroadPhase
+                ? instance->FindLowestCostFrame(/*useBroadPhase=*/true)
+                : instance->FindLowestCostFrameInRange(task.m_startFrame, task.m_endFrame);
+        }
+    }
+} // namespace EMotionFX::MotionMatching
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <MotionMatchingInstance.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Gathers the lowest cost frame searches of the motion matching instances during the anim graph updates and runs all of them
+    //! together once per frame in a single task graph.
+    //! Searches of instances that share the same motion matching data get processed next to each other, so that the feature matrix and
+    //! the broad-phase search structure are still in the cache for the next search. When the broad-phase search is disabled, the feature
+    //! matrix gets split into ranges of frames instead and each task compares all queries of the group against its range.
+    //! The instances apply the results with their next update, which delays the frame switches by one frame.
+    class EMFX_API MotionMatchingSearchBatch
+    {
+    public:
+        AZ_RTTI(MotionMatchingSearchBatch, "{5C2E9A41-8D7B-4F36-B0E5-19A4C7D3F862}")
+        AZ_CLASS_ALLOCATOR_DECL
+
+        MotionMatchingSearchBatch() = default;
+        virtual ~MotionMatchingSearchBatch() = default;
+
+        //! Queue the search for the given instance. The query vector of the instance has to be ready already.
+        //! Thread-safe, as anim graphs of different actor instances update in parallel.
+        void Submit(MotionMatchingInstance* instance);
+
+        //! Remove an instance from the queue, e.g. in case it gets destroyed before its search ran. Thread-safe.
+        void Cancel(MotionMatchingInstance* instance);
+
+        //! Run all queued searches, wait for them to finish and hand the results back to the instances.
+        //! Call this once per frame after the anim graphs got updated.
+        void Process();
+
+        size_t GetNumPendingSearches() const;
+
+    private:
+        struct SearchTask
+        {
+            size_t m_firstInstance = 0; //!< Index of the first instance in m_instances.
+            size_t m_numInstances = 0;
+            size_t m_startFrame = 0; //!< Range of frames to compare, only used without broad-phase search.
+            size_t m_endFrame = 0;
+            size_t m_firstResult = 0; //!< Index of the first result in m_taskResults, one per instance.
+        };
+
+        void AddSearchTasks(size_t firstInstance, size_t numInstances, bool useBroadPhase);
+        void ProcessSearchTask(const SearchTask& task, bool useBroadPhase);
+
+        static constexpr size_t s_numInstancesPerTask = 4; //!< Number of searches per task when using the broad-phase search.
+        static constexpr size_t s_numFramesPerTask = 2048; //!< Number of frames per task when comparing against all frames.
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::vector<MotionMatchingInstance*> m_pendingInstances; //!< Instances that submitted a search since the last processing.
+
+        /// Buffers used while processing the batch.
+        AZStd::vector<MotionMatchingInstance*> m_instances;
+        AZStd::vector<SearchTask> m_tasks;
+        AZStd::vector<MotionMatchingInstance::SearchResult> m_taskResults;
+        AZStd::vector<MotionMatchingInstance::SearchResult> m_results;
+    };
+
+    using MotionMatchingSearchBatchInterface = AZ::Interface<MotionMatchingSearchBatch>;
+} // namespace EMotionFX::MotionMatching
@@ -45,6 +45,14 @@ namespace EMotionFX::MotionMatching
         "Use Kd-Tree to accelerate the motion matching search for the best next matching frame. "
         "Disabling it will heavily slow down performance and should only be done for debugging purposes");
 
+    AZ_CVAR(AZ::u32, mm_maxQuantizedSearchFrames, 32768, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Motion databases with up to this number of frames use a brute-force scan over quantized feature values for the broad-phase search, "
+        "larger ones use the flattened kd-tree. Only used when the automatic search backend is selected. Changes apply when motion matching is re-initialized.");
+
+    AZ_CVAR(bool, mm_batchedSearch, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Gather the lowest cost frame searches of all motion matching instances and run them together once per frame, spread across all cores. "
+        "The search results get applied one frame later.");
+
     AZ_CVAR(bool, mm_multiThreadedInitialization, true, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Use multi-threading to initialize motion matching.");
 
@@ -122,6 +130,11 @@ namespace EMotionFX::MotionMatching
 
     void MotionMatchingSystemComponent::Activate()
     {
+        if (MotionMatchingSearchBatchInterface::Get() == nullptr)
+        {
+            MotionMatchingSearchBatchInterface::Register(&m_searchBatch);
+        }
+
         MotionMatchingRequestBus::Handler::BusConnect();
         AZ::TickBus::Handler::BusConnect();
 
@@ -144,6 +157,13 @@ namespace EMotionFX::MotionMatching
     {
         AZ::TickBus::Handler::BusDisconnect();
         MotionMatchingRequestBus::Handler::BusDisconnect();
+
+        if (MotionMatchingSearchBatchInterface::Get() == &m_searchBatch)
+        {
+            // Hand out the results of the remaining searches, as the instances won't search again while waiting for them.
+            m_searchBatch.Process();
+            MotionMatchingSearchBatchInterface::Unregister(&m_searchBatch);
+        }
     }
 
     void MotionMatchingSystemComponent::DebugDraw(AZ::s32 debugDisplayId)
@@ -169,6 +189,9 @@ namespace EMotionFX::MotionMatching
 
     void MotionMatchingSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        // The anim graphs got updated already, run the searches they submitted.
+        m_searchBatch.Process();
+
         MotionMatchingSystemComponent::DebugDraw(AzFramework::g_defaultSceneEntityDebugDisplayId);
     }
 } // namespace EMotionFX::MotionMatching
@@ -11,6 +11,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
 #include <MotionMatching/MotionMatchingBus.h>
+#include <MotionMatchingSearchBatch.h>
 
 
 namespace EMotionFX::MotionMatching
@@ -52,5 +53,6 @@ namespace EMotionFX::MotionMatching
         virtual void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
         ////////////////////////////////////////////////////////////////////////
 
+        MotionMatchingSearchBatch m_searchBatch;
     };
 } // namespace EMotionFX::MotionMatching
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Debug/Timer.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+#include <Allocators.h>
+#include <QuantizedFrameSearch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZ_CLASS_ALLOCATOR_IMPL(QuantizedFrameSearch, MotionMatchAllocator, 0)
+
+    static_assert(QuantizedFrameSearch::BlockSize == AZ::Simd::Vec4::ElementCount, "A packed block needs to fill exactly one SIMD register.");
+
+    bool QuantizedFrameSearch::Init([[maybe_unused]] const FrameDatabase& frameDatabase,
+        const FeatureMatrix& featureMatrix,
+        const AZStd::vector<Feature*>& features,
+        const InitSettings& settings)
+    {
+        AZ_PROFILE_SCOPE(Animation, "QuantizedFrameSearch::Init");
+
+#if !defined(_RELEASE)
+        AZ::Debug::Timer timer;
+        timer.Stamp();
+#endif
+
+        Clear();
+
+        const AZStd::vector<size_t> featureColumns = CalcFeatureColumns(features);
+        if (featureColumns.empty())
+        {
+            AZ_Error("Motion Matching", false, "Cannot initialize quantized frame search. There are no feature values to search.");
+            return false;
+        }
+
+        m_numDimensions = featureColumns.size();
+        m_numColumnBlocks = (m_numDimensions + BlockSize - 1) / BlockSize;
+        m_numFrames = featureMatrix.rows();
+        m_numCandidates = AZ::GetMax<size_t>(settings.m_numCandidates, 1);
+
+        const size_t numFrameBlocks = (m_numFrames + BlockSize - 1) / BlockSize;
+        m_packedValues.resize(numFrameBlocks * m_numColumnBlocks * BlockSize, 0);
+
+        // Padding columns dequantize to zero and thus don't add to the distance.
+        m_columnScales.resize(m_numColumnBlocks * BlockSize, 0.0f);
+        m_columnOffsets.resize(m_numColumnBlocks * BlockSize, 0.0f);
+
+        for (size_t dimension = 0; dimension < m_numDimensions; ++dimension)
+        {
+            const size_t column = featureColumns[dimension];
+            float minValue = FLT_MAX;
+            float maxValue = -FLT_MAX;
+            for (size_t frameIndex = 0; frameIndex < m_numFrames; ++frameIndex)
+            {
+                minValue = AZ::GetMin(minValue, featureMatrix(frameIndex, column));
+                maxValue = AZ::GetMax(maxValue, featureMatrix(frameIndex, column));
+            }
+
+            if (m_numFrames == 0)
+            {
+                minValue = maxValue = 0.0f;
+            }
+
+            // Map the value range to [0, 255].
+            const float scale = (maxValue - minValue) / 255.0f;
+            const float invScale = (scale > 0.0f) ? 1.0f / scale : 0.0f;
+
+            // The kernel masks out the column's byte while leaving it in place, so the scale accounts for its position in the lane.
+            // The top byte is stored with its sign bit flipped, as it ends up as the sign of the 32-bit lane.
+            const size_t byteIndex = dimension % BlockSize;
+            const AZ::u32 byteShift = aznumeric_cast<AZ::u32>(byteIndex * 8);
+            const bool isTopByte = (byteIndex == BlockSize - 1);
+            m_columnScales[dimension] = scale / aznumeric_cast<float>(1u << byteShift);
+            m_columnOffsets[dimension] = isTopByte ? minValue + 128.0f * scale : minValue;
+
+            const size_t columnBlock = dimension / BlockSize;
+            for (size_t frameIndex = 0; frameIndex < m_numFrames; ++frameIndex)
+            {
+                const float normalizedValue = (featureMatrix(frameIndex, column) - minValue) * invScale;
+                AZ::u32 quantizedValue = aznumeric_cast<AZ::u32>(AZ::GetClamp(normalizedValue + 0.5f, 0.0f, 255.0f));
+                if (isTopByte)
+                {
+                    quantizedValue ^= 0x80;
+                }
+
+                AZ::s32& lane = m_packedValues[((frameIndex / BlockSize) * m_numColumnBlocks + columnBlock) * BlockSize + frameIndex % BlockSize];
+                lane = static_cast<AZ::s32>(static_cast<AZ::u32>(lane) | (quantizedValue << byteShift));
+            }
+        }
+
+#if !defined(_RELEASE)
+        const float initTime = timer.GetDeltaTimeInSeconds();
+        AZ_TracePrintf("Motion Matching", "Quantized frame search initialized in %.2f ms (numFrames = %zu  numDims = %zu  Memory used = %.2f MB).",
+            initTime * 1000.0f,
+            m_numFrames,
+            m_numDimensions,
+            static_cast<float>(CalcMemoryUsageInBytes()) / 1024.0f / 1024.0f);
+#endif
+        return true;
+    }
+
+    void QuantizedFrameSearch::Clear()
+    {
+        m_packedValues.clear();
+        m_columnScales.clear();
+        m_columnOffsets.clear();
+        m_numDimensions = 0;
+        m_numColumnBlocks = 0;
+        m_numFrames = 0;
+    }
+
+    bool QuantizedFrameSearch::IsInitialized() const
+    {
+        return (m_numDimensions != 0);
+    }
+
+    size_t QuantizedFrameSearch::GetNumNodes() const
+    {
+        return 0;
+    }
+
+    size_t QuantizedFrameSearch::GetNumDimensions() const
+    {
+        return m_numDimensions;
+    }
+
+    size_t QuantizedFrameSearch::CalcMemoryUsageInBytes() const
+    {
+        size_t totalBytes = sizeof(QuantizedFrameSearch);
+        totalBytes += m_packedValues.capacity() * sizeof(AZ::s32);
+        totalBytes += m_columnScales.capacity() * sizeof(float);
+        totalBytes += m_columnOffsets.capacity() * sizeof(float);
+        return totalBytes;
+    }
+
+    void QuantizedFrameSearch::CalcDistances(const AZStd::vector<float>& frameFloats, SearchBuffers& buffers) const
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        AZ_Assert(frameFloats.size() == m_numDimensions, "The query vector doesn't match the number of dimensions of the quantized frame search.");
+
+        // Fold the query values into the dequantization offsets, so the kernel directly gets the difference to the query.
+        AZStd::vector<float>& queryOffsets = buffers.m_queryOffsets;
+        queryOffsets.resize(m_columnOffsets.size());
+        for (size_t column = 0; column < m_columnOffsets.size(); ++column)
+        {
+            queryOffsets[column] = m_columnOffsets[column] - ((column < m_numDimensions) ? frameFloats[column] : 0.0f);
+        }
+
+        const Vec4::Int32Type byteMasks[BlockSize] = {
+            Vec4::Splat(static_cast<int32_t>(0x000000FFu)),
+            Vec4::Splat(static_cast<int32_t>(0x0000FF00u)),
+            Vec4::Splat(static_cast<int32_t>(0x00FF0000u)),
+            Vec4::Splat(static_cast<int32_t>(0xFF000000u))
+        };
+
+        const size_t numFrameBlocks = (m_numFrames + BlockSize - 1) / BlockSize;
+        AZStd::vector<float>& distances = buffers.m_distances;
+        distances.resize(numFrameBlocks * BlockSize);
+
+        const AZ::s32* packedValues = m_packedValues.data();
+        for (size_t frameBlock = 0; frameBlock < numFrameBlocks; ++frameBlock)
+        {
+            Vec4::FloatType distance = Vec4::ZeroFloat();
+            for (size_t columnBlock = 0; columnBlock < m_numColumnBlocks; ++columnBlock, packedValues += BlockSize)
+            {
+                // Each lane holds the four column values of one frame.
+                const Vec4::Int32Type lanes = Vec4::LoadUnaligned(packedValues);
+                for (size_t byteIndex = 0; byteIndex < BlockSize; ++byteIndex)
+                {
+                    const size_t column = columnBlock * BlockSize + byteIndex;
+                    const Vec4::FloatType difference = Vec4::Madd(
+                        Vec4::ConvertToFloat(Vec4::And(lanes, byteMasks[byteIndex])),
+                        Vec4::Splat(m_columnScales[column]),
+                        Vec4::Splat(queryOffsets[column]));
+                    distance = Vec4::Madd(difference, difference, distance);
+                }
+            }
+            Vec4::StoreUnaligned(&distances[frameBlock * BlockSize], distance);
+        }
+    }
+
+    void QuantizedFrameSearch::FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices, SearchBuffers& buffers) const
+    {
+        AZ_PROFILE_SCOPE(Animation, "QuantizedFrameSearch::FindNearestNeighbors");
+        AZ_Assert(IsInitialized(), "Expecting an initialized quantized frame search. Did you forget to call QuantizedFrameSearch::Init()?");
+
+        resultFrameIndices.clear();
+
+        // There is nothing to filter when all frames are candidates.
+        if (m_numFrames <= m_numCandidates)
+        {
+            resultFrameIndices.resize(m_numFrames);
+            for (size_t frameIndex = 0; frameIndex < m_numFrames; ++frameIndex)
+            {
+                resultFrameIndices[frameIndex] = frameIndex;
+            }
+            return;
+        }
+
+        CalcDistances(frameFloats, buffers);
+
+        // Select the closest frames in O(n).
+        const AZStd::vector<float>& distances = buffers.m_distances;
+        AZStd::vector<AZ::u32>& frameOrder = buffers.m_frameOrder;
+        frameOrder.resize(m_numFrames);
+        for (size_t frameIndex = 0; frameIndex < m_numFrames; ++frameIndex)
+        {
+            frameOrder[frameIndex] = aznumeric_cast<AZ::u32>(frameIndex);
+        }
+
+        AZStd::nth_element(frameOrder.begin(), frameOrder.begin() + m_numCandidates, frameOrder.end(),
+            [&distances](AZ::u32 frameA, AZ::u32 frameB)
+            {
+                return distances[frameA] < distances[frameB];
+            });
+
+        resultFrameIndices.assign(frameOrder.begin(), frameOrder.begin() + m_numCandidates);
+    }
+} // namespace EMotionFX::MotionMatching
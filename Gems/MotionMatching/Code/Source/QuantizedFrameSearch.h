@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+#include <FrameSearch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Brute-force search over 8-bit quantized feature values that finds the nearest frames to the query values.
+    //! Every column is quantized separately over its value range. The values are packed so that a single SIMD register holds
+    //! four columns of four consecutive frames, which lets the distance kernel process four frames at once while reading a
+    //! quarter of the memory the float feature matrix would need.
+    //! The distances are approximate, so the number of candidates should leave some slack for the narrow-phase to pick the best frame.
+    class EMFX_API QuantizedFrameSearch
+        : public FrameSearch
+    {
+    public:
+        AZ_RTTI(QuantizedFrameSearch, "{B8E1A7C4-2D6F-4E0B-A5C3-71F9D2E6B804}", FrameSearch);
+        AZ_CLASS_ALLOCATOR_DECL
+
+        //! Number of frames and columns stored per packed block.
+        static constexpr size_t BlockSize = 4;
+
+        QuantizedFrameSearch() = default;
+        ~QuantizedFrameSearch() override = default;
+
+        bool Init(const FrameDatabase& frameDatabase,
+            const FeatureMatrix& featureMatrix,
+            const AZStd::vector<Feature*>& features,
+            const InitSettings& settings) override;
+        void Clear() override;
+        bool IsInitialized() const override;
+
+        size_t GetNumNodes() const override;
+        size_t GetNumDimensions() const override;
+        size_t CalcMemoryUsageInBytes() const override;
+
+        void FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices, SearchBuffers& buffers) const override;
+
+        //! Calculate the approximate squared distances between the query values and all frames into SearchBuffers::m_distances.
+        //! The distances are padded to a multiple of the block size, padded entries are undefined.
+        void CalcDistances(const AZStd::vector<float>& frameFloats, SearchBuffers& buffers) const;
+
+    private:
+        //! Packed quantized values, for each block of frames and each block of columns there are BlockSize 32-bit lanes,
+        //! one per frame, holding the 8-bit values of the columns.
+        AZStd::vector<AZ::s32> m_packedValues;
+
+        //! Per column dequantization, value = offset + scale * (lane & byteMask).
+        //! The scale includes the position of the column's byte inside the lane.
+        AZStd::vector<float> m_columnScales;
+        AZStd::vector<float> m_columnOffsets;
+
+        size_t m_numDimensions = 0;
+        size_t m_numColumnBlocks = 0;
+        size_t m_numFrames = 0;
+        size_t m_numCandidates = 1000;
+    };
+} // namespace EMotionFX::MotionMatching
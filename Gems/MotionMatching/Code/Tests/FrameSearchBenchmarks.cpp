@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Math/Random.h>
+#include <benchmark/benchmark.h>
+
+#include <FeaturePosition.h>
+#include <FrameSearch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Compares the broad-phase search backends over motion databases of different sizes.
+    //! The feature values are random, so the kd-tree sees a worst-case distribution without any clusters.
+    //! The pointer-based kd-tree isn't included as it builds from the frames of imported motions.
+    class FrameSearchBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        void RunFrameSearchBenchmark(benchmark::State& state)
+        {
+            const size_t numFrames = aznumeric_cast<size_t>(state.range(0));
+            const auto searchType = static_cast<FrameSearch::FrameSearchType>(state.range(1));
+
+            // Three 3D position features, which is about what the default feature schema puts into the broad-phase search.
+            constexpr size_t numFeatures = 3;
+            constexpr size_t numColumns = numFeatures * 3;
+            AZStd::vector<Feature*> features;
+            for (size_t i = 0; i < numFeatures; ++i)
+            {
+                Feature* feature = aznew FeaturePosition();
+                feature->SetColumnOffset(i * 3);
+                features.push_back(feature);
+            }
+
+            AZ::SimpleLcgRandom random;
+            FeatureMatrix featureMatrix;
+            featureMatrix.resize(numFrames, numColumns);
+            for (size_t frame = 0; frame < numFrames; ++frame)
+            {
+                for (size_t column = 0; column < numColumns; ++column)
+                {
+                    featureMatrix(frame, column) = random.GetRandomFloat();
+                }
+            }
+
+            FrameDatabase frameDatabase;
+            FrameSearch::InitSettings settings;
+            AZStd::unique_ptr<FrameSearch> frameSearch = FrameSearch::Create(searchType, numFrames);
+            frameSearch->Init(frameDatabase, featureMatrix, features, settings);
+
+            // Use a different query for every search so the results don't stay in the cache.
+            constexpr size_t numQueries = 64;
+            AZStd::vector<AZStd::vector<float>> queries(numQueries, AZStd::vector<float>(numColumns));
+            for (AZStd::vector<float>& query : queries)
+            {
+                for (float& value : query)
+                {
+                    value = random.GetRandomFloat();
+                }
+            }
+
+            FrameSearch::SearchBuffers buffers;
+            AZStd::vector<size_t> result;
+            size_t queryIndex = 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                frameSearch->FindNearestNeighbors(queries[queryIndex], result, buffers);
+                benchmark::DoNotOptimize(result.data());
+                queryIndex = (queryIndex + 1) % numQueries;
+            }
+
+            state.counters["MemoryInMB"] = static_cast<double>(frameSearch->CalcMemoryUsageInBytes()) / 1024.0 / 1024.0;
+
+            frameSearch.reset();
+            for (Feature* feature : features)
+            {
+                delete feature;
+            }
+        }
+    };
+
+    BENCHMARK_DEFINE_F(FrameSearchBenchmarkFixture, BM_FrameSearch)(benchmark::State& state)
+    {
+        RunFrameSearchBenchmark(state);
+    }
+
+    BENCHMARK_REGISTER_F(FrameSearchBenchmarkFixture, BM_FrameSearch)
+        ->ArgNames({ "Frames", "SearchType" })
+        ->Args({ 4096, FrameSearch::FlatKdTreeSearchType })
+        ->Args({ 16384, FrameSearch::FlatKdTreeSearchType })
+        ->Args({ 65536, FrameSearch::FlatKdTreeSearchType })
+        ->Args({ 262144, FrameSearch::FlatKdTreeSearchType })
+        ->Args({ 4096, FrameSearch::QuantizedSearchType })
+        ->Args({ 16384, FrameSearch::QuantizedSearchType })
+        ->Args({ 65536, FrameSearch::QuantizedSearchType })
+        ->Args({ 262144, FrameSearch::QuantizedSearchType })
+        ->Unit(::benchmark::kMicrosecond);
+} // namespace EMotionFX::MotionMatching
+
+#endif
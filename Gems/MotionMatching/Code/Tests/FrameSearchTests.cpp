@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/sort.h>
+
+#include <Fixture.h>
+#include <FeaturePosition.h>
+#include <FlatKdTree.h>
+#include <FrameSearch.h>
+#include <QuantizedFrameSearch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    class FrameSearchFixture
+        : public Fixture
+    {
+    public:
+        void SetUp() override
+        {
+            Fixture::SetUp();
+
+            // Two 3D position features next to each other in the feature matrix.
+            for (size_t i = 0; i < 2; ++i)
+            {
+                Feature* feature = aznew FeaturePosition();
+                feature->SetColumnOffset(i * 3);
+                m_features.push_back(feature);
+            }
+
+            AZ::SimpleLcgRandom random;
+            m_featureMatrix.resize(s_numFrames, 6);
+            for (size_t frame = 0; frame < s_numFrames; ++frame)
+            {
+                for (size_t column = 0; column < 6; ++column)
+                {
+                    m_featureMatrix(frame, column) = random.GetRandomFloat() * 4.0f - 2.0f;
+                }
+            }
+
+            m_query = { 0.25f, -0.5f, 1.0f, -1.5f, 0.0f, 0.75f };
+        }
+
+        void TearDown() override
+        {
+            for (Feature* feature : m_features)
+            {
+                delete feature;
+            }
+            m_features.clear();
+            m_featureMatrix.Clear();
+
+            Fixture::TearDown();
+        }
+
+        float CalcDistance(size_t frame) const
+        {
+            float distance = 0.0f;
+            for (size_t column = 0; column < m_query.size(); ++column)
+            {
+                const float difference = m_featureMatrix(frame, column) - m_query[column];
+                distance += difference * difference;
+            }
+            return distance;
+        }
+
+        //! Returns the frames sorted by their exact distance to the query.
+        AZStd::vector<size_t> SortFramesByDistance() const
+        {
+            AZStd::vector<size_t> frames(s_numFrames);
+            for (size_t frame = 0; frame < s_numFrames; ++frame)
+            {
+                frames[frame] = frame;
+            }
+            AZStd::sort(frames.begin(), frames.end(),
+                [this](size_t frameA, size_t frameB)
+                {
+                    return CalcDistance(frameA) < CalcDistance(frameB);
+                });
+            return frames;
+        }
+
+        static constexpr size_t s_numFrames = 2000;
+        static constexpr size_t s_numCandidates = 50;
+
+        FrameDatabase m_frameDatabase;
+        FeatureMatrix m_featureMatrix;
+        AZStd::vector<Feature*> m_features;
+        AZStd::vector<float> m_query;
+    };
+
+    TEST_F(FrameSearchFixture, FlatKdTreeFindsExactNearestFrames)
+    {
+        FrameSearch::InitSettings settings;
+        settings.m_maxFramesPerLeaf = 16;
+        settings.m_numCandidates = s_numCandidates;
+
+        FlatKdTree flatKdTree;
+        ASSERT_TRUE(flatKdTree.Init(m_frameDatabase, m_featureMatrix, m_features, settings));
+        EXPECT_EQ(flatKdTree.GetNumDimensions(), 6);
+        EXPECT_GT(flatKdTree.GetNumNodes(), 1);
+
+        FrameSearch::SearchBuffers buffers;
+        AZStd::vector<size_t> result;
+        flatKdTree.FindNearestNeighbors(m_query, result, buffers);
+        AZStd::sort(result.begin(), result.end());
+
+        AZStd::vector<size_t> expected = SortFramesByDistance();
+        expected.resize(s_numCandidates);
+        AZStd::sort(expected.begin(), expected.end());
+        EXPECT_EQ(result, expected);
+    }
+
+    TEST_F(FrameSearchFixture, QuantizedSearchApproximatesDistances)
+    {
+        FrameSearch::InitSettings settings;
+        settings.m_numCandidates = s_numCandidates;
+
+        QuantizedFrameSearch quantizedSearch;
+        ASSERT_TRUE(quantizedSearch.Init(m_frameDatabase, m_featureMatrix, m_features, settings));
+        EXPECT_EQ(quantizedSearch.GetNumDimensions(), 6);
+
+        // Every value is off by at most half a quantization step, which bounds the error of the squared distances.
+        const float maxValueError = 0.5f * 4.0f / 255.0f;
+        FrameSearch::SearchBuffers buffers;
+        quantizedSearch.CalcDistances(m_query, buffers);
+        ASSERT_GE(buffers.m_distances.size(), s_numFrames);
+        for (size_t frame = 0; frame < s_numFrames; ++frame)
+        {
+            float maxDistanceError = 0.0f;
+            for (size_t column = 0; column < m_query.size(); ++column)
+            {
+                const float difference = AZ::GetAbs(m_featureMatrix(frame, column) - m_query[column]);
+                maxDistanceError += 2.0f * difference * maxValueError + maxValueError * maxValueError;
+            }
+            EXPECT_NEAR(buffers.m_distances[frame], CalcDistance(frame), maxDistanceError + 0.001f);
+        }
+
+        // The closest frames have to be among the candidates.
+        AZStd::vector<size_t> result;
+        quantizedSearch.FindNearestNeighbors(m_query, result, buffers);
+        EXPECT_EQ(result.size(), s_numCandidates);
+
+        const AZStd::vector<size_t> expected = SortFramesByDistance();
+        for (size_t i = 0; i < 10; ++i)
+        {
+            EXPECT_NE(AZStd::find(result.begin(), result.end(), expected[i]), result.end());
+        }
+    }
+
+    TEST_F(FrameSearchFixture, SearchTypeDependsOnDatabaseSize)
+    {
+        EXPECT_EQ(FrameSearch::SelectSearchType(1000), FrameSearch::QuantizedSearchType);
+        EXPECT_EQ(FrameSearch::SelectSearchType(1000000), FrameSearch::FlatKdTreeSearchType);
+
+        EXPECT_TRUE(azrtti_istypeof<QuantizedFrameSearch>(FrameSearch::Create(FrameSearch::AutomaticSearchType, 1000).get()));
+        EXPECT_TRUE(azrtti_istypeof<FlatKdTree>(FrameSearch::Create(FrameSearch::AutomaticSearchType, 1000000).get()));
+        EXPECT_TRUE(azrtti_istypeof<FlatKdTree>(FrameSearch::Create(FrameSearch::FlatKdTreeSearchType, 1000).get()));
+    }
+} // namespace EMotionFX::MotionMatching
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/Motion.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+#include <Fixture.h>
+#include <FeaturePosition.h>
+#include <FlatKdTree.h>
+#include <MotionMatchingData.h>
+#include <MotionMatchingInstance.h>
+#include <MotionMatchingSearchBatch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZ_CVAR_EXTERNED(bool, mm_useKdTree);
+
+    //! Motion matching data filled with random feature values, so that the searches can be tested without extracting features from motions.
+    class RandomMotionMatchingData
+        : public MotionMatchingData
+    {
+    public:
+        RandomMotionMatchingData(const FeatureSchema& featureSchema)
+            : MotionMatchingData(featureSchema)
+        {
+        }
+
+        bool InitRandom(Motion* motion, size_t numFrames, AZ::u64 seed)
+        {
+            size_t numColumns = 0;
+            for (const Feature* feature : m_featureSchema.GetFeatures())
+            {
+                numColumns += feature->GetNumDimensions();
+            }
+
+            AZ::SimpleLcgRandom random(seed);
+            m_featureMatrix.resize(numFrames, numColumns);
+            for (size_t frame = 0; frame < numFrames; ++frame)
+            {
+                m_frameDatabase.GetFrames().emplace_back(frame, motion, frame / 30.0f, /*mirrored=*/false);
+                for (size_t column = 0; column < numColumns; ++column)
+                {
+                    m_featureMatrix(frame, column) = random.GetRandomFloat() * 4.0f - 2.0f;
+                }
+            }
+
+            m_featuresInKdTree = m_featureSchema.GetFeatures();
+
+            FrameSearch::InitSettings settings;
+            settings.m_maxFramesPerLeaf = 16;
+            settings.m_numCandidates = 50;
+            m_frameSearch = AZStd::make_unique<FlatKdTree>();
+            return m_frameSearch->Init(m_frameDatabase, m_featureMatrix, m_featuresInKdTree, settings);
+        }
+    };
+
+    class MotionMatchingSearchBatchFixture
+        : public Fixture
+    {
+    public:
+        void SetUp() override
+        {
+            Fixture::SetUp();
+
+            // Two 3D position features next to each other in the feature matrix.
+            for (size_t i = 0; i < 2; ++i)
+            {
+                Feature* feature = aznew FeaturePosition();
+                feature->SetColumnOffset(i * 3);
+                m_featureSchema.AddFeature(feature);
+            }
+
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(1);
+            m_actorInstance = ActorInstance::Create(m_actor.get());
+
+            // Frames within the last second of their motion get discarded by the search, leave enough room after the last frame.
+            m_motion = aznew Motion("MotionMatchingSearchBatchTests");
+            m_motion->SetMotionData(aznew NonUniformMotionData());
+            m_motion->GetMotionData()->SetDuration(s_maxNumFrames / 30.0f + 2.0f);
+        }
+
+        void TearDown() override
+        {
+            mm_useKdTree = true;
+
+            m_instances.clear();
+            m_datas.clear();
+            m_featureSchema.Clear();
+            m_motion->Destroy();
+            m_actorInstance->Destroy();
+            m_actor.reset();
+
+            Fixture::TearDown();
+        }
+
+        MotionMatchingData* CreateData(size_t numFrames, AZ::u64 seed)
+        {
+            auto data = AZStd::make_unique<RandomMotionMatchingData>(m_featureSchema);
+            EXPECT_TRUE(data->InitRandom(m_motion, numFrames, seed));
+            return m_datas.emplace_back(AZStd::move(data)).get();
+        }
+
+        MotionMatchingInstance* CreateInstance(MotionMatchingData* data, AZ::SimpleLcgRandom& random)
+        {
+            auto instance = AZStd::make_unique<MotionMatchingInstance>();
+            MotionMatchingInstance::InitSettings settings;
+            settings.m_actorInstance = m_actorInstance;
+            settings.m_data = data;
+            instance->Init(settings);
+
+            for (float& value : instance->m_queryVector.GetData())
+            {
+                value = random.GetRandomFloat() * 4.0f - 2.0f;
+            }
+
+            return m_instances.emplace_back(AZStd::move(instance)).get();
+        }
+
+        static const MotionMatchingInstance::SearchResult& GetBatchedSearchResult(const MotionMatchingInstance& instance)
+        {
+            return instance.m_batchedSearchResult;
+        }
+
+        static constexpr size_t s_maxNumFrames = 5000;
+
+        FeatureSchema m_featureSchema;
+        AZStd::unique_ptr<Actor> m_actor;
+        ActorInstance* m_actorInstance = nullptr;
+        Motion* m_motion = nullptr;
+        AZStd::vector<AZStd::unique_ptr<RandomMotionMatchingData>> m_datas;
+        AZStd::vector<AZStd::unique_ptr<MotionMatchingInstance>> m_instances;
+    };
+
+    TEST_F(MotionMatchingSearchBatchFixture, BatchedSearchesMatchImmediateSearches)
+    {
+        // Use more instances than a broad-phase task holds and more frames than a frame range task holds, so that the results of several
+        // tasks get merged. The instances of the two databases are submitted interleaved, so the batch has to group them.
+        MotionMatchingData* largeData = CreateData(s_maxNumFrames, 1);
+        MotionMatchingData* smallData = CreateData(500, 2);
+        AZ::SimpleLcgRandom random(3);
+        for (size_t i = 0; i < 6; ++i)
+        {
+            CreateInstance(largeData, random);
+            CreateInstance(smallData, random);
+        }
+
+        MotionMatchingSearchBatch searchBatch;
+        for (bool useBroadPhase : { true, false })
+        {
+            mm_useKdTree = useBroadPhase;
+
+            AZStd::vector<MotionMatchingInstance::SearchResult> expectedResults;
+            for (const auto& instance : m_instances)
+            {
+                expectedResults.emplace_back(instance->FindLowestCostFrame(useBroadPhase));
+                searchBatch.Submit(instance.get());
+            }
+            EXPECT_EQ(searchBatch.GetNumPendingSearches(), m_instances.size());
+
+            searchBatch.Process();
+            EXPECT_EQ(searchBatch.GetNumPendingSearches(), 0);
+
+            for (size_t i = 0; i < m_instances.size(); ++i)
+            {
+                const MotionMatchingInstance::SearchResult& result = GetBatchedSearchResult(*m_instances[i]);
+                ASSERT_NE(expectedResults[i].m_frameIndex, InvalidIndex);
+                EXPECT_FALSE(m_instances[i]->IsBatchedSearchPending());
+                EXPECT_EQ(result.m_frameIndex, expectedResults[i].m_frameIndex);
+                EXPECT_FLOAT_EQ(result.m_cost, expectedResults[i].m_cost);
+            }
+        }
+    }
+
+    TEST_F(MotionMatchingSearchBatchFixture, CanceledSearchesDoNotRun)
+    {
+        MotionMatchingData* data = CreateData(500, 1);
+        AZ::SimpleLcgRandom random(2);
+        MotionMatchingInstance* canceledInstance = CreateInstance(data, random);
+        MotionMatchingInstance* instance = CreateInstance(data, random);
+
+        MotionMatchingSearchBatch searchBatch;
+        searchBatch.Submit(canceledInstance);
+        searchBatch.Submit(instance);
+        searchBatch.Cancel(canceledInstance);
+        EXPECT_EQ(searchBatch.GetNumPendingSearches(), 1);
+
+        searchBatch.Process();
+        EXPECT_EQ(GetBatchedSearchResult(*canceledInstance).m_frameIndex, InvalidIndex);
+        EXPECT_EQ(GetBatchedSearchResult(*instance).m_frameIndex, instance->FindLowestCostFrame(mm_useKdTree).m_frameIndex);
+    }
+} // namespace EMotionFX::MotionMatching
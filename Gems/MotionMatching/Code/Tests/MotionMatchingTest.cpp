@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/UnitTest/TestTypes.h>
 #include <AzTest/AzTest.h>
 
-AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
+AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV, UnitTest::ScopedAllocatorBenchmarkEnvironment);
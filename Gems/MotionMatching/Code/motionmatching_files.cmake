@@ -51,6 +51,12 @@ set(FILES
     Source/TrajectoryQuery.h
     Source/FrameDatabase.cpp
     Source/FrameDatabase.h
+    Source/FrameSearch.cpp
+    Source/FrameSearch.h
+    Source/FlatKdTree.cpp
+    Source/FlatKdTree.h
+    Source/QuantizedFrameSearch.cpp
+    Source/QuantizedFrameSearch.h
     Source/ImGuiMonitor.cpp
     Source/ImGuiMonitor.h
     Source/ImGuiMonitorBus.h
@@ -60,4 +66,6 @@ set(FILES
     Source/MotionMatchingData.h
     Source/MotionMatchingInstance.cpp
     Source/MotionMatchingInstance.h
+    Source/MotionMatchingSearchBatch.cpp
+    Source/MotionMatchingSearchBatch.h
 )
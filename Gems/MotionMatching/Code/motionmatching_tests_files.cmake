@@ -10,7 +10,10 @@ set(FILES
     Tests/Fixture.h
     Tests/FeatureMatrixTests.cpp
     Tests/FeatureSchemaTests.cpp
+    Tests/FrameSearchBenchmarks.cpp
+    Tests/FrameSearchTests.cpp
     Tests/MinMaxScalerTests.cpp
+    Tests/MotionMatchingSearchBatchTests.cpp
     Tests/MotionMatchingTest.cpp
     Tests/StandardScalerTests.cpp
 )
\ No newline at end of file
@@ -42,6 +42,12 @@ namespace Multiplayer
         //! Creates and manages sending updates to the remote endpoint.
         virtual void Update() = 0;
 
+        //! Serializes the entity updates the next Update will send, without sending them.
+        //! May be called for different connections concurrently, but must be followed by Update on the same frame.
+        //! Entities pending activation must be activated on the main thread before updates are prepared.
+        //! The default implementation does nothing, in which case Update serializes and sends the updates itself.
+        virtual void PrepareUpdates() {}
+
         //! Returns whether update messages can be sent to the connection.
         //! @return true if update messages can be sent
         virtual bool CanSendUpdates() const = 0;
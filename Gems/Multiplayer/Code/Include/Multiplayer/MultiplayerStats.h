@@ -10,6 +10,7 @@
 
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/Time/ITime.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
@@ -49,6 +50,29 @@ namespace Multiplayer
         };
         AZStd::vector<ComponentStats> m_componentStats;
 
+        //! Guards sent property metrics, which are recorded by connections preparing their updates in parallel.
+        AZStd::mutex m_propertySentMutex;
+
+        //! Sent metrics of one serialized entity update, in the order they were recorded.
+        //! Servers that share a serialized update between connections record them again for every connection reusing it.
+        struct SentEntityUpdateMetrics
+        {
+            struct PropertySent
+            {
+                NetComponentId m_netComponentId = InvalidNetComponentId;
+                PropertyIndex m_propertyIndex = PropertyIndex{ 0 };
+                uint32_t m_totalBytes = 0;
+            };
+            struct ComponentSerialized
+            {
+                NetComponentId m_netComponentId = InvalidNetComponentId;
+                //! Index past the last entry of m_propertiesSent that belongs to this component.
+                uint32_t m_propertiesSentEnd = 0;
+            };
+            AZStd::vector<PropertySent> m_propertiesSent;
+            AZStd::vector<ComponentSerialized> m_componentsSerialized;
+        };
+
         void ReserveComponentStats(NetComponentId netComponentId, uint16_t propertyCount, uint16_t rpcCount);
         void RecordEntitySerializeStart(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName);
         void RecordComponentSerializeEnd(AzNetworking::SerializerMode mode, NetComponentId netComponentId);
@@ -58,6 +82,13 @@ namespace Multiplayer
         void RecordRpcSent(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordRpcReceived(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordFrameTime(AZ::TimeUs networkFrameTime);
+
+        //! Collects the sent metrics recorded by the calling thread into outMetrics, until EndSentMetricsCapture() is called.
+        void BeginSentMetricsCapture(SentEntityUpdateMetrics& outMetrics);
+        void EndSentMetricsCapture();
+
+        //! Records the sent metrics of an entity update whose serialized payload was reused instead of serialized again.
+        void RecordEntityUpdateReused(AZ::EntityId entityId, const char* entityName, const SentEntityUpdateMetrics& metrics);
         void TickStats(AZ::TimeMs metricFrameTimeMs);
 
         Metric CalculateComponentPropertyUpdateSentMetrics(NetComponentId netComponentId) const;
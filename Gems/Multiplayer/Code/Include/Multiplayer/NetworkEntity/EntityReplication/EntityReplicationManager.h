@@ -60,7 +60,15 @@ namespace Multiplayer
         const HostId& GetRemoteHostId() const;
 
         void ActivatePendingEntities();
+
+        //! Serializes this frame's entity updates into packets without sending them.
+        //! Managers of different connections may prepare their updates concurrently, the prepared packets are sent by the
+        //! next call to SendUpdates. Calling SendUpdates without preparing first prepares and sends in one go.
+        void PrepareUpdates();
         void SendUpdates();
+
+        //! Returns true if PrepareUpdates was called and the prepared packets have not been sent yet.
+        bool HasPreparedUpdates() const;
         void Clear(bool forMigration);
 
         bool SetEntityRebasing(NetworkEntityHandle& entityHandle);
@@ -121,7 +129,9 @@ namespace Multiplayer
         using EntityReplicatorList = AZStd::deque<EntityReplicator*>;
         EntityReplicatorList GenerateEntityUpdateList();
 
-        void SendEntityUpdateMessages(EntityReplicatorList& replicatorList);
+        void SerializeEntityUpdateMessages(EntityReplicatorList& replicatorList);
+        void SendEntityUpdateMessages();
+        void ClearPreparedUpdates();
         void SendEntityRpcs(RpcMessages& rpcMessages, bool reliable);
         void SendEntityResets();
 
@@ -187,6 +197,16 @@ namespace Multiplayer
         NetEntityIdSet m_replicatorsPendingSend;
         NetEntityIdSet m_replicatorsPendingReset;
 
+        // Proxy replicators with pending changes and their accumulated send priority, reused between frames
+        using ProxySendCandidate = AZStd::pair<float, EntityReplicator*>;
+        AZStd::vector<ProxySendCandidate> m_proxySendCandidates;
+
+        // Entity updates serialized by PrepareUpdates, each packet ends at the stored index into the message list
+        AZStd::vector<NetworkEntityUpdateMessage> m_preparedUpdateMessages;
+        AZStd::vector<EntityReplicator*> m_preparedUpdateReplicators;
+        AZStd::vector<uint32_t> m_preparedPacketEnds;
+        bool m_updatesPrepared = false;
+
         // Deferred RPC Sends
         RpcMessages m_deferredRpcMessagesReliable;
         RpcMessages m_deferredRpcMessagesUnreliable;
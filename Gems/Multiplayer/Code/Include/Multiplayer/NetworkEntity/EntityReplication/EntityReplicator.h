@@ -14,6 +14,7 @@
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/containers/ring_buffer.h>
+#include <AzCore/std/algorithm.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
 
@@ -70,6 +71,21 @@ namespace Multiplayer
 
         AZ::TimeMs GetResendTimeoutTimeMs() const;
 
+        //! Smallest priority a replicator can have, so its send priority keeps growing and it is never starved.
+        static constexpr float MinPriority = 1.0e-6f;
+
+        //! Priority assigned by the replication window, added to the send priority every frame the replicator has changes to send.
+        //! Priorities below MinPriority are clamped. Replicators start at the highest distance based priority of 1.0f so new
+        //! entities are sent promptly.
+        void SetPriority(float priority);
+        float GetPriority() const;
+        float AccumulateSendPriority();
+        void ResetSendPriority();
+
+        //! Size of the last update message generated by this replicator, used to estimate the cost of the next update.
+        void SetLastUpdateSize(uint32_t updateSize);
+        uint32_t GetLastUpdateSize() const;
+
         PropertyPublisher* GetPropertyPublisher();
         const PropertyPublisher* GetPropertyPublisher() const;
         PropertySubscriber* GetPropertySubscriber();
@@ -136,6 +152,10 @@ namespace Multiplayer
         NetEntityRole m_boundLocalNetworkRole;
         NetEntityRole m_remoteNetworkRole;
 
+        float m_priority = 1.0f;
+        float m_sendPriority = 0.0f;
+        uint32_t m_lastUpdateSize = 0;
+
         bool m_wasMigrated = false;
         bool m_isForwardingRpc = false;
         bool m_prefabEntityIdSet = false;
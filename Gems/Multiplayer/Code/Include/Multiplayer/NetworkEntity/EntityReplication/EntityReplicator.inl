@@ -51,6 +51,37 @@ namespace Multiplayer
         m_wasMigrated = wasMigrated;
     }
 
+    inline void EntityReplicator::SetPriority(float priority)
+    {
+        m_priority = AZStd::max(priority, MinPriority);
+    }
+
+    inline float EntityReplicator::GetPriority() const
+    {
+        return m_priority;
+    }
+
+    inline float EntityReplicator::AccumulateSendPriority()
+    {
+        m_sendPriority += m_priority;
+        return m_sendPriority;
+    }
+
+    inline void EntityReplicator::ResetSendPriority()
+    {
+        m_sendPriority = 0.0f;
+    }
+
+    inline void EntityReplicator::SetLastUpdateSize(uint32_t updateSize)
+    {
+        m_lastUpdateSize = updateSize;
+    }
+
+    inline uint32_t EntityReplicator::GetLastUpdateSize() const
+    {
+        return m_lastUpdateSize;
+    }
+
     inline PropertyPublisher* EntityReplicator::GetPropertyPublisher()
     {
         return m_propertyPublisher.get();
@@ -11,6 +11,7 @@
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzCore/Name/Name.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
 namespace Multiplayer
@@ -67,6 +68,14 @@ namespace Multiplayer
         //! @return whether or not the entity was migrated
         bool GetWasMigrated() const;
 
+        //! Sets whether the data is an entity snapshot, delta encoded against a snapshot the receiver acknowledged.
+        //! @param value true if the data is an entity snapshot
+        void SetIsSnapshot(bool value);
+
+        //! Gets whether the data is an entity snapshot rather than a replication record and its dirty properties.
+        //! @return whether the data is an entity snapshot
+        bool GetIsSnapshot() const;
+
         //! Gets the current value of HasValidPrefabId.
         //! @return the current value of HasValidPrefabId
         bool GetHasValidPrefabId() const;
@@ -88,9 +97,15 @@ namespace Multiplayer
         const AzNetworking::PacketEncodingBuffer* GetData() const;
 
         //! Retrieves a non-const reference to the value of Data.
+        //! If the data is shared with other messages, it is copied first.
         //! @return a non-const reference to the value of Data
         AzNetworking::PacketEncodingBuffer& ModifyData();
 
+        //! Sets Data to a buffer that may be shared with other update messages, without copying it.
+        //! The buffer must not be modified directly once shared, use ModifyData() to get a private copy.
+        //! @param value the shared buffer to set Data to
+        void SetSharedData(const AZStd::shared_ptr<AzNetworking::PacketEncodingBuffer>& value);
+
         //! Base serialize method for all serializable structures or classes to implement.
         //! @param serializer ISerializer instance to use for serialization
         //! @return boolean true for success, false for serialization failure
@@ -102,12 +117,14 @@ namespace Multiplayer
         NetEntityId    m_entityId = InvalidNetEntityId;
         bool           m_isDelete = false;
         bool           m_wasMigrated = false;
+        bool           m_isSnapshot = false;
         bool           m_hasValidPrefabId = false;
         PrefabEntityId m_prefabEntityId;
 
         // Only allocated if we actually have data
         // This is to prevent blowing out stack memory if we declare an array of these EntityUpdateMessages
-        AZStd::unique_ptr<AzNetworking::PacketEncodingBuffer> m_data;
+        // Copies of a message share the buffer, and identical updates sent to several connections can share it too
+        AZStd::shared_ptr<AzNetworking::PacketEncodingBuffer> m_data;
     };
     using NetworkEntityUpdateVector = AZStd::fixed_vector<NetworkEntityUpdateMessage, MaxAggregateEntityMessages>;
 }
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+
+namespace Multiplayer
+{
+    //! @class IReplicationPriorityManager
+    //! @brief IReplicationPriorityManager provides an interface for scaling the replication priority of entities per client.
+    //!
+    //! By default, the priority of an entity is derived from its distance to the player's entity. Each tick an entity
+    //! has pending changes, its priority is added to a per-connection accumulator, and entities with the highest
+    //! accumulated priority are sent first until the connection's send budget is spent. Accumulators reset once an
+    //! entity is sent, so distant entities are updated less often but are never starved.
+    //!
+    //! Games can bias this, for example to favour entities the player is aiming at or members of the player's team,
+    //! by implementing this interface and registering it with AZ::Interface<IReplicationPriorityManager>.
+    class IReplicationPriorityManager
+    {
+    public:
+        AZ_RTTI(IReplicationPriorityManager, "{0E7C8A2B-5D1F-4A34-9E60-3B7F2C9D4A18}");
+
+        //! Smallest priority scale that is applied, lower scales (including 0) are clamped to it so that an entity in range
+        //! is still updated eventually. Use IFilterEntityManager to stop replicating an entity to a client entirely.
+        static constexpr float MinPriorityScale = 0.01f;
+
+        virtual ~IReplicationPriorityManager() = default;
+
+        //! Returns a scale applied to the distance based replication priority of the given entity.
+        //! Important: this method is a hot code path, it will be called over all entities around each player frequently.
+        //!
+        //! @param entity the entity being prioritized
+        //! @param controllerEntity player's entity for the associated connection
+        //! @param connectionId the connection the entity is being replicated to
+        //! @return the priority scale, 1.0f leaves the default priority unchanged, values below MinPriorityScale are clamped
+        virtual float GetEntityPriorityScale(AZ::Entity* entity, ConstNetworkEntityHandle controllerEntity, AzNetworking::ConnectionId connectionId) = 0;
+    };
+}
@@ -52,7 +52,16 @@ namespace Multiplayer
 
     void ClientToServerConnectionData::Update()
     {
-        m_entityReplicationManager.ActivatePendingEntities();
+        // Prepared updates were serialized after pending entities were activated this frame
+        if (!m_entityReplicationManager.HasPreparedUpdates())
+        {
+            m_entityReplicationManager.ActivatePendingEntities();
+        }
         m_entityReplicationManager.SendUpdates();
     }
+
+    void ClientToServerConnectionData::PrepareUpdates()
+    {
+        m_entityReplicationManager.PrepareUpdates();
+    }
 }
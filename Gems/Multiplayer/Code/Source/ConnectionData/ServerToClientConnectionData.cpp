@@ -73,17 +73,35 @@ namespace Multiplayer
 
     void ServerToClientConnectionData::Update()
     {
-        m_entityReplicationManager.ActivatePendingEntities();
+        // Prepared updates were serialized after pending entities were activated this frame
+        if (!m_entityReplicationManager.HasPreparedUpdates())
+        {
+            m_entityReplicationManager.ActivatePendingEntities();
+        }
+
+        if (ShouldSendEntityUpdates())
+        {
+            m_entityReplicationManager.SendUpdates();
+        }
+    }
+
+    void ServerToClientConnectionData::PrepareUpdates()
+    {
+        if (ShouldSendEntityUpdates())
+        {
+            m_entityReplicationManager.PrepareUpdates();
+        }
+    }
 
+    bool ServerToClientConnectionData::ShouldSendEntityUpdates() const
+    {
         if (CanSendUpdates())
         {
-            NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
+            const NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
             // potentially false if we just migrated the player, if that is the case, don't send any more updates
-            if (netBindComponent != nullptr && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority))
-            {
-                m_entityReplicationManager.SendUpdates();
-            }
+            return netBindComponent != nullptr && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority);
         }
+        return false;
     }
 
     void ServerToClientConnectionData::OnControlledEntityRemove()
@@ -32,6 +32,7 @@ namespace Multiplayer
         AzNetworking::IConnection* GetConnection() const override;
         EntityReplicationManager& GetReplicationManager() override;
         void Update() override;
+        void PrepareUpdates() override;
         bool CanSendUpdates() const override;
         void SetCanSendUpdates(bool canSendUpdates) override;
         bool DidHandshake() const override;
@@ -44,6 +45,7 @@ namespace Multiplayer
         void SetProviderTicket(const AZStd::string&);
 
     private:
+        bool ShouldSendEntityUpdates() const;
         void OnControlledEntityRemove();
         void OnControlledEntityMigration(const ConstNetworkEntityHandle& entityHandle, const HostId& remoteHostId);
         void OnGameplayStarted();
@@ -12,6 +12,9 @@
 
 namespace Multiplayer
 {
+    // Sent metrics capture of the calling thread, set while a shared entity update is serialized
+    static thread_local MultiplayerStats::SentEntityUpdateMetrics* s_sentMetricsCapture = nullptr;
+
     MultiplayerStats::Metric::Metric()
     {
         AZStd::uninitialized_fill_n(m_callHistory.data(), RingbufferSamples, 0);
@@ -38,6 +41,11 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordComponentSerializeEnd(AzNetworking::SerializerMode mode, NetComponentId netComponentId)
     {
+        if ((s_sentMetricsCapture != nullptr) && (mode == AzNetworking::SerializerMode::ReadFromObject))
+        {
+            const uint32_t propertiesSentEnd = aznumeric_cast<uint32_t>(s_sentMetricsCapture->m_propertiesSent.size());
+            s_sentMetricsCapture->m_componentsSerialized.push_back({ netComponentId, propertiesSentEnd });
+        }
         m_events.m_componentSerializeEnd.Signal(mode, netComponentId);
     }
 
@@ -50,6 +58,12 @@ namespace Multiplayer
     {
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
+        if (s_sentMetricsCapture != nullptr)
+        {
+            s_sentMetricsCapture->m_propertiesSent.push_back({ netComponentId, propertyId, totalBytes });
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_propertySentMutex);
         if (m_componentStats[netComponentIndex].m_propertyUpdatesSent.size() > propertyIndex)
         {
             m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_totalCalls++;
@@ -127,6 +141,34 @@ namespace Multiplayer
         m_events.m_rpcReceived.Signal(entityId, entityName, netComponentId, rpcId, totalBytes);
     }
 
+    void MultiplayerStats::BeginSentMetricsCapture(SentEntityUpdateMetrics& outMetrics)
+    {
+        AZ_Assert(s_sentMetricsCapture == nullptr, "Sent metrics are already being captured on this thread");
+        s_sentMetricsCapture = &outMetrics;
+    }
+
+    void MultiplayerStats::EndSentMetricsCapture()
+    {
+        s_sentMetricsCapture = nullptr;
+    }
+
+    void MultiplayerStats::RecordEntityUpdateReused(AZ::EntityId entityId, const char* entityName, const SentEntityUpdateMetrics& metrics)
+    {
+        // Replays the metrics in the order the original serialization recorded them, so per entity reports attribute them the same way
+        RecordEntitySerializeStart(AzNetworking::SerializerMode::ReadFromObject, entityId, entityName);
+        uint32_t propertyIndex = 0;
+        for (const SentEntityUpdateMetrics::ComponentSerialized& component : metrics.m_componentsSerialized)
+        {
+            for (; propertyIndex < component.m_propertiesSentEnd; ++propertyIndex)
+            {
+                const SentEntityUpdateMetrics::PropertySent& property = metrics.m_propertiesSent[propertyIndex];
+                RecordPropertySent(property.m_netComponentId, property.m_propertyIndex, property.m_totalBytes);
+            }
+            RecordComponentSerializeEnd(AzNetworking::SerializerMode::ReadFromObject, component.m_netComponentId);
+        }
+        RecordEntitySerializeStop(AzNetworking::SerializerMode::ReadFromObject, entityId, entityName);
+    }
+
     void MultiplayerStats::TickStats(AZ::TimeMs metricFrameTimeMs)
     {
         SET_PERFORMANCE_STAT(MultiplayerStat_EntityCount, m_entityCount);
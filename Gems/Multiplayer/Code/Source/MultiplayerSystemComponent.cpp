@@ -33,6 +33,7 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 
@@ -93,6 +94,10 @@ namespace Multiplayer
     AZ_CVAR(bool, sv_isTransient, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "[DEPRECATED: use sv_terminateOnPlayerExit instead] Whether a dedicated server shuts down if all existing connections disconnect.");
     AZ_CVAR(bool, sv_terminateOnPlayerExit, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether a dedicated server shuts down if all existing connections disconnect.");
     AZ_CVAR(AZ::TimeMs, sv_serverSendRateMs, AZ::TimeMs{ 50 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of milliseconds between each network update");
+    AZ_CVAR(bool, sv_ParallelEntityReplication, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Serialize entity updates for each connection in parallel on the task graph before they are sent");
+    AZ_CVAR(uint32_t, sv_ParallelEntityReplicationMinConnections, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Minimum number of connections before entity updates are serialized in parallel");
     AZ_CVAR(float, cl_renderTickBlendBase, 0.15f, nullptr, AZ::ConsoleFunctorFlags::Null,
         "The base used for blending between network updates, 0.1 will be quite linear, 0.2 or 0.3 will "
         "slow down quicker and may be better suited to connections with highly variable latency");
@@ -531,6 +536,11 @@ namespace Multiplayer
         {            
             AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: OnTick - SendOutGameStateUpdate");
 
+            if (sv_ParallelEntityReplication)
+            {
+                PrepareConnectionUpdatesParallel();
+            }
+
             auto sendNetworkUpdates = [&stats](IConnection& connection)
             {
                 if (connection.GetUserData() != nullptr)
@@ -1505,6 +1515,62 @@ namespace Multiplayer
         }
     }
 
+    void MultiplayerSystemComponent::PrepareConnectionUpdatesParallel()
+    {
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (taskGraphActiveInterface == nullptr || !taskGraphActiveInterface->IsTaskGraphActive())
+        {
+            return;
+        }
+
+        // Per entity serialization stats rely on entities being serialized one at a time, keep to the serial path while they are observed
+        const MultiplayerStats::Events& statEvents = GetStats().m_events;
+        if (statEvents.m_entitySerializeStart.HasHandlerConnected() || statEvents.m_componentSerializeEnd.HasHandlerConnected()
+            || statEvents.m_entitySerializeStop.HasHandlerConnected() || statEvents.m_propertySent.HasHandlerConnected())
+        {
+            return;
+        }
+
+        m_parallelUpdateConnections.clear();
+        m_networkInterface->GetConnectionSet().VisitConnections([this](IConnection& connection)
+        {
+            if (connection.GetUserData() != nullptr)
+            {
+                m_parallelUpdateConnections.push_back(reinterpret_cast<IConnectionData*>(connection.GetUserData()));
+            }
+        });
+
+        if (m_parallelUpdateConnections.size() < sv_ParallelEntityReplicationMinConnections)
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: PrepareConnectionUpdatesParallel");
+
+        // Activating entities is not thread safe and must happen before the updates are serialized, as it does on the serial path
+        for (IConnectionData* connectionData : m_parallelUpdateConnections)
+        {
+            connectionData->GetReplicationManager().ActivatePendingEntities();
+        }
+
+        // Each connection serializes its own entity updates into packets, the packets are handed to the network interface
+        // when the connection is updated on this thread, since sending assigns the packet ids the replicators are finalized with
+        static const AZ::TaskDescriptor prepareUpdatesDescriptor{ "Multiplayer PrepareConnectionUpdates", "Multiplayer" };
+        AZ::TaskGraph taskGraph{ "Multiplayer PrepareConnectionUpdates" };
+        for (IConnectionData* connectionData : m_parallelUpdateConnections)
+        {
+            taskGraph.AddTask(prepareUpdatesDescriptor, [connectionData]()
+            {
+                connectionData->PrepareUpdates();
+            });
+        }
+
+        AZ::TaskGraphEvent finishedEvent{ "Multiplayer PrepareConnectionUpdates Wait" };
+        taskGraph.Submit(&finishedEvent);
+        finishedEvent.Wait();
+        m_parallelUpdateConnections.clear();
+    }
+
     void MultiplayerSystemComponent::OnConsoleCommandInvoked
     (
         AZStd::string_view command,
@@ -25,6 +25,7 @@
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/sort.h>
 
 AZ_DECLARE_BUDGET(MULTIPLAYER);
 
@@ -35,6 +36,9 @@ namespace Multiplayer
     // Take out a few extra bytes for special headers, we currently only use 1 byte for the count of entity updates
     constexpr uint32_t ReplicationManagerPacketOverhead = 16;
 
+    // Assumed cost of an entity update before the replicator has sent one, used for the per frame send budget
+    constexpr uint32_t DefaultEntityUpdateSizeEstimate = 128;
+
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
 
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
@@ -112,39 +116,52 @@ namespace Multiplayer
         }
     }
 
-    void EntityReplicationManager::SendUpdates()
+    void EntityReplicationManager::PrepareUpdates()
     {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: PrepareUpdates");
+        AZ_Assert(!m_updatesPrepared, "Entity updates have already been prepared this frame");
+
         m_frameTimeMs = AZ::GetElapsedTimeMs();
 
-        {
-            EntityReplicatorList toSendList = GenerateEntityUpdateList();
+        EntityReplicatorList toSendList = GenerateEntityUpdateList();
 
-            AZLOG
-            (
-                NET_ReplicationInfo,
-                "Sending %zd updates from %s to %s",
-                toSendList.size(),
-                GetNetworkEntityManager()->GetHostId().GetString().c_str(),
-                GetRemoteHostId().GetString().c_str()
-            );
+        AZLOG
+        (
+            NET_ReplicationInfo,
+            "Sending %zd updates from %s to %s",
+            toSendList.size(),
+            GetNetworkEntityManager()->GetHostId().GetString().c_str(),
+            GetRemoteHostId().GetString().c_str()
+        );
 
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: PrepareUpdates - PrepareSerialization");
+            // Prep a replication record for send, at this point, everything needs to be sent
+            for (EntityReplicator* replicator : toSendList)
             {
-                AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - PrepareSerialization");
-                // Prep a replication record for send, at this point, everything needs to be sent
-                for (EntityReplicator* replicator : toSendList)
-                {
-                    replicator->GetPropertyPublisher()->PrepareSerialization();
-                }
+                replicator->GetPropertyPublisher()->PrepareSerialization();
             }
+        }
 
-            {
-                AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - SendEntityUpdateMessages");
-                // While our to send list is not empty, build up another packet to send
-                do
-                {
-                    SendEntityUpdateMessages(toSendList);
-                } while (!toSendList.empty());
-            }
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: PrepareUpdates - SerializeEntityUpdateMessages");
+            SerializeEntityUpdateMessages(toSendList);
+        }
+
+        m_updatesPrepared = true;
+    }
+
+    void EntityReplicationManager::SendUpdates()
+    {
+        if (!m_updatesPrepared)
+        {
+            PrepareUpdates();
+        }
+
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - SendEntityUpdateMessages");
+            SendEntityUpdateMessages();
+            ClearPreparedUpdates();
         }
 
         SendEntityRpcs(m_deferredRpcMessagesReliable, true);
@@ -167,6 +184,11 @@ namespace Multiplayer
         );
     }
 
+    bool EntityReplicationManager::HasPreparedUpdates() const
+    {
+        return m_updatesPrepared;
+    }
+
     EntityReplicationManager::EntityReplicatorList EntityReplicationManager::GenerateEntityUpdateList()
     {
         if (m_replicationWindow == nullptr)
@@ -179,7 +201,6 @@ namespace Multiplayer
         // Generate a list of all our entities that need updates
         EntityReplicatorList toSendList;
 
-        uint32_t proxySendCount = 0;
         for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end();)
         {
             bool clearPendingSend = true;
@@ -217,10 +238,10 @@ namespace Multiplayer
                         {
                             toSendList.push_back(replicator);
                         }
-                        else if (proxySendCount < m_replicationWindow->GetMaxProxyEntityReplicatorSendCount())
+                        else
                         {
-                            toSendList.push_back(replicator);
-                            ++proxySendCount;
+                            const float sendPriority = replicator->AccumulateSendPriority();
+                            m_proxySendCandidates.push_back({ sendPriority, replicator });
                         }
                     }
                 }
@@ -237,37 +258,63 @@ namespace Multiplayer
             }
         }
 
+        // Send the proxies with the highest accumulated priority first, until either the count or the byte budget is spent.
+        // Proxies that miss out stay pending and keep accumulating priority, so they are sent on a later frame.
+        AZStd::sort(m_proxySendCandidates.begin(), m_proxySendCandidates.end(),
+            [](const ProxySendCandidate& lhs, const ProxySendCandidate& rhs) { return lhs.first > rhs.first; });
+
+        const uint32_t maxProxySendCount = m_replicationWindow->GetMaxProxyEntityReplicatorSendCount();
+        const uint32_t maxProxySendBytes = m_replicationWindow->GetMaxProxyEntityReplicatorSendBytes();
+        uint32_t proxySendCount = 0;
+        uint32_t proxySendBytes = 0;
+        for (const ProxySendCandidate& candidate : m_proxySendCandidates)
+        {
+            EntityReplicator* replicator = candidate.second;
+            const uint32_t lastUpdateSize = replicator->GetLastUpdateSize();
+            const uint32_t estimatedSize = (lastUpdateSize > 0) ? lastUpdateSize : DefaultEntityUpdateSizeEstimate;
+            const bool budgetSpent = (maxProxySendBytes > 0) && (proxySendCount > 0) && (proxySendBytes + estimatedSize > maxProxySendBytes);
+            if ((proxySendCount >= maxProxySendCount) || budgetSpent)
+            {
+                break;
+            }
+
+            toSendList.push_back(replicator);
+            replicator->ResetSendPriority();
+            proxySendBytes += estimatedSize;
+            ++proxySendCount;
+        }
+        m_proxySendCandidates.clear();
+
         return toSendList;
     }
 
-    void EntityReplicationManager::SendEntityUpdateMessages(EntityReplicatorList& replicatorList)
+    void EntityReplicationManager::SerializeEntityUpdateMessages(EntityReplicatorList& replicatorList)
     {
         uint32_t pendingPacketSize = 0;
-        EntityReplicatorList replicatorUpdatedList;
-        NetworkEntityUpdateVector entityUpdates;
-        // Serialize everything
-        while (!replicatorList.empty())
+        uint32_t pendingPacketCount = 0;
+        for (EntityReplicator* replicator : replicatorList)
         {
-            EntityReplicator* replicator = replicatorList.front();
             NetworkEntityUpdateMessage updateMessage(replicator->GenerateUpdatePacket());
 
             const uint32_t nextMessageSize = updateMessage.GetEstimatedSerializeSize();
+            replicator->SetLastUpdateSize(nextMessageSize);
 
-            // Check if we are over our limits
+            // Start a new packet if this message would put the current one over our limits
             const bool payloadFull = (pendingPacketSize + nextMessageSize > m_maxPayloadSize);
-            const bool capacityReached = (entityUpdates.size() >= entityUpdates.capacity());
-            const bool largeEntityDetected = (payloadFull && replicatorUpdatedList.empty());
-            if (capacityReached || (payloadFull && !largeEntityDetected))
+            const bool capacityReached = (pendingPacketCount >= MaxAggregateEntityMessages);
+            if ((pendingPacketCount > 0) && (capacityReached || payloadFull))
             {
-                break;
+                m_preparedPacketEnds.push_back(aznumeric_cast<uint32_t>(m_preparedUpdateMessages.size()));
+                pendingPacketSize = 0;
+                pendingPacketCount = 0;
             }
 
             pendingPacketSize += nextMessageSize;
-            entityUpdates.push_back(updateMessage);
-            replicatorUpdatedList.push_back(replicator);
-            replicatorList.pop_front();
+            ++pendingPacketCount;
+            m_preparedUpdateMessages.emplace_back(AZStd::move(updateMessage));
+            m_preparedUpdateReplicators.push_back(replicator);
 
-            if (largeEntityDetected)
+            if (nextMessageSize > m_maxPayloadSize)
             {
                 AZLOG_WARN
                 (
@@ -276,24 +323,51 @@ namespace Multiplayer
                     m_maxPayloadSize,
                     nextMessageSize
                 );
-                break;
             }
         }
 
-        if (m_replicationWindow)
+        // Always send at least one, possibly empty, update packet per frame
+        if ((pendingPacketCount > 0) || m_preparedPacketEnds.empty())
+        {
+            m_preparedPacketEnds.push_back(aznumeric_cast<uint32_t>(m_preparedUpdateMessages.size()));
+        }
+        replicatorList.clear();
+    }
+
+    void EntityReplicationManager::SendEntityUpdateMessages()
+    {
+        if (m_replicationWindow == nullptr)
+        {
+            AZ_Assert(false, "Failed to send entity update message, replication window does not exist");
+            return;
+        }
+
+        uint32_t packetStart = 0;
+        for (const uint32_t packetEnd : m_preparedPacketEnds)
         {
+            NetworkEntityUpdateVector entityUpdates;
+            for (uint32_t index = packetStart; index < packetEnd; ++index)
+            {
+                entityUpdates.push_back(AZStd::move(m_preparedUpdateMessages[index]));
+            }
+
             const AzNetworking::PacketId sentId = m_replicationWindow->SendEntityUpdateMessages(entityUpdates);
 
             // Update the sent things with the packet id
-            for (EntityReplicator* replicator : replicatorUpdatedList)
+            for (uint32_t index = packetStart; index < packetEnd; ++index)
             {
-                replicator->FinalizeSerialization(sentId);
+                m_preparedUpdateReplicators[index]->FinalizeSerialization(sentId);
             }
+            packetStart = packetEnd;
         }
-        else
-        {
-            AZ_Assert(false, "Failed to send entity update message, replication window does not exist");
-        }
+    }
+
+    void EntityReplicationManager::ClearPreparedUpdates()
+    {
+        m_preparedUpdateMessages.clear();
+        m_preparedUpdateReplicators.clear();
+        m_preparedPacketEnds.clear();
+        m_updatesPrepared = false;
     }
 
     void EntityReplicationManager::SendEntityRpcs(RpcMessages& rpcMessages, bool reliable)
@@ -354,6 +428,8 @@ namespace Multiplayer
 
     void EntityReplicationManager::Clear(bool forMigration)
     {
+        ClearPreparedUpdates();
+
         if (forMigration)
         {
             for (auto& replicatorPair : m_entityReplicatorMap)
@@ -842,6 +918,33 @@ namespace Multiplayer
         // May still be nullptr
         EntityReplicator* entityReplicator = GetEntityReplicator(updateMessage.GetEntityId());
         UpdateValidationResult result = ValidateUpdate(updateMessage, packetHeader.GetPacketId(), entityReplicator);
+
+        // Snapshots are decoded before dropping old messages, the server may use any snapshot it saw acknowledged as a baseline
+        const EntitySnapshot* snapshot = nullptr;
+        if (updateMessage.GetIsSnapshot() && !updateMessage.GetIsDelete() && (result != UpdateValidationResult::DropMessageAndDisconnect))
+        {
+            if (m_updateMode != Mode::LocalClientToRemoteServer)
+            {
+                AZLOG_WARN("Dropping Packet and connection, only servers can send entity snapshots");
+                return false;
+            }
+
+            PropertySubscriber* propSubscriber = (entityReplicator != nullptr) ? entityReplicator->GetPropertySubscriber() : nullptr;
+            if ((propSubscriber != nullptr) && (updateMessage.GetData() != nullptr))
+            {
+                OutputSerializer snapshotSerializer(updateMessage.GetData()->GetBuffer(), static_cast<uint32_t>(updateMessage.GetData()->GetSize()));
+                snapshot = propSubscriber->DecodeSnapshot(snapshotSerializer);
+            }
+
+            if (snapshot == nullptr)
+            {
+                AZLOG(NET_RepUpdate, "EntityReplicationManager: Unable to decode snapshot for entity id %llu, requesting a reset",
+                    (AZ::u64)updateMessage.GetEntityId());
+                m_replicatorsPendingReset.emplace(updateMessage.GetEntityId());
+                return true;
+            }
+        }
+
         switch (result)
         {
         case UpdateValidationResult::HandleMessage:
@@ -859,7 +962,9 @@ namespace Multiplayer
             return HandleEntityDeleteMessage(entityReplicator, packetHeader, updateMessage);
         }
 
-        OutputSerializer outputSerializer(updateMessage.GetData()->GetBuffer(), static_cast<uint32_t>(updateMessage.GetData()->GetSize()));
+        // Snapshots decode to the same layout as a regular update, with every property the client replicates marked dirty
+        const AzNetworking::PacketEncodingBuffer* updateData = (snapshot != nullptr) ? snapshot->m_state.get() : updateMessage.GetData();
+        OutputSerializer outputSerializer(updateData->GetBuffer(), static_cast<uint32_t>(updateData->GetSize()));
 
         PrefabEntityId prefabEntityId;
         if (updateMessage.GetHasValidPrefabId())
@@ -1049,7 +1154,10 @@ namespace Multiplayer
             {
                 if (newWindowIter->first && (newWindowIter->first.GetNetEntityId() < currWindowIter->first))
                 {
-                    AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
+                    if (EntityReplicator* newReplicator = AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole))
+                    {
+                        newReplicator->SetPriority(newWindowIter->second.m_priority);
+                    }
                     ++newWindowIter;
                 }
                 else if (newWindowIter->first.GetNetEntityId() > currWindowIter->first)
@@ -1069,6 +1177,7 @@ namespace Multiplayer
                     {
                         currReplicator = AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
                     }
+                    currReplicator->SetPriority(newWindowIter->second.m_priority);
                     currReplicator->ClearPendingRemoval();
                     ++newWindowIter;
                     ++currWindowIter;
@@ -1078,7 +1187,10 @@ namespace Multiplayer
             // Do remaining adds
             while (newWindowIter != newWindow.end())
             {
-                AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
+                if (EntityReplicator* newReplicator = AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole))
+                {
+                    newReplicator->SetPriority(newWindowIter->second.m_priority);
+                }
                 ++newWindowIter;
             }
 
@@ -16,8 +16,10 @@
 #include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicationManager.h>
 #include <Source/NetworkEntity/NetworkEntityAuthorityTracker.h>
 #include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <Source/NetworkEntity/EntityReplication/EntitySnapshot.h>
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
 #include <Source/NetworkEntity/EntityReplication/PropertySubscriber.h>
+#include <Source/NetworkEntity/EntityReplication/SharedEntityUpdateCache.h>
 
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/PacketLayer/IPacket.h>
@@ -30,6 +32,11 @@
 
 namespace Multiplayer
 {
+    AZ_CVAR(bool, sv_ShareEntityUpdateSerialization, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Serialize identical entity updates once per host frame and share the payload between all client connections that need it");
+    AZ_CVAR(bool, sv_SnapshotReplication, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Replicate entity state to clients as snapshots delta encoded against the last snapshot each client acknowledged, instead of resending unacknowledged changes");
+
     void SyncActivatingEntityTransform(AZ::Entity* entity)
     {
         NetworkTransformComponent* netTransform = entity->FindComponent<NetworkTransformComponent>();
@@ -146,6 +153,12 @@ namespace Multiplayer
                     m_netBindComponent,
                     *m_connection
                 );
+            if (sv_SnapshotReplication && (AZ::Interface<EntitySnapshotCache>::Get() != nullptr)
+                && (m_replicationManager.m_updateMode == EntityReplicationManager::Mode::LocalServerToRemoteClient)
+                && (GetRemoteNetworkRole() == NetEntityRole::Client))
+            {
+                m_propertyPublisher->EnableSnapshotReplication();
+            }
             m_onEntityDirtiedHandler.Disconnect();
             m_netBindComponent->AddEntityDirtiedEventHandler(m_onEntityDirtiedHandler);
         }
@@ -487,6 +500,30 @@ namespace Multiplayer
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
 
+        if (m_propertyPublisher->IsSnapshotPrepared())
+        {
+            // Snapshots are built and encoded once per host frame and baseline, and shared between clients
+            EntitySnapshot::SharedBuffer payload;
+            m_propertyPublisher->UpdateSnapshotSerialization(*AZ::Interface<EntitySnapshotCache>::Get(), GetEntityHandle().GetNetEntityId(), payload);
+            updateMessage.SetIsSnapshot(true);
+            if (payload != nullptr)
+            {
+                updateMessage.SetSharedData(payload);
+            }
+            return updateMessage;
+        }
+
+        // Servers can share identical payloads between the clients observing this entity, they are only serialized once per host frame
+        SharedEntityUpdateCache* sharedUpdateCache = AZ::Interface<SharedEntityUpdateCache>::Get();
+        if (sv_ShareEntityUpdateSerialization && (sharedUpdateCache != nullptr)
+            && (m_replicationManager.m_updateMode == EntityReplicationManager::Mode::LocalServerToRemoteClient))
+        {
+            SharedEntityUpdateCache::SharedBuffer payload;
+            m_propertyPublisher->UpdateSharedSerialization(*sharedUpdateCache, GetEntityHandle().GetNetEntityId(), payload);
+            updateMessage.SetSharedData(payload);
+            return updateMessage;
+        }
+
         InputSerializer inputSerializer(updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
         m_propertyPublisher->UpdateSerialization(inputSerializer);
         updateMessage.ModifyData().Resize(inputSerializer.GetSize());
@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/EntitySnapshot.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
+#include <Multiplayer/NetworkTime/INetworkTime.h>
+#include <AzNetworking/Serialization/DeltaSerializer.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+AZ_DECLARE_BUDGET(MULTIPLAYER);
+
+namespace Multiplayer
+{
+    // The DeltaSerializer tracks at most 255 fields per delta, so snapshots are diffed as blocks of 32-bit words
+    static constexpr uint32_t MaxWordsPerBlock = 255;
+    static constexpr uint32_t BytesPerWord = sizeof(uint32_t);
+
+    struct SnapshotWordBlock
+    {
+        uint32_t m_words[MaxWordsPerBlock];
+        uint32_t m_wordCount = 0;
+
+        // Words are assembled byte by byte so the encoding does not depend on host endianness
+        void Load(const AzNetworking::PacketEncodingBuffer& state, uint32_t firstWord, uint32_t wordCount)
+        {
+            m_wordCount = wordCount;
+            const uint8_t* bytes = state.GetBuffer();
+            const uint32_t stateSize = static_cast<uint32_t>(state.GetSize());
+            for (uint32_t wordIndex = 0; wordIndex < wordCount; ++wordIndex)
+            {
+                uint32_t word = 0;
+                const uint32_t byteOffset = (firstWord + wordIndex) * BytesPerWord;
+                for (uint32_t byteIndex = 0; byteIndex < BytesPerWord; ++byteIndex)
+                {
+                    if (byteOffset + byteIndex < stateSize)
+                    {
+                        word |= static_cast<uint32_t>(bytes[byteOffset + byteIndex]) << (byteIndex * 8);
+                    }
+                }
+                m_words[wordIndex] = word;
+            }
+        }
+
+        void Store(AzNetworking::PacketEncodingBuffer& state, uint32_t firstWord) const
+        {
+            uint8_t* bytes = state.GetBuffer();
+            const uint32_t stateSize = static_cast<uint32_t>(state.GetSize());
+            for (uint32_t wordIndex = 0; wordIndex < m_wordCount; ++wordIndex)
+            {
+                const uint32_t byteOffset = (firstWord + wordIndex) * BytesPerWord;
+                for (uint32_t byteIndex = 0; byteIndex < BytesPerWord; ++byteIndex)
+                {
+                    if (byteOffset + byteIndex < stateSize)
+                    {
+                        bytes[byteOffset + byteIndex] = static_cast<uint8_t>(m_words[wordIndex] >> (byteIndex * 8));
+                    }
+                }
+            }
+        }
+
+        bool Serialize(AzNetworking::ISerializer& serializer)
+        {
+            for (uint32_t wordIndex = 0; wordIndex < m_wordCount; ++wordIndex)
+            {
+                if (!serializer.Serialize(m_words[wordIndex], "Word"))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    static uint32_t GetSnapshotWordCount(uint32_t stateSize, uint32_t baselineSize)
+    {
+        // Both sides diff the same number of words, bytes past the end of the shorter state read as zero
+        return (AZStd::max(stateSize, baselineSize) + BytesPerWord - 1) / BytesPerWord;
+    }
+
+    bool EncodeEntitySnapshot(AzNetworking::ISerializer& serializer, const EntitySnapshot& snapshot, const EntitySnapshot* baseline)
+    {
+        AZ_Assert(snapshot.m_state != nullptr, "Snapshot has no state");
+        HostFrameId frameId = snapshot.m_frameId;
+        HostFrameId baselineFrameId = (baseline != nullptr) ? baseline->m_frameId : InvalidHostFrameId;
+        serializer.Serialize(frameId, "FrameId");
+        serializer.Serialize(baselineFrameId, "BaselineFrameId");
+
+        if (baseline == nullptr)
+        {
+            return serializer.Serialize(*snapshot.m_state, "State");
+        }
+
+        uint16_t stateSize = static_cast<uint16_t>(snapshot.m_state->GetSize());
+        serializer.Serialize(stateSize, "StateSize");
+
+        const uint32_t wordCount = GetSnapshotWordCount(stateSize, static_cast<uint32_t>(baseline->m_state->GetSize()));
+        for (uint32_t firstWord = 0; firstWord < wordCount; firstWord += MaxWordsPerBlock)
+        {
+            const uint32_t blockWordCount = AZStd::min(MaxWordsPerBlock, wordCount - firstWord);
+            SnapshotWordBlock baselineBlock;
+            SnapshotWordBlock currentBlock;
+            baselineBlock.Load(*baseline->m_state, firstWord, blockWordCount);
+            currentBlock.Load(*snapshot.m_state, firstWord, blockWordCount);
+
+            AzNetworking::SerializerDelta delta;
+            AzNetworking::DeltaSerializerCreate deltaSerializer(delta);
+            if (!deltaSerializer.CreateDelta(baselineBlock, currentBlock) || !delta.Serialize(serializer))
+            {
+                return false;
+            }
+        }
+        return serializer.IsValid();
+    }
+
+    EntitySnapshotHistory::EntitySnapshotHistory(uint32_t capacity)
+        : m_snapshots(capacity)
+    {
+        ;
+    }
+
+    const EntitySnapshot* EntitySnapshotHistory::Decode(AzNetworking::ISerializer& serializer)
+    {
+        EntitySnapshot snapshot;
+        HostFrameId baselineFrameId = InvalidHostFrameId;
+        serializer.Serialize(snapshot.m_frameId, "FrameId");
+        serializer.Serialize(baselineFrameId, "BaselineFrameId");
+        snapshot.m_state = AZStd::make_shared<AzNetworking::PacketEncodingBuffer>();
+
+        if (baselineFrameId == InvalidHostFrameId)
+        {
+            if (!serializer.Serialize(*snapshot.m_state, "State"))
+            {
+                return nullptr;
+            }
+        }
+        else
+        {
+            const EntitySnapshot* baseline = Find(baselineFrameId);
+            uint16_t stateSize = 0;
+            if ((baseline == nullptr) || !serializer.Serialize(stateSize, "StateSize") || !snapshot.m_state->Resize(stateSize))
+            {
+                return nullptr;
+            }
+
+            const uint32_t wordCount = GetSnapshotWordCount(stateSize, static_cast<uint32_t>(baseline->m_state->GetSize()));
+            for (uint32_t firstWord = 0; firstWord < wordCount; firstWord += MaxWordsPerBlock)
+            {
+                SnapshotWordBlock block;
+                block.Load(*baseline->m_state, firstWord, AZStd::min(MaxWordsPerBlock, wordCount - firstWord));
+
+                AzNetworking::SerializerDelta delta;
+                if (!delta.Serialize(serializer))
+                {
+                    return nullptr;
+                }
+                AzNetworking::DeltaSerializerApply deltaSerializer(delta);
+                if (!deltaSerializer.ApplyDelta(block))
+                {
+                    return nullptr;
+                }
+                block.Store(*snapshot.m_state, firstWord);
+            }
+        }
+
+        if (!serializer.IsValid())
+        {
+            return nullptr;
+        }
+
+        Push(snapshot);
+        return Find(snapshot.m_frameId);
+    }
+
+    void EntitySnapshotHistory::Push(const EntitySnapshot& snapshot)
+    {
+        for (EntitySnapshot& existing : m_snapshots)
+        {
+            if (existing.m_frameId == snapshot.m_frameId)
+            {
+                existing = snapshot;
+                return;
+            }
+        }
+        m_snapshots.push_front(snapshot);
+    }
+
+    const EntitySnapshot* EntitySnapshotHistory::Find(HostFrameId frameId) const
+    {
+        for (const EntitySnapshot& snapshot : m_snapshots)
+        {
+            if (snapshot.m_frameId == frameId)
+            {
+                return &snapshot;
+            }
+        }
+        return nullptr;
+    }
+
+    void EntitySnapshotHistory::Clear()
+    {
+        m_snapshots.clear();
+    }
+
+    EntitySnapshotCache::EntitySnapshotCache()
+    {
+        AZ::Interface<EntitySnapshotCache>::Register(this);
+    }
+
+    EntitySnapshotCache::~EntitySnapshotCache()
+    {
+        AZ::Interface<EntitySnapshotCache>::Unregister(this);
+    }
+
+    EntitySnapshot EntitySnapshotCache::GetCurrentSnapshot(NetEntityId netEntityId, NetBindComponent& netBindComponent)
+    {
+        HostFrameId frameId = InvalidHostFrameId;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            ClearIfStale();
+
+            auto iter = m_cachedEntities.find(netEntityId);
+            if ((iter != m_cachedEntities.end()) && (iter->second.m_snapshot.m_state != nullptr))
+            {
+                return iter->second.m_snapshot;
+            }
+            frameId = m_cachedFrameId;
+        }
+
+        // Serialize outside the lock so that connections snapshotting different entities don't wait on each other
+        EntitySnapshot snapshot;
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "EntitySnapshotCache: GetCurrentSnapshot");
+
+            // Snapshots are only sent to clients, so they contain every property replicated to the client role
+            ReplicationRecord record(NetEntityRole::Client);
+            netBindComponent.FillTotalReplicationRecord(record);
+
+            EntitySnapshot::SharedBuffer state = AZStd::make_shared<AzNetworking::PacketEncodingBuffer>();
+            InputSerializer inputSerializer(state->GetBuffer(), static_cast<uint32_t>(state->GetCapacity()));
+            record.Serialize(inputSerializer);
+            netBindComponent.SerializeStateDeltaMessage(record, inputSerializer);
+            if (!inputSerializer.IsValid())
+            {
+                return snapshot;
+            }
+            state->Resize(inputSerializer.GetSize());
+            snapshot.m_frameId = frameId;
+            snapshot.m_state = AZStd::move(state);
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        ClearIfStale();
+        if (m_cachedFrameId != frameId)
+        {
+            // The host frame changed while serializing, don't cache a snapshot of the previous frame
+            return snapshot;
+        }
+
+        // If another connection stored the snapshot in the meantime, use it so every connection shares the same baseline
+        EntitySnapshot& cachedSnapshot = m_cachedEntities[netEntityId].m_snapshot;
+        if (cachedSnapshot.m_state == nullptr)
+        {
+            cachedSnapshot = AZStd::move(snapshot);
+        }
+        return cachedSnapshot;
+    }
+
+    EntitySnapshot::SharedBuffer EntitySnapshotCache::GetEncodedSnapshot(NetEntityId netEntityId, const EntitySnapshot* baseline)
+    {
+        const HostFrameId baselineFrameId = (baseline != nullptr) ? baseline->m_frameId : InvalidHostFrameId;
+        EntitySnapshot snapshot;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            ClearIfStale();
+
+            auto iter = m_cachedEntities.find(netEntityId);
+            if ((iter == m_cachedEntities.end()) || (iter->second.m_snapshot.m_state == nullptr))
+            {
+                AZ_Assert(false, "GetCurrentSnapshot must succeed before the snapshot can be encoded");
+                return nullptr;
+            }
+
+            for (const EncodedPayload& encodedPayload : iter->second.m_encodedPayloads)
+            {
+                if (encodedPayload.m_baselineFrameId == baselineFrameId)
+                {
+                    return encodedPayload.m_payload;
+                }
+            }
+
+            // The state is shared and never modified once cached, so a reference is all that is needed to encode outside the lock
+            snapshot = iter->second.m_snapshot;
+        }
+
+        EntitySnapshot::SharedBuffer payload = AZStd::make_shared<AzNetworking::PacketEncodingBuffer>();
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "EntitySnapshotCache: GetEncodedSnapshot");
+            InputSerializer inputSerializer(payload->GetBuffer(), static_cast<uint32_t>(payload->GetCapacity()));
+            if (!EncodeEntitySnapshot(inputSerializer, snapshot, baseline))
+            {
+                return nullptr;
+            }
+            payload->Resize(inputSerializer.GetSize());
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        ClearIfStale();
+        auto iter = m_cachedEntities.find(netEntityId);
+        if ((iter == m_cachedEntities.end()) || (iter->second.m_snapshot.m_state != snapshot.m_state))
+        {
+            // The cache was cleared for a new host frame while encoding
+            return payload;
+        }
+
+        for (const EncodedPayload& encodedPayload : iter->second.m_encodedPayloads)
+        {
+            if (encodedPayload.m_baselineFrameId == baselineFrameId)
+            {
+                return encodedPayload.m_payload;
+            }
+        }
+        iter->second.m_encodedPayloads.push_back({ baselineFrameId, payload });
+        return payload;
+    }
+
+    void EntitySnapshotCache::Reset()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_cachedEntities = {};
+        m_cachedFrameId = InvalidHostFrameId;
+    }
+
+    void EntitySnapshotCache::ClearIfStale()
+    {
+        const INetworkTime* networkTime = GetNetworkTime();
+        const HostFrameId currentFrameId = networkTime ? networkTime->GetHostFrameId() : InvalidHostFrameId;
+        if (currentFrameId != m_cachedFrameId)
+        {
+            m_cachedEntities.clear();
+            m_cachedFrameId = currentFrameId;
+        }
+    }
+}
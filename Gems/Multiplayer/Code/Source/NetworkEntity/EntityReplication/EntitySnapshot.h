@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/ring_buffer.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace AzNetworking
+{
+    class ISerializer;
+}
+
+namespace Multiplayer
+{
+    class NetBindComponent;
+
+    //! The complete serialized state of an entity at a given host frame.
+    //! The state is laid out like a regular entity update, a replication record followed by every property it marks dirty.
+    struct EntitySnapshot
+    {
+        using SharedBuffer = AZStd::shared_ptr<AzNetworking::PacketEncodingBuffer>;
+
+        HostFrameId m_frameId = InvalidHostFrameId;
+        SharedBuffer m_state;
+    };
+
+    //! Writes a snapshot to the serializer, delta encoded against a baseline snapshot the remote endpoint is known to have.
+    //! @param serializer the serializer to write the snapshot to
+    //! @param snapshot   the snapshot to encode
+    //! @param baseline   the snapshot to delta encode against, nullptr to encode the full state
+    //! @return boolean true on success
+    bool EncodeEntitySnapshot(AzNetworking::ISerializer& serializer, const EntitySnapshot& snapshot, const EntitySnapshot* baseline);
+
+    //! @class EntitySnapshotHistory
+    //! @brief Ring of the most recent snapshots of an entity, used to look up delta baselines by host frame.
+    class EntitySnapshotHistory
+    {
+    public:
+        explicit EntitySnapshotHistory(uint32_t capacity);
+
+        //! Reads a snapshot written by EncodeEntitySnapshot, resolving its baseline from this history, and adds it to the history.
+        //! @param serializer the serializer to read the snapshot from
+        //! @return the decoded snapshot, nullptr if the data was invalid or its baseline is no longer in the history
+        const EntitySnapshot* Decode(AzNetworking::ISerializer& serializer);
+
+        //! Adds a snapshot to the history, replacing any snapshot of the same host frame and evicting the oldest if full.
+        void Push(const EntitySnapshot& snapshot);
+
+        //! Returns the snapshot for the given host frame, nullptr if it is not in the history.
+        const EntitySnapshot* Find(HostFrameId frameId) const;
+
+        void Clear();
+
+    private:
+        AZStd::ring_buffer<EntitySnapshot> m_snapshots;
+    };
+
+    //! @class EntitySnapshotCache
+    //! @brief Builds entity snapshots and their delta encoded payloads once per host frame, sharing them between all client connections.
+    //!
+    //! Every connection that replicates an entity in snapshot mode needs the same current state, and connections that have
+    //! acknowledged the same baseline need the same delta. Both are computed by the first connection that asks for them
+    //! during a host frame and reused by every other one. The cache is cleared whenever the host frame changes, snapshots
+    //! that are still used as baselines are kept alive by the connections referencing them. Connections may prepare their
+    //! updates concurrently, so all accessors are thread safe. Snapshots are serialized and encoded outside the lock, if two
+    //! connections race to build the same one, the first one stored is shared and the other is discarded.
+    class EntitySnapshotCache
+    {
+    public:
+        AZ_RTTI(EntitySnapshotCache, "{8D4C2E71-6A3B-4F95-B1D8-0E7F5A9C3B42}");
+
+        EntitySnapshotCache();
+        virtual ~EntitySnapshotCache();
+
+        //! Returns the snapshot of the entity for the current host frame, serializing it if this is the first request this frame.
+        //! @param netEntityId      the entity to snapshot
+        //! @param netBindComponent the entity's NetBindComponent
+        //! @return the current snapshot, its state is nullptr if serialization failed
+        EntitySnapshot GetCurrentSnapshot(NetEntityId netEntityId, NetBindComponent& netBindComponent);
+
+        //! Returns the current snapshot of the entity encoded against the provided baseline, encoding it if no other connection has this frame.
+        //! @param netEntityId the entity the snapshot is for
+        //! @param baseline    the snapshot acknowledged by the remote endpoint, nullptr to encode the full state
+        //! @return the encoded payload, nullptr if encoding failed
+        EntitySnapshot::SharedBuffer GetEncodedSnapshot(NetEntityId netEntityId, const EntitySnapshot* baseline);
+
+        //! Releases all cached snapshots and payloads.
+        void Reset();
+
+    private:
+        struct EncodedPayload
+        {
+            HostFrameId m_baselineFrameId = InvalidHostFrameId;
+            EntitySnapshot::SharedBuffer m_payload;
+        };
+
+        struct CachedEntity
+        {
+            EntitySnapshot m_snapshot;
+            AZStd::vector<EncodedPayload> m_encodedPayloads;
+        };
+
+        void ClearIfStale();
+
+        AZStd::mutex m_mutex;
+        AZStd::unordered_map<NetEntityId, CachedEntity> m_cachedEntities;
+        HostFrameId m_cachedFrameId = InvalidHostFrameId;
+    };
+}
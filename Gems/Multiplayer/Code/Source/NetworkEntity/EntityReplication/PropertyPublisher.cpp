@@ -8,13 +8,18 @@
 
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <Multiplayer/IMultiplayer.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 
 namespace Multiplayer
 {
     AZ_CVAR(uint32_t, net_EntityReplicatorRecordsMax, 45, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of allowed outstanding entity records");
 
+    // Upper bound of a serialized ReplicationRecord, four bitsets of MaxRecordBits plus their sizes
+    static constexpr uint32_t MaxSerializedRecordSize = 4 * (ReplicationRecord::MaxRecordBits / 8 + sizeof(uint32_t));
+
     PropertyPublisher::PropertyPublisher(NetEntityRole remoteNetworkRole, OwnsLifetime ownsLifetime, NetBindComponent* netBindComponent, AzNetworking::IConnection& connection)
         : m_ownsLifetime(ownsLifetime)
         , m_netBindComponent(netBindComponent)
@@ -64,6 +69,23 @@ namespace Multiplayer
         return m_remoteReplicatorEstablished;
     }
 
+    void PropertyPublisher::EnableSnapshotReplication()
+    {
+        m_snapshotReplication = true;
+        m_sentSnapshots.set_capacity(net_EntityReplicatorRecordsMax);
+    }
+
+    bool PropertyPublisher::IsSnapshotPrepared() const
+    {
+        return m_snapshotPrepared;
+    }
+
+    bool PropertyPublisher::IsSnapshotReplicationActive() const
+    {
+        // Snapshots need an established remote replicator to hold the baselines, creation always goes through the record path
+        return m_snapshotReplication && m_remoteReplicatorEstablished && (m_pendingRecord.GetRemoteNetworkRole() == NetEntityRole::Client);
+    }
+
     PropertyPublisher::EntityReplicatorState PropertyPublisher::GetReplicatorState() const
     {
         return m_replicatorState;
@@ -106,6 +128,28 @@ namespace Multiplayer
         return true;
     }
 
+    bool PropertyPublisher::HasSnapshotUpdate()
+    {
+        // Only the newest acknowledged snapshot is needed as a baseline, drop everything sent before it
+        for (auto iter = m_sentSnapshots.begin(); iter != m_sentSnapshots.end(); ++iter)
+        {
+            if (m_connection.WasPacketAcked(iter->m_sentPacketId))
+            {
+                m_sentSnapshots.erase(++iter, m_sentSnapshots.end());
+                break;
+            }
+        }
+
+        // Records sent before switching to snapshots may still be in flight, the next snapshot supersedes them
+        if (m_pendingRecord.HasChanges() || !m_sentRecords.empty())
+        {
+            return true;
+        }
+
+        // Lost snapshots are never resent, but we keep sending the current state until it has been acknowledged
+        return !m_sentSnapshots.empty() && !m_connection.WasPacketAcked(m_sentSnapshots.front().m_sentPacketId);
+    }
+
     bool PropertyPublisher::PrepareAddEntityRecord()
     {
         m_sentRecords.clear();
@@ -167,6 +211,18 @@ namespace Multiplayer
         return !IsDeleted();
     }
 
+    bool PropertyPublisher::PrepareSnapshotEntityRecord()
+    {
+        m_sentRecords.clear();
+        if (m_sentSnapshots.full())
+        {
+            // Nothing has been acknowledged in a long time, start over from a full snapshot
+            m_sentSnapshots.clear();
+        }
+        m_snapshotPrepared = true;
+        return true;
+    }
+
     bool PropertyPublisher::SerializeUpdateEntityRecord(AzNetworking::ISerializer &serializer)
     {
         AZ_Assert(m_netBindComponent, "NetBindComponent is nullptr");
@@ -197,6 +253,26 @@ namespace Multiplayer
         m_pendingRecord.Clear();
     }
 
+    void PropertyPublisher::FinalizeSnapshotEntityRecord(AzNetworking::PacketId packetId)
+    {
+        if (m_sentSnapshots.empty() || (m_sentSnapshots.front().m_sentPacketId != AzNetworking::InvalidPacketId))
+        {
+            // Serialization failed before the snapshot was recorded
+            return;
+        }
+
+        SentSnapshot& lastSentSnapshot = m_sentSnapshots.front();
+        lastSentSnapshot.m_sentPacketId = packetId;
+        AZ_Assert(lastSentSnapshot.m_sentPacketId != AzNetworking::InvalidPacketId, "Got a bad packet id");
+        if (lastSentSnapshot.m_sentPacketId == AzNetworking::InvalidPacketId)
+        {
+            // The packet failed to be generated, it can never become a baseline
+            m_sentSnapshots.pop_front();
+            return;
+        }
+        m_pendingRecord.Clear();
+    }
+
     void PropertyPublisher::FinalizeDeleteEntityRecord(AzNetworking::PacketId packetId)
     {
         // If we have more than our max records, just clear it and restart tracking again
@@ -223,7 +299,7 @@ namespace Multiplayer
             return true;
 
         case PropertyPublisher::EntityReplicatorState::Updating:
-            return HasUpdateEntityRecord();
+            return IsSnapshotReplicationActive() ? HasSnapshotUpdate() : HasUpdateEntityRecord();
 
         case PropertyPublisher::EntityReplicatorState::Deleting:
             if (m_ownsLifetime == PropertyPublisher::OwnsLifetime::True)
@@ -265,7 +341,7 @@ namespace Multiplayer
             break;
 
         case PropertyPublisher::EntityReplicatorState::Updating:
-            needsUpdate = PrepareUpdateEntityRecord();
+            needsUpdate = IsSnapshotReplicationActive() ? PrepareSnapshotEntityRecord() : PrepareUpdateEntityRecord();
             break;
 
         case PropertyPublisher::EntityReplicatorState::Deleting:
@@ -318,6 +394,94 @@ namespace Multiplayer
         return success;
     }
 
+    bool PropertyPublisher::UpdateSharedSerialization(SharedEntityUpdateCache& cache, NetEntityId netEntityId, SharedEntityUpdateCache::SharedBuffer& outPayload)
+    {
+        if ((m_replicatorState != PropertyPublisher::EntityReplicatorState::Creating)
+         && (m_replicatorState != PropertyPublisher::EntityReplicatorState::Updating))
+        {
+            // Only property updates are worth sharing
+            outPayload = AZStd::make_shared<AzNetworking::PacketEncodingBuffer>();
+            InputSerializer inputSerializer(outPayload->GetBuffer(), static_cast<uint32_t>(outPayload->GetCapacity()));
+            const bool success = UpdateSerialization(inputSerializer);
+            outPayload->Resize(inputSerializer.GetSize());
+            return success;
+        }
+
+        AZ_Assert(m_serializationPhase == PropertyPublisher::EntityReplicatorSerializationPhase::Prepared, "Unexpected serialization phase");
+
+        // The payload starts with the serialized record, which fully determines the properties that follow it
+        // The record is serialized on the stack so that connections can share updates from multiple threads
+        AzNetworking::ByteBuffer<MaxSerializedRecordSize> recordBuffer;
+        InputSerializer recordSerializer(recordBuffer.GetBuffer(), static_cast<uint32_t>(recordBuffer.GetCapacity()));
+        m_pendingRecord.ResetConsumedBits();
+        m_pendingRecord.Serialize(recordSerializer);
+        const NetEntityRole remoteRole = m_pendingRecord.GetRemoteNetworkRole();
+        MultiplayerStats& stats = GetMultiplayer()->GetStats();
+        if (recordSerializer.IsValid())
+        {
+            SharedEntityUpdateCache::SharedMetrics sentMetrics;
+            outPayload = cache.Find(netEntityId, remoteRole, recordBuffer.GetBuffer(), recordSerializer.GetSize(), sentMetrics);
+            if (outPayload != nullptr)
+            {
+                // The payload is sent again on this connection, account for it like the connection that serialized it
+                if (sentMetrics != nullptr)
+                {
+                    stats.RecordEntityUpdateReused(m_netBindComponent->GetEntityId(), m_netBindComponent->GetEntity()->GetName().c_str(), *sentMetrics);
+                }
+                return true;
+            }
+        }
+
+        auto sentMetrics = AZStd::make_shared<MultiplayerStats::SentEntityUpdateMetrics>();
+        outPayload = AZStd::make_shared<AzNetworking::PacketEncodingBuffer>();
+        InputSerializer inputSerializer(outPayload->GetBuffer(), static_cast<uint32_t>(outPayload->GetCapacity()));
+        stats.BeginSentMetricsCapture(*sentMetrics);
+        const bool success = UpdateSerialization(inputSerializer);
+        stats.EndSentMetricsCapture();
+        outPayload->Resize(inputSerializer.GetSize());
+        if (success && recordSerializer.IsValid())
+        {
+            cache.Store(netEntityId, remoteRole, recordSerializer.GetSize(), outPayload, sentMetrics);
+        }
+        return success;
+    }
+
+    bool PropertyPublisher::UpdateSnapshotSerialization(EntitySnapshotCache& cache, NetEntityId netEntityId, EntitySnapshot::SharedBuffer& outPayload)
+    {
+        AZ_Assert(m_snapshotPrepared, "Expected a prepared snapshot");
+        AZ_Assert(m_serializationPhase == PropertyPublisher::EntityReplicatorSerializationPhase::Prepared, "Unexpected serialization phase");
+        AZ_Assert(m_netBindComponent, "NetBindComponent is nullptr");
+
+        const EntitySnapshot snapshot = cache.GetCurrentSnapshot(netEntityId, *m_netBindComponent);
+        if (snapshot.m_state == nullptr)
+        {
+            AZLOG_ERROR("EntityReplicator: Snapshot serialization failed");
+            outPayload = nullptr;
+            return false;
+        }
+
+        // Encode against the newest snapshot the remote endpoint has acknowledged, or send the full state if there is none
+        const EntitySnapshot* baseline = nullptr;
+        for (const SentSnapshot& sentSnapshot : m_sentSnapshots)
+        {
+            if (m_connection.WasPacketAcked(sentSnapshot.m_sentPacketId))
+            {
+                baseline = &sentSnapshot.m_snapshot;
+                break;
+            }
+        }
+
+        outPayload = cache.GetEncodedSnapshot(netEntityId, baseline);
+        if (outPayload == nullptr)
+        {
+            AZLOG_ERROR("EntityReplicator: Snapshot serialization failed");
+            return false;
+        }
+
+        m_sentSnapshots.push_front({ snapshot, AzNetworking::InvalidPacketId });
+        return true;
+    }
+
     void PropertyPublisher::FinalizeSerialization(AzNetworking::PacketId sentId)
     {
         switch (m_replicatorState)
@@ -329,7 +493,15 @@ namespace Multiplayer
         case PropertyPublisher::EntityReplicatorState::Updating:
         {
             AZ_Assert(m_serializationPhase == PropertyPublisher::EntityReplicatorSerializationPhase::Prepared, "Unexpected serialization phase");
-            FinalizeUpdateEntityRecord(sentId);
+            if (m_snapshotPrepared)
+            {
+                FinalizeSnapshotEntityRecord(sentId);
+                m_snapshotPrepared = false;
+            }
+            else
+            {
+                FinalizeUpdateEntityRecord(sentId);
+            }
             m_replicatorState = PropertyPublisher::EntityReplicatorState::Updating;
         }
         break;
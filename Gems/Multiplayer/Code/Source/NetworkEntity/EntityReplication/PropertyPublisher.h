@@ -9,6 +9,8 @@
 #pragma once
 
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <Source/NetworkEntity/EntityReplication/EntitySnapshot.h>
+#include <Source/NetworkEntity/EntityReplication/SharedEntityUpdateCache.h>
 #include <AzCore/std/containers/ring_buffer.h>
 
 namespace AzNetworking
@@ -37,6 +39,13 @@ namespace Multiplayer
 
         bool IsRemoteReplicatorEstablished() const;
 
+        //! Once the remote replicator is established, replicate full state snapshots delta encoded against the last acknowledged snapshot.
+        //! Snapshots are never resent, every update carries the complete state relative to what the remote endpoint has.
+        void EnableSnapshotReplication();
+
+        //! Returns true if the prepared update is a snapshot and must be serialized with UpdateSnapshotSerialization.
+        bool IsSnapshotPrepared() const;
+
         void GenerateRecord();
 
         //! Interface for ReplicationManager to manage serialization of entities
@@ -44,6 +53,10 @@ namespace Multiplayer
         bool RequiresSerialization();
         bool PrepareSerialization();
         bool UpdateSerialization(AzNetworking::ISerializer& serializer);
+        //! Like UpdateSerialization, but reuses a payload another connection serialized for the same record this host frame.
+        bool UpdateSharedSerialization(SharedEntityUpdateCache& cache, NetEntityId netEntityId, SharedEntityUpdateCache::SharedBuffer& outPayload);
+        //! Serializes the prepared snapshot, encoded against the newest snapshot the remote endpoint acknowledged.
+        bool UpdateSnapshotSerialization(EntitySnapshotCache& cache, NetEntityId netEntityId, EntitySnapshot::SharedBuffer& outPayload);
         void FinalizeSerialization(AzNetworking::PacketId sentId);
         //! @}
 
@@ -67,12 +80,15 @@ namespace Multiplayer
 
         //! Check if we have data to send
         bool HasUpdateEntityRecord();
+        bool HasSnapshotUpdate();
+        bool IsSnapshotReplicationActive() const;
 
         //! Phase 1, setup of the record
         bool PrepareAddEntityRecord();
         bool PrepareRebaseEntityRecord();
         bool PrepareUpdateEntityRecord();
         bool PrepareDeleteEntityRecord();
+        bool PrepareSnapshotEntityRecord();
 
         //! Phase 2, serialize the record
         //! No add, they share the update path
@@ -82,6 +98,7 @@ namespace Multiplayer
         //! Phase 3, finalize with the packet id
         void FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId);
         void FinalizeDeleteEntityRecord(AzNetworking::PacketId packetId);
+        void FinalizeSnapshotEntityRecord(AzNetworking::PacketId packetId);
 
         EntityReplicatorState m_replicatorState = EntityReplicatorState::Creating;
         EntityReplicatorSerializationPhase m_serializationPhase = EntityReplicatorSerializationPhase::Ready;
@@ -96,5 +113,16 @@ namespace Multiplayer
         AZStd::ring_buffer<ReplicationRecord> m_sentRecords;
         AZStd::vector<AzNetworking::PacketId> m_deletePacketIds;
         bool m_remoteReplicatorEstablished = false;
+
+        struct SentSnapshot
+        {
+            EntitySnapshot m_snapshot;
+            AzNetworking::PacketId m_sentPacketId = AzNetworking::InvalidPacketId;
+        };
+
+        //! Sent snapshots, newest first, the oldest entry is the acknowledged baseline once one has been acked
+        AZStd::ring_buffer<SentSnapshot> m_sentSnapshots;
+        bool m_snapshotReplication = false;
+        bool m_snapshotPrepared = false;
     };
 }
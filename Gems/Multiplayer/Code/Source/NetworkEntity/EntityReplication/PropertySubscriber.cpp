@@ -9,12 +9,16 @@
 #include <Source/NetworkEntity/EntityReplication/PropertySubscriber.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicationManager.h>
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <AzCore/Console/IConsole.h>
 
 namespace Multiplayer
 {
+    AZ_CVAR(uint32_t, cl_EntitySnapshotHistoryMax, 64, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of received snapshots kept per entity as baselines for delta encoded snapshot updates");
+
     PropertySubscriber::PropertySubscriber(EntityReplicationManager& replicationManager, NetBindComponent* netBindComponent)
         : m_replicationManager(replicationManager)
         , m_netBindComponent(netBindComponent)
+        , m_receivedSnapshots(cl_EntitySnapshotHistoryMax)
     {
         ;
     }
@@ -50,4 +54,9 @@ namespace Multiplayer
         m_lastReceivedPacketId = packetId;
         return m_netBindComponent->HandlePropertyChangeMessage(*serializer, notifyChanges);
     }
+
+    const EntitySnapshot* PropertySubscriber::DecodeSnapshot(AzNetworking::ISerializer& serializer)
+    {
+        return m_receivedSnapshots.Decode(serializer);
+    }
 }
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <Source/NetworkEntity/EntityReplication/EntitySnapshot.h>
 #include <AzNetworking/Utilities/NetworkCommon.h>
 
 namespace AzNetworking
@@ -34,6 +35,11 @@ namespace Multiplayer
 
         bool HandlePropertyChangeMessage(AzNetworking::PacketId packetId, AzNetworking::ISerializer* serializer, bool notifyChanges = true);
 
+        //! Decodes a snapshot update against the snapshots previously received for this entity and keeps it as a future baseline.
+        //! @param serializer the serializer to read the snapshot from
+        //! @return the decoded snapshot, nullptr if its baseline is no longer available and the entity needs to be reset
+        const EntitySnapshot* DecodeSnapshot(AzNetworking::ISerializer& serializer);
+
     private:
         EntityReplicationManager& m_replicationManager;
         NetBindComponent* m_netBindComponent;
@@ -41,5 +47,8 @@ namespace Multiplayer
         // The last packet to have been received about this entity
         AzNetworking::PacketId m_lastReceivedPacketId = AzNetworking::InvalidPacketId;
         AZ::TimeMs m_markForRemovalTimeMs = AZ::Time::ZeroTimeMs;
+
+        // Snapshots received for this entity, the remote endpoint encodes new snapshots against the ones we acknowledged
+        EntitySnapshotHistory m_receivedSnapshots;
     };
 }
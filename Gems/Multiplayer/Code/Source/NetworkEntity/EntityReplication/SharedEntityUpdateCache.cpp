@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/SharedEntityUpdateCache.h>
+#include <Multiplayer/NetworkTime/INetworkTime.h>
+#include <AzCore/Interface/Interface.h>
+
+namespace Multiplayer
+{
+    SharedEntityUpdateCache::SharedEntityUpdateCache()
+    {
+        AZ::Interface<SharedEntityUpdateCache>::Register(this);
+    }
+
+    SharedEntityUpdateCache::~SharedEntityUpdateCache()
+    {
+        AZ::Interface<SharedEntityUpdateCache>::Unregister(this);
+    }
+
+    SharedEntityUpdateCache::SharedBuffer SharedEntityUpdateCache::Find(NetEntityId netEntityId, NetEntityRole remoteRole, const uint8_t* record, uint32_t recordSize, SharedMetrics& outSentMetrics)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        ClearIfStale();
+
+        auto iter = m_cachedPayloads.find(netEntityId);
+        if (iter == m_cachedPayloads.end())
+        {
+            return nullptr;
+        }
+
+        for (const CachedPayload& cachedPayload : iter->second)
+        {
+            if ((cachedPayload.m_remoteRole == remoteRole)
+             && (cachedPayload.m_recordSize == recordSize)
+             && (memcmp(cachedPayload.m_payload->GetBuffer(), record, recordSize) == 0))
+            {
+                outSentMetrics = cachedPayload.m_sentMetrics;
+                return cachedPayload.m_payload;
+            }
+        }
+        return nullptr;
+    }
+
+    void SharedEntityUpdateCache::Store(NetEntityId netEntityId, NetEntityRole remoteRole, uint32_t recordSize, const SharedBuffer& payload, const SharedMetrics& sentMetrics)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        ClearIfStale();
+        m_cachedPayloads[netEntityId].push_back({ remoteRole, recordSize, payload, sentMetrics });
+    }
+
+    void SharedEntityUpdateCache::Reset()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_cachedPayloads = {};
+        m_cachedFrameId = InvalidHostFrameId;
+    }
+
+    void SharedEntityUpdateCache::ClearIfStale()
+    {
+        const INetworkTime* networkTime = GetNetworkTime();
+        const HostFrameId currentFrameId = networkTime ? networkTime->GetHostFrameId() : InvalidHostFrameId;
+        if (currentFrameId != m_cachedFrameId)
+        {
+            // Payloads still referenced by queued messages stay alive until those messages are released
+            m_cachedPayloads.clear();
+            m_cachedFrameId = currentFrameId;
+        }
+    }
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerStats.h>
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace Multiplayer
+{
+    //! @class SharedEntityUpdateCache
+    //! @brief Shares serialized entity updates between all connections during a host frame.
+    //!
+    //! An entity update payload is a serialized replication record followed by the properties it marks dirty.
+    //! Connections that have acknowledged the same updates build identical records, and therefore identical payloads.
+    //! The first connection to serialize a given record for an entity stores the payload here, and every other
+    //! connection with a matching record reuses the same reference counted buffer instead of serializing it again.
+    //! The cache is cleared whenever the host frame changes. Connections may serialize their updates concurrently, so
+    //! lookups and stores are thread safe.
+    class SharedEntityUpdateCache
+    {
+    public:
+        AZ_RTTI(SharedEntityUpdateCache, "{3F1B7E8C-2A65-4C0D-B9E4-6D2A8F3C1B57}");
+
+        using SharedBuffer = AZStd::shared_ptr<AzNetworking::PacketEncodingBuffer>;
+        using SharedMetrics = AZStd::shared_ptr<const MultiplayerStats::SentEntityUpdateMetrics>;
+
+        SharedEntityUpdateCache();
+        virtual ~SharedEntityUpdateCache();
+
+        //! Returns a payload previously stored this host frame for the entity, role and serialized record, nullptr if there is none.
+        //! @param netEntityId the entity the update is for
+        //! @param remoteRole  the network role of the remote replicator
+        //! @param record      the serialized replication record the payload starts with
+        //! @param recordSize  the size of the serialized replication record in bytes
+        //! @param outSentMetrics the sent metrics recorded when the payload was serialized, so reusing it can record them again
+        //! @return the shared payload, or nullptr if it has not been serialized yet this host frame
+        SharedBuffer Find(NetEntityId netEntityId, NetEntityRole remoteRole, const uint8_t* record, uint32_t recordSize, SharedMetrics& outSentMetrics);
+
+        //! Stores a serialized payload for reuse by other connections during the current host frame.
+        //! @param netEntityId the entity the update is for
+        //! @param remoteRole  the network role of the remote replicator
+        //! @param recordSize  the size of the serialized replication record the payload starts with
+        //! @param payload     the serialized payload, it must not be modified once stored
+        //! @param sentMetrics the sent metrics recorded while serializing the payload
+        void Store(NetEntityId netEntityId, NetEntityRole remoteRole, uint32_t recordSize, const SharedBuffer& payload, const SharedMetrics& sentMetrics);
+
+        //! Releases all cached payloads.
+        void Reset();
+
+    private:
+        struct CachedPayload
+        {
+            NetEntityRole m_remoteRole = NetEntityRole::InvalidRole;
+            uint32_t m_recordSize = 0;
+            SharedBuffer m_payload;
+            SharedMetrics m_sentMetrics;
+        };
+        using CachedPayloads = AZStd::vector<CachedPayload>;
+
+        void ClearIfStale();
+
+        AZStd::mutex m_mutex;
+        AZStd::unordered_map<NetEntityId, CachedPayloads> m_cachedPayloads;
+        HostFrameId m_cachedFrameId = InvalidHostFrameId;
+    };
+}
@@ -386,6 +386,9 @@ namespace Multiplayer
     void NetworkEntityManager::Reset()
     {
         m_multiplayerComponentRegistry.Reset();
+        m_replicationInterestGrid.Reset();
+        m_sharedEntityUpdateCache.Reset();
+        m_entitySnapshotCache.Reset();
         m_removeList.clear();
         m_entityDomain = nullptr;
         m_entityExitDomainEvent.DisconnectAllHandlers();
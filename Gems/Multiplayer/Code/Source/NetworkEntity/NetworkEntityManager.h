@@ -15,6 +15,9 @@
 #include <Source/NetworkEntity/NetworkEntityAuthorityTracker.h>
 #include <Source/NetworkEntity/NetworkEntityTracker.h>
 #include <Source/NetworkEntity/NetworkSpawnableLibrary.h>
+#include <Source/NetworkEntity/EntityReplication/EntitySnapshot.h>
+#include <Source/NetworkEntity/EntityReplication/SharedEntityUpdateCache.h>
+#include <Source/ReplicationWindows/ReplicationInterestGrid.h>
 #include <Multiplayer/Components/MultiplayerComponentRegistry.h>
 #include <Multiplayer/EntityDomains/IEntityDomain.h>
 #include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
@@ -126,6 +129,9 @@ namespace Multiplayer
         NetworkEntityTracker m_networkEntityTracker;
         NetworkEntityAuthorityTracker m_networkEntityAuthorityTracker;
         MultiplayerComponentRegistry m_multiplayerComponentRegistry;
+        ReplicationInterestGrid m_replicationInterestGrid;
+        SharedEntityUpdateCache m_sharedEntityUpdateCache;
+        EntitySnapshotCache m_entitySnapshotCache;
 
         AZStd::unordered_set<ConstNetworkEntityHandle> m_alwaysRelevantToClients;
         AZStd::unordered_set<ConstNetworkEntityHandle> m_alwaysRelevantToServers;
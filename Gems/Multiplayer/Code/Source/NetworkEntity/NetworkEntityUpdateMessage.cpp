@@ -8,6 +8,7 @@
 
 #include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 
 namespace Multiplayer
 {
@@ -16,6 +17,7 @@ namespace Multiplayer
         , m_entityId(rhs.m_entityId)
         , m_isDelete(rhs.m_isDelete)
         , m_wasMigrated(rhs.m_wasMigrated)
+        , m_isSnapshot(rhs.m_isSnapshot)
         , m_hasValidPrefabId(rhs.m_hasValidPrefabId)
         , m_prefabEntityId(rhs.m_prefabEntityId)
         , m_data(AZStd::move(rhs.m_data))
@@ -28,14 +30,12 @@ namespace Multiplayer
         , m_entityId(rhs.m_entityId)
         , m_isDelete(rhs.m_isDelete)
         , m_wasMigrated(rhs.m_wasMigrated)
+        , m_isSnapshot(rhs.m_isSnapshot)
         , m_hasValidPrefabId(rhs.m_hasValidPrefabId)
         , m_prefabEntityId(rhs.m_prefabEntityId)
+        , m_data(rhs.m_data) // Shared, ModifyData() copies on write
     {
-        if (rhs.m_data != nullptr)
-        {
-            m_data = AZStd::make_unique<AzNetworking::PacketEncodingBuffer>();
-            (*m_data) = (*rhs.m_data); // Deep-copy
-        }
+        ;
     }
 
     NetworkEntityUpdateMessage::NetworkEntityUpdateMessage(NetEntityRole networkRole, NetEntityId entityId)
@@ -68,6 +68,7 @@ namespace Multiplayer
         m_entityId = rhs.m_entityId;
         m_isDelete = rhs.m_isDelete;
         m_wasMigrated = rhs.m_wasMigrated;
+        m_isSnapshot = rhs.m_isSnapshot;
         m_hasValidPrefabId = rhs.m_hasValidPrefabId;
         m_prefabEntityId = rhs.m_prefabEntityId;
         m_data = AZStd::move(rhs.m_data);
@@ -80,12 +81,12 @@ namespace Multiplayer
         m_entityId = rhs.m_entityId;
         m_isDelete = rhs.m_isDelete;
         m_wasMigrated = rhs.m_wasMigrated;
+        m_isSnapshot = rhs.m_isSnapshot;
         m_hasValidPrefabId = rhs.m_hasValidPrefabId;
         m_prefabEntityId = rhs.m_prefabEntityId;
         if (rhs.m_data != nullptr)
         {
-            m_data = AZStd::make_unique<AzNetworking::PacketEncodingBuffer>();
-            *m_data = (*rhs.m_data);
+            m_data = rhs.m_data; // Shared, ModifyData() copies on write
         }
         return *this;
     }
@@ -97,6 +98,7 @@ namespace Multiplayer
              && (m_entityId == rhs.m_entityId)
              && (m_isDelete == rhs.m_isDelete)
              && (m_wasMigrated == rhs.m_wasMigrated)
+             && (m_isSnapshot == rhs.m_isSnapshot)
              && (m_hasValidPrefabId == rhs.m_hasValidPrefabId)
              && (m_prefabEntityId == rhs.m_prefabEntityId));
     }
@@ -152,6 +154,16 @@ namespace Multiplayer
         return m_wasMigrated;
     }
 
+    void NetworkEntityUpdateMessage::SetIsSnapshot(bool value)
+    {
+        m_isSnapshot = value;
+    }
+
+    bool NetworkEntityUpdateMessage::GetIsSnapshot() const
+    {
+        return m_isSnapshot;
+    }
+
     bool NetworkEntityUpdateMessage::GetHasValidPrefabId() const
     {
         return m_hasValidPrefabId;
@@ -170,11 +182,12 @@ namespace Multiplayer
 
     void NetworkEntityUpdateMessage::SetData(const AzNetworking::PacketEncodingBuffer& value)
     {
-        if (m_data == nullptr)
-        {
-            m_data = AZStd::make_unique<AzNetworking::PacketEncodingBuffer>();
-        }
-        (*m_data) = value;
+        ModifyData() = value;
+    }
+
+    void NetworkEntityUpdateMessage::SetSharedData(const AZStd::shared_ptr<AzNetworking::PacketEncodingBuffer>& value)
+    {
+        m_data = value;
     }
 
     const AzNetworking::PacketEncodingBuffer* NetworkEntityUpdateMessage::GetData() const
@@ -186,7 +199,11 @@ namespace Multiplayer
     {
         if (m_data == nullptr)
         {
-            m_data = AZStd::make_unique<AzNetworking::PacketEncodingBuffer>();
+            m_data = AZStd::make_shared<AzNetworking::PacketEncodingBuffer>();
+        }
+        else if (m_data.use_count() > 1)
+        {
+            m_data = AZStd::make_shared<AzNetworking::PacketEncodingBuffer>(*m_data); // Deep-copy before writing to shared data
         }
         return *m_data;
     }
@@ -197,13 +214,15 @@ namespace Multiplayer
         serializer.Serialize(m_entityId, "EntityId");
 
         // Use the upper 4 bits for boolean flags, and the lower 4 bits for the network role
-        uint8_t networkTypeAndFlags = (m_isDelete ? 0x40 : 0x00)
+        uint8_t networkTypeAndFlags = (m_isSnapshot ? 0x80 : 0x00)
+                                    | (m_isDelete ? 0x40 : 0x00)
                                     | (m_wasMigrated ? 0x20 : 0x00)
                                     | (m_hasValidPrefabId ? 0x10 : 0x00)
                                     | static_cast<uint8_t>(m_networkRole);
 
         if (serializer.Serialize(networkTypeAndFlags, "TypeAndFlags"))
         {
+            m_isSnapshot = (networkTypeAndFlags & 0x80) == 0x80;
             m_isDelete = (networkTypeAndFlags & 0x40) == 0x40;
             m_wasMigrated = (networkTypeAndFlags & 0x20) == 0x20;
             m_hasValidPrefabId = (networkTypeAndFlags & 0x10) == 0x10;
@@ -221,12 +240,12 @@ namespace Multiplayer
             }
 
             // m_data should never be nullptr unless this is a delete packet
-            if (m_data == nullptr)
+            if ((m_data == nullptr) || (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject))
             {
-                m_data = AZStd::make_unique<AzNetworking::PacketEncodingBuffer>();
+                ModifyData();
             }
 
-            serializer.Serialize(*m_data, "Data");;
+            serializer.Serialize(*m_data, "Data");
         }
 
         return serializer.IsValid();
@@ -0,0 +1,456 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/ReplicationInterestGrid.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <AzFramework/Visibility/EntityBoundsUnionBus.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
+AZ_DECLARE_BUDGET(MULTIPLAYER);
+
+namespace Multiplayer
+{
+    AZ_CVAR(float, sv_ReplicationGridCellSize, 64.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The size of a cell in the spatial hash used to gather entities for client replication windows");
+    AZ_CVAR(uint32_t, sv_ReplicationGridMaxCellsPerEntity, 64, nullptr, AZ::ConsoleFunctorFlags::Null, "Entities overlapping more grid cells than this are tested against every replication window query");
+
+    // Cell coordinates are packed into 21 bits per axis
+    static constexpr int32_t CellCoordinateBits = 21;
+    static constexpr int32_t CellCoordinateMask = (1 << CellCoordinateBits) - 1;
+
+    ReplicationInterestGrid::ReplicationInterestGrid()
+    {
+        AZ::Interface<ReplicationInterestGrid>::Register(this);
+    }
+
+    ReplicationInterestGrid::~ReplicationInterestGrid()
+    {
+        AZ::Interface<ReplicationInterestGrid>::Unregister(this);
+    }
+
+    bool ReplicationInterestGrid::CellRange::operator==(const CellRange& rhs) const
+    {
+        return m_minX == rhs.m_minX && m_minY == rhs.m_minY && m_minZ == rhs.m_minZ
+            && m_maxX == rhs.m_maxX && m_maxY == rhs.m_maxY && m_maxZ == rhs.m_maxZ;
+    }
+
+    uint64_t ReplicationInterestGrid::CellRange::GetCellCount() const
+    {
+        if ((m_maxX < m_minX) || (m_maxY < m_minY) || (m_maxZ < m_minZ))
+        {
+            return 0;
+        }
+        return uint64_t(m_maxX - m_minX + 1) * uint64_t(m_maxY - m_minY + 1) * uint64_t(m_maxZ - m_minZ + 1);
+    }
+
+    void ReplicationInterestGrid::UpdateIfStale()
+    {
+        const INetworkTime* networkTime = GetNetworkTime();
+        const HostFrameId currentFrameId = networkTime ? networkTime->GetHostFrameId() : InvalidHostFrameId;
+        if (!m_isStale && (currentFrameId == m_builtFrameId))
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "ReplicationInterestGrid: Update");
+
+        m_lastUpdatedEntryCount = 0;
+        const float cellSize = AZStd::max(static_cast<float>(sv_ReplicationGridCellSize), 1.0f);
+        if (m_isStale || (cellSize != m_cellSize))
+        {
+            m_cellSize = cellSize;
+            Rebuild();
+        }
+        else
+        {
+            SyncTrackedEntities();
+
+            // Only entities that moved since the last update are re-bucketed
+            for (GridEntry* entry : m_dirtyEntries)
+            {
+                UpdateEntry(*entry);
+            }
+            m_dirtyEntries.clear();
+        }
+
+        m_builtFrameId = currentFrameId;
+        m_isStale = false;
+    }
+
+    void ReplicationInterestGrid::Reset()
+    {
+        m_dirtyEntries = {};
+        m_pendingEntities = {};
+        m_oversizedEntries = {};
+        m_cells = {};
+        m_entries = {};
+        m_isStale = true;
+    }
+
+    void ReplicationInterestGrid::Gather(const AZ::Sphere& sphere, AZStd::vector<const Entry*>& outEntries)
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "ReplicationInterestGrid: Gather");
+
+        // A new stamp per query lets us reject entries we have already visited through another cell
+        if (++m_queryStamp == 0)
+        {
+            for (auto& entryIter : m_entries)
+            {
+                entryIter.second.m_queryStamp = 0;
+            }
+            m_queryStamp = 1;
+        }
+
+        auto testEntry = [this, &sphere, &outEntries](GridEntry* entry)
+        {
+            if (entry->m_queryStamp == m_queryStamp)
+            {
+                return;
+            }
+            entry->m_queryStamp = m_queryStamp;
+
+            if (AZ::ShapeIntersection::Overlaps(sphere, entry->m_worldBounds))
+            {
+                outEntries.push_back(entry);
+            }
+        };
+
+        const AZ::Vector3 radius(sphere.GetRadius());
+        int32_t minX, minY, minZ, maxX, maxY, maxZ;
+        GetCellCoordinates(sphere.GetCenter() - radius, minX, minY, minZ);
+        GetCellCoordinates(sphere.GetCenter() + radius, maxX, maxY, maxZ);
+
+        const uint64_t queryCellCount = uint64_t(maxX - minX + 1) * uint64_t(maxY - minY + 1) * uint64_t(maxZ - minZ + 1);
+        if (queryCellCount > m_cells.size())
+        {
+            // The query covers more cells than are occupied, walk the occupied cells instead
+            for (const auto& cell : m_cells)
+            {
+                for (GridEntry* entry : cell.second)
+                {
+                    testEntry(entry);
+                }
+            }
+        }
+        else
+        {
+            for (int32_t x = minX; x <= maxX; ++x)
+            {
+                for (int32_t y = minY; y <= maxY; ++y)
+                {
+                    for (int32_t z = minZ; z <= maxZ; ++z)
+                    {
+                        auto cellIter = m_cells.find(GetCellKey(x, y, z));
+                        if (cellIter != m_cells.end())
+                        {
+                            for (GridEntry* entry : cellIter->second)
+                            {
+                                testEntry(entry);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        for (GridEntry* entry : m_oversizedEntries)
+        {
+            testEntry(entry);
+        }
+    }
+
+    AZStd::size_t ReplicationInterestGrid::GetEntryCount() const
+    {
+        return m_entries.size();
+    }
+
+    AZStd::size_t ReplicationInterestGrid::GetLastUpdatedEntryCount() const
+    {
+        return m_lastUpdatedEntryCount;
+    }
+
+    void ReplicationInterestGrid::Rebuild()
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "ReplicationInterestGrid: Rebuild");
+
+        m_dirtyEntries.clear();
+        m_pendingEntities.clear();
+        m_oversizedEntries.clear();
+        m_cells.clear();
+        m_entries.clear();
+        m_queryStamp = 0;
+
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        if (networkEntityTracker == nullptr)
+        {
+            return;
+        }
+
+        for (const auto& trackedEntity : *networkEntityTracker)
+        {
+            if (!TryAddEntity(trackedEntity.first, trackedEntity.second))
+            {
+                m_pendingEntities.insert(trackedEntity.first);
+            }
+        }
+
+        m_trackerAddChangeDirty = networkEntityTracker->GetAddChangeDirty();
+        m_trackerDeleteChangeDirty = networkEntityTracker->GetDeleteChangeDirty();
+    }
+
+    void ReplicationInterestGrid::SyncTrackedEntities()
+    {
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        if (networkEntityTracker == nullptr)
+        {
+            return;
+        }
+
+        // Entities are usually added to the tracker before they are activated, retry the ones that weren't active yet
+        for (auto pendingIter = m_pendingEntities.begin(); pendingIter != m_pendingEntities.end();)
+        {
+            AZ::Entity* entity = networkEntityTracker->GetRaw(*pendingIter);
+            if ((entity == nullptr) || TryAddEntity(*pendingIter, entity))
+            {
+                pendingIter = m_pendingEntities.erase(pendingIter);
+            }
+            else
+            {
+                ++pendingIter;
+            }
+        }
+
+        // Only walk the entries or the tracker when entities were actually removed from or added to the tracker
+        const uint32_t deleteChangeDirty = networkEntityTracker->GetDeleteChangeDirty();
+        if (deleteChangeDirty != m_trackerDeleteChangeDirty)
+        {
+            m_trackerDeleteChangeDirty = deleteChangeDirty;
+            for (auto entryIter = m_entries.begin(); entryIter != m_entries.end();)
+            {
+                // A disconnected handler means the entity this entry listened to was destroyed, even if its id was reused
+                const GridEntry& entry = entryIter->second;
+                if ((entry.m_entityHandle.GetEntity() == nullptr) || !entry.m_transformChangedHandler.IsConnected())
+                {
+                    auto removeIter = entryIter++;
+                    RemoveEntry(removeIter);
+                }
+                else
+                {
+                    ++entryIter;
+                }
+            }
+        }
+
+        const uint32_t addChangeDirty = networkEntityTracker->GetAddChangeDirty();
+        if (addChangeDirty != m_trackerAddChangeDirty)
+        {
+            m_trackerAddChangeDirty = addChangeDirty;
+            for (const auto& trackedEntity : *networkEntityTracker)
+            {
+                if ((m_entries.find(trackedEntity.first) != m_entries.end())
+                    || (m_pendingEntities.find(trackedEntity.first) != m_pendingEntities.end()))
+                {
+                    continue;
+                }
+
+                if (!TryAddEntity(trackedEntity.first, trackedEntity.second))
+                {
+                    m_pendingEntities.insert(trackedEntity.first);
+                }
+            }
+        }
+    }
+
+    bool ReplicationInterestGrid::TryAddEntity(NetEntityId netEntityId, AZ::Entity* entity)
+    {
+        if ((entity == nullptr) || (entity->GetState() != AZ::Entity::State::Active))
+        {
+            // Not active yet, try again on the next update
+            return false;
+        }
+
+        AZ::TransformInterface* transformInterface = entity->GetTransform();
+        if (transformInterface == nullptr)
+        {
+            return true;
+        }
+
+        ConstNetworkEntityHandle entityHandle(entity, GetNetworkEntityTracker());
+        if (entityHandle.GetNetBindComponent() == nullptr)
+        {
+            return true;
+        }
+
+        auto insertResult = m_entries.try_emplace(netEntityId);
+        if (!insertResult.second)
+        {
+            return true;
+        }
+
+        GridEntry& entry = insertResult.first->second;
+        entry.m_entityHandle = entityHandle;
+        entry.m_transformChangedHandler = AZ::TransformChangedEvent::Handler(
+            [this, &entry]([[maybe_unused]] const AZ::Transform& localTm, [[maybe_unused]] const AZ::Transform& worldTm)
+            {
+                MarkDirty(entry);
+            });
+        transformInterface->BindTransformChangedEventHandler(entry.m_transformChangedHandler);
+
+        UpdateEntry(entry);
+        return true;
+    }
+
+    void ReplicationInterestGrid::RemoveEntry(EntryMap::iterator entryIter)
+    {
+        GridEntry& entry = entryIter->second;
+        RemoveFromCells(entry);
+        if (entry.m_isDirty)
+        {
+            m_dirtyEntries.erase(AZStd::find(m_dirtyEntries.begin(), m_dirtyEntries.end(), &entry));
+        }
+        m_entries.erase(entryIter);
+    }
+
+    void ReplicationInterestGrid::MarkDirty(GridEntry& entry)
+    {
+        if (!entry.m_isDirty)
+        {
+            entry.m_isDirty = true;
+            m_dirtyEntries.push_back(&entry);
+        }
+    }
+
+    void ReplicationInterestGrid::UpdateEntry(GridEntry& entry)
+    {
+        ++m_lastUpdatedEntryCount;
+        entry.m_isDirty = false;
+
+        AZ::Entity* entity = entry.m_entityHandle.GetEntity();
+        AZ::TransformInterface* transformInterface = entity ? entity->GetTransform() : nullptr;
+        if (transformInterface == nullptr)
+        {
+            // The entity was removed, the entry is dropped once the tracker reports the removal
+            return;
+        }
+
+        AzFramework::IEntityBoundsUnion* boundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
+        AZ::Aabb worldBounds = boundsUnion ? boundsUnion->GetEntityWorldBoundsUnion(entity->GetId()) : AZ::Aabb::CreateNull();
+        if (!worldBounds.IsValid())
+        {
+            worldBounds = AZ::Aabb::CreateFromPoint(transformInterface->GetWorldTranslation());
+        }
+        entry.m_worldBounds = worldBounds;
+
+        // Entities that moved within their cells keep their buckets
+        const CellRange cellRange = GetCellRange(worldBounds);
+        const bool isOversized = cellRange.GetCellCount() > sv_ReplicationGridMaxCellsPerEntity;
+        if ((cellRange == entry.m_cellRange) && (isOversized == entry.m_isOversized))
+        {
+            return;
+        }
+
+        RemoveFromCells(entry);
+        entry.m_cellRange = cellRange;
+        entry.m_isOversized = isOversized;
+        InsertIntoCells(entry);
+    }
+
+    void ReplicationInterestGrid::InsertIntoCells(GridEntry& entry)
+    {
+        if (entry.m_isOversized)
+        {
+            m_oversizedEntries.push_back(&entry);
+            return;
+        }
+
+        const CellRange& range = entry.m_cellRange;
+        for (int32_t x = range.m_minX; x <= range.m_maxX; ++x)
+        {
+            for (int32_t y = range.m_minY; y <= range.m_maxY; ++y)
+            {
+                for (int32_t z = range.m_minZ; z <= range.m_maxZ; ++z)
+                {
+                    m_cells[GetCellKey(x, y, z)].push_back(&entry);
+                }
+            }
+        }
+    }
+
+    void ReplicationInterestGrid::RemoveFromCells(GridEntry& entry)
+    {
+        auto swapAndPop = [](AZStd::vector<GridEntry*>& entries, GridEntry* entryToRemove)
+        {
+            auto entryIter = AZStd::find(entries.begin(), entries.end(), entryToRemove);
+            if (entryIter != entries.end())
+            {
+                *entryIter = entries.back();
+                entries.pop_back();
+            }
+        };
+
+        if (entry.m_isOversized)
+        {
+            swapAndPop(m_oversizedEntries, &entry);
+            return;
+        }
+
+        const CellRange& range = entry.m_cellRange;
+        for (int32_t x = range.m_minX; x <= range.m_maxX; ++x)
+        {
+            for (int32_t y = range.m_minY; y <= range.m_maxY; ++y)
+            {
+                for (int32_t z = range.m_minZ; z <= range.m_maxZ; ++z)
+                {
+                    auto cellIter = m_cells.find(GetCellKey(x, y, z));
+                    if (cellIter != m_cells.end())
+                    {
+                        swapAndPop(cellIter->second, &entry);
+                        if (cellIter->second.empty())
+                        {
+                            // Drop cells that became empty so queries don't walk them
+                            m_cells.erase(cellIter);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    ReplicationInterestGrid::CellRange ReplicationInterestGrid::GetCellRange(const AZ::Aabb& bounds) const
+    {
+        CellRange range;
+        GetCellCoordinates(bounds.GetMin(), range.m_minX, range.m_minY, range.m_minZ);
+        GetCellCoordinates(bounds.GetMax(), range.m_maxX, range.m_maxY, range.m_maxZ);
+        return range;
+    }
+
+    ReplicationInterestGrid::CellKey ReplicationInterestGrid::GetCellKey(int32_t x, int32_t y, int32_t z) const
+    {
+        return (static_cast<CellKey>(x & CellCoordinateMask) << (CellCoordinateBits * 2))
+            | (static_cast<CellKey>(y & CellCoordinateMask) << CellCoordinateBits)
+            | static_cast<CellKey>(z & CellCoordinateMask);
+    }
+
+    void ReplicationInterestGrid::GetCellCoordinates(const AZ::Vector3& position, int32_t& outX, int32_t& outY, int32_t& outZ) const
+    {
+        // Clamp to the packable range so huge worlds alias instead of overflowing
+        constexpr float MaxCoordinate = static_cast<float>((1 << (CellCoordinateBits - 1)) - 1);
+        const AZ::Vector3 cell = position / m_cellSize;
+        outX = static_cast<int32_t>(AZStd::floor(AZStd::clamp(cell.GetX(), -MaxCoordinate, MaxCoordinate)));
+        outY = static_cast<int32_t>(AZStd::floor(AZStd::clamp(cell.GetY(), -MaxCoordinate, MaxCoordinate)));
+        outZ = static_cast<int32_t>(AZStd::floor(AZStd::clamp(cell.GetZ(), -MaxCoordinate, MaxCoordinate)));
+    }
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Sphere.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! @class ReplicationInterestGrid
+    //! @brief Spatial hash of all active network entities, shared by every replication window on a host.
+    //!
+    //! The grid is updated lazily at most once per host frame. Entries persist between frames and only entities whose
+    //! transform changed since the last update are moved between cells, so the cost of gathering entity positions and
+    //! netbinding is paid for moving entities only instead of for every entity once per connection. Replication windows
+    //! query it with their awareness sphere and only ever see entities that have a NetBindComponent.
+    class ReplicationInterestGrid
+    {
+    public:
+        AZ_RTTI(ReplicationInterestGrid, "{5B0E3F61-8C4B-4D57-9C2B-8B9A4C0F6E21}");
+
+        struct Entry
+        {
+            ConstNetworkEntityHandle m_entityHandle;
+            AZ::Aabb m_worldBounds = AZ::Aabb::CreateNull();
+        };
+
+        ReplicationInterestGrid();
+        virtual ~ReplicationInterestGrid();
+
+        //! Updates the grid if it has not been updated yet during the current host frame.
+        //! Adds and removes entities that entered or left the network entity tracker and re-buckets entities that moved.
+        void UpdateIfStale();
+
+        //! Releases all memory and marks the grid as stale so the next query rebuilds it.
+        void Reset();
+
+        //! Gathers all entries whose bounds overlap the provided sphere.
+        //! @param sphere     the sphere to gather entities in
+        //! @param outEntries output list of entries, the pointers are valid until the grid is next updated
+        void Gather(const AZ::Sphere& sphere, AZStd::vector<const Entry*>& outEntries);
+
+        //! Returns the number of entities in the grid.
+        AZStd::size_t GetEntryCount() const;
+
+        //! Returns the number of entries whose bounds were recomputed by the last update.
+        AZStd::size_t GetLastUpdatedEntryCount() const;
+
+    private:
+        using CellKey = uint64_t;
+
+        struct CellRange
+        {
+            int32_t m_minX = 0;
+            int32_t m_minY = 0;
+            int32_t m_minZ = 0;
+            int32_t m_maxX = -1;
+            int32_t m_maxY = -1;
+            int32_t m_maxZ = -1;
+
+            bool operator==(const CellRange& rhs) const;
+            uint64_t GetCellCount() const;
+        };
+
+        struct GridEntry
+            : public Entry
+        {
+            //! Marks the entry dirty when the entity moves, the entry is re-bucketed during the next update.
+            AZ::TransformChangedEvent::Handler m_transformChangedHandler;
+            CellRange m_cellRange;
+            //! Query stamp of the entry, used to skip entries that span multiple cells during a single gather.
+            uint32_t m_queryStamp = 0;
+            bool m_isOversized = false;
+            bool m_isDirty = false;
+        };
+
+        using EntryMap = AZStd::unordered_map<NetEntityId, GridEntry>;
+        using CellMap = AZStd::unordered_map<CellKey, AZStd::vector<GridEntry*>>;
+
+        void Rebuild();
+        void SyncTrackedEntities();
+        bool TryAddEntity(NetEntityId netEntityId, AZ::Entity* entity);
+        void RemoveEntry(EntryMap::iterator entryIter);
+        void MarkDirty(GridEntry& entry);
+        void UpdateEntry(GridEntry& entry);
+        void InsertIntoCells(GridEntry& entry);
+        void RemoveFromCells(GridEntry& entry);
+        CellRange GetCellRange(const AZ::Aabb& bounds) const;
+        CellKey GetCellKey(int32_t x, int32_t y, int32_t z) const;
+        void GetCellCoordinates(const AZ::Vector3& position, int32_t& outX, int32_t& outY, int32_t& outZ) const;
+
+        //! Entries are stored in a node based map, so their addresses stay valid until they are removed.
+        EntryMap m_entries;
+        //! Entries whose entity moved since the last update.
+        AZStd::vector<GridEntry*> m_dirtyEntries;
+        //! Tracked entities that were not active yet when they were added to the tracker, checked again every update.
+        //! Hashed so the tracker walk in SyncTrackedEntities can skip them in constant time.
+        AZStd::unordered_set<NetEntityId> m_pendingEntities;
+        //! Entries too large to be bucketed, tested against every query.
+        AZStd::vector<GridEntry*> m_oversizedEntries;
+        CellMap m_cells;
+
+        HostFrameId m_builtFrameId = InvalidHostFrameId;
+        uint32_t m_trackerAddChangeDirty = 0;
+        uint32_t m_trackerDeleteChangeDirty = 0;
+        uint32_t m_queryStamp = 0;
+        AZStd::size_t m_lastUpdatedEntryCount = 0;
+        float m_cellSize = 1.0f;
+        bool m_isStale = true;
+    };
+}
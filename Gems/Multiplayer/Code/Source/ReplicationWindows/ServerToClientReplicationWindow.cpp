@@ -7,10 +7,11 @@
  */
 
 #include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Source/ReplicationWindows/ReplicationInterestGrid.h>
 #include <Source/AutoGen/Multiplayer.AutoPackets.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
-#include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <Multiplayer/ReplicationWindows/IReplicationPriorityManager.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/std/sort.h>
@@ -21,6 +22,8 @@ namespace Multiplayer
     AZ_CVAR(uint32_t, sv_MaxEntitiesToTrackReplication, 512, nullptr, AZ::ConsoleFunctorFlags::Null, "The default max number of entities to track for replication");
     AZ_CVAR(uint32_t, sv_MinEntitiesToReplicate, 128, nullptr, AZ::ConsoleFunctorFlags::Null, "The default min number of entities to replicate to a client connection");
     AZ_CVAR(uint32_t, sv_MaxEntitiesToReplicate, 256, nullptr, AZ::ConsoleFunctorFlags::Null, "The default max number of entities to replicate to a client connection");
+    AZ_CVAR(uint32_t, sv_MinBytesToReplicate, 4096, nullptr, AZ::ConsoleFunctorFlags::Null, "The per tick budget in bytes of proxy entity updates sent to a client connection with poor quality of service, 0 for unbounded");
+    AZ_CVAR(uint32_t, sv_MaxBytesToReplicate, 16384, nullptr, AZ::ConsoleFunctorFlags::Null, "The per tick budget in bytes of proxy entity updates sent to a client connection, 0 for unbounded");
     AZ_CVAR(uint32_t, sv_PacketsToIntegrateQos, 1000, nullptr, AZ::ConsoleFunctorFlags::Null, "The number of packets to accumulate before updating connection quality of service metrics");
     AZ_CVAR(float, sv_BadConnectionThreshold, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null, "The loss percentage beyond which we consider our network bad");
     AZ_CVAR(AZ::TimeMs, sv_ClientReplicationWindowUpdateMs, AZ::TimeMs{ 300 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Rate for replication window updates.");
@@ -92,6 +95,16 @@ namespace Multiplayer
         return m_isPoorConnection ? sv_MinEntitiesToReplicate : sv_MaxEntitiesToReplicate;
     }
 
+    float ServerToClientReplicationWindow::CalculateEntityPriority(float distanceSquared, float priorityScale)
+    {
+        return AZStd::max(priorityScale, IReplicationPriorityManager::MinPriorityScale) / AZStd::max(distanceSquared, 1.0f);
+    }
+
+    uint32_t ServerToClientReplicationWindow::GetMaxProxyEntityReplicatorSendBytes() const
+    {
+        return m_isPoorConnection ? sv_MinBytesToReplicate : sv_MaxBytesToReplicate;
+    }
+
     bool ServerToClientReplicationWindow::IsInWindow([[maybe_unused]] const ConstNetworkEntityHandle& entityHandle, NetEntityRole& outNetworkRole) const
     {
         AZ_Assert(false, "IsInWindow should not be called on the ServerToClientReplicationWindow");
@@ -121,32 +134,28 @@ namespace Multiplayer
         AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
         const AZ::Vector3 controlledEntityPosition = transformInterface->GetWorldTranslation();
 
-        AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
-        AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
-        AZ::Interface<AzFramework::IVisibilitySystem>::Get()->GetDefaultVisibilityScene()->Enumerate(awarenessSphere, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
-            {
-                gatheredEntries.reserve(gatheredEntries.size() + nodeData.m_entries.size());
-                for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
-                {
-                    if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
-                    {
-                        gatheredEntries.push_back(visEntry);
-                    }
-                }
-            }
-        );
+        // Gather from the interest grid shared by all connections, it only holds entities with netbinding
+        m_gatheredEntries.clear();
+        ReplicationInterestGrid* interestGrid = AZ::Interface<ReplicationInterestGrid>::Get();
+        AZ_Assert(interestGrid, "ReplicationInterestGrid must be created.");
+        if (interestGrid)
+        {
+            interestGrid->UpdateIfStale();
+            const AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
+            interestGrid->Gather(awarenessSphere, m_gatheredEntries);
+        }
 
-        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();        
         IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
+        IReplicationPriorityManager* priorityManager = AZ::Interface<IReplicationPriorityManager>::Get();
 
         // Add all the neighbours
-        for (AzFramework::VisibilityEntry* visEntry : gatheredEntries)
+        for (const ReplicationInterestGrid::Entry* gatheredEntry : m_gatheredEntries)
         {
-            AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
-            NetworkEntityHandle entityHandle(entity, networkEntityTracker);
-            if (entityHandle.GetNetBindComponent() == nullptr)
+            ConstNetworkEntityHandle entityHandle = gatheredEntry->m_entityHandle;
+            AZ::Entity* entity = entityHandle.GetEntity();
+            if ((entity == nullptr) || (entity->GetState() != AZ::Entity::State::Active))
             {
-                // Entity does not have netbinding, skip this entity
+                // Entity was removed or deactivated since it was added to the grid
                 continue;
             }
 
@@ -156,11 +165,12 @@ namespace Multiplayer
             }
 
             // We want to find the closest extent to the player and prioritize using that distance
-            const AZ::Vector3 supportNormal = controlledEntityPosition - visEntry->m_boundingVolume.GetCenter();
-            const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
-            const float gatherDistanceSquared = controlledEntityPosition.GetDistanceSq(closestPosition);
-            const float priority = (gatherDistanceSquared > 0.0f) ? 1.0f / gatherDistanceSquared : 0.0f;
-                
+            const float gatherDistanceSquared = gatheredEntry->m_worldBounds.GetDistanceSq(controlledEntityPosition);
+            const float priorityScale = priorityManager
+                ? priorityManager->GetEntityPriorityScale(entity, m_controlledEntity, m_connection->GetConnectionId())
+                : 1.0f;
+            const float priority = CalculateEntityPriority(gatherDistanceSquared, priorityScale);
+
             AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
         }
 
@@ -11,6 +11,7 @@
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <Source/ReplicationWindows/ReplicationInterestGrid.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/EBus/ScheduledEvent.h>
@@ -41,11 +42,16 @@ namespace Multiplayer
 
         ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection);
 
+        //! Returns the replication priority of an entity at the given squared distance from the player's entity.
+        //! The priority scale is clamped to IReplicationPriorityManager::MinPriorityScale so the entity is never starved.
+        static float CalculateEntityPriority(float distanceSquared, float priorityScale);
+
         //! IReplicationWindow interface
         //! @{
         bool ReplicationSetUpdateReady() override;
         const ReplicationSet& GetReplicationSet() const override;
         uint32_t GetMaxProxyEntityReplicatorSendCount() const override;
+        uint32_t GetMaxProxyEntityReplicatorSendBytes() const override;
         bool IsInWindow(const ConstNetworkEntityHandle& entityPtr, NetEntityRole& outNetworkRole) const override;
         void UpdateWindow() override;
         AzNetworking::PacketId SendEntityUpdateMessages(NetworkEntityUpdateVector& entityUpdateVector) override;
@@ -68,6 +74,8 @@ namespace Multiplayer
         // sorted in reverse, lowest priority is the top()
         ReplicationCandidateQueue m_candidateQueue;
         ReplicationSet m_replicationSet;
+        // Reused between updates to avoid reallocating the gather list
+        AZStd::vector<const ReplicationInterestGrid::Entry*> m_gatheredEntries;
 
         AZ::ScheduledEvent m_updateWindowEvent;
 
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/IMultiplayer.h>
+#include <Source/NetworkEntity/EntityReplication/EntitySnapshot.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class EntitySnapshotTests
+        : public LeakDetectionFixture
+    {
+    public:
+        EntitySnapshot CreateSnapshot(uint32_t frameId, uint32_t size, uint8_t seed)
+        {
+            EntitySnapshot snapshot;
+            snapshot.m_frameId = HostFrameId{ frameId };
+            snapshot.m_state = AZStd::make_shared<AzNetworking::PacketEncodingBuffer>();
+            snapshot.m_state->Resize(size);
+            for (uint32_t i = 0; i < size; ++i)
+            {
+                snapshot.m_state->GetBuffer()[i] = static_cast<uint8_t>(i * 7 + seed);
+            }
+            return snapshot;
+        }
+
+        // Encodes the snapshot and decodes it into the provided history, returns the decoded snapshot
+        const EntitySnapshot* RoundTrip(const EntitySnapshot& snapshot, const EntitySnapshot* baseline, EntitySnapshotHistory& history)
+        {
+            InputSerializer inputSerializer(m_payload.GetBuffer(), static_cast<uint32_t>(m_payload.GetCapacity()));
+            EXPECT_TRUE(EncodeEntitySnapshot(inputSerializer, snapshot, baseline));
+            m_payload.Resize(inputSerializer.GetSize());
+
+            OutputSerializer outputSerializer(m_payload.GetBuffer(), static_cast<uint32_t>(m_payload.GetSize()));
+            return history.Decode(outputSerializer);
+        }
+
+        AzNetworking::PacketEncodingBuffer m_payload;
+    };
+
+    TEST_F(EntitySnapshotTests, FullSnapshotRoundTrip)
+    {
+        EntitySnapshotHistory history(8);
+        const EntitySnapshot snapshot = CreateSnapshot(1, 37, 0);
+
+        const EntitySnapshot* decoded = RoundTrip(snapshot, nullptr, history);
+        ASSERT_NE(decoded, nullptr);
+        EXPECT_EQ(decoded->m_frameId, snapshot.m_frameId);
+        EXPECT_EQ(*decoded->m_state, *snapshot.m_state);
+        EXPECT_EQ(history.Find(HostFrameId{ 1 }), decoded);
+    }
+
+    TEST_F(EntitySnapshotTests, DeltaSnapshotRoundTrip)
+    {
+        EntitySnapshotHistory history(8);
+        const EntitySnapshot baseline = CreateSnapshot(1, 2000, 0);
+        ASSERT_NE(RoundTrip(baseline, nullptr, history), nullptr);
+        const AZStd::size_t fullSize = m_payload.GetSize();
+
+        // Change a few bytes across both word blocks
+        EntitySnapshot current = CreateSnapshot(2, 2000, 0);
+        current.m_state->GetBuffer()[3] = 0xFF;
+        current.m_state->GetBuffer()[1500] = 0xFF;
+
+        const EntitySnapshot* decoded = RoundTrip(current, &baseline, history);
+        ASSERT_NE(decoded, nullptr);
+        EXPECT_EQ(*decoded->m_state, *current.m_state);
+        EXPECT_LT(m_payload.GetSize(), fullSize / 4);
+    }
+
+    TEST_F(EntitySnapshotTests, DeltaSnapshotSizeChange)
+    {
+        EntitySnapshotHistory history(8);
+        const EntitySnapshot baseline = CreateSnapshot(1, 100, 0);
+        ASSERT_NE(RoundTrip(baseline, nullptr, history), nullptr);
+
+        const EntitySnapshot grown = CreateSnapshot(2, 131, 1);
+        const EntitySnapshot* decoded = RoundTrip(grown, &baseline, history);
+        ASSERT_NE(decoded, nullptr);
+        EXPECT_EQ(*decoded->m_state, *grown.m_state);
+
+        const EntitySnapshot shrunk = CreateSnapshot(3, 45, 2);
+        decoded = RoundTrip(shrunk, &grown, history);
+        ASSERT_NE(decoded, nullptr);
+        EXPECT_EQ(*decoded->m_state, *shrunk.m_state);
+    }
+
+    TEST_F(EntitySnapshotTests, MissingBaselineFails)
+    {
+        EntitySnapshotHistory history(2);
+        const EntitySnapshot baseline = CreateSnapshot(1, 64, 0);
+        ASSERT_NE(RoundTrip(baseline, nullptr, history), nullptr);
+        ASSERT_NE(RoundTrip(CreateSnapshot(2, 64, 1), nullptr, history), nullptr);
+        ASSERT_NE(RoundTrip(CreateSnapshot(3, 64, 2), nullptr, history), nullptr);
+
+        // Frame 1 has been evicted from the history
+        EXPECT_EQ(history.Find(HostFrameId{ 1 }), nullptr);
+        EXPECT_EQ(RoundTrip(CreateSnapshot(4, 64, 3), &baseline, history), nullptr);
+    }
+}
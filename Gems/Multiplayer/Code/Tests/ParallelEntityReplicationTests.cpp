@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CommonNetworkEntitySetup.h>
+#include <Multiplayer/ConnectionData/IConnectionData.h>
+#include <Source/ConnectionData/ClientToServerConnectionData.h>
+#include <Source/NetworkEntity/EntityReplication/EntitySnapshot.h>
+#include <Source/ReplicationWindows/NullReplicationWindow.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace Multiplayer
+{
+    //! Connection data that only implements the required interface, so it uses the default PrepareUpdates.
+    class SerialConnectionData
+        : public IConnectionData
+    {
+    public:
+        SerialConnectionData(AzNetworking::IConnection* connection, AzNetworking::IConnectionListener& connectionListener)
+            : m_connection(connection)
+            , m_entityReplicationManager(*connection, connectionListener, EntityReplicationManager::Mode::LocalClientToRemoteServer)
+        {
+            ;
+        }
+
+        ConnectionDataType GetConnectionDataType() const override { return ConnectionDataType::ClientToServer; }
+        AzNetworking::IConnection* GetConnection() const override { return m_connection; }
+        EntityReplicationManager& GetReplicationManager() override { return m_entityReplicationManager; }
+        void Update() override { ++m_updateCount; m_entityReplicationManager.SendUpdates(); }
+        bool CanSendUpdates() const override { return true; }
+        void SetCanSendUpdates(bool) override {}
+        bool DidHandshake() const override { return true; }
+        void SetDidHandshake(bool) override {}
+
+        uint32_t m_updateCount = 0;
+
+    private:
+        AzNetworking::IConnection* m_connection = nullptr;
+        EntityReplicationManager m_entityReplicationManager;
+    };
+
+    class ParallelEntityReplicationTests
+        : public NetworkEntityTests
+    {
+    public:
+        void SetUp() override
+        {
+            NetworkEntityTests::SetUp();
+
+            m_root = AZStd::make_unique<EntityInfo>(1, "root", NetEntityId{ 1 }, EntityInfo::Role::None);
+            m_root->m_entity->CreateComponent<AzFramework::TransformComponent>();
+            m_root->m_entity->CreateComponent<NetBindComponent>();
+            m_root->m_entity->CreateComponent<NetworkTransformComponent>();
+            SetupEntity(m_root->m_entity, m_root->m_netId, NetEntityRole::Authority);
+            m_root->m_entity->Activate();
+
+            m_snapshotCache = AZ::Interface<EntitySnapshotCache>::Get();
+            EXPECT_NE(m_snapshotCache, nullptr);
+            m_snapshotCache->Reset();
+        }
+
+        void TearDown() override
+        {
+            m_root.reset();
+            NetworkEntityTests::TearDown();
+        }
+
+        AZStd::unique_ptr<EntityInfo> m_root;
+        EntitySnapshotCache* m_snapshotCache = nullptr;
+    };
+
+    TEST_F(ParallelEntityReplicationTests, PreparedUpdatesAreSentByUpdate)
+    {
+        ClientToServerConnectionData connectionData(m_mockConnection.get(), *m_mockConnectionListener);
+        connectionData.GetReplicationManager().SetReplicationWindow(AZStd::make_unique<NullReplicationWindow>(m_mockConnection.get()));
+
+        EXPECT_FALSE(connectionData.GetReplicationManager().HasPreparedUpdates());
+        connectionData.PrepareUpdates();
+        EXPECT_TRUE(connectionData.GetReplicationManager().HasPreparedUpdates());
+
+        connectionData.Update();
+        EXPECT_FALSE(connectionData.GetReplicationManager().HasPreparedUpdates());
+
+        // Without preparing first, Update serializes and sends in one go
+        connectionData.Update();
+        EXPECT_FALSE(connectionData.GetReplicationManager().HasPreparedUpdates());
+    }
+
+    TEST_F(ParallelEntityReplicationTests, DefaultPrepareUpdatesDefersToUpdate)
+    {
+        SerialConnectionData connectionData(m_mockConnection.get(), *m_mockConnectionListener);
+        connectionData.GetReplicationManager().SetReplicationWindow(AZStd::make_unique<NullReplicationWindow>(m_mockConnection.get()));
+
+        IConnectionData& connectionInterface = connectionData;
+        connectionInterface.PrepareUpdates();
+        EXPECT_FALSE(connectionData.GetReplicationManager().HasPreparedUpdates());
+
+        connectionInterface.Update();
+        EXPECT_EQ(connectionData.m_updateCount, 1);
+        EXPECT_FALSE(connectionData.GetReplicationManager().HasPreparedUpdates());
+    }
+
+    TEST_F(ParallelEntityReplicationTests, ConcurrentSnapshotsAreSharedBetweenConnections)
+    {
+        NetBindComponent* netBindComponent = m_root->m_entity->FindComponent<NetBindComponent>();
+        ASSERT_NE(netBindComponent, nullptr);
+
+        constexpr uint32_t ThreadCount = 8;
+        EntitySnapshot snapshots[ThreadCount];
+        EntitySnapshot::SharedBuffer payloads[ThreadCount];
+
+        AZStd::vector<AZStd::thread> threads;
+        for (uint32_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads.emplace_back([this, netBindComponent, threadIndex, &snapshots, &payloads]()
+            {
+                snapshots[threadIndex] = m_snapshotCache->GetCurrentSnapshot(m_root->m_netId, *netBindComponent);
+                payloads[threadIndex] = m_snapshotCache->GetEncodedSnapshot(m_root->m_netId, nullptr);
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        // Every connection ends up with the state and payload stored by the first one, regardless of which thread built them
+        const EntitySnapshot cachedSnapshot = m_snapshotCache->GetCurrentSnapshot(m_root->m_netId, *netBindComponent);
+        const EntitySnapshot::SharedBuffer cachedPayload = m_snapshotCache->GetEncodedSnapshot(m_root->m_netId, nullptr);
+        ASSERT_NE(cachedSnapshot.m_state, nullptr);
+        ASSERT_NE(cachedPayload, nullptr);
+        for (uint32_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            EXPECT_EQ(snapshots[threadIndex].m_state, cachedSnapshot.m_state);
+            EXPECT_EQ(snapshots[threadIndex].m_frameId, cachedSnapshot.m_frameId);
+            EXPECT_EQ(payloads[threadIndex], cachedPayload);
+        }
+    }
+
+    TEST_F(ParallelEntityReplicationTests, SnapshotsAreRebuiltForNewHostFrames)
+    {
+        NetBindComponent* netBindComponent = m_root->m_entity->FindComponent<NetBindComponent>();
+        ASSERT_NE(netBindComponent, nullptr);
+
+        ON_CALL(*m_mockNetworkTime, GetHostFrameId()).WillByDefault(Return(HostFrameId{ 1 }));
+        const EntitySnapshot firstSnapshot = m_snapshotCache->GetCurrentSnapshot(m_root->m_netId, *netBindComponent);
+        ASSERT_NE(firstSnapshot.m_state, nullptr);
+        EXPECT_EQ(firstSnapshot.m_frameId, HostFrameId{ 1 });
+
+        ON_CALL(*m_mockNetworkTime, GetHostFrameId()).WillByDefault(Return(HostFrameId{ 2 }));
+        const EntitySnapshot secondSnapshot = m_snapshotCache->GetCurrentSnapshot(m_root->m_netId, *netBindComponent);
+        ASSERT_NE(secondSnapshot.m_state, nullptr);
+        EXPECT_EQ(secondSnapshot.m_frameId, HostFrameId{ 2 });
+        EXPECT_NE(secondSnapshot.m_state, firstSnapshot.m_state);
+        EXPECT_EQ(*secondSnapshot.m_state, *firstSnapshot.m_state);
+
+        // The previous snapshot is still a valid baseline for the delta encoding
+        EXPECT_NE(m_snapshotCache->GetEncodedSnapshot(m_root->m_netId, &firstSnapshot), nullptr);
+    }
+}
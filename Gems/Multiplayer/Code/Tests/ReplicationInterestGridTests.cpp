@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CommonNetworkEntitySetup.h>
+#include <AzCore/Math/Sphere.h>
+#include <Source/ReplicationWindows/ReplicationInterestGrid.h>
+#include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+
+namespace Multiplayer
+{
+    class ReplicationInterestGridTests
+        : public NetworkEntityTests
+    {
+    public:
+        void SetUp() override
+        {
+            NetworkEntityTests::SetUp();
+
+            m_interestGrid = AZ::Interface<ReplicationInterestGrid>::Get();
+            EXPECT_NE(m_interestGrid, nullptr);
+            m_interestGrid->Reset();
+
+            m_nearEntity = CreateEntity(1, "Near", NetEntityId{ 1 }, AZ::Vector3(1.0f, 0.0f, 0.0f));
+            m_farEntity = CreateEntity(2, "Far", NetEntityId{ 2 }, AZ::Vector3(1000.0f, 0.0f, 0.0f));
+        }
+
+        void TearDown() override
+        {
+            StopAndDeactivateEntity(m_farEntity);
+            StopAndDeactivateEntity(m_nearEntity);
+
+            NetworkEntityTests::TearDown();
+        }
+
+        AZStd::unique_ptr<AZ::Entity> CreateEntity(AZ::u64 entityId, const char* name, NetEntityId netEntityId, const AZ::Vector3& position)
+        {
+            auto entity = AZStd::make_unique<AZ::Entity>(AZ::EntityId(entityId), name);
+            entity->CreateComponent<AzFramework::TransformComponent>();
+            entity->CreateComponent<NetBindComponent>();
+            SetupEntity(entity, netEntityId, NetEntityRole::Client);
+            entity->Activate();
+            entity->GetTransform()->SetWorldTranslation(position);
+            return entity;
+        }
+
+        void AdvanceFrame()
+        {
+            ++m_frameId;
+            ON_CALL(*m_mockNetworkTime, GetHostFrameId()).WillByDefault(Return(m_frameId));
+            m_interestGrid->UpdateIfStale();
+        }
+
+        bool Contains(const AZStd::vector<const ReplicationInterestGrid::Entry*>& entries, const AZStd::unique_ptr<AZ::Entity>& entity)
+        {
+            for (const ReplicationInterestGrid::Entry* entry : entries)
+            {
+                if (entry->m_entityHandle.GetEntity() == entity.get())
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        AZStd::vector<const ReplicationInterestGrid::Entry*> Gather(const AZ::Vector3& center, float radius)
+        {
+            AZStd::vector<const ReplicationInterestGrid::Entry*> entries;
+            m_interestGrid->Gather(AZ::Sphere(center, radius), entries);
+            return entries;
+        }
+
+        ReplicationInterestGrid* m_interestGrid = nullptr;
+        AZStd::unique_ptr<AZ::Entity> m_nearEntity;
+        AZStd::unique_ptr<AZ::Entity> m_farEntity;
+        HostFrameId m_frameId = HostFrameId{ 0 };
+    };
+
+    TEST_F(ReplicationInterestGridTests, GatherReturnsOnlyEntitiesWithinTheSphere)
+    {
+        AdvanceFrame();
+        EXPECT_EQ(m_interestGrid->GetEntryCount(), 2);
+
+        const auto entries = Gather(AZ::Vector3::CreateZero(), 10.0f);
+        EXPECT_EQ(entries.size(), 1);
+        EXPECT_TRUE(Contains(entries, m_nearEntity));
+        EXPECT_FALSE(Contains(entries, m_farEntity));
+    }
+
+    TEST_F(ReplicationInterestGridTests, UpdateOnlyTouchesMovedEntities)
+    {
+        AdvanceFrame();
+
+        // Nothing moved, so nothing needs updating
+        AdvanceFrame();
+        EXPECT_EQ(m_interestGrid->GetLastUpdatedEntryCount(), 0);
+
+        m_farEntity->GetTransform()->SetWorldTranslation(AZ::Vector3(2.0f, 0.0f, 0.0f));
+        AdvanceFrame();
+        EXPECT_EQ(m_interestGrid->GetLastUpdatedEntryCount(), 1);
+
+        auto entries = Gather(AZ::Vector3::CreateZero(), 10.0f);
+        EXPECT_EQ(entries.size(), 2);
+        EXPECT_TRUE(Contains(entries, m_farEntity));
+
+        entries = Gather(AZ::Vector3(1000.0f, 0.0f, 0.0f), 10.0f);
+        EXPECT_TRUE(entries.empty());
+    }
+
+    TEST_F(ReplicationInterestGridTests, UpdateIsSkippedWithinTheSameFrame)
+    {
+        AdvanceFrame();
+
+        // The grid was already updated for this frame, so the move is picked up on the next frame only
+        m_farEntity->GetTransform()->SetWorldTranslation(AZ::Vector3(2.0f, 0.0f, 0.0f));
+        m_interestGrid->UpdateIfStale();
+        EXPECT_FALSE(Contains(Gather(AZ::Vector3::CreateZero(), 10.0f), m_farEntity));
+
+        AdvanceFrame();
+        EXPECT_TRUE(Contains(Gather(AZ::Vector3::CreateZero(), 10.0f), m_farEntity));
+    }
+
+    TEST_F(ReplicationInterestGridTests, RemovedEntitiesAreDropped)
+    {
+        AdvanceFrame();
+        EXPECT_EQ(m_interestGrid->GetEntryCount(), 2);
+
+        m_networkEntityManager->GetNetworkEntityTracker()->erase(NetEntityId{ 1 });
+        AdvanceFrame();
+        EXPECT_EQ(m_interestGrid->GetEntryCount(), 1);
+        EXPECT_TRUE(Gather(AZ::Vector3::CreateZero(), 10.0f).empty());
+    }
+
+    TEST_F(ReplicationInterestGridTests, AddedEntitiesArePickedUp)
+    {
+        AdvanceFrame();
+
+        auto addedEntity = CreateEntity(3, "Added", NetEntityId{ 3 }, AZ::Vector3(-1.0f, 0.0f, 0.0f));
+        AdvanceFrame();
+        EXPECT_EQ(m_interestGrid->GetEntryCount(), 3);
+        EXPECT_TRUE(Contains(Gather(AZ::Vector3::CreateZero(), 10.0f), addedEntity));
+
+        StopAndDeactivateEntity(addedEntity);
+    }
+
+    TEST_F(ReplicationInterestGridTests, PriorityDecreasesWithDistance)
+    {
+        const float nearPriority = ServerToClientReplicationWindow::CalculateEntityPriority(4.0f, 1.0f);
+        const float farPriority = ServerToClientReplicationWindow::CalculateEntityPriority(400.0f, 1.0f);
+        EXPECT_GT(nearPriority, farPriority);
+
+        // Entities within a unit of the player all get the highest priority
+        EXPECT_FLOAT_EQ(ServerToClientReplicationWindow::CalculateEntityPriority(0.0f, 1.0f), 1.0f);
+        EXPECT_FLOAT_EQ(ServerToClientReplicationWindow::CalculateEntityPriority(0.5f, 1.0f), 1.0f);
+    }
+
+    TEST_F(ReplicationInterestGridTests, ZeroPriorityScaleIsClamped)
+    {
+        const float priority = ServerToClientReplicationWindow::CalculateEntityPriority(4.0f, 0.0f);
+        EXPECT_GT(priority, 0.0f);
+        EXPECT_FLOAT_EQ(priority, IReplicationPriorityManager::MinPriorityScale / 4.0f);
+
+        // Negative scales are clamped as well
+        EXPECT_FLOAT_EQ(ServerToClientReplicationWindow::CalculateEntityPriority(4.0f, -1.0f), priority);
+    }
+
+    TEST_F(ReplicationInterestGridTests, LowPriorityReplicatorsAreNotStarved)
+    {
+        EntityReplicator highPriorityReplicator(*m_entityReplicationManager, m_mockConnection.get(), NetEntityRole::Authority, ConstNetworkEntityHandle(m_nearEntity.get(), m_networkEntityManager->GetNetworkEntityTracker()));
+        EntityReplicator lowPriorityReplicator(*m_entityReplicationManager, m_mockConnection.get(), NetEntityRole::Authority, ConstNetworkEntityHandle(m_farEntity.get(), m_networkEntityManager->GetNetworkEntityTracker()));
+
+        highPriorityReplicator.SetPriority(1.0f);
+        lowPriorityReplicator.SetPriority(0.0f);
+        EXPECT_GE(lowPriorityReplicator.GetPriority(), EntityReplicator::MinPriority);
+
+        // The high priority replicator is sent and reset every frame, the low priority one keeps accumulating until it wins
+        lowPriorityReplicator.SetPriority(0.25f);
+        bool lowPrioritySent = false;
+        for (int32_t frame = 0; frame < 8 && !lowPrioritySent; ++frame)
+        {
+            const float highSendPriority = highPriorityReplicator.AccumulateSendPriority();
+            const float lowSendPriority = lowPriorityReplicator.AccumulateSendPriority();
+            if (lowSendPriority > highSendPriority)
+            {
+                lowPrioritySent = true;
+                lowPriorityReplicator.ResetSendPriority();
+                EXPECT_FLOAT_EQ(lowPriorityReplicator.AccumulateSendPriority(), 0.25f);
+            }
+            else
+            {
+                highPriorityReplicator.ResetSendPriority();
+            }
+        }
+        EXPECT_TRUE(lowPrioritySent);
+    }
+}
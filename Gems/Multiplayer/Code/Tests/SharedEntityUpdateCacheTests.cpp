@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CommonNetworkEntitySetup.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
+#include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
+#include <Source/NetworkEntity/EntityReplication/SharedEntityUpdateCache.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace Multiplayer
+{
+    class SharedEntityUpdateCacheTests
+        : public NetworkEntityTests
+    {
+    public:
+        void SetUp() override
+        {
+            NetworkEntityTests::SetUp();
+
+            m_root = AZStd::make_unique<EntityInfo>(1, "root", NetEntityId{ 1 }, EntityInfo::Role::None);
+            m_root->m_entity->CreateComponent<AzFramework::TransformComponent>();
+            m_root->m_entity->CreateComponent<NetBindComponent>();
+            m_root->m_entity->CreateComponent<NetworkTransformComponent>();
+            SetupEntity(m_root->m_entity, m_root->m_netId, NetEntityRole::Authority);
+            m_root->m_entity->Activate();
+
+            m_cache = AZ::Interface<SharedEntityUpdateCache>::Get();
+            EXPECT_NE(m_cache, nullptr);
+            m_cache->Reset();
+        }
+
+        void TearDown() override
+        {
+            m_console->PerformCommand("sv_ShareEntityUpdateSerialization false");
+
+            m_clients.clear();
+            m_root.reset();
+
+            NetworkEntityTests::TearDown();
+        }
+
+        //! A remote client with its own connection, replication manager and replicator for the root entity.
+        struct Client
+        {
+            AZStd::unique_ptr<NiceMock<IMultiplayerConnectionMock>> m_connection;
+            AZStd::unique_ptr<MockConnectionListener> m_connectionListener;
+            AZStd::unique_ptr<EntityReplicationManager> m_replicationManager;
+            AZStd::unique_ptr<EntityReplicator> m_replicator;
+        };
+
+        Client& AddClient()
+        {
+            const uint32_t clientIndex = static_cast<uint32_t>(m_clients.size());
+            const IpAddress address("localhost", static_cast<uint16_t>(2 + clientIndex), ProtocolType::Udp);
+
+            Client& client = *m_clients.emplace_back(AZStd::make_unique<Client>());
+            client.m_connection = AZStd::make_unique<NiceMock<IMultiplayerConnectionMock>>(ConnectionId{ 2 + clientIndex }, address, ConnectionRole::Acceptor);
+            client.m_connectionListener = AZStd::make_unique<MockConnectionListener>();
+            client.m_replicationManager = AZStd::make_unique<EntityReplicationManager>(
+                *client.m_connection, *client.m_connectionListener, EntityReplicationManager::Mode::LocalServerToRemoteClient);
+
+            const NetworkEntityHandle rootHandle(m_root->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
+            client.m_replicator = AZStd::make_unique<EntityReplicator>(*client.m_replicationManager, client.m_connection.get(), NetEntityRole::Client, rootHandle);
+            client.m_replicator->Initialize(rootHandle);
+            return client;
+        }
+
+        static NetworkEntityUpdateMessage GenerateUpdate(Client& client)
+        {
+            EXPECT_TRUE(client.m_replicator->GetPropertyPublisher()->PrepareSerialization());
+            return client.m_replicator->GenerateUpdatePacket();
+        }
+
+        static AZStd::vector<uint8_t> SerializeMessage(NetworkEntityUpdateMessage& message)
+        {
+            AzNetworking::PacketEncodingBuffer buffer;
+            AzNetworking::NetworkInputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
+            EXPECT_TRUE(message.Serialize(serializer));
+            return AZStd::vector<uint8_t>(buffer.GetBuffer(), buffer.GetBuffer() + serializer.GetSize());
+        }
+
+        static SharedEntityUpdateCache::SharedBuffer CreatePayload(const AZStd::vector<uint8_t>& bytes)
+        {
+            auto payload = AZStd::make_shared<AzNetworking::PacketEncodingBuffer>();
+            payload->CopyValues(bytes.data(), bytes.size());
+            return payload;
+        }
+
+        AZStd::unique_ptr<EntityInfo> m_root;
+        AZStd::vector<AZStd::unique_ptr<Client>> m_clients;
+        SharedEntityUpdateCache* m_cache = nullptr;
+    };
+
+    TEST_F(SharedEntityUpdateCacheTests, FindReturnsStoredPayloadForMatchingRecord)
+    {
+        const AZStd::vector<uint8_t> record = { 1, 2, 3 };
+        const SharedEntityUpdateCache::SharedBuffer payload = CreatePayload({ 1, 2, 3, 4, 5, 6 });
+        const SharedEntityUpdateCache::SharedMetrics storedMetrics = AZStd::make_shared<MultiplayerStats::SentEntityUpdateMetrics>();
+        m_cache->Store(NetEntityId{ 1 }, NetEntityRole::Client, static_cast<uint32_t>(record.size()), payload, storedMetrics);
+
+        SharedEntityUpdateCache::SharedMetrics sentMetrics;
+        EXPECT_EQ(m_cache->Find(NetEntityId{ 1 }, NetEntityRole::Client, record.data(), static_cast<uint32_t>(record.size()), sentMetrics), payload);
+        EXPECT_EQ(sentMetrics, storedMetrics);
+
+        // A different entity, role or record must not reuse the payload
+        const AZStd::vector<uint8_t> otherRecord = { 1, 2, 4 };
+        EXPECT_EQ(m_cache->Find(NetEntityId{ 2 }, NetEntityRole::Client, record.data(), static_cast<uint32_t>(record.size()), sentMetrics), nullptr);
+        EXPECT_EQ(m_cache->Find(NetEntityId{ 1 }, NetEntityRole::Autonomous, record.data(), static_cast<uint32_t>(record.size()), sentMetrics), nullptr);
+        EXPECT_EQ(m_cache->Find(NetEntityId{ 1 }, NetEntityRole::Client, otherRecord.data(), static_cast<uint32_t>(otherRecord.size()), sentMetrics), nullptr);
+        EXPECT_EQ(m_cache->Find(NetEntityId{ 1 }, NetEntityRole::Client, record.data(), 2, sentMetrics), nullptr);
+    }
+
+    TEST_F(SharedEntityUpdateCacheTests, CacheIsClearedWhenTheHostFrameChanges)
+    {
+        ON_CALL(*m_mockNetworkTime, GetHostFrameId()).WillByDefault(Return(HostFrameId{ 1 }));
+
+        const AZStd::vector<uint8_t> record = { 1, 2, 3 };
+        const SharedEntityUpdateCache::SharedBuffer payload = CreatePayload({ 1, 2, 3, 4 });
+        m_cache->Store(NetEntityId{ 1 }, NetEntityRole::Client, static_cast<uint32_t>(record.size()), payload, nullptr);
+        SharedEntityUpdateCache::SharedMetrics sentMetrics;
+        EXPECT_EQ(m_cache->Find(NetEntityId{ 1 }, NetEntityRole::Client, record.data(), static_cast<uint32_t>(record.size()), sentMetrics), payload);
+
+        ON_CALL(*m_mockNetworkTime, GetHostFrameId()).WillByDefault(Return(HostFrameId{ 2 }));
+        EXPECT_EQ(m_cache->Find(NetEntityId{ 1 }, NetEntityRole::Client, record.data(), static_cast<uint32_t>(record.size()), sentMetrics), nullptr);
+
+        // Messages that still reference the payload keep it alive
+        EXPECT_EQ(payload->GetSize(), 4);
+    }
+
+    TEST_F(SharedEntityUpdateCacheTests, SharedAndCopiedDataSerializeIdentically)
+    {
+        const SharedEntityUpdateCache::SharedBuffer payload = CreatePayload({ 7, 6, 5, 4, 3, 2, 1 });
+
+        NetworkEntityUpdateMessage sharedMessage(NetEntityRole::Client, NetEntityId{ 1 });
+        sharedMessage.SetSharedData(payload);
+
+        NetworkEntityUpdateMessage copiedMessage(NetEntityRole::Client, NetEntityId{ 1 });
+        copiedMessage.SetData(*payload);
+
+        EXPECT_EQ(sharedMessage.GetData(), payload.get());
+        EXPECT_NE(copiedMessage.GetData(), payload.get());
+        EXPECT_EQ(SerializeMessage(sharedMessage), SerializeMessage(copiedMessage));
+    }
+
+    TEST_F(SharedEntityUpdateCacheTests, WriteAfterSharingDoesNotAffectOtherMessages)
+    {
+        const SharedEntityUpdateCache::SharedBuffer payload = CreatePayload({ 1, 2, 3, 4 });
+
+        NetworkEntityUpdateMessage firstMessage(NetEntityRole::Client, NetEntityId{ 1 });
+        firstMessage.SetSharedData(payload);
+        NetworkEntityUpdateMessage secondMessage(NetEntityRole::Client, NetEntityId{ 1 });
+        secondMessage.SetSharedData(payload);
+        NetworkEntityUpdateMessage copiedMessage(firstMessage);
+        EXPECT_EQ(copiedMessage.GetData(), payload.get());
+
+        const AZStd::vector<uint8_t> expectedBytes = SerializeMessage(secondMessage);
+
+        // Writing to one message gives it a private copy, the shared payload and the other messages are unchanged
+        firstMessage.ModifyData().GetBuffer()[0] = 42;
+        EXPECT_NE(firstMessage.GetData(), payload.get());
+        EXPECT_EQ(firstMessage.GetData()->GetBuffer()[0], 42);
+        EXPECT_EQ(payload->GetBuffer()[0], 1);
+        EXPECT_EQ(secondMessage.GetData(), payload.get());
+        EXPECT_EQ(copiedMessage.GetData(), payload.get());
+        EXPECT_EQ(SerializeMessage(secondMessage), expectedBytes);
+        EXPECT_EQ(SerializeMessage(copiedMessage), expectedBytes);
+        EXPECT_NE(SerializeMessage(firstMessage), expectedBytes);
+    }
+
+    TEST_F(SharedEntityUpdateCacheTests, ConnectionsShareIdenticalUpdates)
+    {
+        Client& unsharedClient = AddClient();
+        Client& firstClient = AddClient();
+        Client& secondClient = AddClient();
+
+        NetworkEntityUpdateMessage unsharedUpdate = GenerateUpdate(unsharedClient);
+
+        m_console->PerformCommand("sv_ShareEntityUpdateSerialization true");
+        NetworkEntityUpdateMessage firstUpdate = GenerateUpdate(firstClient);
+        NetworkEntityUpdateMessage secondUpdate = GenerateUpdate(secondClient);
+
+        // The second connection reuses the payload serialized for the first one, and it matches an unshared serialization
+        ASSERT_NE(firstUpdate.GetData(), nullptr);
+        EXPECT_EQ(firstUpdate.GetData(), secondUpdate.GetData());
+        EXPECT_NE(firstUpdate.GetData(), unsharedUpdate.GetData());
+        EXPECT_EQ(SerializeMessage(firstUpdate), SerializeMessage(unsharedUpdate));
+        EXPECT_EQ(SerializeMessage(secondUpdate), SerializeMessage(unsharedUpdate));
+
+        // A connection that modifies its update does not change what the other connection sends
+        const AZStd::vector<uint8_t> expectedBytes = SerializeMessage(secondUpdate);
+        firstUpdate.ModifyData().Resize(0);
+        EXPECT_EQ(SerializeMessage(secondUpdate), expectedBytes);
+    }
+
+    TEST_F(SharedEntityUpdateCacheTests, ReusedUpdatesRecordTheSameStatsAsSerializedOnes)
+    {
+        Client& firstClient = AddClient();
+        Client& secondClient = AddClient();
+
+        uint32_t propertiesSent = 0;
+        uint32_t bytesSent = 0;
+        AZ::Event<NetComponentId, PropertyIndex, uint32_t>::Handler propertySentHandler(
+            [&propertiesSent, &bytesSent]([[maybe_unused]] NetComponentId netComponentId, [[maybe_unused]] PropertyIndex propertyIndex, uint32_t totalBytes)
+            {
+                ++propertiesSent;
+                bytesSent += totalBytes;
+            });
+        propertySentHandler.Connect(GetMultiplayer()->GetStats().m_events.m_propertySent);
+
+        m_console->PerformCommand("sv_ShareEntityUpdateSerialization true");
+        NetworkEntityUpdateMessage firstUpdate = GenerateUpdate(firstClient);
+        const uint32_t serializedPropertiesSent = propertiesSent;
+        const uint32_t serializedBytesSent = bytesSent;
+        EXPECT_GT(serializedPropertiesSent, 0u);
+
+        // The second connection reuses the payload without serializing it, but still accounts for the properties it sends
+        NetworkEntityUpdateMessage secondUpdate = GenerateUpdate(secondClient);
+        EXPECT_EQ(firstUpdate.GetData(), secondUpdate.GetData());
+        EXPECT_EQ(propertiesSent, 2 * serializedPropertiesSent);
+        EXPECT_EQ(bytesSent, 2 * serializedBytesSent);
+    }
+}
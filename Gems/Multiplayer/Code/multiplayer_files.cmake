@@ -61,6 +61,7 @@ set(FILES
     Include/Multiplayer/NetworkTime/RewindableFixedVector.inl
     Include/Multiplayer/NetworkTime/RewindableObject.h
     Include/Multiplayer/NetworkTime/RewindableObject.inl
+    Include/Multiplayer/ReplicationWindows/IReplicationPriorityManager.h
     Include/Multiplayer/ReplicationWindows/IReplicationWindow.h
     Include/Multiplayer/Session/IMatchmakingRequests.h
     Include/Multiplayer/Session/ISessionHandlingRequests.h
@@ -114,11 +115,15 @@ set(FILES
     Source/MultiplayerStatSystemComponent.h
     Source/NetworkEntity/EntityReplication/EntityReplicationManager.cpp
     Source/NetworkEntity/EntityReplication/EntityReplicator.cpp
+    Source/NetworkEntity/EntityReplication/EntitySnapshot.cpp
+    Source/NetworkEntity/EntityReplication/EntitySnapshot.h
     Source/NetworkEntity/EntityReplication/PropertyPublisher.cpp
     Source/NetworkEntity/EntityReplication/PropertyPublisher.h
     Source/NetworkEntity/EntityReplication/PropertySubscriber.cpp
     Source/NetworkEntity/EntityReplication/PropertySubscriber.h
     Source/NetworkEntity/EntityReplication/ReplicationRecord.cpp
+    Source/NetworkEntity/EntityReplication/SharedEntityUpdateCache.cpp
+    Source/NetworkEntity/EntityReplication/SharedEntityUpdateCache.h
     Source/NetworkEntity/NetworkEntityAuthorityTracker.cpp
     Source/NetworkEntity/NetworkEntityAuthorityTracker.h
     Source/NetworkEntity/NetworkEntityHandle.cpp
@@ -140,6 +145,8 @@ set(FILES
     Source/NetworkTime/NetworkTime.h
     Source/ReplicationWindows/NullReplicationWindow.cpp
     Source/ReplicationWindows/NullReplicationWindow.h
+    Source/ReplicationWindows/ReplicationInterestGrid.cpp
+    Source/ReplicationWindows/ReplicationInterestGrid.h
     Source/ReplicationWindows/ServerToClientReplicationWindow.cpp
     Source/ReplicationWindows/ServerToClientReplicationWindow.h
     Source/Session/MatchmakingRequests.cpp
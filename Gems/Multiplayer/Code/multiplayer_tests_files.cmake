@@ -18,6 +18,7 @@ set(FILES
     Tests/CommonHierarchySetup.h
     Tests/CommonNetworkEntitySetup.h
     Tests/CommonBenchmarkSetup.h
+    Tests/EntitySnapshotTests.cpp
     Tests/IMultiplayerConnectionMock.h
     Tests/IMultiplayerSpawnerMock.h
     Tests/Main.cpp
@@ -29,9 +30,12 @@ set(FILES
     Tests/NetworkInputTests.cpp
     Tests/NetworkRigidBodyTests.cpp
     Tests/NetworkTransformTests.cpp
+    Tests/ParallelEntityReplicationTests.cpp
     Tests/RewindableContainerTests.cpp
+    Tests/ReplicationInterestGridTests.cpp
     Tests/RewindableObjectTests.cpp
     Tests/ServerHierarchyTests.cpp
+    Tests/SharedEntityUpdateCacheTests.cpp
     Tests/TestMultiplayerComponent.h
     Tests/TestMultiplayerComponent.cpp
 
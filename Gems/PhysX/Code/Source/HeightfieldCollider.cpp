@@ -33,11 +33,10 @@ namespace PhysX
         "Each update will be the largest number of heightfield rows that stays below this total point count threshold.");
 
     // The HeightfieldUpdateJobContext is an extremely simplified way to manage the background update jobs.
-    // On any heightfield change, the collider code will cancel any update job that's currently running, wait for it
-    // to complete, and then start a new update job.
+    // When the heightfield needs to be recreated, the collider code will cancel any update job that's currently running, wait for it
+    // to complete, and then start a new update job. Data changes that don't resize the heightfield never block: while a job is
+    // running they're accumulated into a queued dirty region, which is started as a new job at the next safe point.
     // Also, on HeightfieldCollider destruction, any running jobs will get canceled and block on completion.
-    // Eventually, this could get migrated to a more complex system that allows for overlapping jobs, or potentially using a queue
-    // of regions to update in a currently-running job.
     void HeightfieldCollider::HeightfieldUpdateJobContext::Cancel()
     {
         m_isCanceled = true;
@@ -78,6 +77,12 @@ namespace PhysX
             });
     }
 
+    bool HeightfieldCollider::HeightfieldUpdateJobContext::IsRefreshInProgress()
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_jobsRunningNotificationMutex);
+        return m_refreshInProgress;
+    }
+
 
     HeightfieldCollider::DirtyHeightfieldRegion::DirtyHeightfieldRegion()
     {
@@ -92,6 +97,11 @@ namespace PhysX
         m_maxColumnVertex = AZStd::numeric_limits<size_t>::lowest();
     }
 
+    bool HeightfieldCollider::DirtyHeightfieldRegion::IsNull() const
+    {
+        return (m_minRowVertex > m_maxRowVertex) || (m_minColumnVertex > m_maxColumnVertex);
+    }
+
     void HeightfieldCollider::DirtyHeightfieldRegion::AddAabb(const AZ::Aabb& dirtyRegion, AZ::EntityId entityId)
     {
         size_t startRowVertex = 0;
@@ -115,6 +125,14 @@ namespace PhysX
         m_maxColumnVertex = AZStd::max(m_maxColumnVertex, startColumnVertex + numColumnVertices);
     }
 
+    void HeightfieldCollider::DirtyHeightfieldRegion::AddRegion(const DirtyHeightfieldRegion& dirtyRegion)
+    {
+        m_minRowVertex = AZStd::min(m_minRowVertex, dirtyRegion.m_minRowVertex);
+        m_minColumnVertex = AZStd::min(m_minColumnVertex, dirtyRegion.m_minColumnVertex);
+        m_maxRowVertex = AZStd::max(m_maxRowVertex, dirtyRegion.m_maxRowVertex);
+        m_maxColumnVertex = AZStd::max(m_maxColumnVertex, dirtyRegion.m_maxColumnVertex);
+    }
+
 
 
     HeightfieldCollider::HeightfieldCollider(
@@ -137,6 +155,19 @@ namespace PhysX
         Physics::HeightfieldProviderNotificationBus::Handler::BusConnect(entityId);
         AzPhysics::SimulatedBodyComponentRequestsBus::Handler::BusConnect(entityId);
 
+        // Registered as a component, so the patches are applied after the physics system's own start handlers and before
+        // any game code that reads the heightfield during the same simulation start.
+        m_sceneSimulationStartHandler = AzPhysics::SceneEvents::OnSceneSimulationStartHandler(
+            [this]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] float fixedDeltaTime)
+            {
+                OnSceneSimulationStart();
+            }, aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Components));
+
+        if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+        {
+            sceneInterface->RegisterSceneSimulationStartHandler(m_attachedSceneHandle, m_sceneSimulationStartHandler);
+        }
+
         // Make sure that we trigger a refresh on creation. Depending on initialization order, there might not be any other
         // refreshes that occur.
         RefreshHeightfield(Physics::HeightfieldProviderNotifications::HeightfieldChangeMask::Settings, AZ::Aabb::CreateNull());
@@ -144,13 +175,16 @@ namespace PhysX
 
     HeightfieldCollider::~HeightfieldCollider()
     {
+        AZ::TickBus::Handler::BusDisconnect();
         AzPhysics::SimulatedBodyComponentRequestsBus::Handler::BusDisconnect();
         Physics::HeightfieldProviderNotificationBus::Handler::BusDisconnect();
         PhysX::ColliderShapeRequestBus::Handler::BusDisconnect();
+        m_sceneSimulationStartHandler.Disconnect();
 
         // Make sure any heightfield collider jobs that are running finish up before we destroy ourselves.
         m_jobContext->Cancel();
         m_jobContext->BlockUntilComplete();
+        m_pendingSamplePatches.clear();
 
         ClearHeightfield();
 
@@ -160,6 +194,7 @@ namespace PhysX
     void HeightfieldCollider::BlockOnPendingJobs()
     {
         m_jobContext->BlockUntilComplete();
+        ApplyPendingSamplePatches();
     }
 
     // ColliderShapeRequestBus
@@ -280,22 +315,28 @@ namespace PhysX
         }
     }
 
-    void HeightfieldCollider::UpdatePhysXHeightfieldRows(
-        AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape,
-        size_t startColumn, size_t startRow, size_t numColumns, size_t numRows)
+    void HeightfieldCollider::UpdatePhysXHeightfieldRows(size_t startColumn, size_t startRow, size_t numColumns, size_t numRows)
     {
-        // This method is called by an update job to update a portion of the PhysX heightfield to contain the latest heightfield data.
+        // This method is called by an update job to convert a portion of the shape configuration into PhysX heightfield samples.
+        // The PhysX heightfield itself isn't touched here, since it can be in use by a running simulation step. The converted
+        // samples are queued and patched into the heightfield from the main thread at the next safe point.
 
         if (!m_jobContext->IsCanceled() && (numRows > 0) && (numColumns > 0))
         {
-            // Refresh a subset of the PhysX heightfield.
-            // This assumes that the shape configuration for this region has already been updated.
-            // NOTE: For a given heightfield, only one of these calls should be executed at a time, since the underlying PhysX
-            // heightfield has no thread safety protections and modifies min/max height data global to the heightfield on every refresh.
-            Utils::RefreshHeightfieldShape(scene, &(*shape), *m_shapeConfig, startColumn, startRow, numColumns, numRows);
+            SamplePatch samplePatch;
+            samplePatch.m_startColumn = startColumn;
+            samplePatch.m_startRow = startRow;
+            samplePatch.m_numColumns = numColumns;
+            samplePatch.m_numRows = numRows;
+            samplePatch.m_samples = Utils::ConvertHeightfieldSamples(*m_shapeConfig, startColumn, startRow, numColumns, numRows);
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_pendingSamplePatchesMutex);
+                m_pendingSamplePatches.emplace_back(AZStd::move(samplePatch));
+            }
 
             // Reduce our dirty region by the number of rows that we're processing in this piece of the update job chain.
-            // We've updated both the shape configuration and the PhysX heightfield at this point, so those rows have completed
+            // We've updated the shape configuration and queued the PhysX samples at this point, so those rows have completed
             // their update. Even if we cancel the job at this point, we'll only need to reprocess these rows if data in those rows
             // have changed.
             // This dirty region logic assumes that we're updating all dirty columns for a row on every call. If this assumption
@@ -308,17 +349,86 @@ namespace PhysX
     {
         // This method is called by an update job to signal that the chain of update jobs have completed.
 
-        // If the job hasn't been canceled, notify any listeners that the collider has changed.
+        // If the job hasn't been canceled, listeners are notified that the collider has changed once its samples are applied.
         if (!m_jobContext->IsCanceled())
         {
             m_dirtyRegion.SetNull();
-            Physics::ColliderComponentEventBus::Event(m_entityId, &Physics::ColliderComponentEvents::OnColliderChanged);
+            m_refreshCompletePending = true;
         }
 
         // Notify the job context that the job is completed, so that anything blocking on job completion knows it can proceed.
         m_jobContext->OnRefreshComplete();
     }
 
+    void HeightfieldCollider::ApplyPendingSamplePatches()
+    {
+        // Check for completion before taking the patches. Every patch of a refresh is queued before it's marked as complete,
+        // so the notification below is never sent ahead of the samples it's about.
+        const bool refreshComplete = m_refreshCompletePending.exchange(false);
+
+        AZStd::vector<SamplePatch> samplePatches;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_pendingSamplePatchesMutex);
+            samplePatches.swap(m_pendingSamplePatches);
+        }
+
+        if (!samplePatches.empty())
+        {
+            AZ_PROFILE_SCOPE(Physics, "HeightfieldCollider::ApplyPendingSamplePatches");
+
+            auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+            AzPhysics::Scene* scene = physicsSystem ? physicsSystem->GetScene(m_attachedSceneHandle) : nullptr;
+            AZStd::shared_ptr<Physics::Shape> shape = GetHeightfieldShape();
+            if (scene && shape && m_shapeConfig->GetCachedNativeHeightfield())
+            {
+                for (const SamplePatch& samplePatch : samplePatches)
+                {
+                    Utils::ModifyHeightfieldShapeSamples(
+                        scene, shape.get(), *m_shapeConfig, samplePatch.m_startColumn, samplePatch.m_startRow,
+                        samplePatch.m_numColumns, samplePatch.m_numRows, samplePatch.m_samples);
+                }
+            }
+        }
+
+        if (refreshComplete)
+        {
+            Physics::ColliderComponentEventBus::Event(m_entityId, &Physics::ColliderComponentEvents::OnColliderChanged);
+        }
+    }
+
+    void HeightfieldCollider::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        // Scenes that aren't simulating, like the editor scene during play in editor, never reach a simulation start. The tick is also
+        // outside of the simulation, so the updates are applied here as well, and the handler stays connected until there are none left.
+        // Every patch of a refresh is queued before the refresh completes, so a refresh that wasn't running before the patches were
+        // applied has nothing left to apply.
+        const bool refreshWasInProgress = m_jobContext->IsRefreshInProgress();
+        ApplyPendingUpdates();
+
+        if (!refreshWasInProgress && !m_jobContext->IsRefreshInProgress() && m_queuedDirtyRegion.IsNull())
+        {
+            AZ::TickBus::Handler::BusDisconnect();
+        }
+    }
+
+    void HeightfieldCollider::OnSceneSimulationStart()
+    {
+        ApplyPendingUpdates();
+    }
+
+    void HeightfieldCollider::ApplyPendingUpdates()
+    {
+        ApplyPendingSamplePatches();
+
+        // Start the update jobs for any changes that arrived while the previous refresh was running.
+        if (!m_queuedDirtyRegion.IsNull() && !m_jobContext->IsRefreshInProgress())
+        {
+            m_dirtyRegion.AddRegion(m_queuedDirtyRegion);
+            m_queuedDirtyRegion.SetNull();
+            StartUpdateJobs();
+        }
+    }
+
 
     void HeightfieldCollider::RefreshHeightfield(
         const Physics::HeightfieldProviderNotifications::HeightfieldChangeMask changeMask,
@@ -394,13 +504,32 @@ namespace PhysX
             shouldRecreateHeightfield = shouldRecreateHeightfield || (baseConfiguration.GetMaxHeightBounds() != m_shapeConfig->GetMaxHeightBounds());
         }
 
+        // If the heightfield keeps its size, there's no need to stop a running update. Queue the region instead, it gets picked up
+        // at the next safe point after the running update completes.
+        if (!shouldRecreateHeightfield && m_jobContext->IsRefreshInProgress())
+        {
+            m_queuedDirtyRegion.AddAabb(requestRegion, m_entityId);
+            AZ::TickBus::Handler::BusConnect();
+            return;
+        }
+
         // If the update job is running, stop it and wait for it to complete.
         m_jobContext->Cancel();
         m_jobContext->BlockUntilComplete();
 
+        // Fold any queued changes into this refresh.
+        m_dirtyRegion.AddRegion(m_queuedDirtyRegion);
+        m_queuedDirtyRegion.SetNull();
+
         // If our heightfield has changed size, recreate the configuration and initialize it.
         if (shouldRecreateHeightfield)
         {
+            // Samples that haven't been applied yet were converted for the heightfield that's about to be destroyed.
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_pendingSamplePatchesMutex);
+                m_pendingSamplePatches.clear();
+            }
+
             // Destroy the existing heightfield. This will completely remove it from the world.
             ClearHeightfield();
 
@@ -437,11 +566,23 @@ namespace PhysX
         AZ_Assert(m_dirtyRegion.m_maxColumnVertex >= m_dirtyRegion.m_minColumnVertex,
             "Invalid dirty region (min=%zu max=%zu)", m_dirtyRegion.m_maxColumnVertex, m_dirtyRegion.m_minColumnVertex);
 
+        StartUpdateJobs();
+    }
+
+    void HeightfieldCollider::StartUpdateJobs()
+    {
         // If our heightfield size has just shrunk and we had a pre-existing dirty region, the max vertex values could be higher than
         // our current size, so clamp them to the current size.
         m_dirtyRegion.m_maxRowVertex = AZStd::min(m_dirtyRegion.m_maxRowVertex, m_shapeConfig->GetNumRowVertices());
         m_dirtyRegion.m_maxColumnVertex = AZStd::min(m_dirtyRegion.m_maxColumnVertex, m_shapeConfig->GetNumColumnVertices());
 
+        // A region queued before the heightfield shrunk can lie entirely outside of it.
+        if (m_dirtyRegion.IsNull())
+        {
+            m_dirtyRegion.SetNull();
+            return;
+        }
+
         size_t startColumn = m_dirtyRegion.m_minColumnVertex;
         size_t numColumns = m_dirtyRegion.m_maxColumnVertex - m_dirtyRegion.m_minColumnVertex;
         size_t numRows = m_dirtyRegion.m_maxRowVertex - m_dirtyRegion.m_minRowVertex;
@@ -452,10 +593,8 @@ namespace PhysX
             return;
         }
 
-        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
-        auto* scene = physicsSystem->GetScene(m_attachedSceneHandle);
-
-        auto shape = GetHeightfieldShape();
+        // The jobs queue their samples for the main thread, which applies them on the next tick or simulation start.
+        AZ::TickBus::Handler::BusConnect();
 
         // Get the number of rows to update in each job. We subdivide the region into multiple jobs when processing
         // so that cancellation requests can be detected and processed more quickly. If we just processed a single full dirty region,
@@ -473,7 +612,8 @@ namespace PhysX
         // 
         // For each block of rows being processed we do the following:
         // UpdateShapeConfigJob -> (UpdateHeightsAndMaterialsAsync) -> UpdateShapeConfigCompleteJob -> UpdatePhysXHeightfieldJob
-        // i.e. we update the shape configuration, then we update the PhysX Heightfield
+        // i.e. we update the shape configuration, then we convert it to PhysX samples that get patched into the PhysX heightfield
+        // at the next safe point on the main thread
         // The final UpdatePhysXHeightfieldJob triggers the RefreshCompleteJob to signify that all the work is completed.
         // 
         // For simplicity in managing the job chain, the entire chain of jobs is still triggered on cancellation, but all
@@ -507,7 +647,7 @@ namespace PhysX
 
             auto* updatePhysXHeightfieldJob = AZ::CreateJobFunction(
                 AZStd::bind(&HeightfieldCollider::UpdatePhysXHeightfieldRows,
-                    this, scene, shape, startColumn, startRow, numColumns, subregionRows),
+                    this, startColumn, startRow, numColumns, subregionRows),
                     autoDelete, m_jobContext.get());
 
             // Set up the dependencies:
@@ -8,16 +8,21 @@
 
 #pragma once
 
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
 
 #include <AzFramework/Physics/Components/SimulatedBodyComponentBus.h>
 #include <AzFramework/Physics/HeightfieldProviderBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/Shape.h>
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
 
 #include <PhysX/ColliderShapeBus.h>
 
+#include <PxPhysicsAPI.h>
+
 namespace PhysX
 {
     //! PhysX Heightfield Collider base class.
@@ -27,6 +32,7 @@ namespace PhysX
         : protected AzPhysics::SimulatedBodyComponentRequestsBus::Handler
         , protected Physics::HeightfieldProviderNotificationBus::Handler
         , protected PhysX::ColliderShapeRequestBus::Handler
+        , protected AZ::TickBus::Handler
     {
     public:
 
@@ -73,6 +79,7 @@ namespace PhysX
         //! @return Pointer to the simulated body.
         const AzPhysics::SimulatedBody* GetSimulatedBody() const;
 
+        //! Block until any running update jobs have completed and apply the heightfield changes they produced.
         void BlockOnPendingJobs();
 
         // AzPhysics::SimulatedBodyComponentRequestsBus::Handler overrides ...
@@ -89,6 +96,9 @@ namespace PhysX
         void OnHeightfieldDataChanged(
             const AZ::Aabb& dirtyRegion, Physics::HeightfieldProviderNotifications::HeightfieldChangeMask changeMask) override;
 
+        // AZ::TickBus::Handler overrides ...
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
         // ColliderShapeRequestBus
         AZ::Aabb GetColliderShapeAabb() override;
         bool IsTrigger() override
@@ -108,16 +118,28 @@ namespace PhysX
         void UpdateShapeConfigRows(
             AZ::Job* updateCompleteJob, size_t startColumn, size_t startRow, size_t numColumns, size_t numRows);
 
-        //! Updates a subset of rows in the PhysX heightfield based on the data in the heightfield shape configuration.
+        //! Converts a subset of rows in the heightfield shape configuration to PhysX samples and queues them to be patched into
+        //! the PhysX heightfield at the next safe point.
         //! Note that while this takes in column ranges, the expectation is that it is processing all the dirty columns for each
         //! row being updated. If this assumption changes, the dirty region tracking logic will also need to change.
-        void UpdatePhysXHeightfieldRows(
-            AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape,
-            size_t startColumn, size_t startRow, size_t numColumns, size_t numRows);
+        void UpdatePhysXHeightfieldRows(size_t startColumn, size_t startRow, size_t numColumns, size_t numRows);
 
         //! Called once all of the asynchronous update jobs have completed.
         void RefreshComplete();
 
+        //! Starts the chain of update jobs for the current dirty region.
+        void StartUpdateJobs();
+
+        //! Patches the queued samples into the PhysX heightfield. Must be called on the main thread while the scene isn't simulating.
+        void ApplyPendingSamplePatches();
+
+        //! Applies finished updates and starts the update jobs for any queued changes. Must be called on the main thread while the
+        //! scene isn't simulating.
+        void ApplyPendingUpdates();
+
+        //! Safe point before each simulation step.
+        void OnSceneSimulationStart();
+
         //! Helper class to manage the spawned physics update jobs.
         class HeightfieldUpdateJobContext : public AZ::JobContext
         {
@@ -142,6 +164,9 @@ namespace PhysX
             //! Block until all jobs have been completed.
             void BlockUntilComplete();
 
+            //! Check to see if a refresh is currently running.
+            bool IsRefreshInProgress();
+
         private:
             //! Track whether or not a refresh is currently happening.
             bool m_refreshInProgress = false;
@@ -182,7 +207,9 @@ namespace PhysX
         {
             DirtyHeightfieldRegion();
             void SetNull();
+            bool IsNull() const;
             void AddAabb(const AZ::Aabb& dirtyRegion, AZ::EntityId entityId);
+            void AddRegion(const DirtyHeightfieldRegion& dirtyRegion);
 
             size_t m_minRowVertex;      //! the first dirty row vertex
             size_t m_minColumnVertex;   //! the first dirty column vertex
@@ -191,6 +218,28 @@ namespace PhysX
         };
 
         DirtyHeightfieldRegion m_dirtyRegion;
+
+        //! Changes reported while a refresh is running. They're picked up at the next tick or simulation start once that refresh completes,
+        //! instead of canceling and blocking on the running jobs. Only accessed on the main thread.
+        DirtyHeightfieldRegion m_queuedDirtyRegion;
+
+        //! PhysX samples converted by the update jobs, waiting to be patched into the PhysX heightfield.
+        struct SamplePatch
+        {
+            size_t m_startColumn = 0;
+            size_t m_startRow = 0;
+            size_t m_numColumns = 0;
+            size_t m_numRows = 0;
+            AZStd::vector<physx::PxHeightFieldSample> m_samples;
+        };
+
+        AZStd::mutex m_pendingSamplePatchesMutex;
+        AZStd::vector<SamplePatch> m_pendingSamplePatches;
+
+        //! Set by the update jobs when a refresh finished, so that the collider change gets notified once its patches are applied.
+        AZStd::atomic_bool m_refreshCompletePending = false;
+
+        AzPhysics::SceneEvents::OnSceneSimulationStartHandler m_sceneSimulationStartHandler;
         
         //! Specifies the way of creating Heightfield Collider.
         DataSource m_dataSourceType = DataSource::GenerateNewHeightfield;
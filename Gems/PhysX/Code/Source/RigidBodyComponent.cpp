@@ -21,6 +21,7 @@
 #include <Source/RigidBody.h>
 #include <Source/RigidBodyComponent.h>
 #include <Source/Shape.h>
+#include <Scene/PhysXScene.h>
 
 namespace PhysX
 {
@@ -188,6 +189,7 @@ namespace PhysX
         AZ::TransformNotificationBus::MultiHandler::BusDisconnect();
         m_sceneFinishSimHandler.Disconnect();
         m_activeBodySyncTransformHandler.Disconnect();
+        m_activeActorsScene = nullptr;
         AZ::TickBus::Handler::BusDisconnect();
     }
 
@@ -227,7 +229,19 @@ namespace PhysX
         m_activeBodySyncTransformHandler = AzPhysics::SimulatedBodyEvents::OnSyncTransform::Handler(
             [this](float fixedDeltatime)
             {
-                PostPhysicsTick(fixedDeltatime);
+                // The batched transform sync has already gathered the pose, avoid reading it back from the body
+                const PhysXScene::ActiveBodyPose* pose = m_activeActorsScene ? m_activeActorsScene->GetSyncingBodyPose() : nullptr;
+                if (pose && pose->m_bodyHandle == m_rigidBodyHandle)
+                {
+                    if (IsPhysicsEnabled() && !(IsKinematic() && !m_isLastMovementFromKinematicSource))
+                    {
+                        ApplyPhysicsPose(pose->m_position, pose->m_orientation, fixedDeltatime);
+                    }
+                }
+                else
+                {
+                    PostPhysicsTick(fixedDeltatime);
+                }
             });
     }
 
@@ -256,16 +270,21 @@ namespace PhysX
             return;
         }
         
-        AZ::Transform transform = rigidBody->GetTransform();
+        const AZ::Transform transform = rigidBody->GetTransform();
+        ApplyPhysicsPose(transform.GetTranslation(), transform.GetRotation(), fixedDeltaTime);
+    }
+
+    void RigidBodyComponent::ApplyPhysicsPose(const AZ::Vector3& position, const AZ::Quaternion& orientation, float fixedDeltaTime)
+    {
         if (m_configuration.m_interpolateMotion)
         {
-            m_interpolator->SetTarget(transform.GetTranslation(), rigidBody->GetOrientation(), fixedDeltaTime);
+            m_interpolator->SetTarget(position, orientation, fixedDeltaTime);
         }
         else if (AZ::TransformInterface* entityTransform = GetEntity()->GetTransform())
         {
             AZ::Transform newWorldTransform = entityTransform->GetWorldTM();
-            newWorldTransform.SetRotation(rigidBody->GetOrientation());
-            newWorldTransform.SetTranslation(rigidBody->GetPosition());
+            newWorldTransform.SetRotation(orientation);
+            newWorldTransform.SetTranslation(position);
             entityTransform->SetWorldTM(newWorldTransform);
         }
         m_isLastMovementFromKinematicSource = false;
@@ -320,6 +339,7 @@ namespace PhysX
                 AzPhysics::SimulatedBody* body =
                     m_cachedSceneInterface->GetSimulatedBodyFromHandle(m_attachedSceneHandle, m_rigidBodyHandle);
                 body->RegisterOnSyncTransformHandler(m_activeBodySyncTransformHandler);
+                m_activeActorsScene = azrtti_cast<const PhysXScene*>(scene);
             }
             else
             {
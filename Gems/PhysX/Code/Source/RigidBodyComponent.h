@@ -26,6 +26,7 @@ namespace AzPhysics
 
 namespace PhysX
 {
+    class PhysXScene;
     class TransformForwardTimeInterpolator;
 
     /// Component used to register an entity as a dynamic rigid body in the PhysX simulation.
@@ -150,6 +151,7 @@ namespace PhysX
         void ApplyPhysxSpecificConfiguration();
         void InitPhysicsTickHandler();
         void PostPhysicsTick(float fixedDeltaTime);
+        void ApplyPhysicsPose(const AZ::Vector3& position, const AZ::Quaternion& orientation, float fixedDeltaTime);
 
         const AzPhysics::RigidBody* GetRigidBodyConst() const;
 
@@ -160,6 +162,7 @@ namespace PhysX
             m_physxSpecificConfiguration; //!< Properties specific to PhysX which might not have exact equivalents in other physics engines.
         AzPhysics::SimulatedBodyHandle m_rigidBodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
         AzPhysics::SceneHandle m_attachedSceneHandle = AzPhysics::InvalidSceneHandle;
+        const PhysXScene* m_activeActorsScene = nullptr; ///< Scene syncing this body through active actors, provides the gathered pose during the sync.
 
         bool m_staticTransformAtActivation = false; ///< Whether the transform was static when the component last activated.
         bool m_isLastMovementFromKinematicSource = false; ///< True when the source of the movement comes from SetKinematicTarget as opposed to coming from a Transform change
@@ -29,6 +29,7 @@
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/Physics/Character.h>
@@ -46,6 +47,12 @@ namespace PhysX
     AZ_CVAR(size_t, physx_parallelTransformSyncBatchSize, 250, nullptr, AZ::ConsoleFunctorFlags::Null,
         "How many rigid bodies should be processed per task");
 
+    AZ_CVAR(bool, physx_parallelSceneQueries, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Execute batched and async scene queries in parallel on the task graph. "
+        "Queries with a filter callback always run on the calling thread.");
+    AZ_CVAR(size_t, physx_parallelSceneQueryBatchSize, 64, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "How many scene queries should be processed per task");
+
     AZ_CLASS_ALLOCATOR_IMPL(PhysXScene, AZ::SystemAllocator, 0);
 
     AZ_CVAR(bool, physx_profileSimulationDatapoints, true, nullptr, AZ::ConsoleFunctorFlags::Null,
@@ -56,6 +63,8 @@ namespace PhysX
     /*static*/ thread_local AZStd::vector<physx::PxRaycastHit> PhysXScene::s_rayCastBuffer;
     /*static*/ thread_local AZStd::vector<physx::PxSweepHit> PhysXScene::s_sweepBuffer;
     /*static*/ thread_local AZStd::vector<physx::PxOverlapHit> PhysXScene::s_overlapBuffer;
+    /*static*/ thread_local const PhysXScene* PhysXScene::s_syncingScene = nullptr;
+    /*static*/ thread_local const PhysXScene::ActiveBodyPose* PhysXScene::s_syncingBodyPose = nullptr;
 
     namespace Internal
     {
@@ -262,6 +271,65 @@ namespace PhysX
             return newBody;
         }
 
+        //! Query types in the order batched queries are grouped in.
+        enum class SceneQueryKind : AZ::u8
+        {
+            RayCast,
+            ShapeCast,
+            Overlap,
+            Unknown
+        };
+
+        SceneQueryKind GetSceneQueryKind(const AzPhysics::SceneQueryRequest* request)
+        {
+            if (azrtti_istypeof<AzPhysics::RayCastRequest>(request))
+            {
+                return SceneQueryKind::RayCast;
+            }
+            else if (azrtti_istypeof<AzPhysics::ShapeCastRequest>(request))
+            {
+                return SceneQueryKind::ShapeCast;
+            }
+            else if (azrtti_istypeof<AzPhysics::OverlapRequest>(request))
+            {
+                return SceneQueryKind::Overlap;
+            }
+            return SceneQueryKind::Unknown;
+        }
+
+        //! Returns true if the request has a user filter callback.
+        //! Filter callbacks are not required to be thread safe, so these queries are never run on task graph workers.
+        bool HasFilterCallback(const AzPhysics::SceneQueryRequest* request)
+        {
+            switch (GetSceneQueryKind(request))
+            {
+            case SceneQueryKind::RayCast:
+                return static_cast<bool>(azdynamic_cast<const AzPhysics::RayCastRequest*>(request)->m_filterCallback);
+            case SceneQueryKind::ShapeCast:
+                return static_cast<bool>(azdynamic_cast<const AzPhysics::ShapeCastRequest*>(request)->m_filterCallback);
+            case SceneQueryKind::Overlap:
+                return static_cast<bool>(azdynamic_cast<const AzPhysics::OverlapRequest*>(request)->m_filterCallback);
+            default:
+                return false;
+            }
+        }
+
+        //! Copies a request so that it can be executed after the caller's request has gone out of scope.
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> CloneSceneQueryRequest(const AzPhysics::SceneQueryRequest* request)
+        {
+            switch (GetSceneQueryKind(request))
+            {
+            case SceneQueryKind::RayCast:
+                return AZStd::make_shared<AzPhysics::RayCastRequest>(*azdynamic_cast<const AzPhysics::RayCastRequest*>(request));
+            case SceneQueryKind::ShapeCast:
+                return AZStd::make_shared<AzPhysics::ShapeCastRequest>(*azdynamic_cast<const AzPhysics::ShapeCastRequest*>(request));
+            case SceneQueryKind::Overlap:
+                return AZStd::make_shared<AzPhysics::OverlapRequest>(*azdynamic_cast<const AzPhysics::OverlapRequest*>(request));
+            default:
+                return nullptr;
+            }
+        }
+
         //helper to perform a ray cast
         AzPhysics::SceneQueryHits RayCast(const AzPhysics::RayCastRequest* raycastRequest,
             AZStd::vector<physx::PxRaycastHit>& raycastBuffer,
@@ -512,6 +580,9 @@ namespace PhysX
     {
         m_physicsSystemConfigChanged.Disconnect();
 
+        // Deliver any async queries still in flight before the scene goes away
+        CompleteAsyncSceneQueries();
+
         s_overlapBuffer = {};
         s_rayCastBuffer = {};
         s_sweepBuffer = {};
@@ -552,6 +623,7 @@ namespace PhysX
 
         if (!IsEnabled())
         {
+            DispatchAsyncSceneQueries();
             return;
         }
 
@@ -562,14 +634,22 @@ namespace PhysX
 
         m_currentDeltaTime = deltatime;
 
-        PHYSX_SCENE_WRITE_LOCK(m_pxScene);
-        m_pxScene->simulate(deltatime);
+        {
+            PHYSX_SCENE_WRITE_LOCK(m_pxScene);
+            m_pxScene->simulate(deltatime);
+        }
+
+        // Async queries run concurrently with the simulation step, against the scene state from before the step
+        DispatchAsyncSceneQueries();
     }
 
     void PhysXScene::FinishSimulation()
     {
         AZ_PROFILE_SCOPE(Physics, "PhysXScene::FinishSimulation");
 
+        // Async queries read the scene concurrently with the simulation, they must be done before the results are fetched
+        CompleteAsyncSceneQueries();
+
         if (!IsEnabled())
         {
             return;
@@ -996,26 +1076,196 @@ namespace PhysX
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
         AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        const bool hasFilterCallback = AZStd::any_of(requests.begin(), requests.end(),
+            [](const AZStd::shared_ptr<AzPhysics::SceneQueryRequest>& request)
+            {
+                return Internal::HasFilterCallback(request.get());
+            });
+        if (!physx_parallelSceneQueries || hasFilterCallback || requests.size() <= physx_parallelSceneQueryBatchSize)
         {
-            results.emplace_back(QueryScene(request.get()));
+            results.reserve(requests.size());
+            for (auto& request : requests)
+            {
+                results.emplace_back(QueryScene(request.get()));
+            }
+            return results;
         }
+
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::QuerySceneBatch");
+
+        results.resize(requests.size());
+        AZStd::vector<BatchedSceneQuery> queries;
+        queries.reserve(requests.size());
+        for (size_t i = 0; i < requests.size(); ++i)
+        {
+            queries.push_back({ requests[i].get(), &results[i] });
+        }
+
+        AZ::TaskGraph taskGraph("Scene Query Batch");
+        AZ::TaskGraphEvent finishEvent("Scene Query Batch event");
+        AddSceneQueryTasks(taskGraph, queries);
+        taskGraph.Submit(&finishEvent);
+        finishEvent.Wait();
+
         return results;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsync([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequest* request, [[maybe_unused]] AzPhysics::SceneQuery::AsyncCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback)
+    {
+        if (request == nullptr || !callback)
+        {
+            return false;
+        }
+
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> requestCopy = Internal::CloneSceneQueryRequest(request);
+        if (requestCopy == nullptr)
+        {
+            AZ_Warning("Physx", false, "Unknown Scene Query request type.");
+            return false;
+        }
+
+        AsyncSceneQuery asyncQuery;
+        asyncQuery.m_requestId = requestId;
+        asyncQuery.m_requests.emplace_back(AZStd::move(requestCopy));
+        asyncQuery.m_callback = AZStd::move(callback);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_asyncSceneQueryMutex);
+        m_queuedAsyncSceneQueries.emplace_back(AZStd::move(asyncQuery));
+        return true;
+    }
+
+    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    {
+        if (!callback)
+        {
+            return false;
+        }
+
+        // The requests are shared with the caller and must not be modified until the callback is invoked
+        AsyncSceneQuery asyncQuery;
+        asyncQuery.m_requestId = requestId;
+        asyncQuery.m_requests = requests;
+        asyncQuery.m_batchCallback = AZStd::move(callback);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_asyncSceneQueryMutex);
+        m_queuedAsyncSceneQueries.emplace_back(AZStd::move(asyncQuery));
+        return true;
+    }
+
+    void PhysXScene::AddSceneQueryTasks(AZ::TaskGraph& taskGraph, AZStd::vector<BatchedSceneQuery>& queries)
+    {
+        AZStd::stable_sort(queries.begin(), queries.end(),
+            [](const BatchedSceneQuery& lhs, const BatchedSceneQuery& rhs)
+            {
+                return Internal::GetSceneQueryKind(lhs.m_request) < Internal::GetSceneQueryKind(rhs.m_request);
+            });
+
+        const size_t batchSize = AZStd::max<size_t>(physx_parallelSceneQueryBatchSize, 1);
+        const size_t fullSize = queries.size();
+        for (size_t i = 0; i < fullSize; i += batchSize)
+        {
+            AZ::TaskDescriptor taskDescriptor{ "SceneQueryTask", "Physics" };
+            taskGraph.AddTask(
+                taskDescriptor,
+                [start = i, end = AZStd::min(i + batchSize, fullSize), &queries, this]()
+                {
+                    AZ_PROFILE_SCOPE(Physics, "Scene Query Task");
+
+                    // Keep the scene locked for read for the whole task rather than relocking for every query
+                    PHYSX_SCENE_READ_LOCK(m_pxScene);
+
+                    for (size_t queryIndex = start; queryIndex < end; ++queryIndex)
+                    {
+                        *queries[queryIndex].m_result = QueryScene(queries[queryIndex].m_request);
+                    }
+                });
+        }
+    }
+
+    void PhysXScene::DispatchAsyncSceneQueries()
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (m_asyncSceneQueryEvent != nullptr)
+        {
+            // The previous dispatch was not completed by FinishSimulation, deliver it before starting the next one
+            CompleteAsyncSceneQueries();
+        }
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_asyncSceneQueryMutex);
+            if (m_queuedAsyncSceneQueries.empty())
+            {
+                return;
+            }
+            m_dispatchedAsyncSceneQueries.swap(m_queuedAsyncSceneQueries);
+        }
+
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::DispatchAsyncSceneQueries");
+
+        m_dispatchedBatchedQueries.clear();
+        for (AsyncSceneQuery& asyncQuery : m_dispatchedAsyncSceneQueries)
+        {
+            asyncQuery.m_results.resize(asyncQuery.m_requests.size());
+            for (size_t i = 0; i < asyncQuery.m_requests.size(); ++i)
+            {
+                const AzPhysics::SceneQueryRequest* request = asyncQuery.m_requests[i].get();
+                if (physx_parallelSceneQueries && !Internal::HasFilterCallback(request))
+                {
+                    m_dispatchedBatchedQueries.push_back({ request, &asyncQuery.m_results[i] });
+                }
+                else
+                {
+                    // Run the query immediately on the simulating thread, the callback is still delivered in FinishSimulation
+                    asyncQuery.m_results[i] = QueryScene(request);
+                }
+            }
+        }
+
+        if (m_dispatchedBatchedQueries.empty())
+        {
+            return;
+        }
+
+        m_asyncSceneQueryTaskGraph = AZStd::make_unique<AZ::TaskGraph>("Async Scene Queries");
+        m_asyncSceneQueryEvent = AZStd::make_unique<AZ::TaskGraphEvent>("Async Scene Queries event");
+        AddSceneQueryTasks(*m_asyncSceneQueryTaskGraph, m_dispatchedBatchedQueries);
+        m_asyncSceneQueryTaskGraph->Submit(m_asyncSceneQueryEvent.get());
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequests& requests, [[maybe_unused]] AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    void PhysXScene::CompleteAsyncSceneQueries()
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (m_asyncSceneQueryEvent != nullptr)
+        {
+            AZ_PROFILE_SCOPE(Physics, "PhysXScene::WaitAsyncSceneQueries");
+            m_asyncSceneQueryEvent->Wait();
+            m_asyncSceneQueryEvent.reset();
+            m_asyncSceneQueryTaskGraph.reset();
+        }
+
+        if (m_dispatchedAsyncSceneQueries.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::CompleteAsyncSceneQueries");
+
+        // Move the queries out first, callbacks may queue new async queries
+        AZStd::vector<AsyncSceneQuery> completedQueries;
+        completedQueries.swap(m_dispatchedAsyncSceneQueries);
+        m_dispatchedBatchedQueries.clear();
+
+        for (AsyncSceneQuery& asyncQuery : completedQueries)
+        {
+            if (asyncQuery.m_callback)
+            {
+                asyncQuery.m_callback(asyncQuery.m_requestId, AZStd::move(asyncQuery.m_results.front()));
+            }
+            else
+            {
+                asyncQuery.m_batchCallback(asyncQuery.m_requestId, AZStd::move(asyncQuery.m_results));
+            }
+        }
     }
 
     void PhysXScene::SuppressCollisionEvents(
@@ -1309,29 +1559,76 @@ namespace PhysX
         }
     }
 
+    void PhysXScene::RegisterActiveBodyPosesSyncedHandler(OnActiveBodyPosesSynced::Handler& handler)
+    {
+        handler.Connect(m_activeBodyPosesSyncedEvent);
+    }
+
     void PhysXScene::FlushTransformSync()
     {
         AZ_PROFILE_SCOPE(Physics, "PhysX::FlushTransformSync");
 
-        auto transformSync = [this](AzPhysics::SimulatedBodyIndex bodyIndex)
+        SyncActiveBodyPoses();
+
+        // Drop the slots of bodies that were removed since they became active
+        m_activeBodyPoses.erase(
+            AZStd::remove_if(m_activeBodyPoses.begin(), m_activeBodyPoses.end(),
+                [](const ActiveBodyPose& pose) { return pose.m_bodyHandle == AzPhysics::InvalidSimulatedBodyHandle; }),
+            m_activeBodyPoses.end());
+
+        if (!m_activeBodyPoses.empty())
+        {
+            AZ_PROFILE_SCOPE(Physics, "OnActiveBodyPosesSynced::Signaled");
+            m_activeBodyPosesSyncedEvent.Signal(m_sceneHandle, m_activeBodyPoses, m_accumulatedDeltaTime);
+        }
+
+        m_activeBodyPoses.clear();
+        m_queuedActiveBodyIndices.Clear();
+        m_accumulatedDeltaTime = 0.0f;
+    }
+
+    void PhysXScene::SyncActiveBodyPoses()
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysX::SyncActiveBodyPoses");
+
+        m_activeBodyPoses.clear();
+        m_activeBodyPoses.resize(m_queuedActiveBodyIndices.Size());
+
+        // Each body's pose is gathered into its own slot right before its sync handlers run, so a single pass
+        // serves both the handlers and the aggregated event, and the batches can run in parallel.
+        auto syncBody = [this](size_t poseIndex, AzPhysics::SimulatedBodyIndex bodyIndex)
         {
             if (bodyIndex < m_simulatedBodies.size() && m_simulatedBodies[bodyIndex].second)
             {
-                m_simulatedBodies[bodyIndex].second->SyncTransform(m_accumulatedDeltaTime);
+                AzPhysics::SimulatedBody* simulatedBody = m_simulatedBodies[bodyIndex].second;
+                const AZ::Transform transform = simulatedBody->GetTransform();
+
+                ActiveBodyPose& pose = m_activeBodyPoses[poseIndex];
+                pose.m_bodyHandle = simulatedBody->m_bodyHandle;
+                pose.m_position = transform.GetTranslation();
+                pose.m_orientation = transform.GetRotation();
+
+                s_syncingScene = this;
+                s_syncingBodyPose = &pose;
+                simulatedBody->SyncTransform(m_accumulatedDeltaTime);
+                s_syncingBodyPose = nullptr;
+                s_syncingScene = nullptr;
             }
         };
 
         if (physx_parallelTransformSync)
         {
-            m_queuedActiveBodyIndices.ApplyParallel(transformSync, m_pxScene);
+            m_queuedActiveBodyIndices.ApplyParallel(syncBody, m_pxScene);
         }
         else
         {
-            m_queuedActiveBodyIndices.Apply(transformSync);
+            m_queuedActiveBodyIndices.Apply(syncBody);
         }
+    }
 
-        m_queuedActiveBodyIndices.Clear();
-        m_accumulatedDeltaTime = 0.0f;
+    const PhysXScene::ActiveBodyPose* PhysXScene::GetSyncingBodyPose() const
+    {
+        return (s_syncingScene == this) ? s_syncingBodyPose : nullptr;
     }
 
     void PhysXScene::QueuedActiveBodyIndices::Insert(AzPhysics::SimulatedBodyIndex bodyIndex)
@@ -1353,12 +1650,20 @@ namespace PhysX
         m_packedIndices.clear();
     }
 
-    void PhysXScene::QueuedActiveBodyIndices::Apply(const AZStd::function<void(AzPhysics::SimulatedBodyIndex)>& applyFunction)
+    void PhysXScene::QueuedActiveBodyIndices::Apply(const AZStd::function<void(size_t, AzPhysics::SimulatedBodyIndex)>& applyFunction)
+    {
+        for (size_t packedIndex = 0; packedIndex < m_packedIndices.size(); ++packedIndex)
+        {
+            applyFunction(packedIndex, m_packedIndices[packedIndex]);
+        }
+    }
+
+    size_t PhysXScene::QueuedActiveBodyIndices::Size() const
     {
-        AZStd::for_each(m_packedIndices.begin(), m_packedIndices.end(), applyFunction);
+        return m_packedIndices.size();
     }
 
-    void PhysXScene::QueuedActiveBodyIndices::ApplyParallel(const AZStd::function<void(AzPhysics::SimulatedBodyIndex)>& applyFunction, physx::PxScene* pxScene)
+    void PhysXScene::QueuedActiveBodyIndices::ApplyParallel(const AZStd::function<void(size_t, AzPhysics::SimulatedBodyIndex)>& applyFunction, physx::PxScene* pxScene)
     {
         AZ::TaskGraph taskGraph("Parallel Sync");
         AZ::TaskGraphEvent finishEvent("Parallel sync event");
@@ -1384,7 +1689,7 @@ namespace PhysX
 
                         for (size_t batchIndex = start; batchIndex < end; ++batchIndex)
                         {
-                            applyFunction(m_packedIndices[batchIndex]);
+                            applyFunction(batchIndex, m_packedIndices[batchIndex]);
                         }
                     });
             }
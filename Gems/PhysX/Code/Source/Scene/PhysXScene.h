@@ -13,6 +13,9 @@
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <AzFramework/Physics/Configuration/SceneConfiguration.h>
 
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
 #include <Scene/PhysXSceneSimulationEventCallback.h>
 #include <Scene/PhysXSceneSimulationFilterCallback.h>
 
@@ -25,6 +28,12 @@ namespace physx
     struct PxSweepHit;
 }
 
+namespace AZ
+{
+    class TaskGraph;
+    class TaskGraphEvent;
+}
+
 namespace PhysX
 {
     //! PhysX implementation of the AzPhysics::Scene.
@@ -79,9 +88,28 @@ namespace PhysX
 
         physx::PxControllerManager* GetOrCreateControllerManager();
 
+        //! Pose of an active body, gathered once per simulation pass by the batched transform sync.
+        struct ActiveBodyPose
+        {
+            AzPhysics::SimulatedBodyHandle m_bodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+            AZ::Quaternion m_orientation = AZ::Quaternion::CreateIdentity();
+        };
+        using ActiveBodyPoseList = AZStd::vector<ActiveBodyPose>;
+
+        //! Signaled once per batched transform sync, after every active body has been synced, with the poses of all of them.
+        using OnActiveBodyPosesSynced = AZ::Event<AzPhysics::SceneHandle, const ActiveBodyPoseList&, float>;
+        void RegisterActiveBodyPosesSyncedHandler(OnActiveBodyPosesSynced::Handler& handler);
+
         //! Apply batched transform sync events for the current simulation pass. 
+        //! The pose of each active body is gathered into a contiguous list as the body is synced from it.
+        //! Bodies are synced in parallel on the task graph when physx_parallelTransformSync is enabled.
         //! This will clear the batched data for the next simulation pass.
         void FlushTransformSync();
+
+        //! Returns the pose of the body being synced by FlushTransformSync on the calling thread.
+        //! Only valid from within a SimulatedBody sync transform handler, returns nullptr otherwise.
+        const ActiveBodyPose* GetSyncingBodyPose() const;
         
     private:
 
@@ -93,8 +121,9 @@ namespace PhysX
             void Insert(AzPhysics::SimulatedBodyIndex bodyIndex);
             void IncreaseCapacity(size_t extraSize);
             void Clear();
-            void Apply(const AZStd::function<void(AzPhysics::SimulatedBodyIndex)>& applyFunction);
-            void ApplyParallel(const AZStd::function<void(AzPhysics::SimulatedBodyIndex)>& applyFunction, physx::PxScene* pxScene);
+            void Apply(const AZStd::function<void(size_t, AzPhysics::SimulatedBodyIndex)>& applyFunction);
+            void ApplyParallel(const AZStd::function<void(size_t, AzPhysics::SimulatedBodyIndex)>& applyFunction, physx::PxScene* pxScene);
+            size_t Size() const;
 
         private:
             AZStd::unordered_set<AzPhysics::SimulatedBodyIndex> m_uniqueIndices;
@@ -113,6 +142,36 @@ namespace PhysX
 
         void SyncActiveBodyTransform(const AzPhysics::SimulatedBodyHandleList& activeBodyHandles);
 
+        //! Gathers the pose of each queued active body and runs its sync handlers, in parallel when physx_parallelTransformSync is enabled.
+        void SyncActiveBodyPoses();
+
+        //! A scene query executed as part of a batch, writing its hits to the result slot.
+        struct BatchedSceneQuery
+        {
+            const AzPhysics::SceneQueryRequest* m_request = nullptr;
+            AzPhysics::SceneQueryHits* m_result = nullptr;
+        };
+
+        //! Adds tasks running the queries to the task graph.
+        //! Queries are grouped by type so that each task runs a single kind of query against the read locked scene.
+        void AddSceneQueryTasks(AZ::TaskGraph& taskGraph, AZStd::vector<BatchedSceneQuery>& queries);
+
+        //! Async scene queries queued by QuerySceneAsync and QuerySceneAsyncBatch.
+        struct AsyncSceneQuery
+        {
+            AzPhysics::SceneQuery::AsyncRequestId m_requestId;
+            AzPhysics::SceneQueryRequests m_requests;
+            AzPhysics::SceneQuery::AsyncCallback m_callback; //!< Set for single requests.
+            AzPhysics::SceneQuery::AsyncBatchCallback m_batchCallback; //!< Set for batch requests.
+            AzPhysics::SceneQueryHitsList m_results;
+        };
+
+        //! Starts executing the queued async queries on the task graph when physx_parallelSceneQueries is enabled, they run while the
+        //! scene simulates. Queries with a filter callback, or all queries when the cvar is disabled, run immediately on this thread.
+        void DispatchAsyncSceneQueries();
+        //! Waits for the dispatched async queries and delivers their results to the callbacks.
+        void CompleteAsyncSceneQueries();
+
         bool m_isEnabled = true;
 
         // Batch transform sync data. Here we store the indices of actors that have moved since the last simulation pass.
@@ -120,6 +179,10 @@ namespace PhysX
         // we send the transform sync event once.
         QueuedActiveBodyIndices m_queuedActiveBodyIndices;
 
+        // Poses of the queued active bodies, gathered by FlushTransformSync while syncing them.
+        ActiveBodyPoseList m_activeBodyPoses;
+        OnActiveBodyPosesSynced m_activeBodyPosesSyncedEvent;
+
         // Accumulated delta time over multiple simulation sub-steps.
         // When we run the batched transform sync, the accumulated simulation time is provided
         // to tell how much time was simulated in this full pass.
@@ -144,6 +207,8 @@ namespace PhysX
         static thread_local AZStd::vector<physx::PxRaycastHit> s_rayCastBuffer; //!< thread local structure to hold hits for a single raycast or shapecast.
         static thread_local AZStd::vector<physx::PxSweepHit> s_sweepBuffer; //!< thread local structure to hold hits for a single shapecast.
         static thread_local AZStd::vector<physx::PxOverlapHit> s_overlapBuffer; //!< thread local structure to hold hits for a single overlap query.
+        static thread_local const PhysXScene* s_syncingScene; //!< scene whose FlushTransformSync is syncing a body on this thread.
+        static thread_local const ActiveBodyPose* s_syncingBodyPose; //!< pose of the body being synced on this thread.
         AZ::u64 m_raycastBufferSize = 32; //!< Maximum number of hits that will be returned from a raycast.
         AZ::u64 m_shapecastBufferSize = 32; //!< Maximum number of hits that can be returned from a shapecast.
         AZ::u64 m_overlapBufferSize = 32; //!< Maximum number of overlaps that can be returned from an overlap query.
@@ -154,5 +219,14 @@ namespace PhysX
         physx::PxControllerManager* m_controllerManager = nullptr; //!< The physx controller manager
 
         AZ::Vector3 m_gravity; // cache the gravity of the scene to avoid a lock in GetGravity().
+
+        // Async scene queries may be queued from any thread, they are dispatched in StartSimulation and their callbacks
+        // are invoked in FinishSimulation, on the thread running the simulation.
+        AZStd::mutex m_asyncSceneQueryMutex;
+        AZStd::vector<AsyncSceneQuery> m_queuedAsyncSceneQueries;
+        AZStd::vector<AsyncSceneQuery> m_dispatchedAsyncSceneQueries;
+        AZStd::vector<BatchedSceneQuery> m_dispatchedBatchedQueries;
+        AZStd::unique_ptr<AZ::TaskGraph> m_asyncSceneQueryTaskGraph;
+        AZStd::unique_ptr<AZ::TaskGraphEvent> m_asyncSceneQueryEvent;
     };
 }
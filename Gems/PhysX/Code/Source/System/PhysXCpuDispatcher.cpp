@@ -7,24 +7,138 @@
  */
 
 #include <System/PhysXCpuDispatcher.h>
-#include <System/PhysXJob.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+
+AZ_CVAR(AZ::u32, physx_cpuDispatcherWorkerCount, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Maximum number of task graph workers running PhysX simulation tasks concurrently, 0 uses every task executor thread. "
+    "Applies to dispatchers created after the value is changed.");
 
 namespace PhysX
 {
-    PhysXCpuDispatcher* PhysXCpuDispatcherCreate()
+    namespace Internal
+    {
+        bool IsCpuDispatcherTaskGraphActive()
+        {
+            const auto* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+            return taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
+        }
+    } // namespace Internal
+
+    PhysXCpuDispatcher* PhysXCpuDispatcherCreate(AZ::u32 workerCount)
+    {
+        return aznew PhysXCpuDispatcher(workerCount != 0 ? workerCount : static_cast<AZ::u32>(physx_cpuDispatcherWorkerCount));
+    }
+
+    PhysXCpuDispatcher::PhysXCpuDispatcher(AZ::u32 workerCount)
+        : m_workerCount(workerCount)
     {
-        return aznew PhysXCpuDispatcher();
+    }
+
+    PhysXCpuDispatcher::~PhysXCpuDispatcher()
+    {
+        // Workers and jobs signal shortly after running their last task, wait for them before the queue is destroyed
+        AZStd::unique_lock<AZStd::mutex> lock(m_pendingTasksMutex);
+        m_idleCondition.wait(lock, [this]()
+            {
+                return m_activeWorkers == 0 && m_pendingJobs == 0;
+            });
     }
 
     void PhysXCpuDispatcher::submitTask(physx::PxBaseTask& task)
     {
-        auto azJob = aznew PhysXJob(task);
-        azJob->Start();
+        if (!Internal::IsCpuDispatcherTaskGraphActive())
+        {
+            SubmitJob(task);
+            return;
+        }
+
+        bool startWorker = false;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_pendingTasksMutex);
+            m_pendingTasks.push_back(&task);
+            if (m_activeWorkers < getWorkerCount())
+            {
+                ++m_activeWorkers;
+                startWorker = true;
+            }
+        }
+
+        if (startWorker)
+        {
+            // A worker keeps pulling tasks until the queue is empty, so bursts of PhysX tasks only start a graph per worker
+            AZ::TaskDescriptor taskDescriptor{ "PhysXCpuDispatcher", "Physics" };
+            AZ::TaskGraph taskGraph{ "PhysXCpuDispatcher" };
+            taskGraph.AddTask(taskDescriptor, [this]()
+                {
+                    DrainTasks();
+                });
+            taskGraph.Detach();
+            taskGraph.Submit();
+        }
     }
 
     physx::PxU32 PhysXCpuDispatcher::getWorkerCount() const
     {
-        return AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+        if (!Internal::IsCpuDispatcherTaskGraphActive())
+        {
+            return AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+        }
+
+        const AZ::u32 executorThreadCount = AZ::TaskExecutor::Instance().GetThreadCount();
+        return (m_workerCount != 0) ? AZStd::min(m_workerCount, executorThreadCount) : executorThreadCount;
+    }
+
+    void PhysXCpuDispatcher::DrainTasks()
+    {
+        for (;;)
+        {
+            physx::PxBaseTask* task = nullptr;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_pendingTasksMutex);
+                if (m_pendingTasks.empty())
+                {
+                    // Retiring under the lock guarantees a task queued after this point starts a new worker
+                    --m_activeWorkers;
+                    m_idleCondition.notify_all();
+                    return;
+                }
+                task = m_pendingTasks.front();
+                m_pendingTasks.pop_front();
+            }
+            RunTask(*task);
+        }
     }
-} // namespace PhysX
 
+    void PhysXCpuDispatcher::SubmitJob(physx::PxBaseTask& task)
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_pendingTasksMutex);
+            ++m_pendingJobs;
+        }
+
+        AZ::Job* job = AZ::CreateJobFunction([this, &task]()
+            {
+                RunTask(task);
+
+                AZStd::lock_guard<AZStd::mutex> lock(m_pendingTasksMutex);
+                --m_pendingJobs;
+                m_idleCondition.notify_all();
+            }, true);
+        job->Start();
+    }
+
+    void PhysXCpuDispatcher::RunTask(physx::PxBaseTask& task)
+    {
+        AZ_PROFILE_SCOPE(Physics, task.getName());
+        task.run();
+        task.release();
+    }
+} // namespace PhysX
@@ -9,25 +9,49 @@
 #pragma once
 #include <PxPhysicsAPI.h>
 #include <System/PhysXAllocator.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace PhysX
 {
-    //! CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
+    //! CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine task graph executor.
+    //! Submitted tasks are queued and drained by a bounded number of task graph workers, so PhysX shares
+    //! the engine's worker threads instead of creating one job per task.
+    //! While the task graph is inactive (cl_activateTaskGraph), each task runs as a job on the job manager instead.
     class PhysXCpuDispatcher
         : public physx::PxCpuDispatcher
     {
     public:
         AZ_CLASS_ALLOCATOR(PhysXCpuDispatcher, PhysXAllocator, 0);
 
-        PhysXCpuDispatcher() = default;
-        ~PhysXCpuDispatcher() = default;
-        
+        //! @param workerCount Maximum number of task graph workers draining PhysX tasks concurrently,
+        //! 0 to use every thread of the task executor.
+        explicit PhysXCpuDispatcher(AZ::u32 workerCount = 0);
+        ~PhysXCpuDispatcher();
+
     private:
         // PxCpuDispatcher implementation
         void submitTask(physx::PxBaseTask& task) override;
         physx::PxU32 getWorkerCount() const override;
+
+        //! Runs queued PhysX tasks on the calling task graph worker until the queue is empty.
+        void DrainTasks();
+
+        //! Runs the task as a job on the job manager, used while the task graph is inactive.
+        void SubmitJob(physx::PxBaseTask& task);
+
+        static void RunTask(physx::PxBaseTask& task);
+
+        AZStd::mutex m_pendingTasksMutex;
+        AZStd::condition_variable m_idleCondition; //!< Signaled when a worker retires or a job completes.
+        AZStd::deque<physx::PxBaseTask*> m_pendingTasks; //!< Reused between submissions, tasks are not wrapped individually.
+        AZ::u32 m_activeWorkers = 0;
+        AZ::u32 m_pendingJobs = 0;
+        AZ::u32 m_workerCount = 0;
     };
 
-    //! Creates a CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
-    PhysXCpuDispatcher* PhysXCpuDispatcherCreate();
+    //! Creates a CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine task graph executor.
+    //! @param workerCount Maximum number of workers running PhysX tasks concurrently, 0 to use the physx_cpuDispatcherWorkerCount cvar.
+    PhysXCpuDispatcher* PhysXCpuDispatcherCreate(AZ::u32 workerCount = 0);
 } // namespace PhysX
@@ -131,7 +131,6 @@ namespace PhysX
             return { materialIndex0, materialIndex1 };
         }
 
-        //! Convert a subset of a heightfield shape configuration to a vector of PhysX Heightfield samples.
         AZStd::vector<physx::PxHeightFieldSample> ConvertHeightfieldSamples(
             const Physics::HeightfieldShapeConfiguration& heightfield,
             const size_t startCol, const size_t startRow, 
@@ -269,12 +268,13 @@ namespace PhysX
             }
         }
 
-        void RefreshHeightfieldShape(
+        void ModifyHeightfieldShapeSamples(
             AzPhysics::Scene* physicsScene,
             Physics::Shape* heightfieldShape,
             Physics::HeightfieldShapeConfiguration& heightfield,
             const size_t startCol, const size_t startRow,
-            const size_t numColsToUpdate, const size_t numRowsToUpdate)
+            const size_t numColsToUpdate, const size_t numRowsToUpdate,
+            const AZStd::vector<physx::PxHeightFieldSample>& physxSamples)
         {
             AZ_PROFILE_FUNCTION(Physics);
 
@@ -287,10 +287,11 @@ namespace PhysX
             physx::PxHeightField* pxHeightfield = static_cast<physx::PxHeightField*>(heightfield.GetCachedNativeHeightfield());
             AZ_Assert(pxHeightfield, "Attempting to refresh a null heightfield");
 
-            // Convert the generic heightfield samples in the heigthfield shape to PhysX heightfield samples.
-            // This can be done outside the scene lock because we aren't modifying anything yet.
-            AZStd::vector<physx::PxHeightFieldSample> physxSamples =
-                ConvertHeightfieldSamples(heightfield, startCol, startRow, numColsToUpdate, numRowsToUpdate);
+            AZ_Assert(physxSamples.size() == numColsToUpdate * numRowsToUpdate, "Heightfield patch has the wrong number of samples");
+            if (physxSamples.empty())
+            {
+                return;
+            }
 
             // Create a descriptor for the subregion that we're updating.
             physx::PxHeightFieldDesc desc;
@@ -316,6 +317,24 @@ namespace PhysX
             }
         }
 
+        void RefreshHeightfieldShape(
+            AzPhysics::Scene* physicsScene,
+            Physics::Shape* heightfieldShape,
+            Physics::HeightfieldShapeConfiguration& heightfield,
+            const size_t startCol, const size_t startRow,
+            const size_t numColsToUpdate, const size_t numRowsToUpdate)
+        {
+            AZ_PROFILE_FUNCTION(Physics);
+
+            // Convert the generic heightfield samples in the heigthfield shape to PhysX heightfield samples.
+            // This can be done outside the scene lock because we aren't modifying anything yet.
+            AZStd::vector<physx::PxHeightFieldSample> physxSamples =
+                ConvertHeightfieldSamples(heightfield, startCol, startRow, numColsToUpdate, numRowsToUpdate);
+
+            ModifyHeightfieldShapeSamples(
+                physicsScene, heightfieldShape, heightfield, startCol, startRow, numColsToUpdate, numRowsToUpdate, physxSamples);
+        }
+
         bool CreatePxGeometryFromConfig(const Physics::ShapeConfiguration& shapeConfiguration, physx::PxGeometryHolder& pxGeometry)
         {
             if (!shapeConfiguration.m_scale.IsGreaterThan(AZ::Vector3::CreateZero()))
@@ -202,6 +202,34 @@ namespace PhysX
         Physics::HeightfieldShapeConfiguration CreateBaseHeightfieldShapeConfiguration(AZ::EntityId entityId);
         Physics::HeightfieldShapeConfiguration CreateHeightfieldShapeConfiguration(AZ::EntityId entityId);
 
+        //! Convert a subset of a heightfield shape configuration to a vector of PhysX Heightfield samples.
+        AZStd::vector<physx::PxHeightFieldSample> ConvertHeightfieldSamples(
+            const Physics::HeightfieldShapeConfiguration& heightfield,
+            const size_t startCol,
+            const size_t startRow,
+            const size_t numColsToUpdate,
+            const size_t numRowsToUpdate);
+
+        //! Patch a portion of the heightfield shape in the given scene with samples that were already converted to PhysX samples.
+        //! This lets the conversion run on a worker thread while the patch itself is applied when the scene isn't simulating.
+        //! @param physicsScene The scene that the shape is located in. (Needed for write-locking the scene)
+        //! @param heightfieldShape The shape containing the heightfield in the scene.
+        //! @param heightfield The shape configuration that holds the PhysX heightfield to patch.
+        //! @param startCol The starting column of the heightfield to patch
+        //! @param startRow The starting row of the heightfield to patch
+        //! @param numColsToUpdate The number of columns in the patch
+        //! @param numRowsToUpdate The number of rows in the patch
+        //! @param physxSamples The numColsToUpdate x numRowsToUpdate samples to write, as returned by ConvertHeightfieldSamples
+        void ModifyHeightfieldShapeSamples(
+            AzPhysics::Scene* physicsScene,
+            Physics::Shape* heightfieldShape,
+            Physics::HeightfieldShapeConfiguration& heightfield,
+            const size_t startCol,
+            const size_t startRow,
+            const size_t numColsToUpdate,
+            const size_t numRowsToUpdate,
+            const AZStd::vector<physx::PxHeightFieldSample>& physxSamples);
+
         //! Refresh a portion of the heightfield shape in the given scene based on the data in the HeightfieldShapeConfiguration.
         //! @param physicsScene The scene that the shape is located in. (Needed for write-locking the scene in the thread)
         //! @param heightfieldShape The shape containing the heightfield in the scene.
@@ -23,6 +23,10 @@
 #include <PhysX/Material/PhysXMaterial.h>
 #include <PhysX/Material/PhysXMaterialConfiguration.h>
 #include <AzCore/Casting/lossy_cast.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzFramework/Physics/ColliderComponentBus.h>
+#include <Tests/PhysXTestCommon.h>
 #include <Utils.h>
 
 using ::testing::NiceMock;
@@ -273,6 +277,57 @@ namespace PhysXEditorTests
             return {};
         };
 
+        //! Returns the PhysX height of the center sample of the game entity's heightfield.
+        physx::PxI16 GetGameCenterHeight()
+        {
+            AzPhysics::SimulatedBody* staticBody = nullptr;
+            AzPhysics::SimulatedBodyComponentRequestsBus::EventResult(
+                staticBody, m_gameEntity->GetId(), &AzPhysics::SimulatedBodyComponentRequests::GetSimulatedBody);
+            const auto* pxRigidStatic = static_cast<const physx::PxRigidStatic*>(staticBody->GetNativePointer());
+
+            PHYSX_SCENE_READ_LOCK(pxRigidStatic->getScene());
+
+            physx::PxShape* shape = nullptr;
+            pxRigidStatic->getShapes(&shape, 1, 0);
+
+            physx::PxHeightFieldGeometry heightfieldGeometry;
+            shape->getHeightFieldGeometry(heightfieldGeometry);
+            return heightfieldGeometry.heightField->getSample(1, 1).height;
+        }
+
+        //! Makes the game heightfield provider return the mocked samples with a different center height.
+        void SetGameCenterHeight(float height)
+        {
+            ON_CALL(*m_gameMockShapeRequests, UpdateHeightsAndMaterialsAsync)
+                .WillByDefault(
+                    [height](const Physics::UpdateHeightfieldSampleFunction& updateHeightsMaterialsCallback,
+                       const Physics::UpdateHeightfieldCompleteFunction& updateHeightsMaterialsCompleteCallback,
+                       [[maybe_unused]] size_t startColumn,
+                       [[maybe_unused]] size_t startRow,
+                       [[maybe_unused]] size_t numColumns,
+                       [[maybe_unused]] size_t numRows)
+                    {
+                        auto samples = GetSamples();
+                        samples[4].m_height = height;
+                        for (size_t row = 0; row < 3; row++)
+                        {
+                            for (size_t col = 0; col < 3; col++)
+                            {
+                                updateHeightsMaterialsCallback(col, row, samples[(row * 3) + col]);
+                            }
+                        }
+
+                        updateHeightsMaterialsCompleteCallback();
+                    });
+        }
+
+        //! Returns the PhysX height of a sample for the mocked height bounds of [-3, 3].
+        static physx::PxI16 ToPhysXHeight(float height)
+        {
+            const float scaleFactor = AZStd::numeric_limits<int16_t>::max() / 3.0f;
+            return azlossy_cast<physx::PxI16>(height * scaleFactor);
+        }
+
         EntityPtr m_editorEntity;
         EntityPtr m_gameEntity;
         AZStd::unique_ptr<NiceMock<UnitTest::MockPhysXHeightfieldProvider>> m_editorMockShapeRequests;
@@ -486,5 +541,119 @@ namespace PhysXEditorTests
         }
     }
 
+    //! Counts the collider change notifications of an entity, and records the heightfield's center height at the time.
+    class HeightfieldColliderChangedHandler
+        : public Physics::ColliderComponentEventBus::Handler
+    {
+    public:
+        HeightfieldColliderChangedHandler(AZ::EntityId entityId, AZStd::function<physx::PxI16()> getCenterHeight)
+            : m_getCenterHeight(AZStd::move(getCenterHeight))
+        {
+            Physics::ColliderComponentEventBus::Handler::BusConnect(entityId);
+        }
+
+        ~HeightfieldColliderChangedHandler()
+        {
+            Physics::ColliderComponentEventBus::Handler::BusDisconnect();
+        }
+
+        void OnColliderChanged() override
+        {
+            ++m_changedCount;
+            m_centerHeight = m_getCenterHeight();
+        }
+
+        AZStd::function<physx::PxI16()> m_getCenterHeight;
+        int m_changedCount = 0;
+        physx::PxI16 m_centerHeight = 0;
+    };
+
+    TEST_F(PhysXEditorHeightfieldFixture, EditorHeightfieldColliderComponentDataChangesAreAppliedAtSimulationStart)
+    {
+        constexpr float UpdatedHeight = -2.0f;
+        EXPECT_EQ(GetGameCenterHeight(), ToPhysXHeight(GetSamples()[4].m_height));
+
+        // Game code runs at the default priority, after the collider has patched its heightfield for this simulation step.
+        AZStd::vector<physx::PxI16> heightsSeenBySimulationStart;
+        AzPhysics::SceneEvents::OnSceneSimulationStartHandler gameCodeStartHandler(
+            [this, &heightsSeenBySimulationStart](
+                [[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] float fixedDeltaTime)
+            {
+                heightsSeenBySimulationStart.push_back(GetGameCenterHeight());
+            }, aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Default));
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        sceneInterface->RegisterSceneSimulationStartHandler(m_defaultSceneHandle, gameCodeStartHandler);
+
+        HeightfieldColliderChangedHandler colliderChangedHandler(m_gameEntity->GetId(), [this]() { return GetGameCenterHeight(); });
+
+        // Change the center height without changing the size of the heightfield, so the collider updates it in place.
+        SetGameCenterHeight(UpdatedHeight);
+        Physics::HeightfieldProviderNotificationBus::Event(
+            m_gameEntity->GetId(),
+            &Physics::HeightfieldProviderNotificationBus::Events::OnHeightfieldDataChanged, AZ::Aabb::CreateNull(),
+            Physics::HeightfieldProviderNotifications::HeightfieldChangeMask::HeightData);
+
+        // The update jobs run in the background and their samples are only applied at a simulation start, so step the scene
+        // until the collider reports the change.
+        constexpr int MaxSteps = 1000;
+        for (int step = 0; (step < MaxSteps) && (colliderChangedHandler.m_changedCount == 0); ++step)
+        {
+            PhysX::TestUtils::UpdateScene(m_defaultScene, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+        }
+
+        // The notification is sent once, after the new samples are in the PhysX heightfield.
+        ASSERT_EQ(colliderChangedHandler.m_changedCount, 1);
+        EXPECT_EQ(colliderChangedHandler.m_centerHeight, ToPhysXHeight(UpdatedHeight));
+        EXPECT_EQ(GetGameCenterHeight(), ToPhysXHeight(UpdatedHeight));
+
+        // The game code start handler of the step that applied the samples already saw the updated height.
+        ASSERT_FALSE(heightsSeenBySimulationStart.empty());
+        EXPECT_EQ(heightsSeenBySimulationStart.back(), ToPhysXHeight(UpdatedHeight));
+
+        gameCodeStartHandler.Disconnect();
+    }
+
+    TEST_F(PhysXEditorHeightfieldFixture, EditorHeightfieldColliderComponentBlockOnPendingJobsAppliesDataChanges)
+    {
+        constexpr float UpdatedHeight = 2.5f;
+
+        SetGameCenterHeight(UpdatedHeight);
+        Physics::HeightfieldProviderNotificationBus::Event(
+            m_gameEntity->GetId(),
+            &Physics::HeightfieldProviderNotificationBus::Events::OnHeightfieldDataChanged, AZ::Aabb::CreateNull(),
+            Physics::HeightfieldProviderNotifications::HeightfieldChangeMask::HeightData);
+
+        // Blocking on the jobs applies their samples right away, without waiting for a simulation step.
+        m_gameEntity->FindComponent<PhysX::HeightfieldColliderComponent>()->BlockOnPendingJobs();
+        EXPECT_EQ(GetGameCenterHeight(), ToPhysXHeight(UpdatedHeight));
+    }
+
+    TEST_F(PhysXEditorHeightfieldFixture, EditorHeightfieldColliderComponentDataChangesAreAppliedOnTickWithoutSimulation)
+    {
+        constexpr float UpdatedHeight = 1.0f;
+
+        HeightfieldColliderChangedHandler colliderChangedHandler(m_gameEntity->GetId(), [this]() { return GetGameCenterHeight(); });
+
+        SetGameCenterHeight(UpdatedHeight);
+        Physics::HeightfieldProviderNotificationBus::Event(
+            m_gameEntity->GetId(),
+            &Physics::HeightfieldProviderNotificationBus::Events::OnHeightfieldDataChanged, AZ::Aabb::CreateNull(),
+            Physics::HeightfieldProviderNotifications::HeightfieldChangeMask::HeightData);
+
+        // Scenes that don't simulate, like the editor scene during play in editor, never reach a simulation start,
+        // so only tick until the collider reports the change.
+        constexpr int MaxTicks = 1000;
+        for (int tick = 0; (tick < MaxTicks) && (colliderChangedHandler.m_changedCount == 0); ++tick)
+        {
+            AZ::TickBus::Broadcast(&AZ::TickEvents::OnTick, 0.0f, AZ::ScriptTimePoint());
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+        }
+
+        ASSERT_EQ(colliderChangedHandler.m_changedCount, 1);
+        EXPECT_EQ(colliderChangedHandler.m_centerHeight, ToPhysXHeight(UpdatedHeight));
+        EXPECT_EQ(GetGameCenterHeight(), ToPhysXHeight(UpdatedHeight));
+    }
+
 } // namespace PhysXEditorTests
 
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <System/PhysXCpuDispatcher.h>
+
+namespace PhysX
+{
+    namespace Internal
+    {
+        //! Counts how many times PhysX would have run and released the task.
+        class CountingTask
+            : public physx::PxLightCpuTask
+        {
+        public:
+            void run() override
+            {
+                ++m_runCount;
+            }
+
+            const char* getName() const override
+            {
+                return "CountingTask";
+            }
+
+            void release() override
+            {
+                ++m_releaseCount;
+            }
+
+            AZStd::atomic<int> m_runCount{ 0 };
+            AZStd::atomic<int> m_releaseCount{ 0 };
+        };
+    } // namespace Internal
+
+    //! Sets cl_activateTaskGraph for the lifetime of the object and restores the previous value after.
+    class ScopedTaskGraphActive
+    {
+    public:
+        explicit ScopedTaskGraphActive(bool active)
+        {
+            m_console = AZ::Interface<AZ::IConsole>::Get();
+            EXPECT_NE(m_console, nullptr);
+            if (m_console)
+            {
+                m_console->GetCvarValue("cl_activateTaskGraph", m_previousValue);
+                m_console->PerformCommand(active ? "cl_activateTaskGraph true" : "cl_activateTaskGraph false");
+            }
+        }
+
+        ~ScopedTaskGraphActive()
+        {
+            if (m_console)
+            {
+                m_console->PerformCommand(m_previousValue ? "cl_activateTaskGraph true" : "cl_activateTaskGraph false");
+            }
+        }
+
+    private:
+        AZ::IConsole* m_console = nullptr;
+        bool m_previousValue = false;
+    };
+
+    class PhysXCpuDispatcherTest
+        : public testing::TestWithParam<bool>
+    {
+    public:
+        static constexpr int TaskCount = 256;
+
+        //! Submits the tasks to a new dispatcher and destroys it, which waits for all of them to complete.
+        static void SubmitAndDestroy(AZStd::vector<AZStd::unique_ptr<Internal::CountingTask>>& tasks, AZ::u32 workerCount = 0)
+        {
+            tasks.resize(TaskCount);
+            AZStd::unique_ptr<PhysXCpuDispatcher> dispatcher(PhysXCpuDispatcherCreate(workerCount));
+            physx::PxCpuDispatcher& pxDispatcher = *dispatcher;
+            for (auto& task : tasks)
+            {
+                task = AZStd::make_unique<Internal::CountingTask>();
+                pxDispatcher.submitTask(*task);
+            }
+            dispatcher.reset();
+        }
+    };
+
+    TEST_P(PhysXCpuDispatcherTest, SubmittedTasks_AllRunAndReleaseOnceBeforeDestruction)
+    {
+        ScopedTaskGraphActive taskGraphActive(GetParam());
+        ASSERT_NE(AZ::Interface<AZ::TaskGraphActiveInterface>::Get(), nullptr);
+        EXPECT_EQ(AZ::Interface<AZ::TaskGraphActiveInterface>::Get()->IsTaskGraphActive(), GetParam());
+
+        AZStd::vector<AZStd::unique_ptr<Internal::CountingTask>> tasks;
+        SubmitAndDestroy(tasks);
+
+        for (const auto& task : tasks)
+        {
+            EXPECT_EQ(task->m_runCount, 1);
+            EXPECT_EQ(task->m_releaseCount, 1);
+        }
+    }
+
+    TEST_P(PhysXCpuDispatcherTest, SubmittedTasks_WithSingleWorker_AllRunBeforeDestruction)
+    {
+        ScopedTaskGraphActive taskGraphActive(GetParam());
+
+        AZStd::vector<AZStd::unique_ptr<Internal::CountingTask>> tasks;
+        SubmitAndDestroy(tasks, 1);
+
+        for (const auto& task : tasks)
+        {
+            EXPECT_EQ(task->m_runCount, 1);
+            EXPECT_EQ(task->m_releaseCount, 1);
+        }
+    }
+
+    TEST_P(PhysXCpuDispatcherTest, WorkerCount_MatchesActiveScheduler)
+    {
+        ScopedTaskGraphActive taskGraphActive(GetParam());
+
+        AZStd::unique_ptr<PhysXCpuDispatcher> dispatcher(PhysXCpuDispatcherCreate());
+        const physx::PxCpuDispatcher& pxDispatcher = *dispatcher;
+
+        if (GetParam())
+        {
+            EXPECT_EQ(pxDispatcher.getWorkerCount(), AZ::TaskExecutor::Instance().GetThreadCount());
+        }
+        else
+        {
+            // The simulation keeps the parallelism of the job workers while the task graph is inactive
+            EXPECT_EQ(pxDispatcher.getWorkerCount(), AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads());
+        }
+    }
+
+    TEST(PhysXCpuDispatcher, WorkerCount_WithTaskGraphActive_IsBoundedByWorkerCount)
+    {
+        ScopedTaskGraphActive taskGraphActive(true);
+
+        AZStd::unique_ptr<PhysXCpuDispatcher> dispatcher(PhysXCpuDispatcherCreate(1));
+        const physx::PxCpuDispatcher& pxDispatcher = *dispatcher;
+        EXPECT_EQ(pxDispatcher.getWorkerCount(), 1);
+    }
+
+    INSTANTIATE_TEST_CASE_P(PhysX, PhysXCpuDispatcherTest, ::testing::Bool());
+} // namespace PhysX
@@ -7,6 +7,8 @@
  */
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
@@ -1007,4 +1009,219 @@ namespace PhysX
             }
         }
     }
+
+    //! Enables the parallel scene query path for the lifetime of the object, it is off by default.
+    class ScopedParallelSceneQueries
+    {
+    public:
+        ScopedParallelSceneQueries()
+        {
+            m_console = AZ::Interface<AZ::IConsole>::Get();
+            EXPECT_NE(m_console, nullptr);
+            if (m_console)
+            {
+                m_console->PerformCommand("physx_parallelSceneQueries true");
+            }
+        }
+
+        ~ScopedParallelSceneQueries()
+        {
+            if (m_console)
+            {
+                m_console->PerformCommand("physx_parallelSceneQueries false");
+            }
+        }
+
+    private:
+        AZ::IConsole* m_console = nullptr;
+    };
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_LargeMixedBatch_MatchesIndividualQueries)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        ScopedParallelSceneQueries parallelSceneQueries;
+
+        AzPhysics::SimulatedBodyHandle sphereHandle = TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3::CreateZero(), 10.0f);
+
+        // enough requests to be split across several tasks, interleaving request types and hits with misses
+        AzPhysics::SceneQueryRequests requests;
+        for (int i = 0; i < 500; ++i)
+        {
+            const float offset = (i % 2 == 0) ? 0.0f : 50.0f;
+            if (i % 3 == 0)
+            {
+                auto request = AZStd::make_shared<AzPhysics::OverlapRequest>(AzPhysics::OverlapRequestHelpers::CreateSphereOverlapRequest(
+                    1.0f, AZ::Transform::CreateTranslation(AZ::Vector3(offset, 0.0f, 0.0f))));
+                requests.emplace_back(AZStd::move(request));
+            }
+            else
+            {
+                auto request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+                request->m_start = AZ::Vector3(-100.0f, offset, 0.0f);
+                request->m_direction = AZ::Vector3::CreateAxisX(1.0f);
+                request->m_distance = 200.0f;
+                requests.emplace_back(AZStd::move(request));
+            }
+        }
+
+        AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const AzPhysics::SceneQueryHits expected = sceneInterface->QueryScene(m_testSceneHandle, requests[i].get());
+            ASSERT_EQ(results[i].m_hits.size(), expected.m_hits.size());
+            EXPECT_EQ(results[i].m_hits.size(), (i % 2 == 0) ? 1u : 0u);
+            for (size_t j = 0; j < expected.m_hits.size(); ++j)
+            {
+                EXPECT_TRUE(results[i].m_hits[j].m_bodyHandle == expected.m_hits[j].m_bodyHandle);
+            }
+        }
+
+        sceneInterface->RemoveSimulatedBody(m_testSceneHandle, sphereHandle);
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_CallbacksDeliveredAfterSimulation)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        AzPhysics::SimulatedBodyHandle sphereHandle = TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3::CreateZero(), 10.0f);
+
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3(-100.0f, 0.0f, 0.0f);
+        request.m_direction = AZ::Vector3::CreateAxisX(1.0f);
+        request.m_distance = 200.0f;
+
+        AzPhysics::SceneQueryRequests batchRequests;
+        batchRequests.emplace_back(AZStd::make_shared<AzPhysics::RayCastRequest>(request));
+        batchRequests.emplace_back(AZStd::make_shared<AzPhysics::RayCastRequest>(request));
+
+        AzPhysics::SceneQuery::AsyncRequestId singleResultId = -1;
+        AzPhysics::SceneQueryHits singleResult;
+        bool asyncQueued = sceneInterface->QuerySceneAsync(m_testSceneHandle, 1, &request,
+            [&](AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHits hits)
+            {
+                singleResultId = requestId;
+                singleResult = AZStd::move(hits);
+            });
+        EXPECT_TRUE(asyncQueued);
+
+        AzPhysics::SceneQuery::AsyncRequestId batchResultId = -1;
+        AzPhysics::SceneQueryHitsList batchResults;
+        asyncQueued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, 2, batchRequests,
+            [&](AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHitsList hits)
+            {
+                batchResultId = requestId;
+                batchResults = AZStd::move(hits);
+            });
+        EXPECT_TRUE(asyncQueued);
+
+        // the request may go out of scope once queued, and results are only delivered by the simulation
+        request.m_distance = 0.0f;
+        EXPECT_EQ(singleResultId, -1);
+        EXPECT_EQ(batchResultId, -1);
+
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+
+        EXPECT_EQ(singleResultId, 1);
+        ASSERT_EQ(singleResult.m_hits.size(), 1);
+        EXPECT_TRUE(singleResult.m_hits[0].m_bodyHandle == sphereHandle);
+
+        EXPECT_EQ(batchResultId, 2);
+        ASSERT_EQ(batchResults.size(), batchRequests.size());
+        for (const AzPhysics::SceneQueryHits& hits : batchResults)
+        {
+            ASSERT_EQ(hits.m_hits.size(), 1);
+            EXPECT_TRUE(hits.m_hits[0].m_bodyHandle == sphereHandle);
+        }
+
+        sceneInterface->RemoveSimulatedBody(m_testSceneHandle, sphereHandle);
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_WithFilterCallback_RunsOnCallingThread)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        ScopedParallelSceneQueries parallelSceneQueries;
+
+        AzPhysics::SimulatedBodyHandle sphereHandle = TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3::CreateZero(), 10.0f);
+
+        // The filter callback is not required to be thread safe, so it must only ever be invoked on the thread issuing the batch
+        const AZStd::thread_id callingThreadId = AZStd::this_thread::get_id();
+        size_t callbackCount = 0;
+        bool calledFromOtherThread = false;
+        auto filterCallback = [&](const AzPhysics::SimulatedBody*, const Physics::Shape*)
+        {
+            ++callbackCount;
+            calledFromOtherThread |= (AZStd::this_thread::get_id() != callingThreadId);
+            return AzPhysics::SceneQuery::QueryHitType::Block;
+        };
+
+        // Large enough that the batch would otherwise be split across several tasks
+        AzPhysics::SceneQueryRequests requests;
+        for (int i = 0; i < 500; ++i)
+        {
+            auto request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3(-100.0f, 0.0f, 0.0f);
+            request->m_direction = AZ::Vector3::CreateAxisX(1.0f);
+            request->m_distance = 200.0f;
+            if (i == 250)
+            {
+                request->m_filterCallback = filterCallback;
+            }
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+        ASSERT_EQ(results.size(), requests.size());
+        for (const AzPhysics::SceneQueryHits& hits : results)
+        {
+            ASSERT_EQ(hits.m_hits.size(), 1);
+            EXPECT_TRUE(hits.m_hits[0].m_bodyHandle == sphereHandle);
+        }
+        EXPECT_GT(callbackCount, 0);
+        EXPECT_FALSE(calledFromOtherThread);
+
+        sceneInterface->RemoveSimulatedBody(m_testSceneHandle, sphereHandle);
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_WithFilterCallback_RunsOnSimulatingThread)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        ScopedParallelSceneQueries parallelSceneQueries;
+
+        AzPhysics::SimulatedBodyHandle sphereHandle = TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3::CreateZero(), 10.0f);
+
+        const AZStd::thread_id simulatingThreadId = AZStd::this_thread::get_id();
+        bool calledFromOtherThread = false;
+        size_t callbackCount = 0;
+
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3(-100.0f, 0.0f, 0.0f);
+        request.m_direction = AZ::Vector3::CreateAxisX(1.0f);
+        request.m_distance = 200.0f;
+        request.m_filterCallback = [&](const AzPhysics::SimulatedBody*, const Physics::Shape*)
+        {
+            ++callbackCount;
+            calledFromOtherThread |= (AZStd::this_thread::get_id() != simulatingThreadId);
+            return AzPhysics::SceneQuery::QueryHitType::Block;
+        };
+
+        AzPhysics::SceneQueryHits result;
+        const bool asyncQueued = sceneInterface->QuerySceneAsync(m_testSceneHandle, 1, &request,
+            [&result](AzPhysics::SceneQuery::AsyncRequestId, AzPhysics::SceneQueryHits hits)
+            {
+                result = AZStd::move(hits);
+            });
+        EXPECT_TRUE(asyncQueued);
+
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+
+        ASSERT_EQ(result.m_hits.size(), 1);
+        EXPECT_TRUE(result.m_hits[0].m_bodyHandle == sphereHandle);
+        EXPECT_GT(callbackCount, 0);
+        EXPECT_FALSE(calledFromOtherThread);
+
+        sceneInterface->RemoveSimulatedBody(m_testSceneHandle, sphereHandle);
+    }
 }
@@ -11,6 +11,7 @@
 
 #include <AzTest/AzTest.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/UnitTest/UnitTest.h>
 #include <AZTestShared/Math/MathTestHelpers.h>
 #include <AZTestShared/Utils/Utils.h>
@@ -39,6 +40,8 @@
 
 namespace PhysX
 {
+    AZ_CVAR_EXTERNED(bool, physx_batchTransformSync);
+
     class PhysXSpecificTest
         : public PhysXDefaultWorldTest
         , public UnitTest::TraceBusRedirector
@@ -584,6 +587,51 @@ namespace PhysX
         EXPECT_TRUE(com.IsClose(AZ::Vector3::CreateOne(), PhysXSpecificTest::tolerance));
     }
 
+    TEST_F(PhysXSpecificTest, FlushTransformSync_ActiveBody_PoseSyncedToEntityAndAggregatedEvent)
+    {
+        //! Enables batched transform sync for the test and restores the previous value after, also when an assertion fails.
+        struct ScopedBatchTransformSync
+        {
+            ScopedBatchTransformSync()
+                : m_previousValue(physx_batchTransformSync)
+            {
+                physx_batchTransformSync = true;
+            }
+
+            ~ScopedBatchTransformSync()
+            {
+                physx_batchTransformSync = m_previousValue;
+            }
+
+            const bool m_previousValue;
+        };
+        ScopedBatchTransformSync batchTransformSync;
+
+        auto testBox = TestUtils::AddUnitTestObject(m_testSceneHandle, AZ::Vector3(0.0f, 0.0f, 10.0f), "TestBox");
+        AzPhysics::SimulatedBodyHandle boxHandle = testBox->FindComponent<RigidBodyComponent>()->GetSimulatedBodyHandle();
+
+        PhysX::PhysXScene::ActiveBodyPoseList syncedPoses;
+        PhysX::PhysXScene::OnActiveBodyPosesSynced::Handler posesSyncedHandler(
+            [&syncedPoses](AzPhysics::SceneHandle, const PhysX::PhysXScene::ActiveBodyPoseList& poses, float)
+            {
+                syncedPoses = poses;
+            });
+        static_cast<PhysX::PhysXScene*>(m_defaultScene)->RegisterActiveBodyPosesSyncedHandler(posesSyncedHandler);
+
+        TestUtils::UpdateScene(m_defaultScene, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 10);
+
+        // the falling box is active, so its pose is reported once in the aggregated event and written to its entity
+        auto poseIt = AZStd::find_if(syncedPoses.begin(), syncedPoses.end(),
+            [boxHandle](const PhysX::PhysXScene::ActiveBodyPose& pose) { return pose.m_bodyHandle == boxHandle; });
+        ASSERT_NE(poseIt, syncedPoses.end());
+        EXPECT_LT(poseIt->m_position.GetZ(), 10.0f);
+
+        AZ::Transform entityTransform = AZ::Transform::CreateIdentity();
+        AZ::TransformBus::EventResult(entityTransform, testBox->GetId(), &AZ::TransformBus::Events::GetWorldTM);
+        EXPECT_THAT(entityTransform.GetTranslation(), UnitTest::IsClose(poseIt->m_position));
+        EXPECT_THAT(entityTransform.GetRotation(), UnitTest::IsClose(poseIt->m_orientation));
+    }
+
     TEST_F(PhysXSpecificTest, TriggerArea_BodyDestroyedInsideTrigger_OnTriggerExitEventRaised)
     {
         // set up a trigger box
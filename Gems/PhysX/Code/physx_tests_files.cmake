@@ -10,6 +10,7 @@ set(FILES
     Source/ComponentDescriptors.cpp
     Source/ComponentDescriptors.h
     Tests/PhysXComponentBusTests.cpp
+    Tests/PhysXCpuDispatcherTests.cpp
     Tests/PhysXGenericTestFixture.h
     Tests/PhysXGenericTestFixture.cpp
     Tests/PhysXTestCommon.h
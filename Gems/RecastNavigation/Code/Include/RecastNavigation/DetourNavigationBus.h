@@ -27,6 +27,10 @@ namespace RecastNavigation
         //! @return the associated entity with @RecastNavigationMeshComponent
         virtual AZ::EntityId GetNavigationMeshEntity() const = 0;
 
+        //! The navigation mesh re-calculates the tiles closest to its agents first.
+        //! @return the world position of the agent
+        virtual AZ::Vector3 GetAgentWorldPosition() const = 0;
+
         //! Blocking call that finds a walkable path between two entities.
         //! @param fromEntity The starting point of the path from the position of this entity.
         //! @param toEntity The end point of the path is at the position of this entity.
@@ -38,8 +42,57 @@ namespace RecastNavigation
         //! @param toWorldPosition The end point of the path to find.
         //! @return If a path is found, returns a vector of waypoints. An empty vector is returned if a path was not found.
         virtual AZStd::vector<AZ::Vector3> FindPathBetweenPositions(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) = 0;
+
+        //! Queues a request to find a walkable path between two entities. The path is found on worker threads, together with the other
+        //! path requests of the same frame, and is returned with @DetourNavigationNotificationBus on the main thread in a later frame.
+        //! @param fromEntity The starting point of the path from the position of this entity.
+        //! @param toEntity The end point of the path is at the position of this entity.
+        //! @return The id of the request that is passed to @DetourNavigationNotifications::OnPathFound, or 0 if the request couldn't be queued.
+        virtual AZ::u64 FindPathBetweenEntitiesAsync(AZ::EntityId fromEntity, AZ::EntityId toEntity) = 0;
+
+        //! Queues a request to find a walkable path between two world positions. The path is found on worker threads, together with the
+        //! other path requests of the same frame, and is returned with @DetourNavigationNotificationBus on the main thread in a later frame.
+        //! @param fromWorldPosition The starting point of the path.
+        //! @param toWorldPosition The end point of the path to find.
+        //! @return The id of the request that is passed to @DetourNavigationNotifications::OnPathFound, or 0 if the request couldn't be queued.
+        virtual AZ::u64 FindPathBetweenPositionsAsync(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) = 0;
     };
 
     //! Request EBus for a path finding component.
     using DetourNavigationRequestBus = AZ::EBus<DetourNavigationRequests>;
+
+    //! Interface for the notifications of path finding requests.
+    class DetourNavigationNotifications
+        : public AZ::ComponentBus
+    {
+    public:
+        //! Notifies when a path requested with @FindPathBetweenEntitiesAsync or @FindPathBetweenPositionsAsync has been found.
+        //! @param agentEntity the entity that requested the path. This is helpful for Script Canvas use.
+        //! @param requestId the id returned when the path was requested.
+        //! @param waypoints the waypoints along the path, empty if a path was not found.
+        virtual void OnPathFound(AZ::EntityId agentEntity, AZ::u64 requestId, const AZStd::vector<AZ::Vector3>& waypoints) = 0;
+    };
+
+    //! Notification EBus for a path finding component.
+    using DetourNavigationNotificationBus = AZ::EBus<DetourNavigationNotifications>;
+
+    //! Scripting reflection helper for @DetourNavigationNotificationBus.
+    class DetourNavigationNotificationHandler
+        : public DetourNavigationNotificationBus::Handler
+        , public AZ::BehaviorEBusHandler
+    {
+    public:
+        AZ_EBUS_BEHAVIOR_BINDER(DetourNavigationNotificationHandler,
+            "{6A7E1F3B-2D4C-4B8E-9F05-C3D8A1E27B64}",
+            AZ::SystemAllocator, OnPathFound);
+
+        //! Notifies when a requested path has been found.
+        //! @param agentEntity the entity that requested the path.
+        //! @param requestId the id returned when the path was requested.
+        //! @param waypoints the waypoints along the path, empty if a path was not found.
+        void OnPathFound(AZ::EntityId agentEntity, AZ::u64 requestId, const AZStd::vector<AZ::Vector3>& waypoints) override
+        {
+            Call(FN_OnPathFound, agentEntity, requestId, waypoints);
+        }
+    };
 } // namespace RecastNavigation
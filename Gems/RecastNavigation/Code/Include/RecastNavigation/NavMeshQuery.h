@@ -9,6 +9,11 @@
 #pragma once
 
 #include <DetourNavMesh.h>
+#include <DetourNavMeshQuery.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <RecastNavigation/RecastSmartPointer.h>
 
 namespace RecastNavigation
@@ -16,10 +21,16 @@ namespace RecastNavigation
     //! Holds pointers to Recast navigation mesh objects and the associated mutex.
     //! This structure should be used when performing operations on a navigation mesh.
     //! In order to access NavMesh or NavMeshQuery objects, use the object LockGuard(NavMeshQuery&).
+    //! Path queries that only read the navigation mesh can run at the same time from multiple threads using SharedLockGuard(NavMeshQuery&),
+    //! each with its own query object from @AcquireQuery.
     class NavMeshQuery
     {
     public:
         class LockGuard;
+        class SharedLockGuard;
+
+        //! The maximum number of search nodes of each query object.
+        static constexpr int MaxQueryNodes = 2048;
 
         NavMeshQuery(dtNavMesh* navMesh, dtNavMeshQuery* navQuery)
         {
@@ -28,12 +39,12 @@ namespace RecastNavigation
         }
 
         //! A lock guard class with accessors for navigation mesh and query objects.
-        //! A lock is held in place until this object goes out of scope.
+        //! An exclusive lock is held in place until this object goes out of scope. The lock is not recursive.
         //! Release this object as soon as you are done working with the navigation mesh.
         class LockGuard
         {
         public:
-            //! Grabs a lock on a mutex in @NavMeshQuery
+            //! Grabs an exclusive lock on a mutex in @NavMeshQuery
             //! @param navMesh navigation mesh to hold on to
             explicit LockGuard(NavMeshQuery& navMesh)
                 : m_lock(navMesh.m_mutex)
@@ -55,13 +66,73 @@ namespace RecastNavigation
             }
 
         private:
-            AZStd::lock_guard<AZStd::recursive_mutex> m_lock;
+            AZStd::lock_guard<AZStd::shared_mutex> m_lock;
             dtNavMesh* m_mesh = nullptr;
             dtNavMeshQuery* m_query = nullptr;
 
             AZ_DISABLE_COPY_MOVE(LockGuard);
         };
 
+        //! A lock guard class with read-only access to the navigation mesh.
+        //! Any number of shared locks can be held at the same time, while the navigation mesh can't be modified.
+        //! The query object of @NavMeshQuery isn't accessible, use a query object from @AcquireQuery instead.
+        class SharedLockGuard
+        {
+        public:
+            //! Grabs a shared lock on a mutex in @NavMeshQuery
+            //! @param navMesh navigation mesh to hold on to
+            explicit SharedLockGuard(NavMeshQuery& navMesh)
+                : m_lock(navMesh.m_mutex)
+                , m_mesh(navMesh.m_mesh.get())
+            {
+            }
+
+            //! Navigation mesh accessor.
+            const dtNavMesh* GetNavMesh() const
+            {
+                return m_mesh;
+            }
+
+        private:
+            AZStd::shared_lock<AZStd::shared_mutex> m_lock;
+            const dtNavMesh* m_mesh = nullptr;
+
+            AZ_DISABLE_COPY_MOVE(SharedLockGuard);
+        };
+
+        //! Takes a query object from the pool of this navigation mesh, or creates a new one if all of them are in use.
+        //! A query object keeps the state of a search, so each search that runs at the same time needs its own query object.
+        //! @returns a query object for this navigation mesh, or an empty pointer if one couldn't be created
+        RecastPointer<dtNavMeshQuery> AcquireQuery()
+        {
+            {
+                AZStd::lock_guard lock(m_queryPoolMutex);
+                if (!m_queryPool.empty())
+                {
+                    RecastPointer<dtNavMeshQuery> query = AZStd::move(m_queryPool.back());
+                    m_queryPool.pop_back();
+                    return query;
+                }
+            }
+
+            RecastPointer<dtNavMeshQuery> query(dtAllocNavMeshQuery());
+            if (!query || dtStatusFailed(query->init(m_mesh.get(), MaxQueryNodes)))
+            {
+                return {};
+            }
+            return query;
+        }
+
+        //! Returns a query object from @AcquireQuery to the pool.
+        void ReleaseQuery(RecastPointer<dtNavMeshQuery> query)
+        {
+            if (query)
+            {
+                AZStd::lock_guard lock(m_queryPoolMutex);
+                m_queryPool.push_back(AZStd::move(query));
+            }
+        }
+
     private:
         //! Recast navigation mesh object.
         RecastPointer<dtNavMesh> m_mesh;
@@ -70,6 +141,10 @@ namespace RecastNavigation
         RecastPointer<dtNavMeshQuery> m_query;
 
         //! A mutex for accessing and modifying the navigation mesh.
-        AZStd::recursive_mutex m_mutex;
+        AZStd::shared_mutex m_mutex;
+
+        //! Query objects that are not in use, see @AcquireQuery.
+        AZStd::vector<RecastPointer<dtNavMeshQuery>> m_queryPool;
+        AZStd::mutex m_queryPoolMutex;
     };
 } // namespace RecastNavigation
@@ -10,14 +10,38 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_template.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <RecastNavigation/NavMeshQuery.h>
 
 namespace RecastNavigation
 {
+    //! A request to find a path on a navigation mesh, see @RecastNavigationRequests::QueuePathQuery.
+    struct PathQueryRequest
+    {
+        //! The navigation mesh to find the path on.
+        AZStd::shared_ptr<NavMeshQuery> m_navMeshQuery;
+        AZ::Vector3 m_fromWorldPosition = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_toWorldPosition = AZ::Vector3::CreateZero();
+        //! Distance to use when finding the nearest points on the navigation mesh to the start and the end of the path.
+        float m_nearestDistance = 3.f;
+        //! Called on the main thread with the id of the request and the waypoints along the path, which are empty if no path was found.
+        AZStd::function<void(AZ::u64, const AZStd::vector<AZ::Vector3>&)> m_callback;
+    };
+
     class RecastNavigationRequests
     {
     public:
         AZ_RTTI(RecastNavigationRequests, "{d1c2f552-287d-4aa1-a5b8-5b234c9106f3}");
         virtual ~RecastNavigationRequests() = default;
+
+        //! Queues a path query. All the queries queued during a frame are processed in batches on the shared task executor.
+        //! Long paths are searched over several frames. The result is returned via @PathQueryRequest::m_callback.
+        //! @param request the path to find
+        //! @returns the id of the request, or 0 if the request isn't valid
+        virtual AZ::u64 QueuePathQuery(PathQueryRequest request) = 0;
     };
 
     class RecastNavigationBusTraits
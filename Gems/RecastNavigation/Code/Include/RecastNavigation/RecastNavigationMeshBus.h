@@ -10,6 +10,7 @@
 
 #include <DetourNavMesh.h>
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/Math/Aabb.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <RecastNavigation/NavMeshQuery.h>
 #include <RecastNavigation/RecastSmartPointer.h>
@@ -29,6 +30,13 @@ namespace RecastNavigation
         //! @returns false if another update operation is already in progress
         virtual bool UpdateNavigationMeshAsync() = 0;
 
+        //! Re-calculates only the tiles of the navigation mesh that overlap the given area, for example after a static obstacle moved.
+        //! Notifies when completed using @RecastNavigationMeshNotificationBus.
+        //! If another update operation is in progress, the area is re-calculated once that operation has finished.
+        //! @param dirtyArea the world area that has changed
+        //! @returns false if the area is not valid
+        virtual bool UpdateNavigationMeshAreaAsync(const AZ::Aabb& dirtyArea) = 0;
+
         //! @returns the underlying navigation objects with the associated synchronization object.
         virtual AZStd::shared_ptr<NavMeshQuery> GetNavigationObject() = 0;
     };
@@ -34,6 +34,16 @@ namespace RecastNavigation
         virtual bool CollectGeometryAsync(float tileSize, float borderSize,
             AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) = 0;
 
+        //! Collects the geometry (triangles) of the tiles that overlap @dirtyArea and returns the result via the callback @tileCallback.
+        //! The tiles are laid out the same way as the ones returned by @CollectGeometryAsync, so that they replace the same navigation tiles.
+        //! @param tileSize A navigation mesh is made up of tiles. Each tile is a square of the same size.
+        //! @param borderSize An additional extent in each dimension around each tile. Tiles whose border overlaps @dirtyArea are collected as well.
+        //! @param dirtyArea The world area that has changed.
+        //! @param tileCallback will be called once for each tile with geometry data and one last time to indicate the end of the operation with an empty shared_ptr
+        //! @returns true if an async operation was scheduled, false otherwise
+        virtual bool CollectGeometryWithinAreaAsync(float tileSize, float borderSize, const AZ::Aabb& dirtyArea,
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) = 0;
+
         //! A navigation mesh is made up of tiles. Each tile is a square of the same size.
         //! @param tileSize size of square tiles that make up a navigation mesh.
         //! @returns number of tiles that would be necessary to the cover the required area provided by @GetWorldBounds.
@@ -46,4 +56,18 @@ namespace RecastNavigation
 
     //! Request EBus for a navigation provider component that collects geometry data.
     using RecastNavigationProviderRequestBus = AZ::EBus<RecastNavigationProviderRequests>;
+
+    //! The interface for @RecastNavigationProviderNotificationBus.
+    class RecastNavigationProviderNotifications
+        : public AZ::ComponentBus
+    {
+    public:
+        //! Notifies that the geometry within a world area has changed, for example when a collider was added or removed there.
+        //! The navigation tiles over that area are out of date and can be re-calculated with @CollectGeometryWithinAreaAsync.
+        //! @param changedArea The world area that has changed.
+        virtual void OnGeometryChanged(const AZ::Aabb& changedArea) = 0;
+    };
+
+    //! Notification EBus for a navigation provider component, addressed by the entity of the provider.
+    using RecastNavigationProviderNotificationBus = AZ::EBus<RecastNavigationProviderNotifications>;
 } // namespace RecastNavigation
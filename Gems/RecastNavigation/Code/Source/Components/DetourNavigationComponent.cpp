@@ -10,7 +10,9 @@
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <Components/DetourNavigationComponent.h>
+#include <Misc/DetourPathQueryQueue.h>
 #include <RecastNavigation/RecastHelpers.h>
+#include <RecastNavigation/RecastNavigationBus.h>
 #include <RecastNavigation/RecastNavigationMeshBus.h>
 
 AZ_DECLARE_BUDGET(Navigation);
@@ -40,10 +42,19 @@ namespace RecastNavigation
                 ->Attribute(AZ::Script::Attributes::Category, "Recast Navigation")
                 ->Event("FindPathBetweenEntities", &DetourNavigationRequests::FindPathBetweenEntities)
                 ->Event("FindPathBetweenPositions", &DetourNavigationRequests::FindPathBetweenPositions)
+                ->Event("FindPathBetweenEntitiesAsync", &DetourNavigationRequests::FindPathBetweenEntitiesAsync)
+                ->Event("FindPathBetweenPositionsAsync", &DetourNavigationRequests::FindPathBetweenPositionsAsync)
                 ->Event("SetNavigationMeshEntity", &DetourNavigationRequests::SetNavigationMeshEntity)
                 ->Event("GetNavigationMeshEntity", &DetourNavigationRequests::GetNavigationMeshEntity)
                 ;
 
+            behaviorContext->EBus<DetourNavigationNotificationBus>("DetourNavigationNotificationBus")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "navigation")
+                ->Attribute(AZ::Script::Attributes::Category, "Recast Navigation")
+                ->Handler<DetourNavigationNotificationHandler>()
+                ;
+
             behaviorContext->Class<DetourNavigationComponent>()->RequestBus("DetourNavigationRequestBus");
         }
     }
@@ -73,73 +84,78 @@ namespace RecastNavigation
             return {};
         }
 
-        NavMeshQuery::LockGuard lock(*navMeshQuery);
-        if (!lock.GetNavQuery())
+        RecastPointer<dtNavMeshQuery> query = navMeshQuery->AcquireQuery();
+        if (!query)
         {
             return {};
         }
 
-        RecastVector3 startRecast = RecastVector3::CreateFromVector3SwapYZ(fromWorldPosition);
-        RecastVector3 endRecast = RecastVector3::CreateFromVector3SwapYZ(toWorldPosition);
-        const float halfExtents[3] = { m_nearestDistance, m_nearestDistance, m_nearestDistance };
-
-        dtPolyRef startPoly = 0, endPoly = 0;
-
-        RecastVector3 nearestStartPoint, nearestEndPoint;
-
-        const dtQueryFilter filter;
-
-        // Find nearest points on the navigation mesh given the positions provided.
-        // We are allowing some flexibility where looking for a point just a bit outside of the navigation mesh would still work.
-        dtStatus result = lock.GetNavQuery()->findNearestPoly(startRecast.GetData(), halfExtents, &filter, &startPoly, nearestStartPoint.GetData());
-        if (dtStatusFailed(result) || startPoly == 0)
+        AZStd::vector<AZ::Vector3> pathPoints;
         {
-            return {};
+            NavMeshQuery::SharedLockGuard lock(*navMeshQuery);
+
+            const dtQueryFilter filter;
+            PathEndpoints endpoints;
+
+            // Find nearest points on the navigation mesh given the positions provided.
+            if (FindPathEndpoints(*query, fromWorldPosition, toWorldPosition, m_nearestDistance, filter, endpoints))
+            {
+                AZStd::array<dtPolyRef, MaxPathLength> path;
+                int pathLength = 0;
+
+                // Find an approximate path first. In Recast, an approximate path is a collection of polygons, where a polygon covers an area.
+                const dtStatus result = query->findPath(endpoints.m_startPoly, endpoints.m_endPoly, endpoints.m_nearestStart.GetData(),
+                    endpoints.m_nearestEnd.GetData(), &filter, path.data(), &pathLength, MaxPathLength);
+                if (dtStatusSucceed(result))
+                {
+                    // Then the detailed path.
+                    pathPoints = FindStraightPath(*query, endpoints, path.data(), pathLength);
+                }
+            }
         }
 
-        result = lock.GetNavQuery()->findNearestPoly(endRecast.GetData(), halfExtents, &filter, &endPoly, nearestEndPoint.GetData());
-        if (dtStatusFailed(result) || endPoly == 0)
+        navMeshQuery->ReleaseQuery(AZStd::move(query));
+        return pathPoints;
+    }
+
+    AZ::u64 DetourNavigationComponent::FindPathBetweenEntitiesAsync(AZ::EntityId fromEntity, AZ::EntityId toEntity)
+    {
+        if (fromEntity.IsValid() && toEntity.IsValid())
         {
-            return {};
-        }
+            AZ::Vector3 start = AZ::Vector3::CreateZero(), end = AZ::Vector3::CreateZero();
+            AZ::TransformBus::EventResult(start, fromEntity, &AZ::TransformBus::Events::GetWorldTranslation);
+            AZ::TransformBus::EventResult(end, toEntity, &AZ::TransformBus::Events::GetWorldTranslation);
 
-        // Some reasonable amount of waypoints along the path. Recast isn't made to calculate very long paths.
-        constexpr int MaxPathLength = 100;
+            return FindPathBetweenPositionsAsync(start, end);
+        }
 
-        AZStd::array<dtPolyRef, MaxPathLength> path;
-        int pathLength = 0;
+        return 0;
+    }
 
-        // Find an approximate path first. In Recast, an approximate path is a collection of polygons, where a polygon covers an area.
-        result = lock.GetNavQuery()->findPath(startPoly, endPoly, nearestStartPoint.GetData(), nearestEndPoint.GetData(),
-            &filter, path.data(), &pathLength, MaxPathLength);
-        if (dtStatusFailed(result))
+    AZ::u64 DetourNavigationComponent::FindPathBetweenPositionsAsync(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition)
+    {
+        RecastNavigationRequests* recastNavigation = RecastNavigationInterface::Get();
+        if (!recastNavigation)
         {
-            return {};
+            return 0;
         }
 
-        AZStd::array<RecastVector3, MaxPathLength> detailedPath;
-        AZStd::array<AZ::u8, MaxPathLength> detailedPathFlags;
-        AZStd::array<dtPolyRef, MaxPathLength> detailedPolyPathRefs;
-        int detailedPathCount = 0;
-
-        // Then the detailed path. This gives us actual specific waypoints along the path over the polygons found earlier.
-        result = lock.GetNavQuery()->findStraightPath(startRecast.GetData(), endRecast.GetData(), path.data(), pathLength,
-            detailedPath[0].GetData(), detailedPathFlags.data(), detailedPolyPathRefs.data(),
-            &detailedPathCount, MaxPathLength, DT_STRAIGHTPATH_ALL_CROSSINGS);
-        if (dtStatusFailed(result))
+        PathQueryRequest request;
+        RecastNavigationMeshRequestBus::EventResult(request.m_navMeshQuery, m_navQueryEntityId, &RecastNavigationMeshRequests::GetNavigationObject);
+        if (!request.m_navMeshQuery)
         {
-            return {};
+            return 0;
         }
 
-        AZStd::vector<AZ::Vector3> pathPoints;
-        pathPoints.reserve(detailedPathCount);
-        // Note: Recast uses +Y, O3DE used +Z as up vectors.
-        for (int i = 0; i < detailedPathCount; ++i)
+        request.m_fromWorldPosition = fromWorldPosition;
+        request.m_toWorldPosition = toWorldPosition;
+        request.m_nearestDistance = m_nearestDistance;
+        request.m_callback = [entityId = GetEntityId()](AZ::u64 requestId, const AZStd::vector<AZ::Vector3>& waypoints)
         {
-            pathPoints.push_back(detailedPath[i].AsVector3WithZup());
-        }
+            DetourNavigationNotificationBus::Event(entityId, &DetourNavigationNotifications::OnPathFound, entityId, requestId, waypoints);
+        };
 
-        return pathPoints;
+        return recastNavigation->QueuePathQuery(AZStd::move(request));
     }
 
     void DetourNavigationComponent::SetNavigationMeshEntity(AZ::EntityId navMeshEntity)
@@ -152,6 +168,13 @@ namespace RecastNavigation
         return m_navQueryEntityId;
     }
 
+    AZ::Vector3 DetourNavigationComponent::GetAgentWorldPosition() const
+    {
+        AZ::Vector3 position = AZ::Vector3::CreateZero();
+        AZ::TransformBus::EventResult(position, GetEntityId(), &AZ::TransformBus::Events::GetWorldTranslation);
+        return position;
+    }
+
     void DetourNavigationComponent::Activate()
     {
         if (!m_navQueryEntityId.IsValid())
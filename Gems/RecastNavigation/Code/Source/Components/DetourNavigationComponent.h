@@ -34,8 +34,11 @@ namespace RecastNavigation
         //! @{
         AZStd::vector<AZ::Vector3> FindPathBetweenEntities(AZ::EntityId fromEntity, AZ::EntityId toEntity) override;
         AZStd::vector<AZ::Vector3> FindPathBetweenPositions(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) override;
+        AZ::u64 FindPathBetweenEntitiesAsync(AZ::EntityId fromEntity, AZ::EntityId toEntity) override;
+        AZ::u64 FindPathBetweenPositionsAsync(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) override;
         void SetNavigationMeshEntity(AZ::EntityId navMeshEntity) override;
         AZ::EntityId GetNavigationMeshEntity() const override;
+        AZ::Vector3 GetAgentWorldPosition() const override;
         //! @}
 
         //! AZ::Component overrides ...
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+#include <Misc/DetourPathQueryQueue.h>
+
+AZ_CVAR(
+    AZ::u32, bg_navmesh_pathQueriesPerTask, 16, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Number of path queries each task processes when finding the paths requested during a frame");
+AZ_CVAR(
+    int, bg_navmesh_pathIterationsPerFrame, 512, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Maximum number of search iterations of a single path query per frame. Longer paths continue in the next frame");
+
+AZ_DECLARE_BUDGET(Navigation);
+
+namespace RecastNavigation
+{
+    bool FindPathEndpoints(dtNavMeshQuery& query, const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition,
+        float nearestDistance, const dtQueryFilter& filter, PathEndpoints& endpoints)
+    {
+        endpoints.m_start = RecastVector3::CreateFromVector3SwapYZ(fromWorldPosition);
+        endpoints.m_end = RecastVector3::CreateFromVector3SwapYZ(toWorldPosition);
+        const float halfExtents[3] = { nearestDistance, nearestDistance, nearestDistance };
+
+        dtStatus result = query.findNearestPoly(endpoints.m_start.GetData(), halfExtents, &filter,
+            &endpoints.m_startPoly, endpoints.m_nearestStart.GetData());
+        if (dtStatusFailed(result) || endpoints.m_startPoly == 0)
+        {
+            return false;
+        }
+
+        result = query.findNearestPoly(endpoints.m_end.GetData(), halfExtents, &filter,
+            &endpoints.m_endPoly, endpoints.m_nearestEnd.GetData());
+        if (dtStatusFailed(result) || endpoints.m_endPoly == 0)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    AZStd::vector<AZ::Vector3> FindStraightPath(dtNavMeshQuery& query, PathEndpoints& endpoints, const dtPolyRef* polygons, int polygonCount)
+    {
+        AZStd::array<RecastVector3, MaxPathLength> detailedPath;
+        AZStd::array<AZ::u8, MaxPathLength> detailedPathFlags;
+        AZStd::array<dtPolyRef, MaxPathLength> detailedPolyPathRefs;
+        int detailedPathCount = 0;
+
+        // This gives us actual specific waypoints along the path over the polygons found earlier.
+        const dtStatus result = query.findStraightPath(endpoints.m_start.GetData(), endpoints.m_end.GetData(), polygons, polygonCount,
+            detailedPath[0].GetData(), detailedPathFlags.data(), detailedPolyPathRefs.data(),
+            &detailedPathCount, MaxPathLength, DT_STRAIGHTPATH_ALL_CROSSINGS);
+        if (dtStatusFailed(result))
+        {
+            return {};
+        }
+
+        AZStd::vector<AZ::Vector3> pathPoints;
+        pathPoints.reserve(detailedPathCount);
+        // Note: Recast uses +Y, O3DE used +Z as up vectors.
+        for (int i = 0; i < detailedPathCount; ++i)
+        {
+            pathPoints.push_back(detailedPath[i].AsVector3WithZup());
+        }
+
+        return pathPoints;
+    }
+
+    DetourPathQueryQueue::~DetourPathQueryQueue()
+    {
+        Clear();
+    }
+
+    AZ::u64 DetourPathQueryQueue::QueuePathQuery(PathQueryRequest request)
+    {
+        if (!request.m_navMeshQuery || !request.m_callback)
+        {
+            return 0;
+        }
+
+        AZStd::unique_ptr<PathQuery> pathQuery = AZStd::make_unique<PathQuery>();
+        pathQuery->m_requestId = m_nextRequestId++;
+        pathQuery->m_request = AZStd::move(request);
+        const AZ::u64 requestId = pathQuery->m_requestId;
+
+        AZStd::lock_guard lock(m_queuedQueriesMutex);
+        m_queuedQueries.push_back(AZStd::move(pathQuery));
+        return requestId;
+    }
+
+    void DetourPathQueryQueue::Update()
+    {
+        if (m_taskGraphEvent && !m_taskGraphEvent->IsSignaled())
+        {
+            // The previous batch is still running, its results are delivered once it has finished.
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: DetourPathQueryQueue::Update");
+
+        // Deliver the finished queries and keep the ones that continue searching in this frame.
+        const auto finishedBegin = AZStd::stable_partition(m_activeQueries.begin(), m_activeQueries.end(),
+            [](const AZStd::unique_ptr<PathQuery>& pathQuery)
+            {
+                return !pathQuery->m_finished;
+            });
+
+        AZStd::vector<AZStd::unique_ptr<PathQuery>> finishedQueries(
+            AZStd::make_move_iterator(finishedBegin), AZStd::make_move_iterator(m_activeQueries.end()));
+        m_activeQueries.erase(finishedBegin, m_activeQueries.end());
+
+        {
+            AZStd::lock_guard lock(m_queuedQueriesMutex);
+            m_activeQueries.insert(m_activeQueries.end(),
+                AZStd::make_move_iterator(m_queuedQueries.begin()), AZStd::make_move_iterator(m_queuedQueries.end()));
+            m_queuedQueries.clear();
+        }
+
+        if (!m_activeQueries.empty())
+        {
+            m_taskGraphEvent = AZStd::make_unique<AZ::TaskGraphEvent>("RecastNavigation Path Queries Wait");
+            m_taskGraph.Reset();
+
+            const size_t queriesPerTask = AZStd::max<size_t>(bg_navmesh_pathQueriesPerTask, 1);
+            for (size_t begin = 0; begin < m_activeQueries.size(); begin += queriesPerTask)
+            {
+                const size_t end = AZStd::min(begin + queriesPerTask, m_activeQueries.size());
+                m_taskGraph.AddTask(
+                    m_taskDescriptor, [this, begin, end]()
+                    {
+                        AZ_PROFILE_SCOPE(Navigation, "Navigation: task - finding paths");
+
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            ProcessQuery(*m_activeQueries[i]);
+                        }
+                    });
+            }
+
+            m_taskGraph.Submit(m_taskGraphEvent.get());
+        }
+
+        // The callbacks are free to queue new queries, which are started in the next frame.
+        for (AZStd::unique_ptr<PathQuery>& pathQuery : finishedQueries)
+        {
+            pathQuery->m_request.m_navMeshQuery->ReleaseQuery(AZStd::move(pathQuery->m_query));
+            pathQuery->m_request.m_callback(pathQuery->m_requestId, pathQuery->m_waypoints);
+        }
+    }
+
+    void DetourPathQueryQueue::Clear()
+    {
+        if (m_taskGraphEvent && !m_taskGraphEvent->IsSignaled())
+        {
+            m_taskGraphEvent->Wait();
+        }
+        m_taskGraphEvent.reset();
+
+        m_activeQueries.clear();
+
+        AZStd::lock_guard lock(m_queuedQueriesMutex);
+        m_queuedQueries.clear();
+    }
+
+    void DetourPathQueryQueue::ProcessQuery(PathQuery& pathQuery)
+    {
+        NavMeshQuery& navMeshQuery = *pathQuery.m_request.m_navMeshQuery;
+        if (!pathQuery.m_query)
+        {
+            pathQuery.m_query = navMeshQuery.AcquireQuery();
+            if (!pathQuery.m_query)
+            {
+                pathQuery.m_finished = true;
+                return;
+            }
+        }
+
+        dtNavMeshQuery& query = *pathQuery.m_query;
+        NavMeshQuery::SharedLockGuard lock(navMeshQuery);
+
+        if (!pathQuery.m_started)
+        {
+            if (!FindPathEndpoints(query, pathQuery.m_request.m_fromWorldPosition, pathQuery.m_request.m_toWorldPosition,
+                pathQuery.m_request.m_nearestDistance, pathQuery.m_filter, pathQuery.m_endpoints))
+            {
+                pathQuery.m_finished = true;
+                return;
+            }
+
+            // Find an approximate path first. In Recast, an approximate path is a collection of polygons, where a polygon covers an area.
+            const dtStatus result = query.initSlicedFindPath(pathQuery.m_endpoints.m_startPoly, pathQuery.m_endpoints.m_endPoly,
+                pathQuery.m_endpoints.m_nearestStart.GetData(), pathQuery.m_endpoints.m_nearestEnd.GetData(), &pathQuery.m_filter);
+            if (dtStatusFailed(result))
+            {
+                pathQuery.m_finished = true;
+                return;
+            }
+            pathQuery.m_started = true;
+        }
+
+        // The search fails if the navigation mesh has changed under it since the previous slice.
+        const dtStatus result = query.updateSlicedFindPath(bg_navmesh_pathIterationsPerFrame, nullptr);
+        if (dtStatusInProgress(result))
+        {
+            return;
+        }
+
+        pathQuery.m_finished = true;
+        if (dtStatusFailed(result))
+        {
+            return;
+        }
+
+        AZStd::array<dtPolyRef, MaxPathLength> path;
+        int pathLength = 0;
+        if (dtStatusFailed(query.finalizeSlicedFindPath(path.data(), &pathLength, MaxPathLength)))
+        {
+            return;
+        }
+
+        // Then the detailed path.
+        pathQuery.m_waypoints = FindStraightPath(query, pathQuery.m_endpoints, path.data(), pathLength);
+    }
+} // namespace RecastNavigation
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <DetourNavMeshQuery.h>
+#include <AzCore/Task/TaskDescriptor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <RecastNavigation/RecastHelpers.h>
+#include <RecastNavigation/RecastNavigationBus.h>
+
+namespace RecastNavigation
+{
+    //! Some reasonable amount of waypoints along the path. Recast isn't made to calculate very long paths.
+    constexpr int MaxPathLength = 100;
+
+    //! The start and the end of a path, snapped to the navigation mesh.
+    struct PathEndpoints
+    {
+        RecastVector3 m_start;
+        RecastVector3 m_end;
+        RecastVector3 m_nearestStart;
+        RecastVector3 m_nearestEnd;
+        dtPolyRef m_startPoly = 0;
+        dtPolyRef m_endPoly = 0;
+    };
+
+    //! Finds the nearest points on the navigation mesh to the given positions.
+    //! We are allowing some flexibility where looking for a point just a bit outside of the navigation mesh would still work.
+    //! @param query the query object to search with
+    //! @param fromWorldPosition the starting point of the path
+    //! @param toWorldPosition the end point of the path
+    //! @param nearestDistance the distance around the positions to look for the navigation mesh
+    //! @param filter the polygons to consider
+    //! @param endpoints (out) the start and the end of the path on the navigation mesh
+    //! @return true if both points were found on the navigation mesh
+    bool FindPathEndpoints(dtNavMeshQuery& query, const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition,
+        float nearestDistance, const dtQueryFilter& filter, PathEndpoints& endpoints);
+
+    //! Finds the waypoints along a path of polygons.
+    //! @param query the query object to search with
+    //! @param endpoints the start and the end of the path
+    //! @param polygons the polygons along the path, as found by dtNavMeshQuery::findPath
+    //! @param polygonCount the number of polygons in @polygons
+    //! @return the waypoints in O3DE coordinates, empty if the path failed
+    AZStd::vector<AZ::Vector3> FindStraightPath(dtNavMeshQuery& query, PathEndpoints& endpoints, const dtPolyRef* polygons, int polygonCount);
+
+    //! Processes the path queries of all the agents in batches on the shared task executor.
+    //! The queries queued during a frame are started on the next @Update and split into tasks of a few queries each.
+    //! Each query searches with its own query object from the pool of its navigation mesh, while holding a shared lock,
+    //! so the queries run in parallel with each other and only wait on updates of the navigation mesh.
+    //! Long paths are searched in slices of a limited number of iterations per frame, so they don't hold up the whole batch.
+    class DetourPathQueryQueue
+    {
+    public:
+        DetourPathQueryQueue() = default;
+        ~DetourPathQueryQueue();
+
+        //! Queues a path query, it can be called from any thread.
+        //! @returns the id of the request, or 0 if the request isn't valid
+        AZ::u64 QueuePathQuery(PathQueryRequest request);
+
+        //! Delivers the results of the finished queries and starts processing the queued and the unfinished ones.
+        //! Should be called once a frame from the main thread. If the previous batch is still running, nothing is done until it finishes.
+        void Update();
+
+        //! Waits for the current batch to finish and removes all the queries, without delivering their results.
+        void Clear();
+
+    private:
+        struct PathQuery
+        {
+            AZ::u64 m_requestId = 0;
+            PathQueryRequest m_request;
+
+            //! The query object keeps the state of a sliced search between frames.
+            RecastPointer<dtNavMeshQuery> m_query;
+            dtQueryFilter m_filter;
+            PathEndpoints m_endpoints;
+            bool m_started = false;
+            bool m_finished = false;
+            AZStd::vector<AZ::Vector3> m_waypoints;
+        };
+
+        //! Runs one slice of a query, it's called from a task.
+        void ProcessQuery(PathQuery& pathQuery);
+
+        //! Queries that were queued since the last @Update.
+        AZStd::vector<AZStd::unique_ptr<PathQuery>> m_queuedQueries;
+        AZStd::mutex m_queuedQueriesMutex;
+
+        //! Queries that are processed by the current batch. Only modified on the main thread while no batch is running.
+        AZStd::vector<AZStd::unique_ptr<PathQuery>> m_activeQueries;
+
+        AZStd::atomic<AZ::u64> m_nextRequestId{ 1 };
+
+        //! Task graph objects to process the active queries in batches.
+        AZ::TaskGraph m_taskGraph{ "RecastNavigation Path Queries" };
+        AZStd::unique_ptr<AZ::TaskGraphEvent> m_taskGraphEvent;
+        AZ::TaskDescriptor m_taskDescriptor{ "Find Paths", "Recast Navigation" };
+    };
+} // namespace RecastNavigation
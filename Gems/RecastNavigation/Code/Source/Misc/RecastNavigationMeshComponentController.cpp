@@ -12,10 +12,14 @@
 #include <DetourNavMeshBuilder.h>
 #include <AzCore/Console/Console.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
 #include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <Misc/RecastNavigationMeshComponentController.h>
+#include <RecastNavigation/DetourNavigationBus.h>
 #include <RecastNavigation/RecastNavigationProviderBus.h>
 
 AZ_DEFINE_BUDGET(Navigation);
@@ -26,9 +30,6 @@ AZ_CVAR(
 AZ_CVAR(
     float, cl_navmesh_debugRadius, 25.f, nullptr, AZ::ConsoleFunctorFlags::Null,
     "Limit debug draw to within a specified distance from the active camera");
-AZ_CVAR(
-    AZ::u32, bg_navmesh_threads, 2, nullptr, AZ::ConsoleFunctorFlags::Null,
-    "Number of threads to use to process tiles for each RecastNavigationMeshComponentController");
 
 namespace RecastNavigation
 {
@@ -69,6 +70,12 @@ namespace RecastNavigation
             return false;
         }
 
+        {
+            // The whole navigation mesh is re-calculated, which includes any area that was marked as changed.
+            AZStd::lock_guard lock(m_tileProcessingMutex);
+            m_dirtyArea = AZ::Aabb::CreateNull();
+        }
+
         AZStd::vector<AZStd::shared_ptr<TileGeometry>> tiles;
 
         // Blocking call.
@@ -79,33 +86,9 @@ namespace RecastNavigation
         RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
             &RecastNavigationMeshNotificationBus::Events::OnNavigationMeshBeganRecalculating, m_entityComponentIdPair.GetEntityId());
 
+        for (const AZStd::shared_ptr<TileGeometry>& tile : tiles)
         {
-            for (AZStd::shared_ptr<TileGeometry>& tile : tiles)
-            {
-                {
-                    NavMeshQuery::LockGuard lock(*m_navObject);
-                    // If a tile at the location already exists, remove it before updating the data.
-                    if (const dtTileRef tileRef = lock.GetNavMesh()->getTileRefAt(tile->m_tileX, tile->m_tileY, 0))
-                    {
-                        lock.GetNavMesh()->removeTile(tileRef, nullptr, nullptr);
-                    }
-                }
-
-                if (tile->IsEmpty())
-                {
-                    continue;
-                }
-
-                // Given geometry create Recast tile structure.
-                NavigationTileData navigationTileData = CreateNavigationTile(tile.get(),
-                    m_configuration, m_context.get());
-
-                // A tile might have no geometry at all if no objects were found there.
-                if (navigationTileData.IsValid())
-                {
-                    AttachNavigationTileToMesh(navigationTileData);
-                }
-            }
+            UpdateNavigationTile(tile, m_configuration);
         }
 
         RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
@@ -121,6 +104,13 @@ namespace RecastNavigation
         {
             AZ_PROFILE_SCOPE(Navigation, "Navigation: UpdateNavigationMeshAsync");
 
+            // The whole navigation mesh is re-calculated, which includes any area that was marked as changed.
+            AZ::Aabb dirtyArea = AZ::Aabb::CreateNull();
+            {
+                AZStd::lock_guard lock(m_tileProcessingMutex);
+                AZStd::swap(dirtyArea, m_dirtyArea);
+            }
+
             bool operationScheduled = false;
             RecastNavigationProviderRequestBus::EventResult(operationScheduled, m_entityComponentIdPair.GetEntityId(),
                 &RecastNavigationProviderRequests::CollectGeometryAsync,
@@ -132,6 +122,8 @@ namespace RecastNavigation
 
             if (!operationScheduled)
             {
+                AZStd::lock_guard lock(m_tileProcessingMutex);
+                m_dirtyArea.AddAabb(dirtyArea);
                 m_updateInProgress = false;
                 return false;
             }
@@ -141,11 +133,81 @@ namespace RecastNavigation
         return false;
     }
 
+    bool RecastNavigationMeshComponentController::UpdateNavigationMeshAreaAsync(const AZ::Aabb& dirtyArea)
+    {
+        if (!dirtyArea.IsValid())
+        {
+            return false;
+        }
+
+        {
+            AZStd::lock_guard lock(m_tileProcessingMutex);
+            m_dirtyArea.AddAabb(dirtyArea);
+        }
+
+        // If another update is in progress, the area is picked up once it has finished, see @OnSendNotificationTick.
+        UpdateDirtyArea();
+        return true;
+    }
+
+    void RecastNavigationMeshComponentController::UpdateDirtyArea()
+    {
+        bool notInProgress = false;
+        if (!m_updateInProgress.compare_exchange_strong(notInProgress, true))
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: UpdateDirtyArea");
+
+        AZ::Aabb dirtyArea = AZ::Aabb::CreateNull();
+        {
+            AZStd::lock_guard lock(m_tileProcessingMutex);
+            AZStd::swap(dirtyArea, m_dirtyArea);
+        }
+
+        if (!dirtyArea.IsValid())
+        {
+            m_updateInProgress = false;
+            return;
+        }
+
+        bool operationScheduled = false;
+        RecastNavigationProviderRequestBus::EventResult(operationScheduled, m_entityComponentIdPair.GetEntityId(),
+            &RecastNavigationProviderRequests::CollectGeometryWithinAreaAsync,
+            m_configuration.m_tileSize, aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize, dirtyArea,
+            [this](AZStd::shared_ptr<TileGeometry> tile)
+            {
+                OnTileProcessedEvent(tile);
+            });
+
+        if (!operationScheduled)
+        {
+            AZStd::lock_guard lock(m_tileProcessingMutex);
+            m_dirtyArea.AddAabb(dirtyArea);
+            m_updateInProgress = false;
+        }
+    }
+
     AZStd::shared_ptr<NavMeshQuery> RecastNavigationMeshComponentController::GetNavigationObject()
     {
         return m_navObject;
     }
 
+    void RecastNavigationMeshComponentController::OnGeometryChanged(const AZ::Aabb& changedArea)
+    {
+        {
+            // Nothing to re-calculate until the navigation mesh has been built.
+            AZStd::lock_guard lock(m_tileGeometryCacheMutex);
+            if (m_tileGeometryCache.empty())
+            {
+                return;
+            }
+        }
+
+        UpdateNavigationMeshAreaAsync(changedArea);
+    }
+
     void RecastNavigationMeshComponentController::Activate(const AZ::EntityComponentIdPair& entityComponentIdPair)
     {
         m_entityComponentIdPair = entityComponentIdPair;
@@ -161,6 +223,7 @@ namespace RecastNavigation
         }
 
         RecastNavigationMeshRequestBus::Handler::BusConnect(m_entityComponentIdPair.GetEntityId());
+        RecastNavigationProviderNotificationBus::Handler::BusConnect(m_entityComponentIdPair.GetEntityId());
         m_shouldProcessTiles = true;
     }
 
@@ -183,12 +246,26 @@ namespace RecastNavigation
         m_taskGraphEvent.reset();
         m_updateInProgress = false;
 
+        {
+            AZStd::lock_guard lock(m_tileProcessingMutex);
+            m_dirtyArea = AZ::Aabb::CreateNull();
+        }
+        {
+            AZStd::lock_guard lock(m_tileGeometryCacheMutex);
+            m_tileGeometryCache.clear();
+        }
+
+        RecastNavigationProviderNotificationBus::Handler::BusDisconnect();
         RecastNavigationMeshRequestBus::Handler::BusDisconnect();
     }
 
     void RecastNavigationMeshComponentController::SetConfiguration(const RecastNavigationMeshConfig& config)
     {
         m_configuration = config;
+
+        // The cached tiles were built with the previous configuration.
+        AZStd::lock_guard lock(m_tileGeometryCacheMutex);
+        m_tileGeometryCache.clear();
     }
 
     const RecastNavigationMeshConfig& RecastNavigationMeshComponentController::GetConfiguration() const
@@ -203,6 +280,9 @@ namespace RecastNavigation
             RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
                 &RecastNavigationMeshNotifications::OnNavigationMeshUpdated, m_entityComponentIdPair.GetEntityId());
             m_updateInProgress = false;
+
+            // Re-calculate the area that changed while this update was in progress.
+            UpdateDirtyArea();
         }
     }
 
@@ -303,14 +383,8 @@ namespace RecastNavigation
         return recast.CreateDetourData(geom, meshConfig);
     }
 
-    RecastNavigationMeshComponentController::RecastNavigationMeshComponentController()
-        : m_taskExecutor(bg_navmesh_threads)
-    {
-    }
-
     RecastNavigationMeshComponentController::RecastNavigationMeshComponentController(const RecastNavigationMeshConfig& config)
         : m_configuration(config)
-        , m_taskExecutor(bg_navmesh_threads)
     {
     }
 
@@ -348,7 +422,7 @@ namespace RecastNavigation
 
         RecastPointer<dtNavMeshQuery> navQuery(dtAllocNavMeshQuery());
 
-        status = navQuery->init(navMesh.get(), 2048);
+        status = navQuery->init(navMesh.get(), NavMeshQuery::MaxQueryNodes);
         if (dtStatusFailed(status))
         {
             AZ_Error("Navigation", false, "Could not init Detour navmesh query");
@@ -369,6 +443,12 @@ namespace RecastNavigation
         m_shouldProcessTiles = false;
         m_updateInProgress = false;
 
+        {
+            // The new navigation mesh doesn't have any tiles yet.
+            AZStd::lock_guard lock(m_tileGeometryCacheMutex);
+            m_tileGeometryCache.clear();
+        }
+
         return true;
     }
 
@@ -391,6 +471,120 @@ namespace RecastNavigation
         return true;
     }
 
+    // Recast builds the same navigation tile from the same input, so a tile only needs to be rebuilt when its input has changed.
+    static bool HasSameGeometry(const TileGeometry& lhs, const TileGeometry& rhs)
+    {
+        return lhs.m_worldBounds == rhs.m_worldBounds
+            && lhs.m_indices == rhs.m_indices
+            && AZStd::equal(lhs.m_vertices.begin(), lhs.m_vertices.end(), rhs.m_vertices.begin(), rhs.m_vertices.end(),
+                [](const RecastVector3& a, const RecastVector3& b)
+                {
+                    return a.m_xyz[0] == b.m_xyz[0] && a.m_xyz[1] == b.m_xyz[1] && a.m_xyz[2] == b.m_xyz[2];
+                });
+    }
+
+    bool RecastNavigationMeshComponentController::UpdateTileGeometryCache(const AZStd::shared_ptr<TileGeometry>& tile)
+    {
+        const AZ::u64 tileKey = (aznumeric_cast<AZ::u64>(aznumeric_cast<AZ::u32>(tile->m_tileY)) << 32) | aznumeric_cast<AZ::u32>(tile->m_tileX);
+
+        AZStd::shared_ptr<TileGeometry> cachedTile;
+        {
+            AZStd::lock_guard lock(m_tileGeometryCacheMutex);
+            AZStd::shared_ptr<TileGeometry>& cacheEntry = m_tileGeometryCache[tileKey];
+            cachedTile = AZStd::move(cacheEntry);
+            cacheEntry = tile;
+        }
+
+        // The provider might return the very same geometry it cached for the tile.
+        return !cachedTile || (cachedTile != tile && !HasSameGeometry(*cachedTile, *tile));
+    }
+
+    void RecastNavigationMeshComponentController::UpdateNavigationTile(
+        const AZStd::shared_ptr<TileGeometry>& tile, const RecastNavigationMeshConfig& meshConfig)
+    {
+        if (!UpdateTileGeometryCache(tile))
+        {
+            // The tile in the navigation mesh was already built from the same geometry.
+            return;
+        }
+
+        // Given geometry create Recast tile structure. A tile might have no geometry at all if no objects were found there.
+        NavigationTileData navigationTileData;
+        if (!tile->IsEmpty())
+        {
+            navigationTileData = CreateNavigationTile(tile.get(), meshConfig, m_context.get());
+        }
+
+        {
+            NavMeshQuery::LockGuard lock(*m_navObject);
+            // If a tile at the location already exists, remove it before updating the data.
+            if (const dtTileRef tileRef = lock.GetNavMesh()->getTileRefAt(tile->m_tileX, tile->m_tileY, 0))
+            {
+                lock.GetNavMesh()->removeTile(tileRef, nullptr, nullptr);
+            }
+        }
+
+        if (navigationTileData.IsValid())
+        {
+            AttachNavigationTileToMesh(navigationTileData);
+        }
+    }
+
+    size_t RecastNavigationMeshComponentController::SortTilesByPriority(AZStd::vector<AZStd::shared_ptr<TileGeometry>>& tiles) const
+    {
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: SortTilesByPriority");
+
+        AZStd::vector<AZ::Vector3> agentPositions;
+        const AZ::EntityId meshEntityId = m_entityComponentIdPair.GetEntityId();
+        DetourNavigationRequestBus::EnumerateHandlers([&agentPositions, meshEntityId](DetourNavigationRequests* agent)
+            {
+                if (agent->GetNavigationMeshEntity() == meshEntityId)
+                {
+                    agentPositions.push_back(agent->GetAgentWorldPosition());
+                }
+                return true;
+            });
+
+        if (agentPositions.empty())
+        {
+            // Without any agents, such as in the Editor, the tiles around the active camera are the ones looked at.
+            AZ::Transform cameraTransform = AZ::Transform::CreateIdentity();
+            Camera::ActiveCameraRequestBus::BroadcastResult(cameraTransform, &Camera::ActiveCameraRequestBus::Events::GetActiveCameraTransform);
+            agentPositions.push_back(cameraTransform.GetTranslation());
+        }
+
+        AZStd::vector<AZStd::pair<float, AZStd::shared_ptr<TileGeometry>>> tilesByDistance;
+        tilesByDistance.reserve(tiles.size());
+        for (AZStd::shared_ptr<TileGeometry>& tile : tiles)
+        {
+            float closestDistanceSq = AZStd::numeric_limits<float>::max();
+            for (const AZ::Vector3& position : agentPositions)
+            {
+                closestDistanceSq = AZStd::min(closestDistanceSq, tile->m_worldBounds.GetDistanceSq(position));
+            }
+            tilesByDistance.emplace_back(closestDistanceSq, AZStd::move(tile));
+        }
+
+        AZStd::sort(tilesByDistance.begin(), tilesByDistance.end(),
+            [](const AZStd::pair<float, AZStd::shared_ptr<TileGeometry>>& lhs, const AZStd::pair<float, AZStd::shared_ptr<TileGeometry>>& rhs)
+            {
+                return lhs.first < rhs.first;
+            });
+
+        const float priorityDistanceSq = m_configuration.m_tileSize * m_configuration.m_tileSize;
+        size_t numPriorityTiles = 0;
+        for (size_t i = 0; i < tilesByDistance.size(); ++i)
+        {
+            if (tilesByDistance[i].first <= priorityDistanceSq)
+            {
+                ++numPriorityTiles;
+            }
+            tiles[i] = AZStd::move(tilesByDistance[i].second);
+        }
+
+        return numPriorityTiles;
+    }
+
     void RecastNavigationMeshComponentController::ReceivedAllNewTilesImpl(const RecastNavigationMeshConfig& config, AZ::ScheduledEvent& sendNotificationEvent)
     {
         if (m_shouldProcessTiles && (!m_taskGraphEvent || m_taskGraphEvent->IsSignaled()))
@@ -408,11 +602,15 @@ namespace RecastNavigation
                 m_tilesToBeProcessed.swap(tilesToBeProcessed);
             }
 
+            // Process the tiles around the agents first, those are the ones that are needed right away.
+            const size_t numPriorityTiles = SortTilesByPriority(tilesToBeProcessed);
+
             // Create tasks for each tile and a finish task.
-            for (AZStd::shared_ptr<TileGeometry> tile : tilesToBeProcessed)
+            for (size_t i = 0; i < tilesToBeProcessed.size(); ++i)
             {
                 AZ::TaskToken token = m_taskGraph.AddTask(
-                    m_taskDescriptor, [this, tile, &config]()
+                    i < numPriorityTiles ? m_priorityTaskDescriptor : m_taskDescriptor,
+                    [this, tile = tilesToBeProcessed[i], &config]()
                     {
                         if (!m_shouldProcessTiles)
                         {
@@ -420,27 +618,7 @@ namespace RecastNavigation
                         }
 
                         AZ_PROFILE_SCOPE(Navigation, "Navigation: task - computing tile");
-
-                        NavigationTileData navigationTileData = CreateNavigationTile(tile.get(),
-                            config, m_context.get());
-
-                        {
-                            NavMeshQuery::LockGuard lock(*m_navObject);
-                            if (const dtTileRef tileRef = lock.GetNavMesh()->getTileRefAt(tile->m_tileX, tile->m_tileY, 0))
-                            {
-                                lock.GetNavMesh()->removeTile(tileRef, nullptr, nullptr);
-                            }
-                        }
-
-                        if (navigationTileData.IsValid())
-                        {
-                            AZ_PROFILE_SCOPE(Navigation, "Navigation: UpdateNavigationMeshAsync - tile callback");
-
-                            if (navigationTileData.IsValid())
-                            {
-                                AttachNavigationTileToMesh(navigationTileData);
-                            }
-                        }
+                        UpdateNavigationTile(tile, config);
                     });
 
                 tileTaskTokens.push_back(AZStd::move(token));
@@ -457,7 +635,7 @@ namespace RecastNavigation
                 task.Precedes(finishToken);
             }
 
-            m_taskGraph.SubmitOnExecutor(m_taskExecutor, m_taskGraphEvent.get());
+            m_taskGraph.Submit(m_taskGraphEvent.get());
 
             RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
                 &RecastNavigationMeshNotificationBus::Events::OnNavigationMeshBeganRecalculating, m_entityComponentIdPair.GetEntityId());
@@ -12,13 +12,15 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/Task/TaskDescriptor.h>
-#include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
 #include <RecastNavigation/RecastHelpers.h>
 #include <Misc/RecastNavigationDebugDraw.h>
 #include <Misc/RecastNavigationMeshConfig.h>
 #include <RecastNavigation/RecastNavigationMeshBus.h>
+#include <RecastNavigation/RecastNavigationProviderBus.h>
 
 namespace RecastNavigation
 {
@@ -26,13 +28,14 @@ namespace RecastNavigation
     //! The method provided are not thread-safe. Use the mutex from @m_navObject to synchronize as necessary at the higher level.
     class RecastNavigationMeshComponentController
         : public RecastNavigationMeshRequestBus::Handler
+        , public RecastNavigationProviderNotificationBus::Handler
     {
         friend class EditorRecastNavigationMeshComponent;
     public:
         AZ_CLASS_ALLOCATOR(RecastNavigationMeshComponentController, AZ::SystemAllocator, 0);
         AZ_RTTI(RecastNavigationMeshComponentController, "{D34CD5E0-8C29-4545-8734-9C7A92F03740}");
 
-        RecastNavigationMeshComponentController();
+        RecastNavigationMeshComponentController() = default;
         explicit RecastNavigationMeshComponentController(const RecastNavigationMeshConfig& config);
         ~RecastNavigationMeshComponentController() override = default;
 
@@ -63,7 +66,14 @@ namespace RecastNavigation
         //! @returns the tile data that can be attached to the navigation mesh using @AttachNavigationTileToMesh
         NavigationTileData CreateNavigationTile(TileGeometry* geom, const RecastNavigationMeshConfig& meshConfig, rcContext* context);
 
+        //! Rebuilds a navigation tile from the given geometry and replaces the existing tile at the same location.
+        //! Tiles whose geometry did not change since they were last built are skipped.
+        //! @param tile the geometry of the tile
+        //! @param meshConfig Recast navigation mesh configuration.
+        void UpdateNavigationTile(const AZStd::shared_ptr<TileGeometry>& tile, const RecastNavigationMeshConfig& meshConfig);
+
         //! Creates a task graph with tasks to process received tile data.
+        //! The tiles closest to the agents of this navigation mesh are processed first.
         //! @param config navigation mesh configuration to apply to the tile data
         //! @param sendNotificationEvent once all the tiles are processed and added to the navigation update notify on the main thread
         void ReceivedAllNewTilesImpl(const RecastNavigationMeshConfig& config, AZ::ScheduledEvent& sendNotificationEvent);
@@ -72,9 +82,15 @@ namespace RecastNavigation
         //! @{
         bool UpdateNavigationMeshBlockUntilCompleted() override;
         bool UpdateNavigationMeshAsync() override;
+        bool UpdateNavigationMeshAreaAsync(const AZ::Aabb& dirtyArea) override;
         AZStd::shared_ptr<NavMeshQuery> GetNavigationObject() override;
         //! @}
 
+        //! RecastNavigationProviderNotificationBus overrides ...
+        //! @{
+        void OnGeometryChanged(const AZ::Aabb& changedArea) override;
+        //! @}
+
     protected:
         AZ::EntityComponentIdPair m_entityComponentIdPair;
 
@@ -102,7 +118,19 @@ namespace RecastNavigation
         AZ::ScheduledEvent m_receivedAllNewTilesEvent{ [this]() { OnReceivedAllNewTiles(); }, AZ::Name("RecastNavigationReceivedTiles") };
 
         void OnTileProcessedEvent(AZStd::shared_ptr<TileGeometry> tile);
-    
+
+        //! Starts an async update of the tiles within @m_dirtyArea, unless another update operation is in progress.
+        void UpdateDirtyArea();
+
+        //! Stores the geometry of a tile in @m_tileGeometryCache.
+        //! @returns false if the cache already had the same geometry for that tile, so the tile doesn't need to be rebuilt.
+        bool UpdateTileGeometryCache(const AZStd::shared_ptr<TileGeometry>& tile);
+
+        //! Sorts the tiles by their distance to the agents of this navigation mesh, or to the active camera if there are none.
+        //! @param tiles the tiles to sort, the closest ones first
+        //! @returns the number of tiles at the beginning of @tiles that are within a tile size of an agent
+        size_t SortTilesByPriority(AZStd::vector<AZStd::shared_ptr<TileGeometry>>& tiles) const;
+
         //! Debug draw object for Recast navigation mesh.
         RecastNavigationDebugDraw m_customDebugDraw;
 
@@ -115,14 +143,23 @@ namespace RecastNavigation
         AZStd::vector<AZStd::shared_ptr<TileGeometry>> m_tilesToBeProcessed;
         AZStd::recursive_mutex m_tileProcessingMutex;
 
+        //! The area that needs to be re-calculated once the current update operation has finished. Guarded by @m_tileProcessingMutex.
+        AZ::Aabb m_dirtyArea = AZ::Aabb::CreateNull();
+
+        //! The geometry each tile was last built from, by tile coordinates. Rebuilding a tile from the same geometry results in the same
+        //! navigation tile, so those tiles are kept as they are. Cleared whenever the navigation mesh or its configuration change.
+        AZStd::unordered_map<AZ::u64, AZStd::shared_ptr<TileGeometry>> m_tileGeometryCache;
+        AZStd::mutex m_tileGeometryCacheMutex;
+
         //! A way to check if we should stop tile processing (because we might be deactivating, for example).
         AZStd::atomic<bool> m_shouldProcessTiles{ true };
 
         //! Task graph objects to process tile geometry into Recast tiles.
+        //! The tasks run on the shared task executor. Tiles near the agents run at a normal priority, the rest as background work.
         AZ::TaskGraph m_taskGraph{ "RecastNavigation Tile Processing" };
-        AZ::TaskExecutor m_taskExecutor;
         AZStd::unique_ptr<AZ::TaskGraphEvent> m_taskGraphEvent;
-        AZ::TaskDescriptor m_taskDescriptor{ "Processing Tiles", "Recast Navigation" };
+        AZ::TaskDescriptor m_taskDescriptor{ "Processing Tiles", "Recast Navigation", AZ::TaskPriority::LOW };
+        AZ::TaskDescriptor m_priorityTaskDescriptor{ "Processing Tiles Near Agents", "Recast Navigation", AZ::TaskPriority::MEDIUM };
 
         //! If true, an update operation is in progress.
         AZStd::atomic<bool> m_updateInProgress{ false };
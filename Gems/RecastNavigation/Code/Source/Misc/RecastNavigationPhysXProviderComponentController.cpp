@@ -11,6 +11,7 @@
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/Shape.h>
 #include <AzFramework/Physics/ShapeConfiguration.h>
+#include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
 #include <DebugDraw/DebugDrawBus.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 #include <Misc/RecastNavigationPhysXProviderComponentController.h>
@@ -21,9 +22,6 @@ AZ_CVAR(
 AZ_CVAR(
     float, cl_navmesh_showInputDataSeconds, 30.f, nullptr, AZ::ConsoleFunctorFlags::Null,
     "If enabled, keeps the debug triangle mesh input for the specified number of seconds");
-AZ_CVAR(
-    AZ::u32, bg_navmesh_tileThreads, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
-    "Number of threads to use to process tiles for each RecastNavigationPhysXProvider");
 
 AZ_DECLARE_BUDGET(Navigation);
 
@@ -60,15 +58,9 @@ namespace RecastNavigation
         required.push_back(AZ_CRC_CE("AxisAlignedBoxShapeService"));
     }
 
-    RecastNavigationPhysXProviderComponentController::RecastNavigationPhysXProviderComponentController()
-        : m_taskExecutor(bg_navmesh_tileThreads)
-    {
-    }
-
     RecastNavigationPhysXProviderComponentController::RecastNavigationPhysXProviderComponentController(
         const RecastNavigationPhysXProviderConfig& config)
         : m_config(config)
-        , m_taskExecutor(bg_navmesh_tileThreads)
     {
     }
 
@@ -79,11 +71,23 @@ namespace RecastNavigation
         m_updateInProgress = false;
         OnConfigurationChanged();
         RecastNavigationProviderRequestBus::Handler::BusConnect(m_entityComponentIdPair.GetEntityId());
+
+        if (auto sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+        {
+            const AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(GetSceneName());
+            sceneInterface->RegisterSimulationBodyAddedHandler(sceneHandle, m_bodyAddedHandler);
+            sceneInterface->RegisterSimulationBodyRemovedHandler(sceneHandle, m_bodyRemovedHandler);
+            sceneInterface->RegisterSimulationBodySimulationEnabledHandler(sceneHandle, m_bodyEnabledHandler);
+            sceneInterface->RegisterSimulationBodySimulationDisabledHandler(sceneHandle, m_bodyDisabledHandler);
+        }
     }
 
     void RecastNavigationPhysXProviderComponentController::SetConfiguration(const RecastNavigationPhysXProviderConfig& config)
     {
         m_config = config;
+
+        // The cached geometry was collected with the previous configuration.
+        ClearTileGeometryCache();
     }
 
     const RecastNavigationPhysXProviderConfig& RecastNavigationPhysXProviderComponentController::GetConfiguration() const
@@ -104,9 +108,17 @@ namespace RecastNavigation
         }
 
         m_updateInProgress = false;
+        AZ::TickBus::Handler::BusDisconnect();
+        m_pendingChangedArea = AZ::Aabb::CreateNull();
+        m_bodyAddedHandler.Disconnect();
+        m_bodyRemovedHandler.Disconnect();
+        m_bodyEnabledHandler.Disconnect();
+        m_bodyDisabledHandler.Disconnect();
         RecastNavigationProviderRequestBus::Handler::BusDisconnect();
         // The event is used to detect if tasks are already in progress.
         m_taskGraphEvent.reset();
+        m_cachedTilesToSend.clear();
+        ClearTileGeometryCache();
     }
 
     AZStd::vector<AZStd::shared_ptr<TileGeometry>> RecastNavigationPhysXProviderComponentController::CollectGeometry(
@@ -121,7 +133,21 @@ namespace RecastNavigation
         float borderSize,
         AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
     {
-        return CollectGeometryAsyncImpl(tileSize, borderSize, GetWorldBounds(), AZStd::move(tileCallback));
+        return CollectGeometryAsyncImpl(tileSize, borderSize, GetWorldBounds(), AZ::Aabb::CreateNull(), AZStd::move(tileCallback));
+    }
+
+    bool RecastNavigationPhysXProviderComponentController::CollectGeometryWithinAreaAsync(
+        float tileSize,
+        float borderSize,
+        const AZ::Aabb& dirtyArea,
+        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
+    {
+        if (!dirtyArea.IsValid())
+        {
+            return false;
+        }
+
+        return CollectGeometryAsyncImpl(tileSize, borderSize, GetWorldBounds(), dirtyArea, AZStd::move(tileCallback));
     }
 
     AZ::Aabb RecastNavigationPhysXProviderComponentController::GetWorldBounds() const
@@ -151,6 +177,96 @@ namespace RecastNavigation
     void RecastNavigationPhysXProviderComponentController::OnConfigurationChanged()
     {
         m_collisionGroup = GetCollisionGroupById(m_config.m_collisionGroupId);
+
+        // The cached geometry might have been collected for a different collision group.
+        ClearTileGeometryCache();
+    }
+
+    void RecastNavigationPhysXProviderComponentController::OnSimulatedBodyChanged(
+        AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+    {
+        AzPhysics::SceneInterface* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        const AzPhysics::SimulatedBody* body = sceneInterface ? sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, bodyHandle) : nullptr;
+
+        // Only static colliders are collected, see @CollectCollidersWithinVolume, so moving rigid bodies don't change the geometry.
+        if (body && !azrtti_istypeof<AzPhysics::RigidBody>(body))
+        {
+            const AZ::Aabb bodyArea = body->GetAabb();
+            if (bodyArea.IsValid())
+            {
+                // Geometry collected before the body is in the PhysX scene would be cached out of date, wait for the next tick.
+                m_pendingChangedArea.AddAabb(bodyArea);
+                if (!AZ::TickBus::Handler::BusIsConnected())
+                {
+                    AZ::TickBus::Handler::BusConnect();
+                }
+            }
+        }
+    }
+
+    void RecastNavigationPhysXProviderComponentController::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+
+        const AZ::Aabb changedArea = m_pendingChangedArea;
+        m_pendingChangedArea = AZ::Aabb::CreateNull();
+        OnGeometryChanged(changedArea);
+    }
+
+    void RecastNavigationPhysXProviderComponentController::OnGeometryChanged(const AZ::Aabb& changedArea)
+    {
+        if (!changedArea.IsValid() || !changedArea.Overlaps(GetWorldBounds()))
+        {
+            return;
+        }
+
+        {
+            AZStd::lock_guard lock(m_tileGeometryCacheMutex);
+            ++m_tileGeometryCacheVersion;
+            for (auto tileIterator = m_tileGeometryCache.begin(); tileIterator != m_tileGeometryCache.end();)
+            {
+                if (tileIterator->second->m_scanBounds.Overlaps(changedArea))
+                {
+                    tileIterator = m_tileGeometryCache.erase(tileIterator);
+                }
+                else
+                {
+                    ++tileIterator;
+                }
+            }
+        }
+
+        RecastNavigationProviderNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
+            &RecastNavigationProviderNotifications::OnGeometryChanged, changedArea);
+    }
+
+    static AZ::u64 GetTileKey(int tileX, int tileY)
+    {
+        return (aznumeric_cast<AZ::u64>(aznumeric_cast<AZ::u32>(tileY)) << 32) | aznumeric_cast<AZ::u32>(tileX);
+    }
+
+    AZStd::shared_ptr<TileGeometry> RecastNavigationPhysXProviderComponentController::FindCachedTileGeometry(int tileX, int tileY)
+    {
+        AZStd::lock_guard lock(m_tileGeometryCacheMutex);
+        const auto tileIterator = m_tileGeometryCache.find(GetTileKey(tileX, tileY));
+        return tileIterator != m_tileGeometryCache.end() ? tileIterator->second : nullptr;
+    }
+
+    void RecastNavigationPhysXProviderComponentController::StoreTileGeometry(const AZStd::shared_ptr<TileGeometry>& tile, AZ::u64 cacheVersion)
+    {
+        AZStd::lock_guard lock(m_tileGeometryCacheMutex);
+        // If the geometry changed while this tile was collected, it might be out of date already.
+        if (cacheVersion == m_tileGeometryCacheVersion)
+        {
+            m_tileGeometryCache[GetTileKey(tile->m_tileX, tile->m_tileY)] = tile;
+        }
+    }
+
+    void RecastNavigationPhysXProviderComponentController::ClearTileGeometryCache()
+    {
+        AZStd::lock_guard lock(m_tileGeometryCacheMutex);
+        ++m_tileGeometryCacheVersion;
+        m_tileGeometryCache.clear();
     }
 
     void RecastNavigationPhysXProviderComponentController::CollectCollidersWithinVolume(const AZ::Aabb& volume, QueryHits& overlapHits)
@@ -358,6 +474,7 @@ namespace RecastNavigation
         float tileSize,
         float borderSize,
         const AZ::Aabb& worldVolume,
+        const AZ::Aabb& dirtyArea,
         AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
     {
         bool notInProgress = false;
@@ -387,6 +504,22 @@ namespace RecastNavigation
 
             const AZ::Vector3 border = AZ::Vector3::CreateOne() * borderSize;
 
+            AZ::u64 cacheVersion = 0;
+            {
+                // The cached geometry can only be reused for the same tile grid.
+                AZStd::lock_guard lock(m_tileGeometryCacheMutex);
+                if (m_cachedTileSize != tileSize || m_cachedBorderSize != borderSize || m_cachedWorldVolume != worldVolume)
+                {
+                    ++m_tileGeometryCacheVersion;
+                    m_tileGeometryCache.clear();
+                    m_cachedTileSize = tileSize;
+                    m_cachedBorderSize = borderSize;
+                    m_cachedWorldVolume = worldVolume;
+                }
+                cacheVersion = m_tileGeometryCacheVersion;
+            }
+
+            m_cachedTilesToSend.clear();
             AZStd::vector<AZ::TaskToken> tileTaskTokens;
 
             // Create tasks for each tile and a finish task.
@@ -408,6 +541,24 @@ namespace RecastNavigation
 
                     AZ::Aabb tileVolume = AZ::Aabb::CreateFromMinMax(tileMin, tileMax);
                     AZ::Aabb scanVolume = AZ::Aabb::CreateFromMinMax(tileMin - border, tileMax + border);
+
+                    // The tile grid always covers the whole world volume, so that the tile coordinates match the ones of a full update.
+                    // Only the tiles that can see a change within their scan volume need to be collected again.
+                    if (dirtyArea.IsValid() && !scanVolume.Overlaps(dirtyArea))
+                    {
+                        continue;
+                    }
+
+                    // Tiles within a changed area are always collected again, the others only if no geometry was cached for them.
+                    if (!dirtyArea.IsValid())
+                    {
+                        if (AZStd::shared_ptr<TileGeometry> cachedTile = FindCachedTileGeometry(x, y))
+                        {
+                            m_cachedTilesToSend.push_back(AZStd::move(cachedTile));
+                            continue;
+                        }
+                    }
+
                     AZStd::shared_ptr<TileGeometry> geometryData = AZStd::make_unique<TileGeometry>();
                     geometryData->m_tileCallback = tileCallback;
                     geometryData->m_worldBounds = tileVolume;
@@ -416,7 +567,7 @@ namespace RecastNavigation
                     geometryData->m_tileY = y;
 
                     AZ::TaskToken token = m_taskGraph.AddTask(
-                        m_taskDescriptor, [this, geometryData]()
+                        m_taskDescriptor, [this, geometryData, cacheVersion]()
                         {
                             if (m_shouldProcessTiles)
                             {
@@ -424,6 +575,7 @@ namespace RecastNavigation
                                 QueryHits results;
                                 CollectCollidersWithinVolume(geometryData->m_scanBounds, results);
                                 AppendColliderGeometry(*geometryData, results);
+                                StoreTileGeometry(geometryData, cacheVersion);
                                 geometryData->m_tileCallback(geometryData);
                             }
                         });
@@ -435,6 +587,14 @@ namespace RecastNavigation
             AZ::TaskToken finishToken = m_taskGraph.AddTask(
                 m_taskDescriptor, [this, tileCallback]()
                 {
+                    if (m_shouldProcessTiles)
+                    {
+                        for (const AZStd::shared_ptr<TileGeometry>& cachedTile : m_cachedTilesToSend)
+                        {
+                            tileCallback(cachedTile);
+                        }
+                    }
+
                     tileCallback({}); // Notifies the caller that the operation is done.
                     m_updateInProgress = false;
                 });
@@ -445,10 +605,12 @@ namespace RecastNavigation
             }
 
             AZ_Assert(m_taskGraphEvent->IsSignaled() == false, "RecastNavigationPhysXProviderComponentController might be runtime two async gather operations, which is not supported.");
-            m_taskGraph.SubmitOnExecutor(m_taskExecutor, m_taskGraphEvent.get());
+            m_taskGraph.Submit(m_taskGraphEvent.get());
             return true;
         }
 
+        // The previous task graph is still finishing up.
+        m_updateInProgress = false;
         return false;
     }
 } // namespace RecastNavigation
@@ -9,8 +9,12 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
-#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/Task/TaskDescriptor.h>
 #include <AzCore/Task/TaskGraph.h>
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
 #include <RecastNavigation/RecastHelpers.h>
 #include <Misc/RecastNavigationPhysXProviderConfig.h>
@@ -22,13 +26,14 @@ namespace RecastNavigation
     //! The method provided are not thread-safe. Synchronize as necessary at the higher level.
     class RecastNavigationPhysXProviderComponentController
         : public RecastNavigationProviderRequestBus::Handler
+        , public AZ::TickBus::Handler
     {
         friend class EditorRecastNavigationPhysXProviderComponent;
     public:
         AZ_CLASS_ALLOCATOR(RecastNavigationPhysXProviderComponentController, AZ::SystemAllocator, 0);
         AZ_RTTI(RecastNavigationPhysXProviderComponentController, "{182D93F8-9E76-409B-9939-6816509A6F52}");
 
-        RecastNavigationPhysXProviderComponentController();
+        RecastNavigationPhysXProviderComponentController() = default;
         explicit RecastNavigationPhysXProviderComponentController(const RecastNavigationPhysXProviderConfig& config);
         ~RecastNavigationPhysXProviderComponentController() override = default;
 
@@ -47,14 +52,22 @@ namespace RecastNavigation
         //! @{
         AZStd::vector<AZStd::shared_ptr<TileGeometry>> CollectGeometry(float tileSize, float borderSize) override;
         bool CollectGeometryAsync(float tileSize, float borderSize, AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) override;
+        bool CollectGeometryWithinAreaAsync(float tileSize, float borderSize, const AZ::Aabb& dirtyArea,
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) override;
         AZ::Aabb GetWorldBounds() const override;
         int GetNumberOfTiles(float tileSize) const override;
         //! @}
 
+        //! TickBus overrides ...
+        //! @{
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        //! @}
+
         //! A container of PhysX overlap scene hits (has PhysX colliders and their position/orientation).
         using QueryHits = AZStd::vector<AzPhysics::SceneQueryHit>;
 
         //! Blocking call. Collects all the relevant PhysX geometry within a provided volume.
+        //! Always queries PhysX, the geometry cache is only used by @CollectGeometryAsyncImpl.
         //! @param tileSize the result is packaged in tiles, which are squares covering the provided volume of @worldVolume
         //! @param borderSize an additional extend in all direction around the tile volume, this additional geometry will allow Recast to connect tiles together.
         //! @param worldVolume the overall volume to collect static PhysX geometry
@@ -77,12 +90,15 @@ namespace RecastNavigation
         //! @param tileSize the result is packaged in tiles, which are squares covering the provided volume of @worldVolume
         //! @param borderSize an additional extend in all direction around the tile volume, this additional geometry will allow Recast to connect tiles together
         //! @param worldVolume worldVolume the overall volume to collect static PhysX geometry
+        //! @param dirtyArea if valid, only the tiles whose scan volume overlaps this area are collected. Otherwise all the tiles are returned,
+        //!                  reusing the geometry cached for the tiles where no static PhysX body has changed since it was collected.
         //! @param tileCallback an empty tile indicates the end of the operation, otherwise a valid shared_ptr is returned with tile geometry
         //! @returns true if an async operation was scheduled, false otherwise
         bool CollectGeometryAsyncImpl(
             float tileSize,
             float borderSize,
             const AZ::Aabb& worldVolume,
+            const AZ::Aabb& dirtyArea,
             AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback);
 
         //! Finds all the static PhysX colliders within a given volume.
@@ -98,9 +114,27 @@ namespace RecastNavigation
         //! Returns the built-in names for the PhysX scene, either Editor or game scene.
         const char* GetSceneName() const;
 
+        //! Marks the cached geometry of the tiles that can see @changedArea as out of date
+        //! and notifies the navigation mesh with @RecastNavigationProviderNotifications::OnGeometryChanged.
+        //! @param changedArea the world area where the PhysX geometry has changed
+        void OnGeometryChanged(const AZ::Aabb& changedArea);
+
     protected:
         void OnConfigurationChanged();
 
+        //! Handles static PhysX bodies being added, removed, enabled or disabled within the PhysX scene.
+        //! The scene signals these events before the body is added to or removed from the PhysX scene, so the area of the body is
+        //! only queued here and marked as changed on the next tick, see @m_pendingChangedArea.
+        void OnSimulatedBodyChanged(AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle);
+
+        //! Returns the cached geometry for a tile, or nullptr if it needs to be collected from PhysX.
+        AZStd::shared_ptr<TileGeometry> FindCachedTileGeometry(int tileX, int tileY);
+
+        //! Stores the geometry collected for a tile, unless the cache was invalidated after @cacheVersion was read.
+        void StoreTileGeometry(const AZStd::shared_ptr<TileGeometry>& tile, AZ::u64 cacheVersion);
+
+        void ClearTileGeometryCache();
+
         AZ::EntityComponentIdPair m_entityComponentIdPair;
         RecastNavigationPhysXProviderConfig m_config;
 
@@ -113,9 +147,37 @@ namespace RecastNavigation
         AZStd::atomic<bool> m_updateInProgress{ false };
 
         //! Task graph objects to collect geometry data in tiles over a grid.
+        //! The tasks run on the shared task executor as background work.
         AZ::TaskGraph m_taskGraph{ "RecastNavigation PhysX" };
-        AZ::TaskExecutor m_taskExecutor;
         AZStd::unique_ptr<AZ::TaskGraphEvent> m_taskGraphEvent;
-        AZ::TaskDescriptor m_taskDescriptor{ "Collect Geometry", "Recast Navigation" };
+        AZ::TaskDescriptor m_taskDescriptor{ "Collect Geometry", "Recast Navigation", AZ::TaskPriority::LOW };
+
+        //! Cached tiles returned by the current async operation once the rest of the tiles are collected.
+        AZStd::vector<AZStd::shared_ptr<TileGeometry>> m_cachedTilesToSend;
+
+        //! The geometry collected from PhysX for each tile, by tile coordinates. A tile is removed once a static PhysX body changes within
+        //! its scan volume. Only valid for the tile grid it was collected with, see @m_cachedTileSize, @m_cachedBorderSize and
+        //! @m_cachedWorldVolume. Guarded by @m_tileGeometryCacheMutex.
+        AZStd::unordered_map<AZ::u64, AZStd::shared_ptr<TileGeometry>> m_tileGeometryCache;
+        float m_cachedTileSize = 0.f;
+        float m_cachedBorderSize = 0.f;
+        AZ::Aabb m_cachedWorldVolume = AZ::Aabb::CreateNull();
+        //! Incremented each time cached geometry is invalidated, so that geometry collected before that is not cached.
+        AZ::u64 m_tileGeometryCacheVersion = 0;
+        AZStd::mutex m_tileGeometryCacheMutex;
+
+        //! The areas of the static PhysX bodies that changed since the last tick, merged together.
+        //! Passed to @OnGeometryChanged on the next tick, once the PhysX scene has been updated.
+        AZ::Aabb m_pendingChangedArea = AZ::Aabb::CreateNull();
+
+        //! Events of the PhysX scene that change the static geometry.
+        AzPhysics::SceneEvents::OnSimulationBodyAdded::Handler m_bodyAddedHandler{
+            [this](AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle) { OnSimulatedBodyChanged(sceneHandle, bodyHandle); } };
+        AzPhysics::SceneEvents::OnSimulationBodyRemoved::Handler m_bodyRemovedHandler{
+            [this](AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle) { OnSimulatedBodyChanged(sceneHandle, bodyHandle); } };
+        AzPhysics::SceneEvents::OnSimulationBodySimulationEnabled::Handler m_bodyEnabledHandler{
+            [this](AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle) { OnSimulatedBodyChanged(sceneHandle, bodyHandle); } };
+        AzPhysics::SceneEvents::OnSimulationBodySimulationDisabled::Handler m_bodyDisabledHandler{
+            [this](AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle) { OnSimulatedBodyChanged(sceneHandle, bodyHandle); } };
     };
 } // namespace RecastNavigation
@@ -79,10 +79,17 @@ namespace RecastNavigation
     {
         AZ::TickBus::Handler::BusDisconnect();
         RecastNavigationRequestBus::Handler::BusDisconnect();
+        m_pathQueryQueue.Clear();
     }
 
     void RecastNavigationSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        m_pathQueryQueue.Update();
+    }
+
+    AZ::u64 RecastNavigationSystemComponent::QueuePathQuery(PathQueryRequest request)
+    {
+        return m_pathQueryQueue.QueuePathQuery(AZStd::move(request));
     }
 
 } // namespace RecastNavigation
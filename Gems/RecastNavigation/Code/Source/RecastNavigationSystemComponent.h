@@ -10,6 +10,7 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <Misc/DetourPathQueryQueue.h>
 #include <RecastNavigation/RecastNavigationBus.h>
 
 namespace RecastNavigation
@@ -40,6 +41,13 @@ namespace RecastNavigation
 
         //! AZTickBus overrides ...
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+        //! RecastNavigationRequestBus overrides ...
+        AZ::u64 QueuePathQuery(PathQueryRequest request) override;
+
+    private:
+        //! Path queries of all the agents, processed in batches every frame.
+        DetourPathQueryQueue m_pathQueryQueue;
     };
 
 } // namespace RecastNavigation
@@ -14,6 +14,7 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/EBus/EventSchedulerSystemComponent.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/Mocks/MockITime.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
@@ -60,6 +61,7 @@ namespace RecastNavigation
         unique_ptr<UnitTest::MockPhysicsShape> m_mockPhysicsShape;
         unique_ptr<UnitTest::MockSimulatedBody> m_mockSimulatedBody;
         unique_ptr<AZ::Console> m_console;
+        unique_ptr<AZ::TaskExecutor> m_taskExecutor;
 
         void SetUp() override
         {
@@ -68,6 +70,10 @@ namespace RecastNavigation
             m_console.reset(aznew AZ::Console());
             AZ::Interface<AZ::IConsole>::Register(m_console.get());
 
+            // Navigation tiles are processed on the shared task executor.
+            m_taskExecutor = AZStd::make_unique<AZ::TaskExecutor>();
+            AZ::TaskExecutor::SetInstance(m_taskExecutor.get());
+
             // register components involved in testing
             m_descriptors = AZStd::make_unique<AZStd::vector<AZ::ComponentDescriptor*>>();
             m_sc = AZStd::make_unique<AZ::SerializeContext>();
@@ -111,6 +117,9 @@ namespace RecastNavigation
             m_sc.reset();
             m_bc.reset();
 
+            AZ::TaskExecutor::SetInstance(nullptr);
+            m_taskExecutor.reset();
+
             AZ::Interface<AZ::IConsole>::Unregister(m_console.get());
             m_console.reset();
             UnitTest::LeakDetectionFixture::TearDown();
@@ -13,7 +13,10 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/EBus/EventSchedulerSystemComponent.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/Mocks/MockITime.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
@@ -36,6 +39,9 @@ namespace RecastNavigationTests
     using AZ::EventSchedulerSystemComponent;
     using RecastNavigation::RecastNavigationMeshRequestBus;
     using RecastNavigation::RecastNavigationMeshRequests;
+    using RecastNavigation::RecastNavigationProviderRequestBus;
+    using RecastNavigation::RecastNavigationProviderRequests;
+    using RecastNavigation::TileGeometry;
     using RecastNavigation::RecastNavigationDebugDraw;
     using RecastNavigation::DetourNavigationRequests;
     using RecastNavigation::NavMeshQuery;
@@ -55,6 +61,7 @@ namespace RecastNavigationTests
         unique_ptr<UnitTest::MockPhysicsShape> m_mockPhysicsShape;
         unique_ptr<UnitTest::MockSimulatedBody> m_mockSimulatedBody;
         unique_ptr<AZ::Console> m_console;
+        unique_ptr<AZ::TaskExecutor> m_taskExecutor;
         unique_ptr<AZ::NameDictionary> m_nameDictionary;
 
         void SetUp() override
@@ -67,6 +74,10 @@ namespace RecastNavigationTests
             m_nameDictionary = AZStd::make_unique<AZ::NameDictionary>();
             AZ::Interface<AZ::NameDictionary>::Register(m_nameDictionary.get());
 
+            // Navigation tiles are processed on the shared task executor.
+            m_taskExecutor = AZStd::make_unique<AZ::TaskExecutor>();
+            AZ::TaskExecutor::SetInstance(m_taskExecutor.get());
+
             // register components involved in testing
             m_descriptors = AZStd::make_unique<AZStd::vector<AZ::ComponentDescriptor*>>();
             m_sc = AZStd::make_unique<AZ::SerializeContext>();
@@ -103,6 +114,9 @@ namespace RecastNavigationTests
             m_sc = {};
             m_bc = {};
 
+            AZ::TaskExecutor::SetInstance(nullptr);
+            m_taskExecutor.reset();
+
             AZ::Interface<AZ::NameDictionary>::Unregister(m_nameDictionary.get());
             m_nameDictionary.reset();
 
@@ -123,16 +137,80 @@ namespace RecastNavigationTests
         }
 
         // helper method
-        void PopulateEntity(AZ::Entity& e)
+        void PopulateEntity(AZ::Entity& e, const RecastNavigation::RecastNavigationMeshConfig& meshConfig = {})
         {
             e.SetId(AZ::EntityId{ 1 });
             e.CreateComponent<AZ::EventSchedulerSystemComponent>();
             e.CreateComponent<RecastNavigation::RecastNavigationSystemComponent>();
             m_mockShapeComponent = e.CreateComponent<MockShapeComponent>();
             e.CreateComponent<RecastNavigation::RecastNavigationPhysXProviderComponent>();
-            e.CreateComponent<RecastNavigation::RecastNavigationMeshComponent>(RecastNavigation::RecastNavigationMeshConfig{});
+            e.CreateComponent<RecastNavigation::RecastNavigationMeshComponent>(meshConfig);
+        }
+
+        // Splits the world bounds of @MockShapeComponent into 2x2 tiles.
+        static RecastNavigation::RecastNavigationMeshConfig CreateTiledMeshConfig()
+        {
+            RecastNavigation::RecastNavigationMeshConfig meshConfig;
+            meshConfig.m_tileSize = 10.f;
+            meshConfig.m_borderSize = 2;
+            return meshConfig;
         }
 
+        // Returns a floor over the whole scanned volume of a tile and the test box at @m_obstacle if it is within that volume.
+        void SetupTiledGeometry()
+        {
+            ON_CALL(*m_mockPhysicsShape, GetLocalPose()).WillByDefault(Return(
+                AZStd::make_pair(AZ::Vector3::CreateZero(), AZ::Quaternion::CreateIdentity())));
+
+            ON_CALL(*m_mockPhysicsShape, GetGeometry(_, _, _)).WillByDefault(Invoke([this]
+            (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb* scanBounds)
+                {
+                    ++m_collectedTiles;
+
+                    if (m_obstacle.IsValid() && m_obstacle.Overlaps(*scanBounds))
+                    {
+                        AddTestGeometry(vertices, indices, true);
+                        for (AZ::Vector3& vertex : vertices)
+                        {
+                            vertex += m_obstacle.GetCenter();
+                        }
+                    }
+
+                    const AZ::Vector3& min = scanBounds->GetMin();
+                    const AZ::Vector3& max = scanBounds->GetMax();
+                    const AZ::u32 firstIndex = aznumeric_cast<AZ::u32>(vertices.size());
+                    vertices.push_back(AZ::Vector3(min.GetX(), max.GetY(), 0.f));
+                    vertices.push_back(AZ::Vector3(min.GetX(), min.GetY(), 0.f));
+                    vertices.push_back(AZ::Vector3(max.GetX(), min.GetY(), 0.f));
+                    vertices.push_back(AZ::Vector3(max.GetX(), max.GetY(), 0.f));
+                    for (AZ::u32 index : { 0u, 1u, 2u, 0u, 2u, 3u })
+                    {
+                        indices.push_back(firstIndex + index);
+                    }
+                }));
+        }
+
+        // The navigation tiles of @CreateTiledMeshConfig. A tile gets a new reference each time it is rebuilt.
+        static AZStd::vector<dtTileRef> GetTileRefs(AZ::EntityId meshEntityId)
+        {
+            AZStd::shared_ptr<NavMeshQuery> navMeshQuery;
+            RecastNavigationMeshRequestBus::EventResult(navMeshQuery, meshEntityId, &RecastNavigationMeshRequests::GetNavigationObject);
+            NavMeshQuery::LockGuard lock(*navMeshQuery);
+
+            AZStd::vector<dtTileRef> tileRefs;
+            for (int y = 0; y < 2; ++y)
+            {
+                for (int x = 0; x < 2; ++x)
+                {
+                    tileRefs.push_back(lock.GetNavMesh()->getTileRefAt(x, y, 0));
+                }
+            }
+            return tileRefs;
+        }
+
+        AZStd::atomic<int> m_collectedTiles{ 0 };
+        AZ::Aabb m_obstacle = AZ::Aabb::CreateNull();
+
         void SetupNavigationMesh()
         {
             m_hit->m_resultFlags = AzPhysics::SceneQuery::EntityId;
@@ -375,6 +453,205 @@ namespace RecastNavigationTests
         RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
     }
 
+    /*
+     * Tiles whose geometry didn't change are not rebuilt on the second update, while tiles that changed are.
+     */
+    TEST_F(NavigationTest, BlockingTestRerunKeepsUnchangedTiles)
+    {
+        Entity e;
+        PopulateEntity(e);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([this]
+        (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb*)
+            {
+                AddTestGeometry(vertices, indices, true);
+            }));
+
+        AZStd::shared_ptr<NavMeshQuery> navMeshQuery;
+        RecastNavigationMeshRequestBus::EventResult(navMeshQuery, e.GetId(), &RecastNavigationMeshRequests::GetNavigationObject);
+        const auto getTileRef = [&navMeshQuery]()
+        {
+            NavMeshQuery::LockGuard lock(*navMeshQuery);
+            return lock.GetNavMesh()->getTileRefAt(0, 0, 0);
+        };
+
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
+        const dtTileRef firstTileRef = getTileRef();
+        EXPECT_NE(firstTileRef, 0);
+
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
+        EXPECT_EQ(getTileRef(), firstTileRef);
+
+        ON_CALL(*m_mockSimulatedBody, GetPosition()).WillByDefault(Return(AZ::Vector3(0.5f, 0.f, 0.f)));
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
+        EXPECT_NE(getTileRef(), firstTileRef);
+    }
+
+    /*
+     * A second update gets the geometry of all the tiles from the cache of the provider and rebuilds none of them.
+     */
+    TEST_F(NavigationTest, AsyncRerunReusesCachedGeometry)
+    {
+        Entity e;
+        PopulateEntity(e, CreateTiledMeshConfig());
+        ActivateEntity(e);
+        SetupNavigationMesh();
+        SetupTiledGeometry();
+
+        Wait wait(AZ::EntityId(1));
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshAsync);
+        wait.BlockUntilCalled();
+        EXPECT_EQ(m_collectedTiles, 4);
+
+        const AZStd::vector<dtTileRef> firstTileRefs = GetTileRefs(e.GetId());
+        for (dtTileRef tileRef : firstTileRefs)
+        {
+            EXPECT_NE(tileRef, 0);
+        }
+
+        m_collectedTiles = 0;
+        wait.Reset();
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshAsync);
+        wait.BlockUntilCalled();
+        EXPECT_EQ(wait.m_updatedCalls, 1);
+        EXPECT_EQ(m_collectedTiles, 0);
+        EXPECT_EQ(GetTileRefs(e.GetId()), firstTileRefs);
+    }
+
+    /*
+     * A static collider added within one tile collects the geometry of that tile again on the next tick and rebuilds only that tile.
+     */
+    TEST_F(NavigationTest, AddedStaticBodyRebuildsOnlyItsTile)
+    {
+        AzPhysics::SceneEvents::OnSimulationBodyAdded bodyAddedEvent;
+        ON_CALL(*m_mockSceneInterface, RegisterSimulationBodyAddedHandler(_, _)).WillByDefault(Invoke([&bodyAddedEvent]
+        (AzPhysics::SceneHandle, AzPhysics::SceneEvents::OnSimulationBodyAdded::Handler& handler)
+            {
+                handler.Connect(bodyAddedEvent);
+            }));
+
+        Entity e;
+        PopulateEntity(e, CreateTiledMeshConfig());
+        ActivateEntity(e);
+        SetupNavigationMesh();
+        SetupTiledGeometry();
+
+        Wait wait(AZ::EntityId(1));
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshAsync);
+        wait.BlockUntilCalled();
+        const AZStd::vector<dtTileRef> firstTileRefs = GetTileRefs(e.GetId());
+
+        // The box is well within the first tile, away from the borders of the other tiles.
+        m_obstacle = AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(-5.f, -5.f, 0.f), AZ::Vector3(2.5f));
+        ON_CALL(*m_mockSimulatedBody, GetAabb()).WillByDefault(Return(m_obstacle));
+
+        m_collectedTiles = 0;
+        wait.Reset();
+        bodyAddedEvent.Signal(AzPhysics::InvalidSceneHandle, AzPhysics::InvalidSimulatedBodyHandle);
+
+        // The body is not in the PhysX scene yet when the event is signaled, its area is only rebuilt on the next tick.
+        EXPECT_EQ(wait.m_updatedCalls, 0);
+        EXPECT_EQ(m_collectedTiles, 0);
+
+        AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.1f, AZ::ScriptTimePoint{});
+        wait.BlockUntilCalled();
+        EXPECT_EQ(wait.m_updatedCalls, 1);
+        EXPECT_EQ(m_collectedTiles, 1);
+
+        const AZStd::vector<dtTileRef> tileRefs = GetTileRefs(e.GetId());
+        ASSERT_EQ(tileRefs.size(), firstTileRefs.size());
+        EXPECT_NE(tileRefs[0], firstTileRefs[0]);
+        for (size_t i = 1; i < tileRefs.size(); ++i)
+        {
+            EXPECT_EQ(tileRefs[i], firstTileRefs[i]);
+        }
+    }
+
+    /*
+     * Marking an area that changed re-calculates the tiles around it only.
+     */
+    TEST_F(NavigationTest, UpdateNavigationMeshAreaAsync)
+    {
+        Entity e;
+        PopulateEntity(e, CreateTiledMeshConfig());
+        ActivateEntity(e);
+        SetupNavigationMesh();
+        SetupTiledGeometry();
+
+        bool updateStarted = true;
+        RecastNavigationMeshRequestBus::EventResult(updateStarted, e.GetId(),
+            &RecastNavigationMeshRequests::UpdateNavigationMeshAreaAsync, AZ::Aabb::CreateNull());
+        EXPECT_FALSE(updateStarted);
+
+        Wait wait(AZ::EntityId(1));
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshAsync);
+        wait.BlockUntilCalled();
+        const AZStd::vector<dtTileRef> firstTileRefs = GetTileRefs(e.GetId());
+
+        // The corner shared by all the tiles is within the border of each of them.
+        m_obstacle = AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3(0.1f));
+        m_collectedTiles = 0;
+        wait.Reset();
+        RecastNavigationMeshRequestBus::EventResult(updateStarted, e.GetId(),
+            &RecastNavigationMeshRequests::UpdateNavigationMeshAreaAsync, m_obstacle);
+        EXPECT_TRUE(updateStarted);
+        wait.BlockUntilCalled();
+        EXPECT_EQ(m_collectedTiles, 4);
+
+        const AZStd::vector<dtTileRef> tileRefs = GetTileRefs(e.GetId());
+        for (size_t i = 0; i < tileRefs.size(); ++i)
+        {
+            EXPECT_NE(tileRefs[i], firstTileRefs[i]);
+        }
+    }
+
+    /*
+     * The provider only collects the tiles whose scanned volume overlaps the changed area, using the tile grid of a full update.
+     */
+    TEST_F(NavigationTest, CollectGeometryWithinAreaAsync)
+    {
+        Entity e;
+        PopulateEntity(e);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+        SetupTiledGeometry();
+
+        const auto ignoreTile = [](AZStd::shared_ptr<TileGeometry>) {};
+        bool operationScheduled = true;
+        RecastNavigationProviderRequestBus::EventResult(operationScheduled, e.GetId(),
+            &RecastNavigationProviderRequests::CollectGeometryWithinAreaAsync, 10.f, 0.8f, AZ::Aabb::CreateNull(), ignoreTile);
+        EXPECT_FALSE(operationScheduled);
+
+        AZStd::mutex tilesMutex;
+        AZStd::vector<AZStd::shared_ptr<TileGeometry>> tiles;
+        AZStd::binary_semaphore finished;
+        RecastNavigationProviderRequestBus::EventResult(operationScheduled, e.GetId(),
+            &RecastNavigationProviderRequests::CollectGeometryWithinAreaAsync, 10.f, 0.8f,
+            AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(5.f, -5.f, 0.f), AZ::Vector3::CreateOne()),
+            [&tilesMutex, &tiles, &finished](AZStd::shared_ptr<TileGeometry> tile)
+            {
+                if (tile)
+                {
+                    AZStd::lock_guard lock(tilesMutex);
+                    tiles.push_back(tile);
+                }
+                else
+                {
+                    finished.release();
+                }
+            });
+        ASSERT_TRUE(operationScheduled);
+        ASSERT_TRUE(finished.try_acquire_for(AZStd::chrono::seconds(2)));
+
+        ASSERT_EQ(tiles.size(), 1);
+        EXPECT_EQ(tiles[0]->m_tileX, 1);
+        EXPECT_EQ(tiles[0]->m_tileY, 0);
+        EXPECT_EQ(tiles[0]->m_worldBounds, AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.f, -10.f, -10.f), AZ::Vector3(10.f, 0.f, 10.f)));
+        EXPECT_FALSE(tiles[0]->IsEmpty());
+    }
+
     /*
      * Run update navigation mesh twice with no data.
      */
@@ -531,6 +808,65 @@ namespace RecastNavigationTests
         EXPECT_GT(waypoints.size(), 0);
     }
 
+    class PathFoundHandler : public RecastNavigation::DetourNavigationNotificationBus::Handler
+    {
+    public:
+        explicit PathFoundHandler(AZ::EntityId id)
+        {
+            BusConnect(id);
+        }
+
+        ~PathFoundHandler() override
+        {
+            BusDisconnect();
+        }
+
+        void OnPathFound([[maybe_unused]] AZ::EntityId agentEntity, AZ::u64 requestId, const AZStd::vector<AZ::Vector3>& waypoints) override
+        {
+            m_requestId = requestId;
+            m_waypoints = waypoints;
+            m_calls++;
+        }
+
+        AZ::u64 m_requestId = 0;
+        AZStd::vector<AZ::Vector3> m_waypoints;
+        int m_calls = 0;
+    };
+
+    TEST_F(NavigationTest, FindPathAsyncTest)
+    {
+        Entity e;
+        PopulateEntity(e);
+        e.CreateComponent<DetourNavigationComponent>(e.GetId(), 3.f);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([this]
+        (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb*)
+            {
+                AddTestGeometry(vertices, indices, true);
+            }));
+
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
+
+        const PathFoundHandler handler(e.GetId());
+        AZ::u64 requestId = 0;
+        DetourNavigationRequestBus::EventResult(requestId, AZ::EntityId(1), &DetourNavigationRequests::FindPathBetweenPositionsAsync,
+            AZ::Vector3(0.f, 0, 0), AZ::Vector3(2.f, 2, 0));
+        EXPECT_NE(requestId, 0);
+
+        // The path is delivered on a tick once the batch of queries has finished.
+        for (int i = 0; i < 1000 && handler.m_calls == 0; ++i)
+        {
+            AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.1f, AZ::ScriptTimePoint{});
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+        }
+
+        EXPECT_EQ(handler.m_calls, 1);
+        EXPECT_EQ(handler.m_requestId, requestId);
+        EXPECT_GT(handler.m_waypoints.size(), 0);
+    }
+
     /*
      * Test with one of the point being way outside of the range of the navigation mesh.
      */
@@ -18,6 +18,8 @@ set(FILES
     Source/Components/RecastNavigationPhysXProviderComponent.h
     Source/Components/RecastNavigationPhysXProviderComponent.cpp
 
+    Source/Misc/DetourPathQueryQueue.h
+    Source/Misc/DetourPathQueryQueue.cpp
     Source/Misc/RecastNavigationConstants.h
     Source/Misc/RecastNavigationDebugDraw.h
     Source/Misc/RecastNavigationDebugDraw.cpp
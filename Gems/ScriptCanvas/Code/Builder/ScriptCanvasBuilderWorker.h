@@ -70,6 +70,7 @@ namespace ScriptCanvasBuilder
         AddExplicitDestructCallForMemberVariables,
         DoNotLoadScriptEventsDuringCreateJobs,
         FixEntityIdReturnValuesInEvents,
+        AddSourceHashForNativeTranslations,
         // add new entries above
         Current,
     };
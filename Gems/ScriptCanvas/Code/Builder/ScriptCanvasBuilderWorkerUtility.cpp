@@ -398,6 +398,24 @@ namespace ScriptCanvasBuilder
     ScriptCanvas::Translation::Result TranslateToLua(ScriptCanvas::Grammar::Request& request)
     {
         request.translationTargetFlags = ScriptCanvas::Translation::TargetFlags::Lua;
-        return ScriptCanvas::Translation::ParseAndTranslateGraph(request);
+
+        if (ScriptCanvas::Grammar::g_translateToNative)
+        {
+            // the native translation is only usable from the saved files
+            request.translationTargetFlags |= ScriptCanvas::Translation::TargetFlags::Cpp | ScriptCanvas::Translation::TargetFlags::Hpp;
+            request.rawSaveDebugOutput = true;
+        }
+
+        ScriptCanvas::Translation::Result result = ScriptCanvas::Translation::ParseAndTranslateGraph(request);
+
+        if (ScriptCanvas::Grammar::g_translateToNative
+            && result.TranslationSucceed(ScriptCanvas::Translation::TargetFlags::Lua)
+            && !result.TranslationSucceed(ScriptCanvas::Translation::TargetFlags::Cpp))
+        {
+            AZ_Warning("ScriptCanvasBuilder", false, "%s will run through Lua, translation to C++ failed: %s"
+                , request.name.data(), result.ErrorsToString().c_str());
+        }
+
+        return result;
     }
 }
@@ -13,6 +13,7 @@
 #include <Editor/Framework/ScriptCanvasReporter.h>
 #include <ScriptCanvas/Assets/ScriptCanvasFileHandling.h>
 #include <ScriptCanvas/Core/Core.h>
+#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>
 #include <ScriptCanvas/Translation/TranslationResult.h>
 
 namespace ScriptCanvas
@@ -45,6 +46,8 @@ namespace ScriptCanvasEditor
         bool debug = true;
         bool traced = true;
         AZStd::function<void()> m_onPostSimulate;
+        // registered for the graph while it runs in ExecutionMode::Native, without it the graph runs its Lua translation
+        ScriptCanvas::Execution::NativeGraphFactory m_nativeGraph = nullptr;
     };
 
     struct RunGraphSpec
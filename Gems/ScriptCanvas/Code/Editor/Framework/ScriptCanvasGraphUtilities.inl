@@ -198,7 +198,8 @@ namespace ScriptCanvasEditor
             AZStd::vector<RuntimeData> dependencyDataBuffer;
             AZStd::vector<LoadedInterpretedDependency> dependencies;
 
-            if (runGraphSpec.runSpec.execution == ExecutionMode::Interpreted)
+            // the native execution takes the runtime inputs of the graph from its Lua translation
+            if (runGraphSpec.runSpec.execution == ExecutionMode::Interpreted || runGraphSpec.runSpec.execution == ExecutionMode::Native)
             {
                 ScopedOutputSuppression outputSuppressor;
                 AZ::Outcome<ScriptCanvas::Translation::LuaAssetResult, AZStd::string> luaAssetOutcome = AZ::Failure(AZStd::string("lua asset creation failed"));
@@ -294,6 +295,13 @@ namespace ScriptCanvasEditor
                 }
                 else
                 {
+                    const bool isNativeGraphRegistered = runGraphSpec.runSpec.execution == ExecutionMode::Native && runGraphSpec.runSpec.m_nativeGraph;
+                    if (isNativeGraphRegistered)
+                    {
+                        Execution::RegisterNativeGraph(loadResult.m_runtimeAsset.GetId().m_guid, runGraphSpec.runSpec.m_nativeGraph
+                            , loadResult.m_runtimeAsset->m_runtimeData.m_input.m_sourceHash);
+                    }
+
                     loadResult.m_entity->Init();
                     reporter.SetGraph(loadResult.m_runtimeAsset.GetId());
 
@@ -327,13 +335,19 @@ namespace ScriptCanvasEditor
                     }
 
                     loadResult.m_entity->Deactivate();
+
+                    if (isNativeGraphRegistered)
+                    {
+                        Execution::UnregisterNativeGraph(loadResult.m_runtimeAsset.GetId().m_guid);
+                    }
+
                     reporter.CollectPerformanceTiming();
                     reporter.FinishReport();
                     loadResult.m_entity.reset();
                 }
             }
 
-            if (runGraphSpec.runSpec.execution == ExecutionMode::Interpreted)
+            if (runGraphSpec.runSpec.execution == ExecutionMode::Interpreted || runGraphSpec.runSpec.execution == ExecutionMode::Native)
             {
                 AZ::ScriptSystemRequestBus::Broadcast(&AZ::ScriptSystemRequests::ClearAssetReferences, loadResult.m_scriptAsset.GetId());
 
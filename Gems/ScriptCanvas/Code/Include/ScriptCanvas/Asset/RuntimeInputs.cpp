@@ -49,6 +49,7 @@ namespace ScriptCanvas
             m_variables = AZStd::move(rhs.m_variables);
             m_entityIds = AZStd::move(rhs.m_entityIds);
             m_staticVariables = AZStd::move(rhs.m_staticVariables);
+            m_sourceHash = rhs.m_sourceHash;
         }
 
         return *this;
@@ -64,7 +65,8 @@ namespace ScriptCanvas
                 ->Field("nodeables", &RuntimeInputs::m_nodeables)
                 ->Field("variables", &RuntimeInputs::m_variables)
                 ->Field("entityIds", &RuntimeInputs::m_entityIds)
-                ->Field("staticVariables", &RuntimeInputs::m_staticVariables);
+                ->Field("staticVariables", &RuntimeInputs::m_staticVariables)
+                ->Field("sourceHash", &RuntimeInputs::m_sourceHash);
         }
     }
 } // namespace ScriptCanvas
@@ -46,6 +46,10 @@ namespace ScriptCanvas
         // when the system can't pass in the input from C++.
         AZStd::vector<AZStd::pair<VariableId, AZStd::any>> m_staticVariables;
 
+        // Hash of the Lua translation of the graph. Native C++ translations register the hash of the translation they were written with,
+        // and only run in place of the Lua translation while it matches.
+        AZ::u32 m_sourceHash = 0;
+
         RuntimeInputs() = default;
         RuntimeInputs(const RuntimeInputs&) = default;
         RuntimeInputs(RuntimeInputs&&);
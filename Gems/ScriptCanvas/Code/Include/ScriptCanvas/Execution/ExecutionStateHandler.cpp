@@ -91,7 +91,23 @@ namespace ScriptCanvas
         AZ_PROFILE_SCOPE(ScriptCanvas, "ExecutionStateHandler::Initialize (%s)", overrides.m_runtimeAsset.GetId().ToString<AZStd::string>().c_str());
 
         ExecutionStateConfig config(overrides, AZStd::move(userData));
-        m_executionState = overrides.m_runtimeAsset.Get()->m_runtimeData.m_createExecution(m_executionStateStorage, config);
+
+        // a C++ translation of the graph compiled into a gem module takes the place of the interpreted one, unless the graph has changed since
+        const RuntimeData& runtimeData = overrides.m_runtimeAsset.Get()->m_runtimeData;
+        const Execution::NativeGraphRegistration nativeGraph = Execution::FindNativeGraph(overrides.m_runtimeAsset.GetId().m_guid);
+        if (nativeGraph.m_factory && nativeGraph.m_sourceHash == runtimeData.m_input.m_sourceHash)
+        {
+            m_executionState = Execution::CreateNative(m_executionStateStorage, config, nativeGraph.m_factory);
+        }
+        else
+        {
+            AZ_Warning("ScriptCanvas", !nativeGraph.m_factory
+                , "ExecutionStateHandler::Initialize the native translation of %s-%s is out of date with its runtime asset, the graph will run through Lua"
+                , overrides.m_runtimeAsset.GetId().ToString<AZStd::string>().data()
+                , overrides.m_runtimeAsset.GetHint().c_str());
+
+            m_executionState = runtimeData.m_createExecution(m_executionStateStorage, config);
+        }
 
 #if defined(SC_RUNTIME_CHECKS_ENABLED)
         if (!m_executionState)
@@ -12,6 +12,12 @@ namespace ScriptCanvas
 {
     namespace Execution
     {
+        ExecutionState* CreateNative(StateStorage& storage, ExecutionStateConfig& config, NativeGraphFactory factory)
+        {
+            new (&storage.data) ExecutionStateNative(config, factory);
+            return reinterpret_cast<ExecutionState*>(&storage.data);
+        }
+
         ExecutionState* CreatePerActivation(StateStorage& storage, ExecutionStateConfig& config)
         {
             new (&storage.data) ExecutionStateInterpretedPerActivation(config);
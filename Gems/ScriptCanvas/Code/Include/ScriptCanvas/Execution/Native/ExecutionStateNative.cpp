@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>
+#include <ScriptCanvas/Execution/RuntimeComponent.h>
+
+namespace ExecutionStateNativeCpp
+{
+    using namespace ScriptCanvas;
+
+    constexpr const char* k_registryName = "ScriptCanvasNativeGraphRegistry";
+
+    struct NativeGraphRegistry
+    {
+        AZStd::mutex m_mutex;
+        AZStd::unordered_map<AZ::Uuid, Execution::NativeGraphRegistration> m_graphs;
+    };
+
+    // only set in the ScriptCanvas module, the other modules find the registry through the environment
+    static AZ::EnvironmentVariable<NativeGraphRegistry> s_registry;
+
+    AZ::EnvironmentVariable<NativeGraphRegistry> FindRegistry()
+    {
+        return AZ::Environment::FindVariable<NativeGraphRegistry>(k_registryName);
+    }
+
+    AZ::BehaviorContext* GetBehaviorContext()
+    {
+        AZ::BehaviorContext* behaviorContext = nullptr;
+        AZ::ComponentApplicationBus::BroadcastResult(behaviorContext, &AZ::ComponentApplicationRequests::GetBehaviorContext);
+        return behaviorContext;
+    }
+
+    const AZ::BehaviorMethod* FindClassMethod(const AZ::BehaviorClass& behaviorClass, const char* methodName)
+    {
+        auto methodIter = behaviorClass.m_methods.find(methodName);
+        return methodIter != behaviorClass.m_methods.end() ? methodIter->second : nullptr;
+    }
+}
+
+namespace ScriptCanvas
+{
+    namespace Execution
+    {
+        bool NativeGraph::ConnectTo(EBusHandler& handler, const Datum& address)
+        {
+            AZ::BehaviorArgument busId;
+            busId.m_typeId = address.GetType().GetAZType();
+            busId.m_value = const_cast<void*>(address.GetAsDanger());
+            return handler.ConnectTo(busId);
+        }
+
+        AZStd::unique_ptr<EBusHandler> NativeGraph::CreateEBusHandler(ExecutionStateNative& executionState, const char* busName)
+        {
+            return AZStd::make_unique<EBusHandler>(executionState.WeakFromThis(), busName, ExecutionStateNativeCpp::GetBehaviorContext());
+        }
+
+        const AZ::BehaviorMethod* NativeGraph::FindMethod(const char* className, const char* methodName)
+        {
+            AZ::BehaviorContext* behaviorContext = ExecutionStateNativeCpp::GetBehaviorContext();
+            if (!behaviorContext)
+            {
+                return nullptr;
+            }
+
+            auto classIter = behaviorContext->m_classes.find(className);
+            if (classIter != behaviorContext->m_classes.end())
+            {
+                if (auto method = ExecutionStateNativeCpp::FindClassMethod(*classIter->second, methodName))
+                {
+                    return method;
+                }
+            }
+
+            auto methodIter = behaviorContext->m_methods.find(methodName);
+            return methodIter != behaviorContext->m_methods.end() ? methodIter->second : nullptr;
+        }
+
+        const AZ::BehaviorMethod* NativeGraph::FindMemberMethod(const char* typeIdString, const char* methodName)
+        {
+            AZ::BehaviorContext* behaviorContext = ExecutionStateNativeCpp::GetBehaviorContext();
+            if (!behaviorContext)
+            {
+                return nullptr;
+            }
+
+            auto classIter = behaviorContext->m_typeToClassMap.find(AZ::Uuid::CreateString(typeIdString));
+            return classIter != behaviorContext->m_typeToClassMap.end()
+                ? ExecutionStateNativeCpp::FindClassMethod(*classIter->second, methodName)
+                : nullptr;
+        }
+
+        const AZ::BehaviorMethod* NativeGraph::FindEvent(const char* busName, const char* eventName, EventType eventType)
+        {
+            AZ::BehaviorContext* behaviorContext = ExecutionStateNativeCpp::GetBehaviorContext();
+            if (!behaviorContext)
+            {
+                return nullptr;
+            }
+
+            auto ebusIter = behaviorContext->m_ebuses.find(busName);
+            if (ebusIter == behaviorContext->m_ebuses.end())
+            {
+                return nullptr;
+            }
+
+            auto eventIter = ebusIter->second->m_events.find(eventName);
+            if (eventIter == ebusIter->second->m_events.end())
+            {
+                return nullptr;
+            }
+
+            switch (eventType)
+            {
+            case EventType::Broadcast:
+                return eventIter->second.m_broadcast;
+            case EventType::BroadcastQueue:
+                return eventIter->second.m_queueBroadcast;
+            case EventType::Event:
+                return eventIter->second.m_event;
+            case EventType::EventQueue:
+                return eventIter->second.m_queueEvent;
+            default:
+                return nullptr;
+            }
+        }
+
+        void InitNativeGraphRegistry()
+        {
+            AZ_Assert(!ExecutionStateNativeCpp::s_registry.IsConstructed(), "native graph registry is already initialized");
+            ExecutionStateNativeCpp::s_registry = AZ::Environment::CreateVariable<ExecutionStateNativeCpp::NativeGraphRegistry>(ExecutionStateNativeCpp::k_registryName);
+        }
+
+        void ResetNativeGraphRegistry()
+        {
+            ExecutionStateNativeCpp::s_registry.Reset();
+        }
+
+        void RegisterNativeGraph(const AZ::Uuid& sourceAssetId, NativeGraphFactory factory, AZ::u32 sourceHash)
+        {
+            auto registry = ExecutionStateNativeCpp::FindRegistry();
+            if (!registry.IsConstructed())
+            {
+                AZ_Error("ScriptCanvas", false, "RegisterNativeGraph called for %s before the ScriptCanvas module was loaded, the graph will run through Lua"
+                    , sourceAssetId.ToString<AZStd::string>().c_str());
+                return;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(registry->m_mutex);
+            registry->m_graphs[sourceAssetId] = NativeGraphRegistration{ factory, sourceHash };
+        }
+
+        void UnregisterNativeGraph(const AZ::Uuid& sourceAssetId)
+        {
+            // the ScriptCanvas module may already have released the registry on shutdown
+            auto registry = ExecutionStateNativeCpp::FindRegistry();
+            if (registry.IsConstructed())
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(registry->m_mutex);
+                registry->m_graphs.erase(sourceAssetId);
+            }
+        }
+
+        NativeGraphRegistration FindNativeGraph(const AZ::Uuid& sourceAssetId)
+        {
+            auto registry = ExecutionStateNativeCpp::FindRegistry();
+            if (!registry.IsConstructed())
+            {
+                return {};
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(registry->m_mutex);
+            auto iter = registry->m_graphs.find(sourceAssetId);
+            return iter != registry->m_graphs.end() ? iter->second : NativeGraphRegistration{};
+        }
+    }
+
+    ExecutionStateNative::ExecutionStateNative(ExecutionStateConfig& config, Execution::NativeGraphFactory factory)
+        : ExecutionState(config)
+        , m_graph(factory())
+    {}
+
+    ExecutionStateNative::~ExecutionStateNative()
+    {
+        if (m_deactivationRequired)
+        {
+            StopExecution();
+        }
+    }
+
+    void ExecutionStateNative::Execute()
+    {
+        if (m_graph)
+        {
+            m_graph->OnGraphStart();
+        }
+    }
+
+    ExecutionMode ExecutionStateNative::GetExecutionMode() const
+    {
+        return ExecutionMode::Native;
+    }
+
+    AZ::EntityId ExecutionStateNative::GetSelfEntityId() const
+    {
+        auto reference = AZStd::any_cast<const RuntimeComponentUserData>(&GetUserData());
+        return reference ? reference->entity : AZ::EntityId();
+    }
+
+    void ExecutionStateNative::Initialize()
+    {
+        Execution::ActivationInputArray storage;
+        Execution::ActivationData data(GetRuntimeDataOverrides(), storage);
+        Execution::ActivationInputRange range = Execution::Context::CreateActivateInputRange(data);
+
+        if (!m_graph || !m_graph->Initialize(*this, range))
+        {
+            AZ_Error("ScriptCanvas", false, "ExecutionStateNative::Initialize native graph for AssetId: %s failed to initialize, script will not run"
+                , GetAssetId().ToString<AZStd::string>().c_str());
+            m_graph.reset();
+            return;
+        }
+
+        m_deactivationRequired = true;
+    }
+
+    void ExecutionStateNative::StopExecution()
+    {
+        if (m_graph)
+        {
+            m_graph->Stop();
+        }
+
+        m_deactivationRequired = false;
+    }
+}
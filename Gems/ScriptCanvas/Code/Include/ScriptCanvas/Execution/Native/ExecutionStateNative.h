@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <ScriptCanvas/Core/Core.h>
+#include <ScriptCanvas/Core/Datum.h>
+#include <ScriptCanvas/Core/EBusHandler.h>
+#include <ScriptCanvas/Execution/ExecutionContext.h>
+#include <ScriptCanvas/Execution/ExecutionState.h>
+
+namespace ScriptCanvas
+{
+    class ExecutionStateNative;
+
+    namespace Execution
+    {
+        /// <summary>
+        /// \class NativeGraph - the base class of the C++ translations of graphs, as written by Translation::GraphToCPlusPlus. The translations
+        /// are compiled into a gem module, which registers them by the source asset id of their graph. When a graph has a registered
+        /// translation, it is executed by an ExecutionStateNative instead of the interpreted Lua translation.
+        /// All values are held in Datums, and all the calls into BehaviorContext methods are resolved once, on initialization. The calls bind
+        /// their arguments by the types of the method parameters, which the translation reads from the BehaviorContext.
+        /// </summary>
+        class NativeGraph
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(NativeGraph, AZ::SystemAllocator, 0);
+
+            virtual ~NativeGraph() = default;
+
+            /// Resolves the BehaviorContext methods the graph calls, takes the values of its variables from the activation inputs, and
+            /// connects the handlers that start connected. Returns false if anything the graph requires is missing from the BehaviorContext.
+            virtual bool Initialize(ExecutionStateNative& executionState, const ActivationInputRange& inputs) = 0;
+
+            virtual void OnGraphStart() {}
+
+            virtual void Stop() {}
+
+            /// Finds the method of the class by the name, or the global method if the class name is empty or not found.
+            /// The translation finds the methods the same way, to write the types of their parameters.
+            static const AZ::BehaviorMethod* FindMethod(const char* className, const char* methodName);
+
+            static const AZ::BehaviorMethod* FindMemberMethod(const char* typeIdString, const char* methodName);
+
+            static const AZ::BehaviorMethod* FindEvent(const char* busName, const char* eventName, EventType eventType);
+
+        protected:
+            /// Calls the method with the arguments bound as they are, their types must match the parameters of the method.
+            template<typename... Args>
+            static void Invoke(const AZ::BehaviorMethod* method, Args&&... arguments);
+
+            /// As above, and returns the result of the method as the type R.
+            template<typename R, typename... Args>
+            static R InvokeResult(const AZ::BehaviorMethod* method, Args&&... arguments);
+
+            static bool ConnectTo(EBusHandler& handler, const Datum& address);
+
+            static AZStd::unique_ptr<EBusHandler> CreateEBusHandler(ExecutionStateNative& executionState, const char* busName);
+        };
+
+        template<typename... Args>
+        void NativeGraph::Invoke(const AZ::BehaviorMethod* method, Args&&... arguments)
+        {
+            SC_RUNTIME_CHECK(method, "NativeGraph::Invoke called without a method, check the initialization of the graph");
+
+            if (!method->Invoke(AZStd::forward<Args>(arguments)...))
+            {
+                AZ_Error("ScriptCanvas", false, "NativeGraph::Invoke failed to call %s, the arguments do not match its parameters", method->m_name.c_str());
+            }
+        }
+
+        template<typename R, typename... Args>
+        R NativeGraph::InvokeResult(const AZ::BehaviorMethod* method, Args&&... arguments)
+        {
+            SC_RUNTIME_CHECK(method, "NativeGraph::InvokeResult called without a method, check the initialization of the graph");
+
+            R result{};
+
+            if (!method->InvokeResult(result, AZStd::forward<Args>(arguments)...))
+            {
+                AZ_Error("ScriptCanvas", false, "NativeGraph::InvokeResult failed to call %s, the arguments or the result do not match its signature"
+                    , method->m_name.c_str());
+            }
+
+            return result;
+        }
+
+        using NativeGraphFactory = NativeGraph*(*)();
+
+        /// A registered translation, with the hash of the Lua translation of the graph it was written with, see RuntimeInputs::m_sourceHash.
+        struct NativeGraphRegistration
+        {
+            NativeGraphFactory m_factory = nullptr;
+            AZ::u32 m_sourceHash = 0;
+        };
+
+        /// The registry is owned by the ScriptCanvas module, which creates it when it is loaded and releases it when it is unloaded.
+        void InitNativeGraphRegistry();
+
+        void ResetNativeGraphRegistry();
+
+        /// The registry is shared by all modules, so the graphs registered by a gem module are found by the ScriptCanvas runtime. Gem modules
+        /// register their graphs once the ScriptCanvas module is loaded, on the activation of one of their system components.
+        /// The graph only runs the translation while @sourceHash matches the hash in its runtime asset, so a graph modified after it was
+        /// translated runs through Lua until the translation is written and compiled again.
+        void RegisterNativeGraph(const AZ::Uuid& sourceAssetId, NativeGraphFactory factory, AZ::u32 sourceHash);
+
+        void UnregisterNativeGraph(const AZ::Uuid& sourceAssetId);
+
+        /// Returns an empty registration if no translation is registered for the graph.
+        NativeGraphRegistration FindNativeGraph(const AZ::Uuid& sourceAssetId);
+    }
+
+    class ExecutionStateNative
+        : public ExecutionState
+    {
+    public:
+        AZ_RTTI(ExecutionStateNative, "{6B8C2B0F-0E4A-4B4D-9F3B-5C1A9E7D2F64}", ExecutionState);
+        AZ_CLASS_ALLOCATOR(ExecutionStateNative, AZ::SystemAllocator, 0);
+
+        ExecutionStateNative(ExecutionStateConfig& config, Execution::NativeGraphFactory factory);
+
+        ~ExecutionStateNative() override;
+
+        void Execute() override;
+
+        ExecutionMode GetExecutionMode() const override;
+
+        // #scriptcanvas_component_extension
+        AZ::EntityId GetSelfEntityId() const;
+
+        void Initialize() override;
+
+        void StopExecution() override;
+
+    private:
+        AZStd::unique_ptr<Execution::NativeGraph> m_graph;
+        bool m_deactivationRequired = false;
+    };
+}
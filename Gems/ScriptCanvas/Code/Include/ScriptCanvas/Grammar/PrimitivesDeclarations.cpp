@@ -18,6 +18,7 @@ namespace ScriptCanvas
         AZ_CVAR(bool, g_processingErrorsForUnitTestsEnabled, false, {}, AZ::ConsoleFunctorFlags::Null, "Enable AP processing errors on parse failure for unit tests.");
         AZ_CVAR(bool, g_saveRawTranslationOuputToFile, true, {}, AZ::ConsoleFunctorFlags::Null, "Save out the raw result of translation for debug purposes.");
         AZ_CVAR(bool, g_saveRawTranslationOuputToFileAtPrefabTime, false, {}, AZ::ConsoleFunctorFlags::Null, "Save out the raw result of translation (at prefab time) for debug purposes.");
+        AZ_CVAR(bool, g_translateToNative, false, {}, AZ::ConsoleFunctorFlags::Null, "Also translate graphs to C++, saved with the raw translation output, for compilation into a gem module that registers them.");
 
         SettingsCache::SettingsCache()
         {
@@ -0,0 +1,1567 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <clocale>
+
+#include <ScriptCanvas/Core/Node.h>
+#include <ScriptCanvas/Data/Constants.h>
+#include <ScriptCanvas/Data/Data.h>
+#include <ScriptCanvas/Debugger/ValidationEvents/ParsingValidation/ParsingValidations.h>
+#include <ScriptCanvas/Execution/ExecutionState.h>
+#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>
+#include <ScriptCanvas/Grammar/AbstractCodeModel.h>
+#include <ScriptCanvas/Grammar/ParsingUtilities.h>
+#include <ScriptCanvas/Grammar/Primitives.h>
+#include <ScriptCanvas/Grammar/PrimitivesExecution.h>
+#include <ScriptCanvas/Libraries/String/Format.h>
+#include <ScriptCanvas/Libraries/String/Print.h>
+#include <ScriptCanvas/Results/ErrorText.h>
+
+#include <ScriptCanvas/Translation/GraphToCPlusPlus.h>
+
+namespace GraphToCPlusPlusCpp
+{
+    using namespace ScriptCanvas;
+
+    constexpr const char* k_datum = "ScriptCanvas::Datum";
+    constexpr const char* k_booleanType = "ScriptCanvas::Data::BooleanType";
+    constexpr const char* k_numberType = "ScriptCanvas::Data::NumberType";
+    constexpr const char* k_stringType = "ScriptCanvas::Data::StringType";
+    constexpr const char* k_selfEntityIdName = "m_selfEntityId";
+
+    class ScopedLocale
+    {
+    public:
+        ScopedLocale()
+        {
+            m_previousLocale = std::setlocale(LC_NUMERIC, "C");
+        }
+
+        ~ScopedLocale()
+        {
+            std::setlocale(LC_NUMERIC, m_previousLocale);
+        }
+
+    private:
+        char* m_previousLocale = nullptr;
+    };
+
+    AZStd::string NotSupported(AZStd::string_view construct)
+    {
+        return AZStd::string::format("%.*s is not supported by the native C++ translation", aznumeric_cast<int>(construct.size()), construct.data());
+    }
+
+    AZStd::string ToStringLiteral(AZStd::string_view value)
+    {
+        AZStd::string literal = "\"";
+
+        for (char character : value)
+        {
+            switch (character)
+            {
+            case '"':
+                literal += "\\\"";
+                break;
+            case '\\':
+                literal += "\\\\";
+                break;
+            case '\n':
+                literal += "\\n";
+                break;
+            case '\r':
+                literal += "\\r";
+                break;
+            case '\t':
+                literal += "\\t";
+                break;
+            default:
+                literal += character;
+                break;
+            }
+        }
+
+        literal += "\"";
+        return literal;
+    }
+
+    // the exponent notation keeps the literals valid with any value, and lossless for the type
+    AZStd::string ToFloatLiteral(float value)
+    {
+        return AZStd::string::format("%.9ef", value);
+    }
+
+    AZStd::string ToDoubleLiteral(double value)
+    {
+        return AZStd::string::format("%.17e", value);
+    }
+
+    AZStd::string ToTypedDatum(AZStd::string_view typeName, AZStd::string_view value)
+    {
+        return AZStd::string::format("%s(%.*s(%.*s))", k_datum
+            , aznumeric_cast<int>(typeName.size()), typeName.data()
+            , aznumeric_cast<int>(value.size()), value.data());
+    }
+
+    struct NativeType
+    {
+        AZ::Uuid m_typeId;
+        const char* m_name = nullptr;
+        bool m_isNumber = false;
+    };
+
+    // the types of the parameters and results of BehaviorContext methods that the calls of the translation bind directly
+    const NativeType* FindNativeType(const AZ::Uuid& typeId)
+    {
+        static const NativeType k_types[] =
+        {
+            { azrtti_typeid<bool>(), "bool", false },
+            { azrtti_typeid<double>(), "double", true },
+            { azrtti_typeid<float>(), "float", true },
+            { azrtti_typeid<AZ::s8>(), "AZ::s8", true },
+            { azrtti_typeid<AZ::u8>(), "AZ::u8", true },
+            { azrtti_typeid<AZ::s16>(), "AZ::s16", true },
+            { azrtti_typeid<AZ::u16>(), "AZ::u16", true },
+            { azrtti_typeid<AZ::s32>(), "AZ::s32", true },
+            { azrtti_typeid<AZ::u32>(), "AZ::u32", true },
+            { azrtti_typeid<AZ::s64>(), "AZ::s64", true },
+            { azrtti_typeid<AZ::u64>(), "AZ::u64", true },
+            { azrtti_typeid<AZStd::string>(), "AZStd::string", false },
+            { azrtti_typeid<AZ::Aabb>(), "AZ::Aabb", false },
+            { azrtti_typeid<AZ::Color>(), "AZ::Color", false },
+            { azrtti_typeid<AZ::Crc32>(), "AZ::Crc32", false },
+            { azrtti_typeid<AZ::Data::AssetId>(), "AZ::Data::AssetId", false },
+            { azrtti_typeid<AZ::EntityId>(), "AZ::EntityId", false },
+            { azrtti_typeid<AZ::Matrix3x3>(), "AZ::Matrix3x3", false },
+            { azrtti_typeid<AZ::Matrix4x4>(), "AZ::Matrix4x4", false },
+            { azrtti_typeid<AZ::NamedEntityId>(), "AZ::NamedEntityId", false },
+            { azrtti_typeid<AZ::Obb>(), "AZ::Obb", false },
+            { azrtti_typeid<AZ::Plane>(), "AZ::Plane", false },
+            { azrtti_typeid<AZ::Quaternion>(), "AZ::Quaternion", false },
+            { azrtti_typeid<AZ::Transform>(), "AZ::Transform", false },
+            { azrtti_typeid<AZ::Vector2>(), "AZ::Vector2", false },
+            { azrtti_typeid<AZ::Vector3>(), "AZ::Vector3", false },
+            { azrtti_typeid<AZ::Vector4>(), "AZ::Vector4", false },
+        };
+
+        auto iter = AZStd::find_if(AZStd::begin(k_types), AZStd::end(k_types), [&typeId](const NativeType& type) { return type.m_typeId == typeId; });
+        return iter != AZStd::end(k_types) ? iter : nullptr;
+    }
+
+    // pointers are only bound for the execution state
+    const NativeType* FindNativeType(const AZ::BehaviorParameter& parameter)
+    {
+        return (parameter.m_traits & AZ::BehaviorParameter::TR_POINTER) ? nullptr : FindNativeType(parameter.m_typeId);
+    }
+
+    AZStd::string ToHandlerMemberName(AZStd::string_view handlerName)
+    {
+        AZStd::string memberName = Grammar::ToIdentifier(handlerName);
+        if (!memberName.starts_with(Grammar::k_memberNamePrefix))
+        {
+            memberName.insert(0, Grammar::k_memberNamePrefix);
+        }
+
+        return memberName;
+    }
+}
+
+namespace ScriptCanvas
+{
+    namespace Translation
+    {
+        Configuration CreateCPlusPlusConfig([[maybe_unused]] const Grammar::AbstractCodeModel& source)
+        {
+            Configuration configuration;
+            configuration.m_blockCommentClose = "*/";
+            configuration.m_blockCommentOpen = "/*";
+            configuration.m_dependencyDelimiter = "/";
+            configuration.m_executionStateName = "executionState";
+            configuration.m_executionStateReferenceGraph = "m_executionState";
+            configuration.m_executionStateReferenceLocal = configuration.m_executionStateName;
+            configuration.m_executionStateScriptCanvasIdName = "m_scriptCanvasId";
+            configuration.m_functionBlockClose = "}";
+            configuration.m_functionBlockOpen = "{";
+            configuration.m_lexicalScopeDelimiter = "::";
+            configuration.m_lexicalScopeVariable = ".";
+            configuration.m_namespaceClose = "}";
+            configuration.m_namespaceOpen = "{";
+            configuration.m_namespaceOpenPrefix = "namespace";
+            configuration.m_scopeClose = "}";
+            configuration.m_scopeOpen = "{";
+            configuration.m_singleLineComment = "//";
+            configuration.m_suffix = Grammar::k_internalRuntimeSuffix;
+
+            // #scriptcanvas_component_extension
+            configuration.m_executionStateEntityIdRefInitialization = "executionState.GetSelfEntityId()";
+            configuration.m_executionStateEntityIdRef = GraphToCPlusPlusCpp::k_selfEntityIdName;
+            return configuration;
+        }
+
+        GraphToCPlusPlus::GraphToCPlusPlus(const Grammar::AbstractCodeModel& source, AZ::u32 sourceHash)
+            : GraphToX(CreateCPlusPlusConfig(source), source)
+            , m_sourceHash(sourceHash)
+        {
+            MarkTranslationStart();
+
+            m_className = Grammar::ToSafeName(m_model.GetSource().m_name);
+            // the definitions are written inside the namespace of the .cpp file
+            m_body.Indent();
+
+            TranslateBody();
+            WriteClassDeclaration();
+            WriteClassDefinition();
+
+            MarkTranslationStop();
+        }
+
+        AZStd::string GraphToCPlusPlus::AddLiteral(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr input)
+        {
+            auto iter = m_literalNames.find(input);
+            if (iter != m_literalNames.end())
+            {
+                return iter->second;
+            }
+
+            // a Datum is constructed once for every literal, instead of on every call that uses it
+            Member literal;
+            literal.m_name = AZStd::string::format("m_literal_%zu", m_literals.size());
+            literal.m_initializer = ToValueString(execution, input->m_datum);
+            m_literalNames.emplace(input, literal.m_name);
+            m_literals.push_back(literal);
+            return literal.m_name;
+        }
+
+        AZStd::string GraphToCPlusPlus::AddMethod(Grammar::ExecutionTreeConstPtr execution, const AZ::BehaviorMethod*& method)
+        {
+            const AZStd::string& name = execution->GetName();
+            const AZStd::string methodName = GraphToCPlusPlusCpp::ToStringLiteral(name);
+            const Grammar::LexicalScope& lexicalScope = execution->GetNameLexicalScope();
+            AZStd::string initializer;
+            method = nullptr;
+
+            // the method is found at translation time as it is on initialization, for the types of its parameters
+            if (execution->GetEventType() != EventType::Count)
+            {
+                if (lexicalScope.m_namespaces.empty())
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), "EBus event call is missing the name of the bus"));
+                    return {};
+                }
+
+                const char* eventType = "";
+                switch (execution->GetEventType())
+                {
+                case EventType::Broadcast:
+                    eventType = "Broadcast";
+                    break;
+                case EventType::BroadcastQueue:
+                    eventType = "BroadcastQueue";
+                    break;
+                case EventType::Event:
+                    eventType = "Event";
+                    break;
+                case EventType::EventQueue:
+                    eventType = "EventQueue";
+                    break;
+                default:
+                    break;
+                }
+
+                const AZStd::string& busName = lexicalScope.m_namespaces.back();
+                initializer = AZStd::string::format("FindEvent(%s, %s, ScriptCanvas::EventType::%s)"
+                    , GraphToCPlusPlusCpp::ToStringLiteral(busName).c_str(), methodName.c_str(), eventType);
+                method = Execution::NativeGraph::FindEvent(busName.c_str(), name.c_str(), execution->GetEventType());
+            }
+            else if (lexicalScope.m_type == Grammar::LexicalScopeType::Variable)
+            {
+                if (execution->GetInputCount() == 0)
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), "Member function call is missing the object it is called on"));
+                    return {};
+                }
+
+                const AZStd::string typeId = execution->GetInput(0).m_value->m_datum.GetType().GetAZType().ToString<AZStd::string>();
+                initializer = AZStd::string::format("FindMemberMethod(\"%s\", %s)", typeId.c_str(), methodName.c_str());
+                method = Execution::NativeGraph::FindMemberMethod(typeId.c_str(), name.c_str());
+            }
+            else
+            {
+                const AZStd::string className = lexicalScope.m_namespaces.empty() ? "" : lexicalScope.m_namespaces.back();
+                initializer = AZStd::string::format("FindMethod(%s, %s)", GraphToCPlusPlusCpp::ToStringLiteral(className).c_str(), methodName.c_str());
+                method = Execution::NativeGraph::FindMethod(className.c_str(), name.c_str());
+            }
+
+            if (!method)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId()
+                    , AZStd::string::format("Method %s was not found in the BehaviorContext", name.c_str())));
+                return {};
+            }
+
+            auto iter = AZStd::find_if(m_methods.begin(), m_methods.end(), [&initializer](const Member& member) { return member.m_initializer == initializer; });
+            if (iter != m_methods.end())
+            {
+                return iter->m_name;
+            }
+
+            Member member;
+            member.m_name = AZStd::string::format("m_method_%zu", m_methods.size());
+            member.m_initializer = AZStd::move(initializer);
+            m_methods.push_back(member);
+            return member.m_name;
+        }
+
+        bool GraphToCPlusPlus::IsExecutionStateInput(Grammar::VariableConstPtr input, Grammar::ExecutionTreeConstPtr execution)
+        {
+            // the hidden input of the methods that take the execution state, the Lua translation passes the execution state for it as well
+            auto entityId = input->m_datum.GetAs<Data::EntityIDType>();
+            return entityId && *entityId == UniqueId && IsInputNamed(input, execution) == IsNamed::No;
+        }
+
+        GraphToCPlusPlus::IsNamed GraphToCPlusPlus::IsInputNamed(Grammar::VariableConstPtr input, Grammar::ExecutionTreeConstPtr execution)
+        {
+            return input->m_source != execution || input->m_requiresCreationFunction ? IsNamed::Yes : IsNamed::No;
+        }
+
+        bool GraphToCPlusPlus::IsSupported(Grammar::ExecutionTreeConstPtr execution)
+        {
+            using namespace GraphToCPlusPlusCpp;
+
+            AZStd::string_view construct;
+
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::Cycle:
+                construct = "Cycle";
+                break;
+            case Grammar::Symbol::ForEach:
+                construct = "ForEach";
+                break;
+            case Grammar::Symbol::RandomSwitch:
+                construct = "Random switch";
+                break;
+            case Grammar::Symbol::Switch:
+                construct = "Switch";
+                break;
+            case Grammar::Symbol::UserOut:
+                construct = "User out";
+                break;
+            default:
+                break;
+            }
+
+            if (construct.empty())
+            {
+                if (execution->GetNodeable())
+                {
+                    construct = "Node with a nodeable";
+                }
+                else if (!execution->GetInternalOuts().empty())
+                {
+                    construct = "Node with internal outs";
+                }
+                else if (!execution->GetConversions().empty())
+                {
+                    construct = "Input conversion";
+                }
+                else if (Grammar::IsEventConnectCall(execution) || Grammar::IsEventDisconnectCall(execution))
+                {
+                    construct = "AZ::Event handling";
+                }
+                else if (Grammar::IsExecutedPropertyExtraction(execution))
+                {
+                    construct = "Property extraction";
+                }
+                else if (Grammar::IsWrittenMathExpression(execution))
+                {
+                    construct = "Math expression";
+                }
+                else if (azrtti_istypeof<const Nodes::String::Format*>(execution->GetId().m_node)
+                    || azrtti_istypeof<const Nodes::String::Print*>(execution->GetId().m_node))
+                {
+                    // both are translated to calls of Lua functions
+                    construct = "String formatting";
+                }
+                else if (Grammar::IsGlobalPropertyRead(execution) || Grammar::IsClassPropertyRead(execution) || Grammar::IsClassPropertyWrite(execution))
+                {
+                    construct = "Property access";
+                }
+                else if (execution->GetChildrenCount() == 1 && execution->GetChild(0).m_output.size() > 1)
+                {
+                    construct = "Multiple outputs";
+                }
+            }
+
+            if (!construct.empty())
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), NotSupported(construct)));
+                return false;
+            }
+
+            return true;
+        }
+
+        TargetResult GraphToCPlusPlus::MoveResult(Writer& writer)
+        {
+            TargetResult result;
+            result.m_text = writer.MoveOutput();
+            result.m_runtimeInputs.CopyFrom(m_model.GetRuntimeInputs());
+            result.m_runtimeInputs.m_sourceHash = m_sourceHash;
+            result.m_debugMap = m_model.GetDebugMap();
+            result.m_subgraphInterface = m_model.GetInterface();
+            result.m_duration = GetTranslationDuration();
+            return result;
+        }
+
+        AZStd::string GraphToCPlusPlus::ToValueString(Grammar::ExecutionTreeConstPtr execution, const Datum& datum)
+        {
+            using namespace GraphToCPlusPlusCpp;
+
+            ScopedLocale scopedLocale;
+
+            switch (datum.GetType().GetType())
+            {
+            case Data::eType::BehaviorContextObject:
+                if (datum.GetType().GetAZType() != azrtti_typeid<ExecutionState>())
+                {
+                    // objects start as nil in the Lua translation
+                    return AZStd::string::format("%s()", k_datum);
+                }
+                break;
+
+            case Data::eType::Boolean:
+                return ToTypedDatum(k_booleanType, *datum.GetAs<Data::BooleanType>() ? "true" : "false");
+
+            case Data::eType::Color:
+            {
+                const auto value = datum.GetAs<Data::ColorType>();
+                return ToTypedDatum("ScriptCanvas::Data::ColorType", AZStd::string::format("%s, %s, %s, %s"
+                    , ToFloatLiteral(value->GetR()).c_str(), ToFloatLiteral(value->GetG()).c_str()
+                    , ToFloatLiteral(value->GetB()).c_str(), ToFloatLiteral(value->GetA()).c_str()));
+            }
+
+            case Data::eType::CRC:
+                return ToTypedDatum("ScriptCanvas::Data::CRCType", AZStd::string::format("AZ::u32(%u)", static_cast<AZ::u32>(*datum.GetAs<Data::CRCType>())));
+
+            // #scriptcanvas_component_extension
+            case Data::eType::EntityID:
+            {
+                const AZ::EntityId& value = *datum.GetAs<Data::EntityIDType>();
+                if (value == GraphOwnerId)
+                {
+                    return AZStd::string::format("%s(%s)", k_datum, m_configuration.m_executionStateEntityIdRef.data());
+                }
+                else if (value != UniqueId)
+                {
+                    // direct references are not supported, the invalid id is the only remaining option
+                    return ToTypedDatum("ScriptCanvas::Data::EntityIDType", "");
+                }
+                break;
+            }
+
+            case Data::eType::Number:
+                return ToTypedDatum(k_numberType, ToDoubleLiteral(*datum.GetAs<Data::NumberType>()));
+
+            case Data::eType::Quaternion:
+            {
+                const auto value = datum.GetAs<Data::QuaternionType>();
+                return ToTypedDatum("ScriptCanvas::Data::QuaternionType", AZStd::string::format("%s, %s, %s, %s"
+                    , ToFloatLiteral(value->GetX()).c_str(), ToFloatLiteral(value->GetY()).c_str()
+                    , ToFloatLiteral(value->GetZ()).c_str(), ToFloatLiteral(value->GetW()).c_str()));
+            }
+
+            case Data::eType::String:
+                return ToTypedDatum(k_stringType, ToStringLiteral(*datum.GetAs<Data::StringType>()));
+
+            case Data::eType::Vector2:
+            {
+                const auto value = datum.GetAs<Data::Vector2Type>();
+                return ToTypedDatum("ScriptCanvas::Data::Vector2Type", AZStd::string::format("%s, %s"
+                    , ToFloatLiteral(value->GetX()).c_str(), ToFloatLiteral(value->GetY()).c_str()));
+            }
+
+            case Data::eType::Vector3:
+            {
+                const auto value = datum.GetAs<Data::Vector3Type>();
+                return ToTypedDatum("ScriptCanvas::Data::Vector3Type", AZStd::string::format("%s, %s, %s"
+                    , ToFloatLiteral(value->GetX()).c_str(), ToFloatLiteral(value->GetY()).c_str(), ToFloatLiteral(value->GetZ()).c_str()));
+            }
+
+            case Data::eType::Vector4:
+            {
+                const auto value = datum.GetAs<Data::Vector4Type>();
+                return ToTypedDatum("ScriptCanvas::Data::Vector4Type", AZStd::string::format("%s, %s, %s, %s"
+                    , ToFloatLiteral(value->GetX()).c_str(), ToFloatLiteral(value->GetY()).c_str()
+                    , ToFloatLiteral(value->GetZ()).c_str(), ToFloatLiteral(value->GetW()).c_str()));
+            }
+
+            case Data::eType::Invalid:
+                break;
+
+            default:
+                if (datum.IsDefaultValue())
+                {
+                    return AZStd::string::format("%s(ScriptCanvas::Data::FromAZType(AZ::Uuid(\"%s\")), %s::eOriginality::Original)"
+                        , k_datum, datum.GetType().GetAZType().ToString<AZStd::string>().c_str(), k_datum);
+                }
+                break;
+            }
+
+            AddError(execution, aznew Internal::ParseError(execution ? execution->GetNodeId() : AZ::EntityId()
+                , NotSupported(AZStd::string::format("Value of type %s", Data::GetName(datum.GetType()).c_str()))));
+            return AZStd::string::format("%s()", k_datum);
+        }
+
+        AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> GraphToCPlusPlus::Translate(const Grammar::AbstractCodeModel& source, AZ::u32 sourceHash)
+        {
+            GraphToCPlusPlus translation(source, sourceHash);
+
+            if (translation.IsSuccessfull())
+            {
+                TargetResult dotH = translation.MoveResult(translation.m_dotH);
+                TargetResult dotCPP = translation.MoveResult(translation.m_dotCPP);
+                return AZ::Success(AZStd::make_pair(AZStd::move(dotH), AZStd::move(dotCPP)));
+            }
+            else
+            {
+                return AZ::Failure(translation.MoveErrors());
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateBody()
+        {
+            using namespace GraphToCPlusPlusCpp;
+
+            if (!m_model.GetNodeableParse().empty())
+            {
+                AddError(nullptr, aznew Internal::ParseError(AZ::EntityId(), NotSupported("Node with a nodeable")));
+            }
+
+            if (!m_model.GetEventHandlings().empty())
+            {
+                AddError(nullptr, aznew Internal::ParseError(AZ::EntityId(), NotSupported("AZ::Event handling")));
+            }
+
+            if (m_model.IsUserNodeable())
+            {
+                AddError(nullptr, aznew Internal::ParseError(AZ::EntityId(), NotSupported("Graph used as a function by other graphs")));
+            }
+
+            if (!m_model.GetRuntimeInputs().m_staticVariables.empty())
+            {
+                AddError(nullptr, aznew Internal::ParseError(AZ::EntityId(), NotSupported("Variable with a static initializer")));
+            }
+
+            if (!IsSuccessfull())
+            {
+                return;
+            }
+
+            TranslateEBusHandling();
+            TranslateExecutionTrees();
+        }
+
+        void GraphToCPlusPlus::TranslateEBusHandling()
+        {
+            using namespace GraphToCPlusPlusCpp;
+
+            for (const auto& ebusHandling : m_model.GetEBusHandlings())
+            {
+                Handler handler;
+                handler.m_name = ToHandlerMemberName(ebusHandling->m_handlerName);
+                handler.m_busName = ebusHandling->m_ebusName;
+                handler.m_startsConnected = ebusHandling->m_startsConnected;
+
+                if (ebusHandling->m_isAddressed && ebusHandling->m_startsConnected)
+                {
+                    handler.m_address = ebusHandling->m_startingAdress->m_name;
+                }
+
+                for (const auto& nameAndEventThread : ebusHandling->m_events)
+                {
+                    const Grammar::ExecutionTreeConstPtr& eventThread = nameAndEventThread.second;
+
+                    if (eventThread->HasReturnValues())
+                    {
+                        AddError(eventThread, aznew Internal::ParseError(ebusHandling->m_node->GetEntityId(), NotSupported("Handled event with a result")));
+                        continue;
+                    }
+
+                    AZStd::optional<size_t> eventIndex = ebusHandling->m_node->GetEventIndex(nameAndEventThread.first);
+                    if (!eventIndex)
+                    {
+                        AddError(nullptr,
+                            aznew Internal::ParseError(
+                                ebusHandling->m_node->GetEntityId()
+                                , AZStd::string::format
+                                    ( "EBus Handler %s did not return a valid index for event %s"
+                                    , ebusHandling->m_ebusName.c_str()
+                                    , nameAndEventThread.first.c_str())));
+                        return;
+                    }
+
+                    HandledEvent handledEvent;
+                    handledEvent.m_eventIndex = *eventIndex;
+                    handledEvent.m_functionName = AZStd::string::format("%s_%s", handler.m_name.c_str() + AZStd::string_view(Grammar::k_memberNamePrefix).size()
+                        , Grammar::ToIdentifier(nameAndEventThread.first).c_str());
+                    handledEvent.m_parameterCount = eventThread->GetChildrenCount() > 0 ? eventThread->GetChild(0).m_output.size() : 0;
+
+                    TranslateFunction(eventThread, handledEvent.m_functionName, IsNamed::No);
+                    handler.m_events.push_back(AZStd::move(handledEvent));
+                }
+
+                m_handlerNamesByGraphName.emplace(ebusHandling->m_handlerName, handler.m_name);
+                m_handlers.push_back(AZStd::move(handler));
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTreeChildren(Grammar::ExecutionTreeConstPtr execution, size_t startingIndex)
+        {
+            for (size_t childIndex = startingIndex; childIndex < execution->GetChildrenCount(); ++childIndex)
+            {
+                const auto& child = execution->GetChild(childIndex);
+
+                if (child.m_execution && !child.m_execution->IsInternalOut())
+                {
+                    TranslateExecutionTreeEntry(child.m_execution);
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (!IsSupported(execution))
+            {
+                return;
+            }
+
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::Break:
+                m_body.WriteLineIndented("break;");
+                break;
+
+            case Grammar::Symbol::IfCondition:
+            {
+                m_body.WriteIndented("if (");
+                WriteTypedInput(execution, 0, GraphToCPlusPlusCpp::k_booleanType);
+                m_body.WriteLine(")");
+                OpenScope(m_body);
+
+                if (execution->GetChildrenCount() > 0 && execution->GetChild(0).m_execution)
+                {
+                    TranslateExecutionTreeEntry(execution->GetChild(0).m_execution);
+                }
+
+                CloseScope(m_body);
+
+                if (execution->GetChildrenCount() > 1 && execution->GetChild(1).m_execution)
+                {
+                    m_body.WriteLineIndented("else");
+                    OpenScope(m_body);
+                    TranslateExecutionTreeEntry(execution->GetChild(1).m_execution);
+                    CloseScope(m_body);
+                }
+
+                return;
+            }
+
+            case Grammar::Symbol::While:
+            {
+                // the first child is the loop body, the rest execute after the loop
+                m_body.WriteIndented("while (");
+                WriteTypedInput(execution, 0, GraphToCPlusPlusCpp::k_booleanType);
+                m_body.WriteLine(")");
+                OpenScope(m_body);
+
+                if (execution->GetChildrenCount() > 0 && execution->GetChild(0).m_execution)
+                {
+                    TranslateExecutionTreeEntry(execution->GetChild(0).m_execution);
+                }
+
+                CloseScope(m_body);
+                TranslateExecutionTreeChildren(execution, 1);
+                return;
+            }
+
+            case Grammar::Symbol::CompareEqual:
+            case Grammar::Symbol::CompareGreater:
+            case Grammar::Symbol::CompareGreaterEqual:
+            case Grammar::Symbol::CompareLess:
+            case Grammar::Symbol::CompareLessEqual:
+            case Grammar::Symbol::CompareNotEqual:
+            case Grammar::Symbol::IsNull:
+            case Grammar::Symbol::LogicalAND:
+            case Grammar::Symbol::LogicalNOT:
+            case Grammar::Symbol::LogicalOR:
+            case Grammar::Symbol::FunctionCall:
+            case Grammar::Symbol::OperatorAddition:
+            case Grammar::Symbol::OperatorDivision:
+            case Grammar::Symbol::OperatorMultiplication:
+            case Grammar::Symbol::OperatorSubraction:
+            case Grammar::Symbol::VariableAssignment:
+                TranslateExecutionTreeFunctionCall(execution);
+                break;
+
+            case Grammar::Symbol::VariableDeclaration:
+            {
+                auto variable = execution->GetInput(0).m_value;
+                m_body.WriteLineIndented("%s %s = %s;", GraphToCPlusPlusCpp::k_datum, variable->m_name.c_str(), ToValueString(execution, variable->m_datum).c_str());
+                break;
+            }
+
+            default:
+                break;
+            }
+
+            TranslateExecutionTreeChildren(execution, 0);
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution)
+        {
+            const bool isWrittenOutputPossible = execution->GetChildrenCount() == 1 && !execution->GetChild(0).m_output.empty();
+            const bool isNullCheckRequired = Grammar::IsFunctionCallNullCheckRequired(execution);
+            IsNamed isDeclared = IsNamed::No;
+
+            if (isNullCheckRequired)
+            {
+                if (isWrittenOutputPossible && execution->GetChild(0).m_output[0].second->m_source->m_source == execution)
+                {
+                    // declared outside of the check, so the rest of the function can read it
+                    m_body.WriteLineIndented("%s %s;", GraphToCPlusPlusCpp::k_datum, execution->GetChild(0).m_output[0].second->m_source->m_name.c_str());
+                    isDeclared = IsNamed::Yes;
+                }
+
+                m_body.WriteIndented("if (%s::IsValidDatum(&", GraphToCPlusPlusCpp::k_datum);
+                WriteFunctionCallInput(execution, 0);
+                m_body.WriteLine("))");
+                OpenScope(m_body);
+            }
+
+            m_body.WriteIndent();
+
+            if (isWrittenOutputPossible)
+            {
+                WriteVariableWrite(execution, isDeclared);
+            }
+
+            if (Grammar::IsLogicalExpression(execution))
+            {
+                WriteLogicalExpression(execution);
+            }
+            else if (Grammar::IsVariableGet(execution) || Grammar::IsVariableSet(execution) || execution->GetSymbol() == Grammar::Symbol::VariableAssignment)
+            {
+                WriteFunctionCallInput(execution, 0);
+            }
+            else if (Grammar::IsOperatorArithmetic(execution))
+            {
+                WriteOperatorArithmetic(execution);
+            }
+            else if (execution->GetId().m_node && Grammar::CheckEventHandlingType(execution) == Grammar::EventHandingType::EBus)
+            {
+                WriteEBusHandlerCall(execution);
+            }
+            else if (Grammar::IsUserFunctionCall(execution))
+            {
+                WriteUserFunctionCall(execution);
+            }
+            else
+            {
+                WriteMethodCall(execution);
+            }
+
+            m_body.WriteLine(";");
+
+            if (isNullCheckRequired)
+            {
+                CloseScope(m_body);
+            }
+
+            WriteOutputAssignments(execution);
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTrees()
+        {
+            if (auto start = m_model.GetStart())
+            {
+                TranslateFunction(start, "OnGraphStart", IsNamed::Yes);
+            }
+
+            for (auto function : m_model.GetFunctions())
+            {
+                TranslateFunction(function, Grammar::ToIdentifier(function->GetName()), IsNamed::Yes);
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateFunction(Grammar::ExecutionTreeConstPtr execution, AZStd::string_view name, IsNamed isNamed)
+        {
+            using namespace GraphToCPlusPlusCpp;
+
+            if (execution->GetReturnValueCount() > 1)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), NotSupported("Function with multiple return values")));
+                return;
+            }
+
+            const bool isStart = execution == m_model.GetStart();
+            AZStd::string parameters;
+
+            if (!isStart && execution->GetChildrenCount() > 0)
+            {
+                const auto& output = execution->GetChild(0).m_output;
+                // as in the Lua translation, the first output of a named function that is not pure is the graph itself
+                size_t inputIndex = isNamed == IsNamed::Yes && !execution->IsPure() && !m_model.IsUserNodeable() ? 1 : 0;
+
+                for (; inputIndex < output.size(); ++inputIndex)
+                {
+                    if (!parameters.empty())
+                    {
+                        parameters += ", ";
+                    }
+
+                    parameters += AZStd::string::format("%s %s", k_datum, output[inputIndex].second->m_source->m_name.c_str());
+                }
+            }
+
+            const AZStd::string returnType = execution->HasReturnValues() ? k_datum : "void";
+            m_functionDeclarations.push_back(AZStd::string::format("%s %.*s(%s)%s", returnType.c_str()
+                , aznumeric_cast<int>(name.size()), name.data(), parameters.c_str(), isStart ? " override" : ""));
+
+            m_body.WriteLineIndented("%s %s::%.*s(%s)", returnType.c_str(), m_className.c_str()
+                , aznumeric_cast<int>(name.size()), name.data(), parameters.c_str());
+            TranslateFunctionBlock(execution);
+            m_body.WriteNewLine();
+        }
+
+        void GraphToCPlusPlus::TranslateFunctionBlock(Grammar::ExecutionTreeConstPtr functionBlock)
+        {
+            OpenFunctionBlock(m_body);
+
+            if (!m_model.GetStaticVariablesNames(functionBlock).empty())
+            {
+                AddError(functionBlock, aznew Internal::ParseError(functionBlock->GetNodeId()
+                    , GraphToCPlusPlusCpp::NotSupported("Variable with a static initializer")));
+            }
+
+            WriteOutputAssignments(functionBlock);
+            WriteLocalVariableInitialization(functionBlock);
+            WriteReturnValueInitialization(functionBlock);
+
+            if (functionBlock->GetChildrenCount() > 0 && functionBlock->GetChild(0).m_execution)
+            {
+                TranslateExecutionTreeEntry(functionBlock->GetChild(0).m_execution);
+            }
+
+            WriteReturnStatement(functionBlock);
+            CloseFunctionBlock(m_body);
+        }
+
+        void GraphToCPlusPlus::WriteClassDeclaration()
+        {
+            using namespace GraphToCPlusPlusCpp;
+
+            WriteCopyright(m_dotH);
+            m_dotH.WriteNewLine();
+            WriteDoNotModify(m_dotH);
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLine("#pragma once");
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLine("#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>");
+            m_dotH.WriteNewLine();
+
+            OpenNamespace(m_dotH, GetAutoNativeNamespace());
+            m_dotH.WriteLineIndented("class %s", m_className.c_str());
+            m_dotH.Indent();
+            m_dotH.WriteLineIndented(": public ScriptCanvas::Execution::NativeGraph");
+            m_dotH.Outdent();
+            m_dotH.WriteLineIndented("{");
+            m_dotH.WriteLineIndented("public:");
+            m_dotH.Indent();
+            m_dotH.WriteLineIndented("AZ_CLASS_ALLOCATOR(%s, AZ::SystemAllocator, 0);", m_className.c_str());
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLineIndented("static ScriptCanvas::Execution::NativeGraph* Create();");
+            m_dotH.WriteLineIndented("static void Register();");
+            m_dotH.WriteLineIndented("static void Unregister();");
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLineIndented("bool Initialize(ScriptCanvas::ExecutionStateNative& %s, const ScriptCanvas::Execution::ActivationInputRange& inputs) override;"
+                , m_configuration.m_executionStateName.data());
+            m_dotH.WriteLineIndented("void Stop() override;");
+
+            for (const auto& declaration : m_functionDeclarations)
+            {
+                m_dotH.WriteLineIndented("%s;", declaration.c_str());
+            }
+
+            m_dotH.Outdent();
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLineIndented("private:");
+            m_dotH.Indent();
+            m_dotH.WriteLineIndented("AZ::EntityId %s;", m_configuration.m_executionStateEntityIdRef.data());
+            m_dotH.WriteLineIndented("ScriptCanvas::ExecutionStateNative* %s = nullptr;", m_configuration.m_executionStateReferenceGraph.data());
+
+            for (const auto& variable : m_model.GetVariables())
+            {
+                if (variable->m_isMember && !variable->m_isDebugOnly && m_handlerNamesByGraphName.find(variable->m_name) == m_handlerNamesByGraphName.end())
+                {
+                    m_dotH.WriteLineIndented("%s %s;", k_datum, variable->m_name.c_str());
+                }
+            }
+
+            for (const auto& literal : m_literals)
+            {
+                m_dotH.WriteLineIndented("%s %s;", k_datum, literal.m_name.c_str());
+            }
+
+            for (const auto& method : m_methods)
+            {
+                m_dotH.WriteLineIndented("const AZ::BehaviorMethod* %s = nullptr;", method.m_name.c_str());
+            }
+
+            for (const auto& handler : m_handlers)
+            {
+                m_dotH.WriteLineIndented("AZStd::unique_ptr<ScriptCanvas::EBusHandler> %s;", handler.m_name.c_str());
+            }
+
+            m_dotH.Outdent();
+            m_dotH.WriteLineIndented("};");
+            CloseNamespace(m_dotH, GetAutoNativeNamespace());
+        }
+
+        void GraphToCPlusPlus::WriteClassDefinition()
+        {
+            WriteCopyright(m_dotCPP);
+            m_dotCPP.WriteNewLine();
+            WriteDoNotModify(m_dotCPP);
+            m_dotCPP.WriteNewLine();
+            m_dotCPP.WriteLine("#include \"%s_VM.h\"", m_model.GetSource().m_name.c_str());
+            m_dotCPP.WriteNewLine();
+
+            OpenNamespace(m_dotCPP, GetAutoNativeNamespace());
+            m_dotCPP.WriteLineIndented("ScriptCanvas::Execution::NativeGraph* %s::Create()", m_className.c_str());
+            OpenFunctionBlock(m_dotCPP);
+            m_dotCPP.WriteLineIndented("return aznew %s();", m_className.c_str());
+            CloseFunctionBlock(m_dotCPP);
+            m_dotCPP.WriteNewLine();
+
+            const AZStd::string sourceId = m_model.GetSource().m_assetId.m_guid.ToString<AZStd::string>();
+            m_dotCPP.WriteLineIndented("void %s::Register()", m_className.c_str());
+            OpenFunctionBlock(m_dotCPP);
+            m_dotCPP.WriteLineIndented("ScriptCanvas::Execution::RegisterNativeGraph(AZ::Uuid(\"%s\"), &%s::Create, 0x%08x);"
+                , sourceId.c_str(), m_className.c_str(), m_sourceHash);
+            CloseFunctionBlock(m_dotCPP);
+            m_dotCPP.WriteNewLine();
+
+            m_dotCPP.WriteLineIndented("void %s::Unregister()", m_className.c_str());
+            OpenFunctionBlock(m_dotCPP);
+            m_dotCPP.WriteLineIndented("ScriptCanvas::Execution::UnregisterNativeGraph(AZ::Uuid(\"%s\"));", sourceId.c_str());
+            CloseFunctionBlock(m_dotCPP);
+            m_dotCPP.WriteNewLine();
+
+            WriteInitialize();
+            WriteStop();
+            m_dotCPP.Write(m_body.GetOutput());
+            CloseNamespace(m_dotCPP, GetAutoNativeNamespace());
+        }
+
+        void GraphToCPlusPlus::WriteEBusHandlerCall(Grammar::ExecutionTreeConstPtr execution)
+        {
+            const auto& name = execution->GetName();
+            const AZStd::string* graphHandlerName = execution->GetInputCount() > 0 ? execution->GetInput(0).m_value->m_datum.GetAs<Data::StringType>() : nullptr;
+            auto iter = graphHandlerName ? m_handlerNamesByGraphName.find(*graphHandlerName) : m_handlerNamesByGraphName.end();
+
+            if (iter == m_handlerNamesByGraphName.end())
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), "EBus handler call did not refer to a handler of the graph"));
+                return;
+            }
+
+            const char* handlerName = iter->second.c_str();
+
+            if (name == Grammar::k_EBusHandlerConnectName)
+            {
+                m_body.Write(GraphToCPlusPlusCpp::ToTypedDatum(GraphToCPlusPlusCpp::k_booleanType, AZStd::string::format("%s->Connect()", handlerName)));
+            }
+            else if (name == Grammar::k_EBusHandlerConnectToName && execution->GetInputCount() > 1)
+            {
+                m_body.Write("%s(%s(*%s, ", GraphToCPlusPlusCpp::k_datum, GraphToCPlusPlusCpp::k_booleanType, handlerName);
+                WriteFunctionCallInput(execution, 1);
+                m_body.Write("))");
+            }
+            else if (name == Grammar::k_EBusHandlerIsConnectedName)
+            {
+                m_body.Write(GraphToCPlusPlusCpp::ToTypedDatum(GraphToCPlusPlusCpp::k_booleanType, AZStd::string::format("%s->IsConnected()", handlerName)));
+            }
+            else if (name == Grammar::k_EBusHandlerDisconnectName && !(execution->GetChildrenCount() == 1 && !execution->GetChild(0).m_output.empty()))
+            {
+                m_body.Write("%s->Disconnect()", handlerName);
+            }
+            else
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), GraphToCPlusPlusCpp::NotSupported(AZStd::string::format("EBus handler call %s", name.c_str()))));
+            }
+        }
+
+        void GraphToCPlusPlus::WriteFunctionCallArguments(Grammar::ExecutionTreeConstPtr execution, const AZ::BehaviorMethod& method)
+        {
+            using namespace GraphToCPlusPlusCpp;
+
+            const size_t inputCount = execution->GetInputCount();
+
+            if (inputCount > method.GetNumArguments())
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId()
+                    , AZStd::string::format("Call with more inputs (%zu) than %s has parameters", inputCount, method.m_name.c_str())));
+                return;
+            }
+
+            for (size_t index = 0; index < inputCount; ++index)
+            {
+                m_body.Write(", ");
+
+                const Grammar::VariableConstPtr& input = execution->GetInput(index).m_value;
+                if (IsExecutionStateInput(input, execution))
+                {
+                    m_body.Write("static_cast<const ScriptCanvas::ExecutionState*>(%s)", m_configuration.m_executionStateReferenceGraph.data());
+                    continue;
+                }
+
+                // each argument is bound as the type of its parameter, the values of the graph only convert numbers
+                const AZ::BehaviorParameter& parameter = *method.GetArgument(index);
+                const NativeType* parameterType = FindNativeType(parameter);
+                const Data::Type& inputType = input->m_datum.GetType();
+
+                if (index == 0 && method.IsMember())
+                {
+                    // the object a member method is called on is bound by its address
+                    const NativeType* objectType = FindNativeType(parameter.m_typeId);
+                    if (objectType && Data::FromAZType(objectType->m_typeId) == inputType)
+                    {
+                        WriteFunctionCallInput(execution, index);
+                        m_body.Write(".ModAs<%s>()", objectType->m_name);
+                        continue;
+                    }
+                }
+
+                if (parameterType && parameterType->m_isNumber && inputType == Data::Type::Number())
+                {
+                    if (parameterType->m_typeId != azrtti_typeid<Data::NumberType>())
+                    {
+                        m_body.Write("static_cast<%s>", parameterType->m_name);
+                    }
+
+                    WriteTypedInput(execution, index, k_numberType);
+                }
+                else if (parameterType && Data::FromAZType(parameterType->m_typeId) == inputType)
+                {
+                    WriteTypedInput(execution, index, parameterType->m_name);
+                }
+                else
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId()
+                        , NotSupported(AZStd::string::format("Argument of type %s to %s", Data::GetName(inputType).c_str(), method.m_name.c_str()))));
+                    return;
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::WriteFunctionCallInput(Grammar::ExecutionTreeConstPtr execution, size_t index)
+        {
+            if (index >= execution->GetInputCount())
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), "Not enough input for the native C++ translation of the node"));
+                return;
+            }
+
+            auto& input = execution->GetInput(index).m_value;
+
+            if (IsInputNamed(input, execution) == IsNamed::Yes)
+            {
+                m_body.Write(input->m_name);
+            }
+            else
+            {
+                m_body.Write(AddLiteral(execution, input));
+            }
+        }
+
+        void GraphToCPlusPlus::WriteInitialize()
+        {
+            using namespace GraphToCPlusPlusCpp;
+
+            const auto& runtimeInputs = m_model.GetRuntimeInputs();
+            const AZStd::vector<Grammar::VariableConstPtr> constructionArguments = m_model.CombineVariableLists(runtimeInputs.m_nodeables, runtimeInputs.m_variables, runtimeInputs.m_entityIds);
+
+            m_dotCPP.WriteLineIndented("bool %s::Initialize(ScriptCanvas::ExecutionStateNative& %s, const ScriptCanvas::Execution::ActivationInputRange& inputs)"
+                , m_className.c_str(), m_configuration.m_executionStateName.data());
+            OpenFunctionBlock(m_dotCPP);
+            m_dotCPP.WriteLineIndented("if (inputs.totalCount != %zu)", constructionArguments.size());
+            OpenScope(m_dotCPP);
+            m_dotCPP.WriteLineIndented("return false;");
+            CloseScope(m_dotCPP);
+            m_dotCPP.WriteNewLine();
+
+            m_dotCPP.WriteLineIndented("%s = &%s;", m_configuration.m_executionStateReferenceGraph.data(), m_configuration.m_executionStateName.data());
+            m_dotCPP.WriteLineIndented("%s = %s;", m_configuration.m_executionStateEntityIdRef.data(), m_configuration.m_executionStateEntityIdRefInitialization.data());
+
+            // the activation inputs are ordered as the construction arguments of the Lua translation
+            for (size_t index = 0; index < constructionArguments.size(); ++index)
+            {
+                m_dotCPP.WriteLineIndented("%s = %s(inputs.inputs[%zu]);", constructionArguments[index]->m_name.c_str(), k_datum, index);
+            }
+
+            for (const auto& variable : m_model.GetVariables())
+            {
+                if (!variable->m_isMember || variable->m_isDebugOnly || m_handlerNamesByGraphName.find(variable->m_name) != m_handlerNamesByGraphName.end())
+                {
+                    continue;
+                }
+
+                switch (Grammar::ParseConstructionRequirement(variable))
+                {
+                // #scriptcanvas_component_extension
+                case Grammar::VariableConstructionRequirement::SelfEntityId:
+                case Grammar::VariableConstructionRequirement::None:
+                    m_dotCPP.WriteLineIndented("%s = %s;", variable->m_name.c_str(), ToValueString(nullptr, variable->m_datum).c_str());
+                    break;
+
+                case Grammar::VariableConstructionRequirement::InputNodeable:
+                    AddError(nullptr, aznew Internal::ParseError(AZ::EntityId(), NotSupported("Node with a nodeable")));
+                    break;
+
+                default:
+                    break;
+                }
+            }
+
+            for (const auto& literal : m_literals)
+            {
+                m_dotCPP.WriteLineIndented("%s = %s;", literal.m_name.c_str(), literal.m_initializer.c_str());
+            }
+
+            if (!m_methods.empty())
+            {
+                m_dotCPP.WriteNewLine();
+
+                for (const auto& method : m_methods)
+                {
+                    m_dotCPP.WriteLineIndented("%s = %s;", method.m_name.c_str(), method.m_initializer.c_str());
+                }
+
+                m_dotCPP.WriteIndented("if (!%s", m_methods.front().m_name.c_str());
+
+                for (size_t index = 1; index < m_methods.size(); ++index)
+                {
+                    m_dotCPP.Write(" || !%s", m_methods[index].m_name.c_str());
+                }
+
+                m_dotCPP.WriteLine(")");
+                OpenScope(m_dotCPP);
+                m_dotCPP.WriteLineIndented("return false;");
+                CloseScope(m_dotCPP);
+            }
+
+            for (const auto& handler : m_handlers)
+            {
+                m_dotCPP.WriteNewLine();
+                m_dotCPP.WriteLineIndented("%s = CreateEBusHandler(%s, %s);", handler.m_name.c_str(), m_configuration.m_executionStateName.data()
+                    , ToStringLiteral(handler.m_busName).c_str());
+
+                for (const auto& handledEvent : handler.m_events)
+                {
+                    m_dotCPP.WriteLineIndented("%s->HandleEvent(%zu);", handler.m_name.c_str(), handledEvent.m_eventIndex);
+
+                    if (handledEvent.m_parameterCount == 0)
+                    {
+                        m_dotCPP.WriteLineIndented("%s->SetExecutionOut(%zu, [this](AZ::BehaviorArgument*, AZ::BehaviorArgument*, int)"
+                            , handler.m_name.c_str(), handledEvent.m_eventIndex);
+                        OpenFunctionBlock(m_dotCPP);
+                        m_dotCPP.WriteLineIndented("%s();", handledEvent.m_functionName.c_str());
+                    }
+                    else
+                    {
+                        m_dotCPP.WriteLineIndented("%s->SetExecutionOut(%zu, [this](AZ::BehaviorArgument*, AZ::BehaviorArgument* arguments, int numArguments)"
+                            , handler.m_name.c_str(), handledEvent.m_eventIndex);
+                        OpenFunctionBlock(m_dotCPP);
+                        m_dotCPP.WriteLineIndented("if (numArguments >= %zu)", handledEvent.m_parameterCount);
+                        OpenScope(m_dotCPP);
+                        m_dotCPP.WriteIndented("%s(", handledEvent.m_functionName.c_str());
+
+                        for (size_t index = 0; index < handledEvent.m_parameterCount; ++index)
+                        {
+                            m_dotCPP.Write("%s%s(arguments[%zu])", index == 0 ? "" : ", ", k_datum, index);
+                        }
+
+                        m_dotCPP.WriteLine(");");
+                        CloseScope(m_dotCPP);
+                    }
+
+                    m_dotCPP.Outdent();
+                    m_dotCPP.WriteLineIndented("});");
+                }
+
+                if (handler.m_startsConnected)
+                {
+                    if (handler.m_address.empty())
+                    {
+                        m_dotCPP.WriteLineIndented("%s->Connect();", handler.m_name.c_str());
+                    }
+                    else
+                    {
+                        m_dotCPP.WriteLineIndented("ConnectTo(*%s, %s);", handler.m_name.c_str(), handler.m_address.c_str());
+                    }
+                }
+            }
+
+            m_dotCPP.WriteNewLine();
+            m_dotCPP.WriteLineIndented("return true;");
+            CloseFunctionBlock(m_dotCPP);
+            m_dotCPP.WriteNewLine();
+        }
+
+        void GraphToCPlusPlus::WriteLocalVariableInitialization(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (const auto& localDeclaredVariables = m_model.GetLocalVariables(execution))
+            {
+                for (const auto& variable : *localDeclaredVariables)
+                {
+                    const auto requirement = Grammar::ParseConstructionRequirement(variable);
+
+                    if (requirement == Grammar::VariableConstructionRequirement::None
+                    || requirement != Grammar::VariableConstructionRequirement::Static && execution != m_model.GetStart())
+                    {
+                        m_body.WriteLineIndented("%s %s = %s;", GraphToCPlusPlusCpp::k_datum, variable->m_name.c_str(), ToValueString(execution, variable->m_datum).c_str());
+                    }
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::WriteLogicalExpression(Grammar::ExecutionTreeConstPtr execution)
+        {
+            using namespace GraphToCPlusPlusCpp;
+
+            m_body.Write("%s(%s(", k_datum, k_booleanType);
+
+            const auto symbol = execution->GetSymbol();
+
+            if (symbol == Grammar::Symbol::IsNull)
+            {
+                m_body.Write("!%s::IsValidDatum(&", k_datum);
+                WriteFunctionCallInput(execution, 0);
+                m_body.Write(")");
+            }
+            else if (symbol == Grammar::Symbol::LogicalNOT)
+            {
+                m_body.Write("!");
+                WriteTypedInput(execution, 0, k_booleanType);
+            }
+            else if (symbol == Grammar::Symbol::LogicalAND || symbol == Grammar::Symbol::LogicalOR)
+            {
+                WriteTypedInput(execution, 0, k_booleanType);
+                m_body.Write(symbol == Grammar::Symbol::LogicalAND ? " && " : " || ");
+                WriteTypedInput(execution, 1, k_booleanType);
+            }
+            else if (Grammar::IsFloatingPointNumberEqualityComparison(execution))
+            {
+                // AZ::GetAbs(lhs - rhs) <= 0.000001
+                m_body.Write("AZ::GetAbs(");
+                WriteTypedInput(execution, 0, k_numberType);
+                m_body.Write(" - ");
+                WriteTypedInput(execution, 1, k_numberType);
+                m_body.Write(symbol == Grammar::Symbol::CompareEqual ? ") <= %s" : ") > %s", Grammar::k_LuaEpsilonString);
+            }
+            else
+            {
+                const char* operatorString = "";
+                switch (symbol)
+                {
+                case Grammar::Symbol::CompareEqual:
+                    operatorString = " == ";
+                    break;
+                case Grammar::Symbol::CompareGreater:
+                    operatorString = " > ";
+                    break;
+                case Grammar::Symbol::CompareGreaterEqual:
+                    operatorString = " >= ";
+                    break;
+                case Grammar::Symbol::CompareLess:
+                    operatorString = " < ";
+                    break;
+                case Grammar::Symbol::CompareLessEqual:
+                    operatorString = " <= ";
+                    break;
+                case Grammar::Symbol::CompareNotEqual:
+                    operatorString = " != ";
+                    break;
+                default:
+                    break;
+                }
+
+                if (execution->GetInput(0).m_value->m_datum.GetType() == Data::Type::Number())
+                {
+                    WriteTypedInput(execution, 0, k_numberType);
+                    m_body.Write(operatorString);
+                    WriteTypedInput(execution, 1, k_numberType);
+                }
+                else
+                {
+                    // the comparison of Datums compares the values of any type the graph can compare
+                    m_body.Write("(");
+                    WriteFunctionCallInput(execution, 0);
+                    m_body.Write(operatorString);
+                    WriteFunctionCallInput(execution, 1);
+                    m_body.Write(").GetValueOr(false)");
+                }
+            }
+
+            m_body.Write("))");
+        }
+
+        void GraphToCPlusPlus::WriteMethodCall(Grammar::ExecutionTreeConstPtr execution)
+        {
+            using namespace GraphToCPlusPlusCpp;
+
+            if (execution->GetName().empty())
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), "Function call without a name"));
+                return;
+            }
+
+            const AZ::BehaviorMethod* method = nullptr;
+            const AZStd::string methodName = AddMethod(execution, method);
+            if (!method)
+            {
+                return;
+            }
+
+            if (execution->GetChildrenCount() == 1 && !execution->GetChild(0).m_output.empty())
+            {
+                // the result is held in a Datum like every other value of the graph
+                const NativeType* resultType = method->HasResult() ? FindNativeType(*method->GetResult()) : nullptr;
+                if (!resultType)
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId()
+                        , NotSupported(AZStd::string::format("Result of %s", method->m_name.c_str()))));
+                    return;
+                }
+
+                if (resultType->m_isNumber)
+                {
+                    m_body.Write("%s(%s(InvokeResult<%s>(%s", k_datum, k_numberType, resultType->m_name, methodName.c_str());
+                    WriteFunctionCallArguments(execution, *method);
+                    m_body.Write(")))");
+                }
+                else
+                {
+                    m_body.Write("%s(InvokeResult<%s>(%s", k_datum, resultType->m_name, methodName.c_str());
+                    WriteFunctionCallArguments(execution, *method);
+                    m_body.Write("))");
+                }
+            }
+            else
+            {
+                m_body.Write("Invoke(%s", methodName.c_str());
+                WriteFunctionCallArguments(execution, *method);
+                m_body.Write(")");
+            }
+        }
+
+        void GraphToCPlusPlus::WriteOperatorArithmetic(Grammar::ExecutionTreeConstPtr execution)
+        {
+            using namespace GraphToCPlusPlusCpp;
+
+            const auto count = execution->GetInputCount();
+
+            if (count < 2)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NotEnoughInputForArithmeticOperator));
+                return;
+            }
+
+            const auto symbol = execution->GetSymbol();
+            const Data::Type& type = execution->GetInput(0).m_value->m_datum.GetType();
+            const char* typeName = nullptr;
+
+            if (type == Data::Type::Number())
+            {
+                typeName = k_numberType;
+            }
+            else if (type == Data::Type::String() && symbol == Grammar::Symbol::OperatorAddition)
+            {
+                typeName = k_stringType;
+            }
+            else
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId()
+                    , NotSupported(AZStd::string::format("Arithmetic on %s", Data::GetName(type).c_str()))));
+                return;
+            }
+
+            const char* operatorString = " + ";
+            switch (symbol)
+            {
+            case Grammar::Symbol::OperatorAddition:
+                break;
+            case Grammar::Symbol::OperatorDivision:
+                operatorString = " / ";
+                break;
+            case Grammar::Symbol::OperatorMultiplication:
+                operatorString = " * ";
+                break;
+            case Grammar::Symbol::OperatorSubraction:
+                operatorString = " - ";
+                break;
+            default:
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::UntranslatedArithmetic));
+                return;
+            }
+
+            m_body.Write("%s(%s(", k_datum, typeName);
+
+            for (size_t i(0); i < (count - 1); ++i)
+            {
+                m_body.Write("(");
+            }
+
+            // write operand 0 + operand 1
+            WriteTypedInput(execution, 0, typeName);
+            m_body.Write(operatorString);
+            WriteTypedInput(execution, 1, typeName);
+            m_body.Write(")");
+
+            for (size_t i(2); i < count; ++i)
+            {
+                m_body.Write(operatorString);
+                WriteTypedInput(execution, i, typeName);
+                m_body.Write(")");
+            }
+
+            m_body.Write("))");
+        }
+
+        void GraphToCPlusPlus::WriteOutputAssignments(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (const auto output = execution->GetLocalOutput())
+            {
+                for (const auto& outputIter : *output)
+                {
+                    if (!outputIter.second->m_sourceConversions.empty())
+                    {
+                        AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), GraphToCPlusPlusCpp::NotSupported("Output conversion")));
+                        continue;
+                    }
+
+                    for (const auto& assignment : outputIter.second->m_assignments)
+                    {
+                        if (assignment->m_isMember && !m_model.GetVariableHandling(assignment).empty())
+                        {
+                            AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), GraphToCPlusPlusCpp::NotSupported("Variable change handling")));
+                            continue;
+                        }
+
+                        m_body.WriteLineIndented("%s = %s;", assignment->m_name.c_str(), outputIter.second->m_source->m_name.c_str());
+                    }
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::WriteReturnStatement(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (execution->HasReturnValues())
+            {
+                m_body.WriteLineIndented("return %s;", execution->GetReturnValue(0).second->m_source->m_name.c_str());
+            }
+        }
+
+        void GraphToCPlusPlus::WriteReturnValueInitialization(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (execution->HasReturnValues())
+            {
+                for (size_t index(0), sentinel(execution->GetReturnValueCount()); index < sentinel; ++index)
+                {
+                    const auto& returnValue = execution->GetReturnValue(index).second;
+
+                    if (returnValue->m_isNewValue)
+                    {
+                        const AZStd::string initialization = returnValue->m_initializationValue
+                            ? returnValue->m_initializationValue->m_name
+                            : ToValueString(execution, returnValue->m_source->m_datum);
+                        m_body.WriteLineIndented("%s %s = %s;", GraphToCPlusPlusCpp::k_datum, returnValue->m_source->m_name.c_str(), initialization.c_str());
+                    }
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::WriteStop()
+        {
+            m_dotCPP.WriteLineIndented("void %s::Stop()", m_className.c_str());
+            OpenFunctionBlock(m_dotCPP);
+
+            for (const auto& handler : m_handlers)
+            {
+                m_dotCPP.WriteLineIndented("if (%s)", handler.m_name.c_str());
+                OpenScope(m_dotCPP);
+                m_dotCPP.WriteLineIndented("%s->Disconnect();", handler.m_name.c_str());
+                CloseScope(m_dotCPP);
+            }
+
+            CloseFunctionBlock(m_dotCPP);
+            m_dotCPP.WriteNewLine();
+        }
+
+        void GraphToCPlusPlus::WriteTypedInput(Grammar::ExecutionTreeConstPtr execution, size_t index, AZStd::string_view typeName)
+        {
+            m_body.Write("(*");
+            WriteFunctionCallInput(execution, index);
+            m_body.Write(".GetAs<%.*s>())", aznumeric_cast<int>(typeName.size()), typeName.data());
+        }
+
+        void GraphToCPlusPlus::WriteUserFunctionCall(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (!Grammar::IsUserFunctionCallLocallyDefined(execution))
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), GraphToCPlusPlusCpp::NotSupported("Call to a function of another graph")));
+                return;
+            }
+
+            m_body.Write("%s(", Grammar::ToIdentifier(execution->GetName()).c_str());
+
+            bool isFirstArgument = true;
+            for (size_t index = 0; index < execution->GetInputCount(); ++index)
+            {
+                // the graph itself is the implicit this pointer of the member function
+                if (!Grammar::IsSelfInput(execution, index))
+                {
+                    m_body.Write(isFirstArgument ? "" : ", ");
+                    WriteFunctionCallInput(execution, index);
+                    isFirstArgument = false;
+                }
+            }
+
+            m_body.Write(")");
+        }
+
+        void GraphToCPlusPlus::WriteVariableWrite(Grammar::ExecutionTreeConstPtr execution, IsNamed isDeclared)
+        {
+            auto firstOutput = execution->GetChild(0).m_output[0].second;
+
+            if (firstOutput->m_source->m_isMember && !m_model.GetVariableHandling(firstOutput->m_source).empty())
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), GraphToCPlusPlusCpp::NotSupported("Variable change handling")));
+            }
+
+            if (firstOutput->m_source->m_source == execution && isDeclared == IsNamed::No)
+            {
+                m_body.Write("%s %s = ", GraphToCPlusPlusCpp::k_datum, firstOutput->m_source->m_name.c_str());
+            }
+            else
+            {
+                m_body.Write("%s = ", firstOutput->m_source->m_name.c_str());
+            }
+        }
+    }
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/unordered_map.h>
+
+#include "GraphToX.h"
+#include "TranslationResult.h"
+#include "TranslationUtilities.h"
+
+namespace ScriptCanvas
+{
+    namespace Translation
+    {
+        /// Translates the execution trees of a graph to a class derived from Execution::NativeGraph, written to a .h and a .cpp file that
+        /// are compiled into a gem module. A system component of the module calls the Register function of the class on activation, after
+        /// which every instance of the graph executes the class instead of its Lua translation.
+        /// Values are still held in Datums, and BehaviorContext methods are resolved once, when the graph is initialized. The calls bind their
+        /// arguments by the types of the method parameters, found in the BehaviorContext when the graph is translated. Constructs without a
+        /// C++ translation yet fail the translation, which leaves the graph to the Lua translation.
+        class GraphToCPlusPlus
+            : public GraphToX
+        {
+        public:
+            // returns the .h and the .cpp file, the class registers with the hash of the Lua translation of the graph
+            static AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> Translate(const Grammar::AbstractCodeModel& source, AZ::u32 sourceHash);
+
+        protected:
+            enum class IsNamed { No, Yes };
+
+            struct Member
+            {
+                AZStd::string m_name;
+                AZStd::string m_initializer;
+            };
+
+            struct HandledEvent
+            {
+                AZStd::string m_functionName;
+                size_t m_eventIndex = 0;
+                size_t m_parameterCount = 0;
+            };
+
+            struct Handler
+            {
+                AZStd::string m_name;
+                AZStd::string m_busName;
+                AZStd::string m_address;
+                bool m_startsConnected = false;
+                AZStd::vector<HandledEvent> m_events;
+            };
+
+            static bool IsExecutionStateInput(Grammar::VariableConstPtr input, Grammar::ExecutionTreeConstPtr execution);
+            static IsNamed IsInputNamed(Grammar::VariableConstPtr input, Grammar::ExecutionTreeConstPtr execution);
+
+            AZStd::string m_className;
+            AZ::u32 m_sourceHash = 0;
+            Writer m_dotH;
+            Writer m_dotCPP;
+            // the function definitions are translated first, they determine the members the class declares and initializes
+            Writer m_body;
+            AZStd::vector<AZStd::string> m_functionDeclarations;
+            AZStd::vector<Member> m_literals;
+            AZStd::unordered_map<Grammar::VariableConstPtr, AZStd::string> m_literalNames;
+            AZStd::vector<Member> m_methods;
+            AZStd::vector<Handler> m_handlers;
+            AZStd::unordered_map<AZStd::string, AZStd::string> m_handlerNamesByGraphName;
+
+            GraphToCPlusPlus(const Grammar::AbstractCodeModel& source, AZ::u32 sourceHash);
+
+            AZStd::string AddLiteral(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr input);
+            // returns the name of the member holding the method, and the method as the translation finds it in the BehaviorContext
+            AZStd::string AddMethod(Grammar::ExecutionTreeConstPtr execution, const AZ::BehaviorMethod*& method);
+            bool IsSupported(Grammar::ExecutionTreeConstPtr execution);
+            TargetResult MoveResult(Writer& writer);
+            AZStd::string ToValueString(Grammar::ExecutionTreeConstPtr execution, const Datum& datum);
+            void TranslateBody();
+            void TranslateEBusHandling();
+            void TranslateExecutionTreeChildren(Grammar::ExecutionTreeConstPtr execution, size_t startingIndex);
+            void TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTrees();
+            void TranslateFunction(Grammar::ExecutionTreeConstPtr execution, AZStd::string_view name, IsNamed isNamed);
+            void TranslateFunctionBlock(Grammar::ExecutionTreeConstPtr execution);
+            void WriteClassDeclaration();
+            void WriteClassDefinition();
+            void WriteEBusHandlerCall(Grammar::ExecutionTreeConstPtr execution);
+            void WriteFunctionCallArguments(Grammar::ExecutionTreeConstPtr execution, const AZ::BehaviorMethod& method);
+            void WriteFunctionCallInput(Grammar::ExecutionTreeConstPtr execution, size_t index);
+            void WriteInitialize();
+            void WriteLocalVariableInitialization(Grammar::ExecutionTreeConstPtr execution);
+            void WriteLogicalExpression(Grammar::ExecutionTreeConstPtr execution);
+            void WriteMethodCall(Grammar::ExecutionTreeConstPtr execution);
+            void WriteOperatorArithmetic(Grammar::ExecutionTreeConstPtr execution);
+            void WriteOutputAssignments(Grammar::ExecutionTreeConstPtr execution);
+            void WriteReturnStatement(Grammar::ExecutionTreeConstPtr execution);
+            void WriteReturnValueInitialization(Grammar::ExecutionTreeConstPtr execution);
+            void WriteStop();
+            void WriteTypedInput(Grammar::ExecutionTreeConstPtr execution, size_t index, AZStd::string_view typeName);
+            void WriteUserFunctionCall(Grammar::ExecutionTreeConstPtr execution);
+            void WriteVariableWrite(Grammar::ExecutionTreeConstPtr execution, IsNamed isDeclared);
+        };
+    }
+}
@@ -8,6 +8,7 @@
 
 #include "Translation.h"
 
+#include <AzCore/Math/Crc.h>
 #include <AzCore/Script/ScriptAsset.h>
 #include <AzCore/Script/ScriptContext.h>
 #include <AzCore/Script/lua/lua.h>
@@ -18,6 +19,7 @@
 
 #include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
 #include <ScriptCanvas/Grammar/AbstractCodeModel.h>
+#include <ScriptCanvas/Translation/GraphToCPlusPlus.h>
 #include <ScriptCanvas/Translation/GraphToLua.h>
 #include <ScriptCanvas/Core/Graph.h>
 
@@ -52,6 +54,32 @@ namespace TranslationCPP
             return AZ::Failure(outcome.TakeError());
         }
     }
+
+    // the Lua translation is the one the runtime asset is built from
+    AZ::u32 ToSourceHash(const TargetResult& luaResult)
+    {
+        return AZ::Crc32(luaResult.m_text.data(), luaResult.m_text.size());
+    }
+
+    AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> ToCPlusPlus(const Grammar::AbstractCodeModel& model, AZ::u32 sourceHash, bool rawSave = false)
+    {
+        auto outcome = GraphToCPlusPlus::Translate(model, sourceHash);
+        if (outcome.IsSuccess() && rawSave)
+        {
+            auto saveOutcome = SaveDotH(model.GetSource(), outcome.GetValue().first.m_text);
+            if (saveOutcome.IsSuccess())
+            {
+                saveOutcome = SaveDotCPP(model.GetSource(), outcome.GetValue().second.m_text);
+            }
+
+            if (!saveOutcome.IsSuccess())
+            {
+                AZ_TracePrintf("ScriptCanvas", "Save failed %s", saveOutcome.GetError().data());
+            }
+        }
+
+        return outcome;
+    }
 }
 
 namespace ScriptCanvas
@@ -85,45 +113,57 @@ namespace ScriptCanvas
 
             if (model->IsErrorFree())
             {
-                if (request.translationTargetFlags & TargetFlags::Lua)
+                // the C++ translation is registered with the hash of the Lua translation, so it requires the Lua translation as well
+                const bool isLuaRequested = (request.translationTargetFlags & TargetFlags::Lua) != 0;
+                const bool isNativeRequested = (request.translationTargetFlags & (TargetFlags::Cpp | TargetFlags::Hpp)) != 0;
+
+                if (isLuaRequested || isNativeRequested)
                 {
-                    auto outcomeLua = TranslationCPP::ToLua(*model.get(), request.rawSaveDebugOutput);
+                    auto outcomeLua = TranslationCPP::ToLua(*model.get(), request.rawSaveDebugOutput && isLuaRequested);
                     if (outcomeLua.IsSuccess())
                     {
-                        translations.emplace(TargetFlags::Lua, outcomeLua.TakeValue());
+                        TargetResult luaResult = outcomeLua.TakeValue();
+                        const AZ::u32 sourceHash = TranslationCPP::ToSourceHash(luaResult);
+                        luaResult.m_runtimeInputs.m_sourceHash = sourceHash;
+
+                        if (isLuaRequested)
+                        {
+                            translations.emplace(TargetFlags::Lua, AZStd::move(luaResult));
+                        }
+
+                        // the C++ translation supports a subset of the grammar, failing it leaves the graph to its Lua translation
+                        if (isNativeRequested)
+                        {
+                            auto outcomeCPP = TranslationCPP::ToCPlusPlus(*model.get(), sourceHash, request.rawSaveDebugOutput);
+                            if (outcomeCPP.IsSuccess())
+                            {
+                                auto hppAndCpp = outcomeCPP.TakeValue();
+                                translations.emplace(TargetFlags::Hpp, AZStd::move(hppAndCpp.first));
+                                translations.emplace(TargetFlags::Cpp, AZStd::move(hppAndCpp.second));
+                            }
+                            else
+                            {
+                                ErrorList cppErrors = outcomeCPP.TakeError();
+                                errors.emplace(TargetFlags::Hpp, cppErrors);
+                                errors.emplace(TargetFlags::Cpp, AZStd::move(cppErrors));
+                            }
+                        }
                     }
                     else
                     {
-                        errors.emplace(TargetFlags::Lua, outcomeLua.TakeError());
+                        ErrorList luaErrors = outcomeLua.TakeError();
+                        if (isNativeRequested)
+                        {
+                            errors.emplace(TargetFlags::Hpp, luaErrors);
+                            errors.emplace(TargetFlags::Cpp, luaErrors);
+                        }
+
+                        if (isLuaRequested)
+                        {
+                            errors.emplace(TargetFlags::Lua, AZStd::move(luaErrors));
+                        }
                     }
                 }
-
-                // Translation to C++ (executed via BehaviorContext calls) has been demonstrated in the past and is partially in progress.
-                // These calls allow for users to execute multiple translations from the same abstract code model.
-                // More work is required to complete all the latest features of the ACM, and do integrate output files into the build.
-                // 
-                //                 if (targetFlags & (TargetFlags::Cpp | TargetFlags::Hpp))
-                //                 {
-                //                     auto outcomeCPP = TranslationCPP::ToCPlusPlus(*model.get(), rawSave);
-                //                     if (outcomeCPP.IsSuccess())
-                //                     {
-                //                         auto hppAndCpp = outcomeCPP.TakeValue();
-                //                         
-                //                         TargetResult cppResult;
-                //                         cppResult.m_text = AZStd::move(hppAndCpp.first);
-                //                         translations.emplace(TargetFlags::Hpp, AZStd::move(cppResult));
-                //                         TargetResult hppResult;
-                //                         hppResult.m_text = AZStd::move(hppAndCpp.second);
-                //                         translations.emplace(TargetFlags::Cpp, AZStd::move(hppResult));
-                //                     }
-                //                     else
-                //                     {
-                //                         auto hppAndCpp = outcomeCPP.TakeError();
-                //                         errors.emplace(TargetFlags::Hpp, AZStd::move(hppAndCpp.first));
-                //                         errors.emplace(TargetFlags::Cpp, AZStd::move(hppAndCpp.second));
-                //                     }
-                //                 }
-
             }
 
             return Result(model, AZStd::move(translations), AZStd::move(errors));
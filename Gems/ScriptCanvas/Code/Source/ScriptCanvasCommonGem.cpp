@@ -18,6 +18,7 @@
 #include <ScriptCanvas/Libraries/Libraries.h>
 
 #include <ScriptCanvas/Debugger/Debugger.h>
+#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>
 #include <ScriptCanvas/Execution/RuntimeComponent.h>
 #include <ScriptCanvas/Libraries/Libraries.h>
 #include <ScriptCanvas/Libraries/Math/MathNodeUtilities.h>
@@ -55,6 +56,7 @@ namespace ScriptCanvas
 
         MathNodeUtilities::RandomEngineInit();
         InitDataRegistry();
+        Execution::InitNativeGraphRegistry();
 
         ScriptCanvas::AutoGenRegistryManager::Init();
         if (auto componentApplication = AZ::Interface<AZ::ComponentApplicationRequests>::Get())
@@ -71,6 +73,7 @@ namespace ScriptCanvas
         MathNodeUtilities::RandomEngineReset();
         ScriptCanvas::ResetLibraries();
         ResetDataRegistry();
+        Execution::ResetNativeGraphRegistry();
     }
 
     AZ::ComponentTypeList ScriptCanvasModuleCommon::GetCommonSystemComponents() const
@@ -78,6 +78,7 @@ set(FILES
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpreted.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedAPI.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPerActivation.cpp
+    Include/ScriptCanvas/Execution/Native/ExecutionStateNative.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPure.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedSingleton.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedUtility.cpp
@@ -201,6 +202,7 @@ set(FILES
     Include/ScriptCanvas/Serialization/BehaviorContextObjectSerializer.cpp
     Include/ScriptCanvas/Serialization/DatumSerializer.cpp
     Include/ScriptCanvas/Serialization/RuntimeVariableSerializer.cpp
+    Include/ScriptCanvas/Translation/GraphToCPlusPlus.cpp
     Include/ScriptCanvas/Translation/GraphToLua.cpp
     Include/ScriptCanvas/Translation/GraphToLuaUtility.cpp
     Include/ScriptCanvas/Translation/GraphToX.cpp
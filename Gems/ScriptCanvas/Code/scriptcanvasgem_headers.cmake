@@ -103,6 +103,7 @@ set(FILES
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpreted.h
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedAPI.h
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPerActivation.h
+    Include/ScriptCanvas/Execution/Native/ExecutionStateNative.h
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPure.h
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedSingleton.h
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedUtility.h
@@ -369,6 +370,7 @@ set(FILES
     Include/ScriptCanvas/Serialization/DatumSerializer.h
     Include/ScriptCanvas/Serialization/RuntimeVariableSerializer.h
     Include/ScriptCanvas/Translation/Configuration.h
+    Include/ScriptCanvas/Translation/GraphToCPlusPlus.h
     Include/ScriptCanvas/Translation/GraphToLua.h
     Include/ScriptCanvas/Translation/GraphToLuaUtility.h
     Include/ScriptCanvas/Translation/GraphToX.h
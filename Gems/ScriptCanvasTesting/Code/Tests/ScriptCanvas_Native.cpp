@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Editor/Framework/ScriptCanvasGraphUtilities.h>
+#include <ScriptCanvas/Components/EditorGraph.h>
+#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>
+#include <ScriptCanvas/Translation/Translation.h>
+#include <Source/Framework/ScriptCanvasTestFixture.h>
+#include <Source/Framework/ScriptCanvasTestUtilities.h>
+
+using namespace ScriptCanvas;
+using namespace ScriptCanvasTests;
+using namespace ScriptCanvasEditor;
+
+namespace ScriptCanvas_NativeCPP
+{
+    const char* k_defaultExtension = "scriptcanvas";
+    const char* k_errorNotSupported = "is not supported by the native C++ translation";
+
+    // written as Translation::GraphToCPlusPlus writes LY_SC_UnitTest_Meta_AddSuccess
+    class LY_SC_UnitTest_Meta_AddSuccess
+        : public ScriptCanvas::Execution::NativeGraph
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(LY_SC_UnitTest_Meta_AddSuccess, AZ::SystemAllocator, 0);
+
+        static ScriptCanvas::Execution::NativeGraph* Create()
+        {
+            ++s_createCount;
+            return aznew LY_SC_UnitTest_Meta_AddSuccess();
+        }
+
+        // counts the graphs the execution states created, to tell the native runs from the fallback to Lua
+        static inline size_t s_createCount = 0;
+
+        bool Initialize(ScriptCanvas::ExecutionStateNative& executionState, const ScriptCanvas::Execution::ActivationInputRange& inputs) override
+        {
+            if (inputs.totalCount != 0)
+            {
+                return false;
+            }
+
+            m_executionState = &executionState;
+            m_literal_0 = ScriptCanvas::Datum(ScriptCanvas::Data::StringType("zero"));
+            m_literal_1 = ScriptCanvas::Datum(ScriptCanvas::Data::StringType("one"));
+            m_literal_2 = ScriptCanvas::Datum(ScriptCanvas::Data::StringType("two"));
+            m_literal_3 = ScriptCanvas::Datum(ScriptCanvas::Data::StringType(""));
+
+            m_method_0 = FindMethod("Unit Testing", "Add Success");
+            m_method_1 = FindMethod("Unit Testing", "Mark Complete");
+            if (!m_method_0 || !m_method_1)
+            {
+                return false;
+            }
+
+            return true;
+        }
+
+        void OnGraphStart() override
+        {
+            Invoke(m_method_0, static_cast<const ScriptCanvas::ExecutionState*>(m_executionState), (*m_literal_0.GetAs<ScriptCanvas::Data::StringType>()));
+            Invoke(m_method_0, static_cast<const ScriptCanvas::ExecutionState*>(m_executionState), (*m_literal_1.GetAs<ScriptCanvas::Data::StringType>()));
+            Invoke(m_method_0, static_cast<const ScriptCanvas::ExecutionState*>(m_executionState), (*m_literal_2.GetAs<ScriptCanvas::Data::StringType>()));
+            Invoke(m_method_1, static_cast<const ScriptCanvas::ExecutionState*>(m_executionState), (*m_literal_3.GetAs<ScriptCanvas::Data::StringType>()));
+        }
+
+    private:
+        ScriptCanvas::ExecutionStateNative* m_executionState = nullptr;
+        ScriptCanvas::Datum m_literal_0;
+        ScriptCanvas::Datum m_literal_1;
+        ScriptCanvas::Datum m_literal_2;
+        ScriptCanvas::Datum m_literal_3;
+        const AZ::BehaviorMethod* m_method_0 = nullptr;
+        const AZ::BehaviorMethod* m_method_1 = nullptr;
+    };
+
+    AZStd::string ToFilePath(AZStd::string_view graphName)
+    {
+        return AZStd::string::format("%s/%.*s.%s", GetUnitTestDirPathRelative(), aznumeric_cast<int>(graphName.size()), graphName.data(), k_defaultExtension);
+    }
+
+    Reporter RunUnitTestGraph(AZStd::string_view graphName, ExecutionMode execution, Execution::NativeGraphFactory nativeGraph)
+    {
+        const AZStd::string filePath = ToFilePath(graphName);
+
+        RunGraphSpec runGraphSpec;
+        runGraphSpec.graphPath = filePath;
+        runGraphSpec.dirPath = GetUnitTestDirPathRelative();
+        runGraphSpec.runSpec.execution = execution;
+        runGraphSpec.runSpec.m_nativeGraph = nativeGraph;
+        return RunGraph(runGraphSpec).front();
+    }
+
+    void ExpectTranslation(AZStd::string_view graphName, bool isNativeSupported, AZStd::string_view expectedNativeText = {})
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        LoadTestGraphResult loadResult = LoadTestGraph(ToFilePath(graphName));
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+        ASSERT_TRUE(loadResult.m_runtimeAsset);
+        ASSERT_NE(loadResult.m_editorAsset.Get(), nullptr);
+
+        Grammar::Request request;
+        request.scriptAssetId = loadResult.m_editorAsset.Id();
+        request.graph = loadResult.m_editorAsset.Get();
+        request.name = graphName;
+        request.addDebugInformation = false;
+        request.translationTargetFlags = Translation::TargetFlags::Lua | Translation::TargetFlags::Cpp | Translation::TargetFlags::Hpp;
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        const Translation::Result result = Translation::ParseAndTranslateGraph(request);
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+        ASSERT_TRUE(result.IsModelValid());
+
+        // the Lua translation is the fallback, whether the graph can be translated to C++ or not
+        EXPECT_TRUE(result.TranslationSucceed(Translation::TargetFlags::Lua));
+
+        if (isNativeSupported)
+        {
+            ASSERT_TRUE(result.TranslationSucceed(Translation::TargetFlags::Cpp)) << result.ErrorsToString().c_str();
+            EXPECT_TRUE(result.TranslationSucceed(Translation::TargetFlags::Hpp));
+
+            const AZStd::string& cppText = result.m_translations.find(Translation::TargetFlags::Cpp)->second.m_text;
+            EXPECT_NE(cppText.find(graphName), AZStd::string::npos);
+            EXPECT_NE(cppText.find("RegisterNativeGraph"), AZStd::string::npos);
+
+            if (!expectedNativeText.empty())
+            {
+                EXPECT_NE(cppText.find(expectedNativeText), AZStd::string::npos) << cppText.c_str();
+            }
+        }
+        else
+        {
+            EXPECT_FALSE(result.TranslationSucceed(Translation::TargetFlags::Cpp));
+            EXPECT_FALSE(result.TranslationSucceed(Translation::TargetFlags::Hpp));
+            EXPECT_NE(result.ErrorsToString().find(k_errorNotSupported), AZStd::string::npos);
+        }
+    }
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslationCompareEqual)
+{
+    ScriptCanvas_NativeCPP::ExpectTranslation("LY_SC_UnitTest_CompareEqual", true);
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslationAndBranch)
+{
+    ScriptCanvas_NativeCPP::ExpectTranslation("LY_SC_UnitTest_AndBranch", true);
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslationWhile)
+{
+    ScriptCanvas_NativeCPP::ExpectTranslation("LY_SC_UnitTest_While", true, "while (");
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslationIsNull)
+{
+    ScriptCanvas_NativeCPP::ExpectTranslation("LY_SC_UnitTest_IsNull", true, "IsValidDatum");
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslationExecutionStateArgument)
+{
+    ScriptCanvas_NativeCPP::ExpectTranslation("LY_SC_UnitTest_Meta_AddSuccess", true
+        , "Invoke(m_method_0, static_cast<const ScriptCanvas::ExecutionState*>(m_executionState), (*");
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslationFallbackPrint)
+{
+    ScriptCanvas_NativeCPP::ExpectTranslation("LY_SC_UnitTest_HelloWorld", false);
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslationFallbackForEach)
+{
+    ScriptCanvas_NativeCPP::ExpectTranslation("LY_SC_UnitTest_ForEachIterationArray", false);
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslationFallbackCycle)
+{
+    ScriptCanvas_NativeCPP::ExpectTranslation("LY_SC_UnitTest_Cycle", false);
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeGraphMatchesInterpreted)
+{
+    using namespace ScriptCanvas_NativeCPP;
+
+    const size_t createCount = LY_SC_UnitTest_Meta_AddSuccess::s_createCount;
+
+    AZ_TEST_START_TRACE_SUPPRESSION;
+    const Reporter interpreted = RunUnitTestGraph("LY_SC_UnitTest_Meta_AddSuccess", ExecutionMode::Interpreted, nullptr);
+    const Reporter native = RunUnitTestGraph("LY_SC_UnitTest_Meta_AddSuccess", ExecutionMode::Native, &LY_SC_UnitTest_Meta_AddSuccess::Create);
+    AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+
+    VerifyReporter(interpreted);
+    VerifyReporter(native);
+
+    EXPECT_GT(LY_SC_UnitTest_Meta_AddSuccess::s_createCount, createCount);
+    EXPECT_TRUE(native.IsComplete());
+    EXPECT_EQ(native.GetSuccess().size(), 3);
+    EXPECT_EQ(native, interpreted);
+
+    // the factory is only registered while the graph runs
+    EXPECT_EQ(Execution::FindNativeGraph(interpreted.GetGraph().m_guid).m_factory, nullptr);
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeGraphFallbackWithoutRegistration)
+{
+    using namespace ScriptCanvas_NativeCPP;
+
+    AZ_TEST_START_TRACE_SUPPRESSION;
+    const Reporter interpreted = RunUnitTestGraph("LY_SC_UnitTest_Meta_AddSuccess", ExecutionMode::Interpreted, nullptr);
+    const Reporter fallback = RunUnitTestGraph("LY_SC_UnitTest_Meta_AddSuccess", ExecutionMode::Native, nullptr);
+    AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+
+    VerifyReporter(fallback);
+    EXPECT_EQ(fallback, interpreted);
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeGraphFallbackWithOutOfDateTranslation)
+{
+    using namespace ScriptCanvas_NativeCPP;
+
+    AZ_TEST_START_TRACE_SUPPRESSION;
+    LoadTestGraphResult loadResult = LoadTestGraph(ToFilePath("LY_SC_UnitTest_Meta_AddSuccess"));
+    AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+    ASSERT_TRUE(loadResult.m_runtimeAsset);
+
+    // a translation written before the graph last changed
+    const AZ::Uuid graphId = loadResult.m_runtimeAsset.GetId().m_guid;
+    const AZ::u32 sourceHash = loadResult.m_runtimeAsset->m_runtimeData.m_input.m_sourceHash;
+    EXPECT_NE(sourceHash, 0u);
+    Execution::RegisterNativeGraph(graphId, &LY_SC_UnitTest_Meta_AddSuccess::Create, sourceHash + 1);
+
+    const size_t createCount = LY_SC_UnitTest_Meta_AddSuccess::s_createCount;
+
+    AZ_TEST_START_TRACE_SUPPRESSION;
+    const Reporter interpreted = RunUnitTestGraph("LY_SC_UnitTest_Meta_AddSuccess", ExecutionMode::Interpreted, nullptr);
+    const Reporter fallback = RunUnitTestGraph("LY_SC_UnitTest_Meta_AddSuccess", ExecutionMode::Native, nullptr);
+    AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+
+    Execution::UnregisterNativeGraph(graphId);
+
+    VerifyReporter(fallback);
+    EXPECT_EQ(LY_SC_UnitTest_Meta_AddSuccess::s_createCount, createCount);
+    EXPECT_EQ(fallback, interpreted);
+}
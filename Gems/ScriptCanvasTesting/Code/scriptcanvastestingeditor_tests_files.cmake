@@ -22,6 +22,7 @@ set(FILES
     Tests/ScriptCanvas_FileHandling.cpp
     Tests/ScriptCanvas_Math.cpp
     Tests/ScriptCanvas_MethodOverload.cpp
+    Tests/ScriptCanvas_Native.cpp
     Tests/ScriptCanvas_RuntimeInterpreted.cpp
     Tests/ScriptCanvas_Slots.cpp
     Tests/ScriptCanvas_StringNodes.cpp
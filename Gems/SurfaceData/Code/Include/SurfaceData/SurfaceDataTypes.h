@@ -13,6 +13,7 @@
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzFramework/SurfaceData/SurfaceData.h>
@@ -55,40 +56,40 @@ namespace SurfaceData
         //! @param weight - The surface tag weight.
         void AddSurfaceTagWeight(const AZ::Crc32 tag, const float weight)
         {
-            for (auto weightItr = m_weights.begin(); weightItr != m_weights.end(); ++weightItr)
+            const AZ::u32 tagValue = tag;
+
+            // Since we need to scan for duplicate surface types, store the entries sorted by surface type so that we can
+            // early-out once we pass the location for the entry instead of always searching every entry.
+            size_t insertIndex = 0;
+            for (; insertIndex < m_size; ++insertIndex)
             {
-                // Since we need to scan for duplicate surface types, store the entries sorted by surface type so that we can
-                // early-out once we pass the location for the entry instead of always searching every entry.
-                if (weightItr->m_surfaceType > tag)
+                if (m_tags[insertIndex] == tagValue)
                 {
-                    if (m_weights.size() != AzFramework::SurfaceData::Constants::MaxSurfaceWeights)
-                    {
-                        // We didn't find the surface type, so add the new entry in sorted order.
-                        m_weights.insert(weightItr, { tag, weight });
-                    }
-                    else
-                    {
-                        AZ_Assert(false, "SurfaceTagWeights has reached max capacity, it cannot add a new tag / weight.");
-                    }
+                    // We found the surface type, so just keep the higher of the two weights.
+                    m_weights[insertIndex] = AZ::GetMax(weight, m_weights[insertIndex]);
                     return;
                 }
-                else if (weightItr->m_surfaceType == tag)
+                else if (m_tags[insertIndex] > tagValue)
                 {
-                    // We found the surface type, so just keep the higher of the two weights.
-                    weightItr->m_weight = AZ::GetMax(weight, weightItr->m_weight);
-                    return;
+                    break;
                 }
             }
 
-            // We didn't find the surface weight, and the sort order for it is at the end, so add it to the back of the list.
-            if (m_weights.size() != AzFramework::SurfaceData::Constants::MaxSurfaceWeights)
+            if (m_size == MaxSurfaceWeights)
             {
-                m_weights.emplace_back(tag, weight);
+                AZ_Assert(false, "SurfaceTagWeights has reached max capacity, it cannot add a new tag / weight.");
+                return;
             }
-            else
+
+            // We didn't find the surface type, so add the new entry in sorted order.
+            for (size_t index = m_size; index > insertIndex; --index)
             {
-                AZ_Assert(false, "SurfaceTagWeights has reached max capacity, it cannot add a new tag / weight.");
+                m_tags[index] = m_tags[index - 1];
+                m_weights[index] = m_weights[index - 1];
             }
+            m_tags[insertIndex] = tagValue;
+            m_weights[insertIndex] = weight;
+            ++m_size;
         }
 
         //! Add surface tags and weights to this collection. If a tag already exists, the higher weight will be preserved.
@@ -104,15 +105,10 @@ namespace SurfaceData
         }
 
         //! Add surface tags and weights to this collection. If a tag already exists, the higher weight will be preserved.
-        //! (This method is intentionally inlined for its performance impact)
+        //! Collections with the same set of tags, which is the common case when merging similar surface points, are merged
+        //! with a vectorized max of the weight columns.
         //! @param weights - The surface tags and weights to replace/add.
-        void AddSurfaceTagWeights(const SurfaceTagWeights& weights)
-        {
-            for (const auto& [tag, weight] : weights.m_weights)
-            {
-                AddSurfaceTagWeight(tag, weight);
-            }
-        }
+        void AddSurfaceTagWeights(const SurfaceTagWeights& weights);
 
         //! Equality comparison operator for SurfaceTagWeights.
         bool operator==(const SurfaceTagWeights& rhs) const;
@@ -179,12 +175,20 @@ namespace SurfaceData
         bool HasAnyMatchingTags(AZStd::span<const SurfaceTag> sampleTags, float weightMin, float weightMax) const;
 
     private:
+        static constexpr size_t MaxSurfaceWeights = AzFramework::SurfaceData::Constants::MaxSurfaceWeights;
+        static_assert(
+            (MaxSurfaceWeights % 8) == 0, "SurfaceTagWeights columns are processed in batches of 8, MaxSurfaceWeights must be a multiple of 8.");
+
         //! Search for the given tag entry.
         //! @param tag - The tag to search for.
-        //! @return The pointer to the tag that's found, or end() if it wasn't found.
-        const AzFramework::SurfaceData::SurfaceTagWeight* FindTag(AZ::Crc32 tag) const;
-
-        AZStd::fixed_vector<AzFramework::SurfaceData::SurfaceTagWeight, AzFramework::SurfaceData::Constants::MaxSurfaceWeights> m_weights;
+        //! @return The index of the tag that's found, or m_size if it wasn't found.
+        size_t FindTag(AZ::Crc32 tag) const;
+
+        //! The tags and weights are stored as two fixed-width columns so that the filter and merge operations can process
+        //! several entries at once. Only the first m_size entries of each column are valid, and the tags are kept sorted.
+        AZStd::array<AZ::u32, MaxSurfaceWeights> m_tags = {};
+        AZStd::array<float, MaxSurfaceWeights> m_weights = {};
+        size_t m_size = 0;
     };
 
 
@@ -6,13 +6,83 @@
  *
  */
 
+#include <AzCore/Math/SimdMath.h>
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
 
 namespace SurfaceData
 {
+    namespace SurfaceTagWeightsInternal
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        // The columns are processed in batches of two Vec4 blocks, so each sample tag is splatted once per 8 entries and the
+        // early-out lane test only runs once per batch.
+        static constexpr size_t BatchSize = 2 * Vec4::ElementCount;
+
+        // A lane mask or tag values for one batch of entries.
+        struct Int32Batch
+        {
+            Vec4::Int32Type m_low;
+            Vec4::Int32Type m_high;
+        };
+
+        Int32Batch LoadTags(const AZ::u32* tags)
+        {
+            const int32_t* tagValues = reinterpret_cast<const int32_t*>(tags);
+            return { Vec4::LoadUnaligned(tagValues), Vec4::LoadUnaligned(tagValues + Vec4::ElementCount) };
+        }
+
+        Vec4::Int32Type SplatTag(AZ::Crc32 tag)
+        {
+            return Vec4::Splat(static_cast<int32_t>(static_cast<AZ::u32>(tag)));
+        }
+
+        Int32Batch And(const Int32Batch& lhs, const Int32Batch& rhs)
+        {
+            return { Vec4::And(lhs.m_low, rhs.m_low), Vec4::And(lhs.m_high, rhs.m_high) };
+        }
+
+        // Get a mask with every bit set in the lanes of the batch starting at batchStart that hold one of the first 'size' entries.
+        Int32Batch GetValidLaneMask(size_t batchStart, size_t size)
+        {
+            const Vec4::Int32Type lowLaneIndices = Vec4::Add(
+                Vec4::LoadImmediate(0, 1, 2, 3), Vec4::Splat(aznumeric_cast<int32_t>(batchStart)));
+            const Vec4::Int32Type highLaneIndices = Vec4::Add(lowLaneIndices, Vec4::Splat(aznumeric_cast<int32_t>(Vec4::ElementCount)));
+            const Vec4::Int32Type sizeSplat = Vec4::Splat(aznumeric_cast<int32_t>(size));
+            return { Vec4::CmpLt(lowLaneIndices, sizeSplat), Vec4::CmpLt(highLaneIndices, sizeSplat) };
+        }
+
+        // Get a mask of the lanes in the batch whose weight is within [weightMin, weightMax].
+        Int32Batch GetWeightInRangeMask(const float* weights, Vec4::FloatArgType weightMin, Vec4::FloatArgType weightMax)
+        {
+            const Vec4::FloatType lowWeights = Vec4::LoadUnaligned(weights);
+            const Vec4::FloatType highWeights = Vec4::LoadUnaligned(weights + Vec4::ElementCount);
+            return { Vec4::CastToInt(Vec4::And(Vec4::CmpGtEq(lowWeights, weightMin), Vec4::CmpLtEq(lowWeights, weightMax))),
+                     Vec4::CastToInt(Vec4::And(Vec4::CmpGtEq(highWeights, weightMin), Vec4::CmpLtEq(highWeights, weightMax))) };
+        }
+
+        bool AnyLaneSet(const Int32Batch& mask)
+        {
+            return !Vec4::CmpAllEq(Vec4::Or(mask.m_low, mask.m_high), Vec4::ZeroInt());
+        }
+
+        // Get a lane mask of the entries in the batch whose tag matches any of the sample tags.
+        Int32Batch MatchTags(const Int32Batch& tags, AZStd::span<const SurfaceTag> sampleTags)
+        {
+            Int32Batch matches = { Vec4::ZeroInt(), Vec4::ZeroInt() };
+            for (const auto& sampleTag : sampleTags)
+            {
+                const Vec4::Int32Type sampleTagSplat = SplatTag(sampleTag);
+                matches.m_low = Vec4::Or(matches.m_low, Vec4::CmpEq(tags.m_low, sampleTagSplat));
+                matches.m_high = Vec4::Or(matches.m_high, Vec4::CmpEq(tags.m_high, sampleTagSplat));
+            }
+            return matches;
+        }
+    } // namespace SurfaceTagWeightsInternal
+
     void SurfaceTagWeights::AssignSurfaceTagWeights(const AzFramework::SurfaceData::SurfaceTagWeightList& weights)
     {
-        m_weights.clear();
+        m_size = 0;
         for (auto& weight : weights)
         {
             AddSurfaceTagWeight(weight.m_surfaceType, weight.m_weight);
@@ -21,30 +91,100 @@ namespace SurfaceData
 
     void SurfaceTagWeights::AssignSurfaceTagWeights(const SurfaceTagVector& tags, float weight)
     {
-        m_weights.clear();
+        m_size = 0;
         for (auto& tag : tags)
         {
             AddSurfaceTagWeight(tag.operator AZ::Crc32(), weight);
         }
     }
 
+    void SurfaceTagWeights::AddSurfaceTagWeights(const SurfaceTagWeights& weights)
+    {
+        using namespace SurfaceTagWeightsInternal;
+
+        // Fast path: when both collections contain the exact same tags, which is the common case for merged surface points,
+        // the merge is just a max of the two weight columns.
+        bool sameTags = (m_size == weights.m_size);
+        for (size_t batchStart = 0; sameTags && (batchStart < m_size); batchStart += BatchSize)
+        {
+            const Int32Batch tags = LoadTags(&m_tags[batchStart]);
+            const Int32Batch otherTags = LoadTags(&weights.m_tags[batchStart]);
+            const Int32Batch validLanes = GetValidLaneMask(batchStart, m_size);
+            const Int32Batch differentLanes = { Vec4::AndNot(Vec4::CmpEq(tags.m_low, otherTags.m_low), validLanes.m_low),
+                                                Vec4::AndNot(Vec4::CmpEq(tags.m_high, otherTags.m_high), validLanes.m_high) };
+            sameTags = !AnyLaneSet(differentLanes);
+        }
+
+        if (sameTags)
+        {
+            // The lanes past m_size are unused, so it doesn't matter what gets written into them.
+            for (size_t blockStart = 0; blockStart < m_size; blockStart += Vec4::ElementCount)
+            {
+                Vec4::StoreUnaligned(
+                    &m_weights[blockStart],
+                    Vec4::Max(Vec4::LoadUnaligned(&m_weights[blockStart]), Vec4::LoadUnaligned(&weights.m_weights[blockStart])));
+            }
+            return;
+        }
+
+        // Otherwise, merge the two sorted columns in a single pass.
+        AZStd::array<AZ::u32, MaxSurfaceWeights * 2> mergedTags;
+        AZStd::array<float, MaxSurfaceWeights * 2> mergedWeights;
+        size_t mergedSize = 0;
+        size_t index = 0;
+        size_t otherIndex = 0;
+        while ((index < m_size) || (otherIndex < weights.m_size))
+        {
+            if ((otherIndex == weights.m_size) || ((index < m_size) && (m_tags[index] < weights.m_tags[otherIndex])))
+            {
+                mergedTags[mergedSize] = m_tags[index];
+                mergedWeights[mergedSize] = m_weights[index++];
+            }
+            else if ((index == m_size) || (weights.m_tags[otherIndex] < m_tags[index]))
+            {
+                mergedTags[mergedSize] = weights.m_tags[otherIndex];
+                mergedWeights[mergedSize] = weights.m_weights[otherIndex++];
+            }
+            else
+            {
+                mergedTags[mergedSize] = m_tags[index];
+                mergedWeights[mergedSize] = AZ::GetMax(m_weights[index++], weights.m_weights[otherIndex++]);
+            }
+            ++mergedSize;
+        }
+
+        if (mergedSize > MaxSurfaceWeights)
+        {
+            // Adding the tags one at a time preserves the existing entries and asserts on the ones that don't fit.
+            for (size_t otherTagIndex = 0; otherTagIndex < weights.m_size; ++otherTagIndex)
+            {
+                AddSurfaceTagWeight(weights.m_tags[otherTagIndex], weights.m_weights[otherTagIndex]);
+            }
+            return;
+        }
+
+        AZStd::copy(mergedTags.begin(), mergedTags.begin() + mergedSize, m_tags.begin());
+        AZStd::copy(mergedWeights.begin(), mergedWeights.begin() + mergedSize, m_weights.begin());
+        m_size = mergedSize;
+    }
+
     void SurfaceTagWeights::Clear()
     {
-        m_weights.clear();
+        m_size = 0;
     }
 
     size_t SurfaceTagWeights::GetSize() const
     {
-        return m_weights.size();
+        return m_size;
     }
 
     AzFramework::SurfaceData::SurfaceTagWeightList SurfaceTagWeights::GetSurfaceTagWeightList() const
     {
         AzFramework::SurfaceData::SurfaceTagWeightList weights;
 
-        for (auto& weight : m_weights)
+        for (size_t index = 0; index < m_size; ++index)
         {
-            weights.emplace_back(weight);
+            weights.emplace_back(AZ::Crc32(m_tags[index]), m_weights[index]);
         }
         return weights;
     }
@@ -52,25 +192,27 @@ namespace SurfaceData
     bool SurfaceTagWeights::operator==(const SurfaceTagWeights& rhs) const
     {
         // If the lists are different sizes, they're not equal.
-        if (m_weights.size() != rhs.m_weights.size())
+        if (m_size != rhs.m_size)
         {
             return false;
         }
 
         // The lists are stored in sorted order, so we can compare every entry in order for equivalence.
-        return (m_weights == rhs.m_weights);
+        return AZStd::equal(m_tags.begin(), m_tags.begin() + m_size, rhs.m_tags.begin()) &&
+            AZStd::equal(m_weights.begin(), m_weights.begin() + m_size, rhs.m_weights.begin());
     }
 
     bool SurfaceTagWeights::SurfaceWeightsAreEqual(const AzFramework::SurfaceData::SurfaceTagWeightList& compareWeights) const
     {
         // If the lists are different sizes, they're not equal.
-        if (m_weights.size() != compareWeights.size())
+        if (m_size != compareWeights.size())
         {
             return false;
         }
 
-        for (auto& weight : m_weights)
+        for (size_t index = 0; index < m_size; ++index)
         {
+            const AzFramework::SurfaceData::SurfaceTagWeight weight(AZ::Crc32(m_tags[index]), m_weights[index]);
             auto maskEntry = AZStd::find_if(
                 compareWeights.begin(), compareWeights.end(),
                 [weight](const AzFramework::SurfaceData::SurfaceTagWeight& compareWeight) -> bool
@@ -91,9 +233,9 @@ namespace SurfaceData
 
     void SurfaceTagWeights::EnumerateWeights(AZStd::function<bool(AZ::Crc32 tag, float weight)> weightCallback) const
     {
-        for (auto& [tag, weight] : m_weights)
+        for (size_t index = 0; index < m_size; ++index)
         {
-            if (!weightCallback(tag, weight))
+            if (!weightCallback(AZ::Crc32(m_tags[index]), m_weights[index]))
             {
                 break;
             }
@@ -102,9 +244,9 @@ namespace SurfaceData
 
     bool SurfaceTagWeights::HasValidTags() const
     {
-        for (const auto& weight : m_weights)
+        for (size_t index = 0; index < m_size; ++index)
         {
-            if (weight.m_surfaceType != Constants::s_unassignedTagCrc)
+            if (AZ::Crc32(m_tags[index]) != Constants::s_unassignedTagCrc)
             {
                 return true;
             }
@@ -114,14 +256,18 @@ namespace SurfaceData
 
     bool SurfaceTagWeights::HasMatchingTag(AZ::Crc32 sampleTag) const
     {
-        return FindTag(sampleTag) != m_weights.end();
+        return FindTag(sampleTag) != m_size;
     }
 
     bool SurfaceTagWeights::HasAnyMatchingTags(AZStd::span<const SurfaceTag> sampleTags) const
     {
-        for (const auto& sampleTag : sampleTags)
+        using namespace SurfaceTagWeightsInternal;
+
+        // Compare each batch of the tag column against every sample tag at once instead of searching for each sample tag.
+        for (size_t batchStart = 0; batchStart < m_size; batchStart += BatchSize)
         {
-            if (HasMatchingTag(sampleTag))
+            const Int32Batch matches = MatchTags(LoadTags(&m_tags[batchStart]), sampleTags);
+            if (AnyLaneSet(And(matches, GetValidLaneMask(batchStart, m_size))))
             {
                 return true;
             }
@@ -132,15 +278,21 @@ namespace SurfaceData
 
     bool SurfaceTagWeights::HasMatchingTag(AZ::Crc32 sampleTag, float weightMin, float weightMax) const
     {
-        auto weightEntry = FindTag(sampleTag);
-        return weightEntry != m_weights.end() && weightMin <= weightEntry->m_weight && weightMax >= weightEntry->m_weight;
+        const size_t index = FindTag(sampleTag);
+        return index != m_size && weightMin <= m_weights[index] && weightMax >= m_weights[index];
     }
 
     bool SurfaceTagWeights::HasAnyMatchingTags(AZStd::span<const SurfaceTag> sampleTags, float weightMin, float weightMax) const
     {
-        for (const auto& sampleTag : sampleTags)
+        using namespace SurfaceTagWeightsInternal;
+
+        const Vec4::FloatType minWeight = Vec4::Splat(weightMin);
+        const Vec4::FloatType maxWeight = Vec4::Splat(weightMax);
+        for (size_t batchStart = 0; batchStart < m_size; batchStart += BatchSize)
         {
-            if (HasMatchingTag(sampleTag, weightMin, weightMax))
+            const Int32Batch inRange = GetWeightInRangeMask(&m_weights[batchStart], minWeight, maxWeight);
+            const Int32Batch matches = MatchTags(LoadTags(&m_tags[batchStart]), sampleTags);
+            if (AnyLaneSet(And(And(matches, inRange), GetValidLaneMask(batchStart, m_size))))
             {
                 return true;
             }
@@ -149,23 +301,24 @@ namespace SurfaceData
         return false;
     }
 
-    const AzFramework::SurfaceData::SurfaceTagWeight* SurfaceTagWeights::FindTag(AZ::Crc32 tag) const
+    size_t SurfaceTagWeights::FindTag(AZ::Crc32 tag) const
     {
-        for (auto weightItr = m_weights.begin(); weightItr != m_weights.end(); ++weightItr)
+        const AZ::u32 tagValue = tag;
+        for (size_t index = 0; index < m_size; ++index)
         {
-            if (weightItr->m_surfaceType == tag)
+            if (m_tags[index] == tagValue)
             {
-                // Found the tag, return a pointer to the entry.
-                return weightItr;
+                // Found the tag, return the index of the entry.
+                return index;
             }
-            else if (weightItr->m_surfaceType > tag)
+            else if (m_tags[index] > tagValue)
             {
                 // Our list is stored in sorted order by surfaceType, so early-out if our values get too high.
                 break;
             }
         }
 
-        // The tag wasn't found, so return end().
-        return m_weights.end();
+        // The tag wasn't found, so return m_size.
+        return m_size;
     }
 }
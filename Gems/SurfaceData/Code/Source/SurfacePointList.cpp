@@ -204,45 +204,24 @@ namespace SurfaceData
         // Filter out any points that don't match our search tags.
         // This has to be done after the Surface Modifiers have processed the points, not at point insertion time, because
         // Surface Modifiers add tags to existing points.
-        // The algorithm below is basically an "erase_if" that's operating across multiple storage vectors and using one level of
-        // indirection to keep our sorted indices valid.
+        // The algorithm below is basically an "erase_if" on the sorted indices for each input position. The surface point data
+        // itself is only referenced through the sorted indices, so the filtered-out points are simply left unreferenced in the
+        // storage vectors instead of shifting all of the remaining point data.
         // At some point we might want to consider modifying this to compact the final storage to the minimum needed.
         for (size_t inputIndex = 0; (inputIndex < m_inputPositionSize); inputIndex++)
         {
             size_t surfacePointStartIndex = GetSurfacePointStartIndexFromInPositionIndex(inputIndex);
             size_t listSize = (surfacePointStartIndex + m_numSurfacePointsPerInput[inputIndex]);
             size_t index = surfacePointStartIndex;
-            for (; index < listSize; index++)
+            for (size_t next = surfacePointStartIndex; next < listSize; ++next)
             {
-                if (!m_surfaceWeightsList[m_sortedSurfacePointIndices[index]].HasAnyMatchingTags(desiredTags))
+                if (m_surfaceWeightsList[m_sortedSurfacePointIndices[next]].HasAnyMatchingTags(desiredTags))
                 {
-                    break;
+                    m_sortedSurfacePointIndices[index++] = m_sortedSurfacePointIndices[next];
                 }
             }
 
-            if (index != listSize)
-            {
-                size_t next = index + 1;
-                for (; next < listSize; ++next)
-                {
-                    if (m_surfaceWeightsList[m_sortedSurfacePointIndices[next]].HasAnyMatchingTags(desiredTags))
-                    {
-                        m_sortedSurfacePointIndices[index] = AZStd::move(m_sortedSurfacePointIndices[next]);
-                        m_surfaceCreatorIdList[m_sortedSurfacePointIndices[index]] =
-                            AZStd::move(m_surfaceCreatorIdList[m_sortedSurfacePointIndices[next]]);
-                        m_surfacePositionList[m_sortedSurfacePointIndices[index]] =
-                            AZStd::move(m_surfacePositionList[m_sortedSurfacePointIndices[next]]);
-                        m_surfaceNormalList[m_sortedSurfacePointIndices[index]] =
-                            AZStd::move(m_surfaceNormalList[m_sortedSurfacePointIndices[next]]);
-                        m_surfaceWeightsList[m_sortedSurfacePointIndices[index]] =
-                            AZStd::move(m_surfaceWeightsList[m_sortedSurfacePointIndices[next]]);
-
-                        ++index;
-                    }
-                }
-
-                m_numSurfacePointsPerInput[inputIndex] = index - surfacePointStartIndex;
-            }
+            m_numSurfacePointsPerInput[inputIndex] = index - surfacePointStartIndex;
         }
     }
 
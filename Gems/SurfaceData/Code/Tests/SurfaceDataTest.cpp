@@ -1042,5 +1042,138 @@ TEST_F(SurfaceDataTestApp, SurfaceData_FirstPointFilteredOut_SurfacePointListRem
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_SurfaceTagWeightsMergeAndMatchCorrectly)
+{
+    // Use a partially-filled batch of tags so that the unused lanes of the last batch are exercised.
+    AzFramework::SurfaceData::SurfaceTagWeightList weightList;
+    for (uint32_t tagIndex = 0; tagIndex < 6; tagIndex++)
+    {
+        weightList.emplace_back(AZ::Crc32(AZ::u32(100 + tagIndex)), aznumeric_cast<float>(tagIndex) / 10.0f);
+    }
+
+    SurfaceData::SurfaceTagWeights weights(weightList);
+    SurfaceData::SurfaceTagWeights sameTagWeights;
+    sameTagWeights.AssignSurfaceTagWeights(
+        { SurfaceData::SurfaceTag(AZ::Crc32(AZ::u32(100))), SurfaceData::SurfaceTag(AZ::Crc32(AZ::u32(101))),
+          SurfaceData::SurfaceTag(AZ::Crc32(AZ::u32(102))), SurfaceData::SurfaceTag(AZ::Crc32(AZ::u32(103))),
+          SurfaceData::SurfaceTag(AZ::Crc32(AZ::u32(104))), SurfaceData::SurfaceTag(AZ::Crc32(AZ::u32(105))) },
+        0.25f);
+
+    // TEST: Merging the same set of tags keeps the higher weight for every tag.
+    weights.AddSurfaceTagWeights(sameTagWeights);
+    EXPECT_EQ(weights.GetSize(), 6);
+    EXPECT_TRUE(weights.HasMatchingTag(AZ::Crc32(AZ::u32(100)), 0.25f, 0.25f));
+    EXPECT_TRUE(weights.HasMatchingTag(AZ::Crc32(AZ::u32(105)), 0.5f, 0.5f));
+
+    // TEST: Merging a different set of tags keeps the tags sorted and adds the new ones.
+    SurfaceData::SurfaceTagWeights otherTagWeights;
+    otherTagWeights.AddSurfaceTagWeight(AZ::Crc32(AZ::u32(50)), 1.0f);
+    otherTagWeights.AddSurfaceTagWeight(AZ::Crc32(AZ::u32(103)), 1.0f);
+    weights.AddSurfaceTagWeights(otherTagWeights);
+    EXPECT_EQ(weights.GetSize(), 7);
+    EXPECT_TRUE(weights.HasMatchingTag(AZ::Crc32(AZ::u32(50)), 1.0f, 1.0f));
+    EXPECT_TRUE(weights.HasMatchingTag(AZ::Crc32(AZ::u32(103)), 1.0f, 1.0f));
+
+    AZ::u32 previousTag = 0;
+    weights.EnumerateWeights(
+        [&previousTag](AZ::Crc32 tag, [[maybe_unused]] float weight) -> bool
+        {
+            EXPECT_GT(static_cast<AZ::u32>(tag), previousTag);
+            previousTag = tag;
+            return true;
+        });
+
+    // TEST: Tag matching only considers the stored tags, including the ones in the last partially-filled batch.
+    AZStd::array<SurfaceData::SurfaceTag, 2> matchingTags = { SurfaceData::SurfaceTag(AZ::Crc32(AZ::u32(1))),
+                                                               SurfaceData::SurfaceTag(AZ::Crc32(AZ::u32(105))) };
+    AZStd::array<SurfaceData::SurfaceTag, 1> missingTags = { SurfaceData::SurfaceTag(AZ::Crc32(AZ::u32(0))) };
+    EXPECT_TRUE(weights.HasAnyMatchingTags(matchingTags));
+    EXPECT_FALSE(weights.HasAnyMatchingTags(missingTags));
+    EXPECT_TRUE(weights.HasAnyMatchingTags(matchingTags, 0.5f, 1.0f));
+    EXPECT_FALSE(weights.HasAnyMatchingTags(matchingTags, 0.6f, 1.0f));
+}
+
+TEST_F(SurfaceDataTestApp, SurfaceData_SurfaceTagWeightsSimdMatchesScalarReference)
+{
+    // Every tag is drawn from a pool of MaxSurfaceWeights values so that merged collections can never overflow, and the sample
+    // tags are drawn from a slightly larger pool so that some of them are missing.
+    constexpr AZ::u32 TagPoolSize = static_cast<AZ::u32>(AzFramework::SurfaceData::Constants::MaxSurfaceWeights);
+    constexpr AZ::u32 FirstTag = 1000;
+    const AZStd::array<float, 5> weightValues = { 0.0f, 0.25f, 0.5f, 0.75f, 1.0f };
+    AZ::SimpleLcgRandom random(5678);
+
+    auto createWeights = [&](size_t size, const SurfaceData::SurfaceTagWeights* sameTags) -> SurfaceData::SurfaceTagWeights
+    {
+        SurfaceData::SurfaceTagWeights weights;
+        if (sameTags)
+        {
+            sameTags->EnumerateWeights(
+                [&](AZ::Crc32 tag, [[maybe_unused]] float weight) -> bool
+                {
+                    weights.AddSurfaceTagWeight(tag, weightValues[random.GetRandom() % weightValues.size()]);
+                    return true;
+                });
+            return weights;
+        }
+
+        while (weights.GetSize() < size)
+        {
+            weights.AddSurfaceTagWeight(
+                AZ::Crc32(FirstTag + (random.GetRandom() % TagPoolSize)), weightValues[random.GetRandom() % weightValues.size()]);
+        }
+        return weights;
+    };
+
+    // Cover every size from empty to full, so both full and partially-filled batches are compared.
+    for (size_t size = 0; size <= TagPoolSize; size++)
+    {
+        for (int iteration = 0; iteration < 20; iteration++)
+        {
+            SurfaceData::SurfaceTagWeights weights = createWeights(size, nullptr);
+
+            AZStd::vector<SurfaceData::SurfaceTag> sampleTags;
+            const size_t sampleTagCount = random.GetRandom() % 4;
+            for (size_t sampleIndex = 0; sampleIndex < sampleTagCount; sampleIndex++)
+            {
+                sampleTags.emplace_back(AZ::Crc32(FirstTag + (random.GetRandom() % (TagPoolSize + 4))));
+            }
+
+            const float weightMin = weightValues[random.GetRandom() % weightValues.size()];
+            const float weightMax = weightValues[random.GetRandom() % weightValues.size()];
+
+            // TEST: The vectorized matching returns the same result as searching for each sample tag separately.
+            bool expectedMatch = false;
+            bool expectedMatchInRange = false;
+            for (const auto& sampleTag : sampleTags)
+            {
+                expectedMatch = expectedMatch || weights.HasMatchingTag(sampleTag);
+                expectedMatchInRange = expectedMatchInRange || weights.HasMatchingTag(sampleTag, weightMin, weightMax);
+            }
+            EXPECT_EQ(weights.HasAnyMatchingTags(sampleTags), expectedMatch);
+            EXPECT_EQ(weights.HasAnyMatchingTags(sampleTags, weightMin, weightMax), expectedMatchInRange);
+
+            // TEST: The vectorized merge, for both the same set of tags and a different set of tags, returns the same result as
+            // adding each tag separately.
+            for (bool useSameTags : { true, false })
+            {
+                const SurfaceData::SurfaceTagWeights otherWeights =
+                    createWeights(random.GetRandom() % (TagPoolSize + 1), useSameTags ? &weights : nullptr);
+
+                SurfaceData::SurfaceTagWeights expectedWeights = weights;
+                otherWeights.EnumerateWeights(
+                    [&expectedWeights](AZ::Crc32 tag, float weight) -> bool
+                    {
+                        expectedWeights.AddSurfaceTagWeight(tag, weight);
+                        return true;
+                    });
+
+                SurfaceData::SurfaceTagWeights mergedWeights = weights;
+                mergedWeights.AddSurfaceTagWeights(otherWeights);
+                EXPECT_EQ(mergedWeights, expectedWeights);
+            }
+        }
+    }
+}
+
 // This uses custom test / benchmark hooks so that we can load LmbrCentral and use Shape components in our unit tests and benchmarks.
 AZ_UNIT_TEST_HOOK(new UnitTest::SurfaceDataTestEnvironment, UnitTest::SurfaceDataBenchmarkEnvironment);
@@ -39,6 +39,9 @@ namespace UnitTest
         MOCK_METHOD2(
             RefreshRegion,
             void(const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask));
+        MOCK_METHOD1(BakeTerrainTiles, bool(AZStd::string_view path));
+        MOCK_METHOD1(LoadBakedTerrainTiles, bool(AZStd::string_view path));
+        MOCK_METHOD0(UnloadBakedTerrainTiles, void());
     };
 
     class MockTerrainAreaHeightRequests : public Terrain::TerrainAreaHeightRequestBus::Handler
@@ -9,34 +9,91 @@
 #include <TerrainRaycast/TerrainRaycastContext.h>
 #include <TerrainSystem/TerrainSystem.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/sort.h>
 
 using namespace Terrain;
 
+AZ_CVAR(uint32_t, terrain_raycastChunkCacheSize, 64, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "The maximum number of terrain height chunks cached for raycasts. Each chunk holds the heights of 64x64 terrain grid cells.");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+struct TerrainRaycastContext::HeightChunk
+{
+    static constexpr int32_t CellsPerChunk = 64;
+    static constexpr int32_t PointsPerChunk = CellsPerChunk + 1;
+    static constexpr int32_t LevelCount = 7; //!< Quadtree levels from 64x64 cells down to the single root node
+
+    AZ::Vector2 m_minCorner;
+    float m_cellSize = 1.0f;
+
+    //! Terrain heights at the corners of every cell, PointsPerChunk x PointsPerChunk in row-major order
+    AZStd::vector<float> m_heights;
+
+    //! Min/max terrain height of the quadtree nodes on each level, level 0 holds one node per cell
+    AZStd::array<AZStd::vector<float>, LevelCount> m_minHeights;
+    AZStd::array<AZStd::vector<float>, LevelCount> m_maxHeights;
+
+    float GetHeight(int32_t x, int32_t y) const
+    {
+        return m_heights[y * PointsPerChunk + x];
+    }
+
+    void BuildQuadtree()
+    {
+        for (int32_t level = 0; level < LevelCount; ++level)
+        {
+            const int32_t nodesPerSide = CellsPerChunk >> level;
+            m_minHeights[level].resize(nodesPerSide * nodesPerSide);
+            m_maxHeights[level].resize(nodesPerSide * nodesPerSide);
+
+            for (int32_t y = 0; y < nodesPerSide; ++y)
+            {
+                for (int32_t x = 0; x < nodesPerSide; ++x)
+                {
+                    // Cells are bounded by their 4 corner heights, and every other node by its 4 children.
+                    AZStd::array<float, 4> minValues;
+                    AZStd::array<float, 4> maxValues;
+                    if (level == 0)
+                    {
+                        minValues = maxValues = { GetHeight(x, y), GetHeight(x + 1, y), GetHeight(x, y + 1), GetHeight(x + 1, y + 1) };
+                    }
+                    else
+                    {
+                        const int32_t childNodesPerSide = nodesPerSide * 2;
+                        const int32_t child = (y * 2) * childNodesPerSide + (x * 2);
+                        const auto& childMin = m_minHeights[level - 1];
+                        const auto& childMax = m_maxHeights[level - 1];
+                        minValues = { childMin[child], childMin[child + 1], childMin[child + childNodesPerSide], childMin[child + childNodesPerSide + 1] };
+                        maxValues = { childMax[child], childMax[child + 1], childMax[child + childNodesPerSide], childMax[child + childNodesPerSide + 1] };
+                    }
+
+                    m_minHeights[level][y * nodesPerSide + x] = AZStd::min(AZStd::min(minValues[0], minValues[1]), AZStd::min(minValues[2], minValues[3]));
+                    m_maxHeights[level][y * nodesPerSide + x] = AZStd::max(AZStd::max(maxValues[0], maxValues[1]), AZStd::max(maxValues[2], maxValues[3]));
+                }
+            }
+        }
+    }
+};
+
 namespace
 {
     ////////////////////////////////////////////////////////////////////////////////////////////////////
-    // Convenience function to get the terrain height values at each corner of an AABB, triangulate them,
+    // Convenience function to triangulate the four terrain heights at the corners of a grid square,
     // and then find the nearest intersection (if any) between the resulting triangles and the given ray.
-    static void TriangulateAndFindNearestIntersection(const TerrainSystem& terrainSystem,
-                                                      const AZ::Aabb& aabb,
+    static bool TriangulateAndFindNearestIntersection(AZ::Vector3 point0,
+                                                      AZ::Vector3 point1,
+                                                      AZ::Vector3 point2,
+                                                      AZ::Vector3 point3,
                                                       const AZ::Intersect::SegmentTriangleHitTester& hitTester,
                                                       AzFramework::RenderGeometry::RayResult& result)
     {
-        // Obtain the height values at each corner of the AABB.
-        const AZ::Vector3& aabbMin = aabb.GetMin();
-        const AZ::Vector3& aabbMax = aabb.GetMax();
-        AZ::Vector3 point0 = aabbMin;
-        AZ::Vector3 point2 = aabbMax;
-        AZ::Vector3 point1(point0.GetX(), point2.GetY(), 0.0f);
-        AZ::Vector3 point3(point2.GetX(), point0.GetY(), 0.0f);
-        point0.SetZ(terrainSystem.GetHeight(point0, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
-        point1.SetZ(terrainSystem.GetHeight(point1, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
-        point2.SetZ(terrainSystem.GetHeight(point2, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
-        point3.SetZ(terrainSystem.GetHeight(point3, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
-
-        // Finally, triangulate the four terrain points and check for a hit,
+        // Triangulate the four terrain points and check for a hit,
         // splitting using the top-left -> bottom-right diagonal so to match
         // the current behavior of the terrain physics and rendering systems.
         AZ::Vector3 bottomLeftHitNormal;
@@ -54,15 +111,100 @@ namespace
             result.m_distance = bottomLeftHitDistance;
             result.m_worldNormal = bottomLeftHitNormal;
             result.m_worldPosition = hitTester.GetIntersectionPoint(result.m_distance);
+            return true;
         }
         else if (topRightHit)
         {
             result.m_distance = topRightHitDistance;
             result.m_worldNormal = topRightHitNormal;
             result.m_worldPosition = hitTester.GetIntersectionPoint(result.m_distance);
+            return true;
         }
+        return false;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Convenience function to walk through each grid square of the given size that intersects the XY coordinates of a line
+    // segment, in order from nearest to farthest, until the visitor returns true.
+    // To step through the grid, we use an algorithm similar to Bresenham's line algorithm or a Digital
+    // Differential Analyzer. We can't use Bresenham's line algorithm itself because it will sometimes skip
+    // squares if the ray only passes through a tiny portion, and we need to use every square that it passes through.
+    template<typename Visitor>
+    static void WalkGridSquares(const AZ::Vector2& start, const AZ::Vector2& end, float squareSize, Visitor&& visitor)
+    {
+        const AZ::Vector2 gridSize(squareSize);
+        const AZ::Vector2 lineSegment = end - start;
+
+        // Calculate the total number of grid squares we'll need to visit to trace the line segment.
+        // We need to visit 1 at the start, 1 for each X square we need to move, and 1 for each Y square we need to move,
+        // since we'll always move either horizontally or vertically one square at a time when traversing the line segment.
+        const AZ::Vector2 numSquaresToMove = ((end / gridSize).GetFloor() - (start / gridSize).GetFloor()).GetAbs();
+        const int32_t numSquares = 1 + aznumeric_cast<int32_t>(numSquaresToMove.GetX()) + aznumeric_cast<int32_t>(numSquaresToMove.GetY());
+
+        // This tells us how much t distance on the line to move to increment one grid square in each direction.
+        // Note that it could be infinity (due to a divide-by-0) if we're not moving in that direction.
+        const AZ::Vector2 tDelta(gridSize / lineSegment.GetAbs());
+
+        // Get the min world space corner of the grid square containing the start point.
+        const AZ::Vector2 startGridCorner = (start / gridSize).GetFloor() * gridSize;
+
+        // tUntilNextBoundary stores how much further we currently need to move along t to get to the next grid square boundary
+        // in each direction.
+        // We initialize with the fractional amount that we're starting in the square or max() if we're not moving in this
+        // direction at all (when lineSegment == 0)
+        const AZ::Vector2 tFromMinCorner((start - startGridCorner) / lineSegment.GetAbs());
+
+        AZ::Vector2 tUntilNextBoundary = AZ::Vector2::CreateSelectCmpEqual(
+            lineSegment, AZ::Vector2::CreateZero(), AZ::Vector2(AZStd::numeric_limits<float>::max()), tFromMinCorner);
+
+        // If we're moving in the positive direction in the square, then the amount till the next boundary is actually
+        // the distance remaining to the max corner, not the distance in from the min corner, so flip our calculation.
+        tUntilNextBoundary = AZ::Vector2::CreateSelectCmpGreater(end, start, tDelta - tUntilNextBoundary, tUntilNextBoundary);
+
+        // This is how much we need to increment our x and y by to get to the next grid square along the line.
+        // They will either be +/- squareSize or 0 if we're not moving in that direction.
+        const AZ::Vector2 gridIncrement = gridSize *
+            AZ::Vector2::CreateSelectCmpEqual(lineSegment,
+                                              AZ::Vector2::CreateZero(),
+                                              AZ::Vector2::CreateZero(),
+                                              AZ::Vector2(AZ::GetSign(lineSegment.GetX()), AZ::GetSign(lineSegment.GetY())));
+
+        // Convenience vectors that we can use in the loop to just increment one direction.
+        const AZ::Vector2 tDeltaX(tDelta.GetX(), 0.0f);
+        const AZ::Vector2 tDeltaY(0.0f, tDelta.GetY());
+        const AZ::Vector2 gridIncrementX(gridIncrement.GetX(), 0.0f);
+        const AZ::Vector2 gridIncrementY(0.0f, gridIncrement.GetY());
+
+        AZ::Vector2 curGridCorner = startGridCorner;
+        for (int32_t square = 0; square < numSquares; square++)
+        {
+            if (visitor(curGridCorner))
+            {
+                return;
+            }
+
+            // Move forward along the line (either horizontally or vertically) to the next grid square.
+            if (tUntilNextBoundary.GetY() < tUntilNextBoundary.GetX())
+            {
+                curGridCorner += gridIncrementY;
+                tUntilNextBoundary += tDeltaY;
+            }
+            else
+            {
+                curGridCorner += gridIncrementX;
+                tUntilNextBoundary += tDeltaX;
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // The reciprocal of a ray direction component, using a huge value instead of infinity for a zero component
+    // so that the slab tests below never multiply 0 by infinity.
+    static float SafeReciprocal(float value)
+    {
+        constexpr float MinMagnitude = 1.0e-20f;
+        return 1.0f / ((AZStd::abs(value) < MinMagnitude) ? ((value < 0.0f) ? -MinMagnitude : MinMagnitude) : value);
+    }
 } // namespace
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -71,31 +213,34 @@ TerrainRaycastContext::TerrainRaycastContext(TerrainSystem& terrainSystem)
     , m_entityContextId(AzFramework::EntityContextId::CreateRandom())
 {
     AzFramework::RenderGeometry::IntersectorBus::Handler::BusConnect(m_entityContextId);
+    AzFramework::Terrain::TerrainDataNotificationBus::Handler::BusConnect();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 TerrainRaycastContext::~TerrainRaycastContext()
 {
+    AzFramework::Terrain::TerrainDataNotificationBus::Handler::BusDisconnect();
     AzFramework::RenderGeometry::IntersectorBus::Handler::BusDisconnect();
 }
 
 /*
-   Iterative function that divides an AABB encompasing terrain points into grid squares based on
-   the given grid resolution and steps along the ray visiting each voxel it intersects in order
-   from nearest to farthest. In each square, it obtains the terrain height values at each corner and
-   triangulates them to find the nearest intersection (if any) between the triangles and the ray.
-
-   To step through the grid, we use an algorithm similar to Bresenham's line algorithm or a Digital
-   Differential Analyzer. We can't use Bresenham's line algorithm itself because it will sometimes skip
-   squares if the ray only passes through a tiny portion, and we need to use every square that it passes through.
-
-   We start by clipping the ray itself to the terrain AABB so that we don't walk through any grid squares
-   that cannot contain terrain. We then walk through the grid one square at a time, either moving horizontally
-   or vertically to the next square based on the ray's slope, until we reach the end of the ray or we've found a hit.
+   Iterative function that divides an AABB encompasing terrain points into chunks of 64x64 grid squares based on
+   the given grid resolution and steps along the ray visiting each chunk it intersects in order from nearest to
+   farthest. Each chunk caches the terrain heights at its grid points and a min/max height quadtree over its squares,
+   which the ray descends to find the squares whose height range it actually passes through. In each of those squares
+   it triangulates the terrain heights at the corners to find the nearest intersection (if any) between the triangles
+   and the ray.
+
+   We start by clipping the ray itself to the terrain AABB so that we don't walk through any chunks
+   that cannot contain terrain. We then walk through the chunks one at a time, either moving horizontally
+   or vertically to the next chunk based on the ray's slope, until we reach the end of the ray or we've found a hit.
+   Inside a chunk, the ray is tested against the bounds of four quadtree children at a time, and the children
+   it intersects are visited from nearest to farthest, so the first hit found is the nearest one.
 
    Visualization:
     - X: Grid square intersection but no triangle hit found
     - T: Grid square intersection with a triangle hit found
+    - Squares the ray passes above (or below) the quadtree node height ranges of are never triangulated
     ________________________________________
     |    |    |    |    |    |    |    |    |
     |____|____|____|____|____|____|____|____|  Ray
@@ -118,7 +263,7 @@ AzFramework::RenderGeometry::RayResult TerrainRaycastContext::RayIntersect(
     const AzFramework::RenderGeometry::RayRequest& ray)
 {
     const AZ::Aabb terrainWorldBounds = m_terrainSystem.GetTerrainAabb();
-    const AZ::Vector2 terrainResolution(m_terrainSystem.GetTerrainHeightQueryResolution());
+    const float terrainResolution = m_terrainSystem.GetTerrainHeightQueryResolution();
 
     // Initialize the result to invalid at the start.
     AzFramework::RenderGeometry::RayResult rayIntersectionResult = AzFramework::RenderGeometry::RayResult();
@@ -145,97 +290,258 @@ AzFramework::RenderGeometry::RayResult TerrainRaycastContext::RayIntersect(
         return rayIntersectionResult;
     }
 
-    // Move our clipped line segment into Vector2s for more convenient use below.
-    const AZ::Vector2 clippedStart(clippedRayStart);
-    const AZ::Vector2 clippedEnd(clippedRayEnd);
-    const AZ::Vector2 clippedLineSegment = clippedEnd - clippedStart;
+    // Initialize our segment/triangle hit tester with the ray that we're using. We use the full ray instead of the clipped one
+    // to make sure we don't run into any precision issues caused from the clipping.
+    AZ::Intersect::SegmentTriangleHitTester hitTester(ray.m_startWorldPosition, ray.m_endWorldPosition);
 
-    // Calculate the total number of terrain squares we'll need to visit to trace the ray segment.
-    // We need to visit 1 at the start, 1 for each X square we need to move, and 1 for each Y square we need to move,
-    // since we'll always move either horizontally or vertically one square at a time when traversing the ray segment.
-    const AZ::Vector2 numSquaresToMove =
-        ((clippedEnd / terrainResolution).GetFloor() - (clippedStart / terrainResolution).GetFloor()).GetAbs();
-    const int32_t numTerrainSquares =
-        1 + aznumeric_cast<int32_t>(numSquaresToMove.GetX()) + aznumeric_cast<int32_t>(numSquaresToMove.GetY());
+    // Walk through each chunk of the terrain that intersects the XY coordinates of the clipped line segment,
+    // and check the chunk to see if the ray actually intersects the terrain triangles in it.
+    const float chunkSize = HeightChunk::CellsPerChunk * terrainResolution;
+    WalkGridSquares(AZ::Vector2(clippedRayStart), AZ::Vector2(clippedRayEnd), chunkSize,
+        [&](const AZ::Vector2& chunkCorner)
+        {
+            AZStd::shared_ptr<const HeightChunk> chunk = GetOrBuildChunk(chunkCorner, terrainResolution);
+            return IntersectChunk(*chunk, ray, hitTester, rayIntersectionResult);
+        });
 
-    // This tells us how much t distance on the line to move to increment one terrain square in each direction.
-    // Note that it could be infinity (due to a divide-by-0) if we're not moving in that direction.
-    const AZ::Vector2 tDelta(terrainResolution / clippedLineSegment.GetAbs());
+    if (rayIntersectionResult)
+    {
+        // Intersection found. Replace the triangle normal from the hit with a higher-quality normal calculated
+        // by the terrain system.
+        rayIntersectionResult.m_worldNormal = m_terrainSystem.GetNormal(
+            rayIntersectionResult.m_worldPosition, AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
+    }
 
-    // Get the min world space corner of the terrain grid square containing (x0, y0)
-    const AZ::Vector2 clippedStartGridCorner = (clippedStart / terrainResolution).GetFloor() * terrainResolution;
+    // If needed we could call m_terrainSystem.FindBestAreaEntityAtPosition in order to set
+    // rayIntersectionResult.m_entityAndComponent, but I'm not sure whether that is correct.
+    return rayIntersectionResult;
+}
 
-    // tUntilNextBoundary stores how much further we currently need to move along t to get to the next terrain grid square boundary
-    // in each direction.
-    // We initialize with the fractional amount that we're starting in the square or max() if we're not moving in this
-    // direction at all (when clippedLineSegment == 0)
-    const AZ::Vector2 tFromMinCorner((clippedStart - clippedStartGridCorner) / clippedLineSegment.GetAbs());
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool TerrainRaycastContext::IntersectChunk(const HeightChunk& chunk,
+                                           const AzFramework::RenderGeometry::RayRequest& ray,
+                                           const AZ::Intersect::SegmentTriangleHitTester& hitTester,
+                                           AzFramework::RenderGeometry::RayResult& result)
+{
+    using Vec4 = AZ::Simd::Vec4;
+
+    // The quadtree node bounds are expanded slightly so that precision errors don't cause a ray that grazes
+    // flat terrain to miss the node containing the hit.
+    constexpr float HeightTolerance = 0.01f;
+
+    // Slab test setup for the ray, parameterized the same way as the hit tester, with t in [0, 1] along the full ray.
+    const AZ::Vector3 rayDirection = ray.m_endWorldPosition - ray.m_startWorldPosition;
+    const Vec4::FloatType originX = Vec4::Splat(ray.m_startWorldPosition.GetX());
+    const Vec4::FloatType originY = Vec4::Splat(ray.m_startWorldPosition.GetY());
+    const Vec4::FloatType originZ = Vec4::Splat(ray.m_startWorldPosition.GetZ());
+    const Vec4::FloatType inverseDirectionX = Vec4::Splat(SafeReciprocal(rayDirection.GetX()));
+    const Vec4::FloatType inverseDirectionY = Vec4::Splat(SafeReciprocal(rayDirection.GetY()));
+    const Vec4::FloatType inverseDirectionZ = Vec4::Splat(SafeReciprocal(rayDirection.GetZ()));
+    const Vec4::FloatType rayStart = Vec4::Splat(0.0f);
+    const Vec4::FloatType rayEnd = Vec4::Splat(1.0f);
+    const Vec4::FloatType heightTolerance = Vec4::Splat(HeightTolerance);
+
+    struct Node
+    {
+        int32_t m_level;
+        int32_t m_x;
+        int32_t m_y;
+    };
 
-    AZ::Vector2 tUntilNextBoundary = AZ::Vector2::CreateSelectCmpEqual(
-        clippedLineSegment, AZ::Vector2::CreateZero(), AZ::Vector2(AZStd::numeric_limits<float>::max()), tFromMinCorner);
+    // Nodes are pushed in far-to-near order so that they're popped from nearest to farthest. At most 3 siblings
+    // are left on the stack for each level that has been descended.
+    AZStd::fixed_vector<Node, 4 * HeightChunk::LevelCount> nodeStack;
+    nodeStack.push_back({ HeightChunk::LevelCount - 1, 0, 0 });
 
-    // If we're moving in the positive direction in the square, then the amount till the next boundary is actually
-    // the distance remaining to the max corner, not the distance in from the min corner, so flip our calculation.
-    tUntilNextBoundary = AZ::Vector2::CreateSelectCmpGreater(clippedEnd, clippedStart, tDelta - tUntilNextBoundary, tUntilNextBoundary);
+    while (!nodeStack.empty())
+    {
+        const Node node = nodeStack.back();
+        nodeStack.pop_back();
 
-    // Initialize our segment/triangle hit tester with the ray that we're using. We use the full ray instead of the clipped one
-    // to make sure we don't run into any precision issues caused from the clipping.
-    AZ::Intersect::SegmentTriangleHitTester hitTester(ray.m_startWorldPosition, ray.m_endWorldPosition);
+        if (node.m_level == 0)
+        {
+            // This is a single grid square, so triangulate the terrain heights at its corners and check for a hit.
+            const float minX = chunk.m_minCorner.GetX() + node.m_x * chunk.m_cellSize;
+            const float minY = chunk.m_minCorner.GetY() + node.m_y * chunk.m_cellSize;
+            const float maxX = minX + chunk.m_cellSize;
+            const float maxY = minY + chunk.m_cellSize;
+            if (TriangulateAndFindNearestIntersection(
+                    AZ::Vector3(minX, minY, chunk.GetHeight(node.m_x, node.m_y)),
+                    AZ::Vector3(minX, maxY, chunk.GetHeight(node.m_x, node.m_y + 1)),
+                    AZ::Vector3(maxX, maxY, chunk.GetHeight(node.m_x + 1, node.m_y + 1)),
+                    AZ::Vector3(maxX, minY, chunk.GetHeight(node.m_x + 1, node.m_y)),
+                    hitTester, result))
+            {
+                return true;
+            }
+            continue;
+        }
+
+        // Test the ray against the bounds of all four children at once.
+        const int32_t childLevel = node.m_level - 1;
+        const int32_t childNodesPerSide = HeightChunk::CellsPerChunk >> childLevel;
+        const float childSize = chunk.m_cellSize * (1 << childLevel);
+        const int32_t childX = node.m_x * 2;
+        const int32_t childY = node.m_y * 2;
+        const float childMinX0 = chunk.m_minCorner.GetX() + childX * childSize;
+        const float childMinY0 = chunk.m_minCorner.GetY() + childY * childSize;
+
+        const int32_t child = childY * childNodesPerSide + childX;
+        const auto& minHeights = chunk.m_minHeights[childLevel];
+        const auto& maxHeights = chunk.m_maxHeights[childLevel];
+
+        const Vec4::FloatType minX = Vec4::LoadImmediate(childMinX0, childMinX0 + childSize, childMinX0, childMinX0 + childSize);
+        const Vec4::FloatType minY = Vec4::LoadImmediate(childMinY0, childMinY0, childMinY0 + childSize, childMinY0 + childSize);
+        const Vec4::FloatType size = Vec4::Splat(childSize);
+        const Vec4::FloatType minZ = Vec4::Sub(Vec4::LoadImmediate(minHeights[child], minHeights[child + 1],
+            minHeights[child + childNodesPerSide], minHeights[child + childNodesPerSide + 1]), heightTolerance);
+        const Vec4::FloatType maxZ = Vec4::Add(Vec4::LoadImmediate(maxHeights[child], maxHeights[child + 1],
+            maxHeights[child + childNodesPerSide], maxHeights[child + childNodesPerSide + 1]), heightTolerance);
+
+        const Vec4::FloatType tX0 = Vec4::Mul(Vec4::Sub(minX, originX), inverseDirectionX);
+        const Vec4::FloatType tX1 = Vec4::Mul(Vec4::Sub(Vec4::Add(minX, size), originX), inverseDirectionX);
+        const Vec4::FloatType tY0 = Vec4::Mul(Vec4::Sub(minY, originY), inverseDirectionY);
+        const Vec4::FloatType tY1 = Vec4::Mul(Vec4::Sub(Vec4::Add(minY, size), originY), inverseDirectionY);
+        const Vec4::FloatType tZ0 = Vec4::Mul(Vec4::Sub(minZ, originZ), inverseDirectionZ);
+        const Vec4::FloatType tZ1 = Vec4::Mul(Vec4::Sub(maxZ, originZ), inverseDirectionZ);
+
+        const Vec4::FloatType tEnter = Vec4::Max(
+            Vec4::Max(Vec4::Min(tX0, tX1), Vec4::Min(tY0, tY1)), Vec4::Max(Vec4::Min(tZ0, tZ1), rayStart));
+        const Vec4::FloatType tExit = Vec4::Min(
+            Vec4::Min(Vec4::Max(tX0, tX1), Vec4::Max(tY0, tY1)), Vec4::Min(Vec4::Max(tZ0, tZ1), rayEnd));
+
+        alignas(16) float childEnter[4];
+        alignas(16) float childExit[4];
+        Vec4::StoreAligned(childEnter, tEnter);
+        Vec4::StoreAligned(childExit, tExit);
+
+        // Gather the intersected children and sort them by entry distance. The children don't overlap in XY, so
+        // visiting them in this order visits the squares along the ray from nearest to farthest.
+        AZStd::fixed_vector<AZStd::pair<float, Node>, 4> hitChildren;
+        for (int32_t index = 0; index < 4; ++index)
+        {
+            if (childEnter[index] <= childExit[index])
+            {
+                hitChildren.push_back({ childEnter[index], Node{ childLevel, childX + (index & 1), childY + (index >> 1) } });
+            }
+        }
+        AZStd::sort(hitChildren.begin(), hitChildren.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+        for (const auto& hitChild : hitChildren)
+        {
+            nodeStack.push_back(hitChild.second);
+        }
+    }
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+AZStd::shared_ptr<const TerrainRaycastContext::HeightChunk> TerrainRaycastContext::GetOrBuildChunk(
+    const AZ::Vector2& chunkCorner, float cellSize)
+{
+    const float chunkSize = HeightChunk::CellsPerChunk * cellSize;
+    const int32_t chunkX = aznumeric_cast<int32_t>(AZStd::floor(chunkCorner.GetX() / chunkSize + 0.5f));
+    const int32_t chunkY = aznumeric_cast<int32_t>(AZStd::floor(chunkCorner.GetY() / chunkSize + 0.5f));
+    const ChunkKey key = (static_cast<ChunkKey>(static_cast<AZ::u32>(chunkX)) << 32) | static_cast<AZ::u32>(chunkY);
 
-    // These will hold our current square coordinates in world space values as we loop through the squares, starting with the
-    // grid square for (x0, y0). These values represent the minimum corner of each terrain square.
-    AZ::Vector2 curGridCorner = clippedStartGridCorner;
-
-    // This is how much we need to increment our x and y by to get to the next grid square along the line.
-    // They will either be +/- terrainResolution or 0 if we're not moving in that direction.
-    const AZ::Vector2 gridIncrement = terrainResolution *
-        AZ::Vector2::CreateSelectCmpEqual(clippedLineSegment,
-                                          AZ::Vector2::CreateZero(),
-                                          AZ::Vector2::CreateZero(),
-                                          AZ::Vector2(AZ::GetSign(clippedLineSegment.GetX()), AZ::GetSign(clippedLineSegment.GetY())));
-
-    // Convenience vectors that we can use in the loop to just increment one direction.
-    const AZ::Vector2 tDeltaX(tDelta.GetX(), 0.0f);
-    const AZ::Vector2 tDeltaY(0.0f, tDelta.GetY());
-    const AZ::Vector2 gridIncrementX(gridIncrement.GetX(), 0.0f);
-    const AZ::Vector2 gridIncrementY(0.0f, gridIncrement.GetY());
-
-    // Walk through each grid square in the terrain that intersects the XY coordinates of the line.
-    // We'll check each square to see if the ray intersections actually intersect the terrain triangles in the square.
-    for (int terrainSquare = 0; terrainSquare < numTerrainSquares; terrainSquare++)
-    {
-        // Create a bounding volume for this terrain square.
-        AZ::Aabb currentVoxel = AZ::Aabb::CreateFromMinMax(
-            AZ::Vector3(curGridCorner, terrainWorldBounds.GetMin().GetZ()),
-            AZ::Vector3(curGridCorner + terrainResolution, terrainWorldBounds.GetMax().GetZ()));
-
-        // Check for a hit against the terrain triangles in this square.
-        // Note - this could be optimized to be 2x faster by adding some code to keep track of the terrain heights
-        // from the previous square checked so that we only get the 2 new corners instead of all 4 every time.
-        TriangulateAndFindNearestIntersection(m_terrainSystem, currentVoxel, hitTester, rayIntersectionResult);
-        if (rayIntersectionResult)
+    AZ::u64 buildGeneration = 0;
+    {
+        AZStd::scoped_lock lock(m_chunkMutex);
+        if (auto cachedChunk = m_chunks.find(key); cachedChunk != m_chunks.end() && cachedChunk->second.first->m_cellSize == cellSize)
         {
-            // Intersection found. Replace the triangle normal from the hit with a higher-quality normal calculated
-            // by the terrain system.
-            rayIntersectionResult.m_worldNormal = m_terrainSystem.GetNormal(
-                rayIntersectionResult.m_worldPosition, AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
-            break;
+            m_chunkLru.splice(m_chunkLru.begin(), m_chunkLru, cachedChunk->second.second);
+            return cachedChunk->second.first;
         }
+        buildGeneration = m_chunkGeneration;
+    }
+
+    // Query the heights of every grid point in the chunk in bulk instead of 4 single queries per grid square.
+    // This happens outside of the lock, since the terrain query can be slow and other rays don't need to wait for it.
+    auto chunk = AZStd::make_shared<HeightChunk>();
+    chunk->m_minCorner = AZ::Vector2(chunkX * chunkSize, chunkY * chunkSize);
+    chunk->m_cellSize = cellSize;
+    chunk->m_heights.resize(HeightChunk::PointsPerChunk * HeightChunk::PointsPerChunk);
+
+    // Points without terrain use the terrain minimum height, the same as single EXACT height queries return for them.
+    const float noTerrainHeight = m_terrainSystem.GetTerrainHeightBounds().m_min;
+    AzFramework::Terrain::TerrainQueryRegion queryRegion(
+        chunk->m_minCorner, HeightChunk::PointsPerChunk, HeightChunk::PointsPerChunk, AZ::Vector2(cellSize));
+    m_terrainSystem.QueryRegion(
+        queryRegion, AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights,
+        [&chunk, noTerrainHeight](size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+        {
+            chunk->m_heights[yIndex * HeightChunk::PointsPerChunk + xIndex] = terrainExists ? surfacePoint.m_position.GetZ() : noTerrainHeight;
+        },
+        AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+    chunk->BuildQuadtree();
+
+    AZStd::scoped_lock lock(m_chunkMutex);
+
+    // If the terrain changed while the heights were being queried, they may predate the change. The chunk is still good enough
+    // for the ray that asked for it, but it isn't cached so that the next ray rebuilds it from the current terrain data.
+    if (buildGeneration != m_chunkGeneration)
+    {
+        return chunk;
+    }
+
+    if (auto cachedChunk = m_chunks.find(key); cachedChunk != m_chunks.end())
+    {
+        m_chunkLru.erase(cachedChunk->second.second);
+        m_chunks.erase(cachedChunk);
+    }
+
+    m_chunkLru.push_front(key);
+    m_chunks.emplace(key, AZStd::make_pair(AZStd::shared_ptr<const HeightChunk>(chunk), m_chunkLru.begin()));
+
+    const size_t maxChunks = AZStd::max<size_t>(static_cast<uint32_t>(terrain_raycastChunkCacheSize), 1);
+    while (m_chunks.size() > maxChunks)
+    {
+        m_chunks.erase(m_chunkLru.back());
+        m_chunkLru.pop_back();
+    }
+
+    return chunk;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TerrainRaycastContext::OnTerrainDataChanged(
+    const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask dataChangedMask)
+{
+    using TerrainDataChangedMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask;
+
+    if ((dataChangedMask & (TerrainDataChangedMask::Settings | TerrainDataChangedMask::HeightData)) == TerrainDataChangedMask::None)
+    {
+        return;
+    }
+
+    AZStd::scoped_lock lock(m_chunkMutex);
+    ++m_chunkGeneration;
+
+    // Settings changes can move the grid or change the height range, so every chunk needs to be rebuilt.
+    if (((dataChangedMask & TerrainDataChangedMask::Settings) != TerrainDataChangedMask::None) || !dirtyRegion.IsValid())
+    {
+        m_chunks.clear();
+        m_chunkLru.clear();
+        return;
+    }
 
-        // No hit yet, so move forward along the line (either horizontally or vertically) to the next terrain square.
-        if (tUntilNextBoundary.GetY() < tUntilNextBoundary.GetX())
+    // Otherwise only drop the chunks with grid points inside the dirty region, they're rebuilt the next time a ray reaches them.
+    for (auto chunk = m_chunks.begin(); chunk != m_chunks.end();)
+    {
+        const HeightChunk& heightChunk = *chunk->second.first;
+        const AZ::Vector2 chunkMax = heightChunk.m_minCorner + AZ::Vector2(HeightChunk::CellsPerChunk * heightChunk.m_cellSize);
+        const bool overlaps = (heightChunk.m_minCorner.GetX() <= dirtyRegion.GetMax().GetX()) &&
+            (heightChunk.m_minCorner.GetY() <= dirtyRegion.GetMax().GetY()) && (chunkMax.GetX() >= dirtyRegion.GetMin().GetX()) &&
+            (chunkMax.GetY() >= dirtyRegion.GetMin().GetY());
+        if (overlaps)
         {
-            curGridCorner += gridIncrementY;
-            tUntilNextBoundary += tDeltaY;
+            m_chunkLru.erase(chunk->second.second);
+            chunk = m_chunks.erase(chunk);
         }
         else
         {
-            curGridCorner += gridIncrementX;
-            tUntilNextBoundary += tDeltaX;
+            ++chunk;
         }
     }
-
-    // If needed we could call m_terrainSystem.FindBestAreaEntityAtPosition in order to set
-    // rayIntersectionResult.m_entityAndComponent, but I'm not sure whether that is correct.
-    return rayIntersectionResult;
 }
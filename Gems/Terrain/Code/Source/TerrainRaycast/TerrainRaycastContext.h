@@ -8,7 +8,14 @@
 
 #pragma once
 
+#include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzFramework/Render/IntersectorInterface.h>
+#include <AzFramework/Terrain/TerrainDataRequestBus.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 namespace Terrain
@@ -16,7 +23,9 @@ namespace Terrain
     class TerrainSystem;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    class TerrainRaycastContext : public AzFramework::RenderGeometry::IntersectorBus::Handler
+    class TerrainRaycastContext
+        : public AzFramework::RenderGeometry::IntersectorBus::Handler
+        , private AzFramework::Terrain::TerrainDataNotificationBus::Handler
     {
     public:
         ////////////////////////////////////////////////////////////////////////////////////////////
@@ -54,9 +63,44 @@ namespace Terrain
         ///@}
 
     private:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! \ref AzFramework::Terrain::TerrainDataNotifications::OnTerrainDataChanged
+        void OnTerrainDataChanged(
+            const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask dataChangedMask) override;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Cached terrain heights for a square block of terrain grid cells, along with a min/max height quadtree over those cells.
+        struct HeightChunk;
+        using ChunkKey = AZ::u64;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Get the cached height chunk with the given min corner, querying the terrain system to build it if it isn't cached
+        //! \param[in] chunkCorner The world space min corner of the chunk
+        //! \param[in] cellSize The terrain height query resolution
+        //! \return The height chunk
+        AZStd::shared_ptr<const HeightChunk> GetOrBuildChunk(const AZ::Vector2& chunkCorner, float cellSize);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Find the nearest intersection (if any) between the ray and the terrain triangles in a height chunk, descending the
+        //! chunk's min/max height quadtree so that only the cells whose height range the ray passes through are triangulated.
+        //! \param[in] chunk The height chunk to intersect
+        //! \param[in] ray The ray being cast
+        //! \param[in] hitTester The segment/triangle hit tester for the ray
+        //! \param[out] result The nearest intersection, left untouched if there isn't one
+        //! \return True if an intersection was found
+        static bool IntersectChunk(const HeightChunk& chunk,
+                                   const AzFramework::RenderGeometry::RayRequest& ray,
+                                   const AZ::Intersect::SegmentTriangleHitTester& hitTester,
+                                   AzFramework::RenderGeometry::RayResult& result);
+
         ////////////////////////////////////////////////////////////////////////////////////////////
         // Variables
         TerrainSystem& m_terrainSystem; //!< Terrain system that owns this terrain raycast context
         AzFramework::EntityContextId m_entityContextId; //!< This object's entity context id
+
+        AZStd::mutex m_chunkMutex; //!< Guards the height chunk cache, rays can be cast from multiple threads
+        AZStd::unordered_map<ChunkKey, AZStd::pair<AZStd::shared_ptr<const HeightChunk>, AZStd::list<ChunkKey>::iterator>> m_chunks;
+        AZStd::list<ChunkKey> m_chunkLru; //!< Cached chunk keys, most recently used first
+        AZ::u64 m_chunkGeneration = 0; //!< Incremented on every invalidation, chunks built across one are not cached
     };
 } // namespace Terrain
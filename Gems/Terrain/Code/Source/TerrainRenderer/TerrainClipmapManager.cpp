@@ -14,6 +14,7 @@
 #include <Atom/RPI.Public/ViewportContext.h>
 #include <Atom/RPI.Public/ViewportContextBus.h>
 #include <AzCore/Console/Console.h>
+#include <AzCore/Debug/Profiler.h>
 
 namespace Terrain
 {
@@ -69,9 +70,28 @@ namespace Terrain
         AZ::ConsoleFunctorFlags::Null,
         "A multiplier to the final output of the clipmap texture's debug display.");
 
+    AZ_CVAR(
+        float,
+        r_terrainClipmapPrefetchTime,
+        0.5f,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "How many seconds ahead of the camera, based on its current velocity, the clipmaps are generated. 0 disables prefetching.");
+
+    AZ_CVAR(
+        float,
+        r_terrainClipmapPrefetchMaxOffset,
+        0.25f,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The maximum distance a clipmap center can lead the camera, as a fraction of the clipmap's safe distance.");
+
     namespace
     {
         [[maybe_unused]] static const char* TerrainClipmapManagerName = "TerrainClipmapManager";
+
+        // How quickly the camera velocity estimate follows the camera movement each frame.
+        static constexpr float ViewVelocitySmoothing = 0.2f;
     }
 
     //! Calculate how many layers of clipmap is needed.
@@ -288,6 +308,9 @@ namespace Terrain
     {
         m_isInitialized = false;
         m_fullRefreshClipmaps = true;
+        m_fullRefreshPending = false;
+        m_hasLastViewPosition = false;
+        m_viewVelocity = AZ::Vector2::CreateZero();
 
         m_terrainSrg = nullptr;
 
@@ -307,9 +330,31 @@ namespace Terrain
         m_fullRefreshClipmaps = true;
     }
 
-    void TerrainClipmapManager::Update(const AZ::Vector3& cameraPosition, const AZ::RPI::Scene* scene, AZ::Data::Instance<AZ::RPI::ShaderResourceGroup>& terrainSrg)
+    void TerrainClipmapManager::Update(
+        const AZ::Vector3& cameraPosition, float deltaTime, const AZ::RPI::Scene* scene, AZ::Data::Instance<AZ::RPI::ShaderResourceGroup>& terrainSrg)
     {
-        UpdateClipmapData(cameraPosition, scene, terrainSrg);
+        AZ::Vector2 currentViewPosition = AZ::Vector2(cameraPosition.GetX(), cameraPosition.GetY());
+        UpdateViewVelocity(currentViewPosition, deltaTime);
+
+        m_macroClipmapUpdateRegions.clear();
+        m_detailClipmapUpdateRegions.clear();
+
+        if (m_fullRefreshClipmaps)
+        {
+            m_fullRefreshClipmaps = false;
+            m_fullRefreshPending = true;
+
+            InitializeMacroClipmapBounds(currentViewPosition);
+            InitializeDetailClipmapBounds(currentViewPosition);
+        }
+        else
+        {
+            // Each stack only has a handful of levels, so moving them is cheaper than handing them to jobs.
+            UpdateMacroClipmapBounds(currentViewPosition);
+            UpdateDetailClipmapBounds(currentViewPosition);
+        }
+
+        UpdateClipmapData(scene, terrainSrg);
         terrainSrg->SetConstant(m_terrainSrgClipmapDataIndex, m_clipmapData);
     }
 
@@ -551,11 +596,8 @@ namespace Terrain
         m_clipmaps[ClipmapName::DetailOcclusion] = nullptr;
     }
 
-    void TerrainClipmapManager::UpdateClipmapData(const AZ::Vector3& cameraPosition, const AZ::RPI::Scene* scene, AZ::Data::Instance<AZ::RPI::ShaderResourceGroup>& terrainSrg)
+    void TerrainClipmapManager::UpdateClipmapData(const AZ::RPI::Scene* scene, AZ::Data::Instance<AZ::RPI::ShaderResourceGroup>& terrainSrg)
     {
-        // set new view position
-        AZ::Vector2 currentViewPosition = AZ::Vector2(cameraPosition.GetX(), cameraPosition.GetY());
-
         // Update debug data
         auto viewportContextInterface = AZ::Interface<AZ::RPI::ViewportContextRequestsInterface>::Get();
         auto viewportContext = viewportContextInterface->GetViewportContextByScene(scene);
@@ -584,17 +626,10 @@ namespace Terrain
             m_clipmapData.m_detailClipmapOverlayFactor = 1.0f;
         }
 
-        // Update clipmap center
-        m_macroClipmapUpdateRegions.clear();
-        m_detailClipmapUpdateRegions.clear();
-
         // First time update will run through the whole clipmap
-        if (m_fullRefreshClipmaps)
+        if (m_fullRefreshPending)
         {
-            m_fullRefreshClipmaps = false;
-
-            InitializeMacroClipmapBounds(currentViewPosition);
-            InitializeDetailClipmapBounds(currentViewPosition);
+            m_fullRefreshPending = false;
 
             AZStd::array<uint32_t, 4> aabb = { 0, 0, m_config.m_clipmapSize, m_config.m_clipmapSize };
 
@@ -643,12 +678,91 @@ namespace Terrain
             return;
         }
 
-        // macro clipmap data:
+        uint32_t updateRegionCount = aznumeric_cast<uint32_t>(m_macroClipmapUpdateRegions.size());
+        if (updateRegionCount)
+        {
+            m_macroTotalDispatchThreadX = 64;
+            m_macroTotalDispatchThreadY = 64;
+            m_clipmapData.m_macroDispatchGroupCountX = m_macroTotalDispatchThreadX / MacroGroupThreadX;
+            m_clipmapData.m_macroDispatchGroupCountY = m_macroTotalDispatchThreadY / MacroGroupThreadY;
+
+            m_clipmapData.m_macroClipmapUpdateRegionCount = updateRegionCount;
+            m_macroClipmapUpdateRegionsBuffer.UpdateBuffer(m_macroClipmapUpdateRegions.data(), updateRegionCount);
+            m_macroClipmapUpdateRegionsBuffer.UpdateSrg(terrainSrg.get());
+        }
+        else
+        {
+            m_macroTotalDispatchThreadX = 0;
+            m_macroTotalDispatchThreadY = 0;
+            m_clipmapData.m_macroDispatchGroupCountX = 1;
+            m_clipmapData.m_macroDispatchGroupCountY = 1;
+        }
+
+        updateRegionCount = aznumeric_cast<uint32_t>(m_detailClipmapUpdateRegions.size());
+        if (updateRegionCount)
+        {
+            m_detailTotalDispatchThreadX = 64;
+            m_detailTotalDispatchThreadY = 64;
+            m_clipmapData.m_detailDispatchGroupCountX = m_detailTotalDispatchThreadX / DetailGroupThreadX;
+            m_clipmapData.m_detailDispatchGroupCountY = m_detailTotalDispatchThreadY / DetailGroupThreadY;
+
+            m_clipmapData.m_detailClipmapUpdateRegionCount = updateRegionCount;
+            m_detailClipmapUpdateRegionsBuffer.UpdateBuffer(m_detailClipmapUpdateRegions.data(), updateRegionCount);
+            m_detailClipmapUpdateRegionsBuffer.UpdateSrg(terrainSrg.get());
+        }
+        else
+        {
+            m_detailTotalDispatchThreadX = 0;
+            m_detailTotalDispatchThreadY = 0;
+            m_clipmapData.m_detailDispatchGroupCountX = 1;
+            m_clipmapData.m_detailDispatchGroupCountY = 1;
+        }
+    }
+
+    void TerrainClipmapManager::UpdateViewVelocity(const AZ::Vector2& viewPosition, float deltaTime)
+    {
+        // A paused or frozen frame has no delta time, the estimate is kept until the camera moves in simulated time again.
+        if (m_hasLastViewPosition && deltaTime > 0.0f)
+        {
+            // Smooth the estimate so that frame time jitter doesn't make the clipmap centers wobble around the camera.
+            AZ::Vector2 velocity = (viewPosition - m_lastViewPosition) / deltaTime;
+            m_viewVelocity = m_viewVelocity.Lerp(velocity, ViewVelocitySmoothing);
+        }
+
+        m_lastViewPosition = viewPosition;
+        m_hasLastViewPosition = true;
+    }
+
+    AZ::Vector2 TerrainClipmapManager::GetPrefetchOffset(const ClipmapBounds& clipmapBounds, float clipmapScaleBase) const
+    {
+        float prefetchTime = r_terrainClipmapPrefetchTime;
+        if (prefetchTime <= 0.0f)
+        {
+            return AZ::Vector2::CreateZero();
+        }
+
+        // Every clipmap leads the camera in the same direction, so a level keeps containing the valid area of the finer level
+        // inside it as long as the offset stays below (scaleBase - 1) / scaleBase of its safe distance.
+        float maxOffsetFraction = AZ::GetClamp(float(r_terrainClipmapPrefetchMaxOffset), 0.0f, (clipmapScaleBase - 1.0f) / clipmapScaleBase);
+        float maxOffset = maxOffsetFraction * clipmapBounds.GetWorldSpaceSafeDistance();
+
+        AZ::Vector2 offset = m_viewVelocity * prefetchTime;
+        float offsetLength = offset.GetLength();
+        if (offsetLength > maxOffset)
+        {
+            offset *= maxOffset / offsetLength;
+        }
+        return offset;
+    }
+
+    void TerrainClipmapManager::UpdateMacroClipmapBounds(const AZ::Vector2& viewPosition)
+    {
         for (uint32_t clipmapIndex = 0; clipmapIndex < m_macroClipmapStackSize; ++clipmapIndex)
         {
             ClipmapBounds& clipmapBounds = m_macroClipmapBounds[clipmapIndex];
 
-            ClipmapBoundsRegionList updateRegionList = clipmapBounds.UpdateCenter(currentViewPosition);
+            ClipmapBoundsRegionList updateRegionList =
+                clipmapBounds.UpdateCenter(viewPosition + GetPrefetchOffset(clipmapBounds, m_config.m_macroClipmapScaleBase));
 
             // write updated center
             Vector2i center = clipmapBounds.GetModCenter();
@@ -668,33 +782,16 @@ namespace Terrain
                 m_macroClipmapUpdateRegions.push_back(ClipmapUpdateRegion(clipmapIndex, aabb));
             }
         }
+    }
 
-        uint32_t updateRegionCount = aznumeric_cast<uint32_t>(m_macroClipmapUpdateRegions.size());
-        if (updateRegionCount)
-        {
-            m_macroTotalDispatchThreadX = 64;
-            m_macroTotalDispatchThreadY = 64;
-            m_clipmapData.m_macroDispatchGroupCountX = m_macroTotalDispatchThreadX / MacroGroupThreadX;
-            m_clipmapData.m_macroDispatchGroupCountY = m_macroTotalDispatchThreadY / MacroGroupThreadY;
-
-            m_clipmapData.m_macroClipmapUpdateRegionCount = updateRegionCount;
-            m_macroClipmapUpdateRegionsBuffer.UpdateBuffer(m_macroClipmapUpdateRegions.data(), updateRegionCount);
-            m_macroClipmapUpdateRegionsBuffer.UpdateSrg(terrainSrg.get());
-        }
-        else
-        {
-            m_macroTotalDispatchThreadX = 0;
-            m_macroTotalDispatchThreadY = 0;
-            m_clipmapData.m_macroDispatchGroupCountX = 1;
-            m_clipmapData.m_macroDispatchGroupCountY = 1;
-        }
-
-        // detail clipmap data:
+    void TerrainClipmapManager::UpdateDetailClipmapBounds(const AZ::Vector2& viewPosition)
+    {
         for (uint32_t clipmapIndex = 0; clipmapIndex < m_detailClipmapStackSize; ++clipmapIndex)
         {
             ClipmapBounds& clipmapBounds = m_detailClipmapBounds[clipmapIndex];
 
-            ClipmapBoundsRegionList updateRegionList = clipmapBounds.UpdateCenter(currentViewPosition);
+            ClipmapBoundsRegionList updateRegionList =
+                clipmapBounds.UpdateCenter(viewPosition + GetPrefetchOffset(clipmapBounds, m_config.m_detailClipmapScaleBase));
 
             // write updated center
             Vector2i center = clipmapBounds.GetModCenter();
@@ -714,26 +811,6 @@ namespace Terrain
                 m_detailClipmapUpdateRegions.push_back(ClipmapUpdateRegion(clipmapIndex, aabb));
             }
         }
-
-        updateRegionCount = aznumeric_cast<uint32_t>(m_detailClipmapUpdateRegions.size());
-        if (updateRegionCount)
-        {
-            m_detailTotalDispatchThreadX = 64;
-            m_detailTotalDispatchThreadY = 64;
-            m_clipmapData.m_detailDispatchGroupCountX = m_detailTotalDispatchThreadX / DetailGroupThreadX;
-            m_clipmapData.m_detailDispatchGroupCountY = m_detailTotalDispatchThreadY / DetailGroupThreadY;
-
-            m_clipmapData.m_detailClipmapUpdateRegionCount = updateRegionCount;
-            m_detailClipmapUpdateRegionsBuffer.UpdateBuffer(m_detailClipmapUpdateRegions.data(), updateRegionCount);
-            m_detailClipmapUpdateRegionsBuffer.UpdateSrg(terrainSrg.get());
-        }
-        else
-        {
-            m_detailTotalDispatchThreadX = 0;
-            m_detailTotalDispatchThreadY = 0;
-            m_clipmapData.m_detailDispatchGroupCountX = 1;
-            m_clipmapData.m_detailDispatchGroupCountY = 1;
-        }
     }
 
     AZ::Data::Instance<AZ::RPI::AttachmentImage> TerrainClipmapManager::GetClipmapImage(ClipmapName clipmapName) const
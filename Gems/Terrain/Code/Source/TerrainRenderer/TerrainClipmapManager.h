@@ -148,7 +148,10 @@ namespace Terrain
         void TriggerFullRefresh();
         void UpdateSrgIndices(AZ::Data::Instance<AZ::RPI::ShaderResourceGroup>& srg);
 
-        void Update(const AZ::Vector3& cameraPosition, const AZ::RPI::Scene* scene, AZ::Data::Instance<AZ::RPI::ShaderResourceGroup>& terrainSrg);
+        //! Move the clipmaps to follow the camera and pass the update regions to the terrain SRG. The clipmap centers lead the camera
+        //! along its velocity, estimated from the simulation frame time, so that upcoming regions are generated before the camera reaches them.
+        void Update(
+            const AZ::Vector3& cameraPosition, float deltaTime, const AZ::RPI::Scene* scene, AZ::Data::Instance<AZ::RPI::ShaderResourceGroup>& terrainSrg);
 
         //! Import the clipmap to the frame graph and set scope attachment access,
         //! so that the compute pass can build dependencies accordingly.
@@ -170,10 +173,18 @@ namespace Terrain
         bool HasDetailClipmapUpdate() const;
     private:
         //! Update the C++ copy of the clipmap data. And will later be bound to the terrain SRG.
-        void UpdateClipmapData(
-            const AZ::Vector3& cameraPosition,
-            const AZ::RPI::Scene* scene,
-            AZ::Data::Instance<AZ::RPI::ShaderResourceGroup>& terrainSrg);
+        void UpdateClipmapData(const AZ::RPI::Scene* scene, AZ::Data::Instance<AZ::RPI::ShaderResourceGroup>& terrainSrg);
+
+        //! Update the camera velocity estimate used to prefetch clipmap regions ahead of the camera.
+        void UpdateViewVelocity(const AZ::Vector2& viewPosition, float deltaTime);
+
+        //! Get the offset to apply to the center of a clipmap so that it leads the camera. The offset is limited to a fraction
+        //! of the clipmap's safe distance so the clipmap levels stay nested and the camera stays inside every level.
+        AZ::Vector2 GetPrefetchOffset(const ClipmapBounds& clipmapBounds, float clipmapScaleBase) const;
+
+        //! Move the clipmap centers and gather the regions that need to be regenerated.
+        void UpdateMacroClipmapBounds(const AZ::Vector2& viewPosition);
+        void UpdateDetailClipmapBounds(const AZ::Vector2& viewPosition);
 
         //! Initialzation functions.
         void QueryMacroClipmapStackSize();
@@ -355,6 +366,13 @@ namespace Terrain
         bool m_isInitialized = false;
         //! Flag to generate the full clipmap in situation such as first frame and material update.
         bool m_fullRefreshClipmaps = true;
+        //! Set when the current frame regenerates the full clipmap, so that the full clipmap regions are uploaded.
+        bool m_fullRefreshPending = false;
+
+        //! Camera tracking used to prefetch clipmap regions in the direction the camera is moving.
+        AZ::Vector2 m_lastViewPosition = AZ::Vector2::CreateZero();
+        AZ::Vector2 m_viewVelocity = AZ::Vector2::CreateZero();
+        bool m_hasLastViewPosition = false;
 
         //! Dispatch threads for the compute pass.
         uint32_t m_macroTotalDispatchThreadX = 0;
@@ -25,6 +25,8 @@
 
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 
+#include <AzCore/Time/ITime.h>
+
 #include <Atom/RPI.Reflect/Asset/AssetUtils.h>
 #include <Atom/RPI.Reflect/Material/MaterialAssetCreator.h>
 
@@ -326,7 +328,8 @@ namespace Terrain
                 {
                     if (m_clipmapManager.IsInitialized())
                     {
-                        m_clipmapManager.Update(cameraPosition, GetParentScene(), m_terrainSrg);
+                        const float deltaTime = AZ::TimeUsToSeconds(AZ::GetSimulationTickDeltaTimeUs());
+                        m_clipmapManager.Update(cameraPosition, deltaTime, GetParentScene(), m_terrainSrg);
                     }
                 }
             }
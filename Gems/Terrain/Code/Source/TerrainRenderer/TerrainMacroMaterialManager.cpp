@@ -8,6 +8,9 @@
 
 #include <TerrainRenderer/TerrainMacroMaterialManager.h>
 #include <Atom/RPI.Public/View.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 
 namespace Terrain
 {
@@ -408,6 +411,27 @@ namespace Terrain
     void TerrainMacroMaterialManager::Update(const AZ::RPI::ViewPtr mainView, AZ::Data::Instance<AZ::RPI::ShaderResourceGroup>& terrainSrg)
     {
         AZ::Vector3 mainCameraPosition = mainView->GetCameraTransform().GetTranslation();
+        UpdateTileMaterials(AZ::Vector2(mainCameraPosition));
+
+        if (m_bufferNeedsUpdate && terrainSrg)
+        {
+            m_bufferNeedsUpdate = false;
+            m_materialDataBuffer.UpdateBuffer(m_materialData.GetRawData<0>(), aznumeric_cast<uint32_t>(m_materialData.GetSize()));
+            m_materialRefGridDataBuffer.UpdateBuffer(m_materialRefGridShaderData.data(), aznumeric_cast<uint32_t>(m_materialRefGridShaderData.size()));
+
+            MacroMaterialGridShaderData macroMaterialGridShaderData;
+            macroMaterialGridShaderData.m_tileCount1D = m_tiles1D;
+            macroMaterialGridShaderData.m_tileSize = MacroMaterialGridSize;
+
+            m_materialDataBuffer.UpdateSrg(terrainSrg.get());
+            m_materialRefGridDataBuffer.UpdateSrg(terrainSrg.get());
+            terrainSrg->SetConstant(m_macroMaterialGridIndex, macroMaterialGridShaderData);
+        }
+    }
+
+    void TerrainMacroMaterialManager::UpdateTileMaterials(const AZ::Vector2& viewPosition)
+    {
+        AZ_PROFILE_FUNCTION(AzRender);
 
         if (m_terrainSizeChanged)
         {
@@ -418,7 +442,7 @@ namespace Terrain
             desc.m_clipmapToWorldScale = MacroMaterialGridSize;
             desc.m_clipmapUpdateMultiple = 1;
             desc.m_size = m_tiles1D;
-            desc.m_worldSpaceCenter = AZ::Vector2(mainCameraPosition);
+            desc.m_worldSpaceCenter = viewPosition;
 
             m_macroMaterialTileBounds = ClipmapBounds(desc);
 
@@ -444,68 +468,98 @@ namespace Terrain
                     return true;
                 }
             );
+            return;
         }
-        else
+
+        auto updateRegionList = m_macroMaterialTileBounds.UpdateCenter(viewPosition);
+        if (updateRegionList.empty())
         {
-            auto updateRegionList = m_macroMaterialTileBounds.UpdateCenter(AZ::Vector2(mainCameraPosition));
-            for (const auto& updateRegion : updateRegionList)
-            {
-                AZStd::vector<MaterialHandle> affectedMaterials;
-                affectedMaterials.reserve(AZStd::GetMin(m_entityToMaterialHandle.size(), size_t(128)));
-                AZ::Vector2 regionMin = AZ::Vector2(updateRegion.m_worldAabb.GetMin());
-                AZ::Vector2 regionMax = AZ::Vector2(updateRegion.m_worldAabb.GetMax());
+            return;
+        }
 
-                // Do a coarse check of which materials might affect this region's tiles by gathering all
-                // macro materials that overlap the region. This should reduce the number of checks that need
-                // to be done per-tile.
+        // Each region keeps its own list of materials alive until all of its jobs are done.
+        AZStd::vector<AZStd::vector<MaterialHandle>> affectedMaterialsPerRegion(updateRegionList.size());
+        AZ::JobCompletion jobCompletion;
 
-                for (auto& [entityId, materialHandle] : m_entityToMaterialHandle)
-                {
-                    MacroMaterialShaderData& shaderData = m_materialData.GetElement<0>(materialHandle.GetIndex());
+        for (size_t regionIndex = 0; regionIndex < updateRegionList.size(); ++regionIndex)
+        {
+            const ClipmapBoundsRegion& updateRegion = updateRegionList[regionIndex];
+            AZStd::vector<MaterialHandle>& affectedMaterials = affectedMaterialsPerRegion[regionIndex];
+            affectedMaterials.reserve(AZStd::GetMin(m_entityToMaterialHandle.size(), size_t(128)));
+            AZ::Vector2 regionMin = AZ::Vector2(updateRegion.m_worldAabb.GetMin());
+            AZ::Vector2 regionMax = AZ::Vector2(updateRegion.m_worldAabb.GetMax());
 
-                    if (shaderData.Overlaps(regionMin, regionMax))
-                    {
-                        affectedMaterials.push_back(materialHandle);
-                    }
+            // Do a coarse check of which materials might affect this region's tiles by gathering all
+            // macro materials that overlap the region. This should reduce the number of checks that need
+            // to be done per-tile.
+
+            for (auto& [entityId, materialHandle] : m_entityToMaterialHandle)
+            {
+                MacroMaterialShaderData& shaderData = m_materialData.GetElement<0>(materialHandle.GetIndex());
+
+                if (shaderData.Overlaps(regionMin, regionMax))
+                {
+                    affectedMaterials.push_back(materialHandle);
                 }
+            }
 
-                // Check the list of macro materials against all the tiles in this region.
+            m_bufferNeedsUpdate = true;
 
-                ForMacroMaterialsInRegion(updateRegion,
-                    [&](TileHandle tileHandle, const AZ::Vector2& tileMin)
-                    {
-                        AZ::Vector2 tileMax = tileMin + AZ::Vector2(MacroMaterialGridSize);
-                        m_materialRefGridShaderData.at(tileHandle.GetIndex()) = DefaultTileMaterials; // clear out current materials
-
-                        for (MaterialHandle materialHandle : affectedMaterials)
-                        {
-                            MacroMaterialShaderData& shaderData = m_materialData.GetElement<0>(materialHandle.GetIndex());
-                            if (shaderData.Overlaps(tileMin, tileMax))
-                            {
-                                AddMacroMaterialToTile(materialHandle, tileHandle);
-                            }
-                        }
-                    }
-                );
+            // The camera moving across a tile only adds a row or column of tiles, which isn't worth a job. Jumping
+            // across the world rebuilds the whole grid, which is split into slices of rows.
+            const Vector2i extents = updateRegion.m_localAabb.m_max - updateRegion.m_localAabb.m_min;
+            if (extents.m_x * extents.m_y <= MacroMaterialTilesPerJob)
+            {
+                RebuildTileMaterials(updateRegion, affectedMaterials);
+                continue;
+            }
 
-                m_bufferNeedsUpdate = true;
+            const int32_t rowsPerJob = AZStd::max(MacroMaterialTilesPerJob / extents.m_x, 1);
+            for (int32_t firstRow = 0; firstRow < extents.m_y; firstRow += rowsPerJob)
+            {
+                const int32_t rowCount = AZStd::min(rowsPerJob, extents.m_y - firstRow);
+
+                ClipmapBoundsRegion slice = updateRegion;
+                slice.m_localAabb.m_min.m_y += firstRow;
+                slice.m_localAabb.m_max.m_y = slice.m_localAabb.m_min.m_y + rowCount;
+                AZ::Vector3 sliceMin = updateRegion.m_worldAabb.GetMin();
+                AZ::Vector3 sliceMax = updateRegion.m_worldAabb.GetMax();
+                sliceMin.SetY(sliceMin.GetY() + firstRow * MacroMaterialGridSize);
+                sliceMax.SetY(sliceMin.GetY() + rowCount * MacroMaterialGridSize);
+                slice.m_worldAabb = AZ::Aabb::CreateFromMinMax(sliceMin, sliceMax);
+
+                auto jobLambda = [this, slice, &affectedMaterials]()
+                {
+                    RebuildTileMaterials(slice, affectedMaterials);
+                };
+                AZ::Job* job = AZ::CreateJobFunction(jobLambda, true);
+                job->SetDependent(&jobCompletion);
+                job->Start();
             }
         }
 
-        if (m_bufferNeedsUpdate && terrainSrg)
-        {
-            m_bufferNeedsUpdate = false;
-            m_materialDataBuffer.UpdateBuffer(m_materialData.GetRawData<0>(), aznumeric_cast<uint32_t>(m_materialData.GetSize()));
-            m_materialRefGridDataBuffer.UpdateBuffer(m_materialRefGridShaderData.data(), aznumeric_cast<uint32_t>(m_materialRefGridShaderData.size()));
+        jobCompletion.StartAndWaitForCompletion();
+    }
 
-            MacroMaterialGridShaderData macroMaterialGridShaderData;
-            macroMaterialGridShaderData.m_tileCount1D = m_tiles1D;
-            macroMaterialGridShaderData.m_tileSize = MacroMaterialGridSize;
+    void TerrainMacroMaterialManager::RebuildTileMaterials(const ClipmapBoundsRegion& region, const AZStd::vector<MaterialHandle>& affectedMaterials)
+    {
+        // Check the list of macro materials against all the tiles in this region.
+        ForMacroMaterialsInRegion(region,
+            [&](TileHandle tileHandle, const AZ::Vector2& tileMin)
+            {
+                AZ::Vector2 tileMax = tileMin + AZ::Vector2(MacroMaterialGridSize);
+                m_materialRefGridShaderData.at(tileHandle.GetIndex()) = DefaultTileMaterials; // clear out current materials
 
-            m_materialDataBuffer.UpdateSrg(terrainSrg.get());
-            m_materialRefGridDataBuffer.UpdateSrg(terrainSrg.get());
-            terrainSrg->SetConstant(m_macroMaterialGridIndex, macroMaterialGridShaderData);
-        }
+                for (MaterialHandle materialHandle : affectedMaterials)
+                {
+                    const MacroMaterialShaderData& shaderData = m_materialData.GetElement<0>(materialHandle.GetIndex());
+                    if (shaderData.Overlaps(tileMin, tileMax))
+                    {
+                        AddMacroMaterialToTile(materialHandle, tileHandle);
+                    }
+                }
+            }
+        );
     }
 
     void TerrainMacroMaterialManager::RemoveAllImages()
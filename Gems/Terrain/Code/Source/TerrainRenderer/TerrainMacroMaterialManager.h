@@ -21,11 +21,17 @@
 #include <TerrainRenderer/Vector2i.h>
 #include <TerrainRenderer/ClipmapBounds.h>
 
+namespace UnitTest
+{
+    class TerrainMacroMaterialManagerTest;
+}
+
 namespace Terrain
 {
     class TerrainMacroMaterialManager
         : private TerrainMacroMaterialNotificationBus::Handler
     {
+        friend class UnitTest::TerrainMacroMaterialManagerTest;
     public:
         
         TerrainMacroMaterialManager() = default;
@@ -46,6 +52,8 @@ namespace Terrain
         static constexpr auto InvalidImageIndex = AZ::Render::BindlessImageArrayHandler::InvalidImageIndex;
         static constexpr float MacroMaterialGridSize = 64.0f;
         static constexpr uint16_t MacroMaterialsPerTile = 4;
+        //! Regions with more tiles than this are rebuilt across worker jobs, in slices of about this many tiles.
+        static constexpr int32_t MacroMaterialTilesPerJob = 1024;
 
         using MaterialHandle = AZ::RHI::Handle<uint16_t, class Material>;
         using TileHandle = AZ::RHI::Handle<uint32_t, class Tile>;
@@ -101,6 +109,12 @@ namespace Terrain
         void OnTerrainMacroMaterialRegionChanged(AZ::EntityId entityId, const AZ::Aabb& oldRegion, const AZ::Aabb& newRegion) override;
         void OnTerrainMacroMaterialDestroyed(AZ::EntityId entityId) override;
         
+        //! Move the tile grid to follow the camera and rebuild the material references of the tiles that entered it.
+        void UpdateTileMaterials(const AZ::Vector2& viewPosition);
+        //! Rebuild the tiles of a region from the materials that overlap it. Only reads the material data and only writes the
+        //! tiles of the region, so the regions and the slices of a region can be rebuilt on separate jobs.
+        void RebuildTileMaterials(const ClipmapBoundsRegion& region, const AZStd::vector<MaterialHandle>& affectedMaterials);
+
         void UpdateMacroMaterialShaderEntry(MaterialHandle materialHandle, const MacroMaterialData& macroMaterialData);
         void AddMacroMaterialToTile(MaterialHandle materialHandle, TileHandle tileHandle);
         void RemoveMacroMaterialFromTile(MaterialHandle materialHandle, TileHandle tileHandle, const AZ::Vector2& tileMin);
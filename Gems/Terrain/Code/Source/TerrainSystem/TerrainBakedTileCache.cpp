@@ -0,0 +1,760 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TerrainSystem/TerrainBakedTileCache.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/lock.h>
+
+AZ_DECLARE_BUDGET(Terrain);
+
+namespace Terrain
+{
+    AZ_CVAR(uint32_t, terrain_bakedTileCacheSize, 256, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of baked terrain tiles kept resident in memory.");
+
+    AZ_CVAR(bool, terrain_bakedTilesBlockingRead, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, lookups of baked terrain tiles that aren't resident read them synchronously instead of falling back to "
+        "live terrain evaluation. Useful on servers that only need the baked data.");
+
+    namespace
+    {
+        constexpr uint32_t BakedTilesMagic = AZ_CRC_CE("TerrainBakedTiles");
+        constexpr uint32_t BakedTilesVersion = 1;
+
+        // Upper bound on the tiles in a bake, 4096 x 4096 tiles of HeightSamplesPerTile x HeightSamplesPerTile height samples.
+        constexpr uint64_t MaxBakedTileCount = 1u << 24;
+
+        // The on-disk header of a bake, followed by a table of tileCountX * tileCountY TileIndexEntry values and the tile data.
+        struct BakedTilesHeader
+        {
+            uint32_t m_magic = BakedTilesMagic;
+            uint32_t m_version = BakedTilesVersion;
+            float m_heightQueryResolution = 1.0f;
+            float m_surfaceDataQueryResolution = 1.0f;
+            float m_heightMin = 0.0f;
+            float m_heightMax = 0.0f;
+            int32_t m_firstTileX = 0;
+            int32_t m_firstTileY = 0;
+            uint32_t m_tileCountX = 0;
+            uint32_t m_tileCountY = 0;
+            uint32_t m_heightSamplesPerTile = TerrainBakedTileCache::HeightSamplesPerTile;
+            uint32_t m_padding = 0;
+        };
+
+        AZ::IO::FixedMaxPath ResolveBakePath(const AZ::IO::PathView& path)
+        {
+            AZ::IO::FixedMaxPath resolvedPath(path);
+            if (auto* fileIO = AZ::IO::FileIOBase::GetInstance())
+            {
+                fileIO->ResolvePath(resolvedPath, path);
+            }
+            return resolvedPath;
+        }
+
+        // Returns true if the coordinate lies on the query grid, with the index of the grid point.
+        bool ToGridIndex(float value, float resolution, int32_t& outIndex)
+        {
+            const float gridValue = value / resolution;
+            const float roundedValue = AZStd::round(gridValue);
+            outIndex = aznumeric_cast<int32_t>(roundedValue);
+            return AZStd::abs(gridValue - roundedValue) <= 1.0e-3f;
+        }
+
+        int32_t FloorDivide(int32_t value, int32_t divisor)
+        {
+            return (value >= 0) ? (value / divisor) : -((-value + divisor - 1) / divisor);
+        }
+
+        template<typename T>
+        void WriteValues(AZStd::vector<uint8_t>& buffer, const T* values, size_t count)
+        {
+            const size_t offset = buffer.size();
+            buffer.resize(offset + sizeof(T) * count);
+            memcpy(buffer.data() + offset, values, sizeof(T) * count);
+        }
+
+        template<typename T>
+        bool ReadValues(AZStd::span<const uint8_t>& buffer, T* values, size_t count)
+        {
+            if (buffer.size() < sizeof(T) * count)
+            {
+                return false;
+            }
+            memcpy(values, buffer.data(), sizeof(T) * count);
+            buffer = buffer.subspan(sizeof(T) * count);
+            return true;
+        }
+    } // namespace
+
+    TerrainBakedTileCache::~TerrainBakedTileCache()
+    {
+        Unload();
+
+        // Completion callbacks of cancelled reads still reference this cache.
+        AZStd::unique_lock<AZStd::mutex> lock(m_inFlightReadsMutex);
+        m_inFlightReadsDone.wait(lock, [this]() { return m_inFlightReads == 0; });
+    }
+
+    TerrainBakedTileCache::BakeSettings TerrainBakedTileCache::CreateBakeSettings(
+        const AZ::Aabb& worldBounds,
+        float heightQueryResolution,
+        float surfaceDataQueryResolution,
+        const AzFramework::Terrain::FloatRange& heightRange)
+    {
+        BakeSettings settings;
+        settings.m_heightQueryResolution = heightQueryResolution;
+        settings.m_surfaceDataQueryResolution = surfaceDataQueryResolution;
+        settings.m_heightRange = heightRange;
+
+        if (!worldBounds.IsValid())
+        {
+            return settings;
+        }
+
+        const float tileSize = HeightSamplesPerTile * heightQueryResolution;
+        const int32_t lastTileX = aznumeric_cast<int32_t>(AZStd::floor(worldBounds.GetMax().GetX() / tileSize));
+        const int32_t lastTileY = aznumeric_cast<int32_t>(AZStd::floor(worldBounds.GetMax().GetY() / tileSize));
+        settings.m_firstTileX = aznumeric_cast<int32_t>(AZStd::floor(worldBounds.GetMin().GetX() / tileSize));
+        settings.m_firstTileY = aznumeric_cast<int32_t>(AZStd::floor(worldBounds.GetMin().GetY() / tileSize));
+        settings.m_tileCountX = aznumeric_cast<uint32_t>(lastTileX - settings.m_firstTileX + 1);
+        settings.m_tileCountY = aznumeric_cast<uint32_t>(lastTileY - settings.m_firstTileY + 1);
+        return settings;
+    }
+
+    AZ::Aabb TerrainBakedTileCache::GetTileBounds(const BakeSettings& settings, int32_t tileX, int32_t tileY)
+    {
+        const float tileSize = HeightSamplesPerTile * settings.m_heightQueryResolution;
+        return AZ::Aabb::CreateFromMinMax(
+            AZ::Vector3(tileX * tileSize, tileY * tileSize, settings.m_heightRange.m_min),
+            AZ::Vector3((tileX + 1) * tileSize, (tileY + 1) * tileSize, settings.m_heightRange.m_max));
+    }
+
+    uint16_t TerrainBakedTileCache::QuantizeHeight(float height, const AzFramework::Terrain::FloatRange& heightRange)
+    {
+        const float range = heightRange.m_max - heightRange.m_min;
+        const float normalizedHeight = (range > 0.0f) ? AZ::GetClamp((height - heightRange.m_min) / range, 0.0f, 1.0f) : 0.0f;
+        return aznumeric_cast<uint16_t>(AZStd::round(normalizedHeight * TerrainBakedTile::MaxQuantizedHeight));
+    }
+
+    TerrainBakedTileCache::TileKey TerrainBakedTileCache::MakeTileKey(int32_t tileX, int32_t tileY)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(tileX)) << 32) | static_cast<uint32_t>(tileY);
+    }
+
+    bool TerrainBakedTileCache::SerializeTile(const TerrainBakedTile& tile, AZStd::vector<uint8_t>& outBuffer)
+    {
+        if (tile.m_surfaceTags.size() > AZStd::numeric_limits<uint8_t>::max() ||
+            tile.m_surfaces.size() != static_cast<size_t>(tile.m_surfaceCountX) * tile.m_surfaceCountY)
+        {
+            return false;
+        }
+
+        outBuffer.clear();
+        const uint32_t surfaceTagCount = aznumeric_cast<uint32_t>(tile.m_surfaceTags.size());
+        WriteValues(outBuffer, &tile.m_firstSurfaceX, 1);
+        WriteValues(outBuffer, &tile.m_firstSurfaceY, 1);
+        WriteValues(outBuffer, &tile.m_surfaceCountX, 1);
+        WriteValues(outBuffer, &tile.m_surfaceCountY, 1);
+        WriteValues(outBuffer, &surfaceTagCount, 1);
+        for (const AZ::Crc32& surfaceTag : tile.m_surfaceTags)
+        {
+            const uint32_t tagValue = surfaceTag;
+            WriteValues(outBuffer, &tagValue, 1);
+        }
+        WriteValues(outBuffer, tile.m_heights.data(), tile.m_heights.size());
+        WriteValues(outBuffer, tile.m_surfaces.data(), tile.m_surfaces.size());
+        return true;
+    }
+
+    bool TerrainBakedTileCache::DeserializeTile(
+        AZStd::span<const uint8_t> buffer, uint32_t heightSampleCount, uint32_t maxSurfaceCount, TerrainBakedTile& outTile)
+    {
+        uint32_t surfaceTagCount = 0;
+        if (!ReadValues(buffer, &outTile.m_firstSurfaceX, 1) || !ReadValues(buffer, &outTile.m_firstSurfaceY, 1) ||
+            !ReadValues(buffer, &outTile.m_surfaceCountX, 1) || !ReadValues(buffer, &outTile.m_surfaceCountY, 1) ||
+            !ReadValues(buffer, &surfaceTagCount, 1) || surfaceTagCount > AZStd::numeric_limits<uint8_t>::max())
+        {
+            return false;
+        }
+
+        // The counts come from the file, so make sure they fit the tile and the data that follows before allocating anything.
+        if ((outTile.m_surfaceCountX > maxSurfaceCount) || (outTile.m_surfaceCountY > maxSurfaceCount))
+        {
+            return false;
+        }
+
+        const size_t surfaceCount = static_cast<size_t>(outTile.m_surfaceCountX) * outTile.m_surfaceCountY;
+        const size_t expectedSize = sizeof(uint32_t) * surfaceTagCount + sizeof(uint16_t) * heightSampleCount +
+            sizeof(TerrainBakedTile::SurfaceSample) * surfaceCount;
+        if (buffer.size() != expectedSize)
+        {
+            return false;
+        }
+
+        outTile.m_surfaceTags.resize(surfaceTagCount);
+        for (AZ::Crc32& surfaceTag : outTile.m_surfaceTags)
+        {
+            uint32_t tagValue = 0;
+            if (!ReadValues(buffer, &tagValue, 1))
+            {
+                return false;
+            }
+            surfaceTag = AZ::Crc32(tagValue);
+        }
+
+        outTile.m_heights.resize(heightSampleCount);
+        outTile.m_surfaces.resize(surfaceCount);
+        return ReadValues(buffer, outTile.m_heights.data(), outTile.m_heights.size()) &&
+            ReadValues(buffer, outTile.m_surfaces.data(), outTile.m_surfaces.size());
+    }
+
+    uint32_t TerrainBakedTileCache::GetMaxSurfaceCount(const BakeSettings& settings)
+    {
+        if (settings.m_surfaceDataQueryResolution <= 0.0f)
+        {
+            return 0;
+        }
+
+        // A tile's surface grid points are the ones inside its bounds, so one more than fit into the tile size.
+        const float tileSize = HeightSamplesPerTile * settings.m_heightQueryResolution;
+        return aznumeric_cast<uint32_t>(AZStd::ceil(tileSize / settings.m_surfaceDataQueryResolution)) + 1;
+    }
+
+    bool TerrainBakedTileCache::WriteBakedTiles(const AZ::IO::PathView& path, const BakeSettings& settings, const BakeTileCallback& bakeTile)
+    {
+        AZ_PROFILE_FUNCTION(Terrain);
+
+        const AZ::IO::FixedMaxPath resolvedPath = ResolveBakePath(path);
+        AZ::IO::SystemFile file;
+        if (!file.Open(
+                resolvedPath.c_str(),
+                AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Error("Terrain", false, "Failed to open '%s' to write baked terrain tiles.", resolvedPath.c_str());
+            return false;
+        }
+
+        BakedTilesHeader header;
+        header.m_heightQueryResolution = settings.m_heightQueryResolution;
+        header.m_surfaceDataQueryResolution = settings.m_surfaceDataQueryResolution;
+        header.m_heightMin = settings.m_heightRange.m_min;
+        header.m_heightMax = settings.m_heightRange.m_max;
+        header.m_firstTileX = settings.m_firstTileX;
+        header.m_firstTileY = settings.m_firstTileY;
+        header.m_tileCountX = settings.m_tileCountX;
+        header.m_tileCountY = settings.m_tileCountY;
+
+        // The tile table is written once all tiles are baked and their offsets are known.
+        AZStd::vector<TileIndexEntry> tileIndex(static_cast<size_t>(settings.m_tileCountX) * settings.m_tileCountY);
+        uint64_t offset = sizeof(BakedTilesHeader) + sizeof(TileIndexEntry) * tileIndex.size();
+        file.Seek(offset, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+
+        TerrainBakedTile tile;
+        AZStd::vector<uint8_t> tileBuffer;
+        for (uint32_t y = 0; y < settings.m_tileCountY; ++y)
+        {
+            for (uint32_t x = 0; x < settings.m_tileCountX; ++x)
+            {
+                tile = {};
+                if (!bakeTile(settings.m_firstTileX + x, settings.m_firstTileY + y, tile))
+                {
+                    return false;
+                }
+
+                if (tile.m_heights.size() != HeightSamplesPerTile * HeightSamplesPerTile || !SerializeTile(tile, tileBuffer))
+                {
+                    AZ_Error("Terrain", false, "Baked terrain tile (%u, %u) has invalid data.", x, y);
+                    return false;
+                }
+
+                if (file.Write(tileBuffer.data(), tileBuffer.size()) != tileBuffer.size())
+                {
+                    AZ_Error("Terrain", false, "Failed to write baked terrain tiles to '%s'.", resolvedPath.c_str());
+                    return false;
+                }
+
+                TileIndexEntry& entry = tileIndex[static_cast<size_t>(y) * settings.m_tileCountX + x];
+                entry.m_offset = offset;
+                entry.m_size = aznumeric_cast<uint32_t>(tileBuffer.size());
+                offset += tileBuffer.size();
+            }
+        }
+
+        file.Seek(0, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+        const size_t tileIndexSize = sizeof(TileIndexEntry) * tileIndex.size();
+        return (file.Write(&header, sizeof(header)) == sizeof(header)) &&
+            (file.Write(tileIndex.data(), tileIndexSize) == tileIndexSize);
+    }
+
+    bool TerrainBakedTileCache::Load(const AZ::IO::PathView& path)
+    {
+        Unload();
+
+        const AZ::IO::FixedMaxPath resolvedPath = ResolveBakePath(path);
+        AZ::IO::SystemFile file;
+        if (!file.Open(resolvedPath.c_str(), AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+        {
+            AZ_Error("Terrain", false, "Failed to open baked terrain tiles '%s'.", resolvedPath.c_str());
+            return false;
+        }
+
+        BakedTilesHeader header;
+        if ((file.Read(sizeof(header), &header) != sizeof(header)) || (header.m_magic != BakedTilesMagic) ||
+            (header.m_version != BakedTilesVersion) || (header.m_heightSamplesPerTile != HeightSamplesPerTile))
+        {
+            AZ_Error("Terrain", false, "'%s' isn't a supported baked terrain tile file.", resolvedPath.c_str());
+            return false;
+        }
+
+        // The tile count comes from the file, so check that the tile table fits in it before allocating the table.
+        const uint64_t fileSize = file.Length();
+        const uint64_t tileCount = static_cast<uint64_t>(header.m_tileCountX) * header.m_tileCountY;
+        if ((tileCount > MaxBakedTileCount) || (tileCount * sizeof(TileIndexEntry) > fileSize - sizeof(header)))
+        {
+            AZ_Error("Terrain", false, "Baked terrain tile file '%s' has an invalid tile count of %u x %u.", resolvedPath.c_str(),
+                header.m_tileCountX, header.m_tileCountY);
+            return false;
+        }
+
+        AZStd::vector<TileIndexEntry> tileIndex(static_cast<size_t>(tileCount));
+        const size_t tileIndexSize = sizeof(TileIndexEntry) * tileIndex.size();
+        if (file.Read(tileIndexSize, tileIndex.data()) != tileIndexSize)
+        {
+            AZ_Error("Terrain", false, "Baked terrain tile file '%s' is truncated.", resolvedPath.c_str());
+            return false;
+        }
+
+        for (const TileIndexEntry& entry : tileIndex)
+        {
+            if ((entry.m_offset > fileSize) || (entry.m_size > fileSize - entry.m_offset))
+            {
+                AZ_Error("Terrain", false, "Baked terrain tile file '%s' references tile data past the end of the file.", resolvedPath.c_str());
+                return false;
+            }
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_path = resolvedPath;
+        m_bakeSettings.m_heightQueryResolution = header.m_heightQueryResolution;
+        m_bakeSettings.m_surfaceDataQueryResolution = header.m_surfaceDataQueryResolution;
+        m_bakeSettings.m_heightRange = { header.m_heightMin, header.m_heightMax };
+        m_bakeSettings.m_firstTileX = header.m_firstTileX;
+        m_bakeSettings.m_firstTileY = header.m_firstTileY;
+        m_bakeSettings.m_tileCountX = header.m_tileCountX;
+        m_bakeSettings.m_tileCountY = header.m_tileCountY;
+        m_maxSurfaceCount = GetMaxSurfaceCount(m_bakeSettings);
+        m_tileIndex = AZStd::move(tileIndex);
+        m_loaded = true;
+        ++m_loadGeneration;
+        return true;
+    }
+
+    void TerrainBakedTileCache::Unload()
+    {
+        AZStd::unordered_map<TileKey, AZ::IO::FileRequestPtr> pendingReads;
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+            m_loaded = false;
+            ++m_loadGeneration;
+            m_tileIndex = {};
+            m_residentTiles.clear();
+            m_dirtyTiles.clear();
+            pendingReads.swap(m_pendingReads);
+        }
+
+        // Reads that are already in flight complete for a stale load generation and are dropped.
+        if (auto* streamer = AZ::Interface<AZ::IO::IStreamer>::Get())
+        {
+            for (auto& [key, request] : pendingReads)
+            {
+                streamer->QueueRequest(streamer->Cancel(request));
+            }
+        }
+    }
+
+    bool TerrainBakedTileCache::IsLoaded() const
+    {
+        return m_loaded;
+    }
+
+    void TerrainBakedTileCache::MarkDirty(const AZ::Aabb& region)
+    {
+        if (!m_loaded || !region.IsValid())
+        {
+            return;
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        if (!m_loaded)
+        {
+            return;
+        }
+
+        const float tileSize = HeightSamplesPerTile * m_bakeSettings.m_heightQueryResolution;
+        const int32_t minTileX = AZStd::max(m_bakeSettings.m_firstTileX, aznumeric_cast<int32_t>(AZStd::floor(region.GetMin().GetX() / tileSize)));
+        const int32_t minTileY = AZStd::max(m_bakeSettings.m_firstTileY, aznumeric_cast<int32_t>(AZStd::floor(region.GetMin().GetY() / tileSize)));
+        const int32_t maxTileX = AZStd::min(
+            m_bakeSettings.m_firstTileX + aznumeric_cast<int32_t>(m_bakeSettings.m_tileCountX) - 1,
+            aznumeric_cast<int32_t>(AZStd::floor(region.GetMax().GetX() / tileSize)));
+        const int32_t maxTileY = AZStd::min(
+            m_bakeSettings.m_firstTileY + aznumeric_cast<int32_t>(m_bakeSettings.m_tileCountY) - 1,
+            aznumeric_cast<int32_t>(AZStd::floor(region.GetMax().GetY() / tileSize)));
+
+        for (int32_t tileY = minTileY; tileY <= maxTileY; ++tileY)
+        {
+            for (int32_t tileX = minTileX; tileX <= maxTileX; ++tileX)
+            {
+                const TileKey key = MakeTileKey(tileX, tileY);
+                m_dirtyTiles.insert(key);
+                m_residentTiles.erase(key);
+            }
+        }
+    }
+
+    bool TerrainBakedTileCache::IsCompatible(const BakeSettings& settings) const
+    {
+        return m_loaded && (settings.m_heightQueryResolution == m_bakeSettings.m_heightQueryResolution) &&
+            (settings.m_surfaceDataQueryResolution == m_bakeSettings.m_surfaceDataQueryResolution) &&
+            (settings.m_heightRange == m_bakeSettings.m_heightRange);
+    }
+
+    const TerrainBakedTile* TerrainBakedTileCache::FindResidentTile(TileKey key) const
+    {
+        auto residentTile = m_residentTiles.find(key);
+        if (residentTile == m_residentTiles.end())
+        {
+            return nullptr;
+        }
+
+        residentTile->second->m_lastUsed.store(++m_useCounter, AZStd::memory_order_relaxed);
+        return &residentTile->second->m_tile;
+    }
+
+    bool TerrainBakedTileCache::RequestTiles(const AZStd::vector<TileKey>& tileKeys) const
+    {
+        auto* streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+        const bool blockingRead = !streamer || terrain_bakedTilesBlockingRead;
+
+        struct TileRead
+        {
+            TileKey m_key = 0;
+            TileIndexEntry m_entry;
+        };
+        AZStd::vector<TileRead> tileReads;
+        AZStd::vector<AZ::IO::FileRequestPtr> streamerRequests;
+        AZ::IO::Path path;
+        uint32_t loadGeneration = 0;
+        uint32_t maxSurfaceCount = 0;
+
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+            if (!m_loaded)
+            {
+                return false;
+            }
+
+            path = m_path;
+            loadGeneration = m_loadGeneration;
+            maxSurfaceCount = m_maxSurfaceCount;
+
+            for (const TileKey key : tileKeys)
+            {
+                const int32_t localX = static_cast<int32_t>(key >> 32) - m_bakeSettings.m_firstTileX;
+                const int32_t localY = static_cast<int32_t>(key & 0xFFFFFFFF) - m_bakeSettings.m_firstTileY;
+                if ((localX < 0) || (localY < 0) || (localX >= aznumeric_cast<int32_t>(m_bakeSettings.m_tileCountX)) ||
+                    (localY >= aznumeric_cast<int32_t>(m_bakeSettings.m_tileCountY)))
+                {
+                    continue;
+                }
+
+                const TileIndexEntry& entry = m_tileIndex[static_cast<size_t>(localY) * m_bakeSettings.m_tileCountX + localX];
+                if ((entry.m_size == 0) || m_residentTiles.contains(key) || m_dirtyTiles.contains(key) || m_pendingReads.contains(key))
+                {
+                    continue;
+                }
+
+                if (blockingRead)
+                {
+                    // Blocking reads happen below, outside of the lock. Other threads that miss the same tile in the meantime
+                    // read it as well, and the copy that is inserted last wins.
+                    tileReads.push_back({ key, entry });
+                    continue;
+                }
+
+                // Stream the tile in, the lookup falls back to live evaluation until it arrives.
+                auto buffer = AZStd::make_shared<AZStd::vector<uint8_t>>(entry.m_size);
+                AZ::IO::FileRequestPtr request = streamer->Read(m_path.Native(), buffer->data(), buffer->size(), buffer->size(),
+                    AZ::IO::IStreamerTypes::s_noDeadline, AZ::IO::IStreamerTypes::s_priorityMedium, entry.m_offset);
+                streamer->SetRequestCompleteCallback(
+                    request,
+                    [this, key, buffer, loadGeneration](AZ::IO::FileRequestHandle handle)
+                    {
+                        auto* streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+                        if (streamer->GetRequestStatus(handle) == AZ::IO::IStreamerTypes::RequestStatus::Completed)
+                        {
+                            OnTileRead(key, loadGeneration, AZStd::move(*buffer));
+                        }
+                        else
+                        {
+                            OnTileRead(key, loadGeneration, {});
+                        }
+
+                        // Notify while holding the lock, the cache may be destroyed as soon as the destructor can take it.
+                        AZStd::lock_guard<AZStd::mutex> inFlightLock(m_inFlightReadsMutex);
+                        if (--m_inFlightReads == 0)
+                        {
+                            m_inFlightReadsDone.notify_all();
+                        }
+                    });
+                m_pendingReads.emplace(key, request);
+                {
+                    AZStd::lock_guard<AZStd::mutex> inFlightLock(m_inFlightReadsMutex);
+                    ++m_inFlightReads;
+                }
+                streamerRequests.push_back(request);
+            }
+        }
+
+        // The completion callbacks take the lock, so the requests are queued once it's released.
+        for (AZ::IO::FileRequestPtr& request : streamerRequests)
+        {
+            streamer->QueueRequest(request);
+        }
+
+        bool anyTileRead = false;
+        for (const TileRead& tileRead : tileReads)
+        {
+            AZ_PROFILE_SCOPE(Terrain, "TerrainBakedTileCache::ReadTile");
+            AZStd::vector<uint8_t> buffer(tileRead.m_entry.m_size);
+            TerrainBakedTile tile;
+            if ((AZ::IO::SystemFile::Read(path.c_str(), buffer.data(), buffer.size(), tileRead.m_entry.m_offset) != buffer.size()) ||
+                !DeserializeTile(buffer, HeightSamplesPerTile * HeightSamplesPerTile, maxSurfaceCount, tile))
+            {
+                continue;
+            }
+
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+            if ((loadGeneration == m_loadGeneration) && !m_dirtyTiles.contains(tileRead.m_key))
+            {
+                InsertResidentTile(tileRead.m_key, AZStd::move(tile));
+                anyTileRead = true;
+            }
+        }
+        return anyTileRead;
+    }
+
+    void TerrainBakedTileCache::InsertResidentTile(TileKey key, TerrainBakedTile&& tile) const
+    {
+        auto residentTile = AZStd::make_unique<ResidentTile>();
+        residentTile->m_tile = AZStd::move(tile);
+        residentTile->m_lastUsed = ++m_useCounter;
+        m_residentTiles[key] = AZStd::move(residentTile);
+
+        // Evicting scans the resident tiles for the least recently used one. This only happens when a tile arrives, while lookups
+        // of resident tiles just bump a counter without needing exclusive access.
+        const size_t capacity = AZStd::max<size_t>(static_cast<uint32_t>(terrain_bakedTileCacheSize), 1);
+        while (m_residentTiles.size() > capacity)
+        {
+            auto leastRecentlyUsed = AZStd::min_element(
+                m_residentTiles.begin(), m_residentTiles.end(),
+                [](const auto& lhs, const auto& rhs)
+                {
+                    return lhs.second->m_lastUsed.load(AZStd::memory_order_relaxed) < rhs.second->m_lastUsed.load(AZStd::memory_order_relaxed);
+                });
+            m_residentTiles.erase(leastRecentlyUsed);
+        }
+    }
+
+    void TerrainBakedTileCache::OnTileRead(TileKey key, uint32_t loadGeneration, AZStd::vector<uint8_t>&& buffer) const
+    {
+        uint32_t maxSurfaceCount = 0;
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+            if (loadGeneration != m_loadGeneration)
+            {
+                return;
+            }
+            maxSurfaceCount = m_maxSurfaceCount;
+        }
+
+        TerrainBakedTile tile;
+        const bool valid = !buffer.empty() && DeserializeTile(buffer, HeightSamplesPerTile * HeightSamplesPerTile, maxSurfaceCount, tile);
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        if (loadGeneration != m_loadGeneration)
+        {
+            return;
+        }
+
+        m_pendingReads.erase(key);
+        if (valid && !m_dirtyTiles.contains(key))
+        {
+            InsertResidentTile(key, AZStd::move(tile));
+        }
+    }
+
+    size_t TerrainBakedTileCache::GetHeights(
+        const BakeSettings& settings,
+        AZStd::span<AZ::Vector3> positions,
+        AZStd::span<bool> terrainExists,
+        AZStd::span<bool> resolved) const
+    {
+        if (!m_loaded)
+        {
+            return 0;
+        }
+
+        AZStd::vector<TileKey> missingTiles;
+        size_t resolvedCount = LookupHeights(settings, positions, terrainExists, resolved, missingTiles);
+
+        // Blocking reads make the missing tiles resident right away, so only the positions inside of them need another pass.
+        if (!missingTiles.empty() && RequestTiles(missingTiles))
+        {
+            missingTiles.clear();
+            resolvedCount += LookupHeights(settings, positions, terrainExists, resolved, missingTiles);
+        }
+        return resolvedCount;
+    }
+
+    size_t TerrainBakedTileCache::LookupHeights(
+        const BakeSettings& settings,
+        AZStd::span<AZ::Vector3> positions,
+        AZStd::span<bool> terrainExists,
+        AZStd::span<bool> resolved,
+        AZStd::vector<TileKey>& missingTiles) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        if (!IsCompatible(settings))
+        {
+            return 0;
+        }
+
+        const int32_t tileSamples = aznumeric_cast<int32_t>(HeightSamplesPerTile);
+        const float heightScale = (m_bakeSettings.m_heightRange.m_max - m_bakeSettings.m_heightRange.m_min) / TerrainBakedTile::MaxQuantizedHeight;
+        size_t resolvedCount = 0;
+
+        // Consecutive positions usually fall into the same tile, so remember the last one instead of looking it up every time.
+        const TerrainBakedTile* tile = nullptr;
+        int32_t tileX = AZStd::numeric_limits<int32_t>::min();
+        int32_t tileY = AZStd::numeric_limits<int32_t>::min();
+
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            int32_t gridX = 0;
+            int32_t gridY = 0;
+            if (resolved[index] || !ToGridIndex(positions[index].GetX(), m_bakeSettings.m_heightQueryResolution, gridX) ||
+                !ToGridIndex(positions[index].GetY(), m_bakeSettings.m_heightQueryResolution, gridY))
+            {
+                continue;
+            }
+
+            const int32_t positionTileX = FloorDivide(gridX, tileSamples);
+            const int32_t positionTileY = FloorDivide(gridY, tileSamples);
+            if ((positionTileX != tileX) || (positionTileY != tileY))
+            {
+                tileX = positionTileX;
+                tileY = positionTileY;
+                const TileKey key = MakeTileKey(tileX, tileY);
+                tile = FindResidentTile(key);
+                if (!tile && (AZStd::find(missingTiles.begin(), missingTiles.end(), key) == missingTiles.end()))
+                {
+                    missingTiles.push_back(key);
+                }
+            }
+
+            if (!tile)
+            {
+                continue;
+            }
+
+            const uint16_t height = tile->m_heights[(gridY - tileY * tileSamples) * tileSamples + (gridX - tileX * tileSamples)];
+            terrainExists[index] = (height != TerrainBakedTile::NoTerrain);
+            positions[index].SetZ(
+                terrainExists[index] ? m_bakeSettings.m_heightRange.m_min + height * heightScale : m_bakeSettings.m_heightRange.m_min);
+            resolved[index] = true;
+            ++resolvedCount;
+        }
+
+        return resolvedCount;
+    }
+
+    bool TerrainBakedTileCache::GetSurfaceWeights(
+        const BakeSettings& settings, const AZ::Vector3& position, AzFramework::SurfaceData::SurfaceTagWeightList& outSurfaceWeights) const
+    {
+        if (!m_loaded)
+        {
+            return false;
+        }
+
+        AZStd::vector<TileKey> missingTiles;
+        if (LookupSurfaceWeights(settings, position, outSurfaceWeights, missingTiles))
+        {
+            return true;
+        }
+
+        return !missingTiles.empty() && RequestTiles(missingTiles) &&
+            LookupSurfaceWeights(settings, position, outSurfaceWeights, missingTiles);
+    }
+
+    bool TerrainBakedTileCache::LookupSurfaceWeights(
+        const BakeSettings& settings,
+        const AZ::Vector3& position,
+        AzFramework::SurfaceData::SurfaceTagWeightList& outSurfaceWeights,
+        AZStd::vector<TileKey>& missingTiles) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        if (!IsCompatible(settings))
+        {
+            return false;
+        }
+
+        int32_t surfaceX = 0;
+        int32_t surfaceY = 0;
+        if (!ToGridIndex(position.GetX(), m_bakeSettings.m_surfaceDataQueryResolution, surfaceX) ||
+            !ToGridIndex(position.GetY(), m_bakeSettings.m_surfaceDataQueryResolution, surfaceY))
+        {
+            return false;
+        }
+
+        const float tileSize = HeightSamplesPerTile * m_bakeSettings.m_heightQueryResolution;
+        const TileKey key = MakeTileKey(
+            aznumeric_cast<int32_t>(AZStd::floor(position.GetX() / tileSize)), aznumeric_cast<int32_t>(AZStd::floor(position.GetY() / tileSize)));
+        const TerrainBakedTile* tile = FindResidentTile(key);
+        if (!tile)
+        {
+            missingTiles.push_back(key);
+            return false;
+        }
+        const int32_t localX = surfaceX - tile->m_firstSurfaceX;
+        const int32_t localY = surfaceY - tile->m_firstSurfaceY;
+        if ((localX < 0) || (localY < 0) || (localX >= aznumeric_cast<int32_t>(tile->m_surfaceCountX)) ||
+            (localY >= aznumeric_cast<int32_t>(tile->m_surfaceCountY)))
+        {
+            return false;
+        }
+
+        const TerrainBakedTile::SurfaceSample& sample = tile->m_surfaces[localY * tile->m_surfaceCountX + localX];
+        outSurfaceWeights.clear();
+        for (size_t weightIndex = 0; weightIndex < TerrainBakedTile::MaxSurfaceWeights; ++weightIndex)
+        {
+            if ((sample.m_weights[weightIndex] == 0) || (sample.m_tagIndices[weightIndex] >= tile->m_surfaceTags.size()))
+            {
+                break;
+            }
+            outSurfaceWeights.emplace_back(tile->m_surfaceTags[sample.m_tagIndices[weightIndex]], sample.m_weights[weightIndex] / 255.0f);
+        }
+        return true;
+    }
+} // namespace Terrain
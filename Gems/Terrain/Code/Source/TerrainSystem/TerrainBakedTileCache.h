@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzFramework/SurfaceData/SurfaceData.h>
+#include <AzFramework/Terrain/TerrainDataRequestBus.h>
+
+namespace Terrain
+{
+    //! Quantized terrain heights and surface weights for one square tile of the world, as written by the terrain bake.
+    //! A tile covers HeightSamplesPerTile x HeightSamplesPerTile points of the height query grid. Surface weights are stored for
+    //! every point of the surface data query grid that falls inside the tile, which may use a different resolution.
+    struct TerrainBakedTile
+    {
+        static constexpr uint16_t NoTerrain = 0xFFFF;
+        static constexpr uint16_t MaxQuantizedHeight = NoTerrain - 1;
+        static constexpr size_t MaxSurfaceWeights = 4;
+
+        //! The highest weighted surfaces at a point, in decreasing weight order. Unused entries have a weight of 0.
+        struct SurfaceSample
+        {
+            AZStd::array<uint8_t, MaxSurfaceWeights> m_tagIndices = {};
+            AZStd::array<uint8_t, MaxSurfaceWeights> m_weights = {};
+        };
+
+        //! Height samples in row-major order, NoTerrain marks points without terrain.
+        AZStd::vector<uint16_t> m_heights;
+
+        //! First surface data grid point covered by this tile and the number of grid points on each axis.
+        int32_t m_firstSurfaceX = 0;
+        int32_t m_firstSurfaceY = 0;
+        uint32_t m_surfaceCountX = 0;
+        uint32_t m_surfaceCountY = 0;
+
+        //! Surface tags referenced by the surface samples of this tile.
+        AZStd::vector<AZ::Crc32> m_surfaceTags;
+        AZStd::vector<SurfaceSample> m_surfaces;
+    };
+
+    //! @class TerrainBakedTileCache
+    //! @brief Reads baked terrain tiles on demand through the AZ::IO::Streamer and keeps the most recently used ones resident.
+    //!
+    //! Lookups never block on I/O by default: a baked tile that isn't resident yet is requested from the streamer and the lookup
+    //! reports a miss, so the caller falls back to evaluating the terrain live. Tiles that were refreshed after the bake was loaded
+    //! are marked dirty and always miss. All methods are thread safe. Lookups of resident tiles only take a shared lock, and tile
+    //! reads, including the blocking ones, never happen while the lock is held.
+    class TerrainBakedTileCache
+    {
+    public:
+        static constexpr uint32_t HeightSamplesPerTile = 64;
+
+        //! Describes the terrain settings and the range of tiles stored in a bake.
+        struct BakeSettings
+        {
+            float m_heightQueryResolution = 1.0f;
+            float m_surfaceDataQueryResolution = 1.0f;
+            AzFramework::Terrain::FloatRange m_heightRange = { 0.0f, 0.0f };
+            int32_t m_firstTileX = 0;
+            int32_t m_firstTileY = 0;
+            uint32_t m_tileCountX = 0;
+            uint32_t m_tileCountY = 0;
+        };
+
+        //! Fills in the heights and surface weights of the tile at the given tile coordinates.
+        //! @return false to abort the bake.
+        using BakeTileCallback = AZStd::function<bool(int32_t tileX, int32_t tileY, TerrainBakedTile& tile)>;
+
+        TerrainBakedTileCache() = default;
+        ~TerrainBakedTileCache();
+
+        //! Returns the tile settings that cover the given world bounds at the given query resolutions.
+        static BakeSettings CreateBakeSettings(
+            const AZ::Aabb& worldBounds,
+            float heightQueryResolution,
+            float surfaceDataQueryResolution,
+            const AzFramework::Terrain::FloatRange& heightRange);
+
+        //! Returns the world space XY bounds covered by a tile.
+        static AZ::Aabb GetTileBounds(const BakeSettings& settings, int32_t tileX, int32_t tileY);
+
+        //! Converts a height to its quantized representation within the bake's height range.
+        static uint16_t QuantizeHeight(float height, const AzFramework::Terrain::FloatRange& heightRange);
+
+        //! Writes a bake file containing every tile of the bake settings, produced one at a time by the callback.
+        static bool WriteBakedTiles(const AZ::IO::PathView& path, const BakeSettings& settings, const BakeTileCallback& bakeTile);
+
+        //! Opens a bake file and reads its tile table. The tiles themselves are streamed in on demand.
+        bool Load(const AZ::IO::PathView& path);
+        void Unload();
+        bool IsLoaded() const;
+
+        //! Marks the baked tiles overlapping the region as stale, so lookups inside it fall back to live evaluation.
+        void MarkDirty(const AZ::Aabb& region);
+
+        //! Looks up baked heights for positions on the height query grid.
+        //! @param settings The current terrain settings, baked data is only used if it was baked with the same settings.
+        //! @param positions The positions to look up, the Z value of every resolved position is set to the baked height.
+        //! @param terrainExists Set to whether or not terrain exists at every resolved position.
+        //! @param resolved Set to true for every position that was answered from baked data, untouched otherwise.
+        //! @return The number of positions resolved from baked data.
+        size_t GetHeights(
+            const BakeSettings& settings,
+            AZStd::span<AZ::Vector3> positions,
+            AZStd::span<bool> terrainExists,
+            AZStd::span<bool> resolved) const;
+
+        //! Looks up the baked surface weights for a position on the surface data query grid, in decreasing weight order.
+        //! @return true if the position was answered from baked data.
+        bool GetSurfaceWeights(
+            const BakeSettings& settings, const AZ::Vector3& position, AzFramework::SurfaceData::SurfaceTagWeightList& outSurfaceWeights) const;
+
+    private:
+        using TileKey = uint64_t;
+
+        struct TileIndexEntry
+        {
+            uint64_t m_offset = 0;
+            uint32_t m_size = 0;
+            uint32_t m_padding = 0;
+        };
+
+        struct ResidentTile
+        {
+            TerrainBakedTile m_tile;
+            //! Value of m_useCounter when the tile was last looked up, updated under the shared lock to pick the tile to evict.
+            mutable AZStd::atomic_uint64_t m_lastUsed{ 0 };
+        };
+
+        static TileKey MakeTileKey(int32_t tileX, int32_t tileY);
+        static bool SerializeTile(const TerrainBakedTile& tile, AZStd::vector<uint8_t>& outBuffer);
+
+        //! Reads a tile, rejecting surface grids that are larger than maxSurfaceCount points on either axis or buffers that are
+        //! too small for the counts they declare, before anything is allocated.
+        static bool DeserializeTile(
+            AZStd::span<const uint8_t> buffer, uint32_t heightSampleCount, uint32_t maxSurfaceCount, TerrainBakedTile& outTile);
+
+        //! Returns the maximum number of surface data grid points a tile can cover on each axis.
+        static uint32_t GetMaxSurfaceCount(const BakeSettings& settings);
+
+        //! The caller must hold m_mutex.
+        bool IsCompatible(const BakeSettings& settings) const;
+
+        //! Returns the resident tile, or nullptr if it isn't resident. The caller must hold m_mutex, at least shared.
+        const TerrainBakedTile* FindResidentTile(TileKey key) const;
+
+        //! Answers the positions that aren't resolved yet from resident tiles and adds the tiles that aren't resident to missingTiles.
+        size_t LookupHeights(
+            const BakeSettings& settings,
+            AZStd::span<AZ::Vector3> positions,
+            AZStd::span<bool> terrainExists,
+            AZStd::span<bool> resolved,
+            AZStd::vector<TileKey>& missingTiles) const;
+
+        //! Looks up the surface weights from a resident tile, setting missingTile if the tile isn't resident.
+        bool LookupSurfaceWeights(
+            const BakeSettings& settings,
+            const AZ::Vector3& position,
+            AzFramework::SurfaceData::SurfaceTagWeightList& outSurfaceWeights,
+            AZStd::vector<TileKey>& missingTiles) const;
+
+        //! Requests tiles that aren't resident from the streamer, or reads them synchronously if blocking reads are enabled.
+        //! @return true if any tile was made resident before returning.
+        bool RequestTiles(const AZStd::vector<TileKey>& tileKeys) const;
+
+        //! Adds a tile to the resident set and evicts the least recently used tiles past the cache capacity, the caller must hold m_mutex.
+        void InsertResidentTile(TileKey key, TerrainBakedTile&& tile) const;
+
+        void OnTileRead(TileKey key, uint32_t loadGeneration, AZStd::vector<uint8_t>&& buffer) const;
+
+        //! Guards everything below. Lookups take it shared, loading, invalidation and tile insertion take it exclusively.
+        mutable AZStd::shared_mutex m_mutex;
+        AZ::IO::Path m_path;
+        BakeSettings m_bakeSettings;
+        uint32_t m_maxSurfaceCount = 0;
+        AZStd::vector<TileIndexEntry> m_tileIndex;
+
+        //! Only written under m_mutex, but read without it so callers can skip the baked lookups when nothing is loaded.
+        AZStd::atomic_bool m_loaded{ false };
+
+        //! Incremented on every load and unload, so reads that complete for a previous bake are dropped.
+        uint32_t m_loadGeneration = 0;
+
+        mutable AZStd::atomic_uint64_t m_useCounter{ 0 };
+        mutable AZStd::unordered_map<TileKey, AZStd::unique_ptr<ResidentTile>> m_residentTiles;
+        mutable AZStd::unordered_map<TileKey, AZ::IO::FileRequestPtr> m_pendingReads;
+        AZStd::unordered_set<TileKey> m_dirtyTiles;
+
+        //! Streamer reads whose completion callbacks haven't returned yet, the destructor waits for them on m_inFlightReadsDone.
+        mutable AZStd::mutex m_inFlightReadsMutex;
+        mutable AZStd::condition_variable m_inFlightReadsDone;
+        mutable uint32_t m_inFlightReads = 0;
+    };
+} // namespace Terrain
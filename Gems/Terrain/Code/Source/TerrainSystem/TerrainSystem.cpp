@@ -7,6 +7,7 @@
  */
 
 #include <TerrainSystem/TerrainSystem.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/sort.h>
 #include <SurfaceData/SurfaceDataTypes.h>
@@ -25,6 +26,40 @@ using namespace Terrain;
 
 AZ_DEFINE_BUDGET(Terrain);
 
+AZ_CVAR(AZ::CVarFixedString, terrain_bakedTilesPath, "", nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Path of a baked terrain tile file to load when the terrain system activates. Empty to always evaluate the terrain live.");
+
+static void terrain_bakeTiles(const AZ::ConsoleCommandContainer& arguments)
+{
+    if (arguments.empty())
+    {
+        AZ_Warning("Terrain", false, "terrain_bakeTiles requires the path of the file to bake to.");
+        return;
+    }
+
+    bool baked = false;
+    Terrain::TerrainSystemServiceRequestBus::BroadcastResult(
+        baked, &Terrain::TerrainSystemServiceRequestBus::Events::BakeTerrainTiles, arguments.front());
+    AZ_Printf("Terrain", "Baking terrain tiles to '%.*s' %s.\n", AZ_STRING_ARG(arguments.front()), baked ? "succeeded" : "failed");
+}
+
+static void terrain_loadBakedTiles(const AZ::ConsoleCommandContainer& arguments)
+{
+    if (arguments.empty())
+    {
+        Terrain::TerrainSystemServiceRequestBus::Broadcast(&Terrain::TerrainSystemServiceRequestBus::Events::UnloadBakedTerrainTiles);
+        return;
+    }
+
+    Terrain::TerrainSystemServiceRequestBus::Broadcast(
+        &Terrain::TerrainSystemServiceRequestBus::Events::LoadBakedTerrainTiles, arguments.front());
+}
+
+AZ_CONSOLEFREEFUNC(terrain_bakeTiles, AZ::ConsoleFunctorFlags::Null,
+    "Bakes the terrain heights and surface weights into a file of streamable tiles: terrain_bakeTiles <path>");
+AZ_CONSOLEFREEFUNC(terrain_loadBakedTiles, AZ::ConsoleFunctorFlags::Null,
+    "Loads a baked terrain tile file, or unloads the current one if no path is given: terrain_loadBakedTiles [path]");
+
 bool TerrainLayerPriorityComparator::operator()(const AZ::EntityId& layer1id, const AZ::EntityId& layer2id) const
 {
     // Comparator for insertion/key lookup.
@@ -109,6 +144,11 @@ void TerrainSystem::Activate()
     };
     Terrain::TerrainSpawnerRequestBus::EnumerateHandlers(enumerationCallback);
 
+    if (const AZ::CVarFixedString bakedTilesPath = terrain_bakedTilesPath; !bakedTilesPath.empty())
+    {
+        m_bakedTileCache.Load(AZ::IO::PathView(bakedTilesPath.c_str()));
+    }
+
     AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
         &AzFramework::Terrain::TerrainDataNotificationBus::Events::OnTerrainDataCreateEnd);
 }
@@ -137,6 +177,8 @@ void TerrainSystem::Deactivate()
         m_registeredAreas.clear();
     }
 
+    m_bakedTileCache.Unload();
+
     m_dirtyRegion = AZ::Aabb::CreateNull();
     m_terrainHeightDirty = true;
     m_terrainSettingsDirty = true;
@@ -485,7 +527,45 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
 
     // This will be unused for heights. It's fine if it's empty.
     AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights;
-    MakeBulkQueries(outPositions, outPositions, outTerrainExists, outSurfaceWeights, callback);
+
+    // Answer the query positions that are covered by baked tiles first, and only evaluate the rest of them live.
+    size_t bakedCount = 0;
+    AZStd::vector<bool> resolvedFromBake;
+    if (m_bakedTileCache.IsLoaded())
+    {
+        resolvedFromBake.resize(outPositions.size(), false);
+        bakedCount = m_bakedTileCache.GetHeights(GetCurrentBakeSettings(), outPositions, outTerrainExists, resolvedFromBake);
+    }
+
+    if (bakedCount == 0)
+    {
+        MakeBulkQueries(outPositions, outPositions, outTerrainExists, outSurfaceWeights, callback);
+    }
+    else if (bakedCount < outPositions.size())
+    {
+        AZStd::vector<AZ::Vector3> livePositions;
+        livePositions.reserve(outPositions.size() - bakedCount);
+        for (size_t index = 0; index < outPositions.size(); index++)
+        {
+            if (!resolvedFromBake[index])
+            {
+                livePositions.push_back(outPositions[index]);
+            }
+        }
+
+        AZStd::vector<bool> liveTerrainExists(livePositions.size(), false);
+        MakeBulkQueries(livePositions, livePositions, liveTerrainExists, outSurfaceWeights, callback);
+
+        for (size_t index = 0, liveIndex = 0; index < outPositions.size(); index++)
+        {
+            if (!resolvedFromBake[index])
+            {
+                outPositions[index] = livePositions[liveIndex];
+                outTerrainExists[index] = liveTerrainExists[liveIndex];
+                liveIndex++;
+            }
+        }
+    }
 
     // Compute/store the final result
     for (size_t i = 0, iteratorIndex = 0; i < inPositions.size(); i++, iteratorIndex += indexStepSize)
@@ -547,10 +627,12 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
             const AZ::Vector2 pos1 = pos0 + AZ::Vector2(queryResolution);
 
             AZStd::array<bool,4> exists = { false, false, false, false };
-            const AZStd::array<float, 4> queriedHeights = { GetTerrainAreaHeight(pos0.GetX(), pos0.GetY(), exists[0]),
-                                                            GetTerrainAreaHeight(pos1.GetX(), pos0.GetY(), exists[1]),
-                                                            GetTerrainAreaHeight(pos0.GetX(), pos1.GetY(), exists[2]),
-                                                            GetTerrainAreaHeight(pos1.GetX(), pos1.GetY(), exists[3]) };
+            AZStd::array<AZ::Vector3, 4> corners = { AZ::Vector3(pos0.GetX(), pos0.GetY(), 0.0f),
+                                                     AZ::Vector3(pos1.GetX(), pos0.GetY(), 0.0f),
+                                                     AZ::Vector3(pos0.GetX(), pos1.GetY(), 0.0f),
+                                                     AZ::Vector3(pos1.GetX(), pos1.GetY(), 0.0f) };
+            GetTerrainAreaHeights(corners, exists);
+            const AZStd::array<float, 4> queriedHeights = { corners[0].GetZ(), corners[1].GetZ(), corners[2].GetZ(), corners[3].GetZ() };
 
             InterpolateHeights(queriedHeights, exists, normalizedDelta.GetX(), normalizedDelta.GetY(), height, terrainExists);
         }
@@ -562,7 +644,9 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
             AZ::Vector2 clampedPosition;
             RoundPosition(x, y, queryResolution, clampedPosition);
 
-            height = GetTerrainAreaHeight(clampedPosition.GetX(), clampedPosition.GetY(), terrainExists);
+            AZ::Vector3 position(clampedPosition.GetX(), clampedPosition.GetY(), 0.0f);
+            GetTerrainAreaHeights(AZStd::span<AZ::Vector3>(&position, 1), AZStd::span<bool>(&terrainExists, 1));
+            height = position.GetZ();
         }
         break;
 
@@ -570,7 +654,11 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
     case AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT:
         [[fallthrough]];
     default:
-        height = GetTerrainAreaHeight(x, y, terrainExists);
+        {
+            AZ::Vector3 position(x, y, 0.0f);
+            GetTerrainAreaHeights(AZStd::span<AZ::Vector3>(&position, 1), AZStd::span<bool>(&terrainExists, 1));
+            height = position.GetZ();
+        }
         break;
     }
 
@@ -584,6 +672,28 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
         height, m_currentSettings.m_heightRange.m_min, m_currentSettings.m_heightRange.m_max);
 }
 
+void TerrainSystem::GetTerrainAreaHeights(AZStd::span<AZ::Vector3> positions, AZStd::span<bool> terrainExists) const
+{
+    // All of the positions are looked up in the baked tiles at once, and only the ones that missed are evaluated live.
+    AZStd::array<bool, 4> resolvedFromBake = { false, false, false, false };
+    AZ_Assert(positions.size() <= resolvedFromBake.size(), "Too many positions for a single synchronous height query.");
+    if (m_bakedTileCache.IsLoaded())
+    {
+        m_bakedTileCache.GetHeights(
+            GetCurrentBakeSettings(), positions, terrainExists, AZStd::span<bool>(resolvedFromBake.data(), positions.size()));
+    }
+
+    for (size_t index = 0; index < positions.size(); index++)
+    {
+        if (!resolvedFromBake[index])
+        {
+            bool exists = false;
+            positions[index].SetZ(GetTerrainAreaHeight(positions[index].GetX(), positions[index].GetY(), exists));
+            terrainExists[index] = exists;
+        }
+    }
+}
+
 float TerrainSystem::GetTerrainAreaHeight(float x, float y, bool& terrainExists) const
 {
     const float worldMin = m_currentSettings.m_heightRange.m_min;
@@ -1309,7 +1419,37 @@ void TerrainSystem::GetOrderedSurfaceWeightsFromList(
     
     // This will be unused for surface weights. It's fine if it's empty.
     AZStd::vector<AZ::Vector3> outPositions;
-    MakeBulkQueries(queryPositions, outPositions, terrainExists, outSurfaceWeightsList, callback);
+
+    if (!m_bakedTileCache.IsLoaded())
+    {
+        MakeBulkQueries(queryPositions, outPositions, terrainExists, outSurfaceWeightsList, callback);
+        return;
+    }
+
+    // Answer the query positions that are covered by baked tiles first, and only evaluate the rest of them live.
+    const TerrainBakedTileCache::BakeSettings bakeSettings = GetCurrentBakeSettings();
+    AZStd::vector<size_t> liveIndices;
+    AZStd::vector<AZ::Vector3> livePositions;
+    for (size_t index = 0; index < queryPositions.size(); index++)
+    {
+        if (!m_bakedTileCache.GetSurfaceWeights(bakeSettings, queryPositions[index], outSurfaceWeightsList[index]))
+        {
+            liveIndices.push_back(index);
+            livePositions.push_back(queryPositions[index]);
+        }
+    }
+
+    if (livePositions.empty())
+    {
+        return;
+    }
+
+    AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> liveSurfaceWeightsList(livePositions.size());
+    MakeBulkQueries(livePositions, outPositions, {}, liveSurfaceWeightsList, callback);
+    for (size_t liveIndex = 0; liveIndex < liveIndices.size(); liveIndex++)
+    {
+        outSurfaceWeightsList[liveIndices[liveIndex]] = liveSurfaceWeightsList[liveIndex];
+    }
 }
 
 void TerrainSystem::GetOrderedSurfaceWeights(
@@ -1354,6 +1494,11 @@ void TerrainSystem::GetOrderedSurfaceWeights(
         break;
     }
 
+    if (m_bakedTileCache.GetSurfaceWeights(GetCurrentBakeSettings(), inPosition, outSurfaceWeights))
+    {
+        return;
+    }
+
     AZ::Aabb bounds;
     AZ::EntityId bestAreaId = FindBestAreaEntityAtPosition(inPosition, bounds);
 
@@ -1767,6 +1912,9 @@ void TerrainSystem::RefreshRegion(
 
     m_dirtyRegion.AddAabb(dirtyRegion);
 
+    // Baked tiles in the region no longer match the live terrain.
+    m_bakedTileCache.MarkDirty(dirtyRegion);
+
     // Keep track of which types of data have changed so that we can send out the appropriate notifications later.
 
     m_terrainHeightDirty = m_terrainHeightDirty || ((changeMask & Terrain::HeightData) == Terrain::HeightData);
@@ -1845,3 +1993,156 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
     }
 
 }
+
+TerrainBakedTileCache::BakeSettings TerrainSystem::GetCurrentBakeSettings() const
+{
+    TerrainBakedTileCache::BakeSettings settings;
+    settings.m_heightQueryResolution = m_currentSettings.m_heightQueryResolution;
+    settings.m_surfaceDataQueryResolution = m_currentSettings.m_surfaceDataQueryResolution;
+    settings.m_heightRange = m_currentSettings.m_heightRange;
+    return settings;
+}
+
+bool TerrainSystem::BakeTile(
+    const TerrainBakedTileCache::BakeSettings& settings, int32_t tileX, int32_t tileY, TerrainBakedTile& tile) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+    const int32_t samplesPerTile = aznumeric_cast<int32_t>(TerrainBakedTileCache::HeightSamplesPerTile);
+    const float heightQueryResolution = settings.m_heightQueryResolution;
+
+    // Heights are baked at every point of the height query grid inside the tile.
+    AZStd::vector<AZ::Vector3> positions;
+    positions.reserve(samplesPerTile * samplesPerTile);
+    for (int32_t y = 0; y < samplesPerTile; ++y)
+    {
+        for (int32_t x = 0; x < samplesPerTile; ++x)
+        {
+            positions.emplace_back(
+                (tileX * samplesPerTile + x) * heightQueryResolution, (tileY * samplesPerTile + y) * heightQueryResolution, 0.0f);
+        }
+    }
+
+    AZStd::vector<float> heights(positions.size());
+    AZStd::vector<bool> terrainExists(positions.size());
+    GetHeightsSynchronous(positions, Sampler::EXACT, heights, terrainExists);
+
+    tile.m_heights.resize(positions.size());
+    for (size_t index = 0; index < positions.size(); ++index)
+    {
+        tile.m_heights[index] =
+            terrainExists[index] ? TerrainBakedTileCache::QuantizeHeight(heights[index], settings.m_heightRange) : TerrainBakedTile::NoTerrain;
+    }
+
+    // Surface weights are baked at every point of the surface data query grid inside the tile.
+    const AZ::Aabb tileBounds = TerrainBakedTileCache::GetTileBounds(settings, tileX, tileY);
+    const float surfaceQueryResolution = settings.m_surfaceDataQueryResolution;
+    tile.m_firstSurfaceX = aznumeric_cast<int32_t>(AZStd::ceil(tileBounds.GetMin().GetX() / surfaceQueryResolution));
+    tile.m_firstSurfaceY = aznumeric_cast<int32_t>(AZStd::ceil(tileBounds.GetMin().GetY() / surfaceQueryResolution));
+    tile.m_surfaceCountX = aznumeric_cast<uint32_t>(
+        aznumeric_cast<int32_t>(AZStd::ceil(tileBounds.GetMax().GetX() / surfaceQueryResolution)) - tile.m_firstSurfaceX);
+    tile.m_surfaceCountY = aznumeric_cast<uint32_t>(
+        aznumeric_cast<int32_t>(AZStd::ceil(tileBounds.GetMax().GetY() / surfaceQueryResolution)) - tile.m_firstSurfaceY);
+    tile.m_surfaces.resize(static_cast<size_t>(tile.m_surfaceCountX) * tile.m_surfaceCountY);
+    if (tile.m_surfaces.empty())
+    {
+        return true;
+    }
+
+    positions.clear();
+    for (uint32_t y = 0; y < tile.m_surfaceCountY; ++y)
+    {
+        for (uint32_t x = 0; x < tile.m_surfaceCountX; ++x)
+        {
+            positions.emplace_back(
+                (tile.m_firstSurfaceX + aznumeric_cast<int32_t>(x)) * surfaceQueryResolution,
+                (tile.m_firstSurfaceY + aznumeric_cast<int32_t>(y)) * surfaceQueryResolution, 0.0f);
+        }
+    }
+
+    AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeightsList(positions.size());
+    GetOrderedSurfaceWeightsFromList(positions, Sampler::EXACT, surfaceWeightsList, {});
+
+    for (size_t index = 0; index < surfaceWeightsList.size(); ++index)
+    {
+        TerrainBakedTile::SurfaceSample& sample = tile.m_surfaces[index];
+        const auto& surfaceWeights = surfaceWeightsList[index];
+        for (size_t weightIndex = 0; weightIndex < AZStd::min(surfaceWeights.size(), TerrainBakedTile::MaxSurfaceWeights); ++weightIndex)
+        {
+            const uint8_t weight = aznumeric_cast<uint8_t>(AZStd::round(AZ::GetClamp(surfaceWeights[weightIndex].m_weight, 0.0f, 1.0f) * 255.0f));
+            if (weight == 0)
+            {
+                break;
+            }
+
+            auto tagEntry = AZStd::find(tile.m_surfaceTags.begin(), tile.m_surfaceTags.end(), surfaceWeights[weightIndex].m_surfaceType);
+            if (tagEntry == tile.m_surfaceTags.end())
+            {
+                if (tile.m_surfaceTags.size() >= AZStd::numeric_limits<uint8_t>::max())
+                {
+                    AZ_Error("Terrain", false, "Terrain tile (%d, %d) uses too many surface types to bake.", tileX, tileY);
+                    return false;
+                }
+                tagEntry = tile.m_surfaceTags.insert(tile.m_surfaceTags.end(), surfaceWeights[weightIndex].m_surfaceType);
+            }
+
+            sample.m_tagIndices[weightIndex] = aznumeric_cast<uint8_t>(AZStd::distance(tile.m_surfaceTags.begin(), tagEntry));
+            sample.m_weights[weightIndex] = weight;
+        }
+    }
+
+    return true;
+}
+
+bool TerrainSystem::BakeTerrainTiles(AZStd::string_view path)
+{
+    AZ_PROFILE_FUNCTION(Terrain);
+
+    const AZ::Aabb terrainBounds = GetTerrainAabb();
+    if (!terrainBounds.IsValid())
+    {
+        AZ_Error("Terrain", false, "There is no terrain to bake.");
+        return false;
+    }
+
+    // The bake has to evaluate the live terrain, so stop answering queries from a previous bake.
+    m_bakedTileCache.Unload();
+
+    const TerrainBakedTileCache::BakeSettings settings = TerrainBakedTileCache::CreateBakeSettings(
+        terrainBounds, m_currentSettings.m_heightQueryResolution, m_currentSettings.m_surfaceDataQueryResolution,
+        m_currentSettings.m_heightRange);
+
+    auto bakeTile = [this, &settings](int32_t tileX, int32_t tileY, TerrainBakedTile& tile)
+    {
+        return BakeTile(settings, tileX, tileY, tile);
+    };
+
+    return TerrainBakedTileCache::WriteBakedTiles(AZ::IO::PathView(path), settings, bakeTile) && LoadBakedTerrainTiles(path);
+}
+
+bool TerrainSystem::LoadBakedTerrainTiles(AZStd::string_view path)
+{
+    if (!m_bakedTileCache.Load(AZ::IO::PathView(path)))
+    {
+        return false;
+    }
+
+    // Queries now return the quantized baked data, so let listeners refresh their terrain data on the next tick.
+    m_dirtyRegion.AddAabb(GetTerrainAabb());
+    m_terrainHeightDirty = true;
+    m_terrainSurfacesDirty = true;
+    return true;
+}
+
+void TerrainSystem::UnloadBakedTerrainTiles()
+{
+    if (!m_bakedTileCache.IsLoaded())
+    {
+        return;
+    }
+
+    m_bakedTileCache.Unload();
+    m_dirtyRegion.AddAabb(GetTerrainAabb());
+    m_terrainHeightDirty = true;
+    m_terrainSurfacesDirty = true;
+}
@@ -25,6 +25,7 @@
 
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <TerrainRaycast/TerrainRaycastContext.h>
+#include <TerrainSystem/TerrainBakedTileCache.h>
 #include <TerrainSystem/TerrainSystemBus.h>
 
 AZ_DECLARE_BUDGET(Terrain);
@@ -56,6 +57,9 @@ namespace Terrain
             AZ::EntityId areaId, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask) override;
         void RefreshRegion(
             const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask) override;
+        bool BakeTerrainTiles(AZStd::string_view path) override;
+        bool LoadBakedTerrainTiles(AZStd::string_view path) override;
+        void UnloadBakedTerrainTiles() override;
 
         ///////////////////////////////////////////
         // TerrainDataRequestBus::Handler Impl
@@ -233,6 +237,8 @@ namespace Terrain
             bool* terrainExistsPtr) const;
         float GetHeightSynchronous(float x, float y, Sampler sampler, bool* terrainExistsPtr) const;
         float GetTerrainAreaHeight(float x, float y, bool& terrainExists) const;
+        //! Sets the Z of up to four positions to the terrain height, from the baked tiles where possible.
+        void GetTerrainAreaHeights(AZStd::span<AZ::Vector3> positions, AZStd::span<bool> terrainExists) const;
         AZ::Vector3 GetNormalSynchronous(const AZ::Vector3& position, Sampler sampler, bool* terrainExistsPtr) const;
 
         typedef AZStd::function<void(
@@ -286,6 +292,12 @@ namespace Terrain
         void RecalculateCachedBounds();
         AZ::Aabb ClampZBoundsToHeightBounds(const AZ::Aabb& aabb) const;
 
+        //! Returns the current settings in the form used to check that baked tiles are compatible with them.
+        TerrainBakedTileCache::BakeSettings GetCurrentBakeSettings() const;
+
+        //! Fills in the heights and surface weights of one baked tile from live terrain queries.
+        bool BakeTile(const TerrainBakedTileCache::BakeSettings& settings, int32_t tileX, int32_t tileY, TerrainBakedTile& tile) const;
+
         struct TerrainSystemSettings
         {
             AzFramework::Terrain::FloatRange m_heightRange;
@@ -314,6 +326,7 @@ namespace Terrain
         AZStd::map<AZ::EntityId, TerrainAreaData, TerrainLayerPriorityComparator> m_registeredAreas;
 
         mutable TerrainRaycastContext m_terrainRaycastContext;
+        TerrainBakedTileCache m_bakedTileCache;
 
         AZ::JobManager* m_terrainJobManager = nullptr;
         mutable AZStd::mutex m_activeTerrainJobContextMutex;
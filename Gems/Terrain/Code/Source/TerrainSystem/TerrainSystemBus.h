@@ -13,6 +13,7 @@
 #include <AzCore/std/containers/span.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string_view.h>
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/EBus/EBusSharedDispatchTraits.h>
@@ -48,6 +49,12 @@ namespace Terrain
         virtual void RefreshArea(AZ::EntityId areaId, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask) = 0;
         virtual void RefreshRegion(
             const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask) = 0;
+
+        // Bake the current terrain heights and surface weights into a file of streamable tiles, and start using it for queries.
+        virtual bool BakeTerrainTiles(AZStd::string_view path) = 0;
+        // Use a previously baked tile file for the queries that it can answer, the rest are evaluated live.
+        virtual bool LoadBakedTerrainTiles(AZStd::string_view path) = 0;
+        virtual void UnloadBakedTerrainTiles() = 0;
     };
 
     using TerrainSystemServiceRequestBus = AZ::EBus<TerrainSystemServiceRequests>;
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/Streamer/StreamerComponent.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzTest/Utils.h>
+#include <gmock/gmock.h>
+
+#include <TerrainSystem/TerrainBakedTileCache.h>
+
+namespace UnitTest
+{
+    class TerrainBakedTileCacheTests
+        : public testing::Test
+    {
+    protected:
+        static constexpr float HeightQueryResolution = 1.0f;
+        static constexpr float SurfaceQueryResolution = 2.0f;
+        const AzFramework::Terrain::FloatRange m_heightRange = { 0.0f, 256.0f };
+
+        static float GetTestHeight(int32_t x, int32_t y)
+        {
+            return x * 0.5f + y * 0.25f;
+        }
+
+        static bool BakeTestTile(
+            const Terrain::TerrainBakedTileCache::BakeSettings& settings, int32_t tileX, int32_t tileY, Terrain::TerrainBakedTile& tile)
+        {
+            const int32_t samplesPerTile = aznumeric_cast<int32_t>(Terrain::TerrainBakedTileCache::HeightSamplesPerTile);
+            for (int32_t y = 0; y < samplesPerTile; ++y)
+            {
+                for (int32_t x = 0; x < samplesPerTile; ++x)
+                {
+                    const int32_t gridX = tileX * samplesPerTile + x;
+                    const int32_t gridY = tileY * samplesPerTile + y;
+
+                    // Leave a hole at a known position.
+                    tile.m_heights.push_back(
+                        (gridX == 3 && gridY == 3) ? Terrain::TerrainBakedTile::NoTerrain
+                                                   : Terrain::TerrainBakedTileCache::QuantizeHeight(GetTestHeight(gridX, gridY), settings.m_heightRange));
+                }
+            }
+
+            // A single surface with full weight covers every surface data point.
+            const int32_t surfacesPerTile = samplesPerTile / aznumeric_cast<int32_t>(SurfaceQueryResolution);
+            tile.m_firstSurfaceX = tileX * surfacesPerTile;
+            tile.m_firstSurfaceY = tileY * surfacesPerTile;
+            tile.m_surfaceCountX = aznumeric_cast<uint32_t>(surfacesPerTile);
+            tile.m_surfaceCountY = aznumeric_cast<uint32_t>(surfacesPerTile);
+            tile.m_surfaceTags.push_back(AZ::Crc32("test_surface"));
+            tile.m_surfaces.resize(surfacesPerTile * surfacesPerTile);
+            for (auto& surface : tile.m_surfaces)
+            {
+                surface.m_tagIndices[0] = 0;
+                surface.m_weights[0] = 255;
+            }
+            return true;
+        }
+
+        Terrain::TerrainBakedTileCache::BakeSettings WriteTestBake(
+            const AZ::IO::Path& path, const Terrain::TerrainBakedTileCache::BakeTileCallback& bakeTileOverride = {})
+        {
+            const auto settings = Terrain::TerrainBakedTileCache::CreateBakeSettings(
+                AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f, 0.0f, m_heightRange.m_min), AZ::Vector3(100.0f, 50.0f, m_heightRange.m_max)),
+                HeightQueryResolution, SurfaceQueryResolution, m_heightRange);
+
+            auto bakeTile = [&settings](int32_t tileX, int32_t tileY, Terrain::TerrainBakedTile& tile)
+            {
+                return BakeTestTile(settings, tileX, tileY, tile);
+            };
+            EXPECT_TRUE(Terrain::TerrainBakedTileCache::WriteBakedTiles(path, settings, bakeTileOverride ? bakeTileOverride : bakeTile));
+            return settings;
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+    };
+
+    TEST_F(TerrainBakedTileCacheTests, BakeSettingsCoverWorldBounds)
+    {
+        const auto settings = Terrain::TerrainBakedTileCache::CreateBakeSettings(
+            AZ::Aabb::CreateFromMinMax(AZ::Vector3(-10.0f, 0.0f, 0.0f), AZ::Vector3(100.0f, 50.0f, 0.0f)),
+            HeightQueryResolution, SurfaceQueryResolution, m_heightRange);
+
+        EXPECT_EQ(settings.m_firstTileX, -1);
+        EXPECT_EQ(settings.m_firstTileY, 0);
+        EXPECT_EQ(settings.m_tileCountX, 3);
+        EXPECT_EQ(settings.m_tileCountY, 1);
+    }
+
+    TEST_F(TerrainBakedTileCacheTests, BakedHeightsAndSurfacesRoundTrip)
+    {
+        const AZ::IO::Path path = m_tempDirectory.Resolve("terrain.bakedtiles");
+        const auto settings = WriteTestBake(path);
+
+        Terrain::TerrainBakedTileCache cache;
+        ASSERT_TRUE(cache.Load(path));
+
+        // Positions on the height grid in both tiles are answered from the bake, as well as the hole.
+        // Positions that aren't on the height grid are left for live evaluation.
+        AZStd::vector<AZ::Vector3> positions = { AZ::Vector3(10.0f, 20.0f, 0.0f), AZ::Vector3(70.0f, 5.0f, 0.0f),
+                                                 AZ::Vector3(3.0f, 3.0f, 0.0f), AZ::Vector3(10.5f, 20.0f, 0.0f) };
+        AZStd::vector<bool> terrainExists(positions.size(), false);
+        AZStd::vector<bool> resolved(positions.size(), false);
+        EXPECT_EQ(cache.GetHeights(settings, positions, terrainExists, resolved), 3);
+
+        const float tolerance = (m_heightRange.m_max - m_heightRange.m_min) / Terrain::TerrainBakedTile::MaxQuantizedHeight;
+        EXPECT_TRUE(resolved[0] && terrainExists[0]);
+        EXPECT_NEAR(positions[0].GetZ(), GetTestHeight(10, 20), tolerance);
+        EXPECT_TRUE(resolved[1] && terrainExists[1]);
+        EXPECT_NEAR(positions[1].GetZ(), GetTestHeight(70, 5), tolerance);
+        EXPECT_TRUE(resolved[2]);
+        EXPECT_FALSE(terrainExists[2]);
+        EXPECT_FALSE(resolved[3]);
+
+        AzFramework::SurfaceData::SurfaceTagWeightList surfaceWeights;
+        EXPECT_TRUE(cache.GetSurfaceWeights(settings, AZ::Vector3(70.0f, 4.0f, 0.0f), surfaceWeights));
+        ASSERT_EQ(surfaceWeights.size(), 1);
+        EXPECT_EQ(surfaceWeights[0].m_surfaceType, AZ::Crc32("test_surface"));
+        EXPECT_FLOAT_EQ(surfaceWeights[0].m_weight, 1.0f);
+
+        // Odd coordinates aren't on the surface data grid.
+        EXPECT_FALSE(cache.GetSurfaceWeights(settings, AZ::Vector3(71.0f, 4.0f, 0.0f), surfaceWeights));
+    }
+
+    TEST_F(TerrainBakedTileCacheTests, DirtyAndIncompatibleLookupsMiss)
+    {
+        const AZ::IO::Path path = m_tempDirectory.Resolve("terrain.bakedtiles");
+        auto settings = WriteTestBake(path);
+
+        Terrain::TerrainBakedTileCache cache;
+        ASSERT_TRUE(cache.Load(path));
+
+        AZStd::vector<AZ::Vector3> positions = { AZ::Vector3(10.0f, 20.0f, 0.0f), AZ::Vector3(70.0f, 5.0f, 0.0f) };
+        AZStd::vector<bool> terrainExists(positions.size(), false);
+        AZStd::vector<bool> resolved(positions.size(), false);
+
+        // Refreshing the first tile only invalidates the lookups inside of it.
+        cache.MarkDirty(AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f, 0.0f, 0.0f), AZ::Vector3(32.0f, 32.0f, 0.0f)));
+        EXPECT_EQ(cache.GetHeights(settings, positions, terrainExists, resolved), 1);
+        EXPECT_FALSE(resolved[0]);
+        EXPECT_TRUE(resolved[1]);
+
+        // Baked data isn't used once the terrain settings no longer match the bake.
+        settings.m_heightQueryResolution = 0.5f;
+        AZStd::fill(resolved.begin(), resolved.end(), false);
+        EXPECT_EQ(cache.GetHeights(settings, positions, terrainExists, resolved), 0);
+
+        cache.Unload();
+        EXPECT_FALSE(cache.IsLoaded());
+    }
+
+    TEST_F(TerrainBakedTileCacheTests, OversizedSurfaceGridIsRejected)
+    {
+        const AZ::IO::Path path = m_tempDirectory.Resolve("terrain.bakedtiles");
+
+        // The second tile claims a surface grid that is far wider than a tile can cover, which is consistent with its own surface
+        // data so it gets written, but must not be trusted when it's read back.
+        Terrain::TerrainBakedTileCache::BakeSettings settings;
+        auto bakeTile = [this, &settings](int32_t tileX, int32_t tileY, Terrain::TerrainBakedTile& tile)
+        {
+            BakeTestTile(settings, tileX, tileY, tile);
+            if (tileX == 1)
+            {
+                tile.m_surfaceCountX = 4096;
+                tile.m_surfaceCountY = 1;
+                tile.m_surfaces.resize(tile.m_surfaceCountX);
+            }
+            return true;
+        };
+        settings = WriteTestBake(path, bakeTile);
+
+        Terrain::TerrainBakedTileCache cache;
+        ASSERT_TRUE(cache.Load(path));
+
+        AzFramework::SurfaceData::SurfaceTagWeightList surfaceWeights;
+        EXPECT_TRUE(cache.GetSurfaceWeights(settings, AZ::Vector3(4.0f, 4.0f, 0.0f), surfaceWeights));
+        EXPECT_FALSE(cache.GetSurfaceWeights(settings, AZ::Vector3(70.0f, 4.0f, 0.0f), surfaceWeights));
+
+        // The heights of the rejected tile are evaluated live as well.
+        AZStd::vector<AZ::Vector3> positions = { AZ::Vector3(70.0f, 5.0f, 0.0f) };
+        AZStd::vector<bool> terrainExists(positions.size(), false);
+        AZStd::vector<bool> resolved(positions.size(), false);
+        EXPECT_EQ(cache.GetHeights(settings, positions, terrainExists, resolved), 0);
+    }
+
+    TEST_F(TerrainBakedTileCacheTests, InvalidTileCountIsRejectedBeforeAllocating)
+    {
+        const AZ::IO::Path path = m_tempDirectory.Resolve("terrain.bakedtiles");
+        WriteTestBake(path);
+
+        // Overwrite the tile counts that follow the first eight 32 bit values of the header with counts that are far too large
+        // for the file, and beyond any sane bake.
+        constexpr AZ::IO::SystemFile::SeekSizeType TileCountOffset = 8 * sizeof(uint32_t);
+        const AZStd::array<uint32_t, 2> tileCounts = { 0x10000, 0x10000 };
+        {
+            AZ::IO::SystemFile file;
+            ASSERT_TRUE(file.Open(path.c_str(), AZ::IO::SystemFile::SF_OPEN_READ_WRITE));
+            file.Seek(TileCountOffset, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+            ASSERT_EQ(file.Write(tileCounts.data(), sizeof(tileCounts)), sizeof(tileCounts));
+        }
+
+        Terrain::TerrainBakedTileCache cache;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(cache.Load(path));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_FALSE(cache.IsLoaded());
+    }
+
+    TEST_F(TerrainBakedTileCacheTests, StreamedTilesBecomeResidentAfterMiss)
+    {
+        // Use a streamer, so tiles are read in the background instead of on the looking up thread.
+        AZStd::unique_ptr<AZ::IO::Streamer> streamer;
+        if (!AZ::Interface<AZ::IO::IStreamer>::Get())
+        {
+            streamer = AZStd::make_unique<AZ::IO::Streamer>(AZStd::thread_desc{}, AZ::StreamerComponent::CreateStreamerStack());
+            AZ::Interface<AZ::IO::IStreamer>::Register(streamer.get());
+        }
+
+        const AZ::IO::Path path = m_tempDirectory.Resolve("terrain.bakedtiles");
+        const auto settings = WriteTestBake(path);
+
+        {
+            Terrain::TerrainBakedTileCache cache;
+            ASSERT_TRUE(cache.Load(path));
+
+            // The first lookup misses and leaves the position for live evaluation while the tile streams in.
+            AZStd::vector<AZ::Vector3> positions = { AZ::Vector3(10.0f, 20.0f, 0.0f) };
+            AZStd::vector<bool> terrainExists(positions.size(), false);
+            AZStd::vector<bool> resolved(positions.size(), false);
+            EXPECT_EQ(cache.GetHeights(settings, positions, terrainExists, resolved), 0);
+            EXPECT_FALSE(resolved[0]);
+
+            // Lookups keep missing without queuing the tile again until the read completes.
+            constexpr int MaxAttempts = 5000;
+            for (int attempt = 0; (attempt < MaxAttempts) && !resolved[0]; ++attempt)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+                cache.GetHeights(settings, positions, terrainExists, resolved);
+            }
+
+            const float tolerance = (m_heightRange.m_max - m_heightRange.m_min) / Terrain::TerrainBakedTile::MaxQuantizedHeight;
+            ASSERT_TRUE(resolved[0]);
+            EXPECT_TRUE(terrainExists[0]);
+            EXPECT_NEAR(positions[0].GetZ(), GetTestHeight(10, 20), tolerance);
+
+            // Surface weights in the streamed tile are resident as well.
+            AzFramework::SurfaceData::SurfaceTagWeightList surfaceWeights;
+            EXPECT_TRUE(cache.GetSurfaceWeights(settings, AZ::Vector3(4.0f, 4.0f, 0.0f), surfaceWeights));
+        }
+
+        if (streamer)
+        {
+            AZ::Interface<AZ::IO::IStreamer>::Unregister(streamer.get());
+        }
+    }
+} // namespace UnitTest
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+
+#include <TerrainRenderer/TerrainMacroMaterialManager.h>
+#include <TerrainTestFixtures.h>
+
+namespace UnitTest
+{
+    class TerrainMacroMaterialManagerTest
+        : public TerrainTestFixture
+    {
+    protected:
+        // Large enough that a jump across the world rebuilds regions with more tiles than a single job handles.
+        static constexpr float RenderDistance = 8192.0f;
+        static constexpr int32_t MaterialCount = 8;
+
+        static void MoveTo(Terrain::TerrainMacroMaterialManager& manager, const AZ::Vector2& position)
+        {
+            manager.UpdateTileMaterials(position);
+        }
+
+        // Overlapping materials with mixed priorities, so some tiles have more materials than they can hold.
+        static void AddTestMaterials(Terrain::TerrainMacroMaterialManager& manager, const AZ::Vector2& center)
+        {
+            for (int32_t index = 0; index < MaterialCount; ++index)
+            {
+                const float offset = index * 700.0f;
+
+                Terrain::MacroMaterialData material;
+                material.m_entityId = AZ::EntityId(index + 1);
+                material.m_bounds = AZ::Aabb::CreateFromMinMax(
+                    AZ::Vector3(center.GetX() - 4000.0f + offset, center.GetY() - 3000.0f + offset * 0.5f, 0.0f),
+                    AZ::Vector3(center.GetX() + 1000.0f + offset, center.GetY() + 2000.0f + offset * 0.5f, 0.0f));
+                material.m_priority = index % 3;
+                manager.OnTerrainMacroMaterialCreated(material.m_entityId, material);
+            }
+        }
+
+        static size_t GetTileCount(const Terrain::TerrainMacroMaterialManager& manager)
+        {
+            return manager.m_materialRefGridShaderData.size();
+        }
+
+        static size_t GetTilesWithMaterialsCount(const Terrain::TerrainMacroMaterialManager& manager)
+        {
+            return AZStd::count_if(manager.m_materialRefGridShaderData.begin(), manager.m_materialRefGridShaderData.end(),
+                [](const Terrain::TerrainMacroMaterialManager::TileMaterials& tile)
+                {
+                    return !(tile == Terrain::TerrainMacroMaterialManager::DefaultTileMaterials);
+                });
+        }
+
+        static void ExpectSameTiles(const Terrain::TerrainMacroMaterialManager& manager, const Terrain::TerrainMacroMaterialManager& expected)
+        {
+            ASSERT_EQ(manager.m_materialRefGridShaderData.size(), expected.m_materialRefGridShaderData.size());
+            for (size_t tileIndex = 0; tileIndex < manager.m_materialRefGridShaderData.size(); ++tileIndex)
+            {
+                EXPECT_TRUE(manager.m_materialRefGridShaderData[tileIndex] == expected.m_materialRefGridShaderData[tileIndex])
+                    << "Tile " << tileIndex << " differs from a grid built at the same position.";
+            }
+        }
+
+        static constexpr int32_t GetTilesPerJob()
+        {
+            return Terrain::TerrainMacroMaterialManager::MacroMaterialTilesPerJob;
+        }
+
+        // Moves a grid with the test materials from the origin to the destination, and compares it to a grid built at the destination.
+        static void TestMoveMatchesRebuild(const AZ::Vector2& destination)
+        {
+            Terrain::TerrainMacroMaterialManager movedManager;
+            movedManager.SetRenderDistance(RenderDistance);
+            MoveTo(movedManager, AZ::Vector2::CreateZero());
+            AddTestMaterials(movedManager, destination);
+            MoveTo(movedManager, destination);
+
+            Terrain::TerrainMacroMaterialManager expectedManager;
+            expectedManager.SetRenderDistance(RenderDistance);
+            MoveTo(expectedManager, destination);
+            AddTestMaterials(expectedManager, destination);
+
+            EXPECT_GT(GetTilesWithMaterialsCount(expectedManager), size_t(0));
+            ExpectSameTiles(movedManager, expectedManager);
+        }
+    };
+
+    TEST_F(TerrainMacroMaterialManagerTest, MovingOneTileRebuildsTilesInline)
+    {
+        TestMoveMatchesRebuild(AZ::Vector2(64.0f, 0.0f));
+    }
+
+    TEST_F(TerrainMacroMaterialManagerTest, MovingDiagonallyRebuildsTilesInline)
+    {
+        TestMoveMatchesRebuild(AZ::Vector2(-128.0f, 192.0f));
+    }
+
+    TEST_F(TerrainMacroMaterialManagerTest, JumpingAcrossTheWorldRebuildsTilesOnJobs)
+    {
+        Terrain::TerrainMacroMaterialManager manager;
+        manager.SetRenderDistance(RenderDistance);
+        MoveTo(manager, AZ::Vector2::CreateZero());
+
+        // The whole grid is rebuilt, which is split across jobs.
+        ASSERT_GT(GetTileCount(manager), size_t(4 * GetTilesPerJob()));
+
+        TestMoveMatchesRebuild(AZ::Vector2(100000.0f, -50000.0f));
+    }
+
+    TEST_F(TerrainMacroMaterialManagerTest, JumpingBackAndForthKeepsTilesConsistent)
+    {
+        const AZ::Vector2 destination(100000.0f, 0.0f);
+
+        Terrain::TerrainMacroMaterialManager movedManager;
+        movedManager.SetRenderDistance(RenderDistance);
+        MoveTo(movedManager, destination);
+        AddTestMaterials(movedManager, destination);
+        MoveTo(movedManager, AZ::Vector2::CreateZero());
+        MoveTo(movedManager, destination);
+
+        Terrain::TerrainMacroMaterialManager expectedManager;
+        expectedManager.SetRenderDistance(RenderDistance);
+        MoveTo(expectedManager, destination);
+        AddTestMaterials(expectedManager, destination);
+
+        ExpectSameTiles(movedManager, expectedManager);
+    }
+}
@@ -1481,6 +1481,104 @@ namespace UnitTest
         EXPECT_EQ(numFailures, 0);
     }
 
+    TEST_F(TerrainSystemTest, TerrainGetClosestIntersectionOnSlopedTerrain)
+    {
+        // Create a Terrain Spawner with a box from (-200, -200, -20) to (200, 200, 20) that returns a plane sloping along X.
+        // The terrain triangles exactly match the plane regardless of the query resolution, so every intersection can be
+        // compared against the analytic ray/plane intersection. Rays spanning multiple cached height chunks and passing
+        // above parts of the terrain make sure that the height range culling never skips the grid square with the hit.
+        constexpr float Slope = 0.1f;
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-200.0f, -200.0f, -20.0f, 200.0f, 200.0f, 20.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(position.GetX() * Slope);
+                terrainExists = true;
+            });
+
+        constexpr unsigned int Seed = 1;
+        std::mt19937_64 rng(Seed);
+        std::uniform_real_distribution<float> unif(-100.0f, 100.0f);
+
+        int32_t numFailures = 0;
+
+        for (float queryResolution : { 0.25f, 1.0f, 3.0f })
+        {
+            auto terrainSystem = CreateAndActivateTerrainSystem(queryResolution);
+
+            constexpr uint32_t NumRays = 100;
+            for (uint32_t test = 0; test < NumRays; test++)
+            {
+                // The terrain height is between -10 and 10 in the -100 to 100 XY range, so a start Z above 10 and an end Z
+                // below -10 guarantees an intersection for every ray.
+                AzFramework::RenderGeometry::RayRequest ray;
+                ray.m_startWorldPosition = AZ::Vector3(unif(rng), unif(rng), abs(unif(rng)) + 11.0f);
+                ray.m_endWorldPosition = AZ::Vector3(unif(rng), unif(rng), -abs(unif(rng)) - 11.0f);
+
+                const AZ::Vector3 direction = ray.m_endWorldPosition - ray.m_startWorldPosition;
+                const float t = (Slope * ray.m_startWorldPosition.GetX() - ray.m_startWorldPosition.GetZ()) /
+                    (direction.GetZ() - Slope * direction.GetX());
+                const AZ::Vector3 expectedPosition = ray.m_startWorldPosition + direction * t;
+
+                auto result = terrainSystem->GetClosestIntersection(ray);
+
+                EXPECT_TRUE(result);
+                EXPECT_THAT(result.m_worldPosition, IsCloseTolerance(expectedPosition, 0.01f));
+
+                numFailures += (result ? 0 : 1);
+            }
+
+            // A ray that stays above the terrain doesn't intersect it.
+            AzFramework::RenderGeometry::RayRequest ray;
+            ray.m_startWorldPosition = AZ::Vector3(-100.0f, -100.0f, 21.0f);
+            ray.m_endWorldPosition = AZ::Vector3(100.0f, 100.0f, 21.0f);
+            EXPECT_FALSE(terrainSystem->GetClosestIntersection(ray));
+        }
+
+        EXPECT_EQ(numFailures, 0);
+    }
+
+    TEST_F(TerrainSystemTest, TerrainGetClosestIntersectionIgnoresChunksInvalidatedWhileBuilding)
+    {
+        // Create a Terrain Spawner with a flat terrain whose height can be changed by the test. The first height query notifies
+        // a height change, like an edit that lands while a raycast is building its height chunk from the old terrain data.
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-200.0f, -200.0f, 0.0f, 200.0f, 200.0f, 50.0f);
+        AZStd::atomic<float> terrainHeight{ 5.0f };
+        AZStd::atomic_bool notifyChangeOnNextQuery{ false };
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [&terrainHeight, &notifyChangeOnNextQuery, spawnerBox](AZ::Vector3& position, bool& terrainExists)
+            {
+                if (notifyChangeOnNextQuery.exchange(false))
+                {
+                    AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
+                        &AzFramework::Terrain::TerrainDataNotificationBus::Events::OnTerrainDataChanged, spawnerBox,
+                        AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData);
+                }
+                position.SetZ(terrainHeight);
+                terrainExists = true;
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+
+        AzFramework::RenderGeometry::RayRequest ray;
+        ray.m_startWorldPosition = AZ::Vector3(10.0f, 10.0f, 40.0f);
+        ray.m_endWorldPosition = AZ::Vector3(10.0f, 10.0f, -10.0f);
+
+        // The first ray builds its chunk from the terrain data at the time of the query.
+        notifyChangeOnNextQuery = true;
+        auto result = terrainSystem->GetClosestIntersection(ray);
+        EXPECT_TRUE(result);
+        EXPECT_NEAR(result.m_worldPosition.GetZ(), 5.0f, 0.01f);
+
+        // The change that was notified during the build becomes visible, and the next ray must not reuse the chunk built before it.
+        terrainHeight = 10.0f;
+        result = terrainSystem->GetClosestIntersection(ray);
+        EXPECT_TRUE(result);
+        EXPECT_NEAR(result.m_worldPosition.GetZ(), 10.0f, 0.01f);
+    }
+
     TEST_F(TerrainSystemTest, TerrainProcessAsyncCancellation)
     {
         // Tests cancellation of the asynchronous terrain API.
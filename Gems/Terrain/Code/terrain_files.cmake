@@ -58,6 +58,8 @@ set(FILES
     Source/TerrainRenderer/TerrainMacroMaterialBus.h
     Source/TerrainRenderer/Vector2i.cpp
     Source/TerrainRenderer/Vector2i.h
+    Source/TerrainSystem/TerrainBakedTileCache.cpp
+    Source/TerrainSystem/TerrainBakedTileCache.h
     Source/TerrainSystem/TerrainSystem.cpp
     Source/TerrainSystem/TerrainSystem.h
     Source/TerrainSystem/TerrainSystemBus.h
@@ -10,8 +10,10 @@ set(FILES
     Tests/ClipmapBoundsTests.cpp
     Tests/LayerSpawnerTests.cpp
     Tests/MockAxisAlignedBoxShapeComponent.h
+    Tests/TerrainBakedTileCacheTests.cpp
     Tests/TerrainBulkQueryTests.cpp
     Tests/TerrainHeightGradientListTests.cpp
+    Tests/TerrainMacroMaterialManagerTests.cpp
     Tests/TerrainMacroMaterialTests.cpp
     Tests/SurfaceMaterialsListTest.cpp
     Tests/TerrainPhysicsColliderTests.cpp
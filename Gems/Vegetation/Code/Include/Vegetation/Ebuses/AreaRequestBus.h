@@ -11,6 +11,7 @@
 #include <AzCore/Component/ComponentBus.h>
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 #include <Vegetation/InstanceData.h>
 
@@ -91,6 +92,17 @@ namespace Vegetation
         */
         virtual void UnclaimPosition(const ClaimHandle handle) = 0;
 
+        /**
+        * Reverses a batch of previous 'vegetation location operations', areas that own instances should override this
+        * to release them in bulk
+        */
+        virtual void UnclaimPositions(AZStd::span<const ClaimHandle> handles)
+        {
+            for (const ClaimHandle handle : handles)
+            {
+                UnclaimPosition(handle);
+            }
+        }
     };
 
     typedef AZ::EBus<AreaRequests> AreaRequestBus;
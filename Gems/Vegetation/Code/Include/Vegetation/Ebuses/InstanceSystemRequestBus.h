@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/std/containers/span.h>
 #include <Vegetation/Descriptor.h>
 
 namespace Vegetation
@@ -39,6 +40,16 @@ namespace Vegetation
 
         // destroy vegetation instance by id
         virtual void DestroyInstance(InstanceId instanceId) = 0;
+
+        // destroy a batch of vegetation instances by id, handlers that can queue the batch at once should override this
+        virtual void DestroyInstances(AZStd::span<const InstanceId> instanceIds)
+        {
+            for (const InstanceId instanceId : instanceIds)
+            {
+                DestroyInstance(instanceId);
+            }
+        }
+
         virtual void DestroyAllInstances() = 0;
 
         virtual void Cleanup() = 0;
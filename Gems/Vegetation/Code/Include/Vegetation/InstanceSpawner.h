@@ -9,6 +9,7 @@
 
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/RTTI/ReflectContext.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Memory/SystemAllocator.h>
@@ -84,6 +85,13 @@ namespace Vegetation
         //! Destroy a single instance.
         virtual void DestroyInstance(InstanceId id, InstancePtr instance) = 0;
 
+        //! Create a batch of instances, writing the created instance for each entry of instanceData into outInstances.
+        //! Spawners that can share work between instances should override this, the default creates them one at a time.
+        virtual void CreateInstances(AZStd::span<const InstanceData> instanceData, AZStd::span<InstancePtr> outInstances);
+
+        //! Destroy a batch of instances created by this spawner.
+        virtual void DestroyInstances(AZStd::span<const InstanceId> ids, AZStd::span<const InstancePtr> instances);
+
         //! Check for data equivalency.  Subclasses are expected to implement this.
         bool operator==(const InstanceSpawner& rhs) const { return DataIsEquivalent(rhs); };
 
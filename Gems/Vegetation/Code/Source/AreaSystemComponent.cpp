@@ -18,12 +18,17 @@
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/utils.h>
 #include <AzCore/Component/TransformBus.h>
@@ -37,6 +42,10 @@
 #include <ISystem.h>
 #include <cinttypes>
 
+AZ_CVAR(AZ::u32, veg_sectorPointJobCount, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Maximum number of vegetation sectors whose surface points are generated concurrently on job threads, 1 generates them serially "
+    "on the vegetation thread.");
+
 namespace Vegetation
 {
     namespace AreaSystemUtil
@@ -56,6 +65,26 @@ namespace Vegetation
             }
             return true;
         }
+
+        //! Merges two sector dirty regions, where an invalid region means the entire sector is dirty.
+        static AZ::Aabb MergeDirtyRegions(const AZ::Aabb& lhs, const AZ::Aabb& rhs)
+        {
+            if (!lhs.IsValid() || !rhs.IsValid())
+            {
+                return AZ::Aabb::CreateNull();
+            }
+
+            AZ::Aabb merged(lhs);
+            merged.AddAabb(rhs);
+            return merged;
+        }
+
+        //! Dirty regions come from surface and area bounds, which can have any height, so only XY are compared against points.
+        static bool ContainsXY(const AZ::Aabb& bounds, const AZ::Vector3& position)
+        {
+            return position.GetX() >= bounds.GetMin().GetX() && position.GetX() <= bounds.GetMax().GetX() &&
+                position.GetY() >= bounds.GetMin().GetY() && position.GetY() <= bounds.GetMax().GetY();
+        }
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -97,9 +126,13 @@ namespace Vegetation
 
     //////////////////////////////////////////////////////////////////////////
     // DirtySectors
-    void AreaSystemComponent::DirtySectors::MarkDirty(const SectorId& sector)
+    void AreaSystemComponent::DirtySectors::MarkDirty(const SectorId& sector, const AZ::Aabb& dirtyRegion)
     {
-        m_dirtySet.insert(AZStd::move(sector));
+        auto inserted = m_dirtySet.emplace(sector, dirtyRegion);
+        if (!inserted.second)
+        {
+            inserted.first->second = AreaSystemUtil::MergeDirtyRegions(inserted.first->second, dirtyRegion);
+        }
     }
 
     void AreaSystemComponent::DirtySectors::MarkAllDirty()
@@ -119,6 +152,17 @@ namespace Vegetation
             (!m_dirtySet.empty() && (m_dirtySet.find(sector) != m_dirtySet.end()));
     }
 
+    AZ::Aabb AreaSystemComponent::DirtySectors::GetDirtyRegion(const SectorId& sector) const
+    {
+        if (m_allSectorsDirty)
+        {
+            return AZ::Aabb::CreateNull();
+        }
+
+        auto itSector = m_dirtySet.find(sector);
+        return (itSector != m_dirtySet.end()) ? itSector->second : AZ::Aabb::CreateNull();
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // AreaSystemConfig
 
@@ -1074,14 +1118,13 @@ namespace Vegetation
         return itSector != m_sectorRollingWindow.end() ? &itSector->second : nullptr;
     }
 
-    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode)
+    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::CreateSector(const SectorId& sectorId, int sectorSizeInMeters)
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
         SectorInfo sectorInfo;
         sectorInfo.m_id = sectorId;
         sectorInfo.m_bounds = GetSectorBounds(sectorId, sectorSizeInMeters);
-        UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
 
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
         SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorInfo.m_id] = AZStd::move(sectorInfo);
@@ -1123,13 +1166,19 @@ namespace Vegetation
             SurfaceData::SurfaceTagVector(),
             availablePointsPerPosition);
 
-        uint claimIndex = 0;
-        availablePointsPerPosition.EnumeratePoints([this, &sectorInfo, &claimIndex]
-        ([[maybe_unused]] size_t inPositionIndex, const AZ::Vector3& position,
+        // Claim handles are built from the grid position and the index of the point at that position, so the handles of points
+        // outside of a changed surface region stay the same when the points get rebuilt, and their claims can be kept.
+        size_t lastPositionIndex = AZStd::numeric_limits<size_t>::max();
+        uint32_t pointIndex = 0;
+        availablePointsPerPosition.EnumeratePoints([this, &sectorInfo, &lastPositionIndex, &pointIndex]
+        (size_t inPositionIndex, const AZ::Vector3& position,
             const AZ::Vector3& normal, const SurfaceData::SurfaceTagWeights& masks) -> bool
             {
+                pointIndex = (inPositionIndex == lastPositionIndex) ? pointIndex + 1 : 0;
+                lastPositionIndex = inPositionIndex;
+
                 ClaimPoint& claimPoint = sectorInfo.m_baseContext.m_availablePoints.emplace_back();
-                claimPoint.m_handle = CreateClaimHandle(sectorInfo, ++claimIndex);
+                claimPoint.m_handle = CreateClaimHandle(sectorInfo, aznumeric_cast<uint32_t>(inPositionIndex), pointIndex);
                 claimPoint.m_position = position;
                 claimPoint.m_normal = normal;
                 claimPoint.m_masks = masks;
@@ -1273,7 +1322,7 @@ namespace Vegetation
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
-        AZStd::unordered_map<AZ::EntityId, AZStd::unordered_set<ClaimHandle>> claimsToRelease;
+        AZStd::unordered_map<AZ::EntityId, AZStd::vector<ClaimHandle>> claimsToRelease;
 
         // Group up all the previously-claimed-but-no-longer-claimed points based on area id
         for (const auto& claimPair : sectorInfo.m_claimedWorldPointsBeforeFill)
@@ -1283,7 +1332,7 @@ namespace Vegetation
             const auto& areaId = instanceData.m_id;
             if (sectorInfo.m_claimedWorldPoints.find(handle) == sectorInfo.m_claimedWorldPoints.end())
             {
-                claimsToRelease[areaId].insert(handle);
+                claimsToRelease[areaId].push_back(handle);
             }
         }
         sectorInfo.m_claimedWorldPointsBeforeFill.clear();
@@ -1294,29 +1343,74 @@ namespace Vegetation
             const auto& areaId = claimPair.first;
             const auto& handles = claimPair.second;
             AreaNotificationBus::Event(areaId, &AreaNotificationBus::Events::OnAreaConnect);
-
-            for (const auto& handle : handles)
-            {
-                AreaRequestBus::Event(areaId, &AreaRequestBus::Events::UnclaimPosition, handle);
-            }
-
+            AreaRequestBus::Event(areaId, &AreaRequestBus::Events::UnclaimPositions, handles);
             AreaNotificationBus::Event(areaId, &AreaNotificationBus::Events::OnAreaDisconnect);
         }
     }
 
-    void AreaSystemComponent::VegetationThreadTasks::FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas)
+    void AreaSystemComponent::VegetationThreadTasks::FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas, const AZ::Aabb& dirtyRegion)
     {
         AZ_PROFILE_FUNCTION(Entity);
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillSectorStart, sectorInfo.GetSectorX(), sectorInfo.GetSectorY(), AZStd::chrono::steady_clock::now()));
 
         ReleaseUnregisteredClaims(sectorInfo);
 
-        //m_availablePoints is a free list initialized with the complete set of points in the sector.
-        ClaimContext activeContext = sectorInfo.m_baseContext;
+        ClaimContext activeContext;
 
-        // Clear out the list of claimed world points before we begin
-        sectorInfo.m_claimedWorldPointsBeforeFill = sectorInfo.m_claimedWorldPoints;
-        sectorInfo.m_claimedWorldPoints.clear();
+        const bool partialFill = dirtyRegion.IsValid() &&
+            !(AreaSystemUtil::ContainsXY(dirtyRegion, sectorInfo.m_bounds.GetMin()) && AreaSystemUtil::ContainsXY(dirtyRegion, sectorInfo.m_bounds.GetMax()));
+        if (partialFill)
+        {
+            // Only the points inside the dirty region are offered to the areas, and only the claims on those points are
+            // reevaluated.  Claims outside of the region stay in m_claimedWorldPoints untouched.
+            activeContext.m_existedCallback = sectorInfo.m_baseContext.m_existedCallback;
+            activeContext.m_createdCallback = sectorInfo.m_baseContext.m_createdCallback;
+            sectorInfo.m_claimedWorldPointsBeforeFill.clear();
+
+            AZStd::unordered_set<ClaimHandle> handlesOutsideRegion;
+            for (const auto& point : sectorInfo.m_baseContext.m_availablePoints)
+            {
+                if (AreaSystemUtil::ContainsXY(dirtyRegion, point.m_position))
+                {
+                    activeContext.m_availablePoints.push_back(point);
+                    activeContext.m_masks.AddSurfaceTagWeights(point.m_masks);
+
+                    auto claimItr = sectorInfo.m_claimedWorldPoints.find(point.m_handle);
+                    if (claimItr != sectorInfo.m_claimedWorldPoints.end())
+                    {
+                        sectorInfo.m_claimedWorldPointsBeforeFill.insert(*claimItr);
+                        sectorInfo.m_claimedWorldPoints.erase(claimItr);
+                    }
+                }
+                else
+                {
+                    handlesOutsideRegion.insert(point.m_handle);
+                }
+            }
+
+            // Claims on points that no longer exist after a surface point rebuild need to be released as well.
+            for (auto claimItr = sectorInfo.m_claimedWorldPoints.begin(); claimItr != sectorInfo.m_claimedWorldPoints.end(); )
+            {
+                if (handlesOutsideRegion.find(claimItr->first) == handlesOutsideRegion.end())
+                {
+                    sectorInfo.m_claimedWorldPointsBeforeFill.insert(*claimItr);
+                    claimItr = sectorInfo.m_claimedWorldPoints.erase(claimItr);
+                }
+                else
+                {
+                    ++claimItr;
+                }
+            }
+        }
+        else
+        {
+            //m_availablePoints is a free list initialized with the complete set of points in the sector.
+            activeContext = sectorInfo.m_baseContext;
+
+            // Clear out the list of claimed world points before we begin
+            sectorInfo.m_claimedWorldPointsBeforeFill = sectorInfo.m_claimedWorldPoints;
+            sectorInfo.m_claimedWorldPoints.clear();
+        }
 
         //for all active areas attempt to spawn vegetation on sector grid positions
         for (const auto& area : activeAreas)
@@ -1350,7 +1444,7 @@ namespace Vegetation
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        AZStd::unordered_map<AZ::EntityId, AZStd::unordered_set<ClaimHandle>> claimsToRelease;
+        AZStd::unordered_map<AZ::EntityId, AZStd::vector<ClaimHandle>> claimsToRelease;
 
         // group up all the points based on area id
         for (const auto& claimPair : sectorInfo.m_claimedWorldPoints)
@@ -1358,7 +1452,7 @@ namespace Vegetation
             const auto& handle = claimPair.first;
             const auto& instanceData = claimPair.second;
             const auto& areaId = instanceData.m_id;
-            claimsToRelease[areaId].insert(handle);
+            claimsToRelease[areaId].push_back(handle);
         }
         sectorInfo.m_claimedWorldPoints.clear();
 
@@ -1368,12 +1462,7 @@ namespace Vegetation
             const auto& areaId = claimPair.first;
             const auto& handles = claimPair.second;
             AreaNotificationBus::Event(areaId, &AreaNotificationBus::Events::OnAreaConnect);
-
-            for (const auto& handle : handles)
-            {
-                AreaRequestBus::Event(areaId, &AreaRequestBus::Events::UnclaimPosition, handle);
-            }
-
+            AreaRequestBus::Event(areaId, &AreaRequestBus::Events::UnclaimPositions, handles);
             AreaNotificationBus::Event(areaId, &AreaNotificationBus::Events::OnAreaDisconnect);
         }
     }
@@ -1399,14 +1488,15 @@ namespace Vegetation
         sectorInfo.m_claimedWorldPoints[handle] = instanceData;
     }
 
-    ClaimHandle AreaSystemComponent::VegetationThreadTasks::CreateClaimHandle(const SectorInfo& sectorInfo, uint32_t index) const
+    ClaimHandle AreaSystemComponent::VegetationThreadTasks::CreateClaimHandle(const SectorInfo& sectorInfo, uint32_t positionIndex, uint32_t pointIndex) const
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
         ClaimHandle handle = 0;
         AreaSystemUtil::hash_combine_64(handle, sectorInfo.m_id.first);
         AreaSystemUtil::hash_combine_64(handle, sectorInfo.m_id.second);
-        AreaSystemUtil::hash_combine_64(handle, index);
+        AreaSystemUtil::hash_combine_64(handle, positionIndex);
+        AreaSystemUtil::hash_combine_64(handle, pointIndex);
         return handle;
     }
 
@@ -1420,7 +1510,7 @@ namespace Vegetation
                 // already marked *all* sectors as dirty.
                 EnumerateSectorsInAabb(bounds, worldToSector, viewRect, [&](SectorId&& sectorId)
                 {
-                    dirtySet.MarkDirty(sectorId);
+                    dirtySet.MarkDirty(sectorId, bounds);
                     return true;
                 });
             }
@@ -1591,7 +1681,7 @@ namespace Vegetation
             AZStd::remove_if(
                 m_updateWorkList.begin(),
                 m_updateWorkList.end(),
-                [currViewRect](const auto& entry) {return !currViewRect.IsInside(entry.first); }),
+                [currViewRect](const auto& entry) {return !currViewRect.IsInside(entry.m_id); }),
             m_updateWorkList.end());
         AZ_Assert(m_updateWorkList.size() <= m_viewRectSectorCount, "Refreshed RequestedUpdate list should not be larger than the view rectangle.");
 
@@ -1627,16 +1717,17 @@ namespace Vegetation
                         {
                             // If the sector doesn't currently exist and it belongs in the view rect, request a creation.
                             // (This will either create a new entry or overwrite an existing pending Create request)
-                            auto found = AZStd::find_if(m_updateWorkList.begin(), m_updateWorkList.end(), [sectorId](auto& entry) { return (entry.first == sectorId); });
+                            auto found = AZStd::find_if(m_updateWorkList.begin(), m_updateWorkList.end(), [sectorId](auto& entry) { return (entry.m_id == sectorId); });
                             if (found != m_updateWorkList.end())
                             {
                                 // If the update entry already exists, overwrite the state.  We don't need to check or
                                 // preserve the existing state because Create is the most comprehensive update we can do.
-                                found->second = UpdateMode::Create;
+                                found->m_mode = UpdateMode::Create;
+                                found->m_dirtyRegion = AZ::Aabb::CreateNull();
                             }
                             else
                             {
-                                m_updateWorkList.emplace_back(sectorId, UpdateMode::Create);
+                                m_updateWorkList.push_back({ sectorId, UpdateMode::Create, AZ::Aabb::CreateNull() });
                             }
 
                             // Since we've already removed entries that aren't in the view rect, and these loops are only
@@ -1660,20 +1751,28 @@ namespace Vegetation
                 }
                 else if (threadData->m_dirtySectorSurfacePoints.IsDirty(sectorId))
                 {
-                    // Active sector has new surface point information, so rebuild surface cache and fill
+                    // Active sector has new surface point information, so rebuild surface cache and refill the changed region.
+                    // If the sector contents are dirty too, the refilled region needs to cover both.
+                    AZ::Aabb dirtyRegion = threadData->m_dirtySectorSurfacePoints.GetDirtyRegion(sectorId);
+                    if (threadData->m_dirtySectorContents.IsDirty(sectorId))
+                    {
+                        dirtyRegion = AreaSystemUtil::MergeDirtyRegions(dirtyRegion, threadData->m_dirtySectorContents.GetDirtyRegion(sectorId));
+                    }
+
                     // (This will either create a new entry, or overwrite an existing fill or rebuild request)
-                    auto found = AZStd::find_if(m_updateWorkList.begin(), m_updateWorkList.end(), [sectorId](auto& entry) { return (entry.first == sectorId); });
+                    auto found = AZStd::find_if(m_updateWorkList.begin(), m_updateWorkList.end(), [sectorId](auto& entry) { return (entry.m_id == sectorId); });
                     if (found != m_updateWorkList.end())
                     {
                         // If the update entry already exists, overwrite the state.  We don't need to check or
                         // preserve the state since it should only contain either Rebuild or Fill, and Rebuild
-                        // is more comprehensive than Fill.
-                        AZ_Assert(found->second != UpdateMode::Create, "Create requests shouldn't exist for active sectors!");
-                        found->second = UpdateMode::RebuildSurfaceCacheAndFill;
+                        // is more comprehensive than Fill.  The previously requested region still needs to be refilled.
+                        AZ_Assert(found->m_mode != UpdateMode::Create, "Create requests shouldn't exist for active sectors!");
+                        found->m_mode = UpdateMode::RebuildSurfaceCacheAndFill;
+                        found->m_dirtyRegion = AreaSystemUtil::MergeDirtyRegions(found->m_dirtyRegion, dirtyRegion);
                     }
                     else
                     {
-                        m_updateWorkList.emplace_back(sectorId, UpdateMode::RebuildSurfaceCacheAndFill);
+                        m_updateWorkList.push_back({ sectorId, UpdateMode::RebuildSurfaceCacheAndFill, dirtyRegion });
                     }
 
                     // We shouldn't ever have an update list that's larger than the set of sectors in the view rect.
@@ -1681,19 +1780,24 @@ namespace Vegetation
                 }
                 else if (threadData->m_dirtySectorContents.IsDirty(sectorId))
                 {
-                    // Active sector has new veg area information, so refill it.
+                    // Active sector has new veg area information, so refill the changed region.
+                    const AZ::Aabb dirtyRegion = threadData->m_dirtySectorContents.GetDirtyRegion(sectorId);
                     auto found = AZStd::find_if(m_updateWorkList.begin(), m_updateWorkList.end(), [sectorId](auto& entry)
-                    { return (entry.first == sectorId); });
+                    { return (entry.m_id == sectorId); });
                     if (found == m_updateWorkList.end())
                     {
-                        // Only add Fill entries if no update request exists for this sector.  We don't
-                        // overwrite existing entries because an existing entry might have previously
-                        // requested "RebuildSurfaceCacheAndFill", which is more comprehensive than this request.
-                        m_updateWorkList.emplace_back(sectorId, UpdateMode::Fill);
+                        m_updateWorkList.push_back({ sectorId, UpdateMode::Fill, dirtyRegion });
 
                         // We shouldn't ever have an update list that's larger than the set of sectors in the view rect.
                         AZ_Assert(m_updateWorkList.size() <= m_viewRectSectorCount, "Too many update requests added");
                     }
+                    else
+                    {
+                        // We don't overwrite the mode of existing entries because an existing entry might have previously
+                        // requested "RebuildSurfaceCacheAndFill", which is more comprehensive than this request.  The
+                        // region to refill grows to cover this request as well.
+                        found->m_dirtyRegion = AreaSystemUtil::MergeDirtyRegions(found->m_dirtyRegion, dirtyRegion);
+                    }
                 }
             }
         }
@@ -1741,7 +1845,7 @@ namespace Vegetation
             {
                 // We always pull from the end of the list, so we sort the *closest* sectors to the end.
                 // That way we create / update the closest sectors first.
-                return sectorCompare(lhs.first, rhs.first, false);
+                return sectorCompare(lhs.m_id, rhs.m_id, false);
             });
 
             AZStd::sort(m_deleteWorkList.begin(), m_deleteWorkList.end(), [sectorCompare](const auto& lhs, const auto& rhs)
@@ -1761,7 +1865,7 @@ namespace Vegetation
 
         // This chooses work in the following order:
         // 1) Delete if we have more sectors than the total that should be in the view rectangle
-        // 2) Create/update if we have any sectors to create / update
+        // 2) Create/update a batch of the closest sectors if we have any sectors to create / update
         // 3) Delete if we have any sectors to delete
 
         // Delete if there are more active sectors than the number of desired sectors or the update list is empty.
@@ -1780,44 +1884,85 @@ namespace Vegetation
         // Create / update if there's anything to do and we didn't prioritize a delete.
         if (!m_updateWorkList.empty())
         {
-            auto& updateEntry = m_updateWorkList.back();
-            SectorId sectorId = updateEntry.first;
-            UpdateMode mode = updateEntry.second;
-            m_updateWorkList.pop_back();
+            // Generating surface points is the query-heavy part of an update and only touches the sector being updated, so the
+            // points of several of the closest sectors are generated concurrently.  The vegetation thread builds one of them
+            // itself and the rest run as jobs, so it never waits on more jobs than there are other worker threads.
+            // Filling stays serial, because every area gets connected to the AreaRequestBus for the duration of a fill.
+            const AZ::u32 workerThreadCount = AZ::JobContext::GetGlobalContext() ?
+                AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads() : 1;
+            const size_t batchSize = AZStd::min(
+                aznumeric_cast<size_t>(AZStd::clamp(static_cast<AZ::u32>(veg_sectorPointJobCount), 1u, AZStd::max(workerThreadCount, 1u))),
+                m_updateWorkList.size());
+
+            // The closest sectors are at the end of the list.
+            AZStd::vector<SectorUpdate> batch(m_updateWorkList.rbegin(), m_updateWorkList.rbegin() + batchSize);
+            m_updateWorkList.resize(m_updateWorkList.size() - batchSize);
 
             {
                 AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
 
-                auto& sectorDensity = m_cachedMainThreadData.m_sectorDensity;
-                auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
-                auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+                const int sectorDensity = m_cachedMainThreadData.m_sectorDensity;
+                const int sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
+                const SnapMode sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
 
-                switch (mode)
+                AZStd::vector<SectorInfo*> sectors;
+                AZStd::vector<SectorInfo*> sectorsToBuild;
+                sectors.reserve(batch.size());
+                for (const auto& update : batch)
                 {
-                    case UpdateMode::RebuildSurfaceCacheAndFill:
+                    SectorInfo* sectorInfo = nullptr;
+                    switch (update.m_mode)
                     {
-                        auto sectorInfo = vegTasks->GetSector(sectorId);
-                        AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
-                        vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+                        case UpdateMode::RebuildSurfaceCacheAndFill:
+                        {
+                            sectorInfo = vegTasks->GetSector(update.m_id);
+                            AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
+                            sectorsToBuild.push_back(sectorInfo);
+                        }
+                        break;
+
+                        case UpdateMode::Fill:
+                        {
+                            sectorInfo = vegTasks->GetSector(update.m_id);
+                            AZ_Assert(sectorInfo, "Sector update mode is 'Fill' but sector doesn't exist");
+                        }
+                        break;
+
+                        case UpdateMode::Create:
+                        {
+                            AZ_Assert(!vegTasks->GetSector(update.m_id), "Sector update mode is 'Create' but sector already exists");
+                            sectorInfo = vegTasks->CreateSector(update.m_id, sectorSizeInMeters);
+                            sectorsToBuild.push_back(sectorInfo);
+                        }
+                        break;
                     }
-                    break;
+                    sectors.push_back(sectorInfo);
+                }
 
-                    case UpdateMode::Fill:
+                if (!sectorsToBuild.empty())
+                {
+                    AZ::JobCompletion pointsCompletion;
+                    for (size_t index = 1; index < sectorsToBuild.size(); ++index)
                     {
-                        auto sectorInfo = vegTasks->GetSector(sectorId);
-                        AZ_Assert(sectorInfo, "Sector update mode is 'Fill' but sector doesn't exist");
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+                        SectorInfo* sectorInfo = sectorsToBuild[index];
+                        auto job = AZ::CreateJobFunction([vegTasks, sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode]()
+                        {
+                            vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        }, true);
+                        job->SetDependent(&pointsCompletion);
+                        job->Start();
                     }
-                    break;
 
-                    case UpdateMode::Create:
+                    vegTasks->UpdateSectorPoints(*sectorsToBuild[0], sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                    if (sectorsToBuild.size() > 1)
                     {
-                        AZ_Assert(!vegTasks->GetSector(sectorId), "Sector update mode is 'Create' but sector already exists");
-                        auto sectorInfo = vegTasks->CreateSector(sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+                        pointsCompletion.StartAndWaitForCompletion();
                     }
-                    break;
+                }
+
+                for (size_t index = 0; index < batch.size(); ++index)
+                {
+                    vegTasks->FillSector(*sectors[index], threadData->m_activeAreasInBubble, batch[index].m_dirtyRegion);
                 }
             }
 
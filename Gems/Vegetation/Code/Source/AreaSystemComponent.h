@@ -21,6 +21,11 @@
 #include <ISystem.h>
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 
+namespace UnitTest
+{
+    class VegetationSectorUpdateTests;
+}
+
 namespace Vegetation
 {
     struct DebugData;
@@ -87,6 +92,7 @@ namespace Vegetation
     {
     public:
         friend class EditorAreaSystemComponent;
+        friend class UnitTest::VegetationSectorUpdateTests;
         AZ_COMPONENT(AreaSystemComponent, "{7CE8E791-6BC6-4C88-8727-A476DE00F9A1}");
         static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& services);
         static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& services);
@@ -197,9 +203,9 @@ namespace Vegetation
         using VegetationAreaVector = AZStd::vector<VegetationAreaInfo>;
         using UnregisteredVegetationAreaMap = AZStd::unordered_map<SectorId, AZStd::unordered_set<AZ::EntityId>>;
 
-        //! Helper class to track whether or not a visible sector is dirty.  Different instances of this
-        //! class are used to track different reasons for being dirty.
-        //! This is a class instead of just an unordered_set<> so that we can also encapsulate the optimization
+        //! Helper class to track whether or not a visible sector is dirty, and which region of it is dirty.
+        //! Different instances of this class are used to track different reasons for being dirty.
+        //! This is a class instead of just an unordered_map<> so that we can also encapsulate the optimization
         //! of tracking when *all* sectors are dirty.
         class DirtySectors
         {
@@ -207,15 +213,19 @@ namespace Vegetation
                 DirtySectors() = default;
                 ~DirtySectors() = default;
 
-                void MarkDirty(const SectorId& id);
+                //! Marks a region of a sector as dirty. Regions marked on the same sector are merged, and an invalid
+                //! region marks the entire sector as dirty.
+                void MarkDirty(const SectorId& id, const AZ::Aabb& dirtyRegion);
                 void MarkAllDirty();
                 bool IsAllDirty() const { return m_allSectorsDirty; }
                 bool IsNoneDirty() const { return (!m_allSectorsDirty) && m_dirtySet.empty(); }
                 bool IsDirty(const SectorId& id) const;
+                //! Gets the dirty region of a dirty sector, which is invalid if the entire sector is dirty.
+                AZ::Aabb GetDirtyRegion(const SectorId& id) const;
                 void Clear();
 
             private:
-                using DirtySectorSet = AZStd::unordered_set<SectorId>;
+                using DirtySectorSet = AZStd::unordered_map<SectorId, AZ::Aabb>;
                 DirtySectorSet m_dirtySet;
                 //! Flag when *all* existing sectors are dirty
                 bool m_allSectorsDirty = false;
@@ -291,9 +301,14 @@ namespace Vegetation
             const SectorInfo* GetSector(const SectorId& sectorId) const;
             SectorInfo* GetSector(const SectorId& sectorId);
 
-            SectorInfo* CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            //! Creates an empty sector, UpdateSectorPoints() needs to be called to build its set of plantable points.
+            SectorInfo* CreateSector(const SectorId& sectorId, int sectorSizeInMeters);
+            //! Rebuilds the plantable points of a sector. This only modifies the given sector, so different sectors can be
+            //! updated concurrently.
             void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
-            void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas);
+            //! Runs the active areas over the points of a sector.  If a valid dirty region is given, only the points inside of
+            //! it are reclaimed and the claims outside of it are kept as is.
+            void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas, const AZ::Aabb& dirtyRegion);
             void DeleteSector(const SectorId& sectorId);
             void ClearSectors();
 
@@ -313,7 +328,7 @@ namespace Vegetation
         private:
             // claiming logic
             void CreateClaim(SectorInfo& sectorInfo, const ClaimHandle handle, const InstanceData& instanceData);
-            ClaimHandle CreateClaimHandle(const SectorInfo& sectorInfo, uint32_t index) const;
+            ClaimHandle CreateClaimHandle(const SectorInfo& sectorInfo, uint32_t positionIndex, uint32_t pointIndex) const;
 
             void ReleaseUnusedClaims(SectorInfo& sectorInfo);
             void ReleaseUnregisteredClaims(SectorInfo& sectorInfo);
@@ -438,13 +453,21 @@ namespace Vegetation
                 Fill
             };
 
+            struct SectorUpdate
+            {
+                SectorId m_id;
+                UpdateMode m_mode = UpdateMode::Fill;
+                //! The region of the sector to refill, invalid to refill the entire sector.
+                AZ::Aabb m_dirtyRegion = AZ::Aabb::CreateNull();
+            };
+
             // The sorted work list of sectors to delete.  The list is recreated every time UpdateSectorWorkLists() is run.
             AZStd::vector<SectorId> m_deleteWorkList;
 
             // The sorted work list of sectors to create / update.  This is incrementally modified when UpdateSectorWorkLists()
             // is run, because any previously-requested updates that are still in view need to be preserved.  They can't simply
             // be recalculated.
-            AZStd::vector<AZStd::pair<SectorId, UpdateMode>> m_updateWorkList;
+            AZStd::vector<SectorUpdate> m_updateWorkList;
 
             // Sector counts of the number of expected sectors in the view rectangle vs the number of sectors
             // currently active.  These are used to "load balance" sector deletes and creates so that we don't have
@@ -516,6 +516,34 @@ namespace Vegetation
         }
     }
 
+    void SpawnerComponent::UnclaimPositions(AZStd::span<const ClaimHandle> handles)
+    {
+        AZ_PROFILE_FUNCTION(Vegetation);
+
+        AZStd::vector<InstanceId> instanceIds;
+        instanceIds.reserve(handles.size());
+        {
+            AZStd::lock_guard<decltype(m_claimInstanceMappingMutex)> claimInstanceMappingMutexLock(m_claimInstanceMappingMutex);
+            for (const ClaimHandle handle : handles)
+            {
+                auto claimItr = m_claimInstanceMapping.find(handle);
+                if (claimItr != m_claimInstanceMapping.end())
+                {
+                    if (claimItr->second != InvalidInstanceId)
+                    {
+                        instanceIds.push_back(claimItr->second);
+                    }
+                    m_claimInstanceMapping.erase(claimItr);
+                }
+            }
+        }
+
+        if (!instanceIds.empty())
+        {
+            InstanceSystemRequestBus::Broadcast(&InstanceSystemRequestBus::Events::DestroyInstances, instanceIds);
+        }
+    }
+
     AZ::Aabb SpawnerComponent::GetEncompassingAabb() const
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
@@ -554,11 +582,13 @@ namespace Vegetation
             AZStd::swap(claimInstanceMapping, m_claimInstanceMapping);
         }
 
+        AZStd::vector<InstanceId> instanceIds;
+        instanceIds.reserve(claimInstanceMapping.size());
         for (const auto& claim : claimInstanceMapping)
         {
-            const auto instanceId = claim.second;
-            InstanceSystemRequestBus::Broadcast(&InstanceSystemRequestBus::Events::DestroyInstance, instanceId);
+            instanceIds.push_back(claim.second);
         }
+        InstanceSystemRequestBus::Broadcast(&InstanceSystemRequestBus::Events::DestroyInstances, instanceIds);
 
 #if VEG_SPAWNER_ENABLE_CACHING
         //wipe the cache
@@ -83,6 +83,7 @@ namespace Vegetation
         bool PrepareToClaim(EntityIdStack& stackIds) override;
         void ClaimPositions(EntityIdStack& stackIds, ClaimContext& context) override;
         void UnclaimPosition(const ClaimHandle handle) override;
+        void UnclaimPositions(AZStd::span<const ClaimHandle> handles) override;
 
         //////////////////////////////////////////////////////////////////////////
         // AreaInfoBus
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Vegetation/InstanceSpawner.h>
+#include <Vegetation/InstanceData.h>
+
+namespace Vegetation
+{
+    void InstanceSpawner::CreateInstances(AZStd::span<const InstanceData> instanceData, AZStd::span<InstancePtr> outInstances)
+    {
+        AZ_Assert(instanceData.size() == outInstances.size(), "Every instance to create needs an output entry.");
+
+        for (size_t index = 0; index < instanceData.size(); ++index)
+        {
+            outInstances[index] = CreateInstance(instanceData[index]);
+        }
+    }
+
+    void InstanceSpawner::DestroyInstances(AZStd::span<const InstanceId> ids, AZStd::span<const InstancePtr> instances)
+    {
+        AZ_Assert(ids.size() == instances.size(), "Every instance to destroy needs an instance id.");
+
+        for (size_t index = 0; index < ids.size(); ++index)
+        {
+            DestroyInstance(ids[index], instances[index]);
+        }
+    }
+} // namespace Vegetation
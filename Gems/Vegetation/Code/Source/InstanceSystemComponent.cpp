@@ -13,7 +13,10 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
 
 #include <Vegetation/Ebuses/AreaInfoBus.h>
 #include <Vegetation/Ebuses/AreaSystemRequestBus.h>
@@ -286,10 +289,7 @@ namespace Vegetation
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::CreateInstance, instanceData.m_instanceId, instanceData.m_position, instanceData.m_id));
 
         //queue render node related tasks to process on the main thread
-        AddTask([this, instanceData]() {
-            CreateInstanceNode(instanceData);
-            m_createTaskCount--;
-        });
+        AddTask({ instanceData, false });
 
         m_createTaskCount++;
     }
@@ -307,19 +307,28 @@ namespace Vegetation
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::DeleteInstance, instanceId));
 
         //queue render node related tasks to process on the main thread
-        AddTask([this, instanceId]() {
-            ReleaseInstanceNode(instanceId);
-
-            AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-            m_instanceDeletionSet.erase(instanceId);
-            m_destroyTaskCount--;
-        });
+        Task task;
+        task.m_instanceData.m_instanceId = instanceId;
+        task.m_destroy = true;
+        AddTask(AZStd::move(task));
 
         AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
         m_instanceDeletionSet.insert(instanceId);
         m_destroyTaskCount++;
     }
 
+    void InstanceSystemComponent::DestroyInstances(AZStd::span<const InstanceId> instanceIds)
+    {
+        AZ_PROFILE_FUNCTION(Vegetation);
+
+        // Hold the queue lock for the whole batch so the destructions land in as few task batches as possible.
+        AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
+        for (const InstanceId instanceId : instanceIds)
+        {
+            DestroyInstance(instanceId);
+        }
+    }
+
     void InstanceSystemComponent::DestroyAllInstances()
     {
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::DeleteAllInstances));
@@ -434,80 +443,140 @@ namespace Vegetation
         m_instanceIdPool.insert(instanceId);
     }
 
-    bool InstanceSystemComponent::IsInstanceSkippable(const InstanceData& instanceData) const
-    {
-        VEGETATION_PROFILE_FUNCTION_VERBOSE
-
-        //if the instance was queued for deletion before its creation task executed then skip it
-        AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-        return instanceData.m_instanceId == InvalidInstanceId || m_instanceDeletionSet.find(instanceData.m_instanceId) != m_instanceDeletionSet.end();
-    }
-
-    void InstanceSystemComponent::CreateInstanceNode(const InstanceData& instanceData)
+    void InstanceSystemComponent::CreateInstanceNodes(AZStd::vector<InstanceData>& instances)
     {
-        VEGETATION_PROFILE_FUNCTION_VERBOSE
+        AZ_PROFILE_FUNCTION(Vegetation);
 
-        if (IsInstanceSkippable(instanceData))
         {
-            return;
-        }
+            AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
+            AZStd::lock_guard<decltype(m_uniqueDescriptorsMutex)> lock(m_uniqueDescriptorsMutex);
 
-        // Only support valid, registered descriptors with loaded assets
-        if (!instanceData.m_descriptorPtr || !instanceData.m_descriptorPtr->IsLoaded())
-        {
-            //descriptor and mesh must be valid but it's not an error
-            //an edit, asset change, or other event could have released descriptors or render groups on this or another thread
-            //this should result in a composition change and refresh
-            return;
+            instances.erase(
+                AZStd::remove_if(
+                    instances.begin(),
+                    instances.end(),
+                    [this](const InstanceData& instanceData)
+                    {
+                        //if the instance was queued for deletion before its creation task executed then skip it
+                        if (instanceData.m_instanceId == InvalidInstanceId ||
+                            m_instanceDeletionSet.find(instanceData.m_instanceId) != m_instanceDeletionSet.end())
+                        {
+                            return true;
+                        }
+
+                        //descriptor and mesh must be valid and registered but it's not an error
+                        //an edit, asset change, or other event could have released descriptors or render groups on this or another thread
+                        //this should result in a composition change and refresh
+                        return !instanceData.m_descriptorPtr || !instanceData.m_descriptorPtr->IsLoaded() ||
+                            m_uniqueDescriptors.find(instanceData.m_descriptorPtr) == m_uniqueDescriptors.end();
+                    }),
+                instances.end());
         }
 
+        // Group the instances by descriptor, so each spawner creates all of its instances from one contiguous array
+        AZStd::sort(instances.begin(), instances.end(), [](const InstanceData& lhs, const InstanceData& rhs)
         {
-            AZStd::lock_guard<decltype(m_uniqueDescriptorsMutex)> lock(m_uniqueDescriptorsMutex);
+            return lhs.m_descriptorPtr.get() < rhs.m_descriptorPtr.get();
+        });
 
-            auto descItr = m_uniqueDescriptors.find(instanceData.m_descriptorPtr);
-            if (descItr == m_uniqueDescriptors.end())
+        AZStd::vector<InstancePtr> opaqueInstances(instances.size(), nullptr);
+        for (size_t groupStart = 0; groupStart < instances.size(); )
+        {
+            const DescriptorPtr& descriptorPtr = instances[groupStart].m_descriptorPtr;
+            size_t groupEnd = groupStart + 1;
+            while (groupEnd < instances.size() && instances[groupEnd].m_descriptorPtr == descriptorPtr)
             {
-                //descriptor must be registered with the system to create an instance.
-                //it could have been removed or re-added while editing or deleting entities that control the registration
-                return;
+                ++groupEnd;
             }
-        }
 
-        InstancePtr opaqueInstanceData = instanceData.m_descriptorPtr->CreateInstance(instanceData);
+            descriptorPtr->CreateInstances(
+                AZStd::span<const InstanceData>(instances.data() + groupStart, groupEnd - groupStart),
+                AZStd::span<InstancePtr>(opaqueInstances.data() + groupStart, groupEnd - groupStart));
+            groupStart = groupEnd;
+        }
 
-        if (opaqueInstanceData)
+        AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
+        for (size_t index = 0; index < instances.size(); ++index)
         {
-            AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
-            AZ_Assert(m_instanceMap.find(instanceData.m_instanceId) == m_instanceMap.end(), "InstanceId %llu is already in use!", instanceData.m_instanceId);
-            m_instanceMap[instanceData.m_instanceId] = AZStd::make_pair(instanceData.m_descriptorPtr, opaqueInstanceData);
-            m_instanceCount = static_cast<int>(m_instanceMap.size());
+            if (opaqueInstances[index])
+            {
+                const InstanceData& instanceData = instances[index];
+                AZ_Assert(m_instanceMap.find(instanceData.m_instanceId) == m_instanceMap.end(), "InstanceId %llu is already in use!", instanceData.m_instanceId);
+                m_instanceMap[instanceData.m_instanceId] = AZStd::make_pair(instanceData.m_descriptorPtr, opaqueInstances[index]);
+            }
         }
+        m_instanceCount = static_cast<int>(m_instanceMap.size());
     }
 
-    void InstanceSystemComponent::ReleaseInstanceNode(InstanceId instanceId)
+    void InstanceSystemComponent::ReleaseInstanceNodes(AZStd::span<const InstanceId> instanceIds)
     {
         AZ_PROFILE_FUNCTION(Vegetation);
 
-        DescriptorPtr descriptor = nullptr;
-        InstancePtr opaqueInstanceData = nullptr;
+        struct InstanceToRelease
+        {
+            DescriptorPtr m_descriptorPtr;
+            InstanceId m_instanceId = InvalidInstanceId;
+            InstancePtr m_opaqueInstance = nullptr;
+        };
+        AZStd::vector<InstanceToRelease> instancesToRelease;
+        instancesToRelease.reserve(instanceIds.size());
 
         {
             AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
-            auto instanceItr = m_instanceMap.find(instanceId);
-            if (instanceItr != m_instanceMap.end())
+            for (const InstanceId instanceId : instanceIds)
             {
-                descriptor = instanceItr->second.first;
-                opaqueInstanceData = instanceItr->second.second;
-                m_instanceMap.erase(instanceItr);
+                auto instanceItr = m_instanceMap.find(instanceId);
+                if (instanceItr != m_instanceMap.end())
+                {
+                    if (instanceItr->second.second)
+                    {
+                        instancesToRelease.push_back({ instanceItr->second.first, instanceId, instanceItr->second.second });
+                    }
+                    m_instanceMap.erase(instanceItr);
+                }
             }
             m_instanceCount = static_cast<int>(m_instanceMap.size());
         }
 
-        if (opaqueInstanceData)
+        // Group the instances by descriptor, so each spawner destroys all of its instances from one contiguous array
+        AZStd::sort(instancesToRelease.begin(), instancesToRelease.end(), [](const InstanceToRelease& lhs, const InstanceToRelease& rhs)
+        {
+            return lhs.m_descriptorPtr.get() < rhs.m_descriptorPtr.get();
+        });
+
+        AZStd::vector<InstanceId> groupIds;
+        AZStd::vector<InstancePtr> groupInstances;
+        for (size_t groupStart = 0; groupStart < instancesToRelease.size(); )
+        {
+            const DescriptorPtr& descriptorPtr = instancesToRelease[groupStart].m_descriptorPtr;
+            groupIds.clear();
+            groupInstances.clear();
+
+            size_t groupEnd = groupStart;
+            for (; groupEnd < instancesToRelease.size() && instancesToRelease[groupEnd].m_descriptorPtr == descriptorPtr; ++groupEnd)
+            {
+                groupIds.push_back(instancesToRelease[groupEnd].m_instanceId);
+                groupInstances.push_back(instancesToRelease[groupEnd].m_opaqueInstance);
+            }
+
+            descriptorPtr->DestroyInstances(groupIds, groupInstances);
+            groupStart = groupEnd;
+        }
+
+        {
+            AZStd::lock_guard<decltype(m_instanceIdMutex)> scopedLock(m_instanceIdMutex);
+            for (const InstanceId instanceId : instanceIds)
+            {
+                //add released ids to the free list for recycling
+                m_instanceIdPool.insert(instanceId);
+            }
+        }
+
+        AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
+        for (const InstanceId instanceId : instanceIds)
         {
-            descriptor->DestroyInstance(instanceId, opaqueInstanceData);
+            m_instanceDeletionSet.erase(instanceId);
         }
-        ReleaseInstanceId(instanceId);
     }
 
     bool InstanceSystemComponent::HasTasks() const
@@ -516,7 +585,7 @@ namespace Vegetation
         return !m_mainThreadTaskQueue.empty();
     }
 
-    void InstanceSystemComponent::AddTask(const Task& task)
+    void InstanceSystemComponent::AddTask(Task&& task)
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
@@ -525,7 +594,7 @@ namespace Vegetation
         {
             m_mainThreadTaskQueue.emplace_back().reserve(m_configuration.m_maxInstanceTaskBatchSize);
         }
-        m_mainThreadTaskQueue.back().emplace_back(task);
+        m_mainThreadTaskQueue.back().emplace_back(AZStd::move(task));
     }
 
     void InstanceSystemComponent::ClearTasks()
@@ -565,10 +634,7 @@ namespace Vegetation
         auto removedTasksPtr = AZStd::make_shared<TaskList>();
         while (GetTasks(*removedTasksPtr))
         {
-            for (const auto& task : (*removedTasksPtr).back())
-            {
-                task();
-            }
+            ExecuteTaskBatch((*removedTasksPtr).back());
 
             currentTime = AZStd::chrono::steady_clock::now();
             if (AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(currentTime - initialTime).count() > m_configuration.m_maxInstanceProcessTimeMicroseconds)
@@ -582,6 +648,48 @@ namespace Vegetation
         garbageCollectionJob->Start();
     }
 
+    void InstanceSystemComponent::ExecuteTaskBatch(TaskBatch& batch)
+    {
+        AZ_PROFILE_FUNCTION(Vegetation);
+
+        // Apply the batch as one set of destructions followed by one set of creations, which keeps the order the area system
+        // requests them in when it replaces an instance.  An instance id is only recycled once its destruction has run, so a
+        // destruction in the batch can only target an instance created earlier.  Creations that get destroyed within the same
+        // batch are dropped here, because releasing the id removes it from the deletion set that would otherwise skip them.
+        AZStd::vector<InstanceData> instancesToCreate;
+        AZStd::vector<InstanceId> instancesToDestroy;
+        instancesToCreate.reserve(batch.size());
+        for (const auto& task : batch)
+        {
+            if (task.m_destroy)
+            {
+                instancesToDestroy.push_back(task.m_instanceData.m_instanceId);
+            }
+        }
+
+        const AZStd::unordered_set<InstanceId> destroyedInBatch(instancesToDestroy.begin(), instancesToDestroy.end());
+        int createTaskCount = 0;
+        for (auto& task : batch)
+        {
+            if (!task.m_destroy)
+            {
+                ++createTaskCount;
+                if (destroyedInBatch.find(task.m_instanceData.m_instanceId) == destroyedInBatch.end())
+                {
+                    instancesToCreate.push_back(AZStd::move(task.m_instanceData));
+                }
+            }
+        }
+
+        const int destroyTaskCount = static_cast<int>(instancesToDestroy.size());
+
+        ReleaseInstanceNodes(instancesToDestroy);
+        m_destroyTaskCount -= destroyTaskCount;
+
+        CreateInstanceNodes(instancesToCreate);
+        m_createTaskCount -= createTaskCount;
+    }
+
     void InstanceSystemComponent::ProcessMainThreadTasks()
     {
         AZ_PROFILE_FUNCTION(Vegetation);
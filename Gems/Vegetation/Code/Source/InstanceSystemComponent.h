@@ -95,6 +95,7 @@ namespace Vegetation
 
         void CreateInstance(InstanceData& instanceData) override;
         void DestroyInstance(InstanceId instanceId) override;
+        void DestroyInstances(AZStd::span<const InstanceId> instanceIds) override;
         void DestroyAllInstances() override;
         void Cleanup() override;
 
@@ -123,10 +124,8 @@ namespace Vegetation
 
         ////////////////////////////////////////////////////////////////
         // vegetation instance management
-        bool IsInstanceSkippable(const InstanceData& instanceData) const;
-        void CreateInstanceNode(const InstanceData& instanceData);
-
-        void ReleaseInstanceNode(InstanceId instanceId);
+        void CreateInstanceNodes(AZStd::vector<InstanceData>& instances);
+        void ReleaseInstanceNodes(AZStd::span<const InstanceId> instanceIds);
 
         mutable AZStd::recursive_mutex m_instanceMapMutex;
         AZStd::unordered_map<InstanceId, AZStd::pair<DescriptorPtr, InstancePtr>> m_instanceMap;
@@ -136,7 +135,12 @@ namespace Vegetation
 
         ////////////////////////////////////////////////////////////////
         // Task management
-        using Task = AZStd::function<void(void)>;
+        //! A queued instance creation or destruction.  Destructions only use the instance id of the instance data.
+        struct Task
+        {
+            InstanceData m_instanceData;
+            bool m_destroy = false;
+        };
         using TaskBatch = AZStd::vector<Task>;
         using TaskList = AZStd::list<TaskBatch>;
         TaskList m_mainThreadTaskQueue;
@@ -144,10 +148,11 @@ namespace Vegetation
         mutable AZStd::recursive_mutex m_mainThreadTaskInProgressMutex;
 
         bool HasTasks() const;
-        void AddTask(const Task& task);
+        void AddTask(Task&& task);
         void ClearTasks();
         bool GetTasks(TaskList& removedTasks);
         void ExecuteTasks();
+        void ExecuteTaskBatch(TaskBatch& batch);
         void ProcessMainThreadTasks();
 
         ////////////////////////////////////////////////////////////////
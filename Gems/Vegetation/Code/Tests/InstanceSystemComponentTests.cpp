@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "VegetationTest.h"
+#include "VegetationMocks.h"
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/limits.h>
+
+#include <Source/DebugSystemComponent.h>
+#include <Source/InstanceSystemComponent.h>
+#include <Vegetation/EmptyInstanceSpawner.h>
+
+namespace UnitTest
+{
+    // Instance spawner that records every batch of instances it gets asked to create or destroy, in order.
+    class BatchRecordingInstanceSpawner
+        : public Vegetation::EmptyInstanceSpawner
+    {
+    public:
+        AZ_RTTI(BatchRecordingInstanceSpawner, "{5D2E47A3-3C51-4B8E-9E0B-1B6C2A4F7D90}", Vegetation::EmptyInstanceSpawner);
+        AZ_CLASS_ALLOCATOR(BatchRecordingInstanceSpawner, AZ::SystemAllocator, 0);
+
+        struct Batch
+        {
+            bool m_destroy = false;
+            AZStd::vector<Vegetation::InstanceId> m_instanceIds;
+        };
+
+        void CreateInstances(AZStd::span<const Vegetation::InstanceData> instanceData, AZStd::span<Vegetation::InstancePtr> outInstances) override
+        {
+            Batch& batch = m_batches.emplace_back();
+            for (const auto& instance : instanceData)
+            {
+                batch.m_instanceIds.push_back(instance.m_instanceId);
+            }
+            InstanceSpawner::CreateInstances(instanceData, outInstances);
+        }
+
+        void DestroyInstances(AZStd::span<const Vegetation::InstanceId> ids, AZStd::span<const Vegetation::InstancePtr> instances) override
+        {
+            Batch& batch = m_batches.emplace_back();
+            batch.m_destroy = true;
+            batch.m_instanceIds.assign(ids.begin(), ids.end());
+            InstanceSpawner::DestroyInstances(ids, instances);
+        }
+
+        Vegetation::InstancePtr CreateInstance([[maybe_unused]] const Vegetation::InstanceData& instanceData) override
+        {
+            ++m_createInstanceCount;
+            return this;
+        }
+
+        void DestroyInstance([[maybe_unused]] Vegetation::InstanceId id, [[maybe_unused]] Vegetation::InstancePtr instance) override
+        {
+            ++m_destroyInstanceCount;
+        }
+
+        void Reset()
+        {
+            m_batches.clear();
+            m_createInstanceCount = 0;
+            m_destroyInstanceCount = 0;
+        }
+
+        AZStd::vector<Batch> m_batches;
+        int m_createInstanceCount = 0;
+        int m_destroyInstanceCount = 0;
+    };
+
+    // Instance system handler that only implements the single instance requests, to test the default batch requests.
+    struct SingleDestroyInstanceSystem
+        : public MockDescriptorBus
+    {
+        void DestroyInstance(Vegetation::InstanceId instanceId) override
+        {
+            m_destroyedInstanceIds.push_back(instanceId);
+        }
+
+        AZStd::vector<Vegetation::InstanceId> m_destroyedInstanceIds;
+    };
+
+    class InstanceSystemComponentTests
+        : public VegetationComponentTests
+    {
+    public:
+        void RegisterComponentDescriptors() override
+        {
+            m_app.RegisterComponentDescriptor(Vegetation::DebugSystemComponent::CreateDescriptor());
+        }
+
+        void SetUp() override
+        {
+            VegetationComponentTests::SetUp();
+
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            // The instance system frees its processed tasks on a job.
+            AZ::JobManagerDesc jobDesc;
+            AZ::JobManagerThreadDesc threadDesc;
+            jobDesc.m_workerThreads.push_back(threadDesc);
+            m_jobManager = aznew AZ::JobManager(jobDesc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext);
+
+            // Process every queued task on each tick, so the tests don't depend on timing.
+            Vegetation::InstanceSystemConfig config;
+            config.m_maxInstanceProcessTimeMicroseconds = AZStd::numeric_limits<int>::max();
+            m_instanceSystemEntity = CreateEntity(config, &m_instanceSystemComponent, [](AZ::Entity* e)
+            {
+                e->CreateComponent<Vegetation::DebugSystemComponent>();
+            });
+
+            m_spawner = AZStd::make_shared<BatchRecordingInstanceSpawner>();
+        }
+
+        void TearDown() override
+        {
+            for (auto& descriptorPtr : m_descriptors)
+            {
+                Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::ReleaseUniqueDescriptor, descriptorPtr);
+            }
+            m_descriptors.clear();
+
+            m_instanceSystemEntity.reset();
+            m_spawner.reset();
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+
+            VegetationComponentTests::TearDown();
+        }
+
+        // Registers a descriptor that uses the recording spawner, the weight makes descriptors with different weights unique.
+        Vegetation::DescriptorPtr RegisterDescriptor(float weight)
+        {
+            Vegetation::Descriptor descriptor;
+            descriptor.SetInstanceSpawner(m_spawner);
+            descriptor.m_weight = weight;
+
+            Vegetation::DescriptorPtr descriptorPtr;
+            Vegetation::InstanceSystemRequestBus::BroadcastResult(descriptorPtr, &Vegetation::InstanceSystemRequestBus::Events::RegisterUniqueDescriptor, descriptor);
+            m_descriptors.push_back(descriptorPtr);
+            return descriptorPtr;
+        }
+
+        static Vegetation::InstanceId CreateInstance(const Vegetation::DescriptorPtr& descriptorPtr)
+        {
+            Vegetation::InstanceData instanceData;
+            instanceData.m_descriptorPtr = descriptorPtr;
+            Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::CreateInstance, instanceData);
+            EXPECT_NE(instanceData.m_instanceId, Vegetation::InvalidInstanceId);
+            return instanceData.m_instanceId;
+        }
+
+        static void DestroyInstance(Vegetation::InstanceId instanceId)
+        {
+            Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::DestroyInstance, instanceId);
+        }
+
+        static void ProcessTasks()
+        {
+            AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.f, AZ::ScriptTimePoint{});
+        }
+
+        static AZ::u32 GetInstanceCount()
+        {
+            AZ::u32 instanceCount = 0;
+            Vegetation::InstanceSystemStatsRequestBus::BroadcastResult(instanceCount, &Vegetation::InstanceSystemStatsRequestBus::Events::GetInstanceCount);
+            return instanceCount;
+        }
+
+        static AZ::u32 GetTotalTaskCount()
+        {
+            AZ::u32 taskCount = 0;
+            Vegetation::InstanceSystemStatsRequestBus::BroadcastResult(taskCount, &Vegetation::InstanceSystemStatsRequestBus::Events::GetTotalTaskCount);
+            return taskCount;
+        }
+
+        AZStd::shared_ptr<BatchRecordingInstanceSpawner> m_spawner;
+        AZStd::vector<Vegetation::DescriptorPtr> m_descriptors;
+        Vegetation::InstanceSystemComponent* m_instanceSystemComponent = nullptr;
+        AZStd::unique_ptr<AZ::Entity> m_instanceSystemEntity;
+
+    private:
+        AZ::JobManager* m_jobManager{ nullptr };
+        AZ::JobContext* m_jobContext{ nullptr };
+    };
+
+    TEST_F(InstanceSystemComponentTests, InstancesAreCreatedAndDestroyedInPerDescriptorBatches)
+    {
+        const Vegetation::DescriptorPtr descriptorA = RegisterDescriptor(1.0f);
+        const Vegetation::DescriptorPtr descriptorB = RegisterDescriptor(2.0f);
+        ASSERT_NE(descriptorA, descriptorB);
+
+        // Interleave the descriptors, the instance system still hands each descriptor's instances to the spawner in one batch.
+        AZStd::vector<Vegetation::InstanceId> instanceIds;
+        for (int index = 0; index < 8; ++index)
+        {
+            instanceIds.push_back(CreateInstance((index % 2) ? descriptorA : descriptorB));
+        }
+
+        ProcessTasks();
+        ASSERT_EQ(m_spawner->m_batches.size(), 2);
+        for (const auto& batch : m_spawner->m_batches)
+        {
+            EXPECT_FALSE(batch.m_destroy);
+            EXPECT_EQ(batch.m_instanceIds.size(), 4);
+        }
+        EXPECT_EQ(m_spawner->m_createInstanceCount, 8);
+        EXPECT_EQ(GetInstanceCount(), 8);
+        EXPECT_EQ(GetTotalTaskCount(), 0);
+
+        m_spawner->Reset();
+        Vegetation::InstanceSystemRequestBus::Broadcast(&Vegetation::InstanceSystemRequestBus::Events::DestroyInstances, instanceIds);
+
+        ProcessTasks();
+        ASSERT_EQ(m_spawner->m_batches.size(), 2);
+        for (const auto& batch : m_spawner->m_batches)
+        {
+            EXPECT_TRUE(batch.m_destroy);
+            EXPECT_EQ(batch.m_instanceIds.size(), 4);
+        }
+        EXPECT_EQ(m_spawner->m_destroyInstanceCount, 8);
+        EXPECT_EQ(GetInstanceCount(), 0);
+        EXPECT_EQ(GetTotalTaskCount(), 0);
+    }
+
+    TEST_F(InstanceSystemComponentTests, DestroysAreAppliedBeforeCreates)
+    {
+        const Vegetation::DescriptorPtr descriptor = RegisterDescriptor(1.0f);
+
+        const Vegetation::InstanceId oldInstanceId = CreateInstance(descriptor);
+        ProcessTasks();
+        m_spawner->Reset();
+
+        // Replace the instance the way a refilled claim does: destroy the old instance, then create the new one.
+        DestroyInstance(oldInstanceId);
+        const Vegetation::InstanceId newInstanceId = CreateInstance(descriptor);
+        EXPECT_NE(newInstanceId, oldInstanceId);
+
+        ProcessTasks();
+        ASSERT_EQ(m_spawner->m_batches.size(), 2);
+        EXPECT_TRUE(m_spawner->m_batches[0].m_destroy);
+        EXPECT_EQ(m_spawner->m_batches[0].m_instanceIds, AZStd::vector<Vegetation::InstanceId>{ oldInstanceId });
+        EXPECT_FALSE(m_spawner->m_batches[1].m_destroy);
+        EXPECT_EQ(m_spawner->m_batches[1].m_instanceIds, AZStd::vector<Vegetation::InstanceId>{ newInstanceId });
+        EXPECT_EQ(GetInstanceCount(), 1);
+    }
+
+    TEST_F(InstanceSystemComponentTests, InstancesDestroyedBeforeCreationAreSkipped)
+    {
+        const Vegetation::DescriptorPtr descriptor = RegisterDescriptor(1.0f);
+
+        const Vegetation::InstanceId instanceId = CreateInstance(descriptor);
+        DestroyInstance(instanceId);
+
+        // Both requests land in the same batch, so the spawner never sees the instance.
+        ProcessTasks();
+        EXPECT_TRUE(m_spawner->m_batches.empty());
+        EXPECT_EQ(m_spawner->m_createInstanceCount, 0);
+        EXPECT_EQ(m_spawner->m_destroyInstanceCount, 0);
+        EXPECT_EQ(GetInstanceCount(), 0);
+        EXPECT_EQ(GetTotalTaskCount(), 0);
+
+        // The id was still released, so it gets recycled.
+        EXPECT_EQ(CreateInstance(descriptor), instanceId);
+    }
+
+    TEST_F(VegetationComponentTests, InstanceSystemDefaultDestroyInstancesDestroysEachInstance)
+    {
+        SingleDestroyInstanceSystem instanceSystem;
+
+        const AZStd::vector<Vegetation::InstanceId> instanceIds = { 3, 1, 4 };
+        instanceSystem.DestroyInstances(instanceIds);
+        EXPECT_EQ(instanceSystem.m_destroyedInstanceIds, instanceIds);
+    }
+}
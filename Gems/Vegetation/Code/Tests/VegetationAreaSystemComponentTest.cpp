@@ -15,9 +15,11 @@
 #include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/algorithm.h>
 
 //////////////////////////////////////////////////////////////////////////
 
+#include <Vegetation/Ebuses/AreaRequestBus.h>
 #include <Vegetation/Ebuses/AreaSystemRequestBus.h>
 #include <VegetationModule.h>
 #include <AreaSystemComponent.h>
@@ -158,5 +160,192 @@ namespace UnitTest
         // This test simply creates an environment that activates and deactivates the vegetation system components.
         // If it runs without asserting / crashing, then it is successful.
     }
-}
 
+    // Vegetation area that claims every point it gets offered, and records which points were offered and released.
+    class MockClaimingArea
+        : public Vegetation::AreaRequestBus::Handler
+    {
+    public:
+        MockClaimingArea(AZ::EntityId areaId)
+            : m_areaId(areaId)
+        {
+            Vegetation::AreaRequestBus::Handler::BusConnect(areaId);
+        }
+
+        ~MockClaimingArea()
+        {
+            Vegetation::AreaRequestBus::Handler::BusDisconnect();
+        }
+
+        bool PrepareToClaim([[maybe_unused]] Vegetation::EntityIdStack& stackIds) override
+        {
+            return true;
+        }
+
+        void ClaimPositions([[maybe_unused]] Vegetation::EntityIdStack& stackIds, Vegetation::ClaimContext& context) override
+        {
+            for (const auto& point : context.m_availablePoints)
+            {
+                m_offeredPoints.push_back(point.m_handle);
+
+                Vegetation::InstanceData instanceData;
+                instanceData.m_id = m_areaId;
+                instanceData.m_position = point.m_position;
+                instanceData.m_scale = m_scale;
+                if (!context.m_existedCallback(point, instanceData))
+                {
+                    ++m_createdCount;
+                    context.m_createdCallback(point, instanceData);
+                }
+            }
+            context.m_availablePoints.clear();
+        }
+
+        void UnclaimPosition(const Vegetation::ClaimHandle handle) override
+        {
+            m_releasedPoints.push_back(handle);
+        }
+
+        void ResetCounters()
+        {
+            m_offeredPoints.clear();
+            m_releasedPoints.clear();
+            m_createdCount = 0;
+        }
+
+        AZ::EntityId m_areaId;
+        float m_scale = 1.0f;
+        AZStd::vector<Vegetation::ClaimHandle> m_offeredPoints;
+        AZStd::vector<Vegetation::ClaimHandle> m_releasedPoints;
+        size_t m_createdCount = 0;
+    };
+
+    // Tests the sector update logic that normally runs on the vegetation thread, without starting the thread.
+    class VegetationSectorUpdateTests
+        : public UnitTest::LeakDetectionFixture
+    {
+    protected:
+        using VegetationThreadTasks = Vegetation::AreaSystemComponent::VegetationThreadTasks;
+        using SectorInfo = Vegetation::AreaSystemComponent::SectorInfo;
+        using SectorId = Vegetation::AreaSystemComponent::SectorId;
+        using DirtySectors = Vegetation::AreaSystemComponent::DirtySectors;
+        using ViewRect = Vegetation::AreaSystemComponent::ViewRect;
+        using VegetationAreaInfo = Vegetation::AreaSystemComponent::VegetationAreaInfo;
+        using VegetationAreaVector = Vegetation::AreaSystemComponent::VegetationAreaVector;
+
+        static constexpr int SectorSizeInMeters = 16;
+        static constexpr int PointsPerSide = 4;
+        static constexpr float PointSpacing = static_cast<float>(SectorSizeInMeters) / PointsPerSide;
+
+        // Gives the sector a flat grid of points, the way UpdateSectorPoints() would for a single flat surface.
+        static void AddSectorPoints(SectorInfo& sectorInfo)
+        {
+            const AZ::Vector3 sectorMin = sectorInfo.m_bounds.GetMin();
+            for (int y = 0; y < PointsPerSide; ++y)
+            {
+                for (int x = 0; x < PointsPerSide; ++x)
+                {
+                    Vegetation::ClaimPoint& claimPoint = sectorInfo.m_baseContext.m_availablePoints.emplace_back();
+                    claimPoint.m_handle = static_cast<Vegetation::ClaimHandle>((y * PointsPerSide) + x + 1);
+                    claimPoint.m_position = AZ::Vector3(
+                        sectorMin.GetX() + (x + 0.5f) * PointSpacing, sectorMin.GetY() + (y + 0.5f) * PointSpacing, 0.0f);
+                    claimPoint.m_normal = AZ::Vector3::CreateAxisZ();
+                }
+            }
+        }
+
+        static VegetationAreaVector CreateAreas(const MockClaimingArea& area)
+        {
+            VegetationAreaInfo areaInfo;
+            areaInfo.m_id = area.m_areaId;
+            areaInfo.m_bounds = AZ::Aabb::CreateNull();
+            return VegetationAreaVector{ areaInfo };
+        }
+    };
+
+    TEST_F(VegetationSectorUpdateTests, MarkDirtySectorsOnlyMarksOverlappedSectors)
+    {
+        VegetationThreadTasks vegTasks;
+        DirtySectors dirtySectors;
+        const float worldToSector = 1.0f / SectorSizeInMeters;
+        const ViewRect viewRect(0, 0, 4, 4, AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(4.0f * SectorSizeInMeters)));
+
+        // A change inside of sector (1, 1) only dirties that sector, and only the changed region of it.
+        const AZ::Aabb firstChange = AZ::Aabb::CreateFromMinMax(AZ::Vector3(18.0f, 18.0f, -10.0f), AZ::Vector3(22.0f, 22.0f, 10.0f));
+        vegTasks.MarkDirtySectors(firstChange, dirtySectors, worldToSector, viewRect);
+        for (int y = 0; y < viewRect.m_height; ++y)
+        {
+            for (int x = 0; x < viewRect.m_width; ++x)
+            {
+                EXPECT_EQ(dirtySectors.IsDirty(SectorId(x, y)), (x == 1) && (y == 1));
+            }
+        }
+        EXPECT_EQ(dirtySectors.GetDirtyRegion(SectorId(1, 1)), firstChange);
+
+        // Another change in the same sector grows the dirty region to cover both.
+        const AZ::Aabb secondChange = AZ::Aabb::CreateFromMinMax(AZ::Vector3(26.0f, 26.0f, 0.0f), AZ::Vector3(28.0f, 28.0f, 1.0f));
+        vegTasks.MarkDirtySectors(secondChange, dirtySectors, worldToSector, viewRect);
+        AZ::Aabb mergedChange(firstChange);
+        mergedChange.AddAabb(secondChange);
+        EXPECT_EQ(dirtySectors.GetDirtyRegion(SectorId(1, 1)), mergedChange);
+
+        // Marking the whole sector dirty overrides any region.
+        dirtySectors.MarkDirty(SectorId(1, 1), AZ::Aabb::CreateNull());
+        EXPECT_TRUE(dirtySectors.IsDirty(SectorId(1, 1)));
+        EXPECT_FALSE(dirtySectors.GetDirtyRegion(SectorId(1, 1)).IsValid());
+        dirtySectors.MarkDirty(SectorId(1, 1), firstChange);
+        EXPECT_FALSE(dirtySectors.GetDirtyRegion(SectorId(1, 1)).IsValid());
+    }
+
+    TEST_F(VegetationSectorUpdateTests, FillSectorWithDirtyRegionOnlyReclaimsPointsInRegion)
+    {
+        MockClaimingArea area(AZ::EntityId(1234));
+        const VegetationAreaVector areas = CreateAreas(area);
+
+        VegetationThreadTasks vegTasks;
+        SectorInfo* sectorInfo = vegTasks.CreateSector(SectorId(0, 0), SectorSizeInMeters);
+        ASSERT_NE(sectorInfo, nullptr);
+        AddSectorPoints(*sectorInfo);
+
+        // A full fill offers and claims every point in the sector.
+        const size_t pointCount = PointsPerSide * PointsPerSide;
+        vegTasks.FillSector(*sectorInfo, areas, AZ::Aabb::CreateNull());
+        EXPECT_EQ(area.m_offeredPoints.size(), pointCount);
+        EXPECT_EQ(area.m_createdCount, pointCount);
+        EXPECT_EQ(sectorInfo->m_claimedWorldPoints.size(), pointCount);
+
+        // Change the area so that every point it reclaims gets a new instance, then refill only the lower left quarter.
+        area.ResetCounters();
+        area.m_scale = 2.0f;
+        const AZ::Aabb dirtyRegion = AZ::Aabb::CreateFromMinMax(
+            AZ::Vector3(0.0f, 0.0f, -1.0f), AZ::Vector3(SectorSizeInMeters / 2.0f, SectorSizeInMeters / 2.0f, 1.0f));
+        vegTasks.FillSector(*sectorInfo, areas, dirtyRegion);
+
+        const size_t pointsInRegion = (PointsPerSide / 2) * (PointsPerSide / 2);
+        EXPECT_EQ(area.m_offeredPoints.size(), pointsInRegion);
+        EXPECT_EQ(area.m_createdCount, pointsInRegion);
+        EXPECT_EQ(area.m_releasedPoints.size(), pointsInRegion);
+        EXPECT_EQ(sectorInfo->m_claimedWorldPoints.size(), pointCount);
+
+        // Only the claims inside the region were replaced, the ones outside of it still hold the original instances.
+        for (const auto& point : sectorInfo->m_baseContext.m_availablePoints)
+        {
+            const bool inRegion = point.m_position.GetX() <= dirtyRegion.GetMax().GetX() && point.m_position.GetY() <= dirtyRegion.GetMax().GetY();
+            auto claimItr = sectorInfo->m_claimedWorldPoints.find(point.m_handle);
+            ASSERT_NE(claimItr, sectorInfo->m_claimedWorldPoints.end());
+            EXPECT_EQ(claimItr->second.m_scale, inRegion ? 2.0f : 1.0f);
+            EXPECT_EQ(AZStd::find(area.m_offeredPoints.begin(), area.m_offeredPoints.end(), point.m_handle) != area.m_offeredPoints.end(), inRegion);
+        }
+
+        // Refilling a region where nothing changed keeps the existing claims without creating or releasing anything.
+        area.ResetCounters();
+        vegTasks.FillSector(*sectorInfo, areas, dirtyRegion);
+        EXPECT_EQ(area.m_offeredPoints.size(), pointsInRegion);
+        EXPECT_EQ(area.m_createdCount, 0u);
+        EXPECT_TRUE(area.m_releasedPoints.empty());
+        EXPECT_EQ(sectorInfo->m_claimedWorldPoints.size(), pointCount);
+
+        vegTasks.ClearSectors();
+        EXPECT_EQ(area.m_releasedPoints.size(), pointCount);
+    }
+}
@@ -93,6 +93,7 @@ set(FILES
     Source/DescriptorListAsset.cpp
     Source/Descriptor.cpp
     Source/EmptyInstanceSpawner.cpp
+    Source/InstanceSpawner.cpp
     Source/PrefabInstanceSpawner.cpp
     Source/VegetationSystemComponent.cpp
     Source/VegetationSystemComponent.h
@@ -13,6 +13,7 @@ set(FILES
     Tests/VegetationComponentDescriptorTests.cpp
     Tests/VegetationComponentFilterTests.cpp
     Tests/EmptyInstanceSpawnerTests.cpp
+    Tests/InstanceSystemComponentTests.cpp
     Tests/PrefabInstanceSpawnerTests.cpp
     Tests/VegetationAreaSystemComponentTest.cpp
     Tests/VegetationTest.cpp